@@ -37,6 +37,7 @@
 #include <complex>
 #include "bertini2/mpfr_extensions.hpp"
 #include "bertini2/mpfr_complex.hpp"
+#include "bertini2/limb_pool.hpp"
 
 #include "bertini2/function_tree.hpp"
 
@@ -49,6 +50,23 @@
 #include <Eigen/LU>
 
 
+namespace bertini {
+
+	/**
+	\brief Start-up for programs using Bertini.  Call at the start of main, before starting any threads.
+
+	\param pool_limbs Whether to install the thread-local pooled allocator for the limbs of multiple precision numbers.  See limb_pool.hpp.
+	*/
+	inline
+	void Initialize(bool pool_limbs = false)
+	{
+		if (pool_limbs)
+			limb_pool::Install();
+	}
+
+} // namespace bertini
+
+
 #endif
 
 
@@ -0,0 +1,259 @@
+/*
+This file is part of Bertini 2.
+
+c_api.h is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+c_api.h is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with c_api.h.  If not, see <http://www.gnu.org/licenses/>.
+
+Copyright(C) 2015, 2016 by Bertini2 Development Team
+
+See <http://www.gnu.org/licenses/> for a copy of the license,
+as well as COPYING.  Bertini2 is provided with permitted
+additional terms in the b2/licenses/ directory.
+
+individual authors of this file include:
+daniel brake, university of notre dame
+*/
+
+/**
+\file c_api.h
+
+\brief A C interface to the compiled evaluator and the batch path tracker, for calling bertini from other languages without going through its templates.
+
+Systems and trackers are opaque handles.  Every function returning a b2_status catches whatever was thrown inside, so no exception crosses the interface; on failure, b2_last_error gives the message, for the calling thread.  Numbers are passed in buffers belonging to the caller, which the functions read and write but never keep.
+
+A complex double is two doubles, the real part then the imaginary, as C99's double complex, Julia's ComplexF64 and Rust's Complex<f64> are laid out.  Vectors of them are contiguous, one point after another, and matrices are row-major.
+
+A multiple precision real at a precision of `bits` is b2_mp_real_bytes(bits) bytes: a b2_mp_real, then the mantissa as ceil(bits/64) 64-bit limbs, least significant first, exactly as MPFR holds it, so nothing is printed or parsed on the way.  A complex is its real part then its imaginary part.  Buffers of them must be 8-byte aligned.
+
+The workspace for evaluation is held by the system handle, and grows only when a call needs more than any before, so repeated calls with the same sizes allocate nothing.  A handle may be used by one thread at a time; use one per thread.
+
+\code
+b2_system* sys;
+if (b2_system_from_file("input", &sys) != B2_OK)
+	fprintf(stderr, "%s\n", b2_last_error());
+b2_system_compile(sys);
+b2_system_eval(sys, num_points, points, times, values, jacobians);
+b2_system_free(sys);
+\endcode
+*/
+
+#ifndef BERTINI_C_API_H
+#define BERTINI_C_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+\brief The version of this interface, raised when it changes incompatibly.
+*/
+#define B2_C_API_VERSION 1
+
+typedef enum b2_status
+{
+	B2_OK = 0,
+	B2_ERROR = 1, /* anything not listed below */
+	B2_ERROR_ARGUMENT = 2, /* a null handle or buffer, or sizes which don't match the system */
+	B2_ERROR_FILE = 3, /* a file which does not exist or cannot be read */
+	B2_ERROR_PARSE = 4, /* an input file which cannot be parsed */
+	B2_ERROR_OUT_OF_MEMORY = 5
+} b2_status;
+
+/**
+\brief How a path ended, as bertini::tracking::SuccessCode.
+*/
+typedef enum b2_path_code
+{
+	B2_PATH_SUCCESS = 0,
+	B2_PATH_HIGHER_PRECISION_NECESSARY,
+	B2_PATH_REDUCE_STEP_SIZE,
+	B2_PATH_GOING_TO_INFINITY,
+	B2_PATH_FAILED_TO_CONVERGE,
+	B2_PATH_MATRIX_SOLVE_FAILURE,
+	B2_PATH_MATRIX_SOLVE_FAILURE_FIRST_PART_OF_PREDICTION,
+	B2_PATH_MAX_NUM_STEPS_TAKEN,
+	B2_PATH_MAX_PRECISION_REACHED,
+	B2_PATH_MIN_STEP_SIZE_REACHED,
+	B2_PATH_FAILURE,
+	B2_PATH_SINGULAR_START_POINT,
+	B2_PATH_EXTERNALLY_TERMINATED,
+	B2_PATH_MIN_TRACK_TIME_REACHED,
+	B2_PATH_SECURITY_MAX_NORM_REACHED,
+	B2_PATH_CYCLE_NUM_TOO_HIGH
+} b2_path_code;
+
+/**
+\brief The header of a real in the packed multiple precision format, followed by its limbs.
+*/
+typedef struct b2_mp_real
+{
+	int64_t kind; /* as mpfr_custom_get_kind: 0 NaN, 1 infinity, 2 zero, 3 regular, negated if the sign is negative */
+	int64_t exponent; /* for a regular number, which is the mantissa, in [1/2,1), times 2^exponent; otherwise 0 */
+} b2_mp_real;
+
+/**
+\brief The result of tracking one path.  The endpoint is written to a separate buffer.
+*/
+typedef struct b2_path_result
+{
+	uint64_t index; /* of the start point */
+	int32_t code; /* a b2_path_code */
+	uint32_t bits; /* the precision in which the path ended, 53 for double */
+	double time_real; /* the time at which the path ended, the end time unless it failed */
+	double time_imag;
+} b2_path_result;
+
+typedef struct b2_tracker_settings
+{
+	double tracking_tolerance; /* the length of a Newton step below which a correction has converged */
+	double path_truncation_threshold; /* the norm beyond which a path is going to infinity */
+	double initial_step_size;
+	double min_step_size;
+	double max_step_size;
+	uint64_t max_num_steps;
+	unsigned max_num_newton_iterations;
+	int adaptive_precision; /* nonzero to finish the paths which need more than double precision in adaptive precision, rather than report where they stopped */
+} b2_tracker_settings;
+
+typedef struct b2_system b2_system;
+typedef struct b2_tracker b2_tracker;
+
+
+/**
+\brief B2_C_API_VERSION, as the library was built.
+*/
+unsigned b2_api_version(void);
+
+/**
+\brief The message of the last call on this thread which failed.  Valid until the next call which fails.
+*/
+char const* b2_last_error(void);
+
+
+/* ---- multiple precision numbers ---- */
+
+/**
+\brief The bytes taken by one real in the packed format at a precision of bits.
+*/
+size_t b2_mp_real_bytes(unsigned bits);
+
+/**
+\brief Pack a double into a real at a precision of bits.
+*/
+b2_status b2_mp_from_double(double x, unsigned bits, void* packed);
+
+/**
+\brief Round a packed real at a precision of bits to a double.
+
+Fails with B2_ERROR_ARGUMENT for a real MPFR could not have written: of an unknown kind, or regular with its exponent out of range or its most significant bit clear.  b2_system_eval_mp checks its packed inputs the same way.
+*/
+b2_status b2_mp_to_double(void const* packed, unsigned bits, double* x);
+
+
+/* ---- systems ---- */
+
+/**
+\brief Make a system from a classic input file.  Only the INPUT section is read.
+*/
+b2_status b2_system_from_file(char const* path, b2_system** system);
+
+/**
+\brief Make a system from the bytes of a serialized system, as written by bertini::SystemToBytes, or a cache file.
+*/
+b2_status b2_system_from_bytes(void const* data, size_t size, b2_system** system);
+
+/**
+\brief Make a system from a file written by bertini::SaveSharedSystem, with its compiled program mapped read-only, and so shared, rather than copied, by every process mapping the file.
+*/
+b2_status b2_system_map_shared(char const* path, b2_system** system);
+
+/**
+\brief Free a system.  Null is ignored.  Trackers of it must be freed first.
+*/
+void b2_system_free(b2_system* system);
+
+/**
+\brief Compile the system into a straight-line program, differentiated in forward mode, so that evaluation compiles nothing.  Done on the first evaluation otherwise.
+*/
+b2_status b2_system_compile(b2_system* system);
+
+size_t b2_system_num_variables(b2_system const* system);
+
+/**
+\brief The number of functions, the patches included, so the number of rows of the Jacobian.
+*/
+size_t b2_system_num_functions(b2_system const* system);
+
+int b2_system_has_path_variable(b2_system const* system);
+
+/**
+\brief Evaluate the functions, and optionally the Jacobian, at many points, in double precision.
+
+Systems with a path variable are evaluated in batches of points in lockstep.
+
+\param points num_points times num_variables complex doubles.
+\param times num_points complex doubles, the values of the path variable, or null if the system has none.
+\param values Written with num_points times num_functions complex doubles.
+\param jacobians Written with num_points Jacobians, each num_functions by num_variables, row-major, or null to skip them.
+*/
+b2_status b2_system_eval(b2_system* system, size_t num_points, double const* points, double const* times, double* values, double* jacobians);
+
+/**
+\brief Evaluate as b2_system_eval does, in multiple precision, with the numbers packed at a precision of bits.
+
+The results are rounded to bits.
+*/
+b2_status b2_system_eval_mp(b2_system* system, unsigned bits, size_t num_points, void const* points, void const* times, void* values, void* jacobians);
+
+
+/* ---- tracking ---- */
+
+/**
+\brief The settings bertini tracks with by default.
+*/
+void b2_tracker_default_settings(b2_tracker_settings* settings);
+
+/**
+\brief Make a tracker of a system, which must have a path variable and be square.  The system must outlive the tracker, and is evaluated by it, so may not be used by another thread while it tracks.
+
+\param settings Null for the defaults.
+*/
+b2_status b2_tracker_create(b2_system* system, b2_tracker_settings const* settings, b2_tracker** tracker);
+
+/**
+\brief Free a tracker.  Null is ignored.
+*/
+void b2_tracker_free(b2_tracker* tracker);
+
+/**
+\brief Track paths from start_time to end_time, in batches in lockstep.
+
+\param start_points num_paths times num_variables complex doubles.
+\param results num_paths results, written in the order of the start points.
+\param endpoints Written with num_paths times num_variables complex doubles, rounded if a path ended in more precision.
+*/
+b2_status b2_tracker_track(b2_tracker* tracker, size_t num_paths, double const* start_points, double start_time, double end_time, b2_path_result* results, double* endpoints);
+
+/**
+\brief Track as b2_tracker_track does, writing the endpoints packed at a precision of bits.
+*/
+b2_status b2_tracker_track_mp(b2_tracker* tracker, size_t num_paths, double const* start_points, double start_time, double end_time, b2_path_result* results, unsigned bits, void* endpoints);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -55,6 +55,12 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/utility/string_ref.hpp>
 
 
 namespace bertini
@@ -120,6 +126,237 @@ namespace bertini
 				return out;
 			}
 		};
+
+
+
+		/**
+		\brief Append text to a string, less its comments.
+
+		A comment runs from a % to the end of its line, and the end of line is kept.  This is a single pass over the text, and costs time linear in its length.
+
+		\param first The beginning of the text.
+		\param last One past the end of the text.
+		\param out The string to which to append the text without comments.
+		*/
+		template<typename Iterator>
+		void StripCommentsInto(Iterator first, Iterator last, std::string & out)
+		{
+			bool in_comment = false;
+			for (; first!=last; ++first)
+			{
+				const char c = *first;
+				if (c=='\n')
+					in_comment = false;
+				else if (c=='%')
+					in_comment = true;
+
+				if (!in_comment)
+					out.push_back(c);
+			}
+		}
+
+
+
+		/**
+		\brief A classic input file, with its comments stripped, split into its config and input sections.
+
+		This is the same split as made by parsing::SplitFileInputConfig, but made in one pass to strip the comments and a few searches for the markers CONFIG, END;, and INPUT, so that its cost is linear in the size of the file.  The text is held once, and the sections are ranges in it, so no further copies are made before the input is parsed.
+
+		\code
+		auto file = bertini::classic::PreprocessedInputFile::FromFile("input");
+		bertini::System sys;
+		bertini::SystemParser<bertini::classic::PreprocessedInputFile::const_iterator> S;
+		bool s = file.ParseInput(S, sys);
+		\endcode
+
+		Unlike the split parser, comments are stripped before looking for the markers, so a marker in a comment is ignored.
+		*/
+		class PreprocessedInputFile
+		{
+		public:
+			using const_iterator = std::string::const_iterator;
+
+			/**
+			\brief Strip and split the text in a range of characters.
+			*/
+			template<typename Iterator>
+			PreprocessedInputFile(Iterator first, Iterator last)
+			{
+				StripCommentsInto(first, last, text_);
+				Split();
+			}
+
+			/**
+			\brief Strip and split the text of a whole input file.
+			*/
+			explicit
+			PreprocessedInputFile(std::string const& text) : PreprocessedInputFile(text.begin(), text.end())
+			{}
+
+			/**
+			\brief Strip and split a file, read through a memory mapping, so that the only copy made of it is the stripped text.
+
+			\throws std::runtime_error if the file does not exist or cannot be mapped.
+			*/
+			static
+			PreprocessedInputFile FromFile(boost::filesystem::path const& input_file)
+			{
+				if (!boost::filesystem::exists(input_file))
+					throw std::runtime_error("input file " + input_file.string() + " does not exist");
+
+				if (boost::filesystem::file_size(input_file)==0)
+					return PreprocessedInputFile(std::string());
+
+				try
+				{
+					using namespace boost::interprocess;
+					file_mapping mapping(input_file.string().c_str(), read_only);
+					mapped_region region(mapping, read_only);
+					char const* data = static_cast<char const*>(region.get_address());
+					return PreprocessedInputFile(data, data + region.get_size());
+				}
+				catch (boost::interprocess::interprocess_exception const& e)
+				{
+					throw std::runtime_error("unable to map input file " + input_file.string() + ": " + e.what());
+				}
+			}
+
+
+			/**
+			\brief Whether the file could be split into its sections.  See SplitInputFile::Readable.
+			*/
+			bool Readable() const
+			{
+				return readable_;
+			}
+
+			/**
+			\brief The config section, as a view into the stripped text.
+			*/
+			boost::string_ref Config() const
+			{
+				return boost::string_ref(text_.data() + config_.first, config_.second - config_.first);
+			}
+
+			/**
+			\brief The input section, as a view into the stripped text.
+			*/
+			boost::string_ref Input() const
+			{
+				return boost::string_ref(text_.data() + input_.first, input_.second - input_.first);
+			}
+
+			const_iterator ConfigBegin() const { return text_.begin() + config_.first; }
+			const_iterator ConfigEnd() const { return text_.begin() + config_.second; }
+			const_iterator InputBegin() const { return text_.begin() + input_.first; }
+			const_iterator InputEnd() const { return text_.begin() + input_.second; }
+
+			/**
+			\brief Parse the input section in place, with a parser such as SystemParser<const_iterator>.
+
+			\return Whether the parse succeeded, and used the whole section.
+			*/
+			template<typename ParserT, typename AttributeT>
+			bool ParseInput(ParserT const& parser, AttributeT & attribute) const
+			{
+				auto iter = InputBegin();
+				auto end = InputEnd();
+				return boost::spirit::qi::phrase_parse(iter, end, parser, boost::spirit::ascii::space, attribute) && iter==end;
+			}
+
+			/**
+			\brief Copy the sections into a SplitInputFile, for code expecting one.
+			*/
+			SplitInputFile ToSplitInputFile() const
+			{
+				SplitInputFile split;
+				split.SetConfigInput(Config().to_string(), Input().to_string());
+				split.SetReadable(readable_);
+				return split;
+			}
+
+		private:
+
+			using Range = std::pair<std::size_t, std::size_t>;
+
+			// follows the cases of parsing::SplitFileInputConfig, numbered as there
+			void Split()
+			{
+				const auto npos = std::string::npos;
+				const auto end = text_.size();
+				const std::size_t config_length = 6, end_length = 4, input_length = 5;
+				auto find = [this](char const* marker, std::size_t from){ return text_.find(marker, from); };
+
+				const auto c = find("CONFIG", 0);
+				if (c!=npos)
+				{
+					const auto a = c + config_length;
+					const auto e1 = find("END;", a);
+					if (e1==npos)
+					{
+						const auto n = find("INPUT", a);
+						if (n==npos) // 8
+							SetUnreadable();
+						else // 10
+							SetSections({a, n}, {n+input_length, end});
+						return;
+					}
+
+					const auto n = find("INPUT", e1+end_length);
+					if (n!=npos) // 15, 14
+					{
+						const auto e2 = find("END;", n+input_length);
+						SetSections({a, e1}, {n+input_length, e2==npos ? end : e2});
+						return;
+					}
+
+					const auto e2 = find("END;", e1+end_length);
+					const auto n0 = find("INPUT", a);
+					if (e2!=npos) // 13
+						SetSections({a, e1}, {e1+end_length, e2});
+					else if (n0 < e1) // 11
+						SetSections({a, n0}, {n0+input_length, e1});
+					else // 12
+						SetSections({a, e1}, {e1+end_length, end});
+					return;
+				}
+
+				const auto e1 = find("END;", 0);
+				if (e1!=npos && (find("INPUT", e1+end_length)!=npos || find("END;", e1+end_length)!=npos)) // 7, 6, 5
+				{
+					SetUnreadable();
+					return;
+				}
+
+				const auto n = find("INPUT", 0);
+				if (n!=npos) // 3, 2
+				{
+					const auto e = find("END;", n+input_length);
+					SetSections({0, 0}, {n+input_length, e==npos ? end : e});
+				}
+				else if (e1!=npos) // 1
+					SetSections({0, 0}, {0, e1});
+				else // 0
+					SetSections({0, 0}, {0, end});
+			}
+
+			void SetSections(Range const& config, Range const& input)
+			{
+				config_ = config;
+				input_ = input;
+			}
+
+			void SetUnreadable()
+			{
+				readable_ = false;
+				config_ = input_ = {0, 0};
+			}
+
+			std::string text_; ///< The text of the file, less comments.
+			Range config_ = {0, 0}; ///< The offsets of the config section in text_.
+			Range input_ = {0, 0}; ///< The offsets of the input section in text_.
+			bool readable_ = true;
+		};
 		namespace parsing
 		{
 			/**
@@ -310,7 +547,8 @@ namespace bertini
                     
                     root_rule_.name("CommentStripper_root_rule");
                     
-                    root_rule_ = eps[_val = ""] >> *line_[_val = _val + _1 + "\n"] >> -last_line_[_val = _val + _1 + "\n"];//+line_ | qi::eoi;
+                    // append in place, rather than building a new string for each line, which would be quadratic in the length of the text
+                    root_rule_ = eps[_val = ""] >> *line_[_val += _1, _val += '\n'] >> -last_line_[_val += _1, _val += '\n'];//+line_ | qi::eoi;
                     
                     
                     line_.name("line_of_commented_input");
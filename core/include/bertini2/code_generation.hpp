@@ -0,0 +1,74 @@
+//This file is part of Bertini 2.
+//
+//code_generation.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//code_generation.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with code_generation.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file code_generation.hpp
+
+\brief Writes C++ kernels for a fixed system ahead of time, to be compiled into a program with the rest of its code, as the b2-codegen tool does.
+
+A system which never changes need not be parsed, differentiated and compiled to a StraightLineProgram at every run, nor interpreted.  Its program is written out once as a header, a struct of static function templates, one local per register and no dispatch, for the compiler to optimize, vectorize, and profile, as any other code.  The header includes generated_system.hpp, and names a GeneratedSystem of the struct, whose evaluation runs the kernels:
+
+\code
+b2-codegen --name Cyclic5 -o cyclic5.hpp input
+\endcode
+
+\code
+#include "cyclic5.hpp"
+
+bertini::generated::Cyclic5System sys;
+// homogenize, patch, and track as any other system
+\endcode
+*/
+
+#ifndef BERTINI_CODE_GENERATION_HPP
+#define BERTINI_CODE_GENERATION_HPP
+
+#include <string>
+
+#include "bertini2/system.hpp"
+
+
+namespace bertini {
+
+	namespace codegen {
+
+	/**
+	\brief Write a header of kernels for a system.
+
+	The header defines, in namespace bertini::generated, a struct with the name given, holding the input section from which the system is parsed again by GeneratedSystem, whether it was homogenized, the names of its inputs, its constants, and the templates Eval, Jacobian and TimeDerivative, see StraightLineProgram::WriteCode, and names GeneratedSystem of it as that name followed by System.
+
+	\param sys The system, as parsed from input, and homogenized or not.  GeneratedSystem parses it again and homogenizes it likewise.  Patches are not part of the kernels, so it should not be patched.
+	\param input The input section from which the system was parsed.
+	\param name The name of the struct.  Must be a C++ identifier.
+	\param digits The number of digits to which the constants are written, enough for the highest precision at which the system will be evaluated.
+
+	\throws std::runtime_error if name is not an identifier, or the system cannot be compiled to a StraightLineProgram.
+	*/
+	std::string GenerateHeader(System const& sys, std::string const& input, std::string const& name, unsigned digits = 50);
+
+	} // namespace codegen
+
+} // namespace bertini
+
+#endif
@@ -0,0 +1,155 @@
+//This file is part of Bertini 2.
+//
+//complex_kernels.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//complex_kernels.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with complex_kernels.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file complex_kernels.hpp
+
+\brief Kernels on complex doubles: products without the recovery of infinities of std::complex, and the array operations of the double precision linear algebra, vectorized for the processor found at run time.
+
+The product of two std::complex<double> follows Annex G of C99, and checks its result for NaN's to recover infinities, a call to __muldc3 unless compiled with -fcx-limited-range.  Multiply and MultiplyAdd here are the textbook formulas, which is what bertini wants: a product overflowing to infinity or NaN is a path going to infinity either way.  They have overloads for the other number types, which just multiply, so that code templated on the number type can call them.
+
+Axpy and Dot run over arrays of complex doubles, stored as std::complex is, with the real and imaginary parts interleaved.  The instructions they use, AVX-512, AVX2 with FMA, NEON, or none, are chosen the first time one is called, for the best the processor has, see ActiveInstructionSet.  MatVec and the triangular solves are built from them, by columns.  They are the counterparts for double precision of the kernels of mpfr_slab.hpp.
+*/
+
+#ifndef BERTINI_COMPLEX_KERNELS_HPP
+#define BERTINI_COMPLEX_KERNELS_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+
+#include <cstddef>
+
+
+namespace bertini {
+namespace kernels {
+
+	/**
+	\brief The instructions the array kernels may be run with.
+	*/
+	enum class InstructionSet
+	{
+		Scalar,
+		AVX2,
+		AVX512,
+		NEON
+	};
+
+	/**
+	\brief The instructions the array kernels run with, the best the processor has, unless changed by UseInstructionSet.
+	*/
+	InstructionSet ActiveInstructionSet();
+
+	/**
+	\brief Whether this build and processor can run the kernels with a set of instructions.
+	*/
+	bool Supported(InstructionSet set);
+
+	/**
+	\brief Run the array kernels with a set of instructions, on every thread, for comparing them.
+
+	\throws std::runtime_error if the set is not Supported.
+	*/
+	void UseInstructionSet(InstructionSet set);
+
+	char const* Name(InstructionSet set);
+
+
+	/**
+	\brief a*b, by the textbook formula.
+	*/
+	inline dbl Multiply(dbl const& a, dbl const& b)
+	{
+		return dbl(a.real()*b.real() - a.imag()*b.imag(), a.real()*b.imag() + a.imag()*b.real());
+	}
+
+	template<typename T>
+	T Multiply(T const& a, T const& b)
+	{
+		return a*b;
+	}
+
+	/**
+	\brief result += a*b, by the textbook formula.
+	*/
+	inline void MultiplyAdd(dbl & result, dbl const& a, dbl const& b)
+	{
+		result = dbl(result.real() + a.real()*b.real() - a.imag()*b.imag(), result.imag() + a.real()*b.imag() + a.imag()*b.real());
+	}
+
+	template<typename T>
+	void MultiplyAdd(T & result, T const& a, T const& b)
+	{
+		result += a*b;
+	}
+
+
+	namespace detail {
+
+		/**
+		\brief The array kernels for one set of instructions.
+		*/
+		struct KernelTable
+		{
+			void (*axpy)(std::size_t n, dbl alpha, dbl const* x, dbl* y);
+			dbl (*dot)(std::size_t n, dbl const* x, dbl const* y);
+		};
+
+		KernelTable const& ActiveKernels();
+	}
+
+
+	/**
+	\brief y += alpha*x, for arrays of n entries.
+	*/
+	inline void Axpy(std::size_t n, dbl const& alpha, dbl const* x, dbl* y)
+	{
+		detail::ActiveKernels().axpy(n, alpha, x, y);
+	}
+
+	/**
+	\brief The sum of x_i*y_i, not conjugated, for arrays of n entries.
+	*/
+	inline dbl Dot(std::size_t n, dbl const* x, dbl const* y)
+	{
+		return detail::ActiveKernels().dot(n, x, y);
+	}
+
+	/**
+	\brief y = A*x, for A rows by cols, stored by columns, with a stride of lda between them.  y may not overlap A or x.
+	*/
+	void MatVec(std::size_t rows, std::size_t cols, dbl const* A, std::size_t lda, dbl const* x, dbl* y);
+
+	/**
+	\brief Solve Lx = b in place, for L n by n, stored by columns with a stride of ld, lower triangular with a unit diagonal, which is not read.
+	*/
+	void SolveUnitLower(std::size_t n, dbl const* L, std::size_t ld, dbl* x);
+
+	/**
+	\brief Solve Ux = b in place, for U n by n, stored by columns with a stride of ld, upper triangular.
+	*/
+	void SolveUpper(std::size_t n, dbl const* U, std::size_t ld, dbl* x);
+
+} // namespace kernels
+} // namespace bertini
+
+#endif
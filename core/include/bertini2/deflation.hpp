@@ -0,0 +1,269 @@
+//This file is part of Bertini 2.
+//
+//deflation.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//deflation.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with deflation.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file deflation.hpp
+
+\brief Deflate a system at a singular root, so that Newton's method converges to it quadratically again.
+
+At a root \f$x^*\f$ of \f$f\f$ at which the Jacobian has rank \f$r < n\f$, Newton's method converges only linearly, and no better than the square root of the working precision, so the endgame is left to supply the accuracy.  Deflation, after Leykin, Verschelde and Zhao, adds to the system that the Jacobian has a null vector, in multipliers \f$\lambda \in \mathbb{C}^{r+1}\f$:
+
+\f[ f(x) = 0, \qquad J(x) B \lambda = 0, \qquad h^T \lambda = 1, \f]
+
+with \f$B\f$ an \f$n \times (r+1)\f$ and \f$h\f$ an \f$r+1\f$ random matrix and vector.  The null space of \f$J(x^*)\f$ has dimension \f$n-r\f$, so meets the columns of \f$B\f$ in a line, and \f$(x^*, \lambda^*)\f$ is a root of the deflated system.  Its multiplicity is lower than that of \f$x^*\f$, and for most singular roots one or two deflations make it nonsingular.
+
+\f$J(x)v\f$ is the derivative of \f$f\f$ in the direction \f$v\f$, so is built as one tree per function, by putting the entries of \f$v = B\lambda\f$ in place of the differentials in the derivative tree of the function, see node::SubstituteDifferentials.  The deflated system is overdetermined, and is made square by random linear combinations of its functions.
+*/
+
+#ifndef BERTINI_DEFLATION_HPP
+#define BERTINI_DEFLATION_HPP
+
+#include "bertini2/system.hpp"
+#include "bertini2/lu.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace bertini {
+
+	/**
+	\brief Settings for refining a singular root by deflation.
+	*/
+	struct DeflationConfig
+	{
+		double rank_tolerance = 1e-6; ///< Singular values of the Jacobian below this, relative to the largest, count as zero in its numerical rank.
+		double tolerance = 1e-11; ///< Newton's method on the deflated system has converged once its step is this short, relative to the norm of the point.
+		unsigned max_newton_iterations = 8; ///< The number of Newton steps on the nonsingular system.
+		unsigned max_deflations = 3; ///< The most times the system is deflated, before giving up on the root.
+	};
+
+
+	/**
+	\brief The numerical rank of a matrix, the number of its singular values above a tolerance relative to the largest.
+
+	\param J The matrix.
+	\param relative_tolerance Singular values at most this times the largest count as zero.
+	*/
+	unsigned NumericalRank(Mat<dbl> const& J, double relative_tolerance);
+
+
+	/**
+	\brief A system deflated once, at a root at which its Jacobian has a given rank.
+
+	## Use
+
+	\code
+	DeflatedSystem deflated(sys, rank);
+	Vec<mpfr> lifted = deflated.Lift(x, sys.Jacobian(x));
+	// Newton's method on deflated.GetSystem(), from lifted
+	\endcode
+
+	The variables are those of the system, followed by the multipliers, in a group of their own.  Its functions share the trees of the system, so the two must not be evaluated at the same time, on different threads.
+	*/
+	class DeflatedSystem
+	{
+	public:
+
+		/**
+		\param sys The system to deflate, square counting its patches.  Kept in the deflated system, so should be a copy of its own, see the class notes.
+		\param rank The numerical rank of its Jacobian at the root.
+
+		\throws std::runtime_error if the system is not square, or the rank is not below the number of variables.
+		*/
+		DeflatedSystem(System const& sys, unsigned rank);
+
+		/**
+		\brief The deflated system, in the variables of the system and the multipliers.
+		*/
+		System const& GetSystem() const
+		{
+			return deflated_;
+		}
+
+		/**
+		\brief The rank of the Jacobian at which the system was deflated.
+		*/
+		unsigned Rank() const
+		{
+			return rank_;
+		}
+
+		/**
+		\brief The number of multipliers, one more than the rank.
+		*/
+		unsigned NumMultipliers() const
+		{
+			return static_cast<unsigned>(multipliers_.size());
+		}
+
+		/**
+		\brief Lift an approximate root of the system to one of the deflated system, by the multipliers best making a null vector of its Jacobian.
+
+		Solves \f$[J B; h^T] \lambda = e\f$, with \f$e\f$ the last unit vector, in the least squares sense, by its normal equations.
+
+		\param x The approximate root.
+		\param J The Jacobian of the system at it, including patches.
+
+		\return x, followed by the multipliers.
+
+		\throws std::runtime_error if the normal equations are singular.
+		*/
+		template<typename ComplexType>
+		Vec<ComplexType> Lift(Vec<ComplexType> const& x, Mat<ComplexType> const& J) const
+		{
+			const auto n = x.size();
+			const auto m = static_cast<Eigen::DenseIndex>(multipliers_.size());
+
+			Mat<ComplexType> B(n, m);
+			for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+				for (Eigen::DenseIndex kk = 0; kk < m; ++kk)
+					B(jj,kk) = null_space_mixing_[jj*m+kk]->template Eval<ComplexType>();
+
+			Mat<ComplexType> M(J.rows()+1, m);
+			M.topRows(J.rows()) = J*B;
+			for (Eigen::DenseIndex kk = 0; kk < m; ++kk)
+				M(J.rows(),kk) = normalization_[kk]->template Eval<ComplexType>();
+
+			Vec<ComplexType> e = Vec<ComplexType>::Zero(J.rows()+1);
+			e(J.rows()) = ComplexType(1);
+
+			const Mat<ComplexType> A = M.adjoint()*M;
+			PartialPivotLU<ComplexType> lu(m);
+			lu.Factor(A);
+			if (LUPartialPivotDecompositionSuccessful(lu.MatrixLU())!=MatrixSuccessCode::Success)
+				throw std::runtime_error("lifting a point to a deflated system, the normal equations for the multipliers are singular");
+
+			Vec<ComplexType> lambda(m);
+			lu.Solve(lambda, Vec<ComplexType>(M.adjoint()*e));
+
+			Vec<ComplexType> lifted(n+m);
+			lifted.head(n) = x;
+			lifted.tail(m) = lambda;
+			return lifted;
+		}
+
+	private:
+
+		System deflated_;
+		unsigned rank_;
+		VariableGroup multipliers_;
+		std::vector< std::shared_ptr<node::Rational> > null_space_mixing_; ///< The entries of B, by rows.
+		std::vector< std::shared_ptr<node::Rational> > normalization_; ///< The entries of h.
+	};
+
+
+	/**
+	\brief Refine an approximation of a root of a system, deflating it while the Jacobian is rank deficient, then by Newton's method.
+
+	## Use
+
+	\code
+	Vec<mpfr> root;
+	unsigned num_deflations;
+	if (RefineByDeflation(root, num_deflations, sys, endgame.FinalApproximation<mpfr>(), DeflationConfig()))
+		// root is accurate to config.tolerance
+	\endcode
+
+	At the approximation, the rank of the Jacobian is estimated, in double precision.  While it is deficient, and there have been fewer than config.max_deflations, the system is deflated, and the approximation lifted.  Then Newton's method is run on the last system, which is nonsingular, so converges quadratically.  A system with a path variable is evaluated at t=0.  Everything is at the precision of the approximation.
+
+	The deflated systems share the trees of the system, and evaluate them, so it must not be evaluated on another thread meanwhile.
+
+	\param root The refined root, in the variables of the system.  Set only on success.
+	\param num_deflations The number of times the system was deflated.
+	\param sys The system, square counting its patches.
+	\param approximation The approximate root.
+	\param config The tolerances, and the most deflations.
+
+	\return Whether Newton's method converged on the nonsingular system.
+	*/
+	template<typename ComplexType>
+	bool RefineByDeflation(Vec<ComplexType> & root, unsigned & num_deflations, System const& sys,
+	                       Vec<ComplexType> const& approximation, DeflationConfig const& config)
+	{
+		using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+		const auto precision = Precision(approximation(0));
+		DefaultPrecision(precision);
+
+		const ComplexType zero(0);
+		auto jacobian = [&](System const& s, Vec<ComplexType> const& x)
+		{
+			return s.HavePathVariable() ? s.Jacobian(x, zero) : s.Jacobian(x);
+		};
+		auto eval = [&](System const& s, Vec<ComplexType> const& x)
+		{
+			return s.HavePathVariable() ? s.Eval(x, zero) : s.Eval(x);
+		};
+
+		std::vector< std::unique_ptr<DeflatedSystem> > deflated;
+		System const* current = &sys;
+		Vec<ComplexType> x = approximation;
+		num_deflations = 0;
+
+		current->precision(precision);
+		Mat<ComplexType> J = jacobian(*current, x);
+		for (;;)
+		{
+			Mat<dbl> J_d(J.rows(), J.cols());
+			for (Eigen::DenseIndex ii = 0; ii < J.rows(); ++ii)
+				for (Eigen::DenseIndex jj = 0; jj < J.cols(); ++jj)
+					J_d(ii,jj) = static_cast<dbl>(J(ii,jj));
+
+			const auto rank = NumericalRank(J_d, config.rank_tolerance);
+			if (rank==x.size() || num_deflations==config.max_deflations)
+				break;
+
+			deflated.emplace_back(new DeflatedSystem(*current, rank));
+			x = deflated.back()->Lift(x, J);
+			current = &deflated.back()->GetSystem();
+			current->precision(precision);
+			++num_deflations;
+
+			J = jacobian(*current, x);
+		}
+
+		PartialPivotLU<ComplexType> lu(x.size());
+		Vec<ComplexType> step(x.size());
+		for (unsigned ii = 0; ii < config.max_newton_iterations; ++ii)
+		{
+			if (ii > 0)
+				J = jacobian(*current, x);
+			lu.Factor(J);
+			if (LUPartialPivotDecompositionSuccessful(lu.MatrixLU())!=MatrixSuccessCode::Success)
+				return false;
+			lu.Solve(step, eval(*current, x));
+			x -= step;
+
+			if (step.norm() <= RealType(config.tolerance)*(1+x.norm()))
+			{
+				root = x.head(sys.NumVariables());
+				return true;
+			}
+		}
+		return false;
+	}
+
+} // namespace bertini
+
+#endif
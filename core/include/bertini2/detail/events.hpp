@@ -42,6 +42,11 @@
 #ifndef BERTINI_DETAIL_EVENTS_HPP
 #define BERTINI_DETAIL_EVENTS_HPP
 #include <boost/type_index.hpp>
+
+#include <atomic>
+#include <typeindex>
+#include <vector>
+
 namespace bertini {
 
 	/**
@@ -53,8 +58,60 @@ namespace bertini {
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
 		virtual ~AnyEvent() = default;
+
+		/**
+		\brief Whether this event type is, or derives from, the type with the given index.
+
+		Every event type must define its own, with BERTINI_EVENT_IS_A, so that observers which declare the types they handle receive it.  ADD_BERTINI_EVENT_TYPE does so.
+		*/
+		static bool IsA(std::type_index const& t)
+		{
+			return t==std::type_index(typeid(AnyEvent));
+		}
 	};
 
+
+	/**
+	\brief Defines the static IsA function of an event type, for filtering without an instance.
+
+	\param event_type The event type being defined.
+	\param event_parent The event type it derives from, with its template arguments.
+	*/
+	#define BERTINI_EVENT_IS_A(event_type, event_parent) \
+		static bool IsA(std::type_index const& t) \
+		{ return t==std::type_index(typeid(event_type)) || event_parent::IsA(t); }
+
+
+	/**
+	\brief The list of event types an observer handles, as returned by AnyObserver::HandledEvents.
+	*/
+	template<typename... EventTypes>
+	std::vector<std::type_index> EventTypeList()
+	{
+		return {std::type_index(typeid(EventTypes))...};
+	}
+
+
+	namespace detail {
+
+		inline
+		std::size_t NextEventTypeIndex()
+		{
+			static std::atomic<std::size_t> next(0);
+			return next++;
+		}
+
+		/**
+		\brief A small integer, unique to each event type, by which observables index their lists of subscribers.
+		*/
+		template<typename EventT>
+		std::size_t EventTypeIndex()
+		{
+			static const std::size_t index = NextEventTypeIndex();
+			return index;
+		}
+	}
+
 	/**
 	\brief For emission of events from observables.
 	
@@ -81,6 +138,8 @@ namespace bertini {
 
 		virtual ~Event() = default;
 
+		BERTINI_EVENT_IS_A(Event, AnyEvent)
+
 		/**
 		\brief Get the emitting object, by `const` reference.
 
@@ -110,6 +169,7 @@ namespace bertini {
 	public: \
 		event_name(const ObservedT & obs) : event_parenttype<ObservedT>(obs){} \
 		virtual ~event_name() = default; \
+		BERTINI_EVENT_IS_A(event_name, event_parenttype<ObservedT>) \
 		event_name() = delete; }
 	
 } //re: namespace bertini
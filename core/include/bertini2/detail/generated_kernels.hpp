@@ -0,0 +1,91 @@
+//This file is part of Bertini 2.
+//
+//generated_kernels.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//generated_kernels.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with generated_kernels.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// Daniel Brake
+// University of Notre Dame
+//
+
+/**
+\file generated_kernels.hpp
+
+\brief The kernels generated ahead of time for a fixed system, as System holds them, see System::UseGeneratedKernels and generated_system.hpp.
+*/
+
+
+#ifndef BERTINI_DETAIL_GENERATED_KERNELS_HPP
+#define BERTINI_DETAIL_GENERATED_KERNELS_HPP
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/num_traits.hpp"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief The functions of a struct written by codegen::GenerateHeader, instantiated for double and multiple precision, with the names of its inputs and its constants.
+
+	The inputs of the kernels are the variables of the system, in the order of System::Variables, then the path variable, if any, then the implicit parameters.
+	*/
+	struct GeneratedKernels
+	{
+		template<typename T>
+		using Kernel = void (*)(T const* inputs, T const* constants, T* outputs);
+
+		std::vector<std::string> input_names;
+		std::vector< std::pair<std::string, std::string> > constants; ///< The real and imaginary parts of each constant, in decimal.
+
+		std::tuple< Kernel<dbl>, Kernel<mpfr> > eval; ///< The functions, without the patches.
+		std::tuple< Kernel<dbl>, Kernel<mpfr> > jacobian; ///< The Jacobian of the functions, row-major.
+		std::tuple< Kernel<dbl>, Kernel<mpfr> > time_derivative; ///< The derivatives of the functions with respect to the path variable.
+	};
+
+
+	/**
+	\brief The kernels of a generated struct, see codegen::GenerateHeader.
+	*/
+	template<typename Generated>
+	std::shared_ptr<GeneratedKernels const> MakeGeneratedKernels()
+	{
+		auto kernels = std::make_shared<GeneratedKernels>();
+		for (auto name : Generated::InputNames())
+			kernels->input_names.push_back(name);
+		for (auto const& c : Generated::Constants())
+			kernels->constants.emplace_back(c.first, c.second);
+
+		kernels->eval = std::make_tuple(&Generated::template Eval<dbl>, &Generated::template Eval<mpfr>);
+		kernels->jacobian = std::make_tuple(&Generated::template Jacobian<dbl>, &Generated::template Jacobian<mpfr>);
+		kernels->time_derivative = std::make_tuple(&Generated::template TimeDerivative<dbl>, &Generated::template TimeDerivative<mpfr>);
+		return kernels;
+	}
+
+	} // namespace detail
+
+} // namespace bertini
+
+#endif
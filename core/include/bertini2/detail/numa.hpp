@@ -0,0 +1,276 @@
+//This file is part of Bertini 2.
+//
+//numa.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//numa.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with numa.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// Daniel Brake
+// University of Notre Dame
+//
+
+/**
+\file numa.hpp
+
+\brief The NUMA nodes of the machine and their cores, and pinning threads to cores, so that the workers of the parallel drivers stay near their memory.
+
+Memory is placed on the node of the thread which first writes it, so a worker which makes its own system copy, tracker and pools, after being pinned, has them on its own node.  The parallel drivers do so.  Only Linux is asked for its topology, from /sys; elsewhere the machine is taken as one node, and pinning does nothing.
+*/
+
+
+#ifndef BERTINI_DETAIL_NUMA_HPP
+#define BERTINI_DETAIL_NUMA_HPP
+
+#include "bertini2/detail/thread_team.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief The cores of each NUMA node, of those the process may run on.
+	*/
+	struct NumaTopology
+	{
+		std::vector< std::vector<unsigned> > cpus_of_node; ///< For each node with a core the process may use, those cores.
+
+		unsigned NumNodes() const
+		{
+			return static_cast<unsigned>(cpus_of_node.size());
+		}
+
+		unsigned NumCpus() const
+		{
+			unsigned n = 0;
+			for (auto const& cpus : cpus_of_node)
+				n += static_cast<unsigned>(cpus.size());
+			return n;
+		}
+
+		/**
+		\brief The cores to pin workers to, spreading them over the nodes in turn, so that each node's memory bandwidth serves as few of them as can be.  Past one per core, they wrap around.
+		*/
+		std::vector<unsigned> PlaceWorkers(unsigned num_workers) const
+		{
+			std::vector<unsigned> cpus;
+			std::size_t depth = 0, max_depth = 0;
+			for (auto const& node : cpus_of_node)
+				max_depth = std::max(max_depth, node.size());
+			if (max_depth==0)
+				return cpus;
+
+			// the first core of each node, then the second of each, and so on
+			while (cpus.size() < num_workers)
+			{
+				for (auto const& node : cpus_of_node)
+					if (depth < node.size() && cpus.size() < num_workers)
+						cpus.push_back(node[depth]);
+				depth = (depth+1) % max_depth;
+			}
+			return cpus;
+		}
+
+		/**
+		\brief A line describing the topology, such as "2 NUMA nodes: 0-15,32-47 | 16-31,48-63".
+		*/
+		std::string Describe() const
+		{
+			std::stringstream out;
+			out << NumNodes() << " NUMA node" << (NumNodes()==1 ? "" : "s") << ":";
+			for (unsigned node = 0; node < NumNodes(); ++node)
+			{
+				out << (node ? " |" : "") << ' ';
+				auto const& cpus = cpus_of_node[node];
+				for (std::size_t ii = 0; ii < cpus.size(); )
+				{
+					std::size_t jj = ii;
+					while (jj+1 < cpus.size() && cpus[jj+1]==cpus[jj]+1)
+						++jj;
+					out << (ii ? "," : "") << cpus[ii];
+					if (jj > ii)
+						out << '-' << cpus[jj];
+					ii = jj+1;
+				}
+			}
+			return out.str();
+		}
+
+
+		/**
+		\brief Parse a list of cores as Linux writes them, such as "0-3,8,10-11".
+		*/
+		static std::vector<unsigned> ParseCpuList(std::string const& list)
+		{
+			std::vector<unsigned> cpus;
+			std::stringstream in(list);
+			std::string range;
+			while (std::getline(in, range, ','))
+			{
+				if (range.find_first_of("0123456789")==std::string::npos)
+					continue;
+				const auto dash = range.find('-');
+				const unsigned first = static_cast<unsigned>(std::stoul(range.substr(0, dash)));
+				const unsigned last = dash==std::string::npos ? first : static_cast<unsigned>(std::stoul(range.substr(dash+1)));
+				for (unsigned cpu = first; cpu <= last; ++cpu)
+					cpus.push_back(cpu);
+			}
+			return cpus;
+		}
+
+
+		/**
+		\brief The topology of the machine, found once.
+		*/
+		static NumaTopology const& Detect()
+		{
+			static const NumaTopology topology = Find();
+			return topology;
+		}
+
+	private:
+
+		static NumaTopology Find()
+		{
+			NumaTopology topology;
+#ifdef __linux__
+			cpu_set_t allowed;
+			CPU_ZERO(&allowed);
+			const bool know_allowed = sched_getaffinity(0, sizeof(allowed), &allowed)==0;
+
+			// node numbers may have gaps, as when a node has no memory, so look a little past the last found
+			for (unsigned node = 0, misses = 0; misses < 64; ++node)
+			{
+				std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+				std::string list;
+				if (!file || !std::getline(file, list))
+				{
+					++misses;
+					continue;
+				}
+				misses = 0;
+
+				std::vector<unsigned> cpus;
+				for (auto cpu : ParseCpuList(list))
+					if (!know_allowed || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)))
+						cpus.push_back(cpu);
+				if (!cpus.empty())
+					topology.cpus_of_node.push_back(cpus);
+			}
+
+			if (topology.cpus_of_node.empty() && know_allowed)
+			{
+				std::vector<unsigned> cpus;
+				for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+					if (CPU_ISSET(cpu, &allowed))
+						cpus.push_back(cpu);
+				if (!cpus.empty())
+					topology.cpus_of_node.push_back(cpus);
+			}
+#endif
+			if (topology.cpus_of_node.empty())
+			{
+				std::vector<unsigned> cpus(DefaultNumWorkers());
+				for (unsigned ii = 0; ii < cpus.size(); ++ii)
+					cpus[ii] = ii;
+				topology.cpus_of_node.push_back(cpus);
+			}
+			return topology;
+		}
+	};
+
+
+	/**
+	\brief Pin the calling thread to a core.
+
+	\return Whether it was pinned.  Never, off Linux.
+	*/
+	inline bool PinThisThread(unsigned cpu)
+	{
+#ifdef __linux__
+		if (cpu >= CPU_SETSIZE)
+			return false;
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		return pthread_setaffinity_np(pthread_self(), sizeof(set), &set)==0;
+#else
+		(void)cpu;
+		return false;
+#endif
+	}
+
+
+	/**
+	\brief Pins the calling thread to a core for its lifetime, then lets it run where it could before.
+	*/
+	class ScopedPin
+	{
+	public:
+
+		explicit ScopedPin(unsigned cpu)
+		{
+#ifdef __linux__
+			if (pthread_getaffinity_np(pthread_self(), sizeof(previous_), &previous_)==0)
+				pinned_ = PinThisThread(cpu);
+#else
+			(void)cpu;
+#endif
+		}
+
+		~ScopedPin()
+		{
+#ifdef __linux__
+			if (pinned_)
+				pthread_setaffinity_np(pthread_self(), sizeof(previous_), &previous_);
+#endif
+		}
+
+		ScopedPin(ScopedPin const&) = delete;
+		ScopedPin& operator=(ScopedPin const&) = delete;
+
+		bool Pinned() const
+		{
+			return pinned_;
+		}
+
+	private:
+
+		bool pinned_ = false;
+#ifdef __linux__
+		cpu_set_t previous_;
+#endif
+	};
+
+	} // namespace detail
+
+} // namespace bertini
+
+
+#endif
@@ -26,12 +26,24 @@
 
 /**
 \file pool.hpp 
+
+\brief Pools of objects, which hold shared objects, and lend out temporaries, recycling them.
 */
 
 
 #ifndef BERTINI_GENERIC_POOL_HPP
 #define BERTINI_GENERIC_POOL_HPP
 
+#include "bertini2/tracking/instrumentation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 namespace bertini {
 
 	namespace detail {
@@ -62,6 +74,182 @@ namespace bertini {
 
 
 
+	/**
+	\brief The free objects of a pool, by size class, in stripes each with its own lock.
+
+	A thread gives objects back to its own stripe, and draws from it first, so threads drawing and returning temporaries seldom contend for a lock.  Only when its own stripe is out of objects of a size class does a thread look in the others, skipping any which are locked.
+	*/
+	template<typename T>
+	class FreeLists
+	{
+	public:
+
+		static constexpr unsigned NumStripes = 8;
+
+		/**
+		\brief Take a free object of a size class.
+
+		\return The object, or null if there is none free.
+		*/
+		std::unique_ptr<T> Take(std::size_t size_class)
+		{
+			const auto own = OwnStripe();
+			for (unsigned offset = 0; offset < NumStripes; ++offset)
+			{
+				auto& stripe = stripes_[(own + offset) % NumStripes];
+				std::unique_lock<std::mutex> lock(stripe.mutex, std::defer_lock);
+				if (offset==0)
+					lock.lock();
+				else if (!lock.try_lock())
+					continue;
+
+				auto found = stripe.free.find(size_class);
+				if (found!=stripe.free.end() && !found->second.empty())
+				{
+					auto obj = std::move(found->second.back());
+					found->second.pop_back();
+					return obj;
+				}
+			}
+			return nullptr;
+		}
+
+		/**
+		\brief Give back an object of a size class, to the stripe of the calling thread.
+		*/
+		void Give(std::unique_ptr<T> obj, std::size_t size_class)
+		{
+			auto& stripe = stripes_[OwnStripe()];
+			std::lock_guard<std::mutex> lock(stripe.mutex);
+			stripe.free[size_class].push_back(std::move(obj));
+		}
+
+		/**
+		\brief The number of free objects, of all size classes.
+		*/
+		std::size_t NumFree() const
+		{
+			std::size_t num_free = 0;
+			for (auto const& stripe : stripes_)
+			{
+				std::lock_guard<std::mutex> lock(stripe.mutex);
+				for (auto const& size_class : stripe.free)
+					num_free += size_class.second.size();
+			}
+			return num_free;
+		}
+
+		/**
+		\brief Destroy the free objects.
+		*/
+		void Clear()
+		{
+			for (auto& stripe : stripes_)
+			{
+				std::lock_guard<std::mutex> lock(stripe.mutex);
+				stripe.free.clear();
+			}
+		}
+
+	private:
+
+		static unsigned OwnStripe()
+		{
+			return std::hash<std::thread::id>()(std::this_thread::get_id()) % NumStripes;
+		}
+
+		struct Stripe
+		{
+			mutable std::mutex mutex;
+			std::unordered_map< std::size_t, std::vector< std::unique_ptr<T> > > free;
+		};
+
+		std::array<Stripe, NumStripes> stripes_;
+	};
+
+	template<typename T>
+	constexpr unsigned FreeLists<T>::NumStripes;
+
+
+
+	/**
+	\brief An object drawn from a pool, given back to it when the handle is destroyed or assigned to.
+
+	The handle holds the free lists of its pool, so may outlive the pool itself.
+	*/
+	template<typename T>
+	class PoolHandle
+	{
+	public:
+
+		PoolHandle() = default;
+
+		PoolHandle(std::unique_ptr<T> obj, std::shared_ptr< FreeLists<T> > free, std::size_t size_class) : obj_(std::move(obj)), free_(std::move(free)), size_class_(size_class)
+		{}
+
+		PoolHandle(PoolHandle const&) = delete;
+		PoolHandle& operator=(PoolHandle const&) = delete;
+
+		PoolHandle(PoolHandle && other) = default;
+
+		PoolHandle& operator=(PoolHandle && other)
+		{
+			if (this != &other)
+			{
+				GiveBack();
+				obj_ = std::move(other.obj_);
+				free_ = std::move(other.free_);
+				size_class_ = other.size_class_;
+			}
+			return *this;
+		}
+
+		~PoolHandle()
+		{
+			GiveBack();
+		}
+
+		T& operator*() const
+		{
+			return *obj_;
+		}
+
+		T* operator->() const
+		{
+			return obj_.get();
+		}
+
+		T* get() const
+		{
+			return obj_.get();
+		}
+
+		explicit operator bool() const
+		{
+			return static_cast<bool>(obj_);
+		}
+
+	private:
+
+		void GiveBack()
+		{
+			if (obj_ && free_)
+				free_->Give(std::move(obj_), size_class_);
+			obj_.reset();
+		}
+
+		std::unique_ptr<T> obj_;
+		std::shared_ptr< FreeLists<T> > free_;
+		std::size_t size_class_ = 0;
+	};
+
+
+
+	/**
+	\brief A pool of objects, safe to use from several threads.
+
+	Objects added with NonPtrAdd, PtrAdd or NewObj are held, shared, until PurgeCache finds no one else holding them.  Objects drawn with Acquire are on loan, and go back to the free lists of the pool when their handle is destroyed, to be handed out again by a later Acquire, without constructing a new one.
+	*/
 	template<typename T, class PointerPolicy = DefaultPointerPolicy<T> >
 	class Pool
 	{
@@ -70,31 +258,85 @@ namespace bertini {
 		using PoolHolderType = std::vector< HeldType >;
 
 		PoolHolderType held_data_;
+		mutable std::mutex held_mutex_;
+
+		std::shared_ptr< FreeLists<T> > free_ = std::make_shared< FreeLists<T> >();
 
 	public:
 
+		using Handle = PoolHandle<T>;
+
 
 		HeldType NonPtrAdd(T d)
 		{
-			held_data_.push_back(PointerPolicy::FromObj(d));
-			return held_data_.back();
+			auto held = PointerPolicy::FromObj(std::move(d));
+			std::lock_guard<std::mutex> lock(held_mutex_);
+			held_data_.push_back(held);
+			return held;
 		}
 
 		HeldType PtrAdd(HeldType d)
 		{
+			std::lock_guard<std::mutex> lock(held_mutex_);
 			held_data_.push_back(d);
-			return held_data_.back();
+			return d;
 		}
 
 		HeldType NewObj()
 		{
-			held_data_.push_back(PointerPolicy::DefaultConstructed());
-			return held_data_.back();
+			auto held = PointerPolicy::DefaultConstructed();
+			std::lock_guard<std::mutex> lock(held_mutex_);
+			held_data_.push_back(held);
+			return held;
 		}
 
+		/**
+		\brief Drop the held objects no one else holds, and the free objects.
+		*/
 		void PurgeCache()
 		{
-			std::remove_if(held_data_.begin(), held_data_.end(), [](HeldType const& h){return h.use_count()==1;});
+			{
+				std::lock_guard<std::mutex> lock(held_mutex_);
+				held_data_.erase(std::remove_if(held_data_.begin(), held_data_.end(), [](HeldType const& h){return h.use_count()==1;}), held_data_.end());
+			}
+			free_->Clear();
+		}
+
+		/**
+		\brief The number of objects held, not counting those on loan or free.
+		*/
+		std::size_t NumHeld() const
+		{
+			std::lock_guard<std::mutex> lock(held_mutex_);
+			return held_data_.size();
+		}
+
+
+		/**
+		\brief Borrow an object, a free one of the size class if there is one, else a new default constructed one.  Counted as a hit or miss of the calling thread's instrument::ThreadAllocations.
+
+		\param size_class The class the object is given back to, and drawn from.  Objects of one class are interchangeable.
+		*/
+		Handle Acquire(std::size_t size_class = 0)
+		{
+			auto& counts = tracking::instrument::ThreadAllocations();
+			auto obj = free_->Take(size_class);
+			if (obj)
+				++counts.pool_hits;
+			else
+			{
+				++counts.pool_misses;
+				obj.reset(new T());
+			}
+			return Handle(std::move(obj), free_, size_class);
+		}
+
+		/**
+		\brief The number of objects given back, waiting to be drawn again.
+		*/
+		std::size_t NumFree() const
+		{
+			return free_->NumFree();
 		}
 
 	};
@@ -0,0 +1,204 @@
+//This file is part of Bertini 2.
+//
+//shared_array.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//shared_array.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with shared_array.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// Daniel Brake
+// University of Notre Dame
+//
+
+/**
+\file shared_array.hpp
+
+\brief An array either held, or viewed read-only in memory belonging to something else, such as a file mapped by many processes.
+*/
+
+
+#ifndef BERTINI_DETAIL_SHARED_ARRAY_HPP
+#define BERTINI_DETAIL_SHARED_ARRAY_HPP
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+#include "bertini2/memory_usage.hpp"
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief An array of T, either held in a vector of its own, and built by push_back, or a read-only view of memory kept alive by an owner, shared by whatever else views it.
+
+	Reading is through a pointer either way, so costs the same.  Copies of a held array hold copies; copies of a view view the same memory.  T must be trivially copyable to be viewed, as it is read as written.
+	*/
+	template<typename T>
+	class SharedArray
+	{
+	public:
+
+		using const_iterator = T const*;
+
+		SharedArray() = default;
+
+		/**
+		\brief View memory, kept alive by owner for as long as this or a copy of it is.
+		*/
+		SharedArray(T const* data, std::size_t size, std::shared_ptr<void const> const& owner) : data_(data), size_(size), owner_(owner)
+		{}
+
+		SharedArray(SharedArray const& other) : held_(other.held_), owner_(other.owner_)
+		{
+			Point(other);
+		}
+
+		SharedArray(SharedArray && other) : held_(std::move(other.held_)), owner_(std::move(other.owner_))
+		{
+			Point(other);
+		}
+
+		SharedArray& operator=(SharedArray other)
+		{
+			held_.swap(other.held_);
+			owner_.swap(other.owner_);
+			Point(other);
+			return *this;
+		}
+
+		/**
+		\brief Whether this views memory it does not hold.
+		*/
+		bool Viewed() const
+		{
+			return static_cast<bool>(owner_);
+		}
+
+		std::size_t size() const
+		{
+			return size_;
+		}
+
+		bool empty() const
+		{
+			return size_==0;
+		}
+
+		T const* data() const
+		{
+			return data_;
+		}
+
+		T const& operator[](std::size_t ii) const
+		{
+			return data_[ii];
+		}
+
+		const_iterator begin() const
+		{
+			return data_;
+		}
+
+		const_iterator end() const
+		{
+			return data_ + size_;
+		}
+
+		/**
+		\brief Change an entry of a held array.
+		*/
+		T& Mutable(std::size_t ii)
+		{
+			assert(!Viewed());
+			return held_[ii];
+		}
+
+		/**
+		\brief Append to a held array.
+		*/
+		void push_back(T const& t)
+		{
+			assert(!Viewed());
+			held_.push_back(t);
+			Point();
+		}
+
+		/**
+		\brief Exchange the entries of a held array with those of a vector.
+		*/
+		void swap(std::vector<T> & other)
+		{
+			assert(!Viewed());
+			held_.swap(other);
+			Point();
+		}
+
+		/**
+		\brief The bytes held by this array, none if it is a view.
+		*/
+		std::size_t HeldBytes() const
+		{
+			return memory::HeapBytes(held_);
+		}
+
+	private:
+
+		void Point()
+		{
+			data_ = held_.data();
+			size_ = held_.size();
+		}
+
+		// after taking the vector or owner of other
+		void Point(SharedArray const& other)
+		{
+			if (owner_)
+			{
+				data_ = other.data_;
+				size_ = other.size_;
+			}
+			else
+				Point();
+		}
+
+		std::vector<T> held_;
+		T const* data_ = nullptr;
+		std::size_t size_ = 0;
+		std::shared_ptr<void const> owner_; ///< Keeps viewed memory alive, or null if the array is held.
+	};
+
+	} // namespace detail
+
+
+	namespace memory {
+
+		template<typename T>
+		struct Heap< detail::SharedArray<T> >
+		{
+			static std::size_t Bytes(detail::SharedArray<T> const& a)
+			{
+				return a.HeldBytes();
+			}
+		};
+
+	} // namespace memory
+
+} // namespace bertini
+
+#endif
@@ -0,0 +1,225 @@
+//This file is part of Bertini 2.
+//
+//thread_team.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//thread_team.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with thread_team.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// Daniel Brake
+// University of Notre Dame
+//
+
+/**
+\file thread_team.hpp
+
+\brief A team of threads kept waiting, to split one computation, such as evaluating a large system, into parts run at once.
+*/
+
+
+#ifndef BERTINI_DETAIL_THREAD_TEAM_HPP
+#define BERTINI_DETAIL_THREAD_TEAM_HPP
+
+#include "bertini2/mpfr_extensions.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bertini {
+
+	namespace detail {
+
+	/**
+	\brief Threads kept waiting between runs, to split a computation too short to start threads for, into parts.
+
+	## Use
+
+	\code
+	auto team = std::make_shared<detail::ThreadTeam>(4);
+	team->Run([&](unsigned part, unsigned num_parts)
+		{
+			// rows [part*n/num_parts, (part+1)*n/num_parts)
+		});
+	\endcode
+
+	The calling thread runs part 0, and the Size()-1 threads of the team the others.  Run returns once all the parts are done.  The parts run at the default precision of the calling thread, which is per thread.
+
+	Runs from different threads on the same team take turns, so a team may be shared, but then only one of them has it at a time.
+	*/
+	class ThreadTeam
+	{
+	public:
+
+		using Task = std::function<void(unsigned part, unsigned num_parts)>;
+
+		/**
+		\param num_threads The number of parts of each run, counting the calling thread.  0 is taken as 1.
+		*/
+		explicit
+		ThreadTeam(unsigned num_threads) : size_(std::max(num_threads, 1u))
+		{
+			for (unsigned ii = 1; ii < size_; ++ii)
+				workers_.emplace_back([this, ii](){ Work(ii); });
+		}
+
+		ThreadTeam(ThreadTeam const&) = delete;
+		ThreadTeam& operator=(ThreadTeam const&) = delete;
+
+		~ThreadTeam()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			start_.notify_all();
+			for (auto& w : workers_)
+				w.join();
+		}
+
+		/**
+		\brief The number of parts of each run, counting the calling thread.
+		*/
+		unsigned Size() const
+		{
+			return size_;
+		}
+
+		/**
+		\brief Run task(part, Size()) for each part, at once, returning when all are done.
+
+		\throws The exception thrown by the lowest numbered part which threw, once all are done.
+		*/
+		void Run(Task const& task)
+		{
+			std::lock_guard<std::mutex> turn(run_mutex_);
+			if (size_==1)
+			{
+				task(0,1);
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				task_ = &task;
+				precision_ = DefaultPrecision();
+				remaining_ = size_-1;
+				failures_.assign(size_, nullptr);
+				++generation_;
+			}
+			start_.notify_all();
+
+			try
+			{
+				task(0, size_);
+			}
+			catch (...)
+			{
+				failures_[0] = std::current_exception();
+			}
+
+			std::unique_lock<std::mutex> lock(mutex_);
+			done_.wait(lock, [this](){ return remaining_==0; });
+			task_ = nullptr;
+
+			for (auto const& f : failures_)
+				if (f)
+					std::rethrow_exception(f);
+		}
+
+	private:
+
+		void Work(unsigned part)
+		{
+			unsigned long long seen = 0;
+			for (;;)
+			{
+				Task const* task;
+				unsigned precision;
+				{
+					std::unique_lock<std::mutex> lock(mutex_);
+					start_.wait(lock, [&](){ return stopping_ || generation_!=seen; });
+					if (stopping_)
+						return;
+					seen = generation_;
+					task = task_;
+					precision = precision_;
+				}
+
+				if (DefaultPrecision()!=precision)
+					DefaultPrecision(precision);
+
+				std::exception_ptr failure;
+				try
+				{
+					(*task)(part, size_);
+				}
+				catch (...)
+				{
+					failure = std::current_exception();
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					failures_[part] = failure;
+					--remaining_;
+				}
+				done_.notify_one();
+			}
+		}
+
+		const unsigned size_;
+		std::vector<std::thread> workers_;
+
+		std::mutex run_mutex_; ///< Held for the whole of a run, so that runs take turns.
+		std::mutex mutex_; ///< Guards the rest.
+		std::condition_variable start_, done_;
+		Task const* task_ = nullptr;
+		unsigned precision_ = 0;
+		unsigned remaining_ = 0;
+		unsigned long long generation_ = 0;
+		bool stopping_ = false;
+		std::vector<std::exception_ptr> failures_;
+	};
+
+
+	/**
+	\brief The beginning of a part of a range split as evenly as can be, so that part p covers [PartBegin(p), PartBegin(p+1)).
+	*/
+	inline std::size_t PartBegin(std::size_t size, unsigned part, unsigned num_parts)
+	{
+		return size*part/num_parts;
+	}
+
+	/**
+	\brief The number of workers when none is asked for: one for each hardware thread, and at least one, for the number of hardware threads may be unknown.
+	*/
+	inline unsigned DefaultNumWorkers()
+	{
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	} // namespace detail
+
+} // namespace bertini
+
+
+#endif
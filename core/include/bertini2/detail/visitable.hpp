@@ -36,6 +36,8 @@
 #include "bertini2/detail/visitor.hpp"
 #include "bertini2/detail/events.hpp"
 
+#include <algorithm>
+
 namespace bertini{
 
 	namespace policy{
@@ -135,14 +137,15 @@ namespace bertini{
 		void AddObserver(AnyObserver* new_observer)
 		{
 			current_watchers_.push_back(new_observer);
+			subscribers_.clear();
 		}
 
 	protected:
 
 		/**
-		\brief Sends an Event (more particularly, AnyEvent) to all watching observers of this object.
+		\brief Sends an Event (more particularly, AnyEvent) to all watching observers of this object, whatever event types they handle.
 
-		This function could potentially be improved by filtering on the observer's desired event types, if known at compile time.  This could potentially be a performance bottleneck (hopefully not!) since filtering can use `dynamic_cast`ing.  One hopes this cost is overwhelmed by things like linear algebra and system evaluation.
+		Prefer the overload taking the event type as a template parameter, which skips uninterested observers, and building the event at all if none wants it.
 
 		\param e The event to emit.  Its type should be derived from AnyEvent.
 		*/
@@ -154,12 +157,60 @@ namespace bertini{
 
 		}
 
+		/**
+		\brief Builds an event and sends it to the observers which handle its type, or builds nothing if none does.
+
+		Use as `NotifyObservers< SuccessfulStep<T> >(*this)`.  The observers wanting each event type are found the first time it is emitted after an observer is attached, so that with no observers, or none wanting the event, emitting costs a branch and an index.
+
+		\tparam EventT The type of event to emit.  It must define IsA, with BERTINI_EVENT_IS_A.
+		\param args The arguments of the constructor of the event.
+		*/
+		template<typename EventT, typename... Args>
+		void NotifyObservers(Args&&... args) const
+		{
+			if (current_watchers_.empty())
+				return;
+
+			auto const& subscribers = Subscribers<EventT>();
+			if (subscribers.empty())
+				return;
+
+			const EventT e(std::forward<Args>(args)...);
+			for (auto obs : subscribers)
+				obs->Observe(e);
+		}
+
 
 	private:
 
 		using ObserverContainer = std::vector<AnyObserver*>;
 
+		/**
+		\brief The attached observers which handle an event type, found the first time it is asked for.
+		*/
+		template<typename EventT>
+		ObserverContainer const& Subscribers() const
+		{
+			const auto index = detail::EventTypeIndex<EventT>();
+			if (index >= subscribers_.size())
+				subscribers_.resize(index+1);
+
+			auto& entry = subscribers_[index];
+			if (!entry.first)
+			{
+				for (auto obs : current_watchers_)
+				{
+					auto handled = obs->HandledEvents();
+					if (handled.empty() || std::any_of(handled.begin(), handled.end(), [](std::type_index const& t){ return EventT::IsA(t); }))
+						entry.second.push_back(obs);
+				}
+				entry.first = true;
+			}
+			return entry.second;
+		}
+
 		ObserverContainer current_watchers_;
+		mutable std::vector< std::pair<bool, ObserverContainer> > subscribers_; ///< For each event type, by its index, whether its subscribers have been found, and them.
 	};
 
 } // namespace bertini
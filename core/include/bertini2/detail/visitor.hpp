@@ -34,7 +34,9 @@
 #define BERTINI_DETAIL_VISITOR_HPP
 
 #include <tuple>
+#include <typeindex>
 #include <utility>
+#include <vector>
 
 #include <boost/fusion/adapted/std_tuple.hpp>
 
@@ -95,6 +97,16 @@ namespace bertini{
 		\param e The event which was emitted by the observed object.
 		*/
 		virtual void Observe(AnyEvent const& e) = 0;
+
+		/**
+		\brief The event types this observer wants, as from EventTypeList.  An event is delivered if it is one of them, or derives from one.
+
+		Observables build no event which no attached observer wants, so declaring these is worth it for observers of frequent events.  The default, an empty list, takes every event.  It is asked when the observer is attached, so should not change after.
+		*/
+		virtual std::vector<std::type_index> HandledEvents() const
+		{
+			return {};
+		}
 	};
 
 
@@ -155,6 +167,26 @@ namespace bertini{
 		    for_each(observers_, f);
 		}
 
+		/**
+		The union of the event types of the glued observers, or every event if any of them takes every event.
+		*/
+		std::vector<std::type_index> HandledEvents() const override
+		{
+			using namespace boost::fusion;
+			std::vector<std::type_index> handled;
+			bool takes_all = false;
+			auto f = [&](auto const& obs) 
+			{ 
+				auto h = obs.HandledEvents();
+				takes_all = takes_all || h.empty();
+				handled.insert(handled.end(), h.begin(), h.end());
+			};
+			for_each(observers_, f);
+			if (takes_all)
+				handled.clear();
+			return handled;
+		}
+
 		std::tuple<ObserverTypes<ObservedT>...> observers_;
 		virtual ~MultiObserver() = default;
 	};
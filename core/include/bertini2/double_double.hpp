@@ -0,0 +1,486 @@
+//This file is part of Bertini 2.
+//
+//double_double.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//double_double.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with double_double.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file double_double.hpp
+
+\brief Double-double real and complex number types, carrying about 32 digits in hardware arithmetic.
+
+They are the registers of compensated evaluation, see StraightLineProgram::Compensate and System::UseCompensatedEvaluation, and reach the adaptive precision tracker only through it, by AdaptiveMultiplePrecisionConfig::compensated_double_evaluation.  They are not a number type of System or Node evaluation, nor a precision of their own between double and multiple precision, so besides conversions and bertini::NumTraits, they have only what the program runs: arithmetic, and the functions of its operations.
+*/
+
+
+#ifndef BERTINI_DOUBLE_DOUBLE_HPP
+#define BERTINI_DOUBLE_DOUBLE_HPP
+
+#include "bertini2/mpfr_complex.hpp"
+
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <type_traits>
+
+
+namespace bertini {
+
+	/**
+	\brief The number of decimal digits carried by the double-double types.
+	*/
+	inline
+	unsigned DoubleDoublePrecision()
+	{
+		return 32;
+	}
+
+	/**
+	The double-double types and their functions live in their own namespace, so that they are found by argument-dependent lookup, and do not hide the standard math functions of double from unqualified calls elsewhere in bertini.
+	*/
+	namespace dd {
+
+	/**
+	\brief A real number carried as the unevaluated sum of two doubles, hi + lo, with |lo| at most half an ulp of hi.
+
+	Gives 106 bits of significand, about 32 decimal digits, using only hardware double arithmetic: sums and products are computed exactly as pairs of doubles (Knuth's TwoSum, and TwoProd by fused multiply-add), and then renormalized.  This is roughly an order of magnitude cheaper than MPFR at the same precision, and allocates nothing.
+
+	The exponent range is that of double.  Elementary functions other than sqrt are computed through MPFR, and are not faster than it.
+
+	The algorithms are those of Hida, Li, and Bailey's QD library.
+	*/
+	class dd_real
+	{
+		double hi_, lo_;
+
+		static void TwoSum(double a, double b, double & s, double & e)
+		{
+			s = a + b;
+			const double bb = s - a;
+			e = (a - (s - bb)) + (b - bb);
+		}
+
+		static void QuickTwoSum(double a, double b, double & s, double & e)
+		{
+			s = a + b;
+			e = b - (s - a);
+		}
+
+		static void TwoProd(double a, double b, double & p, double & e)
+		{
+			p = a * b;
+			e = std::fma(a, b, -p);
+		}
+
+	public:
+
+		dd_real() : hi_(0), lo_(0) {}
+
+		dd_real(double hi) : hi_(hi), lo_(0) {}
+
+		template<typename T, typename = typename std::enable_if<std::is_integral<T>::value >::type>
+		dd_real(T n) : hi_(double(n)), lo_(double(n - static_cast<T>(double(n)))) {}
+
+		/**
+		Make from two doubles, which need not be normalized.
+		*/
+		dd_real(double hi, double lo)
+		{
+			QuickTwoSum(hi, lo, hi_, lo_);
+		}
+
+		/**
+		Round a multiple precision number to double-double.
+		*/
+		explicit dd_real(mpfr_float const& x);
+
+		/**
+		The value as a multiple precision number, at the current default precision, which should be at least DoubleDoublePrecision() to be exact.
+		*/
+		mpfr_float ToMpfr() const;
+
+		double hi() const {return hi_;}
+		double lo() const {return lo_;}
+
+		explicit operator double() const {return hi_;}
+
+
+		dd_real& operator+=(dd_real const& b)
+		{
+			double s1, s2, t1, t2;
+			TwoSum(hi_, b.hi_, s1, s2);
+			TwoSum(lo_, b.lo_, t1, t2);
+			s2 += t1;
+			QuickTwoSum(s1, s2, s1, s2);
+			s2 += t2;
+			QuickTwoSum(s1, s2, hi_, lo_);
+			return *this;
+		}
+
+		dd_real& operator+=(double b)
+		{
+			double s1, s2;
+			TwoSum(hi_, b, s1, s2);
+			s2 += lo_;
+			QuickTwoSum(s1, s2, hi_, lo_);
+			return *this;
+		}
+
+		dd_real& operator-=(dd_real const& b)
+		{
+			return *this += -b;
+		}
+
+		dd_real& operator-=(double b)
+		{
+			return *this += -b;
+		}
+
+		dd_real& operator*=(dd_real const& b)
+		{
+			double p1, p2;
+			TwoProd(hi_, b.hi_, p1, p2);
+			p2 += hi_ * b.lo_ + lo_ * b.hi_;
+			QuickTwoSum(p1, p2, hi_, lo_);
+			return *this;
+		}
+
+		dd_real& operator*=(double b)
+		{
+			double p1, p2;
+			TwoProd(hi_, b, p1, p2);
+			p2 += lo_ * b;
+			QuickTwoSum(p1, p2, hi_, lo_);
+			return *this;
+		}
+
+		/**
+		Long division, one double of the quotient at a time, with a correction by a third.
+		*/
+		dd_real& operator/=(dd_real const& b)
+		{
+			const double q1 = hi_ / b.hi_;
+			dd_real r = *this;
+			r -= dd_real(b) *= q1;
+			const double q2 = r.hi_ / b.hi_;
+			r -= dd_real(b) *= q2;
+			const double q3 = r.hi_ / b.hi_;
+
+			double s, e;
+			QuickTwoSum(q1, q2, s, e);
+			*this = dd_real(s, e);
+			return *this += q3;
+		}
+
+		dd_real operator-() const
+		{
+			dd_real n;
+			n.hi_ = -hi_;
+			n.lo_ = -lo_;
+			return n;
+		}
+
+		bool operator==(dd_real const& b) const {return hi_==b.hi_ && lo_==b.lo_;}
+		bool operator!=(dd_real const& b) const {return !(*this==b);}
+		bool operator<(dd_real const& b) const {return hi_ < b.hi_ || (hi_==b.hi_ && lo_ < b.lo_);}
+		bool operator>(dd_real const& b) const {return b < *this;}
+		bool operator<=(dd_real const& b) const {return !(b < *this);}
+		bool operator>=(dd_real const& b) const {return !(*this < b);}
+
+		friend std::ostream& operator<<(std::ostream& out, dd_real const& x);
+	};
+
+
+	inline dd_real operator+(dd_real a, dd_real const& b) {return a += b;}
+	inline dd_real operator-(dd_real a, dd_real const& b) {return a -= b;}
+	inline dd_real operator*(dd_real a, dd_real const& b) {return a *= b;}
+	inline dd_real operator/(dd_real a, dd_real const& b) {return a /= b;}
+
+	inline dd_real operator+(dd_real a, double b) {return a += b;}
+	inline dd_real operator+(double a, dd_real b) {return b += a;}
+	inline dd_real operator-(dd_real a, double b) {return a -= b;}
+	inline dd_real operator-(double a, dd_real const& b) {return dd_real(a) -= b;}
+	inline dd_real operator*(dd_real a, double b) {return a *= b;}
+	inline dd_real operator*(double a, dd_real b) {return b *= a;}
+	inline dd_real operator/(dd_real a, double b) {return a /= dd_real(b);}
+	inline dd_real operator/(double a, dd_real const& b) {return dd_real(a) /= b;}
+
+	inline dd_real abs(dd_real const& x)
+	{
+		return x.hi() < 0 ? -x : x;
+	}
+
+	/**
+	One Newton step from the double square root.
+	*/
+	inline dd_real sqrt(dd_real const& a)
+	{
+		if (a.hi() <= 0)
+			return dd_real(std::sqrt(a.hi()));
+
+		const double x = 1.0 / std::sqrt(a.hi());
+		const double ax = a.hi() * x;
+		const dd_real ax_squared = dd_real(ax) * dd_real(ax);
+		return dd_real(ax) + (a - ax_squared).hi() * (x * 0.5);
+	}
+
+	inline bool isnan(dd_real const& x)
+	{
+		return std::isnan(x.hi());
+	}
+
+	inline bool isinf(dd_real const& x)
+	{
+		return std::isinf(x.hi());
+	}
+
+	dd_real exp(dd_real const& x);
+	dd_real log(dd_real const& x);
+	dd_real sin(dd_real const& x);
+	dd_real cos(dd_real const& x);
+	dd_real pow(dd_real const& x, dd_real const& y);
+
+
+
+
+	/**
+	\brief A complex number with double-double real and imaginary parts.
+
+	Arithmetic and sqrt are in hardware.  Other elementary functions go through bertini::complex, at DoubleDoublePrecision() digits.
+
+	Division is the textbook formula, so may overflow for denominators with magnitude over about 1e154, as for the double-double real type itself.
+	*/
+	class dd_complex
+	{
+		dd_real real_, imag_;
+
+	public:
+
+		dd_complex() {}
+
+		dd_complex(dd_real const& re) : real_(re) {}
+
+		dd_complex(double re) : real_(re) {}
+
+		template<typename T, typename = typename std::enable_if<std::is_integral<T>::value >::type>
+		dd_complex(T re) : real_(re) {}
+
+		dd_complex(dd_real const& re, dd_real const& im) : real_(re), imag_(im) {}
+
+		dd_complex(double re, double im) : real_(re), imag_(im) {}
+
+		dd_complex(std::complex<double> const& z) : real_(z.real()), imag_(z.imag()) {}
+
+		/**
+		Round a multiple precision complex number to double-double.
+		*/
+		explicit dd_complex(complex const& z) : real_(z.real()), imag_(z.imag()) {}
+
+		/**
+		The value as a multiple precision complex number, at the current default precision.
+		*/
+		complex ToMpfr() const
+		{
+			return complex(real_.ToMpfr(), imag_.ToMpfr());
+		}
+
+		/**
+		The value rounded to double precision.
+		*/
+		explicit operator std::complex<double>() const
+		{
+			return std::complex<double>(real_.hi(), imag_.hi());
+		}
+
+		dd_real const& real() const {return real_;}
+		dd_real const& imag() const {return imag_;}
+		void real(dd_real const& re) {real_ = re;}
+		void imag(dd_real const& im) {imag_ = im;}
+
+
+		dd_complex& operator+=(dd_complex const& b)
+		{
+			real_ += b.real_;
+			imag_ += b.imag_;
+			return *this;
+		}
+
+		dd_complex& operator-=(dd_complex const& b)
+		{
+			real_ -= b.real_;
+			imag_ -= b.imag_;
+			return *this;
+		}
+
+		dd_complex& operator*=(dd_complex const& b)
+		{
+			const dd_real re = real_*b.real_ - imag_*b.imag_;
+			imag_ = real_*b.imag_ + imag_*b.real_;
+			real_ = re;
+			return *this;
+		}
+
+		dd_complex& operator*=(dd_real const& b)
+		{
+			real_ *= b;
+			imag_ *= b;
+			return *this;
+		}
+
+		dd_complex& operator/=(dd_complex const& b)
+		{
+			const dd_real d = b.real_*b.real_ + b.imag_*b.imag_;
+			const dd_real re = (real_*b.real_ + imag_*b.imag_) / d;
+			imag_ = (imag_*b.real_ - real_*b.imag_) / d;
+			real_ = re;
+			return *this;
+		}
+
+		dd_complex& operator/=(dd_real const& b)
+		{
+			real_ /= b;
+			imag_ /= b;
+			return *this;
+		}
+
+		dd_complex operator-() const
+		{
+			return dd_complex(-real_, -imag_);
+		}
+
+		bool operator==(dd_complex const& b) const {return real_==b.real_ && imag_==b.imag_;}
+		bool operator!=(dd_complex const& b) const {return !(*this==b);}
+
+		/**
+		The square of the magnitude.
+		*/
+		dd_real abs2() const
+		{
+			return real_*real_ + imag_*imag_;
+		}
+
+		friend std::ostream& operator<<(std::ostream& out, dd_complex const& z)
+		{
+			return out << "(" << z.real_ << "," << z.imag_ << ")";
+		}
+	};
+
+
+	inline dd_complex operator+(dd_complex a, dd_complex const& b) {return a += b;}
+	inline dd_complex operator-(dd_complex a, dd_complex const& b) {return a -= b;}
+	inline dd_complex operator*(dd_complex a, dd_complex const& b) {return a *= b;}
+	inline dd_complex operator/(dd_complex a, dd_complex const& b) {return a /= b;}
+
+	inline dd_complex operator*(dd_complex a, dd_real const& b) {return a *= b;}
+	inline dd_complex operator*(dd_real const& a, dd_complex b) {return b *= a;}
+	inline dd_complex operator/(dd_complex a, dd_real const& b) {return a /= b;}
+
+	inline dd_real real(dd_complex const& z) {return z.real();}
+	inline dd_real imag(dd_complex const& z) {return z.imag();}
+	inline dd_complex conj(dd_complex const& z) {return dd_complex(z.real(), -z.imag());}
+	inline dd_real abs2(dd_complex const& z) {return z.abs2();}
+	inline dd_real norm(dd_complex const& z) {return z.abs2();}
+
+	inline dd_real abs(dd_complex const& z)
+	{
+		return sqrt(z.abs2());
+	}
+
+	inline bool isnan(dd_complex const& z)
+	{
+		return isnan(z.real()) || isnan(z.imag());
+	}
+
+	inline bool isinf(dd_complex const& z)
+	{
+		return isinf(z.real()) || isinf(z.imag());
+	}
+
+	/**
+	The principal square root, with the branch cut along the negative real axis, computed as the real square roots of (|z| +- Re(z))/2.
+	*/
+	inline dd_complex sqrt(dd_complex const& z)
+	{
+		if (z.real()==dd_real(0) && z.imag()==dd_real(0))
+			return dd_complex();
+
+		const dd_real r = abs(z);
+		if (z.real() >= dd_real(0))
+		{
+			const dd_real t = sqrt((r + z.real()) * 0.5);
+			return dd_complex(t, z.imag() / (t * 2.0));
+		}
+
+		dd_real t = sqrt((r - z.real()) * 0.5);
+		if (z.imag() < dd_real(0))
+			t = -t;
+		return dd_complex(z.imag() / (t * 2.0), t);
+	}
+
+	/**
+	Integer powers by repeated squaring, in hardware.
+	*/
+	dd_complex pow(dd_complex const& z, int p);
+
+	dd_complex pow(dd_complex const& z, dd_complex const& w);
+	dd_complex exp(dd_complex const& z);
+	dd_complex log(dd_complex const& z);
+	dd_complex sin(dd_complex const& z);
+	dd_complex cos(dd_complex const& z);
+
+	/**
+	The sine and cosine together, through one conversion to multiple precision.
+	*/
+	void SinCos(dd_complex const& z, dd_complex & s, dd_complex & c);
+
+	dd_complex tan(dd_complex const& z);
+	dd_complex asin(dd_complex const& z);
+	dd_complex acos(dd_complex const& z);
+	dd_complex atan(dd_complex const& z);
+
+	/**
+	\brief Get the precision of a double-double number, trivially DoubleDoublePrecision().
+	*/
+	inline
+	unsigned Precision(dd_real const&)
+	{
+		return DoubleDoublePrecision();
+	}
+
+	/**
+	\brief Get the precision of a double-double complex number, trivially DoubleDoublePrecision().
+	*/
+	inline
+	unsigned Precision(dd_complex const&)
+	{
+		return DoubleDoublePrecision();
+	}
+
+	} // namespace dd
+
+	using dd::dd_real;
+	using dd::dd_complex;
+
+} // namespace bertini
+
+
+#endif
+
@@ -131,11 +131,22 @@ namespace Eigen {
 		{
 			static inline mpfr_float run(const bertini::complex& x)
 			{
-				return real(x)*real(x) + imag(x)*imag(x);
+				return x.abs2();
 			}
 		};
 
 
+		/**
+		 Multiply-add for the scalar fallback of Eigen's products, such as of Mat<mpfr>, using the fused kernel rather than a product temporary.
+		 */
+		template<> inline bertini::complex pmadd<bertini::complex>(const bertini::complex& a, const bertini::complex& b, const bertini::complex& c)
+		{
+			bertini::complex result;
+			bertini::FusedMultiplyAdd(result, a, b, c);
+			return result;
+		}
+
+
 		template<> inline bertini::complex random<bertini::complex>()
 		{
 			return bertini::complex::rand();
@@ -295,11 +306,13 @@ namespace Eigen {
 #include <Eigen/Eigenvalues>
 #include <Eigen/SVD>
 #include <Eigen/Dense>
+#include <Eigen/Sparse>
 
 namespace bertini {
 
 	template<typename NumType> using Vec = Eigen::Matrix<NumType, Eigen::Dynamic, 1>;
 	template<typename NumType> using Mat = Eigen::Matrix<NumType, Eigen::Dynamic, Eigen::Dynamic>;
+	template<typename NumType> using SparseMat = Eigen::SparseMatrix<NumType>;
 
 	template<typename Derived>
 	unsigned Precision(Eigen::MatrixBase<Derived> const & v)
@@ -325,6 +338,23 @@ namespace bertini {
 				Precision(v(ii,jj),prec);
 	}
 
+
+	/**
+	\brief Set a vector or matrix of multiple precision numbers from another, of the same or double precision type, at a precision, in place.
+
+	Each entry keeps its limbs, so moving between precisions already reached allocates nothing.  The target is resized only if its shape differs from the source's.  target may be source.
+	*/
+	template<typename Derived, typename OtherDerived>
+	void SetAtPrecision(Eigen::PlainObjectBase<Derived> & target, Eigen::MatrixBase<OtherDerived> const& source, unsigned prec)
+	{
+		if (target.rows()!=source.rows() || target.cols()!=source.cols())
+			target.resize(source.rows(), source.cols());
+
+		for (int jj=0; jj<source.cols(); ++jj)
+			for (int ii=0; ii<source.rows(); ++ii)
+				SetAtPrecision(target(ii,jj), source(ii,jj), prec);
+	}
+
 	
 
 	/**
@@ -390,38 +420,35 @@ namespace bertini {
 	};
 
 	/**
-	\brief Check the diagonal elements of an LU decomposition for small values and large ratios.  
+	\brief Check the pivots of an LU decomposition, the diagonal of U in the order of elimination, for small values and large ratios.
 
 	\return Success if things are ok.  LargeChange or SmallValue if one is found.
 
-	This function requires a square non-empty matrix.
-
-	\tparam Derived Matrix type from Eigen.
+	\tparam Derived Vector type from Eigen, non-empty.
 	*/
 	template <typename Derived>
-	MatrixSuccessCode LUPartialPivotDecompositionSuccessful(Eigen::MatrixBase<Derived> const& LU)
+	MatrixSuccessCode LUPivotsSuccessful(Eigen::MatrixBase<Derived> const& pivots)
 	{
 		#ifndef BERTINI_DISABLE_ASSERTS
-			assert(LU.rows()==LU.cols() && "non-square matrix in LUPartialPivotDecompositionSuccessful");
-			assert(LU.rows()>0 && "empty matrix in LUPartialPivotDecompositionSuccessful");
+			assert(pivots.size()>0 && "no pivots in LUPivotsSuccessful");
 		#endif
 
-			// this loop won't test entry (0,0).  it's tested separately after.
-		for (unsigned int ii = LU.rows()-1; ii > 0; ii--)
+			// this loop won't test entry 0.  it's tested separately after.
+		for (unsigned int ii = pivots.size()-1; ii > 0; ii--)
 		{
-			if (IsSmallValue(LU(ii,ii))) 
+			if (IsSmallValue(pivots(ii))) 
 			{
 				return MatrixSuccessCode::SmallValue;
 			}
 
-			if (IsLargeChange(LU(ii-1,ii-1),LU(ii,ii)))
+			if (IsLargeChange(pivots(ii-1),pivots(ii)))
 			{
 				return MatrixSuccessCode::LargeChange;
 			}
 		}
 
-		// this line is the reason for the above assert on non-empty matrix.
-		if (IsSmallValue(LU(0,0))) 
+		// this line is the reason for the above assert on non-empty pivots.
+		if (IsSmallValue(pivots(0))) 
 		{
 			return MatrixSuccessCode::SmallValue;
 		}
@@ -429,6 +456,26 @@ namespace bertini {
 		return MatrixSuccessCode::Success;
 	}
 
+	/**
+	\brief Check the diagonal elements of an LU decomposition for small values and large ratios.  
+
+	\return Success if things are ok.  LargeChange or SmallValue if one is found.
+
+	This function requires a square non-empty matrix.
+
+	\tparam Derived Matrix type from Eigen.
+	*/
+	template <typename Derived>
+	MatrixSuccessCode LUPartialPivotDecompositionSuccessful(Eigen::MatrixBase<Derived> const& LU)
+	{
+		#ifndef BERTINI_DISABLE_ASSERTS
+			assert(LU.rows()==LU.cols() && "non-square matrix in LUPartialPivotDecompositionSuccessful");
+			assert(LU.rows()>0 && "empty matrix in LUPartialPivotDecompositionSuccessful");
+		#endif
+
+		return LUPivotsSuccessful(LU.diagonal());
+	}
+
 	/**
 	\brief Make a Kahan matrix with a given number type.
 	*/
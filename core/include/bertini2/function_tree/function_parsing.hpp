@@ -97,7 +97,7 @@ namespace {
 		template <typename... A>
 		typename result<A...>::type operator()(A&&... a) const 
 		{
-			return std::make_shared<T>(std::forward<A>(a)...);
+			return bertini::node::MakeNode<T>(std::forward<A>(a)...);
 		}
 	};
 
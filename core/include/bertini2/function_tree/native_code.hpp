@@ -0,0 +1,109 @@
+//This file is part of Bertini 2.
+//
+//native_code.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//native_code.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with native_code.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file native_code.hpp
+
+\brief The batch sweeps of a StraightLineProgram compiled to native code, by LLVM, when built with --enable-llvm-jit.
+
+The interpreter of a program dispatches on the operation of every instruction, and reads and writes every register through memory.  Compiled, the sweep over the function segment is one function specialized to the program: the registers are SSA values, kept in vector registers where the machine has enough, the operations are vector arithmetic on BatchLanes::Width lanes, and the tangents known to be zero, for forward-mode differentiation, are never read.  The operations other than arithmetic call back into the interpreter, lane by lane, as it computes them.
+
+Compiling takes time proportional to the program, so is done once for each program, and the code is shared by every program with the same instructions, through a cache keyed by their hash, so the copies made for threads, and systems prepared again, compile nothing.  The code lives as long as the process.
+
+Without LLVM, Available is false, and Compile returns nothing, so the interpreter is used.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_NATIVE_CODE_HPP
+#define BERTINI_FUNCTION_TREE_NATIVE_CODE_HPP
+
+#include "bertini2/config.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "bertini2/function_tree/straight_line_program.hpp"
+
+namespace bertini {
+
+	namespace jit {
+
+	/**
+	\brief Runs the function segment on the lane-contiguous registers of a batch, as StraightLineProgram::EvalFunctionsBatch does.
+	*/
+	using BatchValuesKernel = void (*)(double * re, double * im);
+
+	/**
+	\brief Runs the function segment on the registers and tangents of a batch, as StraightLineProgram::EvalForwardModeBatch does.
+	*/
+	using BatchForwardKernel = void (*)(double * re, double * im, double * tangents_re, double * tangents_im);
+
+
+	/**
+	\brief The compiled sweeps of a program, and the instructions which the code calls back with, which it refers to by address, so are kept here with it.
+	*/
+	struct NativeKernels
+	{
+		BatchValuesKernel values = nullptr;
+		BatchForwardKernel forward = nullptr;
+
+		std::uint64_t hash = 0; ///< Of the instructions, the tangents and the number of directions, the key of the cache.
+		std::vector<SLPInstruction> instructions; ///< The function segment.
+		std::vector<bool> has_tangent;
+		size_t num_directions = 0;
+	};
+
+
+	/**
+	\brief Whether this build can compile to native code.
+	*/
+	bool Available();
+
+	/**
+	\brief Compile the function segment of a program, or get it from the cache if a program with the same instructions has been.
+
+	\param instructions The instructions of the function segment.
+	\param has_tangent For each register, whether its derivatives with respect to the variables may be nonzero.
+	\param num_directions The number of variables and the path variable.
+	\return The compiled sweeps, or nullptr if this build cannot compile, the program is too large to be worth compiling, or LLVM failed to, in which case the interpreter should be used.
+	*/
+	std::shared_ptr<NativeKernels const> Compile(std::vector<SLPInstruction> const& instructions, std::vector<bool> const& has_tangent, size_t num_directions);
+
+
+	/**
+	\brief Run one instruction across a batch, as the interpreter does.  Called by compiled code for the operations it does not inline.
+	*/
+	void ExecuteBatchInstruction(SLPInstruction const& instr, double * re, double * im);
+
+	/**
+	\brief Run one instruction and its derivatives across a batch, as the interpreter does.  Called by compiled code for the operations it does not inline.
+	*/
+	void ExecuteBatchForwardInstruction(SLPInstruction const& instr, std::vector<bool> const& has_tangent, size_t num_directions,
+	                                    double * re, double * im, double * tangents_re, double * tangents_im);
+
+	} // namespace jit
+
+} // namespace bertini
+
+#endif
@@ -48,17 +48,22 @@
 #include <tuple>
 
 #include <boost/type_index.hpp>
+#include <boost/pool/pool_alloc.hpp>
 
 #include "bertini2/num_traits.hpp"
 
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 
 #include <deque>
+#include <memory>
+#include <mutex>
 
 
 
@@ -81,6 +86,35 @@ enum class VariableGroupType
 
 namespace node{
 
+/**
+\brief The allocator from which nodes are drawn by MakeNode.
+
+Nodes of the same size, together with their reference counts, are carved from shared slabs, rather than each being its own heap allocation.  Trees built together therefore sit close together in memory, which helps evaluation, and building a tree costs far fewer calls to the system allocator.
+
+Slabs are kept by the pool for the life of the program, and reused for later nodes.
+*/
+template<typename T>
+using NodeAllocator = boost::fast_pool_allocator<T>;
+
+/**
+\brief Make a new node, drawn from the node pool.
+
+This is the way to make nodes in Bertini.  It is a drop-in for std::make_shared, and the resulting pointer behaves exactly as one from it.
+
+\tparam T The type of node to make.
+\param args The arguments to forward to the constructor of T.
+*/
+template<typename T, typename... Args>
+std::shared_ptr<T> MakeNode(Args&&... args)
+{
+	return std::allocate_shared<T>(NodeAllocator<T>(), std::forward<Args>(args)...);
+}
+
+/**
+\brief The lock held while bringing the constant subtrees of a compiled system to a new precision and evaluating them.  Copies of a system made by System::CloneForThread share these subtrees across threads.
+*/
+std::mutex& SharedConstantsMutex();
+
 namespace detail{
 	template<typename T>
 	struct FreshEvalSelector
@@ -122,7 +156,142 @@ namespace detail{
 		}
 
 	};
+
+
+	/**
+	\brief The stored values of a node, in double and multiple precision, each with whether it is fresh.
+
+	The double value is held in place.  The multiple precision one is made on its first use, at the precision last set, so a node only ever evaluated in double precision, as in the systems of a double precision tracker, carries no limbs at all.
+	*/
+	class NodeValueCache
+	{
+	public:
+		NodeValueCache() : precision_(DefaultPrecision())
+		{}
+
+		NodeValueCache(NodeValueCache const& other) : double_value_(other.double_value_), precision_(other.precision_)
+		{
+			if (other.mp_value_)
+				mp_value_.reset(new std::pair<mpfr,bool>(*other.mp_value_));
+		}
+
+		NodeValueCache& operator=(NodeValueCache const& other)
+		{
+			if (this!=&other)
+			{
+				double_value_ = other.double_value_;
+				precision_ = other.precision_;
+				mp_value_.reset(other.mp_value_ ? new std::pair<mpfr,bool>(*other.mp_value_) : nullptr);
+			}
+			return *this;
+		}
+
+		/**
+		\brief The stored value of a number type, and whether it is fresh.  The multiple precision one is made if there is none yet.
+		*/
+		template<typename T>
+		std::pair<T,bool>& Get();
+
+		/**
+		\brief Mark the stored values as stale, so the next evaluation is fresh.
+		*/
+		void MarkStale()
+		{
+			double_value_.second = false;
+			if (mp_value_)
+				mp_value_->second = false;
+		}
+
+		/**
+		\brief The precision of the multiple precision value, made or not.
+		*/
+		unsigned Precision() const
+		{
+			return mp_value_ ? mp_value_->first.precision() : precision_;
+		}
+
+		/**
+		\brief Set the precision of the multiple precision value, or that at which it will be made.
+		*/
+		void Precision(unsigned prec)
+		{
+			precision_ = prec;
+			if (mp_value_)
+				mp_value_->first.precision(prec);
+		}
+
+		/**
+		\brief Whether the multiple precision value has been made.
+		*/
+		bool HasMultiplePrecisionValue() const
+		{
+			return static_cast<bool>(mp_value_);
+		}
+
+	private:
+		std::pair<dbl,bool> double_value_ = std::make_pair(dbl(), false);
+		std::unique_ptr< std::pair<mpfr,bool> > mp_value_; ///< Made on first use.
+		unsigned precision_; ///< The precision of the multiple precision value, kept while it is not made.
+	};
+
+	template<>
+	inline
+	std::pair<dbl,bool>& NodeValueCache::Get<dbl>()
+	{
+		return double_value_;
+	}
+
+	template<>
+	inline
+	std::pair<mpfr,bool>& NodeValueCache::Get<mpfr>()
+	{
+		if (!mp_value_)
+		{
+			mp_value_.reset(new std::pair<mpfr,bool>());
+			mp_value_->first.precision(precision_);
+			mp_value_->second = false;
+		}
+		return *mp_value_;
+	}
 }
+/**
+\brief Memoize derivatives while this object lives, so that a node is differentiated at most once.
+
+Open one around the differentiation of several trees which share nodes, so that their derivatives share the derivatives of the common parts.  Memos nest: only the outermost on a thread does anything, and its table is discarded on its destruction.
+*/
+class DifferentiationMemo
+{
+public:
+	DifferentiationMemo();
+	~DifferentiationMemo();
+
+	DifferentiationMemo(DifferentiationMemo const&) = delete;
+	DifferentiationMemo& operator=(DifferentiationMemo const&) = delete;
+
+private:
+	bool is_outermost_;
+};
+
+
+/**
+\brief Memoize the results of structural queries of nodes -- Degree, MultiDegree, and IsHomogeneous -- while this object lives.
+
+Open one around many queries of trees which share nodes, such as of every function of a system with respect to each of its variable groups.  Results are keyed by the node, and by the variable or the address of the variable group queried, so the trees must not change, nor the queried variable groups be destroyed, while the memo is open.  Memos nest: only the outermost on a thread does anything.
+*/
+class StructureMemo
+{
+public:
+	StructureMemo();
+	~StructureMemo();
+
+	StructureMemo(StructureMemo const&) = delete;
+	StructureMemo& operator=(StructureMemo const&) = delete;
+
+private:
+	bool is_outermost_;
+};
+
+
 /**
 An interface for all nodes in a function tree, and for a function object as well.  Almost all
  methods that will be called on a node must be declared in this class.  The main evaluation method is
@@ -152,6 +321,17 @@ public:
 	///////// END PUBLIC PURE METHODS /////////////////
 	
 	
+	/**
+	Set the stored values for the Node to indicate a fresh eval on the next pass.  This is so that Nodes which are referred to more than once, are only evaluated once.  The first evaluation is fresh, and then the indicator for fresh/stored is set to stored.  Subsequent evaluation calls simply return the stored number.
+
+	Unlike Reset(), this does not descend into the children of the node.
+	*/
+	void ResetStoredValues() const
+	{
+		current_value_.MarkStale();
+	}
+	
+	
 
 	public:
 	/**
@@ -166,7 +346,7 @@ public:
 	template<typename T>
 	T Eval(std::shared_ptr<Variable> const& diff_variable = nullptr) const 
 	{
-		auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
+		auto& val_pair = current_value_.Get<T>();
 		if(!val_pair.second)
 		{
 			val_pair.first = detail::FreshEvalSelector<T>::Run(*this,diff_variable);
@@ -190,7 +370,7 @@ public:
 	template<typename T>
 	void EvalInPlace(T& eval_value, std::shared_ptr<Variable> const& diff_variable = nullptr) const
 	{
-		auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
+		auto& val_pair = current_value_.Get<T>();
 		if(!val_pair.second)
 		{
 			detail::FreshEvalSelector<T>::RunInPlace(val_pair.first, *this,diff_variable);
@@ -214,21 +394,27 @@ public:
 	
 
 	/**
-	Virtual method for differentiating the node.  Produces a Jacobian tree when all is said and done, which is used for evaluating the Jacobian.
+	Differentiate the node.  Produces a Jacobian tree when all is said and done, which is used for evaluating the Jacobian.
+
+	Derivatives are memoized for the duration of a DifferentiationMemo, and for the duration of the outermost call if none is open: a node reached more than once, as shared subfunctions are, is differentiated the first time only, and the same derivative is returned after.  So the derivative trees share structure as the functions do, rather than growing with the number of paths to each node.
 
 	\return The Jacobian for the node.
 	*/
-	virtual std::shared_ptr<Node> Differentiate() const = 0;
+	std::shared_ptr<Node> Differentiate() const;
 
 
 
+	/**
+	The structural queries below, Degree, MultiDegree, and IsHomogeneous, each compute a node's answer at most once while a StructureMemo is open, and for the duration of the outermost query if none is.  So a query of a tree sharing subtrees costs time linear in the number of its nodes, rather than in the number of paths through it.
+	*/
+
 	/**
 	Compute the degree, optionally with respect to a single variable.
 
 	\param v Shared pointer to variable with respect to which you want to compute the degree of the Node.
 	\return The degree.  Will be negative if the Node is non-polynomial.
 	*/
-	virtual int Degree(std::shared_ptr<Variable> const& v = nullptr) const = 0;
+	int Degree(std::shared_ptr<Variable> const& v = nullptr) const;
 
 
 
@@ -237,7 +423,7 @@ public:
 
 	 \return A vector containing the degrees.  Negative entries indicate non-polynomiality.
 	*/
-	virtual std::vector<int> MultiDegree(VariableGroup const& vars) const = 0;
+	std::vector<int> MultiDegree(VariableGroup const& vars) const;
 
 	/**
 	 Compute the overall degree with respect to a variable group.
@@ -245,7 +431,7 @@ public:
 	\param vars A group of variables.
 	 \return The degree.  Will be negative if the Node is non-polynomial.
 	*/
-	virtual int Degree(VariableGroup const& vars) const = 0;
+	int Degree(VariableGroup const& vars) const;
 
 	/**
 	Homogenize a tree, inputting a variable group holding the non-homogeneous variables, and the new homogenizing variable.  The homvar may be an element of the variable group, that's perfectly ok.
@@ -260,14 +446,14 @@ public:
 	
 	\return True if it is homogeneous, false if not.
 	*/
-	virtual bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const = 0;
+	bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const;
 
 	/**
 	Check for homogeneity, with respect to a variable group.
 
 	\return True if it is homogeneous, false if not.
 	*/
-	virtual bool IsHomogeneous(VariableGroup const& vars) const = 0;
+	bool IsHomogeneous(VariableGroup const& vars) const;
 	
 	
 	/**
@@ -279,7 +465,15 @@ public:
 
 	unsigned precision() const
 	{
-		return std::get<std::pair<mpfr,bool> >(current_value_).first.precision();
+		return current_value_.Precision();
+	}
+
+	/**
+	Whether the node has made its multiple precision value, which it does on first being evaluated or set in multiple precision.  Until then it holds no limbs.
+	*/
+	bool HasMultiplePrecisionValue() const
+	{
+		return current_value_.HasMultiplePrecisionValue();
 	}
 	///////// PUBLIC PURE METHODS /////////////////
 
@@ -310,10 +504,8 @@ public:
 	
 
 protected:
-	//Stores the current value of the node in all required types
-	//We must hard code in all types that we want here.
-	//TODO: Initialize this to some default value, second = false
-	mutable std::tuple< std::pair<dbl,bool>, std::pair<mpfr,bool> > current_value_;
+	//Stores the current value of the node in all required types, the multiple precision one made on first use
+	mutable detail::NodeValueCache current_value_;
 	
 	
 	
@@ -350,26 +542,44 @@ protected:
 	 */
 	virtual void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const&) const = 0;
 
+	/**
+	Overridden code for specific node types, for how to compute their degree with respect to a variable, or all variables if null.  Called from the memoizing wrapper Degree().
+	*/
+	virtual int FreshDegree(std::shared_ptr<Variable> const& v) const = 0;
+
+	/**
+	Overridden code for specific node types, for how to compute their degree with respect to a variable group.  Called from the memoizing wrapper Degree().
+	*/
+	virtual int FreshDegree(VariableGroup const& vars) const = 0;
+
+	/**
+	Overridden code for specific node types, for how to compute their multidegree.  Called from the memoizing wrapper MultiDegree().
+	*/
+	virtual std::vector<int> FreshMultiDegree(VariableGroup const& vars) const = 0;
+
+	/**
+	Overridden code for specific node types, for how to check homogeneity with respect to a variable, or all variables if null.  Called from the memoizing wrapper IsHomogeneous().
+	*/
+	virtual bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const = 0;
+
+	/**
+	Overridden code for specific node types, for how to check homogeneity with respect to a variable group.  Called from the memoizing wrapper IsHomogeneous().
+	*/
+	virtual bool FreshIsHomogeneous(VariableGroup const& vars) const = 0;
+
+	/**
+	Overridden code for specific node types, for how to differentiate themselves.  Called from the wrapper Differentiate() call from Node, if the node's derivative isn't already memoized.
+
+	Implementations differentiate their children through Differentiate(), and never nodes they have just made, so that the memo is keyed only by nodes which outlive it.
+	*/
+	virtual std::shared_ptr<Node> FreshDifferentiate() const = 0;
 	
 	
 	
 	///////// END PRIVATE PURE METHODS /////////////////
 	
 	
-	/**
-	Set the stored values for the Node to indicate a fresh eval on the next pass.  This is so that Nodes which are referred to more than once, are only evaluated once.  The first evaluation is fresh, and then the indicator for fresh/stored is set to stored.  Subsequent evaluation calls simply return the stored number.
-	*/
-	void ResetStoredValues() const
-	{
-		std::get< std::pair<dbl,bool> >(current_value_).second = false;
-		std::get< std::pair<mpfr,bool> >(current_value_).second = false;
-	}
-
-	Node()
-	{
-		std::get<std::pair<dbl,bool> >(current_value_).second = false;
-		std::get<std::pair<mpfr,bool> >(current_value_).second = false;
-	}
+	Node() = default;
 private:
 	friend std::ostream& operator<<(std::ostream & out, const Node& N);
 
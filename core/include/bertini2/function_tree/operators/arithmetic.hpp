@@ -132,6 +132,15 @@ namespace node{
 			NaryOperator::AddChild(std::move(child));
 			children_sign_.push_back(sign);
 		}
+
+
+		/**
+		 Get the signs of the terms.  true means add, false means subtract.  These correspond one-to-one with children().
+		 */
+		std::vector<bool> const& children_signs() const
+		{
+			return children_sign_;
+		}
 		
 		
 		/**
@@ -145,21 +154,21 @@ namespace node{
 		/**
 		 Return SumOperator whose children are derivatives of children_
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		/**
 		 Compute the degree of a node.  For sum functions, the degree is the max among summands.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 		
 
-		int Degree(VariableGroup const& vars) const override;
+		int FreshDegree(VariableGroup const& vars) const override;
 
 		/**
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override;
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override;
 		
 
 
@@ -170,12 +179,12 @@ namespace node{
 		 */
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override;
 		
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override;
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override;
 
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override;
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override;
 		
 
 	 
@@ -274,9 +283,9 @@ namespace node{
 		/**
 		 Returns negative of derivative of child.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 		{
 			return child_->IsHomogeneous(v);
 		}
@@ -284,7 +293,7 @@ namespace node{
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override
 		{
 			return child_->IsHomogeneous(vars);
 		}
@@ -316,7 +325,7 @@ namespace node{
 	
 	inline std::shared_ptr<Node> operator-(const std::shared_ptr<Node> & rhs)
 	{
-		return std::make_shared<NegateOperator>(rhs);
+		return MakeNode<NegateOperator>(rhs);
 	}
 	
 	
@@ -384,6 +393,15 @@ namespace node{
 			NaryOperator::AddChild(std::move(child));
 			children_mult_or_div_.push_back(mult);
 		}
+
+
+		/**
+		 Get whether each factor multiplies or divides.  true means multiply, false means divide.  These correspond one-to-one with children().
+		 */
+		std::vector<bool> const& children_mult_or_div() const
+		{
+			return children_mult_or_div_;
+		}
 		
 		
 		/**
@@ -394,32 +412,32 @@ namespace node{
 		/**
 		 Differentiates using the product rule.  If there is division, consider as ^(-1) and use chain rule.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		
 		/**
 		 Compute the degree of a node.  For trig functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return nan.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 		
 
-		int Degree(VariableGroup const& vars) const override;
+		int FreshDegree(VariableGroup const& vars) const override;
 
 		/**
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override;
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override;
 		
 
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override;
 		
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override;
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override;
 
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override;
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override;
 	protected:
 		
 		// Specific implementation of FreshEval for mult and divide.
@@ -499,6 +517,23 @@ namespace node{
 		{
 			exponent_ = new_exponent;
 		}
+
+
+		/**
+		 Get the base of the power.
+		 */
+		std::shared_ptr<Node> const& base() const
+		{
+			return base_;
+		}
+
+		/**
+		 Get the exponent of the power.
+		 */
+		std::shared_ptr<Node> const& exponent() const
+		{
+			return exponent_;
+		}
 		
 		
 		void Reset() const override;
@@ -512,32 +547,32 @@ namespace node{
 		/**
 		 Differentiates with the power rule.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		
 		/**
 		 Compute the degree of a node.  For power functions, the degree depends on the degree of the power.  If the exponent is constant, then the degree is actually a number.  If the exponent is non-constant, then the degree is ill-defined.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 		
-		int Degree(VariableGroup const& vars) const override;
+		int FreshDegree(VariableGroup const& vars) const override;
 
 		/**
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override;
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override;
 		
 
 
 		void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) override;
 		
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override;
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override;
 
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override;
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override;
 
 		virtual ~PowerOperator() = default;
 		
@@ -548,8 +583,7 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 
 			base_->precision(prec);
 			exponent_->precision(prec);
@@ -643,16 +677,16 @@ namespace node{
 		/**
 		 Differentiates a number.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		/**
 		 Compute the degree of a node.  For integer power functions, the degree is the product of the degree of the argument, and the power.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 		
 		
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 		{
 			return child_->IsHomogeneous(v);
 		}
@@ -661,7 +695,7 @@ namespace node{
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override
 		{
 			return child_->IsHomogeneous(vars);
 		}
@@ -761,7 +795,7 @@ namespace node{
 		/**
 		 Differentiates the square root function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		
@@ -770,7 +804,7 @@ namespace node{
 		 
 		 For the square root function, the degree is 0 if the argument is constant, otherwise it's undefined, and we return -1.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 		
 
 		virtual ~SqrtOperator() = default;
@@ -801,7 +835,7 @@ namespace node{
 	
 	inline std::shared_ptr<Node> sqrt(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<SqrtOperator>(N);
+		return MakeNode<SqrtOperator>(N);
 	}
 	
 	
@@ -829,7 +863,7 @@ namespace node{
 		/**
 		 Differentiates the exponential function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		
@@ -838,7 +872,7 @@ namespace node{
 		 
 		 For transcendental functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return -1.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 		
 
 		virtual ~ExpOperator() = default;
@@ -884,7 +918,7 @@ namespace node{
 		/**
 		 Differentiates the exponential function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		
@@ -893,7 +927,7 @@ namespace node{
 		 
 		 For transcendental functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return -1.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 		
 
 		virtual ~LogOperator() = default;
@@ -924,22 +958,22 @@ namespace node{
 
 	inline std::shared_ptr<Node> exp(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<ExpOperator>(N);
+		return MakeNode<ExpOperator>(N);
 	}
 	
 	inline std::shared_ptr<Node> log(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<LogOperator>(N);
+		return MakeNode<LogOperator>(N);
 	}
 	
 	inline std::shared_ptr<Node> pow(const std::shared_ptr<Node> & N, const std::shared_ptr<Node> & p)
 	{
-		return std::make_shared<PowerOperator>(N,p);
+		return MakeNode<PowerOperator>(N,p);
 	}
 
 	inline std::shared_ptr<Node> pow(std::shared_ptr<Node> const& base, int power)
 	{
-		return std::make_shared<IntegerPowerOperator>(base,power);
+		return MakeNode<IntegerPowerOperator>(base,power);
 	}
 
 	std::shared_ptr<Node> pow(const std::shared_ptr<Node> & N, double p) = delete;
@@ -948,17 +982,17 @@ namespace node{
 
 	inline std::shared_ptr<Node> pow(const std::shared_ptr<Node> & N, mpfr_float p)
 	{
-		return std::make_shared<PowerOperator>(N,std::make_shared<Float>(p));
+		return MakeNode<PowerOperator>(N,MakeNode<Float>(p));
 	}
 
 	inline std::shared_ptr<Node> pow(const std::shared_ptr<Node> & N, mpfr p)
 	{
-		return std::make_shared<PowerOperator>(N,std::make_shared<Float>(p));
+		return MakeNode<PowerOperator>(N,MakeNode<Float>(p));
 	}
 
 	inline std::shared_ptr<Node> pow(const std::shared_ptr<Node> & N, mpq_rational const& p)
 	{
-		return std::make_shared<PowerOperator>(N,std::make_shared<Rational>(p,0));
+		return MakeNode<PowerOperator>(N,MakeNode<Rational>(p,0));
 	}
 
 
@@ -983,7 +1017,7 @@ namespace node{
 	
 	inline std::shared_ptr<Node>& operator+=(std::shared_ptr<Node> & lhs, const std::shared_ptr<Node> & rhs)
 	{
-		std::shared_ptr<Node> temp = std::make_shared<SumOperator>(lhs,rhs);		
+		std::shared_ptr<Node> temp = MakeNode<SumOperator>(lhs,rhs);		
 		lhs.swap(temp);
 		return lhs;
 	}
@@ -994,57 +1028,57 @@ namespace node{
 	
 	inline std::shared_ptr<Node> operator+(std::shared_ptr<Node> lhs, const std::shared_ptr<Node> & rhs)
 	{
-		return std::make_shared<SumOperator>(lhs,rhs);
+		return MakeNode<SumOperator>(lhs,rhs);
 	}
 	
 	inline std::shared_ptr<Node> operator+(std::shared_ptr<Node> lhs, mpfr_float const& rhs)
 	{
-		return std::make_shared<SumOperator>(lhs,std::make_shared<Float>(rhs));
+		return MakeNode<SumOperator>(lhs,MakeNode<Float>(rhs));
 	}
 
 	inline std::shared_ptr<Node> operator+(std::shared_ptr<Node> lhs, mpfr const& rhs)
 	{
-		return std::make_shared<SumOperator>(lhs,std::make_shared<Float>(rhs));
+		return MakeNode<SumOperator>(lhs,MakeNode<Float>(rhs));
 	}
 	
 	inline std::shared_ptr<Node> operator+(mpfr_float const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Float>(lhs), rhs);
+		return MakeNode<SumOperator>(MakeNode<Float>(lhs), rhs);
 	}
 
 	inline std::shared_ptr<Node> operator+(mpfr const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Float>(lhs), rhs);
+		return MakeNode<SumOperator>(MakeNode<Float>(lhs), rhs);
 	}
 
 	inline std::shared_ptr<Node> operator+(std::shared_ptr<Node> lhs, int rhs)
 	{
-		return std::make_shared<SumOperator>(lhs,std::make_shared<Integer>(rhs));
+		return MakeNode<SumOperator>(lhs,MakeNode<Integer>(rhs));
 	}
 	
 	inline std::shared_ptr<Node> operator+(int lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Integer>(lhs), rhs);
+		return MakeNode<SumOperator>(MakeNode<Integer>(lhs), rhs);
 	}
 
 	inline std::shared_ptr<Node> operator+(std::shared_ptr<Node> lhs, mpz_int const& rhs)
 	{
-		return std::make_shared<SumOperator>(lhs,std::make_shared<Integer>(rhs));
+		return MakeNode<SumOperator>(lhs,MakeNode<Integer>(rhs));
 	}
 	
 	inline std::shared_ptr<Node> operator+(mpz_int const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Integer>(lhs), rhs);
+		return MakeNode<SumOperator>(MakeNode<Integer>(lhs), rhs);
 	}
 
 	inline std::shared_ptr<Node> operator+(std::shared_ptr<Node> lhs, mpq_rational const& rhs)
 	{
-		return std::make_shared<SumOperator>(lhs,std::make_shared<Rational>(rhs,0));
+		return MakeNode<SumOperator>(lhs,MakeNode<Rational>(rhs,0));
 	}
 	
 	inline std::shared_ptr<Node> operator+(mpq_rational const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Rational>(lhs,0), rhs);
+		return MakeNode<SumOperator>(MakeNode<Rational>(lhs,0), rhs);
 	}
 	
 	
@@ -1058,7 +1092,7 @@ namespace node{
 	
 	inline std::shared_ptr<Node>& operator-=(std::shared_ptr<Node> & lhs, const std::shared_ptr<Node> & rhs)
 	{
-		std::shared_ptr<Node> temp = std::make_shared<SumOperator>(lhs,true,rhs,false);
+		std::shared_ptr<Node> temp = MakeNode<SumOperator>(lhs,true,rhs,false);
 		lhs.swap(temp);
 		return lhs;
 	}
@@ -1066,57 +1100,57 @@ namespace node{
 	
 	inline std::shared_ptr<Node> operator-(std::shared_ptr<Node> lhs, const std::shared_ptr<Node> & rhs)
 	{
-		return std::make_shared<SumOperator>(lhs,true,rhs,false);
+		return MakeNode<SumOperator>(lhs,true,rhs,false);
 	}
 	
 	inline std::shared_ptr<Node> operator-(std::shared_ptr<Node> lhs, mpfr_float rhs)
 	{
-		return std::make_shared<SumOperator>(lhs, true, std::make_shared<Float>(rhs), false);
+		return MakeNode<SumOperator>(lhs, true, MakeNode<Float>(rhs), false);
 	}
 	
 	inline std::shared_ptr<Node> operator-(mpfr_float lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Float>(lhs), true, rhs, false);
+		return MakeNode<SumOperator>(MakeNode<Float>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator-(std::shared_ptr<Node> lhs, mpfr rhs)
 	{
-		return std::make_shared<SumOperator>(lhs, true, std::make_shared<Float>(rhs), false);
+		return MakeNode<SumOperator>(lhs, true, MakeNode<Float>(rhs), false);
 	}
 	
 	inline std::shared_ptr<Node> operator-(mpfr lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Float>(lhs), true, rhs, false);
+		return MakeNode<SumOperator>(MakeNode<Float>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator-(std::shared_ptr<Node> lhs, int rhs)
 	{
-		return std::make_shared<SumOperator>(lhs, true, std::make_shared<Integer>(rhs), false);
+		return MakeNode<SumOperator>(lhs, true, MakeNode<Integer>(rhs), false);
 	}
 	
 	inline std::shared_ptr<Node> operator-(int lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Integer>(lhs), true, rhs, false);
+		return MakeNode<SumOperator>(MakeNode<Integer>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator-(std::shared_ptr<Node> lhs, mpz_int const& rhs)
 	{
-		return std::make_shared<SumOperator>(lhs, true, std::make_shared<Integer>(rhs), false);
+		return MakeNode<SumOperator>(lhs, true, MakeNode<Integer>(rhs), false);
 	}
 	
 	inline std::shared_ptr<Node> operator-(mpz_int const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Integer>(lhs), true, rhs, false);
+		return MakeNode<SumOperator>(MakeNode<Integer>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator-(std::shared_ptr<Node> lhs, mpq_rational const& rhs)
 	{
-		return std::make_shared<SumOperator>(lhs, true, std::make_shared<Rational>(rhs,0), false);
+		return MakeNode<SumOperator>(lhs, true, MakeNode<Rational>(rhs,0), false);
 	}
 	
 	inline std::shared_ptr<Node> operator-(mpq_rational const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<SumOperator>(std::make_shared<Rational>(lhs,0), true, rhs, false);
+		return MakeNode<SumOperator>(MakeNode<Rational>(lhs,0), true, rhs, false);
 	}
 
 
@@ -1133,52 +1167,52 @@ namespace node{
 	
 	inline std::shared_ptr<Node> operator*(std::shared_ptr<Node> lhs, mpfr_float rhs)
 	{
-		return std::make_shared<MultOperator>(lhs,std::make_shared<Float>(rhs));
+		return MakeNode<MultOperator>(lhs,MakeNode<Float>(rhs));
 	}
 
 	inline std::shared_ptr<Node> operator*(std::shared_ptr<Node> lhs, mpfr rhs)
 	{
-		return std::make_shared<MultOperator>(lhs,std::make_shared<Float>(rhs));
+		return MakeNode<MultOperator>(lhs,MakeNode<Float>(rhs));
 	}
 	
 	inline std::shared_ptr<Node> operator*(mpfr_float lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Float>(lhs), rhs);
+		return MakeNode<MultOperator>(MakeNode<Float>(lhs), rhs);
 	}
 
 	inline std::shared_ptr<Node> operator*(mpfr lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Float>(lhs), rhs);
+		return MakeNode<MultOperator>(MakeNode<Float>(lhs), rhs);
 	}
 
 	inline std::shared_ptr<Node> operator*(std::shared_ptr<Node> lhs, int rhs)
 	{
-		return std::make_shared<MultOperator>(lhs,std::make_shared<Integer>(rhs));
+		return MakeNode<MultOperator>(lhs,MakeNode<Integer>(rhs));
 	}
 	
 	inline std::shared_ptr<Node> operator*(int lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Integer>(lhs), rhs);
+		return MakeNode<MultOperator>(MakeNode<Integer>(lhs), rhs);
 	}
 	
 	inline std::shared_ptr<Node> operator*(std::shared_ptr<Node> lhs, mpz_int const& rhs)
 	{
-		return std::make_shared<MultOperator>(lhs,std::make_shared<Integer>(rhs));
+		return MakeNode<MultOperator>(lhs,MakeNode<Integer>(rhs));
 	}
 	
 	inline std::shared_ptr<Node> operator*(mpz_int const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Integer>(lhs), rhs);
+		return MakeNode<MultOperator>(MakeNode<Integer>(lhs), rhs);
 	}
 	
 	inline std::shared_ptr<Node> operator*(std::shared_ptr<Node> lhs, mpq_rational const& rhs)
 	{
-		return std::make_shared<MultOperator>(lhs,std::make_shared<Rational>(rhs,0));
+		return MakeNode<MultOperator>(lhs,MakeNode<Rational>(rhs,0));
 	}
 	
 	inline std::shared_ptr<Node> operator*(mpq_rational const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Rational>(lhs,0), rhs);
+		return MakeNode<MultOperator>(MakeNode<Rational>(lhs,0), rhs);
 	}
 
 
@@ -1204,7 +1238,7 @@ namespace node{
 			}
 		}
 
-		std::shared_ptr<Node> temp = std::make_shared<MultOperator>(lhs,rhs);
+		std::shared_ptr<Node> temp = MakeNode<MultOperator>(lhs,rhs);
 		lhs.swap(temp);
 		return lhs;
 
@@ -1242,7 +1276,7 @@ namespace node{
 		// }
 
 
-		std::shared_ptr<Node> temp = std::make_shared<MultOperator>(lhs,true,rhs,false);
+		std::shared_ptr<Node> temp = MakeNode<MultOperator>(lhs,true,rhs,false);
 		lhs.swap(temp);
 		return lhs;
 	}
@@ -1262,52 +1296,52 @@ namespace node{
 	
 	inline std::shared_ptr<Node> operator/(std::shared_ptr<Node> lhs, mpfr_float rhs)
 	{
-		return std::make_shared<MultOperator>(lhs, true, std::make_shared<Float>(rhs), false);
+		return MakeNode<MultOperator>(lhs, true, MakeNode<Float>(rhs), false);
 	}
 
 	inline std::shared_ptr<Node> operator/(std::shared_ptr<Node> lhs, mpfr rhs)
 	{
-		return std::make_shared<MultOperator>(lhs, true, std::make_shared<Float>(rhs), false);
+		return MakeNode<MultOperator>(lhs, true, MakeNode<Float>(rhs), false);
 	}
 	
 	inline std::shared_ptr<Node> operator/(mpfr_float lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Float>(lhs), true, rhs, false);
+		return MakeNode<MultOperator>(MakeNode<Float>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator/(mpfr lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Float>(lhs), true, rhs, false);
+		return MakeNode<MultOperator>(MakeNode<Float>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator/(std::shared_ptr<Node> lhs, int rhs)
 	{
-		return std::make_shared<MultOperator>(lhs, true, std::make_shared<Integer>(rhs), false);
+		return MakeNode<MultOperator>(lhs, true, MakeNode<Integer>(rhs), false);
 	}
 	
 	inline std::shared_ptr<Node> operator/(int lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Integer>(lhs), true, rhs, false);
+		return MakeNode<MultOperator>(MakeNode<Integer>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator/(std::shared_ptr<Node> lhs, mpz_int const& rhs)
 	{
-		return std::make_shared<MultOperator>(lhs, true, std::make_shared<Integer>(rhs), false);
+		return MakeNode<MultOperator>(lhs, true, MakeNode<Integer>(rhs), false);
 	}
 	
 	inline std::shared_ptr<Node> operator/(mpz_int const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Integer>(lhs), true, rhs, false);
+		return MakeNode<MultOperator>(MakeNode<Integer>(lhs), true, rhs, false);
 	}
 
 	inline std::shared_ptr<Node> operator/(std::shared_ptr<Node> lhs, mpq_rational const& rhs)
 	{
-		return std::make_shared<MultOperator>(lhs, true, std::make_shared<Rational>(rhs,0), false);
+		return MakeNode<MultOperator>(lhs, true, MakeNode<Rational>(rhs,0), false);
 	}
 	
 	inline std::shared_ptr<Node> operator/(mpq_rational const& lhs,  std::shared_ptr<Node> rhs)
 	{
-		return std::make_shared<MultOperator>(std::make_shared<Rational>(lhs,0), true, rhs, false);
+		return MakeNode<MultOperator>(MakeNode<Rational>(lhs,0), true, rhs, false);
 	}
 
 
@@ -119,13 +119,13 @@ namespace node{
 		/**
 		 Compute the degree of a node.  For trig functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return nan.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override
 		{
 			return child_->Degree(v);
 		}
 		
 
-		int Degree(VariableGroup const& vars) const override
+		int FreshDegree(VariableGroup const& vars) const override
 		{
 			auto multideg = MultiDegree(vars);
 			auto deg = 0;
@@ -142,7 +142,7 @@ namespace node{
 		/**
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override
 		{
 			
 			std::vector<int> deg(vars.size());
@@ -160,7 +160,7 @@ namespace node{
 		}
 
 		
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 		{
 			if (Degree(v)==0)
 			{
@@ -174,7 +174,7 @@ namespace node{
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override
 		{
 			if (Degree(vars)==0)
 			{
@@ -193,8 +193,7 @@ namespace node{
 		 */
 		void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 
 			child_->precision(prec);
 		}
@@ -260,7 +259,26 @@ namespace node{
 		{
 			return children_[0];
 		}
-		
+
+		/**
+		 Get the children of this operator, in the order in which they were added.
+		 */
+		std::vector< std::shared_ptr<Node> > const& children() const
+		{
+			return children_;
+		}
+
+		/**
+		 Replace a child of this operator, keeping its position, and whatever else is stored per-child in derived types.
+
+		 \param index The position of the child to replace.
+		 \param new_child The new child.
+		 */
+		void SetChild(size_t index, std::shared_ptr<Node> new_child)
+		{
+			children_[index] = std::move(new_child);
+		}
+
 		
 		
 		
@@ -271,8 +289,7 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 			
 			this->PrecisionChangeSpecific(prec);
 
@@ -69,7 +69,7 @@ namespace node{
 		 
 		 For transcendental functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return -1.
 		 */
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override;
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override;
 	protected:
 		TrigOperator(){}
 	private:
@@ -109,7 +109,7 @@ namespace node{
 		/**
 		 Differentiates the sine function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		virtual ~SinOperator() = default;
@@ -175,7 +175,7 @@ namespace node{
 		/**
 		 Differentiates the sine function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		virtual ~ArcSinOperator() = default;
@@ -251,7 +251,7 @@ namespace node{
 		/**
 		 Differentiates the cosine function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		virtual ~CosOperator() = default;
@@ -321,7 +321,7 @@ namespace node{
 		/**
 		 Differentiates the cosine function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 
 
@@ -398,7 +398,7 @@ namespace node{
 		/**
 		 Differentiates the tangent function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		
@@ -468,7 +468,7 @@ namespace node{
 		/**
 		 Differentiates the tangent function.
 		 */
-		std::shared_ptr<Node> Differentiate() const override;
+		std::shared_ptr<Node> FreshDifferentiate() const override;
 		
 		
 		
@@ -517,40 +517,40 @@ namespace node{
 
 	inline std::shared_ptr<Node> sin(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<SinOperator>(N);
+		return MakeNode<SinOperator>(N);
 	}
 	
 	inline std::shared_ptr<Node> asin(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<ArcSinOperator>(N);
+		return MakeNode<ArcSinOperator>(N);
 	}
 	
 
 
 	inline std::shared_ptr<Node> cos(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<CosOperator>(N);
+		return MakeNode<CosOperator>(N);
 	}
 
 
 
 	inline std::shared_ptr<Node> acos(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<ArcCosOperator>(N);
+		return MakeNode<ArcCosOperator>(N);
 	}
 
 
 
 	inline std::shared_ptr<Node> tan(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<TanOperator>(N);
+		return MakeNode<TanOperator>(N);
 	}
 
 
 	
 	inline std::shared_ptr<Node> atan(const std::shared_ptr<Node> & N)
 	{
-		return std::make_shared<ArcTanOperator>(N);
+		return MakeNode<ArcTanOperator>(N);
 	}
 	
 	
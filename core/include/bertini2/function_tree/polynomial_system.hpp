@@ -0,0 +1,529 @@
+//This file is part of Bertini 2.
+//
+//polynomial_system.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polynomial_system.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polynomial_system.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file polynomial_system.hpp
+
+\brief Provides the PolynomialSystem type, the functions of a polynomial system expanded into tables of monomials.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_POLYNOMIAL_SYSTEM_HPP
+#define BERTINI_FUNCTION_TREE_POLYNOMIAL_SYSTEM_HPP
+
+#include <map>
+#include <vector>
+
+#include "bertini2/function_tree.hpp"
+#include "bertini2/function_tree/simplify.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/memory_usage.hpp"
+#include "bertini2/detail/thread_team.hpp"
+
+namespace bertini {
+
+	/**
+	\brief The functions of a system which are polynomial in its variables and path variable, expanded into sums of monomials.
+
+	Walking a function tree for a polynomial pays for a virtual call and a stored value at every sum, product, and power.  This class instead expands the trees once into, for each function, a list of terms, each a coefficient times a product of powers of the variables and the path variable.  Evaluation then
+
+	1. fills a table of the powers of each variable, up to the highest power in which it appears, so that powers are shared among all the terms, and
+	2. sums, for each term, its coefficient times the product of the powers it uses.
+
+	The Jacobian and time derivatives come from the same tables, differentiating each monomial exactly, so no derivative trees are needed.  The functions, Jacobian, and time derivatives can be computed together in a single pass over the terms.
+
+	The terms of a function are grouped by their powers of the variables, so that those differing only in the power of the path variable share one product of powers of the variables.  A homotopy \f$(1-t) f + \gamma t g\f$ expands every term of the target \f$f\f$, and of the start system \f$g\f$, into one with and one without \f$t\f$.  Grouped, each monomial in the variables is multiplied out, and differentiated, once, by its coefficient, a polynomial in \f$t\f$.  For a total degree start system, the start part of each function is then two groups, \f$x_i^{d_i}\f$ and a constant, and its Jacobian a single entry on the diagonal.
+
+	Coefficients made of Integer, Rational, and Float numbers are folded exactly, as rationals, and rounded to the working precision with no error beyond that.  Constant parts which are not exactly known -- Pi, E, or transcendental functions of numbers -- are kept as trees, and re-evaluated when the precision changes.
+
+	Values of variables are read from the Variable nodes themselves, so the usual System::SetVariables and System::SetPathVariable calls are the way to set the point of evaluation.
+
+	The tables are only read while sweeping the terms, so a large system may be evaluated on a team of threads, each sweeping a block of the functions with temporaries of its own, see UseThreads.
+
+	The tables refer to the nodes they were expanded from, and must be rebuilt if the trees change.
+	*/
+	class PolynomialSystem
+	{
+	public:
+		using Nd = std::shared_ptr<node::Node>;
+		using Var = std::shared_ptr<node::Variable>;
+
+		/**
+		\brief Expand function trees into tables of monomials.
+
+		\param functions The functions to expand.
+		\param variables The variables of the functions, in the order of the columns of the Jacobian.
+		\param path_variable The path variable.  May be nullptr, in which case time derivatives are unavailable.
+		\param max_terms The largest number of terms any function, or any of its subtrees, may expand into.  Guards against products of sums whose expansions are far larger than their trees.
+
+		\throws std::runtime_error if a function is not a polynomial in the variables and path variable, or expands into more than max_terms terms.
+		*/
+		PolynomialSystem(std::vector<Nd> const& functions,
+		                 VariableGroup const& variables,
+		                 Var const& path_variable = nullptr,
+		                 size_t max_terms = 100000);
+
+
+		/**
+		\brief The number of functions in the tables.
+		*/
+		size_t NumFunctions() const
+		{
+			return function_groups_.size()-1;
+		}
+
+		/**
+		\brief The number of variables, the columns of the Jacobian.
+		*/
+		size_t NumVariables() const
+		{
+			return num_variables_;
+		}
+
+		/**
+		\brief The total number of terms, over all the functions.
+		*/
+		size_t NumTerms() const
+		{
+			return exact_coefficients_.size();
+		}
+
+		/**
+		\brief The number of terms of one function.
+		*/
+		size_t NumTerms(size_t function_index) const
+		{
+			return group_terms_[function_groups_[function_index+1]] - group_terms_[function_groups_[function_index]];
+		}
+
+		/**
+		\brief The number of distinct monomials in the variables, over all the functions, by which the terms are grouped.
+		*/
+		size_t NumGroups() const
+		{
+			return group_factors_.size()-1;
+		}
+
+		/**
+		\brief The memory held by the monomial structure, the coefficients, and the tables of the sweep, those of the precisions recently left included.
+		*/
+		MemoryUsage MemoryReport() const;
+
+		/**
+		\brief The support of one function, the exponents of the variables in each of its monomials.
+
+		Terms differing only in their power of the path variable share a monomial in the variables, which is listed once.  Terms whose coefficients cancelled exactly in the expansion are not listed.
+
+		\param function_index The index of the function.
+		\return For each distinct monomial, the exponent of each variable, in the order of the columns of the Jacobian.
+		*/
+		std::vector< std::vector<unsigned> > Support(size_t function_index) const
+		{
+			std::vector< std::vector<unsigned> > support;
+			for (auto gg = function_groups_[function_index]; gg < function_groups_[function_index+1]; ++gg)
+			{
+				std::vector<unsigned> exponents(num_variables_, 0);
+				for (auto kk = group_factors_[gg]; kk < group_factors_[gg+1]; ++kk)
+					exponents[factor_inputs_[kk]] = factor_exponents_[kk];
+				support.push_back(std::move(exponents));
+			}
+			return support;
+		}
+
+		/**
+		\brief The coefficients of one function, one for each monomial of its Support, in the same order, at the current value of the path variable, rounded to the current precision.
+
+		\param function_index The index of the function.
+		*/
+		template<typename T>
+		std::vector<T> Coefficients(size_t function_index) const
+		{
+			LoadPowers<T>();
+			const auto& p = std::get<std::vector<T> >(powers_);
+			const auto& c = std::get<std::vector<T> >(coefficients_);
+
+			std::vector<T> coefficients;
+			for (auto gg = function_groups_[function_index]; gg < function_groups_[function_index+1]; ++gg)
+			{
+				T coefficient(0);
+				for (auto tt = group_terms_[gg]; tt < group_terms_[gg+1]; ++tt)
+					if (term_time_exponents_[tt])
+						coefficient += c[tt] * p[term_time_powers_[tt]];
+					else
+						coefficient += c[tt];
+				coefficients.push_back(coefficient);
+			}
+			return coefficients;
+		}
+
+		/**
+		\brief Whether the tables were expanded with a path variable, so that time derivatives are available.
+		*/
+		bool HaveTimeDerivative() const
+		{
+			return path_variable_!=nullptr;
+		}
+
+
+		/**
+		\brief Evaluate the functions at the current values of the variables.
+
+		Writes into the first NumFunctions() entries of function_values.
+		*/
+		template<typename Derived>
+		void EvalFunctions(Eigen::MatrixBase<Derived> & function_values) const
+		{
+			using T = typename Derived::Scalar;
+			Sweep<T>(&function_values, nullptr_mat<T>(), nullptr_vec<T>());
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian at the current values of the variables.
+
+		Writes into the first NumFunctions() rows of J.
+		*/
+		template<typename Derived>
+		void EvalJacobian(Eigen::MatrixBase<Derived> & J) const
+		{
+			using T = typename Derived::Scalar;
+			Sweep<T>(nullptr_vec<T>(), &J, nullptr_vec<T>());
+		}
+
+
+		/**
+		\brief Evaluate the functions and the Jacobian at the current values of the variables, in one pass over the terms.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalFunctionsAndJacobian(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J) const
+		{
+			using T = typename Derived::Scalar;
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+			Sweep<T>(&function_values, &J, nullptr_vec<T>());
+		}
+
+
+		/**
+		\brief Evaluate the derivatives of the functions with respect to the path variable, at the current values of the variables and path variable.
+
+		Writes into the first NumFunctions() entries of ds_dt.
+
+		\throws std::runtime_error if the tables were expanded without a path variable.
+		*/
+		template<typename Derived>
+		void EvalTimeDerivative(Eigen::MatrixBase<Derived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+			if (!HaveTimeDerivative())
+				throw std::runtime_error("evaluating time derivative of polynomial system expanded without path variable");
+			Sweep<T>(nullptr_vec<T>(), nullptr_mat<T>(), &ds_dt);
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian and the derivatives with respect to the path variable, in one pass over the terms.
+
+		\throws std::runtime_error if the tables were expanded without a path variable.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalJacobianAndTimeDerivative(Eigen::MatrixBase<Derived> & J, Eigen::MatrixBase<OtherDerived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+			if (!HaveTimeDerivative())
+				throw std::runtime_error("evaluating time derivative of polynomial system expanded without path variable");
+			Sweep<T>(nullptr_vec<T>(), &J, &ds_dt);
+		}
+
+
+		/**
+		\brief Change the precision of the multiple-precision tables, re-rounding the coefficients.
+
+		The tables at the precisions most recently left are kept, so that returning to one of them only swaps them back in.
+		*/
+		void precision(unsigned new_precision) const;
+
+		/**
+		\brief Read the variables and path variable from other nodes, as for a copy in a system with variables of its own.
+
+		\param substitutes The variable nodes to read in place of those the system was expanded against.  Variables not listed are read as before.
+		*/
+		void SubstituteInputs(std::map<const node::Variable*, Var> const& substitutes);
+
+		/**
+		\brief Get the precision of the multiple-precision tables.
+		*/
+		unsigned precision() const
+		{
+			return precision_;
+		}
+
+		/**
+		\brief Sweep the terms on a team of threads, each taking a block of consecutive functions, or on the calling thread alone if team is null.
+
+		The powers of the variables are filled on the calling thread, and then only read, as are the coefficients.  The functions are split evenly by number, so this pays when there are many functions of similar size, and each has many terms.  A copy of the tables shares the team, and runs on it take turns.
+
+		\param team The threads, or nullptr for none.
+		*/
+		void UseThreads(std::shared_ptr<detail::ThreadTeam> const& team)
+		{
+			team_ = team;
+			part_scratch_.clear();
+			if (team_)
+				part_scratch_.resize(team_->Size()-1);
+		}
+
+	private:
+
+		template<typename T>
+		static Eigen::MatrixBase<Vec<T> >* nullptr_vec()
+		{
+			return nullptr;
+		}
+
+		template<typename T>
+		static Eigen::MatrixBase<Mat<T> >* nullptr_mat()
+		{
+			return nullptr;
+		}
+
+
+		/**
+		\brief Fill the table of powers of the variables and path variable, from the values of their nodes.
+		*/
+		template<typename T>
+		void LoadPowers() const
+		{
+			auto& p = std::get<std::vector<T> >(powers_);
+			for (size_t ii = 0; ii < inputs_.size(); ++ii)
+			{
+				const auto begin = power_offsets_[ii], end = power_offsets_[ii+1];
+				// p[begin] is the zeroth power, always 1
+				if (end-begin < 2)
+					continue;
+
+				inputs_[ii]->EvalInPlace(p[begin+1]);
+				for (auto jj = begin+2; jj < end; ++jj)
+				{
+					p[jj] = p[jj-1];
+					p[jj] *= p[begin+1];
+				}
+			}
+		}
+
+
+		/**
+		\brief One pass over the terms, computing any of the function values, the Jacobian, and the time derivatives.
+
+		Each of the outputs may be nullptr, in which case it is not computed.
+
+		The terms of each group share a monomial in the variables, by which the sum of their coefficients times their powers of the path variable, the coefficient of the group, is multiplied.  The derivative of a group with respect to one of its variables is its coefficient times the exponent of the variable, times the next lower power of that variable, times the other factors.  Its derivative with respect to the path variable is the monomial times the sum of each coefficient times its exponent of the path variable, precomputed in time_derivative_coefficients_, times the next lower power of the path variable.
+		*/
+		template<typename T, typename DerivedF, typename DerivedJ, typename DerivedT>
+		void Sweep(Eigen::MatrixBase<DerivedF> * function_values, Eigen::MatrixBase<DerivedJ> * J, Eigen::MatrixBase<DerivedT> * ds_dt) const
+		{
+			LoadPowers<T>();
+
+			const auto num_functions = NumFunctions();
+			if (!team_ || num_functions < team_->Size())
+			{
+				SweepRows<T>(0, num_functions, std::get<std::vector<T> >(scratch_), function_values, J, ds_dt);
+				return;
+			}
+
+			team_->Run([&](unsigned part, unsigned num_parts)
+				{
+					SweepRows<T>(detail::PartBegin(num_functions, part, num_parts), detail::PartBegin(num_functions, part+1, num_parts),
+					             PartScratch<T>(part), function_values, J, ds_dt);
+				});
+		}
+
+
+		/**
+		\brief The temporaries of one part of a sweep on a team of threads.  Part 0, on the calling thread, uses scratch_, and the others copies of it, brought to its size and precision on the thread of the part.
+		*/
+		template<typename T>
+		std::vector<T> & PartScratch(unsigned part) const
+		{
+			auto& main = std::get<std::vector<T> >(scratch_);
+			if (part==0)
+				return main;
+
+			auto& s = std::get<std::vector<T> >(part_scratch_[part-1]);
+			if (s.size()!=main.size() || Precision(s.back())!=Precision(main.back()))
+			{
+				s.clear();
+				s = main;
+			}
+			return s;
+		}
+
+
+		/**
+		\brief The sweep over the terms of the functions in [row_begin, row_end), with temporaries s.
+		*/
+		template<typename T, typename DerivedF, typename DerivedJ, typename DerivedT>
+		void SweepRows(size_t row_begin, size_t row_end, std::vector<T> & s, Eigen::MatrixBase<DerivedF> * function_values, Eigen::MatrixBase<DerivedJ> * J, Eigen::MatrixBase<DerivedT> * ds_dt) const
+		{
+			const auto& p = std::get<std::vector<T> >(powers_);
+			const auto& c = std::get<std::vector<T> >(coefficients_);
+			const auto& dc = std::get<std::vector<T> >(time_derivative_coefficients_);
+			T& value = s[0];
+			T& sum = s[1];
+			T& derivative = s[2];
+			T& coefficient = s[3];
+			T& time_coefficient = s[4];
+			const T& zero = s[5];
+
+			const auto num_rows = static_cast<Eigen::DenseIndex>(row_end - row_begin);
+			if (J)
+				J->middleRows(row_begin, num_rows).setZero();
+			if (ds_dt)
+				ds_dt->segment(row_begin, num_rows).setZero();
+
+			for (size_t ii = row_begin; ii < row_end; ++ii)
+			{
+				sum = zero;
+				for (auto gg = function_groups_[ii]; gg < function_groups_[ii+1]; ++gg)
+				{
+					const auto begin = group_factors_[gg], end = group_factors_[gg+1];
+					const auto first_term = group_terms_[gg], last_term = group_terms_[gg+1];
+
+					if (function_values || J)
+					{
+						coefficient = c[first_term];
+						if (term_time_exponents_[first_term])
+							coefficient *= p[term_time_powers_[first_term]];
+						for (auto tt = first_term+1; tt < last_term; ++tt)
+						{
+							value = c[tt];
+							if (term_time_exponents_[tt])
+								value *= p[term_time_powers_[tt]];
+							coefficient += value;
+						}
+					}
+
+					if (function_values)
+					{
+						value = coefficient;
+						for (auto kk = begin; kk < end; ++kk)
+							value *= p[factor_powers_[kk]];
+						sum += value;
+					}
+
+					if (J)
+						for (auto aa = begin; aa < end; ++aa)
+						{
+							derivative = coefficient;
+							if (factor_exponents_[aa]!=1)
+								derivative *= factor_exponents_[aa];
+							derivative *= p[factor_powers_[aa]-1];
+							for (auto kk = begin; kk < end; ++kk)
+								if (kk!=aa)
+									derivative *= p[factor_powers_[kk]];
+
+							(*J)(ii,factor_inputs_[aa]) += derivative;
+						}
+
+					if (ds_dt)
+					{
+						bool depends_on_time = false;
+						for (auto tt = first_term; tt < last_term; ++tt)
+						{
+							if (!term_time_exponents_[tt])
+								continue;
+
+							value = dc[tt];
+							value *= p[term_time_powers_[tt]-1];
+							if (depends_on_time)
+								time_coefficient += value;
+							else
+								time_coefficient = value;
+							depends_on_time = true;
+						}
+
+						if (depends_on_time)
+						{
+							for (auto kk = begin; kk < end; ++kk)
+								time_coefficient *= p[factor_powers_[kk]];
+							(*ds_dt)(ii) += time_coefficient;
+						}
+					}
+				}
+
+				if (function_values)
+					(*function_values)(ii) = sum;
+			}
+		}
+
+
+		/**
+		\brief The value of the coefficient of a term, rounded to the current precision.
+		*/
+		template<typename T>
+		T CoefficientValue(size_t term) const;
+
+
+		/**
+		\brief Multiple-precision tables at a precision left, to come back to.
+		*/
+		struct PrecisionState
+		{
+			unsigned precision = 0; ///< The precision of the tables, or 0 if they are yet to be brought to one.
+			std::vector<mpfr> powers, coefficients, time_derivative_coefficients, scratch;
+		};
+
+		static constexpr size_t precision_cache_size_ = 4; ///< The number of precisions left whose tables are kept.
+
+		size_t num_variables_;
+		Var path_variable_;
+		std::vector<Var> inputs_; ///< The variables, followed by the path variable if there is one.
+
+		std::vector<size_t> power_offsets_; ///< Where the powers of each input begin in powers_, one past the last input at the end.
+		std::vector<size_t> function_groups_; ///< Where the groups of each function begin, one past the last group at the end.
+		std::vector<size_t> group_factors_; ///< Where the factors of the monomial in the variables of each group begin, one past the last factor at the end.
+		std::vector<size_t> group_terms_; ///< Where the terms of each group begin, one past the last term at the end.
+		std::vector<size_t> factor_inputs_; ///< For each factor, the index of its variable.
+		std::vector<size_t> factor_powers_; ///< For each factor, the index of its power in powers_.
+		std::vector<unsigned> factor_exponents_; ///< For each factor, the exponent of its variable.
+		std::vector<size_t> term_time_powers_; ///< For each term, the index in powers_ of its power of the path variable.  Unused if its exponent is 0.
+		std::vector<unsigned> term_time_exponents_; ///< For each term, its exponent of the path variable.
+
+		std::vector<node::detail::ExactValue> exact_coefficients_; ///< The exactly known part of the coefficient of each term.
+		std::vector<Nd> inexact_coefficients_; ///< The remaining part of the coefficient of each term, as a constant tree.  nullptr if the coefficient is exact.
+
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > powers_;
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > coefficients_;
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > time_derivative_coefficients_; ///< For each term, its coefficient times its exponent of the path variable.
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > scratch_; ///< Temporaries for the sweep, so that multiple-precision evaluation allocates nothing.  The last is always 0.
+		mutable unsigned precision_;
+		mutable std::vector<PrecisionState> precision_cache_; ///< The tables at precisions recently left, the most recent last.
+
+		std::shared_ptr<detail::ThreadTeam> team_; ///< The threads sweeping blocks of the functions, if any.
+		mutable std::vector< std::tuple< std::vector<dbl>, std::vector<mpfr> > > part_scratch_; ///< The temporaries of the parts of a sweep after the first.
+	};
+
+} // namespace bertini
+
+
+#endif
@@ -144,7 +144,7 @@ namespace node{
 		/** 
 		 Calls Differentiate on the entry node and returns differentiated entry node.
 		 */
-		std::shared_ptr<Node> Differentiate() const override
+		std::shared_ptr<Node> FreshDifferentiate() const override
 		{
 			return entry_node_->Differentiate();
 		}
@@ -155,13 +155,13 @@ namespace node{
 		/**
 		Compute the degree of a node.  For functions, the degree is the degree of the entry node.
 		*/
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override
 		{
 			return entry_node_->Degree(v);
 		}
 
 
-		int Degree(VariableGroup const& vars) const override
+		int FreshDegree(VariableGroup const& vars) const override
 		{
 			return entry_node_->Degree(vars);
 		}
@@ -171,7 +171,7 @@ namespace node{
 		/**
 		 Compute the multidegree with respect to a variable group.  This is for homogenization, and testing for homogeneity.  
 		*/
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override
 		{
 			
 			std::vector<int> deg(vars.size());
@@ -188,7 +188,7 @@ namespace node{
 			entry_node_->Homogenize(vars, homvar);
 		}
 
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 		{
 			return entry_node_->IsHomogeneous(v);
 		}
@@ -196,7 +196,7 @@ namespace node{
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override
 		{
 			return entry_node_->IsHomogeneous(vars);
 		}
@@ -209,11 +209,10 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			if (val_pair.first.precision()==prec)
+			if (current_value_.Precision()==prec)
 				return;
 			else{
-				val_pair.first.precision(prec);
+				current_value_.Precision(prec);
 				entry_node_->precision(prec);
 			}
 			
@@ -88,7 +88,7 @@ namespace node{
 				template<typename T>
 				T EvalJ(std::shared_ptr<Variable> const& diff_variable) const
 				{
-						auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
+						auto& val_pair = current_value_.Get<T>();
 
 						if(diff_variable == current_diff_variable_ && val_pair.second)
 							return val_pair.first;
@@ -109,7 +109,7 @@ namespace node{
 				template<typename T>
 				void EvalJInPlace(T& eval_value, std::shared_ptr<Variable> const& diff_variable) const
 				{
-						auto& val_pair = std::get< std::pair<T,bool> >(current_value_);
+						auto& val_pair = current_value_.Get<T>();
 
 						if(diff_variable == current_diff_variable_ && val_pair.second)
 							eval_value = val_pair.first;
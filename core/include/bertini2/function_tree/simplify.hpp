@@ -0,0 +1,265 @@
+//This file is part of Bertini 2.
+//
+//simplify.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//simplify.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with simplify.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file simplify.hpp
+
+\brief Provides passes which rewrite function trees into cheaper, equivalent trees.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_SIMPLIFY_HPP
+#define BERTINI_FUNCTION_TREE_SIMPLIFY_HPP
+
+#include <map>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "bertini2/function_tree.hpp"
+
+
+
+namespace bertini {
+namespace node{
+
+	/**
+	\brief Merge structurally identical subtrees of a collection of trees into single shared nodes.
+
+	Walks the trees from the leaves up, and replaces every operator whose type, children, and per-child data match those of one already seen with that one.  Since nodes store their values, a merged subtree is evaluated once per reset, no matter how many times it appears in the trees.  Numbers are merged if they are Integer or Rational and have the same value, differentials if they are with respect to the same variable.  Variables and Functions are never merged, as they are identified by pointer, but the trees under Functions are visited.
+
+	Operands are compared in order, so `x*y` and `y*x` are not merged.
+
+	The trees are modified in place.  Values stored in them are not reset.
+
+	\param roots The trees to simplify.  Each is visited, and can share nodes with the others.
+	\return The number of nodes which were replaced by an equivalent one.
+	*/
+	unsigned EliminateCommonSubexpressions(std::vector< std::shared_ptr<Node> > const& roots);
+
+
+	/**
+	\brief Fold the constant parts of a collection of trees, and remove the zero and identity terms differentiation leaves behind.
+
+	Walks the trees from the leaves up, and
+	- adds, multiplies, divides, negates, and raises to integer powers the Integer, Rational, and Float numbers it finds, exactly, replacing them with one Integer or Rational,
+	- drops terms which are 0 from sums, and factors which are 1 from products,
+	- replaces products with a factor of 0 by 0,
+	- replaces `x^0` by 1, `x^1` by `x`, `(x^a)^b` by `x^(a*b)` for integers a and b, and powers with an integer exponent by IntegerPowerOperators,
+	- removes double negations.
+
+	Pi, E, and transcendental functions are not folded, since their values depend on the precision in which they are evaluated.  Floats are converted to the exactly equal rational number, so folding them is exact, too.
+
+	The trees are modified in place.  A root which is a Function keeps its identity, and has its entry node replaced.  Other roots are replaced in the vector by their simplified trees.  Values stored in the trees are not reset.
+
+	\param roots The trees to simplify.  Each is visited, and can share nodes with the others.
+	\return The number of nodes which were replaced by a simpler one.
+	*/
+	unsigned Simplify(std::vector< std::shared_ptr<Node> > & roots);
+
+
+	/**
+	\brief Put trees in place of the differentials in derivative trees, turning total derivatives into directional ones.
+
+	The tree Node::Differentiate makes for a function is its total differential, \f$\sum_j \frac{\partial f}{\partial x_j} dx_j\f$, linear in the differentials.  Putting \f$v_j\f$ in place of each \f$dx_j\f$ gives the derivative of f in the direction v, the product of its Jacobian with v, as one tree.  Differentials of variables not given a tree, such as the path variable, are replaced by 0.
+
+	The trees are modified in place.  Roots which are differentials are replaced in the vector.  Only nodes made by differentiation have differentials as children, so the trees which were differentiated are not changed, though they are visited.  Values stored in the trees are not reset.
+
+	\param roots The derivative trees.  Each is visited, and can share nodes with the others.
+	\param directions The tree to put in place of the differential of each variable.
+	\return The number of differentials replaced.
+	*/
+	unsigned SubstituteDifferentials(std::vector< std::shared_ptr<Node> > & roots, std::map< const Variable*, std::shared_ptr<Node> > const& directions);
+
+
+
+	namespace detail{
+
+		/**
+		\brief Implementation of EliminateCommonSubexpressions.
+
+		Holds the table of nodes seen so far, keyed on their structure.  The keys refer to children by raw pointer, which is safe because the table holds the children alive.
+		*/
+		class SubexpressionMerger
+		{
+		public:
+
+			/**
+			\brief Get the node to use in place of n, merging n's children first.
+			*/
+			std::shared_ptr<Node> Canonical(std::shared_ptr<Node> const& n);
+
+			/**
+			\brief The number of nodes replaced so far.
+			*/
+			unsigned NumMerged() const
+			{
+				return num_merged_;
+			}
+
+		private:
+
+			struct Key
+			{
+				std::type_index type;
+				std::vector<const Node*> children;
+				std::vector<int> data;
+				std::string text;
+
+				bool operator==(Key const& other) const
+				{
+					return type==other.type && children==other.children && data==other.data && text==other.text;
+				}
+			};
+
+			struct KeyHash
+			{
+				size_t operator()(Key const& k) const;
+			};
+
+			/**
+			\brief Merge the children of n, and build its key.
+
+			\return false if n is a node which is never merged, true if key was filled.
+			*/
+			bool MakeKey(std::shared_ptr<Node> const& n, Key & key);
+
+			std::unordered_map<Key, std::shared_ptr<Node>, KeyHash> table_; ///< The canonical node for each structure seen.
+			std::unordered_map<const Node*, std::shared_ptr<Node> > visited_; ///< The canonical node for each node already visited.
+			unsigned num_merged_ = 0;
+		};
+
+
+
+		/**
+		\brief An exactly known complex number, for constant folding.
+		*/
+		struct ExactValue
+		{
+			mpq_rational real;
+			mpq_rational imag;
+		};
+
+		bool IsZero(ExactValue const& a);
+		bool IsOne(ExactValue const& a);
+		ExactValue Add(ExactValue const& a, ExactValue const& b);
+		ExactValue Subtract(ExactValue const& a, ExactValue const& b);
+		ExactValue Multiply(ExactValue const& a, ExactValue const& b);
+		ExactValue Divide(ExactValue const& a, ExactValue const& b); ///< b must be non-zero.
+		ExactValue Power(ExactValue const& a, int p); ///< a must be non-zero if p is negative.
+
+		/**
+		\brief Get the exact value of a number node.
+
+		\return false if n is not an Integer, Rational, or finite Float.
+		*/
+		bool GetExactValue(std::shared_ptr<Node> const& n, ExactValue & value);
+
+		/**
+		\brief Make the simplest number node with an exact value, an Integer if possible, otherwise a Rational.
+		*/
+		std::shared_ptr<Node> MakeNumber(ExactValue const& value);
+
+
+		/**
+		\brief Implementation of Simplify.
+
+		Holds the simplified form of every node visited so far, so that subtrees shared by several parents are simplified once, and stay shared.
+		*/
+		class Simplifier
+		{
+		public:
+
+			/**
+			\brief Get the node to use in place of n, simplifying n's children first.
+			*/
+			std::shared_ptr<Node> Simplified(std::shared_ptr<Node> const& n);
+
+			/**
+			\brief The number of nodes replaced so far.
+			*/
+			unsigned NumSimplified() const
+			{
+				return num_simplified_;
+			}
+
+		private:
+
+			std::shared_ptr<Node> SimplifySum(std::shared_ptr<SumOperator> const& n);
+			std::shared_ptr<Node> SimplifyProduct(std::shared_ptr<MultOperator> const& n);
+			std::shared_ptr<Node> SimplifyPower(std::shared_ptr<PowerOperator> const& n);
+			std::shared_ptr<Node> SimplifyIntegerPower(std::shared_ptr<IntegerPowerOperator> const& n);
+			std::shared_ptr<Node> SimplifyNegate(std::shared_ptr<NegateOperator> const& n);
+
+			/**
+			\brief Simplify a simplified base raised to an integer power.
+
+			\return The simpler node, or nullptr if there is nothing simpler than an IntegerPowerOperator.
+			*/
+			static std::shared_ptr<Node> IntegerPowerOf(std::shared_ptr<Node> const& base, int exponent);
+
+			std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node> > visited_; ///< The simplified node for each node already visited.  Keyed on the nodes themselves, so they stay alive while the table is in use.
+			unsigned num_simplified_ = 0;
+		};
+
+
+
+		/**
+		\brief Implementation of SubstituteDifferentials.
+
+		Holds the substituted form of every node visited so far, so that subtrees shared by several parents are visited once.
+		*/
+		class DifferentialSubstituter
+		{
+		public:
+
+			DifferentialSubstituter(std::map< const Variable*, std::shared_ptr<Node> > const& directions);
+
+			/**
+			\brief Get the node to use in place of n, substituting in n's children first.
+			*/
+			std::shared_ptr<Node> Substituted(std::shared_ptr<Node> const& n);
+
+			/**
+			\brief The number of differentials replaced so far.
+			*/
+			unsigned NumSubstituted() const
+			{
+				return num_substituted_;
+			}
+
+		private:
+
+			std::map< const Variable*, std::shared_ptr<Node> > const& directions_;
+			std::shared_ptr<Node> zero_; ///< Put in place of the differentials of variables without a direction.
+			std::unordered_map<const Node*, std::shared_ptr<Node> > visited_; ///< The substituted node for each node already visited.
+			unsigned num_substituted_ = 0;
+		};
+	} // re: namespace detail
+
+} // re: namespace node
+} // re: namespace bertini
+
+
+
+#endif
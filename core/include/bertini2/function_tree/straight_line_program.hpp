@@ -0,0 +1,1515 @@
+//This file is part of Bertini 2.
+//
+//straight_line_program.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//straight_line_program.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with straight_line_program.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file straight_line_program.hpp
+
+\brief Provides the StraightLineProgram type, a flat instruction tape compiled from function trees.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_STRAIGHT_LINE_PROGRAM_HPP
+#define BERTINI_FUNCTION_TREE_STRAIGHT_LINE_PROGRAM_HPP
+
+#include <map>
+#include <vector>
+#include <array>
+#include <tuple>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "bertini2/function_tree.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/double_double.hpp"
+#include "bertini2/complex_kernels.hpp"
+#include "bertini2/memory_usage.hpp"
+#include "bertini2/function_tree/taylor_series.hpp"
+#include "bertini2/detail/thread_team.hpp"
+#include "bertini2/detail/shared_array.hpp"
+
+namespace bertini {
+
+	namespace jit {
+		struct NativeKernels;
+	}
+
+	/**
+	\brief The operations which can appear in a StraightLineProgram.
+	*/
+	enum class SLPOperation
+	{
+		Add,
+		Subtract,
+		Multiply,
+		Divide,
+		Negate,
+		Power,
+		Sqrt,
+		Exp,
+		Log,
+		Sin,
+		Cos,
+		Tan,
+		ArcSin,
+		ArcCos,
+		ArcTan,
+		SinCos ///< The sine of first into result, and its cosine into second.  Never lowered from a tree, but fused from a Sin and a Cos of the same register.
+	};
+
+
+	/**
+	\brief Thrown when compiling a StraightLineProgram meets a node type it has no instruction for.
+
+	Distinct from the other errors of compilation, so that a System can fall back to evaluating its trees for this reason, and for no other.
+	*/
+	class UnsupportedNodeError : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+
+	/**
+	\brief A single instruction in a StraightLineProgram.
+
+	Reads from one or two registers, and writes to a third, or for SinCos, reads from one and writes to two.  Each register of a program is written exactly once, so there is no aliasing between the result and the operands.  In the schedule on which a program runs its plain evaluations, registers are reused, but never by an instruction for its own operands.
+	*/
+	struct SLPInstruction
+	{
+		SLPOperation operation;
+		size_t result;
+		size_t first;
+		size_t second; ///< Unused by unary operations.
+	};
+
+
+	/**
+	\brief Complex numbers, one for each lane of a batch of points evaluated together by a StraightLineProgram, held as separate arrays of real and imaginary parts.
+
+	Entry `index` of lane `lane` is at `index*Width + lane`, so that the lanes of an entry are contiguous, and arithmetic across them is a loop over reals which the compiler can vectorize.
+
+	The parts are doubles, see BatchLanes, or floats, see FloatBatchLanes, for the screening of easy steps in single precision.  A vector register holds twice as many floats as doubles, so the same loops run about twice as many lanes per instruction.
+	*/
+	template<typename S>
+	struct BasicBatchLanes
+	{
+		static constexpr size_t Width = 8; ///< The number of lanes.
+
+		std::vector<S> real;
+		std::vector<S> imag;
+
+		explicit BasicBatchLanes(size_t num_entries = 0) : real(num_entries*Width), imag(num_entries*Width)
+		{}
+
+		void Resize(size_t num_entries)
+		{
+			real.resize(num_entries*Width);
+			imag.resize(num_entries*Width);
+		}
+
+		size_t NumEntries() const
+		{
+			return real.size()/Width;
+		}
+
+		dbl Get(size_t index, size_t lane) const
+		{
+			return dbl(real[index*Width + lane], imag[index*Width + lane]);
+		}
+
+		void Set(size_t index, size_t lane, dbl const& value)
+		{
+			real[index*Width + lane] = S(value.real());
+			imag[index*Width + lane] = S(value.imag());
+		}
+	};
+
+	template<typename S>
+	constexpr size_t BasicBatchLanes<S>::Width;
+
+	using BatchLanes = BasicBatchLanes<double>; ///< Lanes in double precision.
+	using FloatBatchLanes = BasicBatchLanes<float>; ///< Lanes in single precision, see BatchTracker::ScreenInSinglePrecision.
+
+
+	/**
+	\brief A flat, compiled form of the functions of a system, their Jacobian, and their derivatives with respect to the path variable.
+
+	Evaluating the function tree walks `shared_ptr<Node>`'s, dispatching virtually at every node and resetting every node's stored value on each call.  This class lowers the trees once into a linear sequence of SLPInstruction's over a contiguous array of registers, one array for each number type, so that evaluation is a single loop with no pointer chasing.
+
+	The program is made of three consecutive segments:
+
+	1. the function values,
+	2. the Jacobian entries, and
+	3. the derivatives with respect to the path variable.
+
+	The later segments may read registers computed by the first, so evaluating the Jacobian or time derivative always runs the function segment first.
+
+	Values of variables are read from the Variable nodes themselves, so the usual System::SetVariables and System::SetPathVariable calls are the way to set the point of evaluation.  Numbers are loaded into registers once, and reloaded when precision changes.
+
+	Structurally shared subtrees (the same node reachable along several paths, as produced by differentiation and by subfunctions) are computed once.  Registers known to be zero or one are propagated through the arithmetic, so that the many trivial terms produced by Node::Differentiate do not generate instructions.  An exact zero is a strong zero: 0*x and 0/x are 0, so where x is infinite, or zero in a quotient, the program gives 0 where the trees give NaN.  Integer powers compile to multiplications, by squaring and multiplying through a table of the powers of each register, so that x^2, x^3, and x^5 anywhere in the system share their partial products rather than each being computed on its own.
+
+	Evaluation in double precision may be compensated, see Compensate, running the program in double-double registers so that cancellation among the terms of the functions costs no accuracy.
+
+	A program compiled without derivative trees can still produce the Jacobian and time derivatives, by forward-mode automatic differentiation: EvalForwardMode carries, alongside each register, its partial derivatives with respect to every variable (and the path variable, if any), and computes them together with the function values in a single sweep over the function segment.  This avoids building and walking the symbolic Jacobian altogether.
+
+	Along a curve in the variables, EvalTaylor computes the Taylor coefficients of the functions through any order, running the function segment in truncated Taylor arithmetic, see taylor_series.hpp.  This is what a Taylor series predictor needs of the system.
+
+	A large program may be run on a team of threads, each computing a block of the functions, and their rows of the Jacobian, in registers of its own, see UseThreads.
+
+	The program writes each register once, so a program of \f$10^5\f$ intermediate values has as many registers.  The plain evaluations, EvalFunctions, EvalJacobian, EvalTimeDerivative and their combinations, instead run on a schedule of the same instructions made when compiling.  Each instruction is moved to just before the first in its segment to read its result, and registers are reused once the values they held are dead, so they number no more than the values live at once, see NumRunRegisters.  The inputs, constants, and outputs keep registers of their own, numbered first.  The other evaluations, forward mode, Taylor, by blocks, and in batches, run on the program as compiled, and size their registers to it on first use, so a thread which only evaluates plainly holds only the registers of the schedule.  In multiple precision, at high precision, this is most of the memory of a copy of the program.
+
+	When every constant of the program is real, see HasRealCoefficients, the plain evaluations may also be run in real arithmetic, in double or mpfr_float, on registers of their own.  Their inputs are the real parts of the values of the variable nodes, and their constants the real parts of those of the complex registers.  A real multiplication is a quarter of a complex one, so real refinement of real points, and homotopies moving along the reals, evaluate several times faster.
+
+	The program refers to the nodes it was built from, and must be rebuilt if the trees change.
+	*/
+	class StraightLineProgram
+	{
+	public:
+		using Nd = std::shared_ptr<node::Node>;
+		using Var = std::shared_ptr<node::Variable>;
+
+		/**
+		\brief Indices for the three segments of the program.
+		*/
+		enum Segment
+		{
+			FunctionSegment = 0,
+			JacobianSegment = 1,
+			TimeDerivativeSegment = 2
+		};
+
+		/**
+		\brief Compile a program from function trees and their derivative trees.
+
+		\param functions The functions to compile.
+		\param derivatives The derivative trees of the functions, as produced by Node::Differentiate.  Must be the same length as functions, or empty if no Jacobian is wanted.
+		\param variables The variables with respect to which to differentiate, in the order of the columns of the Jacobian.
+		\param path_variable The path variable.  May be nullptr, in which case the time-derivative segment is empty.
+
+		\throws UnsupportedNodeError if the trees contain a node type which cannot be compiled.
+		\throws std::runtime_error if the number of derivatives is neither zero nor the number of functions.
+		*/
+		StraightLineProgram(std::vector<Nd> const& functions,
+		                    std::vector<Nd> const& derivatives,
+		                    VariableGroup const& variables,
+		                    Var const& path_variable = nullptr);
+
+
+		/**
+		\brief The number of functions computed by the program.
+		*/
+		size_t NumFunctions() const
+		{
+			return function_outputs_.size();
+		}
+
+		/**
+		\brief The number of variables, being the number of columns of the Jacobian.
+		*/
+		size_t NumVariables() const
+		{
+			return num_variables_;
+		}
+
+		/**
+		\brief The total number of instructions in all segments.
+		*/
+		size_t NumInstructions() const
+		{
+			return instructions_.size();
+		}
+
+		/**
+		\brief The number of instructions in a particular segment.
+		*/
+		size_t NumInstructions(Segment s) const
+		{
+			return segment_end_[s] - SegmentBegin(s);
+		}
+
+		/**
+		\brief The number of registers, including those for inputs and constants.
+		*/
+		size_t NumRegisters() const
+		{
+			return num_registers_;
+		}
+
+		/**
+		\brief The number of registers the plain evaluations run in, the inputs, constants and outputs included, with the rest reused once dead.  At most NumRegisters().
+		*/
+		size_t NumRunRegisters() const
+		{
+			return run_schedule_->num_registers;
+		}
+
+		/**
+		\brief Whether the program has a Jacobian segment.
+		*/
+		bool HaveJacobian() const
+		{
+			return have_jacobian_;
+		}
+
+		/**
+		\brief Whether the program has a time-derivative segment.
+		*/
+		bool HaveTimeDerivative() const
+		{
+			return have_jacobian_ && path_variable_!=nullptr;
+		}
+
+		/**
+		\brief Whether every constant of the program is real, and every input a variable or the path variable, so that at real values of those the program computes real numbers, and may be run in double or mpfr_float.
+
+		Operations which are not real at some real arguments, such as square roots and logarithms of negative numbers, give NaN in real arithmetic.
+		*/
+		bool HasRealCoefficients() const;
+
+		/**
+		\brief The memory held by the instructions, and the registers of each kind of evaluation, those of the precisions recently left included.
+		*/
+		MemoryUsage MemoryReport() const;
+
+
+		/**
+		\brief Write the program as an image, which FromImage makes a program of in place, its instructions viewed rather than copied.
+
+		The nodes read by the program are written as numbers, by which FromImage finds their counterparts.  The instructions are as laid out in memory, so the image is for builds of the same kind only.
+
+		\param out Where to write the image.  It is to be read from an address which is a multiple of 8.
+		\param input_id The number of each variable node read by the program, the path variable among them.
+		\param constant_id The number of each number node.
+		*/
+		void WriteImage(std::ostream & out, std::function<std::uint64_t(Var const&)> const& input_id, std::function<std::uint64_t(Nd const&)> const& constant_id) const;
+
+		/**
+		\brief Make a program of an image written by WriteImage, viewing its instructions in place, so that every program made of one image, in any process mapping it, shares them.
+
+		The program, and its copies, have registers of their own, as any program does.
+
+		\param data The image, at an address which is a multiple of 8.
+		\param size The bytes of the image.
+		\param owner Keeps the image where it is for as long as the program, or a copy of it, lives.
+		\param input The variable node of each number written by input_id.
+		\param constant The number node of each number written by constant_id.
+
+		\throws std::runtime_error if the image is cut short, or refers to registers the program does not have.
+		*/
+		static std::shared_ptr<StraightLineProgram> FromImage(char const* data, std::size_t size, std::shared_ptr<void const> const& owner, std::function<Var(std::uint64_t)> const& input, std::function<Nd(std::uint64_t)> const& constant);
+
+
+		/**
+		\brief Evaluate the functions at the current values of the variables.
+
+		Writes into the first NumFunctions() entries of function_values.  These may be double or mpfr_float, for a program with real coefficients, see HasRealCoefficients, evaluating at the real parts of the variables.
+		*/
+		template<typename Derived>
+		void EvalFunctions(Eigen::MatrixBase<Derived> & function_values) const
+		{
+			using T = typename Derived::Scalar;
+
+			if (RunningInBlocks<T>())
+			{
+				RunBlocks<T>(FunctionOutputs, [&](RowBlock const& block, std::vector<T> const& r)
+					{
+						CopyBlockOutputs(block, function_outputs_, 1, r, function_values);
+					});
+				return;
+			}
+
+			Run<T>({FunctionSegment});
+			CopyOutputs(function_outputs_, 1, function_values);
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian at the current values of the variables.
+
+		Writes into the first NumFunctions() rows of J.
+
+		\throws std::runtime_error if the program was compiled without derivatives.
+		*/
+		template<typename Derived>
+		void EvalJacobian(Eigen::MatrixBase<Derived> & J) const
+		{
+			using T = typename Derived::Scalar;
+
+			if (!have_jacobian_)
+				throw std::runtime_error("evaluating Jacobian of straight line program compiled without derivatives");
+
+			if (RunningInBlocks<T>())
+			{
+				RunBlocks<T>(JacobianOutputs, [&](RowBlock const& block, std::vector<T> const& r)
+					{
+						CopyBlockOutputs(block, jacobian_outputs_, num_variables_, r, J);
+					});
+				return;
+			}
+
+			Run<T>({FunctionSegment, JacobianSegment});
+			CopyOutputs(jacobian_outputs_, num_variables_, J);
+		}
+
+
+		/**
+		\brief Evaluate the functions and the Jacobian at the current values of the variables.
+
+		The function segment is run once, for both.
+
+		\throws std::runtime_error if the program was compiled without derivatives.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalFunctionsAndJacobian(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J) const
+		{
+			using T = typename Derived::Scalar;
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (!have_jacobian_)
+				throw std::runtime_error("evaluating Jacobian of straight line program compiled without derivatives");
+
+			if (RunningInBlocks<T>())
+			{
+				RunBlocks<T>(FunctionOutputs | JacobianOutputs, [&](RowBlock const& block, std::vector<T> const& r)
+					{
+						CopyBlockOutputs(block, function_outputs_, 1, r, function_values);
+						CopyBlockOutputs(block, jacobian_outputs_, num_variables_, r, J);
+					});
+				return;
+			}
+
+			Run<T>({FunctionSegment, JacobianSegment});
+			CopyOutputs(function_outputs_, 1, function_values);
+			CopyOutputs(jacobian_outputs_, num_variables_, J);
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian and the derivatives with respect to the path variable at the current values of the variables and path variable.
+
+		The function segment is run once, for both.
+
+		\throws std::runtime_error if the program was compiled without derivatives or without a path variable.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalJacobianAndTimeDerivative(Eigen::MatrixBase<Derived> & J, Eigen::MatrixBase<OtherDerived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (!HaveTimeDerivative())
+				throw std::runtime_error("evaluating time derivative of straight line program compiled without derivatives or path variable");
+
+			if (RunningInBlocks<T>())
+			{
+				RunBlocks<T>(JacobianOutputs | TimeDerivativeOutputs, [&](RowBlock const& block, std::vector<T> const& r)
+					{
+						CopyBlockOutputs(block, jacobian_outputs_, num_variables_, r, J);
+						CopyBlockOutputs(block, time_derivative_outputs_, 1, r, ds_dt);
+					});
+				return;
+			}
+
+			Run<T>({FunctionSegment, JacobianSegment, TimeDerivativeSegment});
+			CopyOutputs(jacobian_outputs_, num_variables_, J);
+			CopyOutputs(time_derivative_outputs_, 1, ds_dt);
+		}
+
+
+		/**
+		\brief Evaluate the derivatives of the functions with respect to the path variable, at the current values of the variables and path variable.
+
+		Writes into the first NumFunctions() entries of ds_dt.
+
+		\throws std::runtime_error if the program was compiled without derivatives or without a path variable.
+		*/
+		template<typename Derived>
+		void EvalTimeDerivative(Eigen::MatrixBase<Derived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+
+			if (!HaveTimeDerivative())
+				throw std::runtime_error("evaluating time derivative of straight line program compiled without derivatives or path variable");
+
+			if (RunningInBlocks<T>())
+			{
+				RunBlocks<T>(TimeDerivativeOutputs, [&](RowBlock const& block, std::vector<T> const& r)
+					{
+						CopyBlockOutputs(block, time_derivative_outputs_, 1, r, ds_dt);
+					});
+				return;
+			}
+
+			Run<T>({FunctionSegment, TimeDerivativeSegment});
+			CopyOutputs(time_derivative_outputs_, 1, ds_dt);
+		}
+
+
+		/**
+		\brief The number of directions carried by forward-mode differentiation.
+
+		This is the number of variables, plus one if there is a path variable.
+		*/
+		size_t NumDirections() const
+		{
+			return num_variables_ + (path_variable_ ? 1 : 0);
+		}
+
+
+		/**
+		\brief Evaluate the functions and their Jacobian at the current values of the variables, in one forward-mode sweep over the function segment.
+
+		Does not require that the program was compiled with derivatives.  Writes into the first NumFunctions() entries of function_values, and the first NumFunctions() rows of J.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalForwardMode(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J) const
+		{
+			using T = typename Derived::Scalar;
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			ForwardSweep<T>();
+
+			const auto& r = std::get<std::vector<T> >(registers_);
+			for (size_t ii = 0; ii < function_outputs_.size(); ++ii)
+				function_values(ii) = r[function_outputs_[ii]];
+			CopyForwardJacobian(J);
+		}
+
+
+		/**
+		\brief Evaluate the functions, their Jacobian, and their derivatives with respect to the path variable, in one forward-mode sweep over the function segment.
+
+		\throws std::runtime_error if the program was compiled without a path variable.
+		*/
+		template<typename Derived, typename OtherDerived, typename ThirdDerived>
+		void EvalForwardMode(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J, Eigen::MatrixBase<ThirdDerived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+			static_assert(std::is_same<typename ThirdDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (!path_variable_)
+				throw std::runtime_error("evaluating time derivative of straight line program compiled without path variable");
+
+			EvalForwardMode(function_values, J);
+			CopyForwardTimeDerivative(ds_dt);
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian at the current values of the variables, by forward-mode differentiation.
+
+		Writes into the first NumFunctions() rows of J.
+		*/
+		template<typename Derived>
+		void EvalJacobianForwardMode(Eigen::MatrixBase<Derived> & J) const
+		{
+			using T = typename Derived::Scalar;
+
+			ForwardSweep<T>();
+			CopyForwardJacobian(J);
+		}
+
+
+		/**
+		\brief Evaluate the derivatives of the functions with respect to the path variable, by forward-mode differentiation.
+
+		Writes into the first NumFunctions() entries of ds_dt.
+
+		\throws std::runtime_error if the program was compiled without a path variable.
+		*/
+		template<typename Derived>
+		void EvalTimeDerivativeForwardMode(Eigen::MatrixBase<Derived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+
+			if (!path_variable_)
+				throw std::runtime_error("evaluating time derivative of straight line program compiled without path variable");
+
+			ForwardSweep<T>();
+			CopyForwardTimeDerivative(ds_dt);
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian and the derivatives with respect to the path variable, in one forward-mode sweep.
+
+		\throws std::runtime_error if the program was compiled without a path variable.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalJacobianAndTimeDerivativeForwardMode(Eigen::MatrixBase<Derived> & J, Eigen::MatrixBase<OtherDerived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (!path_variable_)
+				throw std::runtime_error("evaluating time derivative of straight line program compiled without path variable");
+
+			ForwardSweep<T>();
+			CopyForwardJacobian(J);
+			CopyForwardTimeDerivative(ds_dt);
+		}
+
+
+		/**
+		\brief Evaluate the Taylor coefficients of the functions along a curve, in one sweep over the function segment in truncated Taylor arithmetic.
+
+		The curve is \f$x(s) = \sum_k X_k s^k\f$ in the variables, with \f$X_k\f$ the columns of variable_coefficients, and \f$t + s\f$ in the path variable.  Coefficient \f$k\f$ of each function along it, for k up to the number of columns less one, is written into column k of the first NumFunctions() rows of function_coefficients.  Other inputs, such as parameters, are read from their nodes, and are constant along the curve.
+
+		Does not require that the program was compiled with derivatives.  Registers which do not depend on the variables carry only their values, and an operation on series of order \f$K\f$ costs \f$O(K^2)\f$ of its arithmetic.
+
+		\throws std::runtime_error if the program was compiled without a path variable, or variable_coefficients does not have a row for each variable and at least one column.
+		*/
+		template<typename Derived, typename OtherDerived, typename T>
+		void EvalTaylor(Eigen::MatrixBase<Derived> & function_coefficients, Eigen::MatrixBase<OtherDerived> const& variable_coefficients, T const& time) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (!path_variable_)
+				throw std::runtime_error("evaluating Taylor coefficients of straight line program compiled without path variable");
+			if (static_cast<size_t>(variable_coefficients.rows())!=num_variables_ || variable_coefficients.cols()==0)
+				throw std::runtime_error("evaluating Taylor coefficients of straight line program, but the coefficients of the variables are " + std::to_string(variable_coefficients.rows()) + " by " + std::to_string(variable_coefficients.cols()) + ", not " + std::to_string(num_variables_) + " by at least 1");
+
+			const size_t order = variable_coefficients.cols() - 1;
+			TaylorSweep(variable_coefficients, time, order);
+
+			const auto& c = std::get<std::vector<T> >(series_);
+			for (size_t ii = 0; ii < function_outputs_.size(); ++ii)
+				for (size_t kk = 0; kk <= order; ++kk)
+					function_coefficients(ii,kk) = c[function_outputs_[ii]*(order+1) + kk];
+		}
+
+
+		/**
+		\brief The number of points evaluated in lockstep by EvalFunctionsBatch.
+		*/
+		static constexpr size_t BatchWidth = BatchLanes::Width;
+
+		/**
+		\brief Evaluate the functions at many points, in double precision, BatchWidth points at a time.
+
+		Each instruction of the function segment is run across a whole batch of points before moving to the next.  The registers for a batch are laid out as separate arrays of real and imaginary parts, with the points of the batch contiguous, so that arithmetic, including the multiplications to which integer powers compile, becomes short loops over doubles, which the compiler can vectorize.  The other operations are computed one point at a time.
+
+		Division is done by the textbook formula, without the rescaling std::complex does, so may overflow for divisors of magnitude beyond about 1e154.
+
+		The values of the variable nodes are neither used nor changed, except for those of inputs which are neither variables nor the path variable, such as implicit parameters, which are the same for every point.
+
+		\param points The points, one per column.  The rows are the variables, followed by the path variable if there is one, as for NumDirections().
+		\param function_values Resized to NumFunctions() by points.cols(), and filled with the function values, one column per point.
+
+		\throws std::runtime_error if the number of rows of points is not NumDirections().
+		*/
+		void EvalFunctionsBatch(Mat<dbl> const& points, Mat<dbl> & function_values) const;
+
+		/**
+		\brief Evaluate the functions, the Jacobian, and the derivatives with respect to the path variable, at the BatchWidth points of one batch, in double precision, by forward-mode differentiation.
+
+		As for EvalFunctionsBatch, each instruction is run across the lanes of the batch before moving to the next, and the partial derivatives carried with each register are laid out lane-contiguous as well, so the chain rule for the arithmetic operations vectorizes.  The derivatives of the other operations are computed one point at a time, then applied across the lanes.
+
+		\param inputs The points, NumDirections() entries: the variables, then the path variable.
+		\param function_values Resized to NumFunctions() entries.
+		\param jacobian Resized to NumFunctions() times NumVariables() entries, row-major.
+		\param time_derivatives Resized to NumFunctions() entries.
+
+		\throws std::runtime_error if the program was compiled without a path variable, or if inputs has the wrong number of entries.
+		*/
+		void EvalForwardModeBatch(BatchLanes const& inputs, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const;
+
+
+		/**
+		\brief Evaluate the functions at many points, as EvalFunctionsBatch does, with some of the other inputs, such as implicit parameters, taking a value for each point rather than the value of their node.
+
+		So one program evaluates a family of systems at many members at once, for sampling its parameter space.
+
+		\param points The points, one per column, as for EvalFunctionsBatch.
+		\param lane_inputs The nodes of the inputs which vary by point.  Those which are not inputs of the program are skipped.
+		\param lane_input_values Their values, a row for each of lane_inputs, a column for each point.
+		\param function_values Resized to NumFunctions() by points.cols(), and filled with the function values, one column per point.
+
+		\throws std::runtime_error if the number of rows of points is not NumDirections(), if lane_input_values is not lane_inputs.size() by points.cols(), or if one of lane_inputs is a variable or the path variable.
+		*/
+		void EvalFunctionsBatch(Mat<dbl> const& points, VariableGroup const& lane_inputs, Mat<dbl> const& lane_input_values, Mat<dbl> & function_values) const;
+
+		/**
+		\brief Evaluate the functions, the Jacobian, and the derivatives with respect to the path variable, at the points of one batch, as EvalForwardModeBatch does, with some of the other inputs taking a value for each lane.
+
+		\param inputs The points, NumDirections() entries: the variables, then the path variable.
+		\param lane_inputs The nodes of the inputs which vary by lane.  Those which are not inputs of the program are skipped.
+		\param lane_input_values Their values, an entry for each of lane_inputs.
+		\param function_values Resized to NumFunctions() entries.
+		\param jacobian Resized to NumFunctions() times NumVariables() entries, row-major.
+		\param time_derivatives Resized to NumFunctions() entries.
+
+		\throws std::runtime_error as EvalForwardModeBatch, or if lane_input_values does not have an entry for each of lane_inputs, or if one of lane_inputs is a variable or the path variable.
+		*/
+		void EvalForwardModeBatch(BatchLanes const& inputs, VariableGroup const& lane_inputs, BatchLanes const& lane_input_values, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const;
+
+		/**
+		\brief Evaluate the functions, the Jacobian, and the derivatives with respect to the path variable, at the points of one batch, as EvalForwardModeBatch does, in single precision.
+
+		For screening steps which are well enough conditioned that about seven digits do, see BatchTracker::ScreenInSinglePrecision.  The operations other than arithmetic, the exponential and the trigonometric functions are computed in double precision one point at a time, and rounded.  Always interpreted, as native code is compiled only for double precision.
+		*/
+		void EvalForwardModeBatch(FloatBatchLanes const& inputs, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const;
+
+		/**
+		\brief Evaluate the functions, the Jacobian, and the derivatives with respect to the path variable, at the points of one batch in single precision, with some of the other inputs taking a value for each lane.
+		*/
+		void EvalForwardModeBatch(FloatBatchLanes const& inputs, VariableGroup const& lane_inputs, FloatBatchLanes const& lane_input_values, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const;
+
+
+		/**
+		\brief Switch compensated evaluation in double precision on or off.
+
+		When on, EvalFunctions, EvalJacobian, EvalTimeDerivative, and their combinations, given double precision arguments, run the program in double-double registers, and round the results to double.  Every sum and product is then carried as a pair of doubles, by TwoSum and TwoProd, so the results are correct to about one rounding of double however much the terms of the functions cancel, where plain double arithmetic loses as many digits as cancel.  This costs a few times a plain double evaluation, much less than one in multiple precision.  Operations other than arithmetic and square roots go through MPFR, see dd_complex.
+
+		Evaluation in multiple precision, forward-mode evaluation, and batch evaluation are not affected.  Off by default.
+		*/
+		void Compensate(bool should_compensate = true) const
+		{
+			compensated_ = should_compensate;
+		}
+
+		/**
+		\brief Whether evaluation in double precision is compensated, see Compensate.
+		*/
+		bool Compensated() const
+		{
+			return compensated_;
+		}
+
+
+		/**
+		\brief Change the precision of the multiple-precision registers, and reload the constants at the new precision.
+
+		The subtrees from which the constants were compiled are changed to the new precision as well, but none of the rest of the nodes from which the program was compiled are touched.
+
+		The registers at the precisions most recently left are kept, with their constants loaded, so that returning to one of them, as adaptive precision tracking does constantly near a singularity, only swaps them back in.
+		*/
+		void precision(unsigned new_precision) const;
+
+		/**
+		\brief Read the inputs from other variable nodes, as for a copy of the program in a system with variables of its own.
+
+		\param substitutes The variable nodes to read in place of those the program was compiled against.  Variables not listed are read as before.
+		*/
+		void SubstituteInputs(std::map<const node::Variable*, Var> const& substitutes);
+
+		/**
+		\brief Get the current precision of the multiple-precision registers.
+		*/
+		unsigned precision() const
+		{
+			return precision_;
+		}
+
+		/**
+		\brief Run the program on a team of threads, each computing a block of consecutive functions, with their rows of the Jacobian and their time derivatives, or on the calling thread alone if team is null.
+
+		Each block runs only the instructions on which its outputs depend, in registers of its own, so work shared among the functions of several blocks, such as common powers, is repeated in each.  The instructions of a block are found on the first evaluation of each combination of outputs.  The inputs are loaded on the calling thread, and copied into the registers of each block.
+
+		Only EvalFunctions, EvalJacobian, EvalTimeDerivative, and their combinations run on the team, and not when compensated.  Forward mode and batches run on the calling thread.  A copy of the program shares the team, and runs on it take turns.
+
+		\param team The threads, or nullptr for none.  A team larger than the number of functions is not used.
+		*/
+		void UseThreads(std::shared_ptr<detail::ThreadTeam> const& team);
+
+		/**
+		\brief Compile the batch sweeps, EvalFunctionsBatch and EvalForwardModeBatch, to native code, which they run from then on in place of interpreting the instructions.  See native_code.hpp.
+
+		Programs with the same instructions share the code, so compiling a copy, or a program compiled again from the same system, takes no time.  A copy of the program shares the code as well.
+
+		\return Whether the sweeps are compiled, false if this build cannot compile, built without --enable-llvm-jit, or compiling failed.  The batch sweeps are interpreted as before if not.
+		*/
+		bool CompileNative() const;
+
+		/**
+		\brief Whether the batch sweeps run in native code, see CompileNative.
+		*/
+		bool CompiledNative() const
+		{
+			return bool(native_);
+		}
+
+
+		/**
+		\brief Write the program as C++, the members of a struct of generated kernels, see code_generation.hpp.
+
+		Writes a static function Constants, giving the real and imaginary parts of the constants the program loads, as strings, and the static function templates
+
+		\code
+		template<typename T> static void Eval(T const* inputs, T const* constants, T* function_values);
+		template<typename T> static void Jacobian(T const* inputs, T const* constants, T* jacobian);
+		template<typename T> static void TimeDerivative(T const* inputs, T const* constants, T* time_derivatives);
+		\endcode
+
+		each running the instructions on which its outputs depend, one local per register, with no dispatch.  The Jacobian is row-major.  The Jacobian is empty if the program was compiled without derivatives, as is the time derivative without a path variable.
+
+		\param out The stream to write to.
+		\param input_order The variable nodes in the order of the inputs of the generated kernels.  Every input of the program must be among them.
+		\param digits The number of digits to which to write the constants.
+
+		\throws std::runtime_error if an input of the program is not in input_order.
+		*/
+		void WriteCode(std::ostream & out, VariableGroup const& input_order, unsigned digits) const;
+
+	private:
+
+		/**
+		\brief An empty program, for FromImage to fill.
+		*/
+		StraightLineProgram() : num_variables_(0), have_jacobian_(false), precision_(DefaultPrecision())
+		{}
+
+		/**
+		\brief The outputs a block of rows computes, as bits, so that combinations of them index the instructions of a block.
+		*/
+		enum OutputKind : unsigned
+		{
+			FunctionOutputs = 1,
+			JacobianOutputs = 2,
+			TimeDerivativeOutputs = 4
+		};
+
+		/**
+		\brief A block of consecutive functions, evaluated by one thread of the team.
+		*/
+		struct RowBlock
+		{
+			size_t row_begin = 0, row_end = 0;
+			std::array< std::vector<size_t>, 8 > instructions; ///< For each combination of OutputKind, the indices of the instructions on which those outputs of the rows depend, in order.
+			std::array< bool, 8 > have_instructions{}; ///< Whether each entry of instructions has been found.
+			std::tuple< std::vector<dbl>, std::vector<mpfr>, std::vector<double>, std::vector<mpfr_float> > registers;
+		};
+
+		template<typename T>
+		bool RunningInBlocks() const
+		{
+			return !blocks_.empty() && !Compensating<T>();
+		}
+
+		/**
+		\brief The instructions on which some outputs of a block depend, found by walking the program backward from the outputs.
+		*/
+		std::vector<size_t> const& BlockInstructions(RowBlock & block, unsigned outputs) const;
+
+		/**
+		\brief The registers of a block in T, holding the inputs loaded into the registers of the program.  They are copied whole, constants and all, the first time, and when the precision has changed.
+		*/
+		template<typename T>
+		std::vector<T> & BlockRegisters(RowBlock & block) const
+		{
+			const auto& main = std::get<std::vector<T> >(registers_);
+			auto& r = std::get<std::vector<T> >(block.registers);
+			if (r.size()!=main.size() || Precision(r[zero_])!=Precision(main[zero_]))
+			{
+				r.clear();
+				r = main;
+			}
+			else
+				for (const auto& iter : inputs_)
+					r[iter.second] = main[iter.second];
+			return r;
+		}
+
+		/**
+		\brief Load the inputs, then run the instructions each block needs for some outputs, one block per thread of the team, passing its registers to copy_out to read its outputs from.
+		*/
+		template<typename T, typename CopyOut>
+		void RunBlocks(unsigned outputs, CopyOut const& copy_out) const
+		{
+			LoadRealConstants(std::get<std::vector<T> >(registers_));
+			AllRegisters<T>();
+			LoadInputs<T>();
+			for (auto& block : blocks_)
+				BlockInstructions(block, outputs);
+
+			team_->Run([&](unsigned part, unsigned)
+				{
+					auto& block = blocks_[part];
+					auto& r = BlockRegisters<T>(block);
+					for (auto ii : block.instructions[outputs])
+						ExecuteInstruction(instructions_[ii], r);
+					copy_out(block, r);
+				});
+		}
+
+		/**
+		\brief Copy the registers listed in outputs, for the rows of a block, into the same rows of destination.
+		*/
+		template<typename T, typename Derived>
+		static void CopyBlockOutputs(RowBlock const& block, std::vector<size_t> const& outputs, size_t num_columns, std::vector<T> const& r, Eigen::MatrixBase<Derived> & destination)
+		{
+			for (size_t ii = block.row_begin; ii < block.row_end; ++ii)
+				for (size_t jj = 0; jj < num_columns; ++jj)
+					destination(ii,jj) = r[outputs[ii*num_columns+jj]];
+		}
+
+
+		size_t SegmentBegin(Segment s) const
+		{
+			return s==FunctionSegment ? 0 : segment_end_[s-1];
+		}
+
+
+		/**
+		\brief The type of the registers in which evaluation in T is run when compensated: double-double for double, and T itself otherwise.
+		*/
+		template<typename T>
+		using CompensatedType = typename std::conditional<std::is_same<T,dbl>::value, dd_complex, T>::type;
+
+		/**
+		\brief Whether evaluation in T runs in the double-double registers.
+		*/
+		template<typename T>
+		bool Compensating() const
+		{
+			return compensated_ && std::is_same<T,dbl>::value;
+		}
+
+
+		/**
+		\brief Load the inputs and run segments of the program, in the registers of T, or in double-double if compensating.  Real registers get their constants first, if they need them.
+		*/
+		template<typename T>
+		void Run(std::initializer_list<Segment> segments) const
+		{
+			if (Compensating<T>())
+			{
+				if (std::get<std::vector<dd_complex> >(registers_).size()!=run_schedule_->num_registers)
+					LoadCompensatedConstants();
+				RunIn<CompensatedType<T> >(segments);
+			}
+			else
+			{
+				LoadRealConstants(std::get<std::vector<T> >(registers_));
+				RunIn<T>(segments);
+			}
+		}
+
+		/**
+		\brief Size the registers of a real evaluation for the schedule, and fill their constants with the real parts of those of the complex registers, the first time, and for mpfr_float whenever the precision has changed.  The complex registers have their constants from the constructor and precision(), so need nothing.
+		*/
+		template<typename T>
+		void LoadRealConstants(std::vector<T> &) const
+		{}
+
+		void LoadRealConstants(std::vector<double> & r) const;
+
+		void LoadRealConstants(std::vector<mpfr_float> & r) const;
+
+		template<typename R>
+		void RunIn(std::initializer_list<Segment> segments) const
+		{
+			LoadInputs<R>();
+			for (auto s : segments)
+				Execute<R>(s);
+		}
+
+
+		/**
+		\brief Copy the registers listed in outputs, row-major with num_columns columns and NumFunctions() rows, into the first rows of destination, from the registers evaluation ran in.
+		*/
+		template<typename Derived>
+		void CopyOutputs(std::vector<size_t> const& outputs, size_t num_columns, Eigen::MatrixBase<Derived> & destination) const
+		{
+			using T = typename Derived::Scalar;
+
+			if (Compensating<T>())
+				CopyOutputsFrom<CompensatedType<T> >(outputs, num_columns, destination);
+			else
+				CopyOutputsFrom<T>(outputs, num_columns, destination);
+		}
+
+		template<typename R, typename Derived>
+		void CopyOutputsFrom(std::vector<size_t> const& outputs, size_t num_columns, Eigen::MatrixBase<Derived> & destination) const
+		{
+			const auto& r = std::get<std::vector<R> >(registers_);
+
+			for (size_t ii = 0; ii < function_outputs_.size(); ++ii)
+				for (size_t jj = 0; jj < num_columns; ++jj)
+					destination(ii,jj) = Rounded(r[outputs[ii*num_columns+jj]]);
+		}
+
+		template<typename T>
+		static T const& Rounded(T const& x)
+		{
+			return x;
+		}
+
+		static dbl Rounded(dd_complex const& x)
+		{
+			return static_cast<dbl>(x);
+		}
+
+
+		template<typename Derived>
+		void CopyForwardJacobian(Eigen::MatrixBase<Derived> & J) const
+		{
+			using T = typename Derived::Scalar;
+			const auto& t = std::get<std::vector<T> >(tangents_);
+			const auto num_directions = NumDirections();
+
+			for (size_t ii = 0; ii < function_outputs_.size(); ++ii)
+				for (size_t jj = 0; jj < num_variables_; ++jj)
+					J(ii,jj) = t[function_outputs_[ii]*num_directions + jj];
+		}
+
+
+		template<typename Derived>
+		void CopyForwardTimeDerivative(Eigen::MatrixBase<Derived> & ds_dt) const
+		{
+			using T = typename Derived::Scalar;
+			const auto& t = std::get<std::vector<T> >(tangents_);
+			const auto num_directions = NumDirections();
+
+			for (size_t ii = 0; ii < function_outputs_.size(); ++ii)
+				ds_dt(ii) = t[function_outputs_[ii]*num_directions + num_variables_];
+		}
+
+
+		/**
+		\brief Copy the current values of the variable nodes into their registers.
+		*/
+		template<typename T>
+		void LoadInputs() const
+		{
+			auto& r = std::get<std::vector<T> >(registers_);
+			for (const auto& iter : inputs_)
+				LoadInput(r[iter.second], iter.first);
+		}
+
+		template<typename T>
+		static void LoadInput(T & reg, Var const& v)
+		{
+			reg = v->Eval<T>();
+		}
+
+		// the variables of a double precision evaluation hold doubles, which are exact in double-double
+		static void LoadInput(dd_complex & reg, Var const& v)
+		{
+			reg = dd_complex(v->Eval<dbl>());
+		}
+
+		// real evaluation is at the real parts of the variables
+		static void LoadInput(double & reg, Var const& v)
+		{
+			reg = v->Eval<dbl>().real();
+		}
+
+		static void LoadInput(mpfr_float & reg, Var const& v)
+		{
+			reg = v->Eval<mpfr>().real();
+		}
+
+
+		/**
+		\brief Run the instructions of one segment of the program, as scheduled for plain evaluation.
+		*/
+		template<typename T>
+		void Execute(Segment s) const
+		{
+			auto& r = std::get<std::vector<T> >(registers_);
+
+			const auto& scheduled = run_schedule_->instructions;
+			const auto end = segment_end_[s];
+			for (auto ii = SegmentBegin(s); ii < end; ++ii)
+				ExecuteInstruction(scheduled[ii], r);
+		}
+
+		/**
+		\brief The registers of T, sized for the program as compiled, one per value, rather than for the schedule.  Registers added are at the working precision.
+		*/
+		template<typename T>
+		std::vector<T> & AllRegisters() const
+		{
+			auto& r = std::get<std::vector<T> >(registers_);
+			if (r.size()!=num_registers_)
+			{
+				r.resize(num_registers_);
+				SetTangentPrecision(r);
+			}
+			return r;
+		}
+
+
+		/**
+		\brief Run a single instruction.
+		*/
+		template<typename T>
+		static void ExecuteInstruction(SLPInstruction const& instr, std::vector<T> & r)
+		{
+			// for double, which has no namespace for argument dependent lookup to search, in place of the complex overloads of namespace bertini
+			using std::pow; using std::sqrt; using std::exp; using std::log;
+			using std::sin; using std::cos; using std::tan; using std::asin; using std::acos; using std::atan;
+
+			switch (instr.operation)
+			{
+				case SLPOperation::Add:
+					r[instr.result] = r[instr.first] + r[instr.second]; break;
+				case SLPOperation::Subtract:
+					r[instr.result] = r[instr.first] - r[instr.second]; break;
+				case SLPOperation::Multiply:
+					r[instr.result] = kernels::Multiply(r[instr.first], r[instr.second]); break;
+				case SLPOperation::Divide:
+					r[instr.result] = r[instr.first] / r[instr.second]; break;
+				case SLPOperation::Negate:
+					r[instr.result] = -r[instr.first]; break;
+				case SLPOperation::Power:
+					r[instr.result] = pow(r[instr.first], r[instr.second]); break;
+				case SLPOperation::Sqrt:
+					r[instr.result] = sqrt(r[instr.first]); break;
+				case SLPOperation::Exp:
+					r[instr.result] = exp(r[instr.first]); break;
+				case SLPOperation::Log:
+					r[instr.result] = log(r[instr.first]); break;
+				case SLPOperation::Sin:
+					r[instr.result] = sin(r[instr.first]); break;
+				case SLPOperation::Cos:
+					r[instr.result] = cos(r[instr.first]); break;
+				case SLPOperation::Tan:
+					r[instr.result] = tan(r[instr.first]); break;
+				case SLPOperation::ArcSin:
+					r[instr.result] = asin(r[instr.first]); break;
+				case SLPOperation::ArcCos:
+					r[instr.result] = acos(r[instr.first]); break;
+				case SLPOperation::ArcTan:
+					r[instr.result] = atan(r[instr.first]); break;
+				case SLPOperation::SinCos:
+					SinCos(r[instr.first], r[instr.result], r[instr.second]); break;
+			}
+		}
+
+
+		/**
+		\brief Fill the lanes of the batch registers holding constants, and inputs which are neither variables nor the path variable, which are the same for every point.
+		*/
+		template<typename S>
+		void LoadBatchConstants(S * re, S * im) const;
+
+		/**
+		\brief The forward-mode batch evaluation in double or single precision, in the given batch registers and tangents.
+		*/
+		template<typename S>
+		void EvalForwardModeBatchIn(BasicBatchLanes<S> const& inputs, VariableGroup const& lane_inputs, BasicBatchLanes<S> const& lane_input_values,
+		                            BasicBatchLanes<S> & function_values, BasicBatchLanes<S> & jacobian, BasicBatchLanes<S> & time_derivatives,
+		                            std::vector<S> & real, std::vector<S> & imag, std::vector<S> & tangents_real, std::vector<S> & tangents_imag) const;
+
+		/**
+		\brief The registers of inputs given a value for each lane, or no_register_ for those which are not inputs of the program.
+
+		\throws std::runtime_error if one is a variable or the path variable, whose lanes are the points.
+		*/
+		std::vector<size_t> LaneInputRegisters(VariableGroup const& lane_inputs) const;
+
+
+		/**
+		\brief Size the tangent registers for a number type, and fill those which never change: zero for constants, and unit vectors for the variables.
+		*/
+		template<typename T>
+		void InitializeTangents() const
+		{
+			auto& t = std::get<std::vector<T> >(tangents_);
+			const auto num_directions = NumDirections();
+
+			t.assign(num_registers_*num_directions, T(0));
+			for (size_t ii = 0; ii < inputs_.size(); ++ii)
+				if (input_directions_[ii]>=0)
+					t[inputs_[ii].second*num_directions + input_directions_[ii]] = T(1);
+
+			SetTangentPrecision(t);
+		}
+
+		void SetTangentPrecision(std::vector<dbl> &) const
+		{}
+
+		void SetTangentPrecision(std::vector<mpfr> & t) const
+		{
+			for (auto& iter : t)
+				iter.precision(precision_);
+		}
+
+		void SetTangentPrecision(std::vector<double> &) const
+		{}
+
+		void SetTangentPrecision(std::vector<mpfr_float> & t) const
+		{
+			for (auto& iter : t)
+				iter.precision(precision_);
+		}
+
+
+		/**
+		\brief Run the function segment, carrying the partial derivatives of each register along with its value.
+
+		Registers which do not depend on any variable have identically zero tangents, and only their values are computed.
+		*/
+		template<typename T>
+		void ForwardSweep() const
+		{
+			auto& r = AllRegisters<T>();
+			auto& t = std::get<std::vector<T> >(tangents_);
+			const auto num_directions = NumDirections();
+
+			if (t.size()!=num_registers_*num_directions)
+				InitializeTangents<T>();
+
+			LoadInputs<T>();
+
+			const auto end = segment_end_[FunctionSegment];
+			for (size_t ii = 0; ii < end; ++ii)
+			{
+				const auto& instr = instructions_[ii];
+				if (!has_tangent_[instr.result])
+				{
+					ExecuteInstruction(instr, r);
+					continue;
+				}
+
+				const auto& a = r[instr.first];
+				const auto& b = r[instr.second];
+				auto& result = r[instr.result];
+
+				T* dr = t.data() + instr.result*num_directions;
+				const T* da = t.data() + instr.first*num_directions;
+				const T* db = t.data() + instr.second*num_directions;
+
+				T c; // the derivative of a unary operation with respect to its argument
+				switch (instr.operation)
+				{
+					case SLPOperation::Add:
+						result = a + b;
+						for (size_t kk = 0; kk < num_directions; ++kk)
+							dr[kk] = da[kk] + db[kk];
+						continue;
+					case SLPOperation::Subtract:
+						result = a - b;
+						for (size_t kk = 0; kk < num_directions; ++kk)
+							dr[kk] = da[kk] - db[kk];
+						continue;
+					case SLPOperation::Multiply:
+						for (size_t kk = 0; kk < num_directions; ++kk)
+						{
+							dr[kk] = kernels::Multiply(da[kk], b);
+							kernels::MultiplyAdd(dr[kk], a, db[kk]);
+						}
+						result = kernels::Multiply(a, b);
+						continue;
+					case SLPOperation::Divide:
+						result = a / b;
+						for (size_t kk = 0; kk < num_directions; ++kk)
+							dr[kk] = (da[kk] - result*db[kk]) / b;
+						continue;
+					case SLPOperation::Power:
+					{
+						// d(a^b) = b a^(b-1) da + a^b log(a) db.  the second term is skipped for constant exponents, as log(a) may not exist.
+						result = pow(a, b);
+						const T c_a = has_tangent_[instr.first] ? T(b * pow(a, b - T(1))) : T(0);
+						const T c_b = has_tangent_[instr.second] ? T(result * log(a)) : T(0);
+						for (size_t kk = 0; kk < num_directions; ++kk)
+							dr[kk] = c_a*da[kk] + c_b*db[kk];
+						continue;
+					}
+					case SLPOperation::Negate:
+						result = -a;
+						for (size_t kk = 0; kk < num_directions; ++kk)
+							dr[kk] = -da[kk];
+						continue;
+					case SLPOperation::Sqrt:
+						result = sqrt(a);
+						c = T(1) / (T(2)*result); break;
+					case SLPOperation::Exp:
+						result = exp(a);
+						c = result; break;
+					case SLPOperation::Log:
+						c = T(1) / a;
+						result = log(a); break;
+					case SLPOperation::Sin:
+						c = cos(a);
+						result = sin(a); break;
+					case SLPOperation::Cos:
+						c = -sin(a);
+						result = cos(a); break;
+					case SLPOperation::Tan:
+						c = T(1) / pow(cos(a), 2);
+						result = tan(a); break;
+					case SLPOperation::ArcSin:
+						c = T(1) / sqrt(T(1) - pow(a, 2));
+						result = asin(a); break;
+					case SLPOperation::ArcCos:
+						c = -T(1) / sqrt(T(1) - pow(a, 2));
+						result = acos(a); break;
+					case SLPOperation::ArcTan:
+						c = T(1) / (T(1) + pow(a, 2));
+						result = atan(a); break;
+					case SLPOperation::SinCos:
+					{
+						// each is the derivative of the other, up to sign
+						auto& cosine = r[instr.second];
+						T* dc = t.data() + instr.second*num_directions;
+						SinCos(a, result, cosine);
+						for (size_t kk = 0; kk < num_directions; ++kk)
+						{
+							dr[kk] = cosine*da[kk];
+							dc[kk] = -result*da[kk];
+						}
+						continue;
+					}
+				}
+
+				// the chain rule for the unary operations
+				for (size_t kk = 0; kk < num_directions; ++kk)
+					dr[kk] = c*da[kk];
+			}
+		}
+
+
+		/**
+		\brief Run the function segment in truncated Taylor arithmetic, through the given order, see EvalTaylor.
+
+		Registers which do not depend on the variables or path variable are computed as values, and their series are those values and zeros.
+		*/
+		template<typename Derived, typename T>
+		void TaylorSweep(Eigen::MatrixBase<Derived> const& variable_coefficients, T const& time, size_t order) const
+		{
+			auto& r = AllRegisters<T>();
+			auto& c = std::get<std::vector<T> >(series_);
+			auto& scratch = std::get<std::vector<T> >(series_scratch_);
+			const size_t width = order + 1;
+
+			if (c.size()!=num_registers_*width)
+			{
+				c.assign(num_registers_*width, T(0));
+				SetTangentPrecision(c);
+			}
+
+			LoadInputs<T>();
+
+			for (size_t ii = 0; ii < inputs_.size(); ++ii)
+			{
+				const auto reg = inputs_[ii].second;
+				T* series = c.data() + reg*width;
+				const int direction = input_directions_[ii];
+				if (direction<0)
+					taylor::Constant(series, r[reg], order);
+				else if (static_cast<size_t>(direction)<num_variables_)
+					for (size_t kk = 0; kk < width; ++kk)
+						series[kk] = variable_coefficients(direction, kk);
+				else
+				{
+					taylor::Constant(series, time, order);
+					if (order>0)
+						series[1] = T(1);
+				}
+			}
+
+			taylor::Constant(c.data() + zero_*width, r[zero_], order);
+			taylor::Constant(c.data() + one_*width, r[one_], order);
+			for (const auto& iter : constants_)
+				taylor::Constant(c.data() + iter.second*width, r[iter.second], order);
+
+			const auto end = segment_end_[FunctionSegment];
+			for (size_t ii = 0; ii < end; ++ii)
+			{
+				const auto& instr = instructions_[ii];
+				T* result = c.data() + instr.result*width;
+				if (!has_tangent_[instr.result])
+				{
+					ExecuteInstruction(instr, r);
+					taylor::Constant(result, r[instr.result], order);
+					if (instr.operation==SLPOperation::SinCos)
+						taylor::Constant(c.data() + instr.second*width, r[instr.second], order);
+					continue;
+				}
+
+				const T* a = c.data() + instr.first*width;
+				const T* b = c.data() + instr.second*width;
+
+				switch (instr.operation)
+				{
+					case SLPOperation::Add:
+						taylor::Add(result, a, b, order); break;
+					case SLPOperation::Subtract:
+						taylor::Subtract(result, a, b, order); break;
+					case SLPOperation::Multiply:
+						taylor::Multiply(result, a, b, order); break;
+					case SLPOperation::Divide:
+						taylor::Divide(result, a, b, order); break;
+					case SLPOperation::Negate:
+						taylor::Negate(result, a, order); break;
+					case SLPOperation::Power:
+						// as for the tangents, a constant exponent is not taken through log(a), which may not exist
+						if (has_tangent_[instr.second])
+							taylor::GeneralPower(result, a, b, order, scratch);
+						else
+							taylor::Power(result, a, r[instr.second], order);
+						break;
+					case SLPOperation::Sqrt:
+						taylor::Sqrt(result, a, order); break;
+					case SLPOperation::Exp:
+						taylor::Exp(result, a, order); break;
+					case SLPOperation::Log:
+						taylor::Log(result, a, order); break;
+					case SLPOperation::Sin:
+						scratch.resize(width);
+						taylor::SinCos(result, scratch.data(), a, order); break;
+					case SLPOperation::Cos:
+						scratch.resize(width);
+						taylor::SinCos(scratch.data(), result, a, order); break;
+					case SLPOperation::Tan:
+						scratch.resize(width);
+						taylor::Tan(result, a, order, scratch.data()); break;
+					case SLPOperation::ArcSin:
+						taylor::ArcSinCos(result, a, false, order, scratch); break;
+					case SLPOperation::ArcCos:
+						taylor::ArcSinCos(result, a, true, order, scratch); break;
+					case SLPOperation::ArcTan:
+						taylor::ArcTan(result, a, order, scratch); break;
+					case SLPOperation::SinCos:
+						taylor::SinCos(result, c.data() + instr.second*width, a, order); break;
+				}
+			}
+		}
+
+
+		//////////////
+		//
+		//  functions used while compiling
+		//
+		/////////////////
+
+		size_t Lower(Nd const& n, int diff_index, Segment s);
+		size_t LowerOperator(Nd const& n, int diff_index, Segment s);
+		bool DependsOnDifferential(Nd const& n);
+
+		size_t NewRegister();
+		size_t Emit(SLPOperation op, size_t first, size_t second = 0);
+		size_t AddOrSubtract(size_t a, size_t b, bool add);
+		size_t Multiply(size_t a, size_t b);
+		size_t Divide(size_t a, size_t b);
+		size_t Negate(size_t a);
+		size_t IntegerPower(size_t a, int exponent, Segment s);
+		size_t Input(Var const& v);
+		size_t Constant(Nd const& n);
+
+		/**
+		\brief Replace each Sin and Cos of a register with an earlier Cos or Sin of the same one by a single SinCos, in place of the earlier.
+
+		A pair is fused only if the earlier runs whenever the later does, so is in the function segment, which every evaluation runs, or the same segment.
+		*/
+		void FuseSinCos();
+
+		/**
+		\brief Renumber the registers, those of the inputs and constants first, after 0 and 1, then those of the outputs, then the rest in the order they are written, so that those which hold the same value for the whole of an evaluation come first.
+		*/
+		void NumberRegisters();
+
+		/**
+		\brief Make the schedule for plain evaluation, see the class notes.
+
+		Each segment is reordered, each instruction put just before the first in its segment reading its result.  Then the registers are allocated in one pass, through their last reads in any later segment, and a register is freed after the instruction reading it last, to be taken by the next result, the most recently freed first.  If the registers which are not to be reused, the inputs, constants and outputs, are not numbered first, as in an image written before NumberRegisters was, the schedule is the program itself.
+		*/
+		void ScheduleRegisters();
+
+		void LoadConstants() const;
+
+		/**
+		\brief Size the double-double registers, and fill those of the constants, read from their trees at no fewer than DoubleDoublePrecision() digits.
+		*/
+		void LoadCompensatedConstants() const;
+
+
+		/**
+		\brief The instructions of the program as run by plain evaluation, reordered within each segment, and with the registers reused.
+		*/
+		struct RunSchedule
+		{
+			std::vector<SLPInstruction> instructions; ///< The instructions, in the same segments as those of the program.
+			size_t num_registers = 0; ///< The registers they need.
+		};
+
+		/**
+		\brief Multiple-precision registers and tangents at a precision left, to come back to.
+		*/
+		struct PrecisionState
+		{
+			unsigned precision = 0; ///< The precision of the registers, or 0 if they are yet to be brought to one.
+			std::vector<mpfr> registers;
+			std::vector<mpfr> tangents;
+		};
+
+		static constexpr size_t precision_cache_size_ = 4; ///< The number of precisions left whose registers are kept.
+		static constexpr size_t zero_ = 0; ///< The register always holding 0.
+		static constexpr size_t one_ = 1; ///< The register always holding 1.
+		static constexpr int no_differentiation_ = -1; ///< The diff_index used when lowering trees which are not derivatives.
+		static constexpr size_t no_register_ = size_t(-1); ///< The register of a lane input which is not an input of the program.
+
+		detail::SharedArray<SLPInstruction> instructions_; ///< Held, or viewed in an image, see FromImage.
+		std::array<size_t,3> segment_end_; ///< One past the last instruction of each segment.
+		std::shared_ptr<RunSchedule const> run_schedule_; ///< The instructions as run by plain evaluation.  Shared by copies.
+
+		std::vector< std::pair<Var, size_t> > inputs_; ///< Variable nodes, and the registers into which their values are loaded.
+		std::vector< std::pair<Nd, size_t> > constants_; ///< Number nodes, and the registers holding their values.
+
+		std::vector<size_t> function_outputs_;
+		std::vector<size_t> jacobian_outputs_; ///< Row-major, NumFunctions() by NumVariables().
+		std::vector<size_t> time_derivative_outputs_;
+
+		size_t num_registers_ = 2;
+		size_t num_variables_;
+		bool have_jacobian_;
+		Var path_variable_;
+
+		std::vector<int> input_directions_; ///< For each entry of inputs_, its index among the variables and path variable, or -1 if it is neither.
+		std::vector<bool> has_tangent_; ///< For each register, whether it depends on any variable or the path variable.
+
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr>, std::vector<dd_complex>, std::vector<double>, std::vector<mpfr_float> > registers_; ///< Sized for the schedule, and for the whole program by the evaluations which need it, see AllRegisters.  The double-double registers are only for compensated evaluation, and the real ones for real evaluation, see LoadRealConstants, and are sized on first use.
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > tangents_; ///< The partial derivatives of the registers, NumDirections() per register, used by forward-mode differentiation.  Sized on first use.
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > series_; ///< The Taylor coefficients of the registers, order+1 per register, used by EvalTaylor.  Sized on first use, and for each order.
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > series_scratch_; ///< Space for the series an operation of EvalTaylor needs along the way.
+		mutable unsigned precision_;
+		mutable bool compensated_ = false; ///< Whether evaluation in double runs in the double-double registers.
+		mutable std::vector<PrecisionState> precision_cache_; ///< The registers at precisions recently left, the most recent last.
+		mutable std::vector<double> batch_real_, batch_imag_; ///< The registers for EvalFunctionsBatch, BatchWidth consecutive entries per register.
+		std::shared_ptr<detail::ThreadTeam> team_; ///< The threads running the blocks, if any.
+		mutable std::vector<RowBlock> blocks_; ///< One block of functions per thread of team_, or none to run on the calling thread.
+		mutable std::vector<double> batch_tangents_real_, batch_tangents_imag_; ///< The partial derivatives of the batch registers for EvalForwardModeBatch, BatchWidth consecutive entries per direction, NumDirections() directions per register.  Sized on first use.
+		mutable std::vector<float> float_batch_real_, float_batch_imag_, float_batch_tangents_real_, float_batch_tangents_imag_; ///< The registers and their partial derivatives for EvalForwardModeBatch in single precision.  Sized on first use.
+		mutable std::shared_ptr<jit::NativeKernels const> native_; ///< The compiled batch sweeps, if CompileNative has succeeded.  Shared by copies, and with every program having the same instructions.
+
+		// the following are only used during compilation.
+		std::vector<const node::Variable*> differentiation_variables_; ///< The variables, followed by the path variable.  Indexed by diff_index.
+		std::map< std::pair<const node::Node*, int>, size_t> lowered_; ///< Registers holding already-lowered nodes, keyed on node and context.
+		std::map< const node::Node*, bool> depends_on_differential_;
+		std::map< const node::Node*, size_t> input_registers_;
+		std::map< const node::Node*, size_t> constant_registers_;
+		std::map< std::tuple<size_t, int, Segment>, size_t> powers_; ///< Registers holding powers of registers, keyed on base, exponent, and the segment they were computed in.
+	};
+
+} // namespace bertini
+
+
+#endif
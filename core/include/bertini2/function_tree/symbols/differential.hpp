@@ -95,9 +95,9 @@ namespace node{
 		/**
 		 Differentiates a number.  Should this return the special number Zero?
 		 */
-		std::shared_ptr<Node> Differentiate() const override
+		std::shared_ptr<Node> FreshDifferentiate() const override
 		{
-			return std::make_shared<Integer>(0);
+			return MakeNode<Integer>(0);
 		}
 
 
@@ -110,17 +110,17 @@ namespace node{
 		/**
 		Compute the degree with respect to a single variable.   For differentials, the degree is 0.
 		*/
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override
 		{
 			return 0;
 		}
 
-		int Degree(VariableGroup const& vars) const override
+		int FreshDegree(VariableGroup const& vars) const override
 		{
 			return 0;
 		}
 		
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override
 		{
 			return std::vector<int>(vars.size(),0);
 		}
@@ -130,7 +130,7 @@ namespace node{
 			
 		}
 		
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 		{
 			return true;
 		}
@@ -138,7 +138,7 @@ namespace node{
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override
 		{
 			return true;
 		}
@@ -151,8 +151,7 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 		}
 
 		
@@ -220,18 +219,20 @@ namespace node{
 		void save(Archive & ar, const unsigned int version) const
 		{
 			ar & boost::serialization::base_object<NamedSymbol>(*this);
-			ar & differential_variable_;
-			// ar & const_cast<std::shared_ptr<const Variable> >(differential_variable_);
+			const std::shared_ptr<Variable> diff_variable = std::const_pointer_cast<Variable>(differential_variable_);
+			ar & diff_variable;
 		}
 		
 		template<class Archive>
 		void load(Archive & ar, const unsigned int version)
 		{
 			ar & boost::serialization::base_object<NamedSymbol>(*this);
-			ar & std::const_pointer_cast<Variable>(differential_variable_);
+			std::shared_ptr<Variable> diff_variable;
+			ar & diff_variable;
+			differential_variable_ = diff_variable;
 		}
 		
-		// BOOST_SERIALIZATION_SPLIT_MEMBER()
+		BOOST_SERIALIZATION_SPLIT_MEMBER()
 
 	};
 
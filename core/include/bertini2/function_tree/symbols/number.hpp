@@ -51,6 +51,48 @@
 namespace bertini {
 namespace node{
 
+	namespace detail{
+
+		/**
+		\brief The value of a constant, rounded to each of the last few precisions it was evaluated at.
+
+		A change of precision makes every constant of a system evaluate afresh, which means re-reading a float, dividing a rational, or computing \f$\pi\f$, over again.  Precisions come back, as adaptive precision tracking moves among a few of them, so the rounded values are kept, and returning to a precision already seen costs a copy.  The copies of a system made by System::CloneForThread share their constant nodes, so their rounded values too.  They are brought to a precision and evaluated under node::SharedConstantsMutex, which guards these as well.
+		*/
+		class RoundedConstant
+		{
+		public:
+
+			/**
+			\brief The value rounded to a precision, computed by round the first time, which sets the real and imaginary parts passed it, already at that precision.
+			*/
+			template<typename RoundFn>
+			mpfr const& At(unsigned precision, RoundFn const& round) const
+			{
+				for (auto const& iter : values_)
+					if (iter.first==precision)
+						return iter.second;
+
+				if (values_.size()==NumPrecisionsKept)
+					values_.erase(values_.begin());
+
+				mpfr_float real_part, imag_part;
+				real_part.precision(precision);
+				imag_part.precision(precision);
+				round(real_part, imag_part);
+
+				values_.emplace_back(precision, mpfr(real_part, imag_part));
+				values_.back().second.precision(precision);
+				return values_.back().second;
+			}
+
+		private:
+			static const std::size_t NumPrecisionsKept = 8; ///< Enough for the precisions adaptive tracking moves among.
+
+			mutable std::vector< std::pair<unsigned, mpfr> > values_; ///< The precisions, oldest first, and the value rounded to each.
+		};
+
+	} // re: namespace detail
+
 
 	/**
 	\brief Abstract Number type from which other Numbers derive.
@@ -82,18 +124,18 @@ namespace node{
 
 		For transcendental functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return -1.
 		*/
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override
 		{
 			return 0;
 		}
 
 
-		int Degree(VariableGroup const& vars) const override
+		int FreshDegree(VariableGroup const& vars) const override
 		{
 			return 0;
 		}
 
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override
 		{
 			return std::vector<int>(vars.size(), 0);
 		}
@@ -104,7 +146,7 @@ namespace node{
 			
 		}
 
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 		{
 			return true;
 		}
@@ -112,7 +154,7 @@ namespace node{
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override
 		{
 			return true;
 		}
@@ -125,8 +167,7 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 		}
 
 
@@ -180,12 +221,21 @@ namespace node{
 		}
 
 
+		/**
+		 Get the exact value of this integer.
+		 */
+		mpz_int const& true_value() const
+		{
+			return true_value_;
+		}
+
+
 		/**
 		 Differentiates a number.  Should this return the special number Zero?
 		 */
-		std::shared_ptr<Node> Differentiate() const override
+		std::shared_ptr<Node> FreshDifferentiate() const override
 		{
-			return std::make_shared<Integer>(0);
+			return MakeNode<Integer>(0);
 		}
 
 
@@ -206,16 +256,26 @@ namespace node{
 
 		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			return mpfr(true_value_,0);
+			return Rounded();
 		}
 		
 		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			evaluation_value = true_value_;
+			evaluation_value = Rounded();
+		}
+
+		mpfr const& Rounded() const
+		{
+			return rounded_.At(Node::precision(), [this](mpfr_float & real_part, mpfr_float & imag_part)
+			{
+				mpfr_set_z(real_part.backend().data(), true_value_.backend().data(), MPFR_RNDN);
+				imag_part = 0;
+			});
 		}
 
 
 		mpz_int true_value_;
+		detail::RoundedConstant rounded_; ///< The value at the precisions it has been evaluated at.
 
 		friend class boost::serialization::access;
 
@@ -268,12 +328,21 @@ namespace node{
 		}
 
 
+		/**
+		 Get the value of this number, in the precision in which it was made.
+		 */
+		mpfr const& highest_precision_value() const
+		{
+			return highest_precision_value_;
+		}
+
+
 		/**
 		 Differentiates a number.  Should this return the special number Zero?
 		 */
-		std::shared_ptr<Node> Differentiate() const override
+		std::shared_ptr<Node> FreshDifferentiate() const override
 		{
-			return std::make_shared<Integer>(0);
+			return MakeNode<Integer>(0);
 		}
 
 
@@ -292,16 +361,26 @@ namespace node{
 
 		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			return mpfr(highest_precision_value_);
+			return Rounded();
 		}
 		
 		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			evaluation_value = mpfr(highest_precision_value_);
+			evaluation_value = Rounded();
+		}
+
+		mpfr const& Rounded() const
+		{
+			return rounded_.At(Node::precision(), [this](mpfr_float & real_part, mpfr_float & imag_part)
+			{
+				mpfr_set(real_part.backend().data(), highest_precision_value_.real().backend().data(), MPFR_RNDN);
+				mpfr_set(imag_part.backend().data(), highest_precision_value_.imag().backend().data(), MPFR_RNDN);
+			});
 		}
 
 
 		const mpfr highest_precision_value_;
+		detail::RoundedConstant rounded_; ///< The value at the precisions it has been evaluated at.
 
 		friend class boost::serialization::access;
 		Float() = default;
@@ -372,12 +451,29 @@ namespace node{
 		}
 
 
+		/**
+		 Get the exact real part of this rational.
+		 */
+		mpq_rational const& true_value_real() const
+		{
+			return true_value_real_;
+		}
+
+		/**
+		 Get the exact imaginary part of this rational.
+		 */
+		mpq_rational const& true_value_imag() const
+		{
+			return true_value_imag_;
+		}
+
+
 		/**
 		 Differentiates a number.  
 		 */
-		std::shared_ptr<Node> Differentiate() const override
+		std::shared_ptr<Node> FreshDifferentiate() const override
 		{
-			return std::make_shared<Integer>(0);
+			return MakeNode<Integer>(0);
 		}
 
 
@@ -398,16 +494,26 @@ namespace node{
 
 		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			return mpfr(boost::multiprecision::mpfr_float(true_value_real_),boost::multiprecision::mpfr_float(true_value_imag_));
+			return Rounded();
 		}
 		
 		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			evaluation_value = mpfr(boost::multiprecision::mpfr_float(true_value_real_),boost::multiprecision::mpfr_float(true_value_imag_));
+			evaluation_value = Rounded();
+		}
+
+		mpfr const& Rounded() const
+		{
+			return rounded_.At(Node::precision(), [this](mpfr_float & real_part, mpfr_float & imag_part)
+			{
+				mpfr_set_q(real_part.backend().data(), true_value_real_.backend().data(), MPFR_RNDN);
+				mpfr_set_q(imag_part.backend().data(), true_value_imag_.backend().data(), MPFR_RNDN);
+			});
 		}
 
 
 		const mpq_rational true_value_real_, true_value_imag_;
+		detail::RoundedConstant rounded_; ///< The value at the precisions it has been evaluated at.
 		Rational() = default;
 		friend class boost::serialization::access;
 
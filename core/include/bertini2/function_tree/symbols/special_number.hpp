@@ -83,9 +83,9 @@ namespace node{
 			/**
 			 Differentiates a number.  Should this return the special number Zero?
 			 */
-			std::shared_ptr<Node> Differentiate() const override
+			std::shared_ptr<Node> FreshDifferentiate() const override
 			{
-				return std::make_shared<Integer>(0);
+				return MakeNode<Integer>(0);
 			}
 
 			/**
@@ -93,18 +93,18 @@ namespace node{
 
 			For transcendental functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return -1.
 			*/
-			int Degree(std::shared_ptr<Variable> const& v = nullptr) const override
+			int FreshDegree(std::shared_ptr<Variable> const& v) const override
 			{
 				return 0;
 			}
 
 
-			int Degree(VariableGroup const& vars) const override
+			int FreshDegree(VariableGroup const& vars) const override
 			{
 				return 0;
 			}
 
-			std::vector<int> MultiDegree(VariableGroup const& vars) const override
+			std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override
 			{
 				return std::vector<int>(vars.size(), 0);
 			}
@@ -115,7 +115,7 @@ namespace node{
 				
 			}
 
-			bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+			bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 			{
 				return true;
 			}
@@ -123,7 +123,7 @@ namespace node{
 			/**
 			Check for homogeneity, with respect to a variable group.
 			*/
-			bool IsHomogeneous(VariableGroup const& vars) const override
+			bool FreshIsHomogeneous(VariableGroup const& vars) const override
 			{
 				return true;
 			}
@@ -136,8 +136,7 @@ namespace node{
 			 */
 			virtual void precision(unsigned int prec) const override
 			{
-				auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-				val_pair.first.precision(prec);
+				current_value_.Precision(prec);
 			}
 
 
@@ -158,14 +157,25 @@ namespace node{
 
 			mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
 			{
-				return mpfr(mpfr_float(acos(mpfr_float(-1))));
+				return Rounded();
 			}
 			
 			void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 			{
-				evaluation_value = mpfr(mpfr_float(acos(mpfr_float(-1))));
+				evaluation_value = Rounded();
 			}
 
+			mpfr const& Rounded() const
+			{
+				return rounded_.At(Node::precision(), [](mpfr_float & real_part, mpfr_float & imag_part)
+				{
+					mpfr_const_pi(real_part.backend().data(), MPFR_RNDN);
+					imag_part = 0;
+				});
+			}
+
+			detail::RoundedConstant rounded_; ///< The value at the precisions it has been evaluated at.
+
 
 			friend class boost::serialization::access;
 
@@ -199,9 +209,9 @@ namespace node{
 			/**
 			 Differentiates a number.  Should this return the special number Zero?
 			 */
-			std::shared_ptr<Node> Differentiate() const override
+			std::shared_ptr<Node> FreshDifferentiate() const override
 			{
-				return std::make_shared<Integer>(0);
+				return MakeNode<Integer>(0);
 			}
 
 			/**
@@ -209,18 +219,18 @@ namespace node{
 
 			For transcendental functions, the degree is 0 if the argument is constant, otherwise it's undefined, and we return -1.
 			*/
-			int Degree(std::shared_ptr<Variable> const& v = nullptr) const override
+			int FreshDegree(std::shared_ptr<Variable> const& v) const override
 			{
 				return 0;
 			}
 
 
-			int Degree(VariableGroup const& vars) const override
+			int FreshDegree(VariableGroup const& vars) const override
 			{
 				return 0;
 			}
 
-			std::vector<int> MultiDegree(VariableGroup const& vars) const override
+			std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override
 			{
 				return std::vector<int>(vars.size(), 0);
 			}
@@ -231,7 +241,7 @@ namespace node{
 				
 			}
 
-			bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+			bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 			{
 				return true;
 			}
@@ -239,7 +249,7 @@ namespace node{
 			/**
 			Check for homogeneity, with respect to a variable group.
 			*/
-			bool IsHomogeneous(VariableGroup const& vars) const override
+			bool FreshIsHomogeneous(VariableGroup const& vars) const override
 			{
 				return true;
 			}
@@ -251,8 +261,7 @@ namespace node{
 			 */
 			virtual void precision(unsigned int prec) const override
 			{
-				auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-				val_pair.first.precision(prec);
+				current_value_.Precision(prec);
 			}
 
 		private:
@@ -270,14 +279,26 @@ namespace node{
 
 			mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
 			{
-				return mpfr(mpfr_float(exp(mpfr_float(1))));
+				return Rounded();
 			}
 			
 			void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 			{
-				evaluation_value = mpfr(mpfr_float(exp(mpfr_float(1))));
+				evaluation_value = Rounded();
 			}
 
+			mpfr const& Rounded() const
+			{
+				return rounded_.At(Node::precision(), [](mpfr_float & real_part, mpfr_float & imag_part)
+				{
+					mpfr_set_ui(real_part.backend().data(), 1, MPFR_RNDN);
+					mpfr_exp(real_part.backend().data(), real_part.backend().data(), MPFR_RNDN);
+					imag_part = 0;
+				});
+			}
+
+			detail::RoundedConstant rounded_; ///< The value at the precisions it has been evaluated at.
+
 
 			friend class boost::serialization::access;
 
@@ -80,17 +80,30 @@ namespace node{
 		template <typename T>
 		void set_current_value(T val)
 		{
-			std::get< std::pair<T,bool> >(current_value_).first = val;
-			std::get< std::pair<T,bool> >(current_value_).second = false;
+			auto& val_pair = current_value_.Get<T>();
+			val_pair.first = val;
+			val_pair.second = false;
+			++version_;
+		}
+
+
+		/**
+		\brief The number of times the value of this variable has been set.
+
+		A System compares this against the count it saw last, to notice leaves set behind its back.
+		*/
+		unsigned long long Version() const
+		{
+			return version_;
 		}
 		
 		
 		/**
 		 Differentiates a variable.  
 		 */
-		std::shared_ptr<Node> Differentiate() const override
+		std::shared_ptr<Node> FreshDifferentiate() const override
 		{
-			return std::make_shared<Differential>(shared_from_this(), name());
+			return MakeNode<Differential>(shared_from_this(), name());
 		}
 		
 		
@@ -106,7 +119,7 @@ namespace node{
 
 		If this is the variable, then the degree is 1.  Otherwise, 0.
 		*/
-		int Degree(std::shared_ptr<Variable> const& v = nullptr) const override
+		int FreshDegree(std::shared_ptr<Variable> const& v) const override
 		{
 			if (v)
 			{
@@ -121,7 +134,7 @@ namespace node{
 		}
 
 
-		int Degree(VariableGroup const& vars) const override
+		int FreshDegree(VariableGroup const& vars) const override
 		{
 			for (auto iter : vars)
 				if (this==iter.get())
@@ -130,7 +143,7 @@ namespace node{
 			return 0;
 		}
 
-		std::vector<int> MultiDegree(VariableGroup const& vars) const override
+		std::vector<int> FreshMultiDegree(VariableGroup const& vars) const override
 		{
 			std::vector<int> deg;
 			for (auto iter=vars.begin(); iter!=vars.end(); iter++)
@@ -147,7 +160,7 @@ namespace node{
 			
 		}
 
-		bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const override
+		bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const override
 		{
 			return true;
 		}
@@ -155,7 +168,7 @@ namespace node{
 		/**
 		Check for homogeneity, with respect to a variable group.
 		*/
-		bool IsHomogeneous(VariableGroup const& vars) const override
+		bool FreshIsHomogeneous(VariableGroup const& vars) const override
 		{
 			return true;
 		}
@@ -168,8 +181,7 @@ namespace node{
 		 */
 		virtual void precision(unsigned int prec) const override
 		{
-			auto& val_pair = std::get< std::pair<mpfr,bool> >(current_value_);
-			val_pair.first.precision(prec);
+			current_value_.Precision(prec);
 		}
 		
 	protected:
@@ -177,27 +189,29 @@ namespace node{
 		// Return current value of the variable.
 		dbl FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			return std::get< std::pair<dbl,bool> >(current_value_).first;
+			return current_value_.Get<dbl>().first;
 		}
 		
 		void FreshEval_d(dbl& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			evaluation_value = std::get< std::pair<dbl,bool> >(current_value_).first;
+			evaluation_value = current_value_.Get<dbl>().first;
 		}
 
 		
 		mpfr FreshEval_mp(std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			return std::get< std::pair<mpfr,bool> >(current_value_).first;
+			return current_value_.Get<mpfr>().first;
 		}
 		
 		void FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const override
 		{
-			evaluation_value = std::get< std::pair<mpfr,bool> >(current_value_).first;
+			evaluation_value = current_value_.Get<mpfr>().first;
 		}
 
 		Variable() = default;
 	private:
+
+		unsigned long long version_ = 0; ///< Counts the calls to set_current_value.  Not serialized.
 		
 		friend class boost::serialization::access;
 
@@ -0,0 +1,295 @@
+//This file is part of Bertini 2.
+//
+//taylor_series.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//taylor_series.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with taylor_series.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file taylor_series.hpp
+
+\brief Arithmetic on truncated Taylor series, for evaluating a StraightLineProgram along a curve.
+
+A series is the order+1 coefficients of \f$s^0, \ldots, s^{order}\f$, contiguous.  Each operation computes the coefficients of its result from those of its arguments, through the same order, by the recurrences of automatic differentiation in Taylor mode, see Griewank and Walther, Evaluating Derivatives, chapter 13.  The result may not share storage with an argument, which the registers of a StraightLineProgram never do.
+
+The elementary functions are found from the differential equations they satisfy: \f$c = e^a\f$ from \f$c' = a'c\f$, and so on, each coefficient a sum over those before it.  All take \f$O(order^2)\f$ operations.
+*/
+
+#ifndef BERTINI_FUNCTION_TREE_TAYLOR_SERIES_HPP
+#define BERTINI_FUNCTION_TREE_TAYLOR_SERIES_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace bertini {
+
+	namespace taylor {
+
+	template<typename T>
+	void Add(T * c, T const* a, T const* b, std::size_t order)
+	{
+		for (std::size_t k = 0; k <= order; ++k)
+			c[k] = a[k] + b[k];
+	}
+
+	template<typename T>
+	void Subtract(T * c, T const* a, T const* b, std::size_t order)
+	{
+		for (std::size_t k = 0; k <= order; ++k)
+			c[k] = a[k] - b[k];
+	}
+
+	template<typename T>
+	void Negate(T * c, T const* a, std::size_t order)
+	{
+		for (std::size_t k = 0; k <= order; ++k)
+			c[k] = -a[k];
+	}
+
+	/**
+	\brief The series with constant term value, and no others.
+	*/
+	template<typename T>
+	void Constant(T * c, T const& value, std::size_t order)
+	{
+		c[0] = value;
+		for (std::size_t k = 1; k <= order; ++k)
+			c[k] = T(0);
+	}
+
+	/**
+	\brief c = ab, the Cauchy product.
+	*/
+	template<typename T>
+	void Multiply(T * c, T const* a, T const* b, std::size_t order)
+	{
+		for (std::size_t k = 0; k <= order; ++k)
+		{
+			c[k] = a[0]*b[k];
+			for (std::size_t j = 1; j <= k; ++j)
+				c[k] += a[j]*b[k-j];
+		}
+	}
+
+	/**
+	\brief c = a/b, from cb = a.
+	*/
+	template<typename T>
+	void Divide(T * c, T const* a, T const* b, std::size_t order)
+	{
+		for (std::size_t k = 0; k <= order; ++k)
+		{
+			c[k] = a[k];
+			for (std::size_t j = 1; j <= k; ++j)
+				c[k] -= b[j]*c[k-j];
+			c[k] /= b[0];
+		}
+	}
+
+	/**
+	\brief c = sqrt(a), from cc = a.
+	*/
+	template<typename T>
+	void Sqrt(T * c, T const* a, std::size_t order)
+	{
+		using std::sqrt;
+		c[0] = sqrt(a[0]);
+		const T two_c0 = T(2)*c[0];
+		for (std::size_t k = 1; k <= order; ++k)
+		{
+			c[k] = a[k];
+			for (std::size_t j = 1; j < k; ++j)
+				c[k] -= c[j]*c[k-j];
+			c[k] /= two_c0;
+		}
+	}
+
+	/**
+	\brief c = exp(a), from c' = a'c.
+	*/
+	template<typename T>
+	void Exp(T * c, T const* a, std::size_t order)
+	{
+		using std::exp;
+		c[0] = exp(a[0]);
+		for (std::size_t k = 1; k <= order; ++k)
+		{
+			c[k] = a[1]*c[k-1];
+			for (std::size_t j = 2; j <= k; ++j)
+				c[k] += T(int(j))*a[j]*c[k-j];
+			c[k] /= T(int(k));
+		}
+	}
+
+	/**
+	\brief c = log(a), from ac' = a'.
+	*/
+	template<typename T>
+	void Log(T * c, T const* a, std::size_t order)
+	{
+		using std::log;
+		c[0] = log(a[0]);
+		for (std::size_t k = 1; k <= order; ++k)
+		{
+			T sum(0);
+			for (std::size_t j = 1; j < k; ++j)
+				sum += T(int(j))*c[j]*a[k-j];
+			c[k] = (a[k] - sum/T(int(k))) / a[0];
+		}
+	}
+
+	/**
+	\brief c = a^p for a constant exponent p, from ac' = pa'c.
+	*/
+	template<typename T>
+	void Power(T * c, T const* a, T const& p, std::size_t order)
+	{
+		using std::pow;
+		c[0] = pow(a[0], p);
+		for (std::size_t k = 1; k <= order; ++k)
+		{
+			c[k] = T(0);
+			for (std::size_t j = 1; j <= k; ++j)
+				c[k] += (p*T(int(j)) - T(int(k-j)))*a[j]*c[k-j];
+			c[k] /= T(int(k))*a[0];
+		}
+	}
+
+	/**
+	\brief s = sin(a) and c = cos(a) together, from s' = a'c and c' = -a's.
+	*/
+	template<typename T>
+	void SinCos(T * s, T * c, T const* a, std::size_t order)
+	{
+		using std::sin;
+		using std::cos;
+		s[0] = sin(a[0]);
+		c[0] = cos(a[0]);
+		for (std::size_t k = 1; k <= order; ++k)
+		{
+			s[k] = T(0);
+			c[k] = T(0);
+			for (std::size_t j = 1; j <= k; ++j)
+			{
+				const T ja = T(int(j))*a[j];
+				s[k] += ja*c[k-j];
+				c[k] -= ja*s[k-j];
+			}
+			s[k] /= T(int(k));
+			c[k] /= T(int(k));
+		}
+	}
+
+	/**
+	\brief c = tan(a), from c' = a'(1+c^2), with the series of \f$1+c^2\f$ in u, of length order+1, found as c is.
+	*/
+	template<typename T>
+	void Tan(T * c, T const* a, std::size_t order, T * u)
+	{
+		using std::tan;
+		c[0] = tan(a[0]);
+		u[0] = T(1) + c[0]*c[0];
+		for (std::size_t k = 1; k <= order; ++k)
+		{
+			c[k] = T(0);
+			for (std::size_t j = 1; j <= k; ++j)
+				c[k] += T(int(j))*a[j]*u[k-j];
+			c[k] /= T(int(k));
+
+			u[k] = T(0);
+			for (std::size_t j = 0; j <= k; ++j)
+				u[k] += c[j]*c[k-j];
+		}
+	}
+
+	/**
+	\brief The coefficients after the first of y, from \f$y'w = \pm a'\f$, for the inverse trigonometric functions.
+	*/
+	template<typename T>
+	void IntegrateQuotient(T * y, T const* a, T const* w, bool negative, std::size_t order)
+	{
+		for (std::size_t k = 1; k <= order; ++k)
+		{
+			y[k] = negative ? -T(int(k))*a[k] : T(int(k))*a[k];
+			for (std::size_t j = 1; j < k; ++j)
+				y[k] -= T(int(j))*y[j]*w[k-j];
+			y[k] /= T(int(k))*w[0];
+		}
+	}
+
+	/**
+	\brief c = asin(a) or acos(a), from \f$c'\sqrt{1-a^2} = \pm a'\f$, with scratch space for two series.
+	*/
+	template<typename T>
+	void ArcSinCos(T * c, T const* a, bool cosine, std::size_t order, std::vector<T> & scratch)
+	{
+		using std::asin;
+		using std::acos;
+		scratch.resize(2*(order+1));
+		T * q = scratch.data();
+		T * w = q + order + 1;
+
+		Multiply(q, a, a, order);
+		for (std::size_t k = 0; k <= order; ++k)
+			q[k] = -q[k];
+		q[0] += T(1);
+		Sqrt(w, q, order);
+
+		c[0] = cosine ? acos(a[0]) : asin(a[0]);
+		IntegrateQuotient(c, a, w, cosine, order);
+	}
+
+	/**
+	\brief c = atan(a), from \f$c'(1+a^2) = a'\f$, with scratch space for a series.
+	*/
+	template<typename T>
+	void ArcTan(T * c, T const* a, std::size_t order, std::vector<T> & scratch)
+	{
+		using std::atan;
+		scratch.resize(order+1);
+		T * w = scratch.data();
+
+		Multiply(w, a, a, order);
+		w[0] += T(1);
+
+		c[0] = atan(a[0]);
+		IntegrateQuotient(c, a, w, false, order);
+	}
+
+	/**
+	\brief c = a^b for an exponent which is itself a series, as exp(b log(a)), with scratch space for two series.
+	*/
+	template<typename T>
+	void GeneralPower(T * c, T const* a, T const* b, std::size_t order, std::vector<T> & scratch)
+	{
+		scratch.resize(2*(order+1));
+		T * l = scratch.data();
+		T * m = l + order + 1;
+
+		Log(l, a, order);
+		Multiply(m, b, l, order);
+		Exp(c, m, order);
+	}
+
+	} // namespace taylor
+
+} // namespace bertini
+
+#endif
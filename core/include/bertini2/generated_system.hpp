@@ -0,0 +1,78 @@
+//This file is part of Bertini 2.
+//
+//generated_system.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//generated_system.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with generated_system.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file generated_system.hpp
+
+\brief A System evaluated through kernels generated for it ahead of time, by b2-codegen, see code_generation.hpp.
+*/
+
+#ifndef BERTINI_GENERATED_SYSTEM_HPP
+#define BERTINI_GENERATED_SYSTEM_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bertini2/system.hpp"
+#include "bertini2/system_parsing.hpp"
+#include "bertini2/detail/generated_kernels.hpp"
+
+
+namespace bertini {
+
+	/**
+	\brief A System parsed from the input embedded in a struct of generated kernels, and evaluated through them.
+
+	The trees are kept, for the structure of the system and for whatever the kernels do not compute, such as the batch evaluations, but the functions, Jacobian and time derivatives in double and multiple precision come from the kernels, see System::UseGeneratedKernels.  It is homogenized if the system the kernels were generated from was, and is patched and tracked as any other system.  Copies, as those made for threads, run the same kernels.  Changing the functions or variables further goes back to evaluating as for any other system, which is correct, but gives up the kernels.
+
+	\tparam Generated The struct written by codegen::GenerateHeader.
+	*/
+	template<typename Generated>
+	class GeneratedSystem : public System
+	{
+	public:
+
+		/**
+		\throws std::runtime_error if the embedded input does not parse.
+		*/
+		GeneratedSystem()
+		{
+			const std::string input = Generated::Input();
+			auto iter = input.begin();
+			SystemParser<std::string::const_iterator> parser;
+			System& parsed = *this;
+			if (!phrase_parse(iter, input.end(), parser, boost::spirit::ascii::space, parsed) || iter!=input.end())
+				throw std::runtime_error("unable to parse the input embedded in generated kernels");
+
+			if (Generated::homogenized)
+				Homogenize();
+
+			UseGeneratedKernels(detail::MakeGeneratedKernels<Generated>());
+		}
+	};
+
+} // namespace bertini
+
+#endif
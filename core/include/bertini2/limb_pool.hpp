@@ -0,0 +1,102 @@
+//This file is part of Bertini 2.
+//
+//limb_pool.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//limb_pool.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with limb_pool.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file limb_pool.hpp
+
+\brief An opt-in, thread-local pooled allocator for the limbs of GMP and MPFR numbers.
+
+Multiple precision temporaries, in bertini::complex arithmetic, Eigen expressions, and function evaluation, each allocate their limbs from the heap, and at high precision the trips to malloc and free are a large part of the running time.  Installing the limb pool routes GMP's allocation, through mp_set_memory_functions, to per-thread free lists of recently freed blocks, keyed by their exact size.  Threads never contend for the lists, and nothing else about the numbers changes.
+
+Blocks the pool cannot serve come from the memory functions in place when it was installed, GMP's own or those of libbertini2_allocation_counting, which count them, and blocks it does not keep go back to them.  Those are plain malloc blocks, so memory allocated before the pool was installed may be freed into it, and memory allocated from it may be freed after it is uninstalled.  Each request for a block of a size the pool keeps counts as a hit or a miss of the calling thread's tracking::instrument::ThreadAllocations.
+*/
+
+#ifndef BERTINI_LIMB_POOL_HPP
+#define BERTINI_LIMB_POOL_HPP
+
+#include <cstddef>
+
+namespace bertini {
+namespace limb_pool {
+
+	/**
+	\brief Counts of the calls to the pool's allocation functions, on one thread.
+	*/
+	struct Statistics
+	{
+		std::size_t allocations = 0; ///< blocks requested, including by reallocation
+		std::size_t hits = 0; ///< blocks served from the free lists, rather than by the memory functions the pool was installed over
+		std::size_t frees = 0; ///< blocks returned, including by reallocation
+		std::size_t reallocations = 0; ///< calls to reallocate
+
+		/**
+		\brief The fraction of allocations served from the free lists.
+		*/
+		double HitRate() const
+		{
+			return allocations ? double(hits)/double(allocations) : 0;
+		}
+	};
+
+
+	/**
+	\brief Route GMP's, and so MPFR's, memory functions through the pool.
+
+	mp_set_memory_functions is process-wide, so call this at start-up, before other threads use multiple precision.  Calling it when installed does nothing.
+	*/
+	void Install();
+
+	/**
+	\brief Restore the memory functions in use before Install, and release the calling thread's cached blocks.
+
+	As with Install, no other thread may be using multiple precision.  Blocks cached by other threads are released when they exit.
+	*/
+	void Uninstall();
+
+	/**
+	\brief Whether the pool is installed.
+	*/
+	bool IsInstalled();
+
+	/**
+	\brief Free every block cached by the calling thread, returning the memory to the system.
+
+	Trackers call this at the end of each path, so that a thread's cache holds only what the path in progress needs.
+	*/
+	void ReleaseThreadCache();
+
+	/**
+	\brief The allocation counts of the calling thread, since it began or since ResetThreadStatistics.
+	*/
+	Statistics ThreadStatistics();
+
+	/**
+	\brief Zero the allocation counts of the calling thread.
+	*/
+	void ResetThreadStatistics();
+
+} // namespace limb_pool
+} // namespace bertini
+
+#endif
@@ -26,6 +26,10 @@
 \file logging.hpp 
 
 \brief Logging in Bertini using Boost.Log
+
+Statements made with BERTINI_LOG_TRIVIAL or BERTINI_LOG_DEFERRED below the severity BERTINI_MIN_LOG_SEVERITY are removed by the compiler.  Define it, as in CPPFLAGS=-DBERTINI_MIN_LOG_SEVERITY=2, to compile out trace and debug logging entirely.
+
+Deferred statements take a function which writes the message, rather than the message.  When asynchronous logging is running, the function, with whatever it captured by value, goes into a ring buffer belonging to the logging thread, and a background thread calls it and passes the text to Boost.Log, so the tracking thread never formats a number.  Otherwise the function is called at once.
 */
 
 
@@ -44,6 +48,41 @@
 #include <boost/log/sources/severity_logger.hpp>
 #include <boost/log/sources/record_ostream.hpp>
 
+#include <atomic>
+#include <functional>
+#include <ostream>
+
+
+/**
+\brief The least severity of logging compiled in, as the integer value of a boost::log::trivial::severity_level, from 0 for trace to 5 for fatal.
+*/
+#ifndef BERTINI_MIN_LOG_SEVERITY
+	#define BERTINI_MIN_LOG_SEVERITY 0
+#endif
+
+/**
+\brief Whether logging at a severity is compiled in.  The level is as for BOOST_LOG_TRIVIAL, such as `trace` or `severity_level::trace`.
+*/
+#define BERTINI_LOG_COMPILED(level) (static_cast<int>(::boost::log::trivial::level) >= BERTINI_MIN_LOG_SEVERITY)
+
+/**
+\brief BOOST_LOG_TRIVIAL, removed when the severity is below BERTINI_MIN_LOG_SEVERITY.
+*/
+#define BERTINI_LOG_TRIVIAL(level) \
+	if (!BERTINI_LOG_COMPILED(level)) {} else BOOST_LOG_TRIVIAL(level)
+
+/**
+\brief Log the text a function writes to a std::ostream, on the background thread when asynchronous logging is running.
+
+Neither the function nor anything it captures is made when the severity is compiled out, or is below the level set by LoggingInit.  Capture by value what is to be written, as it is written later.
+
+\code
+BERTINI_LOG_DEFERRED(severity_level::trace, [point = t.CurrentPoint()](std::ostream& out){ out << "current x = " << point; });
+\endcode
+*/
+#define BERTINI_LOG_DEFERRED(level, ...) \
+	if (!BERTINI_LOG_COMPILED(level) || !::bertini::LogWanted(::boost::log::trivial::level)) {} else ::bertini::LogDeferred(::boost::log::trivial::level, __VA_ARGS__)
+
 namespace bertini
 {
 
@@ -65,14 +104,74 @@ namespace bertini
 	}
 
 
+	namespace detail {
+		/**
+		\brief The least severity wanted at run time, as set by LoggingInit.
+		*/
+		inline
+		std::atomic<int>& LogThreshold()
+		{
+			static std::atomic<int> threshold(0);
+			return threshold;
+		}
+	}
+
+	/**
+	\brief Whether messages of a severity pass the filter set by LoggingInit.
+	*/
+	inline
+	bool LogWanted(logging::trivial::severity_level level)
+	{
+		return static_cast<int>(level) >= detail::LogThreshold().load(std::memory_order_relaxed);
+	}
+
+	/**
+	\brief Log the text written by a function, on the background thread if asynchronous logging is running, or now if not.  Use through BERTINI_LOG_DEFERRED.
+	*/
+	void LogDeferred(logging::trivial::severity_level level, std::function<void(std::ostream&)> write);
+
+
+	/**
+	\brief Control of the background thread for deferred logging.
+
+	Each thread which logs gets its own ring buffer on its first deferred statement, which only it writes and only the background thread reads, so that logging takes no lock.  When a ring is full, its messages are dropped, and counted, rather than stall tracking.
+
+	Needs thread_local storage.  If configured with --disable-thread_local, Start does nothing, and deferred statements are formatted at once.
+	*/
+	struct AsyncLogging
+	{
+		/**
+		\brief Start the background thread.  Does nothing if it is running.
+
+		\param ring_capacity The number of messages each thread's ring holds.
+		*/
+		static void Start(std::size_t ring_capacity = 4096);
+
+		/**
+		\brief Write out every message in the rings, and stop the background thread.  Call after the threads which log have stopped logging.
+		*/
+		static void Stop();
+
+		static bool Running();
+
+		/**
+		\brief The number of messages dropped because a ring was full, since the last Start.
+		*/
+		static std::size_t NumDropped();
+	};
+
+
+
 	struct LoggingInit
 	{
 		
 		// trivial logger-provided severity levels are  
 		//
 		//  trace, debug, info, warning, error, fatal
-		LoggingInit(logging::trivial::severity_level desired_level = logging::trivial::severity_level::trace, unsigned desired_rotation_size = 10*1024*1024)
+		LoggingInit(logging::trivial::severity_level desired_level = logging::trivial::severity_level::trace, unsigned desired_rotation_size = 10*1024*1024, bool asynchronous = false)
 		{
+			detail::LogThreshold() = static_cast<int>(desired_level);
+
 			logging::add_file_log
 			(
 			    keywords::file_name = "bertini_%N.log",
@@ -87,9 +186,14 @@ namespace bertini
 
 			BOOST_LOG_TRIVIAL(trace) << "initialized logging";
 
+			if (asynchronous)
+				AsyncLogging::Start();
 		}
 
-		~LoggingInit(){}
+		~LoggingInit()
+		{
+			AsyncLogging::Stop();
+		}
 	    
 	};
 
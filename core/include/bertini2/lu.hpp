@@ -0,0 +1,1536 @@
+//This file is part of Bertini 2.
+//
+//lu.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//lu.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with lu.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file lu.hpp
+
+\brief A reusable LU factorization with partial pivoting, for the linear solves of the trackers.
+
+Eigen's PartialPivLU, on a multiple precision scalar, makes temporaries inside its blocked kernels, and factoring again into an existing decomposition allocates.  PartialPivotLU keeps its factors and all the workspace for solving as members, sized once when the tracker is set up, and works on them in place.  The elimination and substitution updates are fused multiply-subtracts, so at a steady size and precision factoring and solving allocate nothing.
+
+For doubles, PartialPivotLU forwards to Eigen's vectorized decomposition, so that code templated on the number type uses one interface for both, except for square matrices of size at most 8, which go to kernels with their size fixed at compile time.
+*/
+
+#ifndef BERTINI_LU_HPP
+#define BERTINI_LU_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+#include "bertini2/complex_kernels.hpp"
+#include "bertini2/detail/thread_team.hpp"
+
+#include <Eigen/LU>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace bertini {
+
+	/**
+	\brief Deduct a product from a number, result -= a*b.
+
+	The double precision counterpart of the multiple precision kernel in mpfr_complex.hpp.
+	*/
+	inline void MultiplySubtract(dbl & result, const dbl & a, const dbl & b)
+	{
+		result -= a*b;
+	}
+
+	/**
+	\brief Negate a number in place.
+	*/
+	inline void Negate(dbl & z)
+	{
+		z = -z;
+	}
+
+	namespace detail {
+
+		/**
+		\brief The magnitude used to choose pivots, |re|+|im|, as in LAPACK.
+
+		For multiple precision, it is computed into out without temporaries, at the precision of out.
+		*/
+		inline void PivotMagnitude(mpfr_float & out, const complex & z)
+		{
+			mpfr_abs(out.backend().data(), z.real().backend().data(), MPFR_RNDN);
+			if (mpfr_sgn(z.imag().backend().data()) >= 0)
+				mpfr_add(out.backend().data(), out.backend().data(), z.imag().backend().data(), MPFR_RNDN);
+			else
+				mpfr_sub(out.backend().data(), out.backend().data(), z.imag().backend().data(), MPFR_RNDN);
+		}
+
+		template<typename RealType, typename NumType>
+		void PivotMagnitude(RealType & out, const NumType & z)
+		{
+			using std::abs;
+			out = abs(real(z)) + abs(imag(z));
+		}
+
+		inline bool IsZero(const mpfr_float & x)
+		{
+			return mpfr_zero_p(x.backend().data());
+		}
+
+		template<typename RealType>
+		bool IsZero(const RealType & x)
+		{
+			return x==0;
+		}
+
+		/**
+		\brief The smallest matrix factored on a team of threads, when one is given.  Below this, the barriers between panels cost more than the threads save.
+		*/
+		constexpr Eigen::DenseIndex MinBlockedLUSize = 64;
+
+		/**
+		\brief The number of columns of a panel of the factorization on a team of threads, after each of which the trailing columns are updated in parallel.
+		*/
+		constexpr Eigen::DenseIndex BlockedLUPanelWidth = 32;
+
+		/**
+		\brief The smallest matrix factored by the sparse direct method, when its pattern is given.  Below this, the dense factorization is as fast, however sparse the matrix.
+		*/
+		constexpr Eigen::DenseIndex MinSparseLUSize = 200;
+
+		/**
+		\brief The largest fraction of the entries of a matrix which may be nonzero, for it to be factored by the sparse direct method.  Above this, the factors fill in to nearly dense anyway.
+		*/
+		constexpr double MaxSparseLUDensity = 0.1;
+
+		/**
+		\brief Whether factoring an n x n matrix with this many entries which may be nonzero pays by the sparse direct method, rather than densely.
+		*/
+		inline bool SparseLUPays(Eigen::DenseIndex n, std::size_t num_nonzeros)
+		{
+			return n >= MinSparseLUSize && num_nonzeros <= MaxSparseLUDensity*n*n;
+		}
+
+
+		/**
+		\brief The sparse direct factorization used by PartialPivotLU for matrices of a fixed pattern, Eigen's supernodal SparseLU with a COLAMD ordering.
+
+		The pattern is analyzed, and its columns ordered to limit fill, once, by UsePattern.  Each Factor then only gathers the entries of a dense matrix at the pattern into the values of the sparse one, and factors it numerically.  The pivots, the diagonal of U in the order of elimination, are kept for LUPivotsSuccessful.
+
+		Eigen's factorization can't be copied, so a copy analyzes the pattern again.
+		*/
+		template<typename NumType>
+		class SparseLUFactors
+		{
+			using Factorization = Eigen::SparseLU< SparseMat<NumType>, Eigen::COLAMDOrdering<int> >;
+
+		public:
+
+			SparseLUFactors() = default;
+
+			SparseLUFactors(SparseLUFactors const& other) : pattern_(other.pattern_), positions_(other.positions_)
+			{
+				if (other.Active())
+					Analyze();
+			}
+
+			SparseLUFactors& operator=(SparseLUFactors const& other)
+			{
+				pattern_ = other.pattern_;
+				positions_ = other.positions_;
+				lu_.reset();
+				factored_ = false;
+				if (other.Active())
+					Analyze();
+				return *this;
+			}
+
+			/**
+			\brief Analyze the pattern of the square matrices to be factored, if the sparse factorization pays for them, else stop using it.
+
+			\param structure For each row, the columns of its entries which may be nonzero.
+			\return Whether the matrices will be factored sparsely.
+			*/
+			bool UsePattern(std::vector< std::vector<unsigned> > const& structure)
+			{
+				lu_.reset();
+				factored_ = false;
+
+				const auto n = static_cast<Eigen::DenseIndex>(structure.size());
+				std::size_t num_nonzeros = 0;
+				for (auto const& row : structure)
+					num_nonzeros += row.size();
+
+				if (!SparseLUPays(n, num_nonzeros))
+				{
+					pattern_.resize(0,0);
+					positions_.clear();
+					return false;
+				}
+
+				std::vector< Eigen::Triplet<NumType> > entries;
+				entries.reserve(num_nonzeros);
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					for (auto jj : structure[ii])
+						entries.push_back(Eigen::Triplet<NumType>(ii, jj, NumType(0)));
+
+				pattern_.resize(n,n);
+				pattern_.setFromTriplets(entries.begin(), entries.end());
+				pattern_.makeCompressed();
+
+				positions_.clear();
+				positions_.reserve(pattern_.nonZeros());
+				for (Eigen::DenseIndex jj = 0; jj < pattern_.outerSize(); ++jj)
+					for (typename SparseMat<NumType>::InnerIterator iter(pattern_, jj); iter; ++iter)
+						positions_.push_back(std::make_pair(iter.row(), iter.col()));
+
+				Analyze();
+				return true;
+			}
+
+			/**
+			\brief Whether a pattern is in use.
+			*/
+			bool Active() const
+			{
+				return static_cast<bool>(lu_);
+			}
+
+			/**
+			\brief Factor a dense matrix whose entries outside the pattern are zero.
+			*/
+			template<typename Derived>
+			void Factor(Eigen::MatrixBase<Derived> const& A)
+			{
+				auto values = pattern_.valuePtr();
+				for (std::size_t kk = 0; kk < positions_.size(); ++kk)
+					values[kk] = A(positions_[kk].first, positions_[kk].second);
+
+				lu_->factorize(pattern_);
+				factored_ = lu_->info()==Eigen::Success;
+				if (!factored_)
+					return;
+
+				// the diagonal blocks of U are kept in the supernodes of L
+				const auto n = pattern_.rows();
+				pivots_.resize(n);
+				auto const& L = lu_->matrixL().m_mapL;
+				for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+					for (typename Factorization::SCMatrix::InnerIterator iter(L, jj); iter; ++iter)
+						if (iter.index()==jj)
+						{
+							pivots_(jj) = iter.value();
+							break;
+						}
+			}
+
+			/**
+			\brief Check the pivots of the last factorization, as LUPartialPivotDecompositionSuccessful does the diagonal of dense factors.  An exactly zero pivot is a small value.
+			*/
+			MatrixSuccessCode Success() const
+			{
+				if (!factored_)
+					return MatrixSuccessCode::SmallValue;
+				return LUPivotsSuccessful(pivots_);
+			}
+
+			Eigen::DenseIndex Size() const
+			{
+				return pattern_.rows();
+			}
+
+			template<typename DerivedX, typename DerivedB>
+			void Solve(Eigen::MatrixBase<DerivedX> & x, Eigen::MatrixBase<DerivedB> const& b) const
+			{
+				x = lu_->solve(b);
+			}
+
+			template<typename DerivedX, typename DerivedB>
+			void SolveAdjoint(Eigen::MatrixBase<DerivedX> & x, Eigen::MatrixBase<DerivedB> const& b) const
+			{
+				x = lu_->adjoint().solve(b);
+			}
+
+		private:
+
+			void Analyze()
+			{
+				lu_.reset(new Factorization);
+				lu_->analyzePattern(pattern_);
+			}
+
+			SparseMat<NumType> pattern_; ///< The pattern, holding the values of the matrix being factored.
+			std::vector< std::pair<Eigen::DenseIndex, Eigen::DenseIndex> > positions_; ///< The row and column of each stored value of pattern_, in storage order.
+			std::unique_ptr<Factorization> lu_; ///< The factorization, analyzed for pattern_, or null if no pattern is in use.
+			bool factored_ = false; ///< Whether the last factorization met no zero pivot.
+			Vec<NumType> pivots_;
+		};
+
+		/**
+		\brief The smallest matrix factored in a band, when its pattern is given.  Below this, the dense factorization is as fast, however narrow the band.
+		*/
+		constexpr Eigen::DenseIndex MinBandedLUSize = 32;
+
+		/**
+		\brief The largest width of the band of the factors, 2kl+ku+1 for kl subdiagonals and ku superdiagonals, as a fraction of the size of the matrix, for it to be factored in the band.
+		*/
+		constexpr double MaxBandedLUWidth = 0.25;
+
+		/**
+		\brief Whether factoring an n x n matrix with kl subdiagonals and ku superdiagonals pays in the band, rather than densely.  Partial pivoting widens the upper band of the factors to kl+ku.
+		*/
+		inline bool BandedLUPays(Eigen::DenseIndex n, Eigen::DenseIndex kl, Eigen::DenseIndex ku)
+		{
+			return n >= MinBandedLUSize && 2*kl+ku+1 <= MaxBandedLUWidth*n;
+		}
+
+		/**
+		\brief The reverse Cuthill-McKee ordering of the symmetrized pattern of a square matrix, which narrows its band.
+
+		Each connected part is numbered breadth first from a vertex of least degree, the neighbours of each vertex in increasing order of degree, and the whole numbering reversed.
+
+		\param structure For each row, the columns of its entries which may be nonzero.
+		\return The original index of each row and column, in the new order.
+		*/
+		inline std::vector<unsigned> ReverseCuthillMcKee(std::vector< std::vector<unsigned> > const& structure)
+		{
+			const auto n = static_cast<unsigned>(structure.size());
+			std::vector< std::vector<unsigned> > adjacent(n);
+			for (unsigned ii = 0; ii < n; ++ii)
+				for (auto jj : structure[ii])
+					if (jj!=ii)
+					{
+						adjacent[ii].push_back(jj);
+						adjacent[jj].push_back(ii);
+					}
+			for (auto& a : adjacent)
+			{
+				std::sort(a.begin(), a.end());
+				a.erase(std::unique(a.begin(), a.end()), a.end());
+			}
+
+			auto by_degree = [&adjacent](unsigned a, unsigned b){ return adjacent[a].size() < adjacent[b].size() || (adjacent[a].size()==adjacent[b].size() && a < b); };
+
+			std::vector<unsigned> vertices(n);
+			for (unsigned ii = 0; ii < n; ++ii)
+				vertices[ii] = ii;
+			std::sort(vertices.begin(), vertices.end(), by_degree);
+
+			std::vector<unsigned> order;
+			order.reserve(n);
+			std::vector<char> numbered(n, 0);
+			for (auto start : vertices)
+			{
+				if (numbered[start])
+					continue;
+				numbered[start] = 1;
+				order.push_back(start);
+				for (auto head = order.size()-1; head < order.size(); ++head)
+				{
+					const auto first = order.size();
+					for (auto jj : adjacent[order[head]])
+						if (!numbered[jj])
+						{
+							numbered[jj] = 1;
+							order.push_back(jj);
+						}
+					std::sort(order.begin()+first, order.end(), by_degree);
+				}
+			}
+
+			std::reverse(order.begin(), order.end());
+			return order;
+		}
+
+		/**
+		\brief The numbers of subdiagonals and superdiagonals of a pattern with its rows and columns in an order.
+
+		\param structure For each row, the columns of its entries which may be nonzero.
+		\param order The original index of each row and column, in the new order.
+		*/
+		inline std::pair<Eigen::DenseIndex, Eigen::DenseIndex> Bandwidths(std::vector< std::vector<unsigned> > const& structure, std::vector<unsigned> const& order)
+		{
+			std::vector<Eigen::DenseIndex> position(order.size());
+			for (std::size_t ii = 0; ii < order.size(); ++ii)
+				position[order[ii]] = ii;
+
+			Eigen::DenseIndex kl = 0, ku = 0;
+			for (std::size_t ii = 0; ii < structure.size(); ++ii)
+				for (auto jj : structure[ii])
+				{
+					kl = std::max(kl, position[ii] - position[jj]);
+					ku = std::max(ku, position[jj] - position[ii]);
+				}
+			return std::make_pair(kl, ku);
+		}
+
+		/**
+		\brief Whether a pattern is worth factoring by its structure, sparsely or in a band, see SparseLUPays and BandedLUPays.
+		*/
+		inline bool StructuredLUPays(std::vector< std::vector<unsigned> > const& structure)
+		{
+			const auto n = static_cast<Eigen::DenseIndex>(structure.size());
+			std::size_t num_nonzeros = 0;
+			for (auto const& row : structure)
+				num_nonzeros += row.size();
+			if (SparseLUPays(n, num_nonzeros))
+				return true;
+			if (n < MinBandedLUSize)
+				return false;
+			const auto widths = Bandwidths(structure, ReverseCuthillMcKee(structure));
+			return BandedLUPays(n, widths.first, widths.second);
+		}
+
+
+		/**
+		\brief The banded factorization used by PartialPivotLU for matrices of a fixed pattern too small or too dense for SparseLUFactors, whose band is narrow once ordered.
+
+		UsePattern orders the rows and columns alike, by ReverseCuthillMcKee, once.  Factor gathers the matrix in that order into band storage as LAPACK's, column jj holding rows jj-kl-ku through jj+kl, and eliminates with partial pivoting within the band, in O(n kl (kl+ku)).  The row exchanges are kept as LAPACK's, so they are applied to the right hand side as it is eliminated.  The ordering is internal: the matrices are passed, and the solutions returned, in the original order.
+		*/
+		template<typename NumType>
+		class BandedLUFactors
+		{
+			using RealType = typename Eigen::NumTraits<NumType>::Real;
+
+		public:
+
+			/**
+			\brief Order the pattern of the square matrices to be factored, if the banded factorization pays for them, else stop using it.
+
+			\param structure For each row, the columns of its entries which may be nonzero.
+			\return Whether the matrices will be factored in a band.
+			*/
+			bool UsePattern(std::vector< std::vector<unsigned> > const& structure)
+			{
+				const auto n = static_cast<Eigen::DenseIndex>(structure.size());
+				order_.clear();
+				if (n < MinBandedLUSize)
+					return false;
+
+				auto order = ReverseCuthillMcKee(structure);
+				const auto widths = Bandwidths(structure, order);
+				if (!BandedLUPays(n, widths.first, widths.second))
+					return false;
+
+				order_ = std::move(order);
+				kl_ = widths.first;
+				ku_ = widths.second;
+				band_.resize(2*kl_+ku_+1, n);
+				pivot_rows_.resize(n);
+				pivots_.resize(n);
+				pivot_inverses_.resize(n);
+				work_.resize(n);
+				return true;
+			}
+
+			/**
+			\brief Whether a pattern is in use.
+			*/
+			bool Active() const
+			{
+				return !order_.empty();
+			}
+
+			void ChangePrecision(unsigned prec)
+			{
+				using bertini::Precision;
+				Precision(band_, prec);
+				Precision(pivots_, prec);
+				Precision(pivot_inverses_, prec);
+				Precision(work_, prec);
+				Precision(one_, prec);
+				best_.precision(prec);
+				candidate_.precision(prec);
+			}
+
+			/**
+			\brief Factor a dense matrix whose entries outside the pattern are zero.
+			*/
+			template<typename Derived>
+			void Factor(Eigen::MatrixBase<Derived> const& A)
+			{
+				const auto n = Size();
+				band_.setZero();
+				for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+					for (Eigen::DenseIndex ii = std::max<Eigen::DenseIndex>(0, jj-ku_); ii <= std::min(n-1, jj+kl_); ++ii)
+						At(ii,jj) = A(order_[ii], order_[jj]);
+
+				for (Eigen::DenseIndex kk = 0; kk < n; ++kk)
+				{
+					const auto last_row = std::min(n-1, kk+kl_);
+					const auto last_col = std::min(n-1, kk+kl_+ku_);
+
+					Eigen::DenseIndex pivot_row = kk;
+					PivotMagnitude(best_, At(kk,kk));
+					for (Eigen::DenseIndex ii = kk+1; ii <= last_row; ++ii)
+					{
+						PivotMagnitude(candidate_, At(ii,kk));
+						if (candidate_ > best_)
+						{
+							using std::swap;
+							swap(best_, candidate_);
+							pivot_row = ii;
+						}
+					}
+
+					pivot_rows_[kk] = pivot_row;
+					if (pivot_row!=kk)
+					{
+						using std::swap;
+						for (Eigen::DenseIndex jj = kk; jj <= last_col; ++jj)
+							swap(At(kk,jj), At(pivot_row,jj));
+					}
+
+					pivots_(kk) = At(kk,kk);
+					pivot_inverses_(kk) = one_;
+					pivot_inverses_(kk) /= At(kk,kk);
+					if (IsZero(best_))
+						continue;
+
+					for (Eigen::DenseIndex ii = kk+1; ii <= last_row; ++ii)
+						At(ii,kk) *= pivot_inverses_(kk);
+
+					for (Eigen::DenseIndex jj = kk+1; jj <= last_col; ++jj)
+						for (Eigen::DenseIndex ii = kk+1; ii <= last_row; ++ii)
+							MultiplySubtract(At(ii,jj), At(ii,kk), At(kk,jj));
+				}
+			}
+
+			/**
+			\brief Check the pivots of the last factorization, as LUPartialPivotDecompositionSuccessful does the diagonal of dense factors.
+			*/
+			MatrixSuccessCode Success() const
+			{
+				return LUPivotsSuccessful(pivots_);
+			}
+
+			Eigen::DenseIndex Size() const
+			{
+				return band_.cols();
+			}
+
+			template<typename DerivedX, typename DerivedB>
+			void Solve(Eigen::MatrixBase<DerivedX> & x, Eigen::MatrixBase<DerivedB> const& b) const
+			{
+				const auto n = Size();
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					work_(ii) = b(order_[ii]);
+
+				// L, with the row exchanges made as the columns were eliminated
+				for (Eigen::DenseIndex kk = 0; kk < n; ++kk)
+				{
+					if (pivot_rows_[kk]!=kk)
+					{
+						using std::swap;
+						swap(work_(kk), work_(pivot_rows_[kk]));
+					}
+					for (Eigen::DenseIndex ii = kk+1; ii <= std::min(n-1, kk+kl_); ++ii)
+						MultiplySubtract(work_(ii), At(ii,kk), work_(kk));
+				}
+
+				for (Eigen::DenseIndex ii = n-1; ii >= 0; --ii)
+				{
+					for (Eigen::DenseIndex jj = ii+1; jj <= std::min(n-1, ii+kl_+ku_); ++jj)
+						MultiplySubtract(work_(ii), At(ii,jj), work_(jj));
+					work_(ii) *= pivot_inverses_(ii);
+				}
+
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					x(order_[ii]) = work_(ii);
+			}
+
+			template<typename DerivedX, typename DerivedB>
+			void SolveAdjoint(Eigen::MatrixBase<DerivedX> & x, Eigen::MatrixBase<DerivedB> const& b) const
+			{
+				using std::conj;
+				const auto n = Size();
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					work_(ii) = b(order_[ii]);
+
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+				{
+					for (Eigen::DenseIndex jj = std::max<Eigen::DenseIndex>(0, ii-kl_-ku_); jj < ii; ++jj)
+						MultiplySubtract(work_(ii), conj(At(jj,ii)), work_(jj));
+					work_(ii) *= conj(pivot_inverses_(ii));
+				}
+
+				// L^H, undoing the row exchanges in reverse
+				for (Eigen::DenseIndex kk = n-1; kk >= 0; --kk)
+				{
+					for (Eigen::DenseIndex ii = kk+1; ii <= std::min(n-1, kk+kl_); ++ii)
+						MultiplySubtract(work_(kk), conj(At(ii,kk)), work_(ii));
+					if (pivot_rows_[kk]!=kk)
+					{
+						using std::swap;
+						swap(work_(kk), work_(pivot_rows_[kk]));
+					}
+				}
+
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					x(order_[ii]) = work_(ii);
+			}
+
+		private:
+
+			NumType & At(Eigen::DenseIndex ii, Eigen::DenseIndex jj)
+			{
+				return band_(kl_+ku_+ii-jj, jj);
+			}
+
+			NumType const& At(Eigen::DenseIndex ii, Eigen::DenseIndex jj) const
+			{
+				return band_(kl_+ku_+ii-jj, jj);
+			}
+
+			std::vector<unsigned> order_; ///< the original index of each row and column, in the order factored, or empty if no pattern is in use
+			Eigen::DenseIndex kl_ = 0, ku_ = 0; ///< the subdiagonals and superdiagonals of the ordered pattern
+			Mat<NumType> band_; ///< the factors, entry (ii,jj) in row kl_+ku_+ii-jj of column jj
+			std::vector<Eigen::DenseIndex> pivot_rows_; ///< the row exchanged with row kk when eliminating column kk
+			Vec<NumType> pivots_; ///< the diagonal of U
+			Vec<NumType> pivot_inverses_;
+			mutable Vec<NumType> work_;
+			NumType one_ = NumType(1);
+			RealType best_, candidate_; ///< pivot magnitudes
+		};
+	}
+
+
+	/**
+	\brief An LU factorization with partial pivoting, PA = LU, which reuses its storage.
+
+	## Use
+
+	Size it once, factor as many matrices of that size as needed, and solve with each:
+
+	\code
+	PartialPivotLU<mpfr> lu(n);
+	lu.Factor(J);
+	if (LUPartialPivotDecompositionSuccessful(lu.MatrixLU())!=MatrixSuccessCode::Success)
+		...
+	lu.Solve(x, b);
+	\endcode
+
+	Factoring a matrix of another size resizes the workspace.  The precision of the workspace follows the factored matrix, and ChangePrecision sets it ahead of time, so the first factorization after a precision change does not allocate.
+
+	With RefinementSteps(k) for k > 0, the factored matrix is kept, and each solve is followed by k steps of iterative refinement, x += (LU)^{-1}(b - Ax), with the residual formed by fused multiply-subtracts at the working precision.  This costs a matrix-vector product and a substitution per step, and tightens the solution of ill-conditioned systems toward their backward error.
+
+	Given a team of threads, by UseThreads, matrices of size at least detail::MinBlockedLUSize are factored a panel of detail::BlockedLUPanelWidth columns at a time.  The panel is factored on the calling thread, and the eliminations it makes are then applied to the trailing columns, split among the threads.  Each entry is updated in the same order as by the unblocked factorization, so the factors are the same, to the bit.  This serves the very large systems, whose few slowest paths set the time of a run.
+
+	Given the pattern of the matrices to be factored, by UseSparsity, large sparse ones are factored by the sparse direct method of detail::SparseLUFactors, with the pattern analyzed once.  Those too small or too dense for it, but whose band is narrow once their rows and columns are put in reverse Cuthill-McKee order, are factored in that band by detail::BandedLUFactors.  The factors are not then stored densely, so MatrixLU is not available, and DecompositionSuccess checks the pivots instead.  The matrices are still passed densely, and in their own order, and only their entries at the pattern read.
+
+	\tparam NumType The complex number type.  The primary template is for multiple precision; double precision forwards to Eigen.
+	*/
+	template<typename NumType>
+	class PartialPivotLU
+	{
+		using RealType = typename Eigen::NumTraits<NumType>::Real;
+
+	public:
+
+		PartialPivotLU() = default;
+
+		/**
+		\brief Make an LU with workspace for n x n matrices.
+		*/
+		explicit
+		PartialPivotLU(Eigen::DenseIndex n)
+		{
+			Resize(n);
+		}
+
+
+		/**
+		\brief Size the workspace for n x n matrices.  Nothing is done if it is already that size.
+		*/
+		void Resize(Eigen::DenseIndex n)
+		{
+			if (lu_.rows()==n)
+				return;
+
+			lu_.resize(n,n);
+			permutation_.resize(n);
+			pivot_inverses_.resize(n);
+			work_.resize(n);
+			zero_pivots_.resize(n);
+			if (refinement_steps_>0)
+				ResizeRefinementWorkspace();
+		}
+
+
+		/**
+		\brief Factor large matrices on a team of threads, or on the calling thread alone if team is null.  See the class notes.
+		*/
+		void UseThreads(std::shared_ptr<detail::ThreadTeam> const& team)
+		{
+			team_ = team;
+		}
+
+
+		/**
+		\brief Factor the matrices to come by the sparse direct method, if it pays for their pattern, see detail::SparseLUPays, else in a band if that pays, see detail::BandedLUPays, else densely.  The pattern is analyzed here, once.
+
+		\param structure For each row, the columns of its entries which may be nonzero.  Empty to factor densely.
+		\return Whether the matrices will be factored by their structure, sparsely or in a band.
+		*/
+		bool UseSparsity(std::vector< std::vector<unsigned> > const& structure)
+		{
+			if (sparse_.UsePattern(structure))
+			{
+				banded_.UsePattern({});
+				return true;
+			}
+			if (banded_.UsePattern(structure))
+			{
+				if (precision_>0)
+					banded_.ChangePrecision(precision_);
+				return true;
+			}
+			return false;
+		}
+
+
+		/**
+		\brief Set the precision of the workspace, in place.
+
+		Call this alongside changing the precision of the matrices to be factored.
+		*/
+		void ChangePrecision(unsigned prec)
+		{
+			using bertini::Precision;
+			Precision(lu_, prec);
+			Precision(pivot_inverses_, prec);
+			Precision(work_, prec);
+			Precision(one_, prec);
+			best_.precision(prec);
+			candidate_.precision(prec);
+			if (banded_.Active())
+				banded_.ChangePrecision(prec);
+			if (refinement_steps_>0)
+			{
+				Precision(a_, prec);
+				Precision(residual_, prec);
+				Precision(correction_, prec);
+			}
+			precision_ = prec;
+		}
+
+
+		/**
+		\brief Set the number of steps of iterative refinement done by each solve.  Zero, the default, turns refinement off.
+
+		Takes effect from the next Factor.
+		*/
+		void RefinementSteps(unsigned steps)
+		{
+			refinement_steps_ = steps;
+			if (steps>0)
+				ResizeRefinementWorkspace();
+		}
+
+		/**
+		\brief The number of steps of iterative refinement done by each solve.
+		*/
+		unsigned RefinementSteps() const
+		{
+			return refinement_steps_;
+		}
+
+
+		/**
+		\brief Factor a square matrix into the workspace.
+
+		Whether the factorization is usable is for the caller to decide, with LUPartialPivotDecompositionSuccessful(MatrixLU()).  As with Eigen, a zero pivot does not stop the elimination.
+		*/
+		template<typename Derived>
+		PartialPivotLU& Factor(Eigen::MatrixBase<Derived> const& A)
+		{
+			using bertini::Precision;
+
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(A.rows()==A.cols() && "PartialPivotLU can only factor square matrices");
+			assert(A.rows()>0 && "PartialPivotLU cannot factor an empty matrix");
+			#endif
+
+			const auto n = A.rows();
+			Resize(n);
+
+			if (sparse_.Active())
+			{
+				if (Precision(A(0,0))!=precision_)
+					ChangePrecision(Precision(A(0,0)));
+				if (refinement_steps_>0)
+					a_ = A;
+				sparse_.Factor(A);
+				return *this;
+			}
+
+			if (banded_.Active())
+			{
+				if (Precision(A(0,0))!=precision_)
+					ChangePrecision(Precision(A(0,0)));
+				if (refinement_steps_>0)
+					a_ = A;
+				banded_.Factor(A);
+				return *this;
+			}
+
+			lu_ = A;
+			if (Precision(lu_(0,0))!=precision_)
+				ChangePrecision(Precision(lu_(0,0)));
+
+			if (refinement_steps_>0)
+				a_ = A;
+
+			for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+				permutation_(ii) = ii;
+
+			if (team_ && team_->Size()>1 && n >= detail::MinBlockedLUSize)
+			{
+				FactorBlocked(n);
+				return *this;
+			}
+
+			for (Eigen::DenseIndex kk = 0; kk < n; ++kk)
+			{
+				if (Pivot(kk))
+					continue;
+
+				for (Eigen::DenseIndex ii = kk+1; ii < n; ++ii)
+					lu_(ii,kk) *= pivot_inverses_(kk);
+
+				// the rank one update of the trailing block, a column at a time
+				for (Eigen::DenseIndex jj = kk+1; jj < n; ++jj)
+					for (Eigen::DenseIndex ii = kk+1; ii < n; ++ii)
+						MultiplySubtract(lu_(ii,jj), lu_(ii,kk), lu_(kk,jj));
+			}
+
+			return *this;
+		}
+
+
+		/**
+		\brief The factors, with L strictly below the diagonal, its unit diagonal implied, and U on and above.
+
+		\throws std::runtime_error if the matrix was factored sparsely or in a band, see UseSparsity.
+		*/
+		Mat<NumType> const& MatrixLU() const
+		{
+			if (sparse_.Active())
+				throw std::runtime_error("asking for the dense factors of a matrix factored sparsely");
+			if (banded_.Active())
+				throw std::runtime_error("asking for the dense factors of a matrix factored in a band");
+			return lu_;
+		}
+
+		/**
+		\brief Whether the last factorization is usable, by the size of its pivots, as LUPartialPivotDecompositionSuccessful(MatrixLU()), but also for a sparse or banded factorization.
+		*/
+		MatrixSuccessCode DecompositionSuccess() const
+		{
+			if (sparse_.Active())
+				return sparse_.Success();
+			if (banded_.Active())
+				return banded_.Success();
+			return LUPartialPivotDecompositionSuccessful(lu_);
+		}
+
+		/**
+		\brief The size of the last matrix factored, or of the workspace.
+		*/
+		Eigen::DenseIndex Size() const
+		{
+			return lu_.rows();
+		}
+
+		/**
+		\brief The precision of the last matrix factored.
+		*/
+		unsigned FactoredPrecision() const
+		{
+			return precision_;
+		}
+
+
+		/**
+		\brief Solve Ax = b for x, in place, where A is the last matrix factored.
+
+		x may be a block of a larger matrix, such as a column, but must not alias b.
+		*/
+		template<typename DerivedX, typename DerivedB>
+		void Solve(Eigen::MatrixBase<DerivedX> const& x, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			SolveImpl(x, b, false);
+		}
+
+		/**
+		\brief Solve Ax = -b for x, in place, as wanted for Newton steps, without negating b.
+		*/
+		template<typename DerivedX, typename DerivedB>
+		void SolveNegative(Eigen::MatrixBase<DerivedX> const& x, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			SolveImpl(x, b, true);
+		}
+
+		/**
+		\brief Solve Ax = b, returning x.  This allocates the result.
+		*/
+		template<typename DerivedB>
+		Vec<NumType> Solve(Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			Vec<NumType> x(b.rows());
+			Solve(x, b);
+			return x;
+		}
+
+		/**
+		\brief Solve A^H x = b for x, in place, where A is the last matrix factored, with the same factors.
+
+		There is no iterative refinement of this solve.  It is for estimating norms of the inverse.
+		*/
+		template<typename DerivedX, typename DerivedB>
+		void SolveAdjoint(Eigen::MatrixBase<DerivedX> const& x_const, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(b.rows()==lu_.rows() && "right hand side of wrong size for PartialPivotLU");
+			#endif
+
+			using std::conj;
+			auto& x = const_cast< Eigen::MatrixBase<DerivedX>& >(x_const);
+			const auto n = lu_.rows();
+			x.derived().resize(n);
+
+			if (sparse_.Active())
+			{
+				sparse_.SolveAdjoint(x, b);
+				return;
+			}
+			if (banded_.Active())
+			{
+				banded_.SolveAdjoint(x, b);
+				return;
+			}
+
+			// A^H = U^H L^H P, so solve U^H L^H y = b, and x = P^T y
+			for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+			{
+				work_(ii) = b(ii);
+				for (Eigen::DenseIndex jj = 0; jj < ii; ++jj)
+					MultiplySubtract(work_(ii), conj(lu_(jj,ii)), work_(jj));
+				work_(ii) *= conj(pivot_inverses_(ii));
+			}
+
+			for (Eigen::DenseIndex ii = n-1; ii >= 0; --ii)
+				for (Eigen::DenseIndex jj = ii+1; jj < n; ++jj)
+					MultiplySubtract(work_(ii), conj(lu_(jj,ii)), work_(jj));
+
+			for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+				x(permutation_(ii)) = work_(ii);
+		}
+
+	private:
+
+		/**
+		\brief Pick the pivot of column kk, among the rows on and below the diagonal, and swap its row into place, whole.  Sets the inverse of the pivot, and returns whether it is zero.
+		*/
+		bool Pivot(Eigen::DenseIndex kk)
+		{
+			const auto n = lu_.rows();
+			Eigen::DenseIndex pivot_row = kk;
+			detail::PivotMagnitude(best_, lu_(kk,kk));
+			for (Eigen::DenseIndex ii = kk+1; ii < n; ++ii)
+			{
+				detail::PivotMagnitude(candidate_, lu_(ii,kk));
+				if (candidate_ > best_)
+				{
+					using std::swap;
+					swap(best_, candidate_);
+					pivot_row = ii;
+				}
+			}
+
+			if (pivot_row!=kk)
+			{
+				using std::swap;
+				for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+					swap(lu_(kk,jj), lu_(pivot_row,jj));
+				swap(permutation_(kk), permutation_(pivot_row));
+			}
+
+			pivot_inverses_(kk) = one_;
+			pivot_inverses_(kk) /= lu_(kk,kk);
+			return detail::IsZero(best_);
+		}
+
+		/**
+		\brief The factorization a panel at a time, with the trailing columns of each panel updated on the team.
+		*/
+		void FactorBlocked(Eigen::DenseIndex n)
+		{
+			for (Eigen::DenseIndex panel = 0; panel < n; panel += detail::BlockedLUPanelWidth)
+			{
+				const auto panel_end = std::min(panel + detail::BlockedLUPanelWidth, n);
+
+				// the columns of the panel, as in the unblocked factorization, but updating only the panel
+				for (Eigen::DenseIndex kk = panel; kk < panel_end; ++kk)
+				{
+					zero_pivots_[kk] = Pivot(kk);
+					if (zero_pivots_[kk])
+						continue;
+
+					for (Eigen::DenseIndex ii = kk+1; ii < n; ++ii)
+						lu_(ii,kk) *= pivot_inverses_(kk);
+
+					for (Eigen::DenseIndex jj = kk+1; jj < panel_end; ++jj)
+						for (Eigen::DenseIndex ii = kk+1; ii < n; ++ii)
+							MultiplySubtract(lu_(ii,jj), lu_(ii,kk), lu_(kk,jj));
+				}
+
+				if (panel_end==n)
+					break;
+
+				// the eliminations of the panel, applied to each trailing column in the order the unblocked factorization would.  the row exchanges were already made on whole rows, and commute with them.
+				const auto num_trailing = static_cast<std::size_t>(n - panel_end);
+				team_->Run([&](unsigned part, unsigned num_parts)
+					{
+						const auto begin = panel_end + static_cast<Eigen::DenseIndex>(detail::PartBegin(num_trailing, part, num_parts));
+						const auto end = panel_end + static_cast<Eigen::DenseIndex>(detail::PartBegin(num_trailing, part+1, num_parts));
+						for (Eigen::DenseIndex jj = begin; jj < end; ++jj)
+							for (Eigen::DenseIndex kk = panel; kk < panel_end; ++kk)
+								if (!zero_pivots_[kk])
+									for (Eigen::DenseIndex ii = kk+1; ii < n; ++ii)
+										MultiplySubtract(lu_(ii,jj), lu_(ii,kk), lu_(kk,jj));
+					});
+			}
+		}
+
+		void ResizeRefinementWorkspace()
+		{
+			const auto n = lu_.rows();
+			a_.resize(n,n);
+			residual_.resize(n);
+			correction_.resize(n);
+		}
+
+		/**
+		\brief Forward and back substitution, overwriting y, which holds the unpermuted right hand side, with the solution.
+		*/
+		void Substitute(Vec<NumType> & y) const
+		{
+			const auto n = lu_.rows();
+
+			// L has unit diagonal
+			for (Eigen::DenseIndex ii = 1; ii < n; ++ii)
+				for (Eigen::DenseIndex jj = 0; jj < ii; ++jj)
+					MultiplySubtract(y(ii), lu_(ii,jj), y(jj));
+
+			for (Eigen::DenseIndex ii = n-1; ii >= 0; --ii)
+			{
+				for (Eigen::DenseIndex jj = ii+1; jj < n; ++jj)
+					MultiplySubtract(y(ii), lu_(ii,jj), y(jj));
+				y(ii) *= pivot_inverses_(ii);
+			}
+		}
+
+		/**
+		\brief y = A^{-1} b from the factors, dense, sparse or banded, without refinement.
+		*/
+		template<typename DerivedB>
+		void SolveFactored(Vec<NumType> & y, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			if (sparse_.Active())
+			{
+				sparse_.Solve(y, b);
+				return;
+			}
+			if (banded_.Active())
+			{
+				banded_.Solve(y, b);
+				return;
+			}
+
+			for (Eigen::DenseIndex ii = 0; ii < y.size(); ++ii)
+				y(ii) = b(permutation_(ii));
+			Substitute(y);
+		}
+
+		template<typename DerivedX, typename DerivedB>
+		void SolveImpl(Eigen::MatrixBase<DerivedX> const& x_const, Eigen::MatrixBase<DerivedB> const& b, bool negate) const
+		{
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(b.rows()==lu_.rows() && "right hand side of wrong size for PartialPivotLU");
+			#endif
+
+			auto& x = const_cast< Eigen::MatrixBase<DerivedX>& >(x_const);
+			const auto n = lu_.rows();
+			x.derived().resize(n);
+
+			SolveFactored(work_, b);
+
+			for (unsigned step = 0; step < refinement_steps_; ++step)
+			{
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+				{
+					residual_(ii) = b(ii);
+					for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+						MultiplySubtract(residual_(ii), a_(ii,jj), work_(jj));
+				}
+
+				SolveFactored(correction_, residual_);
+
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					work_(ii) += correction_(ii);
+			}
+
+			for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+			{
+				x(ii) = work_(ii);
+				if (negate)
+					Negate(x(ii));
+			}
+		}
+
+
+		Mat<NumType> lu_; ///< the factors, in place of the matrix
+		Eigen::Matrix<Eigen::DenseIndex, Eigen::Dynamic, 1> permutation_; ///< row ii of PA is row permutation_(ii) of A
+		Vec<NumType> pivot_inverses_; ///< reciprocals of the diagonal of U, so substitution multiplies rather than divides
+
+		mutable Vec<NumType> work_; ///< the solution in progress
+
+		unsigned refinement_steps_ = 0;
+		Mat<NumType> a_; ///< the factored matrix, kept only for refinement
+		mutable Vec<NumType> residual_;
+		mutable Vec<NumType> correction_;
+
+		NumType one_ = NumType(1);
+		RealType best_, candidate_; ///< pivot magnitudes
+		unsigned precision_ = 0;
+
+		std::shared_ptr<detail::ThreadTeam> team_; ///< the threads on which large matrices are factored, if any
+		std::vector<char> zero_pivots_; ///< whether each pivot was zero, so that its column eliminated nothing
+
+		detail::SparseLUFactors<NumType> sparse_; ///< the sparse factorization, used if it has a pattern
+		detail::BandedLUFactors<NumType> banded_; ///< the banded factorization, used if it has a pattern and the sparse one does not
+	};
+
+
+
+	namespace detail {
+
+		/**
+		\brief The largest size of a double precision matrix factored by the kernels with sizes fixed at compile time.
+		*/
+		constexpr Eigen::DenseIndex MaxSmallLUSize = 8;
+
+		/**
+		\brief Factor PA = LU in place, with partial pivoting on |re|+|im|, for an N by N matrix, N fixed at compile time so that the loops unroll.
+
+		\param a The matrix, by columns, overwritten by L below the diagonal, with its unit diagonal implied, and U on and above it.
+		\param transpositions The row swapped with row k at step k, for each k.
+		*/
+		template<int N>
+		void SmallLUFactor(dbl* a, int* transpositions)
+		{
+			Eigen::Map< Eigen::Matrix<dbl,N,N> > A(a);
+			for (int k = 0; k < N; ++k)
+			{
+				int pivot = k;
+				double biggest, candidate;
+				PivotMagnitude(biggest, A(k,k));
+				for (int ii = k+1; ii < N; ++ii)
+				{
+					PivotMagnitude(candidate, A(ii,k));
+					if (candidate > biggest)
+					{
+						biggest = candidate;
+						pivot = ii;
+					}
+				}
+				transpositions[k] = pivot;
+				if (pivot!=k)
+					A.row(k).swap(A.row(pivot));
+
+				if (biggest==0)
+					continue;
+
+				const dbl inverse = dbl(1)/A(k,k);
+				for (int ii = k+1; ii < N; ++ii)
+					A(ii,k) *= inverse;
+				for (int jj = k+1; jj < N; ++jj)
+					kernels::Axpy(N-k-1, -A(k,jj), &A(k+1,k), &A(k+1,jj));
+			}
+		}
+
+		/**
+		\brief Solve Ax = b in place, from the factors of SmallLUFactor.  With N Eigen::Dynamic, from the factors of BlockedLUFactor, of size n.
+		*/
+		template<int N>
+		void SmallLUSolve(dbl const* lu, int const* transpositions, dbl* x_data, Eigen::DenseIndex n = N)
+		{
+			Eigen::Map< const Eigen::Matrix<dbl,N,N> > LU(lu, n, n);
+			Eigen::Map< Eigen::Matrix<dbl,N,1> > x(x_data, n);
+			for (Eigen::DenseIndex k = 0; k < n; ++k)
+				std::swap(x(k), x(transpositions[k]));
+			kernels::SolveUnitLower(n, lu, n, x_data);
+			kernels::SolveUpper(n, lu, n, x_data);
+		}
+
+		/**
+		\brief Solve A^H x = b in place, from the factors of SmallLUFactor, or with N Eigen::Dynamic of BlockedLUFactor.  A^H = U^H L^H P, so the transpositions are undone last, in reverse.
+		*/
+		template<int N>
+		void SmallLUSolveAdjoint(dbl const* lu, int const* transpositions, dbl* x_data, Eigen::DenseIndex n = N)
+		{
+			Eigen::Map< const Eigen::Matrix<dbl,N,N> > LU(lu, n, n);
+			Eigen::Map< Eigen::Matrix<dbl,N,1> > x(x_data, n);
+			LU.template triangularView<Eigen::Upper>().adjoint().solveInPlace(x);
+			LU.template triangularView<Eigen::UnitLower>().adjoint().solveInPlace(x);
+			for (Eigen::DenseIndex k = n-1; k >= 0; --k)
+				std::swap(x(k), x(transpositions[k]));
+		}
+
+		/**
+		\brief Call f with the size of a small matrix as a compile-time constant, std::integral_constant<int,N>, for N from 1 to MaxSmallLUSize.
+		*/
+		template<typename Function>
+		void DispatchSmallSize(Eigen::DenseIndex n, Function f)
+		{
+			switch (n)
+			{
+				case 1: f(std::integral_constant<int,1>()); break;
+				case 2: f(std::integral_constant<int,2>()); break;
+				case 3: f(std::integral_constant<int,3>()); break;
+				case 4: f(std::integral_constant<int,4>()); break;
+				case 5: f(std::integral_constant<int,5>()); break;
+				case 6: f(std::integral_constant<int,6>()); break;
+				case 7: f(std::integral_constant<int,7>()); break;
+				case 8: f(std::integral_constant<int,8>()); break;
+				default: throw std::logic_error("no fixed-size LU kernel for a matrix of size " + std::to_string(n));
+			}
+		}
+
+		/**
+		\brief Factor PA = LU in place, as SmallLUFactor, a panel of BlockedLUPanelWidth columns at a time, with the trailing columns of each panel solved for and updated on a team of threads, split among them by columns.
+		*/
+		inline
+		void BlockedLUFactor(Mat<dbl> & A, int* transpositions, ThreadTeam & team)
+		{
+			const auto n = A.rows();
+			for (Eigen::DenseIndex panel = 0; panel < n; panel += BlockedLUPanelWidth)
+			{
+				const auto panel_end = std::min(panel + BlockedLUPanelWidth, n);
+				for (auto k = panel; k < panel_end; ++k)
+				{
+					Eigen::DenseIndex pivot = k;
+					double biggest, candidate;
+					PivotMagnitude(biggest, A(k,k));
+					for (auto ii = k+1; ii < n; ++ii)
+					{
+						PivotMagnitude(candidate, A(ii,k));
+						if (candidate > biggest)
+						{
+							biggest = candidate;
+							pivot = ii;
+						}
+					}
+					transpositions[k] = static_cast<int>(pivot);
+					if (pivot!=k)
+						A.row(k).swap(A.row(pivot));
+
+					if (biggest==0)
+						continue;
+
+					A.col(k).tail(n-k-1) /= A(k,k);
+					A.block(k+1, k+1, n-k-1, panel_end-k-1).noalias() -= A.col(k).tail(n-k-1) * A.row(k).segment(k+1, panel_end-k-1);
+				}
+
+				if (panel_end==n)
+					break;
+
+				// U for the trailing columns, then the update of the trailing block by the panel, each part its own columns
+				const auto width = panel_end - panel;
+				const auto num_trailing = n - panel_end;
+				team.Run([&](unsigned part, unsigned num_parts)
+					{
+						const auto begin = panel_end + static_cast<Eigen::DenseIndex>(PartBegin(num_trailing, part, num_parts));
+						const auto end = panel_end + static_cast<Eigen::DenseIndex>(PartBegin(num_trailing, part+1, num_parts));
+						if (begin==end)
+							return;
+
+						auto U = A.block(panel, begin, width, end-begin);
+						A.block(panel, panel, width, width).triangularView<Eigen::UnitLower>().solveInPlace(U);
+						A.block(panel_end, begin, num_trailing, end-begin).noalias() -= A.block(panel_end, panel, num_trailing, width) * U;
+					});
+			}
+		}
+	} // namespace detail
+
+
+	/**
+	\brief Double precision LU, by Eigen's decomposition, with the interface of the multiple precision one.
+
+	Eigen's kernels are vectorized for std::complex<double>, and their temporaries are cheap, so this mostly adapts the interface.  Square matrices of size at most detail::MaxSmallLUSize, as from the small systems solved in bulk in parameter sweeps, are instead factored and solved by kernels with the size fixed at compile time, chosen from the size of the matrix, which unroll their loops and keep their temporaries on the stack.  The factors are in the same layout as Eigen's, L below the unit diagonal and U on and above it, so MatrixLU is read the same way either way, though the pivots, on |re|+|im| as in the multiple precision LU, may differ from Eigen's.
+
+	Given a team of threads, by UseThreads, square matrices of size at least detail::MinBlockedLUSize are factored by detail::BlockedLUFactor, with the same pivots, and the work after each panel split among the threads.  Given their pattern, by UseSparsity, large sparse matrices are factored sparsely, and others of narrow band in their band, either of which takes precedence.
+	*/
+	template<>
+	class PartialPivotLU<dbl>
+	{
+	public:
+
+		PartialPivotLU() = default;
+
+		explicit
+		PartialPivotLU(Eigen::DenseIndex n) : lu_(n)
+		{
+			if (n <= detail::MaxSmallLUSize)
+				own_lu_.resize(n,n);
+		}
+
+		void Resize(Eigen::DenseIndex n)
+		{
+			if (lu_.matrixLU().rows()!=n)
+				lu_ = Eigen::PartialPivLU<Mat<dbl>>(n);
+			if (n <= detail::MaxSmallLUSize)
+				own_lu_.resize(n,n);
+		}
+
+		/**
+		\brief Factor large matrices on a team of threads, or by Eigen on the calling thread if team is null.  See the class notes.
+		*/
+		void UseThreads(std::shared_ptr<detail::ThreadTeam> const& team)
+		{
+			team_ = team;
+		}
+
+		/**
+		\brief Factor the matrices to come sparsely, or in a band, if it pays for their pattern, as the multiple precision LU does.
+		*/
+		bool UseSparsity(std::vector< std::vector<unsigned> > const& structure)
+		{
+			if (sparse_.UsePattern(structure))
+			{
+				banded_.UsePattern({});
+				return true;
+			}
+			return banded_.UsePattern(structure);
+		}
+
+		void ChangePrecision(unsigned)
+		{}
+
+		void RefinementSteps(unsigned steps)
+		{
+			refinement_steps_ = steps;
+		}
+
+		unsigned RefinementSteps() const
+		{
+			return refinement_steps_;
+		}
+
+		template<typename Derived>
+		PartialPivotLU& Factor(Eigen::MatrixBase<Derived> const& A)
+		{
+			const auto n = A.rows();
+			if (sparse_.Active())
+				kernel_ = Kernel::Sparse;
+			else if (banded_.Active())
+				kernel_ = Kernel::Banded;
+			else if (n==A.cols() && n > 0 && n <= detail::MaxSmallLUSize)
+				kernel_ = Kernel::Small;
+			else if (n==A.cols() && team_ && team_->Size()>1 && n >= detail::MinBlockedLUSize)
+				kernel_ = Kernel::Blocked;
+			else
+				kernel_ = Kernel::Eigen;
+
+			if (kernel_==Kernel::Eigen)
+				lu_.compute(A);
+			else if (kernel_==Kernel::Sparse)
+				sparse_.Factor(A);
+			else if (kernel_==Kernel::Banded)
+				banded_.Factor(A);
+			else
+			{
+				own_lu_ = A;
+				transpositions_.resize(n);
+				if (kernel_==Kernel::Small)
+					detail::DispatchSmallSize(n, [this](auto N)
+						{
+							detail::SmallLUFactor<decltype(N)::value>(own_lu_.data(), transpositions_.data());
+						});
+				else
+					detail::BlockedLUFactor(own_lu_, transpositions_.data(), *team_);
+			}
+
+			if (refinement_steps_>0)
+				a_ = A;
+			return *this;
+		}
+
+		Mat<dbl> const& MatrixLU() const
+		{
+			if (kernel_==Kernel::Sparse)
+				throw std::runtime_error("asking for the dense factors of a matrix factored sparsely");
+			if (kernel_==Kernel::Banded)
+				throw std::runtime_error("asking for the dense factors of a matrix factored in a band");
+			return kernel_==Kernel::Eigen ? lu_.matrixLU() : own_lu_;
+		}
+
+		MatrixSuccessCode DecompositionSuccess() const
+		{
+			if (kernel_==Kernel::Sparse)
+				return sparse_.Success();
+			if (kernel_==Kernel::Banded)
+				return banded_.Success();
+			return LUPartialPivotDecompositionSuccessful(MatrixLU());
+		}
+
+		Eigen::DenseIndex Size() const
+		{
+			if (kernel_==Kernel::Sparse)
+				return sparse_.Size();
+			if (kernel_==Kernel::Banded)
+				return banded_.Size();
+			return MatrixLU().rows();
+		}
+
+		unsigned FactoredPrecision() const
+		{
+			return DoublePrecision();
+		}
+
+		template<typename DerivedX, typename DerivedB>
+		void Solve(Eigen::MatrixBase<DerivedX> const& x_const, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			auto& x = const_cast< Eigen::MatrixBase<DerivedX>& >(x_const).derived();
+			SolveUnrefined(x, b);
+			for (unsigned step = 0; step < refinement_steps_; ++step)
+			{
+				residual_ = b;
+				residual_.noalias() -= a_*x;
+				SolveUnrefined(correction_, residual_);
+				x += correction_;
+			}
+		}
+
+		template<typename DerivedX, typename DerivedB>
+		void SolveNegative(Eigen::MatrixBase<DerivedX> const& x_const, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			auto& x = const_cast< Eigen::MatrixBase<DerivedX>& >(x_const).derived();
+			Solve(x, b);
+			x = -x;
+		}
+
+		template<typename DerivedB>
+		Vec<dbl> Solve(Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			Vec<dbl> x(b.rows());
+			Solve(x, b);
+			return x;
+		}
+
+		template<typename DerivedX, typename DerivedB>
+		void SolveAdjoint(Eigen::MatrixBase<DerivedX> const& x_const, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			auto& x = const_cast< Eigen::MatrixBase<DerivedX>& >(x_const).derived();
+			if (kernel_==Kernel::Small)
+			{
+				x = b;
+				detail::DispatchSmallSize(own_lu_.rows(), [&](auto N)
+					{
+						detail::SmallLUSolveAdjoint<decltype(N)::value>(own_lu_.data(), transpositions_.data(), x.data());
+					});
+				return;
+			}
+			if (kernel_==Kernel::Sparse)
+			{
+				sparse_.SolveAdjoint(x, b);
+				return;
+			}
+			if (kernel_==Kernel::Banded)
+			{
+				banded_.SolveAdjoint(x, b);
+				return;
+			}
+			if (kernel_==Kernel::Blocked)
+			{
+				x = b;
+				detail::SmallLUSolveAdjoint<Eigen::Dynamic>(own_lu_.data(), transpositions_.data(), x.data(), own_lu_.rows());
+				return;
+			}
+
+			Vec<dbl> y = lu_.matrixLU().triangularView<Eigen::Upper>().adjoint().solve(b);
+			lu_.matrixLU().triangularView<Eigen::UnitLower>().adjoint().solveInPlace(y);
+			x = lu_.permutationP().transpose() * y;
+		}
+
+	private:
+
+		// x = A^{-1} b, into the storage of x, without refinement
+		template<typename DerivedX, typename DerivedB>
+		void SolveUnrefined(DerivedX & x, Eigen::MatrixBase<DerivedB> const& b) const
+		{
+			if (kernel_==Kernel::Eigen)
+			{
+				x = lu_.solve(b);
+				return;
+			}
+			if (kernel_==Kernel::Sparse)
+			{
+				sparse_.Solve(x, b);
+				return;
+			}
+			if (kernel_==Kernel::Banded)
+			{
+				banded_.Solve(x, b);
+				return;
+			}
+
+			x = b;
+			if (kernel_==Kernel::Blocked)
+			{
+				detail::SmallLUSolve<Eigen::Dynamic>(own_lu_.data(), transpositions_.data(), x.data(), own_lu_.rows());
+				return;
+			}
+			detail::DispatchSmallSize(own_lu_.rows(), [&](auto N)
+				{
+					detail::SmallLUSolve<decltype(N)::value>(own_lu_.data(), transpositions_.data(), x.data());
+				});
+		}
+
+		enum class Kernel { Eigen, Small, Blocked, Sparse, Banded };
+
+		Eigen::PartialPivLU<Mat<dbl>> lu_;
+		Kernel kernel_ = Kernel::Eigen; ///< Which factored the last matrix.
+		Mat<dbl> own_lu_; ///< The factors of the last matrix not factored by Eigen.
+		std::vector<int> transpositions_;
+		std::shared_ptr<detail::ThreadTeam> team_; ///< the threads on which large matrices are factored, if any
+		detail::SparseLUFactors<dbl> sparse_; ///< the sparse factorization, used if it has a pattern
+		detail::BandedLUFactors<dbl> banded_; ///< the banded factorization, used if it has a pattern and the sparse one does not
+		unsigned refinement_steps_ = 0;
+		Mat<dbl> a_;
+		mutable Vec<dbl> residual_, correction_; ///< Workspace for iterative refinement.
+	};
+
+} // namespace bertini
+
+#endif
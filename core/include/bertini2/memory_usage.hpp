@@ -0,0 +1,243 @@
+//This file is part of Bertini 2.
+//
+//memory_usage.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//memory_usage.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with memory_usage.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file memory_usage.hpp
+
+\brief How much memory an object holds, broken down by its components, as reported by the MemoryReport of a System, a tracker, or an endgame.
+
+A component is named by a path, such as "function_trees/SumOperator", and holds a number of bytes, and of the things holding them, nodes or numbers.  Components are disjoint, so the total is their sum, and the bytes of "function_trees" are those of every component beneath it.
+
+The bytes are an estimate, from the sizes of the numbers, vectors and matrices held, and the precisions of the multiple precision ones, not a count of what was allocated.  The overhead of the allocator, and the structures of the standard library, are not counted.
+
+\code
+auto report = sys.MemoryReport();
+std::cout << report; // a line per component
+auto trees = report.Bytes("function_trees");
+\endcode
+*/
+
+#ifndef BERTINI_MEMORY_USAGE_HPP
+#define BERTINI_MEMORY_USAGE_HPP
+
+#include "bertini2/mpfr_complex.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace bertini {
+
+	/**
+	\brief The memory held by an object, by component.
+	*/
+	class MemoryUsage
+	{
+	public:
+
+		struct Component
+		{
+			std::string name;
+			std::size_t bytes;
+			std::size_t count; ///< The number of nodes, numbers, or other things holding the bytes.
+		};
+
+		/**
+		\brief Add bytes to a component, made if there is none of the name.
+		*/
+		void Add(std::string const& name, std::size_t bytes, std::size_t count = 0);
+
+		/**
+		\brief Add the components of another report, each beneath a prefix.
+		*/
+		void Add(std::string const& prefix, MemoryUsage const& other);
+
+		/**
+		\brief The bytes of all the components.
+		*/
+		std::size_t TotalBytes() const;
+
+		/**
+		\brief The bytes of a component, and of those beneath it.  0 if there are none.
+		*/
+		std::size_t Bytes(std::string const& name) const;
+
+		/**
+		\brief The count of a component, and of those beneath it.
+		*/
+		std::size_t Count(std::string const& name) const;
+
+		std::vector<Component> const& Components() const
+		{
+			return components_;
+		}
+
+	private:
+		std::vector<Component> components_; ///< In the order first added.
+	};
+
+	/**
+	\brief Write a line per component, its name, bytes and count, then the total.
+	*/
+	std::ostream& operator<<(std::ostream & out, MemoryUsage const& usage);
+
+
+	/**
+	\brief The bytes of physical memory available to be allocated, or 0 if that cannot be found, as on other systems than Linux.
+	*/
+	std::size_t AvailableMemory();
+
+
+	namespace memory {
+
+		/**
+		\brief The bytes held by a T beyond sizeof(T), on the heap.  Specialize for types holding memory.
+
+		A class template rather than overloads, so that specializations made after a container's, such as for tracking::RingBuffer, are used for its elements.
+		*/
+		template<typename T, typename Enable = void>
+		struct Heap
+		{
+			static std::size_t Bytes(T const&)
+			{
+				return 0;
+			}
+		};
+
+		template<typename T>
+		std::size_t HeapBytes(T const& t)
+		{
+			return Heap<T>::Bytes(t);
+		}
+
+		/**
+		\brief The bytes of a T, its own and those it holds.
+		*/
+		template<typename T>
+		std::size_t BytesOf(T const& t)
+		{
+			return sizeof(T) + HeapBytes(t);
+		}
+
+		/**
+		\brief The bytes of the significand of a real at a precision in digits.
+		*/
+		inline
+		std::size_t SignificandBytes(unsigned digits)
+		{
+			return mpfr_custom_get_size(std::max<mpfr_prec_t>(DigitsToBits(digits), MPFR_PREC_MIN));
+		}
+
+		template<>
+		struct Heap<mpfr_float>
+		{
+			static std::size_t Bytes(mpfr_float const& x)
+			{
+				return mpfr_custom_get_size(mpfr_get_prec(x.backend().data()));
+			}
+		};
+
+		template<>
+		struct Heap<complex>
+		{
+			static std::size_t Bytes(complex const& z)
+			{
+				return HeapBytes(z.real()) + HeapBytes(z.imag());
+			}
+		};
+
+		template<typename T, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+		struct Heap< Eigen::Matrix<T, Rows, Cols, Options, MaxRows, MaxCols> >
+		{
+			static std::size_t Bytes(Eigen::Matrix<T, Rows, Cols, Options, MaxRows, MaxCols> const& m)
+			{
+				std::size_t bytes = (Rows==Eigen::Dynamic || Cols==Eigen::Dynamic) ? m.size()*sizeof(T) : 0;
+				for (Eigen::DenseIndex ii = 0; ii < m.size(); ++ii)
+					bytes += HeapBytes(m.data()[ii]);
+				return bytes;
+			}
+		};
+
+		template<typename T, typename A>
+		struct Heap< std::vector<T, A> >
+		{
+			static std::size_t Bytes(std::vector<T, A> const& v)
+			{
+				std::size_t bytes = v.capacity()*sizeof(T);
+				for (auto const& t : v)
+					bytes += HeapBytes(t);
+				return bytes;
+			}
+		};
+
+		template<typename T, typename A>
+		struct Heap< std::deque<T, A> >
+		{
+			static std::size_t Bytes(std::deque<T, A> const& d)
+			{
+				std::size_t bytes = d.size()*sizeof(T);
+				for (auto const& t : d)
+					bytes += HeapBytes(t);
+				return bytes;
+			}
+		};
+
+		template<typename A, typename B>
+		struct Heap< std::pair<A, B> >
+		{
+			static std::size_t Bytes(std::pair<A, B> const& p)
+			{
+				return HeapBytes(p.first) + HeapBytes(p.second);
+			}
+		};
+
+		template<typename... Ts>
+		struct Heap< std::tuple<Ts...> >
+		{
+			static std::size_t Bytes(std::tuple<Ts...> const& t)
+			{
+				return Sum(t, std::index_sequence_for<Ts...>());
+			}
+
+		private:
+			template<std::size_t... I>
+			static std::size_t Sum(std::tuple<Ts...> const& t, std::index_sequence<I...>)
+			{
+				std::size_t bytes = 0;
+				(void)std::initializer_list<int>{(bytes += HeapBytes(std::get<I>(t)), 0)...};
+				return bytes;
+			}
+		};
+
+	} // namespace memory
+
+} // namespace bertini
+
+#endif
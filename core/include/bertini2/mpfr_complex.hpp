@@ -66,11 +66,29 @@ namespace bertini {
 		mpfr_float real_, imag_;
 		
 		#ifdef USE_THREAD_LOCAL
-			static thread_local mpfr_float temp_[8]; //OSX clang does NOT implement this. Use ./configure --disable-thread_local.  Also, send Apple a letter telling them to implement this keyword.
+			static thread_local mpfr_float temp_[10]; //OSX clang does NOT implement this. Use ./configure --disable-thread_local.  Also, send Apple a letter telling them to implement this keyword.
 		#else
-			static mpfr_float temp_[8];
+			static mpfr_float temp_[10];
 		#endif
 
+		/**
+		 Compute the product of two complex numbers into a pair of reals at default precision, rounding each part once.  The reals must not be parts of either factor.
+
+		 Uses the fused mpfr_fmma and mpfr_fmms, of MPFR 4 and later, when available.
+		 */
+		static void ProductInto(mpfr_float & real_part, mpfr_float & imag_part, const complex & a, const complex & b)
+		{
+			real_part.precision(DefaultPrecision());
+			imag_part.precision(DefaultPrecision());
+		#if MPFR_VERSION_MAJOR >= 4
+			mpfr_fmms(real_part.backend().data(), a.real_.backend().data(), b.real_.backend().data(), a.imag_.backend().data(), b.imag_.backend().data(), MPFR_RNDN);
+			mpfr_fmma(imag_part.backend().data(), a.real_.backend().data(), b.imag_.backend().data(), a.imag_.backend().data(), b.real_.backend().data(), MPFR_RNDN);
+		#else
+			real_part = a.real_*b.real_ - a.imag_*b.imag_;
+			imag_part = a.real_*b.imag_ + a.imag_*b.real_;
+		#endif
+		}
+
 		// Let the boost serialization library have access to the private members of this class.
 		friend class boost::serialization::access;
 		
@@ -329,7 +347,15 @@ namespace bertini {
 		 Get the value of the imaginary part of the complex number
 		 */
 		inline const mpfr_float& imag() const {return imag_;}
-		
+
+		/**
+		 Direct access to the MPFR numbers of the parts, for kernels working on them in place.
+		 */
+		mpfr_srcptr real_data() const {return real_.backend().data();}
+		mpfr_srcptr imag_data() const {return imag_.backend().data();}
+		mpfr_ptr real_data() {return real_.backend().data();}
+		mpfr_ptr imag_data() {return imag_.backend().data();}
+
 		/**
 		 Set the value of the real part of the complex number
 		 */
@@ -549,17 +575,15 @@ namespace bertini {
 
 
 		/**
-		 Complex multiplication.  uses a single temporary variable
+		 Complex multiplication.  The parts of the product are computed into two temporaries, which are then swapped in, so no allocation occurs at steady precision.
 		 
-		 1 temporary, 4 multiplications
+		 2 fused multiply-adds with MPFR 4 or later, 4 multiplications otherwise
 		 */
 		complex& operator*=(const complex & rhs)
 		{
-			temp_[0].precision(DefaultPrecision());
-
-			temp_[0] = real_*rhs.real_ - imag_*rhs.imag_; // cache the real part of the result
-			imag_ = real_*rhs.imag_ + imag_*rhs.real_;
-			real_ = temp_[0];
+			ProductInto(temp_[8], temp_[9], *this, rhs);
+			real_.swap(temp_[8]);
+			imag_.swap(temp_[9]);
 			return *this;
 		}
 		
@@ -591,12 +615,27 @@ namespace bertini {
 		complex& operator/=(const complex & rhs)
 		{
 			temp_[1].precision(DefaultPrecision());
+
+		#if MPFR_VERSION_MAJOR >= 4
+			temp_[8].precision(DefaultPrecision());
+			temp_[9].precision(DefaultPrecision());
+
+			// the denominator, and the numerators of the real and imaginary parts, by fused multiply-adds
+			mpfr_fmma(temp_[1].backend().data(), rhs.real_.backend().data(), rhs.real_.backend().data(), rhs.imag_.backend().data(), rhs.imag_.backend().data(), MPFR_RNDN);
+			mpfr_fmma(temp_[8].backend().data(), real_.backend().data(), rhs.real_.backend().data(), imag_.backend().data(), rhs.imag_.backend().data(), MPFR_RNDN);
+			mpfr_fmms(temp_[9].backend().data(), imag_.backend().data(), rhs.real_.backend().data(), real_.backend().data(), rhs.imag_.backend().data(), MPFR_RNDN);
+			mpfr_div(temp_[8].backend().data(), temp_[8].backend().data(), temp_[1].backend().data(), MPFR_RNDN);
+			mpfr_div(temp_[9].backend().data(), temp_[9].backend().data(), temp_[1].backend().data(), MPFR_RNDN);
+			real_.swap(temp_[8]);
+			imag_.swap(temp_[9]);
+		#else
 			temp_[2].precision(DefaultPrecision());
 
 			temp_[1] = rhs.abs2(); // cache the denomenator...
 			temp_[2] = real_*rhs.real_ + imag_*rhs.imag_; // cache the numerator of the real part of the result
 			imag_ = (imag_*rhs.real_ - real_*rhs.imag_)/temp_[1];
 			real_ = temp_[2]/temp_[1];
+		#endif
 			
 			return *this;
 		}
@@ -657,7 +696,13 @@ namespace bertini {
 		 */
 		mpfr_float abs2() const
 		{
+		#if MPFR_VERSION_MAJOR >= 4
+			mpfr_float result;
+			mpfr_fmma(result.backend().data(), real_.backend().data(), real_.backend().data(), imag_.backend().data(), imag_.backend().data(), MPFR_RNDN);
+			return result;
+		#else
 			return real()*real()+imag()*imag();
+		#endif
 		}
 		
 		/**
@@ -870,6 +915,15 @@ namespace bertini {
 		friend complex inverse(const complex & z);
 
 		friend complex exp(const complex & z);
+		friend void SinCos(const complex & z, complex & s, complex & c);
+
+		friend void MultiplyAdd(complex & result, const complex & a, const complex & b);
+		friend void FusedMultiplyAdd(complex & result, const complex & a, const complex & b, const complex & c);
+		friend void MultiplySubtract(complex & result, const complex & a, const complex & b);
+		friend void Negate(complex & z);
+
+		friend void SetAtPrecision(complex & target, const complex & source, unsigned prec);
+		friend void SetAtPrecision(complex & target, const std::complex<double> & source, unsigned prec);
 	}; // end declaration of the bertini::complex number class
 	
 	
@@ -1247,6 +1301,54 @@ namespace bertini {
 	
 	
 	
+	/**
+	 \brief Accumulate a product into a complex number, result += a*b, without a temporary complex.
+
+	 The product is rounded once per part, and result may be a or b.
+	 */
+	inline void MultiplyAdd(complex & result, const complex & a, const complex & b)
+	{
+		complex::ProductInto(complex::temp_[8], complex::temp_[9], a, b);
+		result.real_ += complex::temp_[8];
+		result.imag_ += complex::temp_[9];
+	}
+
+	/**
+	 \brief Compute result = a*b + c, without a temporary complex.
+
+	 The product is rounded once per part, and result may be any of a, b, or c.
+	 */
+	inline void FusedMultiplyAdd(complex & result, const complex & a, const complex & b, const complex & c)
+	{
+		complex::ProductInto(complex::temp_[8], complex::temp_[9], a, b);
+		complex::temp_[8] += c.real_;
+		complex::temp_[9] += c.imag_;
+		result.real_.swap(complex::temp_[8]);
+		result.imag_.swap(complex::temp_[9]);
+	}
+
+	/**
+	 \brief Deduct a product from a complex number, result -= a*b, without a temporary complex.
+
+	 This is the update of elimination and substitution.  The product is rounded once per part, and result may be a or b.
+	 */
+	inline void MultiplySubtract(complex & result, const complex & a, const complex & b)
+	{
+		complex::ProductInto(complex::temp_[8], complex::temp_[9], a, b);
+		result.real_ -= complex::temp_[8];
+		result.imag_ -= complex::temp_[9];
+	}
+
+	/**
+	 \brief Negate a complex number in place, flipping the signs of its parts.
+	 */
+	inline void Negate(complex & z)
+	{
+		z.real_.backend().negate();
+		z.imag_.backend().negate();
+	}
+
+
 	/**
 	 Compute the inverse of a complex number
 	 */
@@ -1345,21 +1447,53 @@ namespace bertini {
 	
 	
 	/**
-	 Compute e^z for complex z.
+	 Compute e^z for complex z, from one joint sine and cosine of its imaginary part.
 	 */
 	inline complex exp(const complex & z)
 	{
-		complex::temp_[7].precision(DefaultPrecision());
+		for (int ii = 5; ii < 8; ++ii)
+			complex::temp_[ii].precision(DefaultPrecision());
 		complex::temp_[7] = exp(real(z));
-		return complex(complex::temp_[7] * cos(imag(z)), complex::temp_[7] * sin(imag(z)));
+		mpfr_sin_cos(complex::temp_[5].backend().data(), complex::temp_[6].backend().data(), z.imag_.backend().data(), MPFR_RNDN);
+		return complex(complex::temp_[7] * complex::temp_[6], complex::temp_[7] * complex::temp_[5]);
 	}
-	
+
+	/**
+	 Compute the sine and cosine of a complex number together.
+
+	 With z = a+bi, sin(z) = sin(a)cosh(b) + i cos(a)sinh(b), and cos(z) = cos(a)cosh(b) - i sin(a)sinh(b), so both come from one mpfr_sin_cos of the real part and one mpfr_sinh_cosh of the imaginary part, where separately each took two complex exponentials.  The results are rounded to the precisions of s and c, and z may be either of them.
+	 */
+	inline void SinCos(const complex & z, complex & s, complex & c)
+	{
+		for (int ii = 0; ii < 4; ++ii)
+			complex::temp_[ii].precision(DefaultPrecision());
+
+		mpfr_sin_cos(complex::temp_[0].backend().data(), complex::temp_[1].backend().data(), z.real_.backend().data(), MPFR_RNDN);
+		mpfr_sinh_cosh(complex::temp_[2].backend().data(), complex::temp_[3].backend().data(), z.imag_.backend().data(), MPFR_RNDN);
+
+		mpfr_mul(s.real_.backend().data(), complex::temp_[0].backend().data(), complex::temp_[3].backend().data(), MPFR_RNDN);
+		mpfr_mul(s.imag_.backend().data(), complex::temp_[1].backend().data(), complex::temp_[2].backend().data(), MPFR_RNDN);
+		mpfr_mul(c.real_.backend().data(), complex::temp_[1].backend().data(), complex::temp_[3].backend().data(), MPFR_RNDN);
+		mpfr_mul(c.imag_.backend().data(), complex::temp_[0].backend().data(), complex::temp_[2].backend().data(), MPFR_RNDN);
+		mpfr_neg(c.imag_.backend().data(), c.imag_.backend().data(), MPFR_RNDN);
+	}
+
+	/**
+	 Compute the sine and cosine of a real number together, with one mpfr_sin_cos.  The results are rounded to the precisions of s and c.
+	 */
+	inline void SinCos(const mpfr_float & x, mpfr_float & s, mpfr_float & c)
+	{
+		mpfr_sin_cos(s.backend().data(), c.backend().data(), x.backend().data(), MPFR_RNDN);
+	}
+
 	/**
 	 Compute sine of a complex number
 	 */
 	inline complex sin(const complex & z)
 	{
-		return (exp(complex::i()*z) - exp(-complex::i()*z)) / complex::i() / 2;
+		complex s, c;
+		SinCos(z, s, c);
+		return s;
 	}
 	
 	/**
@@ -1367,7 +1501,9 @@ namespace bertini {
 	 */
 	inline complex cos(const complex & z)
 	{
-		return (exp(complex::i()*z) + exp(-complex::i()*z))  / 2;
+		complex s, c;
+		SinCos(z, s, c);
+		return c;
 	}
 	
 	/**
@@ -1512,6 +1648,41 @@ namespace bertini {
 		num.precision(prec);
 	}
 
+
+	/**
+	\brief Set a number to a value rounded to a precision, in place.
+
+	The limbs of target are reused.  MPFR keeps the allocation of a number when its precision drops, so moving a number between precisions no higher than it has had before allocates nothing; building a temporary and assigning it, as in target = mpfr(source), allocates and frees every time.
+
+	target may be source, in which case it is only rounded.
+	*/
+	inline void SetAtPrecision(mpfr_float & target, const mpfr_float & source, unsigned prec)
+	{
+		target.precision(prec);
+		if (&target != &source)
+			mpfr_set(target.backend().data(), source.backend().data(), MPFR_RNDN);
+	}
+
+	/**
+	\brief Set a complex number to a value rounded to a precision, in place, reusing its limbs.  See SetAtPrecision for mpfr_float.
+	*/
+	inline void SetAtPrecision(complex & target, const complex & source, unsigned prec)
+	{
+		SetAtPrecision(target.real_, source.real_, prec);
+		SetAtPrecision(target.imag_, source.imag_, prec);
+	}
+
+	/**
+	\brief Set a complex number to a double-precision value, at a precision, in place, reusing its limbs.  See SetAtPrecision for mpfr_float.
+	*/
+	inline void SetAtPrecision(complex & target, const std::complex<double> & source, unsigned prec)
+	{
+		target.real_.precision(prec);
+		target.imag_.precision(prec);
+		mpfr_set_d(target.real_.backend().data(), source.real(), MPFR_RNDN);
+		mpfr_set_d(target.imag_.backend().data(), source.imag(), MPFR_RNDN);
+	}
+
 	inline 
 	bool isnan(bertini::complex const& num)
 	{
@@ -34,6 +34,7 @@ Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and
 #define BERTINI_MPFR_EXTENSIONS_HPP
 
 #include "bertini2/config.h"
+#include "bertini2/random.hpp"
 
 #include <boost/multiprecision/mpfr.hpp>
 #include <boost/multiprecision/random.hpp>
@@ -90,6 +91,24 @@ namespace bertini{
 	{
 		num.precision(prec);
 	}
+
+	/**
+	\brief Convert a number of decimal digits to a number of bits, as Boost.Multiprecision does for mpfr_float.
+	*/
+	constexpr
+	unsigned DigitsToBits(unsigned digits)
+	{
+		return digits ? 1 + digits*1000/301 : 0;
+	}
+
+	/**
+	\brief Convert a number of bits to the number of decimal digits they carry, as Boost.Multiprecision does for mpfr_float.
+	*/
+	constexpr
+	unsigned BitsToDigits(unsigned bits)
+	{
+		return bits*301/1000;
+	}
 }
 
 // the following code block extends serialization to the mpfr_float class from boost::multiprecision
@@ -191,6 +210,36 @@ using boost::multiprecision::max; //3 options: ./configure --disable-expression_
 
 namespace bertini
 {
+	/**
+	 \brief Set an existing mpfr_float to a random number in [0,1), to a given precision, from the given stream.
+
+	 The significand is as many draws as it takes, so any precision costs no more than its bits.
+	 */
+	void RandomMp(mpfr_float & a, unsigned num_digits, RandomStream & stream);
+
+	/**
+	 \brief Set an existing mpfr_float to a random number in [0,1), to a given precision, from the stream of the calling thread.
+
+	 This function is how to get random numbers at a precision different from the current default.
+	 */
+	void RandomMp(mpfr_float & a, unsigned num_digits);
+
+	/**
+	 \brief create a random number in [0,1), at the current default precision
+	 */
+	mpfr_float RandomMp();
+
+	/**
+	 \brief create a random number in a given interval, at the current default precision
+	*/
+	mpfr_float RandomMp(const mpfr_float & a, const mpfr_float & b);
+
+	/**
+	 \brief A random integer, uniform between -2^num_bits and 2^num_bits inclusive, from the stream of the calling thread.
+	 */
+	mpz_int RandomIntOfBits(unsigned long num_bits);
+
+
 	/**
 	Generate a random integer number between -10^digits and 10^digits
 	*/
@@ -198,10 +247,7 @@ namespace bertini
 	inline
 	mpz_int RandomInt()
 	{
-		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
-	    return ui(mt);
+		return RandomIntOfBits(digits*1000L/301L);
 	}
 	
 	
@@ -211,10 +257,8 @@ namespace bertini
 	template <unsigned long digits = 50>
 	mpq_rational RandomRat()
 	{
-   		using namespace boost::random;
-   		static mt19937 mt;
-	    static uniform_int_distribution<mpz_int> ui(-(mpz_int(1) << digits*1000L/301L), mpz_int(1) << digits*1000L/301L);
-	    return mpq_rational(ui(mt),ui(mt));
+		const mpz_int numerator = RandomIntOfBits(digits*1000L/301L);
+		return mpq_rational(numerator, RandomIntOfBits(digits*1000L/301L));
 	}
 
 
@@ -225,15 +269,10 @@ namespace bertini
 	 */
 	template <unsigned int length_in_digits>
 	mpfr_float RandomMp()
-	{	
-
-		using namespace boost::multiprecision;
-   		using namespace boost::random;
-
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
-
-		return ur(gen);
+	{
+		mpfr_float a;
+		RandomMp(a, length_in_digits);
+		return a;
 	}
 	
 	/**
@@ -243,15 +282,8 @@ namespace bertini
 	 */
 	template <unsigned int length_in_digits>
 	void RandomMp(mpfr_float & a)
-	{	
-
-		using namespace boost::multiprecision;
-   		using namespace boost::random;
-
-   		static uniform_real_distribution<boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<length_in_digits>, boost::multiprecision::et_off> > ur(0,1);
-   		static independent_bits_engine<mt19937, length_in_digits*1000L/301L, mpz_int> gen;
-
-		a = ur(gen);
+	{
+		RandomMp(a, length_in_digits);
 	}
 
 	/**
@@ -268,29 +300,6 @@ namespace bertini
 		return (b-a)*RandomMp<length_in_digits>()+a;
 	}
 
-
-
-	/**
-	 \brief create a random number, at the current default precision
-	 */
-	mpfr_float RandomMp();
-
-	/**
-	 \brief create a random number in a given interval, at the current default precision
-	*/
-	mpfr_float RandomMp(const mpfr_float & a, const mpfr_float & b);
-
-
-
-	/**
-	 \brief Set an existing mpfr_float to a random number, to a given precision.  
-
-	 This function is how to get random numbers at a precision different from the current default.
-	 */
-	void RandomMp(mpfr_float & a, unsigned num_digits);
-
-	
-
 	
 } // re: namespace bertini
 
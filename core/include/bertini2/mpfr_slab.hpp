@@ -0,0 +1,614 @@
+//This file is part of Bertini 2.
+//
+//mpfr_slab.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mpfr_slab.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mpfr_slab.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file mpfr_slab.hpp
+
+\brief Multiple precision complex vectors and matrices with the limbs of all their entries in one contiguous slab, and kernels on them.
+
+Each entry of a Vec<mpfr> owns the limbs of its two parts, allocated separately, so a vector of length 200 is 400 allocations scattered over the heap, and a norm, a dot product, or a copy chases a pointer for every part.  A slab::Vector or slab::Matrix holds the parts of all its entries as MPFR numbers set up through MPFR's custom interface, pointing into one array of limbs, all at the precision of the container.  Making one is two allocations, whatever its size, and its entries are next to each other in memory.
+
+The kernels, Axpy, Dot, the norms, and MatVec, work on the parts in place, with the fused operations of MPFR, so allocate nothing once the scratch of the calling thread is as large as they need.  Results are rounded to the precision of the destination, as MPFR does.
+
+The rest of bertini works on Vec<mpfr>, so Assign and CopyTo move values between the two.  Neither allocates when the sizes already agree.
+*/
+
+#ifndef BERTINI_MPFR_SLAB_HPP
+#define BERTINI_MPFR_SLAB_HPP
+
+#include "bertini2/eigen_extensions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace bertini {
+namespace slab {
+
+	namespace detail {
+
+		inline mpfr_prec_t Bits(unsigned digits)
+		{
+			return std::max<mpfr_prec_t>(DigitsToBits(digits), MPFR_PREC_MIN);
+		}
+
+
+		/**
+		\brief The parts of a number of complex numbers, real and imaginary interleaved, as MPFR numbers with their limbs in one slab.
+
+		Copying copies the limbs, and points the parts of the copy at its own.  Moving moves the slab, which stays where it is in memory, so the parts need no fixing.
+		*/
+		class Storage
+		{
+		public:
+
+			Storage() = default;
+
+			Storage(std::size_t count, mpfr_prec_t bits)
+			{
+				Resize(count, bits);
+			}
+
+			Storage(Storage const& other) : bits_(other.bits_), limbs_per_part_(other.limbs_per_part_), limbs_(other.limbs_), parts_(other.parts_)
+			{
+				Rebind();
+			}
+
+			Storage& operator=(Storage const& other)
+			{
+				if (this==&other)
+					return *this;
+
+				bits_ = other.bits_;
+				limbs_per_part_ = other.limbs_per_part_;
+				limbs_ = other.limbs_;
+				parts_ = other.parts_;
+				Rebind();
+				return *this;
+			}
+
+			Storage(Storage &&) = default;
+			Storage& operator=(Storage &&) = default;
+
+			/**
+			\brief Make room for count complex numbers, at a precision in bits.  The values are kept only if neither changes, and are zero otherwise.
+			*/
+			void Resize(std::size_t count, mpfr_prec_t bits)
+			{
+				if (count==Count() && bits==bits_)
+					return;
+
+				bits_ = bits;
+				limbs_per_part_ = (mpfr_custom_get_size(bits) + sizeof(mp_limb_t) - 1)/sizeof(mp_limb_t);
+				limbs_.assign(2*count*limbs_per_part_, 0);
+				parts_.resize(2*count);
+				for (std::size_t ii = 0; ii < parts_.size(); ++ii)
+				{
+					mp_limb_t* limbs = limbs_.data() + ii*limbs_per_part_;
+					mpfr_custom_init(limbs, bits);
+					mpfr_custom_init_set(&parts_[ii], MPFR_ZERO_KIND, 0, bits, limbs);
+				}
+			}
+
+			void SetZero()
+			{
+				for (auto& iter : parts_)
+					mpfr_set_zero(&iter, 1);
+			}
+
+			std::size_t Count() const
+			{
+				return parts_.size()/2;
+			}
+
+			mpfr_prec_t Bits() const
+			{
+				return bits_;
+			}
+
+			__mpfr_struct* Parts()
+			{
+				return parts_.data();
+			}
+
+			__mpfr_struct const* Parts() const
+			{
+				return parts_.data();
+			}
+
+		private:
+
+			// point the parts at this object's limbs, after copying both
+			void Rebind()
+			{
+				for (std::size_t ii = 0; ii < parts_.size(); ++ii)
+					mpfr_custom_move(&parts_[ii], limbs_.data() + ii*limbs_per_part_);
+			}
+
+			mpfr_prec_t bits_ = MPFR_PREC_MIN;
+			std::size_t limbs_per_part_ = 0;
+			std::vector<mp_limb_t> limbs_;
+			std::vector<__mpfr_struct> parts_;
+		};
+
+
+		/**
+		\brief Real scratch numbers at a precision, on the calling thread, kept between calls so that the kernels do not allocate.
+		*/
+		inline mpfr_ptr Scratch(std::size_t count, mpfr_prec_t bits)
+		{
+			thread_local Storage scratch;
+			if (scratch.Count() < count || scratch.Bits()!=bits)
+				scratch.Resize(std::max(count, scratch.Count()), bits);
+			return scratch.Parts();
+		}
+	} // namespace detail
+
+
+
+	/**
+	\brief The entries of a slab vector, or a column of a slab matrix, to be written by a kernel.
+	*/
+	struct VectorView
+	{
+		__mpfr_struct* parts;
+		std::size_t size;
+
+		mpfr_ptr real_data(std::size_t ii) const {return parts + 2*ii;}
+		mpfr_ptr imag_data(std::size_t ii) const {return parts + 2*ii + 1;}
+	};
+
+	/**
+	\brief The entries of a slab vector, or a column of a slab matrix, to be read by a kernel.
+	*/
+	struct ConstVectorView
+	{
+		__mpfr_struct const* parts;
+		std::size_t size;
+
+		ConstVectorView(__mpfr_struct const* p, std::size_t s) : parts(p), size(s) {}
+		ConstVectorView(VectorView const& v) : parts(v.parts), size(v.size) {}
+
+		mpfr_srcptr real_data(std::size_t ii) const {return parts + 2*ii;}
+		mpfr_srcptr imag_data(std::size_t ii) const {return parts + 2*ii + 1;}
+	};
+
+
+
+	/**
+	\brief A multiple precision complex vector with the limbs of all its entries in one slab.
+
+	All entries are at the precision of the vector, in digits.  Changing the size or the precision zeroes the entries.
+	*/
+	class Vector
+	{
+	public:
+
+		Vector() : digits_(DefaultPrecision())
+		{}
+
+		/**
+		\brief Zero, of a size, at a precision in digits.
+		*/
+		explicit Vector(std::size_t size, unsigned digits = DefaultPrecision()) : digits_(digits), storage_(size, detail::Bits(digits))
+		{}
+
+		std::size_t size() const
+		{
+			return storage_.Count();
+		}
+
+		/**
+		\brief The precision of the entries, in digits.
+		*/
+		unsigned precision() const
+		{
+			return digits_;
+		}
+
+		/**
+		\brief Change the size and precision.  The entries are kept if neither changes, and are zero otherwise.
+		*/
+		void Resize(std::size_t size, unsigned digits)
+		{
+			digits_ = digits;
+			storage_.Resize(size, detail::Bits(digits));
+		}
+
+		void SetZero()
+		{
+			storage_.SetZero();
+		}
+
+		mpfr_ptr real_data(std::size_t ii) {return storage_.Parts() + 2*ii;}
+		mpfr_ptr imag_data(std::size_t ii) {return storage_.Parts() + 2*ii + 1;}
+		mpfr_srcptr real_data(std::size_t ii) const {return storage_.Parts() + 2*ii;}
+		mpfr_srcptr imag_data(std::size_t ii) const {return storage_.Parts() + 2*ii + 1;}
+
+		/**
+		\brief The entry at an index, as a bertini::complex at the precision of the vector.  Allocates, so is for inspection, not kernels.
+		*/
+		complex operator()(std::size_t ii) const
+		{
+			complex z;
+			z.precision(digits_);
+			mpfr_set(z.real_data(), real_data(ii), MPFR_RNDN);
+			mpfr_set(z.imag_data(), imag_data(ii), MPFR_RNDN);
+			return z;
+		}
+
+		/**
+		\brief Take the values of a vector of bertini::complex, rounded to the precision of this one, resizing to it if need be.
+		*/
+		template<typename Derived>
+		void Assign(Eigen::MatrixBase<Derived> const& x)
+		{
+			static_assert(std::is_same<typename Derived::Scalar, complex>::value, "a slab vector takes the values of a vector of bertini::complex");
+
+			if (static_cast<std::size_t>(x.size())!=size())
+				Resize(x.size(), digits_);
+			for (Eigen::DenseIndex ii = 0; ii < x.size(); ++ii)
+			{
+				mpfr_set(real_data(ii), x(ii).real_data(), MPFR_RNDN);
+				mpfr_set(imag_data(ii), x(ii).imag_data(), MPFR_RNDN);
+			}
+		}
+
+		operator VectorView()
+		{
+			return VectorView{storage_.Parts(), size()};
+		}
+
+		operator ConstVectorView() const
+		{
+			return ConstVectorView(storage_.Parts(), size());
+		}
+
+	private:
+
+		unsigned digits_;
+		detail::Storage storage_;
+	};
+
+
+
+	/**
+	\brief A multiple precision complex matrix with the limbs of all its entries in one slab, stored by columns.
+
+	All entries are at the precision of the matrix, in digits.  Changing the size or the precision zeroes the entries.
+	*/
+	class Matrix
+	{
+	public:
+
+		Matrix() : digits_(DefaultPrecision())
+		{}
+
+		/**
+		\brief Zero, of a size, at a precision in digits.
+		*/
+		Matrix(std::size_t rows, std::size_t cols, unsigned digits = DefaultPrecision()) : rows_(rows), cols_(cols), digits_(digits), storage_(rows*cols, detail::Bits(digits))
+		{}
+
+		std::size_t rows() const {return rows_;}
+		std::size_t cols() const {return cols_;}
+
+		/**
+		\brief The precision of the entries, in digits.
+		*/
+		unsigned precision() const
+		{
+			return digits_;
+		}
+
+		/**
+		\brief Change the size and precision.  The entries are kept if neither changes, and are zero otherwise.
+		*/
+		void Resize(std::size_t rows, std::size_t cols, unsigned digits)
+		{
+			rows_ = rows;
+			cols_ = cols;
+			digits_ = digits;
+			storage_.Resize(rows*cols, detail::Bits(digits));
+		}
+
+		void SetZero()
+		{
+			storage_.SetZero();
+		}
+
+		VectorView Col(std::size_t jj)
+		{
+			return VectorView{storage_.Parts() + 2*jj*rows_, rows_};
+		}
+
+		ConstVectorView Col(std::size_t jj) const
+		{
+			return ConstVectorView(storage_.Parts() + 2*jj*rows_, rows_);
+		}
+
+		/**
+		\brief Take the values of a matrix of bertini::complex, rounded to the precision of this one, resizing to it if need be.
+		*/
+		template<typename Derived>
+		void Assign(Eigen::MatrixBase<Derived> const& A)
+		{
+			static_assert(std::is_same<typename Derived::Scalar, complex>::value, "a slab matrix takes the values of a matrix of bertini::complex");
+
+			if (static_cast<std::size_t>(A.rows())!=rows_ || static_cast<std::size_t>(A.cols())!=cols_)
+				Resize(A.rows(), A.cols(), digits_);
+			for (Eigen::DenseIndex jj = 0; jj < A.cols(); ++jj)
+			{
+				auto col = Col(jj);
+				for (Eigen::DenseIndex ii = 0; ii < A.rows(); ++ii)
+				{
+					mpfr_set(col.real_data(ii), A(ii,jj).real_data(), MPFR_RNDN);
+					mpfr_set(col.imag_data(ii), A(ii,jj).imag_data(), MPFR_RNDN);
+				}
+			}
+		}
+
+	private:
+
+		std::size_t rows_ = 0, cols_ = 0;
+		unsigned digits_;
+		detail::Storage storage_;
+	};
+
+
+
+	/**
+	\brief Take the values of a vector of bertini::complex into a view of the same size, rounded to its precision.
+
+	\throws std::runtime_error if the sizes differ.
+	*/
+	template<typename Derived>
+	void Assign(VectorView y, Eigen::MatrixBase<Derived> const& x)
+	{
+		static_assert(std::is_same<typename Derived::Scalar, complex>::value, "a slab vector takes the values of a vector of bertini::complex");
+
+		if (static_cast<std::size_t>(x.size())!=y.size)
+			throw std::runtime_error("assigning a vector of size " + std::to_string(x.size()) + " to a slab vector of size " + std::to_string(y.size));
+		for (Eigen::DenseIndex ii = 0; ii < x.size(); ++ii)
+		{
+			mpfr_set(y.real_data(ii), x(ii).real_data(), MPFR_RNDN);
+			mpfr_set(y.imag_data(ii), x(ii).imag_data(), MPFR_RNDN);
+		}
+	}
+
+	/**
+	\brief Copy the values of a slab vector into a vector of bertini::complex, resizing it if need be.  Its entries keep their precisions, so a vector already at the precision of the slab does not allocate.
+	*/
+	inline void CopyTo(Vec<complex> & y, ConstVectorView x)
+	{
+		if (static_cast<std::size_t>(y.size())!=x.size)
+			y.resize(x.size);
+		for (std::size_t ii = 0; ii < x.size; ++ii)
+		{
+			mpfr_set(y(ii).real_data(), x.real_data(ii), MPFR_RNDN);
+			mpfr_set(y(ii).imag_data(), x.imag_data(ii), MPFR_RNDN);
+		}
+	}
+
+	/**
+	\brief y = x, rounded to the precision of y.
+
+	\throws std::runtime_error if the sizes differ.
+	*/
+	inline void Copy(VectorView y, ConstVectorView x)
+	{
+		if (x.size!=y.size)
+			throw std::runtime_error("copying a slab vector of size " + std::to_string(x.size) + " to one of size " + std::to_string(y.size));
+		for (std::size_t ii = 0; ii < 2*x.size; ++ii)
+			mpfr_set(y.parts + ii, x.parts + ii, MPFR_RNDN);
+	}
+
+
+
+	namespace detail {
+
+		// y += (a_re + i a_im) x, by four fused multiply-adds per entry
+		inline void Axpy(VectorView y, mpfr_srcptr a_re, mpfr_srcptr a_im, ConstVectorView x)
+		{
+			if (x.size!=y.size)
+				throw std::runtime_error("slab axpy of vectors of sizes " + std::to_string(x.size) + " and " + std::to_string(y.size));
+			if (y.size==0)
+				return;
+
+			mpfr_ptr minus_a_im = Scratch(1, mpfr_get_prec(a_im));
+			mpfr_neg(minus_a_im, a_im, MPFR_RNDN);
+
+			for (std::size_t ii = 0; ii < y.size; ++ii)
+			{
+				mpfr_fma(y.real_data(ii), a_re, x.real_data(ii), y.real_data(ii), MPFR_RNDN);
+				mpfr_fma(y.real_data(ii), minus_a_im, x.imag_data(ii), y.real_data(ii), MPFR_RNDN);
+				mpfr_fma(y.imag_data(ii), a_re, x.imag_data(ii), y.imag_data(ii), MPFR_RNDN);
+				mpfr_fma(y.imag_data(ii), a_im, x.real_data(ii), y.imag_data(ii), MPFR_RNDN);
+			}
+		}
+	}
+
+	/**
+	\brief y += a x, for a real scalar.
+
+	\throws std::runtime_error if the sizes differ.
+	*/
+	inline void Axpy(VectorView y, mpfr_float const& a, ConstVectorView x)
+	{
+		if (x.size!=y.size)
+			throw std::runtime_error("slab axpy of vectors of sizes " + std::to_string(x.size) + " and " + std::to_string(y.size));
+
+		for (std::size_t ii = 0; ii < y.size; ++ii)
+		{
+			mpfr_fma(y.real_data(ii), a.backend().data(), x.real_data(ii), y.real_data(ii), MPFR_RNDN);
+			mpfr_fma(y.imag_data(ii), a.backend().data(), x.imag_data(ii), y.imag_data(ii), MPFR_RNDN);
+		}
+	}
+
+	/**
+	\brief y += a x, for a complex scalar.
+
+	\throws std::runtime_error if the sizes differ.
+	*/
+	inline void Axpy(VectorView y, complex const& a, ConstVectorView x)
+	{
+		detail::Axpy(y, a.real_data(), a.imag_data(), x);
+	}
+
+	/**
+	\brief The Hermitian product \f$x^H y\f$, at the precision of x.
+
+	\throws std::runtime_error if the sizes differ.
+	*/
+	inline complex Dot(ConstVectorView x, ConstVectorView y)
+	{
+		if (x.size!=y.size)
+			throw std::runtime_error("slab dot product of vectors of sizes " + std::to_string(x.size) + " and " + std::to_string(y.size));
+
+		complex result;
+		if (x.size==0)
+			return result;
+
+		mpfr_set_prec(result.real_data(), mpfr_get_prec(x.real_data(0)));
+		mpfr_set_prec(result.imag_data(), mpfr_get_prec(x.real_data(0)));
+		mpfr_set_zero(result.real_data(), 1);
+		mpfr_set_zero(result.imag_data(), 1);
+
+		mpfr_ptr re = result.real_data(), im = result.imag_data();
+		for (std::size_t ii = 0; ii < x.size; ++ii)
+		{
+			// re += x_re y_re + x_im y_im, im += x_re y_im - x_im y_re
+			mpfr_fma(re, x.real_data(ii), y.real_data(ii), re, MPFR_RNDN);
+			mpfr_fma(re, x.imag_data(ii), y.imag_data(ii), re, MPFR_RNDN);
+			mpfr_fms(im, x.imag_data(ii), y.real_data(ii), im, MPFR_RNDN);
+			mpfr_neg(im, im, MPFR_RNDN);
+			mpfr_fma(im, x.real_data(ii), y.imag_data(ii), im, MPFR_RNDN);
+		}
+		return result;
+	}
+
+	namespace detail {
+
+		// zero out, at the precision of x, changing its precision only if it differs
+		inline mpfr_ptr ZeroAtPrecisionOf(mpfr_float & out, ConstVectorView x)
+		{
+			mpfr_ptr result = out.backend().data();
+			if (x.size > 0 && mpfr_get_prec(result)!=mpfr_get_prec(x.real_data(0)))
+				mpfr_set_prec(result, mpfr_get_prec(x.real_data(0)));
+			mpfr_set_zero(result, 1);
+			return result;
+		}
+	}
+
+	/**
+	\brief out = the square of the 2-norm, at the precision of x.  Allocates nothing if out is already at that precision.
+	*/
+	inline void SquaredNorm(mpfr_float & out, ConstVectorView x)
+	{
+		mpfr_ptr result = detail::ZeroAtPrecisionOf(out, x);
+		for (std::size_t ii = 0; ii < 2*x.size; ++ii)
+			mpfr_fma(result, x.parts + ii, x.parts + ii, result, MPFR_RNDN);
+	}
+
+	/**
+	\brief The square of the 2-norm, at the precision of x.
+	*/
+	inline mpfr_float SquaredNorm(ConstVectorView x)
+	{
+		mpfr_float result(0);
+		SquaredNorm(result, x);
+		return result;
+	}
+
+	/**
+	\brief out = the 2-norm, at the precision of x.  Allocates nothing if out is already at that precision.
+	*/
+	inline void Norm(mpfr_float & out, ConstVectorView x)
+	{
+		SquaredNorm(out, x);
+		mpfr_sqrt(out.backend().data(), out.backend().data(), MPFR_RNDN);
+	}
+
+	/**
+	\brief The 2-norm, at the precision of x.
+	*/
+	inline mpfr_float Norm(ConstVectorView x)
+	{
+		mpfr_float result(0);
+		Norm(result, x);
+		return result;
+	}
+
+	/**
+	\brief out = the largest magnitude of an entry, at the precision of x.  Allocates nothing if out is already at that precision.
+	*/
+	inline void InfinityNorm(mpfr_float & out, ConstVectorView x)
+	{
+		mpfr_ptr result = detail::ZeroAtPrecisionOf(out, x);
+		if (x.size==0)
+			return;
+
+		mpfr_ptr magnitude = detail::Scratch(1, mpfr_get_prec(result));
+		for (std::size_t ii = 0; ii < x.size; ++ii)
+		{
+			mpfr_hypot(magnitude, x.real_data(ii), x.imag_data(ii), MPFR_RNDN);
+			if (mpfr_greater_p(magnitude, result))
+				mpfr_set(result, magnitude, MPFR_RNDN);
+		}
+	}
+
+	/**
+	\brief The largest magnitude of an entry, at the precision of x.
+	*/
+	inline mpfr_float InfinityNorm(ConstVectorView x)
+	{
+		mpfr_float result(0);
+		InfinityNorm(result, x);
+		return result;
+	}
+
+	/**
+	\brief y = A x, column by column.
+
+	\throws std::runtime_error if the sizes do not conform.
+	*/
+	inline void MatVec(VectorView y, Matrix const& A, ConstVectorView x)
+	{
+		if (A.cols()!=x.size || A.rows()!=y.size)
+			throw std::runtime_error("slab product of a " + std::to_string(A.rows()) + "x" + std::to_string(A.cols()) + " matrix and a vector of size " + std::to_string(x.size) + " into one of size " + std::to_string(y.size));
+
+		for (std::size_t ii = 0; ii < 2*y.size; ++ii)
+			mpfr_set_zero(y.parts + ii, 1);
+		for (std::size_t jj = 0; jj < x.size; ++jj)
+			detail::Axpy(y, x.real_data(jj), x.imag_data(jj), A.Col(jj));
+	}
+
+} // namespace slab
+} // namespace bertini
+
+
+#endif
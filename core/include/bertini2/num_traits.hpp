@@ -38,6 +38,7 @@ The bertini::NumTraits struct provides NumDigits and NumFuzzyDigits functions.
 #include <cmath>
 #include "bertini2/mpfr_complex.hpp"
 #include "bertini2/mpfr_extensions.hpp"
+#include "bertini2/double_double.hpp"
 
 
 
@@ -56,6 +57,49 @@ namespace bertini
 
 
 
+	/**
+	Single precision, used only for screening the easy steps of batch tracking, see BatchTracker::ScreenInSinglePrecision.
+	*/
+	template <> struct NumTraits<float> 
+	{
+		inline static unsigned NumDigits()
+		{
+			return 7;
+		}
+
+		inline static unsigned NumFuzzyDigits()
+		{
+			return 6;
+		}
+
+		inline
+		static unsigned TolToDigits(double tol)
+		{
+			return ceil(-log10(tol));
+		}
+
+		inline static 
+		float FromString(std::string const& s)
+		{
+			return boost::lexical_cast<float>(s);
+		}
+	};
+
+
+	template <> struct NumTraits<std::complex<float> > 
+	{
+		inline static unsigned NumDigits()
+		{
+			return 7;
+		}
+
+		inline static unsigned NumFuzzyDigits()
+		{
+			return 6;
+		}
+	};
+
+
 	template <> struct NumTraits<double> 
 	{
 		inline static unsigned NumDigits()
@@ -182,23 +226,59 @@ namespace bertini
 		}
 	}
 
+	/**
+	\brief Accumulate a product into a number, result += a*b.
+
+	The double precision counterpart of the multiple precision kernel in mpfr_complex.hpp.
+	*/
+	inline
+	void MultiplyAdd(std::complex<double> & result, const std::complex<double> & a, const std::complex<double> & b)
+	{
+		result += a*b;
+	}
+
+	/**
+	\brief Compute the sine and cosine of a number together, from one sine and cosine of its real part, and one hyperbolic sine and cosine of its imaginary part.
+
+	The double precision counterpart of the multiple precision kernel in mpfr_complex.hpp.
+	*/
+	inline
+	void SinCos(const std::complex<double> & z, std::complex<double> & s, std::complex<double> & c)
+	{
+		const double sa = std::sin(z.real()), ca = std::cos(z.real());
+		const double sb = std::sinh(z.imag()), cb = std::cosh(z.imag());
+		s = std::complex<double>(sa*cb, ca*sb);
+		c = std::complex<double>(ca*cb, -sa*sb);
+	}
+
+	/**
+	\brief The sine and cosine of a real number, for code templated on the number type.
+	*/
+	inline
+	void SinCos(double x, double & s, double & c)
+	{
+		s = std::sin(x);
+		c = std::cos(x);
+	}
+
 	inline
 	std::complex<double> rand_complex()
 	{
 		using std::abs;
 		using std::sqrt;
-		std::default_random_engine generator;
-		std::uniform_real_distribution<double> distribution(-1.0,1.0);
-		std::complex<double> returnme(distribution(generator), distribution(generator));
+		auto& stream = ThreadRandomStream();
+		std::complex<double> returnme(2*stream.UniformDouble()-1, 2*stream.UniformDouble()-1);
 		return returnme / sqrt( abs(returnme));
 	}
 
+	/**
+	A random complex number of modulus one, from the stream of the calling thread.
+	*/
 	template <> inline
 	std::complex<double> RandomUnit<std::complex<double> >()
 	{
-		std::default_random_engine generator;
-		std::uniform_real_distribution<double> distribution(-1.0,1.0);
-		std::complex<double> returnme(distribution(generator), distribution(generator));
+		auto& stream = ThreadRandomStream();
+		std::complex<double> returnme(2*stream.UniformDouble()-1, 2*stream.UniformDouble()-1);
 		return returnme / abs(returnme);
 	}
 
@@ -272,6 +352,58 @@ namespace bertini {
 			return bertini::complex(s,t);
 		}
 	};
+
+
+
+	template <> struct NumTraits<dd_real> 
+	{
+		inline static unsigned NumDigits()
+		{
+			return DoubleDoublePrecision();
+		}
+
+		inline static unsigned NumFuzzyDigits()
+		{
+			return DoubleDoublePrecision()-2;
+		}
+
+		inline static 
+		dd_real FromString(std::string const& s)
+		{
+			auto prev_precision = DefaultPrecision();
+			DefaultPrecision(DoubleDoublePrecision()+4);
+			dd_real x{mpfr_float(s)};
+			DefaultPrecision(prev_precision);
+			return x;
+		}
+	};
+
+
+
+	template <> struct NumTraits<dd_complex> 
+	{
+		inline static unsigned NumDigits()
+		{
+			return DoubleDoublePrecision();
+		}
+
+		inline static unsigned NumFuzzyDigits()
+		{
+			return DoubleDoublePrecision()-2;
+		}
+
+		inline static 
+		dd_complex FromString(std::string const& s)
+		{
+			return dd_complex(NumTraits<dd_real>::FromString(s));
+		}
+
+		inline static 
+		dd_complex FromString(std::string const& s, std::string const& t)
+		{
+			return dd_complex(NumTraits<dd_real>::FromString(s), NumTraits<dd_real>::FromString(t));
+		}
+	};
 }
 
 #endif
@@ -36,6 +36,7 @@
 #include "bertini2/mpfr_extensions.hpp"
 #include "bertini2/num_traits.hpp"
 #include "bertini2/eigen_extensions.hpp"
+#include "bertini2/memory_usage.hpp"
 
 #include <vector>
 
@@ -92,7 +93,7 @@ namespace bertini {
 
 		Makes an empty patch.
 		*/
-		Patch() : precision_(DefaultPrecision())
+		Patch() : precision_(DefaultPrecision()), coefficients_precision_(precision_)
 		{}
 
 
@@ -103,6 +104,7 @@ namespace bertini {
 		{	
 			variable_group_sizes_ = other.variable_group_sizes_;
 			precision_ = DefaultPrecision();
+			coefficients_precision_ = precision_;
 
 			// a little shorthand unpacking the tuple
 			std::vector<Vec<mpfr> >& coefficients_mpfr = std::get<std::vector<Vec<mpfr> > >(this->coefficients_working_);
@@ -144,7 +146,7 @@ namespace bertini {
 
 		\param sizes The sizes of the variable groups, including homogenizing variables if present.
 		*/
-		Patch(std::vector<unsigned> const& sizes) : variable_group_sizes_(sizes), coefficients_highest_precision_(sizes.size()), precision_(DefaultPrecision())
+		Patch(std::vector<unsigned> const& sizes) : variable_group_sizes_(sizes), coefficients_highest_precision_(sizes.size()), precision_(DefaultPrecision()), coefficients_precision_(precision_)
 		{
 			using bertini::Precision;
 			using bertini::RandomComplex;
@@ -237,31 +239,12 @@ namespace bertini {
 		/**
 		\brief Set the precision of the patch.
 	
-		Copies the patch coefficients into correct precision for subsequent precision.
+		The change is lazy: the coefficients are copied into the new precision the next time they are used in multiple precision, so that a sequence of precision changes, or a change followed only by work in double, costs nothing.
 
 		\param new_precision The precision to change to.
 		*/
 		void Precision(unsigned new_precision) const
 		{
-			using bertini::Precision;
-			std::vector<Vec<mpfr> >& coefficients_mpfr = std::get<std::vector<Vec<mpfr> > >(coefficients_working_);
-
-			for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
-			{
-				for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
-				{
-					if (new_precision>precision_)
-					{
-						coefficients_mpfr[ii](jj) = coefficients_highest_precision_[ii](jj);
-						coefficients_mpfr[ii](jj).precision(new_precision);
-					}
-					else
-						coefficients_mpfr[ii](jj).precision(new_precision);
-
-					assert(Precision(coefficients_mpfr[ii](jj))==new_precision);
-				}
-			}
-			
 			precision_ = new_precision;
 		}
 
@@ -293,7 +276,7 @@ namespace bertini {
 			#endif
 
 			// unpack from the tuple of working coefficients
-			const std::vector<Vec<T> >& coefficients = std::get<std::vector<Vec<T> > >(coefficients_working_);
+			const std::vector<Vec<T> >& coefficients = WorkingCoefficients<T>();
 
 			unsigned offset(function_values.size() - NumVariableGroups()); // by precondition this number is at least 0.  the precondition is ensured by the public wrapper
 			unsigned counter(0);
@@ -303,7 +286,7 @@ namespace bertini {
 				value = T(-1);
 				for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
 				{	
-					value += x(counter)*coefficients[ii](jj);
+					MultiplyAdd(value, x(counter), coefficients[ii](jj));
 					counter++;
 				}
 			}
@@ -348,7 +331,7 @@ namespace bertini {
 			       );
 			#endif
 			
-			const std::vector<Vec<T> >& coefficients = std::get<std::vector<Vec<T> > >(coefficients_working_);
+			const std::vector<Vec<T> >& coefficients = WorkingCoefficients<T>();
 
 			unsigned offset(jacobian.rows() - NumVariableGroups()); // by precondition this number is at least 0.  the precondition is ensured by the public wrapper
 			unsigned counter(0);
@@ -357,6 +340,59 @@ namespace bertini {
 					jacobian(ii+offset,counter++) = coefficients[ii](jj);
 		}
 
+
+		/**
+		\brief Evaluate the patch and its Jacobian at a point, in place, in one pass over the coefficients.
+
+		Each coefficient is read once, both copied into the Jacobian and accumulated into the value, with no temporaries in multiple precision.  The rows filled are the last NumVariableGroups() of each, as for EvalInPlace and JacobianInPlace.
+
+		\param function_values The vector to populate.  Must be at least as long as the number of variable groups.
+		\param jacobian Matrix to populate with the Jacobian.  Must have at least as many rows as variable groups, and as many columns as the patch has variables.
+		\param x Point at which to evaluate.
+		*/
+		template<typename Derived, typename DerivedJ, typename T>
+		void EvalAndJacobianInPlace(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<DerivedJ> & jacobian, Vec<T> const& x) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar,T>::value && std::is_same<typename DerivedJ::Scalar,T>::value,"scalar types must match");
+
+			#ifndef BERTINI_DISABLE_ASSERTS
+			assert(function_values.size()>=NumVariableGroups() && "function values must be of length at least as long as the number of variable groups");
+			assert(jacobian.rows()>=NumVariableGroups() && "input jacobian must have at least as many rows as variable groups");
+			assert(jacobian.cols()==NumVariables() && "input jacobian must have as many columns as the patch has variables");
+			#endif
+
+			const std::vector<Vec<T> >& coefficients = WorkingCoefficients<T>();
+
+			unsigned value_offset(function_values.size() - NumVariableGroups());
+			unsigned row_offset(jacobian.rows() - NumVariableGroups());
+			unsigned counter(0);
+			for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
+			{
+				T& value = function_values(ii+value_offset);
+				value = T(-1);
+				for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj, ++counter)
+				{
+					T const& c = coefficients[ii](jj);
+					jacobian(ii+row_offset,counter) = c;
+					MultiplyAdd(value, x(counter), c);
+				}
+			}
+		}
+
+
+		/**
+		\brief The working coefficients of a variable group, at the current precision of the patch.
+
+		They are the entries of the row of the Jacobian for the group, in the columns of its variables, so can be copied straight into a Jacobian stored otherwise than densely.  The multiple precision ones are brought to the current precision first, if a change is pending.
+
+		\param group The index of the variable group.
+		*/
+		template<typename T>
+		Vec<T> const& Coefficients(unsigned group) const
+		{
+			return WorkingCoefficients<T>()[group];
+		}
+
 		/**
 		\brief Evaluate the Jacobian matrix, in place.
 
@@ -392,7 +428,7 @@ namespace bertini {
 					   );
 			#endif
 
-			const std::vector<Vec<T> >& coefficients = std::get<std::vector<Vec<T> > >(coefficients_working_);
+			const std::vector<Vec<T> >& coefficients = WorkingCoefficients<T>();
 
 			unsigned starting_index_counter(0);
 			for (unsigned ii=0; ii<NumVariableGroups(); ii++)
@@ -429,6 +465,17 @@ namespace bertini {
 		}
 
 
+		/**
+		\brief Get the sizes of the variable groups.
+
+		\return The number of variables in each group, in the order of the groups.
+		*/
+		std::vector<unsigned> const& VariableGroupSizes() const
+		{
+			return variable_group_sizes_;
+		}
+
+
 		/**
 		\brief Get the number of variables in the patch.  
 		*/
@@ -441,6 +488,17 @@ namespace bertini {
 		}
 
 
+		/**
+		\brief The memory held by the coefficients of the patch, at the highest precision, and working in each number type.
+		*/
+		MemoryUsage MemoryReport() const
+		{
+			MemoryUsage report;
+			report.Add("coefficients", memory::HeapBytes(coefficients_highest_precision_) + memory::HeapBytes(coefficients_working_), 3*NumVariables());
+			return report;
+		}
+
+
 		friend std::ostream& operator<<(std::ostream & out, Patch const& p)
 		{
 			out << p.NumVariableGroups() << " variable groups being patched\n";
@@ -485,6 +543,44 @@ namespace bertini {
 
 	private:
 
+		/**
+		\brief Get the working coefficients in a number type, first bringing the multiple-precision ones to the current precision of the patch if a change is pending.
+		*/
+		template<typename T>
+		std::vector<Vec<T> > const& WorkingCoefficients() const
+		{
+			if (std::is_same<T,mpfr>::value && coefficients_precision_!=precision_)
+				AdjustCoefficientPrecision();
+			return std::get<std::vector<Vec<T> > >(coefficients_working_);
+		}
+
+		/**
+		\brief Copy the multiple-precision working coefficients into the current precision of the patch.
+		*/
+		void AdjustCoefficientPrecision() const
+		{
+			using bertini::Precision;
+			std::vector<Vec<mpfr> >& coefficients_mpfr = std::get<std::vector<Vec<mpfr> > >(coefficients_working_);
+
+			for (unsigned ii = 0; ii < NumVariableGroups(); ++ii)
+			{
+				for (unsigned jj=0; jj<variable_group_sizes_[ii]; ++jj)
+				{
+					if (precision_>coefficients_precision_)
+					{
+						coefficients_mpfr[ii](jj) = coefficients_highest_precision_[ii](jj);
+						coefficients_mpfr[ii](jj).precision(precision_);
+					}
+					else
+						coefficients_mpfr[ii](jj).precision(precision_);
+
+					assert(Precision(coefficients_mpfr[ii](jj))==precision_);
+				}
+			}
+			
+			coefficients_precision_ = precision_;
+		}
+
 		/////////////////
 		//
 		//    Data members
@@ -498,6 +594,7 @@ namespace bertini {
 		std::vector<unsigned> variable_group_sizes_; ///< the sizes of the groups.  In principle, these must be at least 2.
 
 		mutable unsigned precision_; ///< the current working precision of the patch.
+		mutable unsigned coefficients_precision_; ///< the precision of the multiple-precision working coefficients, which lags precision_ until they are next used.
 
 		// add serialization support through boost.
 
@@ -505,7 +602,10 @@ namespace bertini {
 
 		template <typename Archive>
 		void serialize(Archive& ar, const unsigned version) {
+			if (Archive::is_saving::value)
+				AdjustCoefficientPrecision();
 			ar & precision_;
+			coefficients_precision_ = precision_;
 
 			ar & coefficients_highest_precision_;
 
@@ -0,0 +1,123 @@
+//This file is part of Bertini 2.
+//
+//polyhedral.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polyhedral.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polyhedral.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file polyhedral.hpp
+
+\brief Mixed cells, binomial systems, and lifted homotopies, from which the Polyhedral start system is solved.
+
+A system whose functions have supports \f$S_1,\ldots,S_n \subset \mathbb{Z}^n\f$, the exponents of their monomials, and generic coefficients, has as many solutions with no zero coordinate as the mixed volume of the supports, which for sparse systems is far fewer than the total degree.  Lifting each point \f$a \in S_k\f$ to \f$(a, w_k(a))\f$ by a generic integer \f$w_k(a)\f$, the lower facets of the Minkowski sum of the lifted supports which are sums of one edge from each support are the mixed cells.  The mixed volume is the sum of their volumes, each the absolute determinant of its edges.
+
+Each mixed cell, with inner normal \f$(\alpha, 1)\f$, gives a binomial system, whose solutions start paths of the lifted homotopy
+
+\f[ h_k(y,s) = \sum_{a \in S_k} c_a \, y^a \, s^{\langle a,\alpha\rangle + w_k(a) - \beta_k}, \f]
+
+with \f$\beta_k\f$ the smallest exponent of \f$s\f$ before the shift, attained at the two points of the edge.  At \f$s=0\f$ only the edge remains, and at \f$s=1\f$ the homotopy is the system with coefficients \f$c_a\f$.  Over all the cells, the paths end at all its solutions.
+*/
+
+#ifndef BERTINI_POLYHEDRAL_HPP
+#define BERTINI_POLYHEDRAL_HPP
+
+#include <utility>
+#include <vector>
+
+#include "bertini2/num_traits.hpp"
+#include "bertini2/eigen_extensions.hpp"
+
+namespace bertini {
+	namespace start_system {
+		namespace polyhedral {
+
+			using Support = std::vector< std::vector<int> >; ///< The exponents of the monomials of a function.
+			using Lifting = std::vector<long>; ///< The lift of each point of a support.
+
+
+			/**
+			\brief A mixed cell of a lifted tuple of supports.
+			*/
+			struct MixedCell
+			{
+				std::vector< std::pair<size_t, size_t> > edges; ///< For each support, the indices of the two points of its edge in the cell.
+				std::vector<double> inner_normal; ///< The first coordinates \f$\alpha\f$ of the inner normal \f$(\alpha,1)\f$ of the lower facet of the cell.
+				mpz_int volume; ///< The volume of the cell, the absolute determinant of its edges, and the number of solutions of its binomial system.
+			};
+
+
+			/**
+			\brief Compute the mixed cells of a lifted tuple of supports.
+
+			Edges are chosen one support at a time, depth first, and a partial choice is dropped as soon as no \f$\alpha\f$ makes each edge chosen so far lowest in its support, which is decided by a small linear program.  The choices of edge in the first support are shared among the threads.
+
+			\param supports The supports, as many as the dimension of their points.
+			\param liftings The lift of each point of each support.  Integers, which should be random, for the subdivision to be fine.
+			\param num_threads The number of threads.  0, the default, uses one per hardware thread.
+
+			\return The mixed cells, ordered by their edges.
+
+			\throws std::runtime_error if the lifting is not generic, so that some lower facet is not a cell.  Lift again, at random.
+			*/
+			std::vector<MixedCell> MixedCells(std::vector<Support> const& supports, std::vector<Lifting> const& liftings, unsigned num_threads = 0);
+
+
+			/**
+			\brief The mixed volume, the sum of the volumes of the mixed cells.
+			*/
+			mpz_int MixedVolume(std::vector<MixedCell> const& cells);
+
+
+			/**
+			\brief Solve a binomial system \f$y^{v_k} = b_k\f$, for \f$k = 1..n\f$.
+
+			The rows of exponents are brought to upper triangular Hermite form by unimodular integer row operations, which combine the equations by products and quotients.  In logarithms, the system is then triangular, solved from the last variable up, through every branch of each root.
+
+			\param exponents The exponent vectors \f$v_k\f$, linearly independent.
+			\param right_hand_sides The nonzero \f$b_k\f$.
+
+			\return All \f$|\det v|\f$ solutions.
+			*/
+			std::vector< Vec<dbl> > SolveBinomialSystem(std::vector< std::vector<int> > const& exponents, std::vector<dbl> const& right_hand_sides);
+
+
+			/**
+			\brief Track the paths of the lifted homotopies of the mixed cells, from the solutions of their binomial systems to those of the system with the given coefficients.
+
+			Each path is tracked in double precision, by a Runge-Kutta predictor and Newton's method, in the variable \f$\tau\f$ with \f$s = \tau^{1/e}\f$, where \f$e\f$ is the least positive exponent of \f$s\f$ in its homotopy, so that the homotopy is differentiable at \f$\tau=0\f$.  The paths are shared among the threads.
+
+			\param supports The supports.
+			\param liftings The liftings of which the cells are mixed cells.
+			\param coefficients The coefficient of each point of each support.
+			\param cells The mixed cells.
+			\param num_threads The number of threads.  0, the default, uses one per hardware thread.
+
+			\return The endpoints of the paths which were tracked to \f$s=1\f$, in the order of the cells.  The others are dropped.
+			*/
+			std::vector< Vec<dbl> > TrackLiftedHomotopies(std::vector<Support> const& supports, std::vector<Lifting> const& liftings,
+			                                               std::vector< std::vector<dbl> > const& coefficients,
+			                                               std::vector<MixedCell> const& cells, unsigned num_threads = 0);
+
+		} // namespace polyhedral
+	} // namespace start_system
+} // namespace bertini
+
+#endif
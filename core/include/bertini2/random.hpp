@@ -0,0 +1,194 @@
+//This file is part of Bertini 2.
+//
+//random.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//random.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with random.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file random.hpp
+
+\brief Counter-based streams of random bits, one per thread, or per path, all derived from one master seed.
+
+Every random number Bertini draws, through RandomMp, RandomInt and RandomRat, and the random complex numbers and units built on them, comes from the stream of the calling thread.  So the random gamma, patches, slices, and values of a total degree start system, and the random vectors of the predictors and correctors, are drawn without any lock between threads, and at any precision, the bits of a multiple precision number being simply more draws.
+
+A stream is Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", 2011): the n-th draw is a fixed function of the seed, the identity of the stream, and n, so any stream can be started anywhere without a sequence of seedings.  The parallel drivers give each path a stream of its own, by ScopedRandomStream, the Substream of one forked from the calling thread, so the random numbers a path uses do not depend on which worker tracks it, or when, and a run with the same seed is reproducible on any number of threads.
+
+## Use
+
+\code
+bertini::SetRandomSeed(42); // everything after is reproducible
+
+auto paths = bertini::ThreadRandomStream().Fork();
+// on any thread, for path ii
+{
+	bertini::ScopedRandomStream scoped(paths.Substream(ii));
+	auto v = RandomOfUnits<dbl>(n); // drawn from the stream of path ii
+}
+\endcode
+*/
+
+#ifndef BERTINI_RANDOM_HPP
+#define BERTINI_RANDOM_HPP
+
+#include <cstdint>
+#include <limits>
+
+namespace bertini {
+
+	/**
+	\brief A counter-based stream of random 64-bit numbers, Philox4x32-10.
+
+	Meets the requirements of a uniform random bit generator, so serves the distributions of the standard library and Boost.Random.  Copies are independent, and draw the same numbers.
+	*/
+	class RandomStream
+	{
+	public:
+		using result_type = std::uint64_t;
+
+		/**
+		\param seed The key, the master seed for streams derived from RandomSeed.
+		\param stream The identity of the stream among those with the seed.
+		*/
+		explicit RandomStream(std::uint64_t seed = 0, std::uint64_t stream = 0) : seed_(seed), stream_(stream)
+		{}
+
+		static constexpr result_type min()
+		{
+			return 0;
+		}
+
+		static constexpr result_type max()
+		{
+			return std::numeric_limits<result_type>::max();
+		}
+
+		/**
+		\brief The next 64 random bits.
+		*/
+		result_type operator()()
+		{
+			return Draw(seed_, stream_, position_++);
+		}
+
+		/**
+		\brief A uniform double in [0,1), from the top 53 bits of the next draw.
+		*/
+		double UniformDouble()
+		{
+			return double((*this)() >> 11) * (1.0/9007199254740992.0);
+		}
+
+		/**
+		\brief Skip ahead, as if n numbers had been drawn, in constant time.
+		*/
+		void Discard(std::uint64_t n)
+		{
+			position_ += n;
+		}
+
+		/**
+		\brief The index-th stream derived from this one, at its current position, the same whichever thread asks.  This one does not move.
+		*/
+		RandomStream Substream(std::uint64_t index) const;
+
+		/**
+		\brief A stream derived from this one at its current position, after which this one moves on by one draw, so that successive forks differ.
+		*/
+		RandomStream Fork()
+		{
+			auto forked = Substream(std::numeric_limits<std::uint64_t>::max());
+			++position_;
+			return forked;
+		}
+
+		std::uint64_t Seed() const
+		{
+			return seed_;
+		}
+
+		std::uint64_t Stream() const
+		{
+			return stream_;
+		}
+
+		/**
+		\brief How many numbers have been drawn, or skipped.
+		*/
+		std::uint64_t Position() const
+		{
+			return position_;
+		}
+
+		/**
+		\brief The n-th draw of a stream.
+		*/
+		static std::uint64_t Draw(std::uint64_t seed, std::uint64_t stream, std::uint64_t n);
+
+	private:
+		std::uint64_t seed_;
+		std::uint64_t stream_;
+		std::uint64_t position_ = 0;
+	};
+
+
+
+	/**
+	\brief Set the master seed, from which the stream of every thread is derived, and restart them.
+
+	Each thread's stream starts over, from the new seed, the next time it draws.  Streams held by a ScopedRandomStream are unaffected until it ends.  The seed is 0 until set.
+	*/
+	void SetRandomSeed(std::uint64_t seed);
+
+	/**
+	\brief The master seed.
+	*/
+	std::uint64_t RandomSeed();
+
+	/**
+	\brief The stream from which the calling thread draws its random numbers.
+
+	Unless one is in force by a ScopedRandomStream, it is the stream of the thread, derived from the master seed and the order in which threads first drew, the first being 0.  Needs thread_local storage.  If configured with --disable-thread_local, all threads share one stream, and random numbers must not be drawn by more than one at once.
+	*/
+	RandomStream& ThreadRandomStream();
+
+
+	/**
+	\brief Draw the random numbers of the calling thread from a given stream, for the lifetime of this object.
+
+	The stream in force before is restored, where it was, at the end.  Nests.
+	*/
+	class ScopedRandomStream
+	{
+	public:
+		explicit ScopedRandomStream(RandomStream const& stream);
+		~ScopedRandomStream();
+
+		ScopedRandomStream(ScopedRandomStream const&) = delete;
+		ScopedRandomStream& operator=(ScopedRandomStream const&) = delete;
+
+	private:
+		RandomStream previous_;
+		bool previous_scoped_;
+	};
+
+} // namespace bertini
+
+#endif
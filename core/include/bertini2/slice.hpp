@@ -60,6 +60,7 @@ namespace bertini {
 		VariableGroup sliced_vars_;
 		unsigned num_dims_sliced_;
 		mutable unsigned precision_; ///< the current working precision of the patch.
+		mutable unsigned coefficients_precision_; ///< the precision of the multiple-precision working coefficients and constants, which lags precision_ until they are next used.
 
 		bool is_homogeneous_;
 	public:
@@ -83,34 +84,178 @@ namespace bertini {
 		template<typename NumT>
 		void Eval(Vec<NumT> & result, Vec<NumT> const& x) const
 		{
-			result = std::get<Mat<NumT> >(coefficients_working_) * x;
+			result.noalias() = WorkingCoefficients<NumT>() * x;
 
 			if (!is_homogeneous_)
 				result += std::get<Vec<NumT> >(constants_working_);
 		}
 
 
+		/**
+		\brief Evaluate the slice at many points at once, in place.
+
+		The points are the columns of a matrix, so the evaluation is one matrix-matrix product with the working coefficients, at their current precision, with no temporary.
+
+		\param result The values, one column per point, one row per dimension sliced.  Resized if needed.
+		\param points The points, one per column.
+		*/
+		template<typename NumT>
+		void EvalBatch(Mat<NumT> & result, Mat<NumT> const& points) const
+		{
+			result.noalias() = WorkingCoefficients<NumT>() * points;
+
+			if (!is_homogeneous_)
+				result.colwise() += std::get<Vec<NumT> >(constants_working_);
+		}
+
+
+		/**
+		\brief Evaluate the slice at many points at once.
+
+		\param points The points, one per column.
+		\return The values, one column per point.
+		*/
+		template<typename NumT>
+		Mat<NumT> EvalBatch(Mat<NumT> const& points) const
+		{
+			Mat<NumT> result(Dimension(), points.cols());
+			EvalBatch(result, points);
+			return result;
+		}
+
+
 		template<typename NumT>
 		Vec<NumT> Eval(Vec<NumT> const& x) const
 		{
 			if (!is_homogeneous_)
-				return std::get<Mat<NumT> >(coefficients_working_) * x + std::get<Vec<NumT> >(constants_working_);
+				return WorkingCoefficients<NumT>() * x + std::get<Vec<NumT> >(constants_working_);
 			else
-				return std::get<Mat<NumT> >(coefficients_working_) * x;
+				return WorkingCoefficients<NumT>() * x;
 		}
 
 
 		template<typename NumT>
 		void Jacobian(Mat<NumT> & result, Mat<NumT> const& x) const
 		{
-			result = std::get<Mat<NumT> >(coefficients_working_);
+			result = WorkingCoefficients<NumT>();
 		}
 
 
 		template<typename NumT>
 		Mat<NumT> Jacobian(Mat<NumT> const& x) const
 		{
-			return std::get<Mat<NumT> >(coefficients_working_);
+			return WorkingCoefficients<NumT>();
+		}
+
+
+
+
+		/**
+		\brief The coefficients of the slice, one row per dimension sliced, at the current precision of the slice.
+		*/
+		template<typename NumT>
+		Mat<NumT> const& Coefficients() const
+		{
+			return WorkingCoefficients<NumT>();
+		}
+
+
+		/**
+		\brief The constants of the slice, at the current precision of the slice.  Empty for a homogeneous slice.
+		*/
+		template<typename NumT>
+		Vec<NumT> const& Constants() const
+		{
+			WorkingCoefficients<NumT>();
+			return std::get<Vec<NumT> >(constants_working_);
+		}
+
+
+		/**
+		\brief Move the slice parallel to itself, to pass through a point, by changing its constants.
+
+		\param point The point, in the sliced variables.
+
+		\throws std::runtime_error if the slice is homogeneous, so has no constants, or the point has the wrong number of coordinates.
+		*/
+		void PassThrough(Vec<mpfr> const& point)
+		{
+			if (is_homogeneous_)
+				throw std::runtime_error("trying to move a homogeneous slice through a point, but it has no constants to change");
+			if (point.size()!=NumVariables())
+				throw std::runtime_error("trying to move a slice through a point with " + std::to_string(point.size()) + " coordinates, but the slice is on " + std::to_string(NumVariables()) + " variables");
+
+			WorkingCoefficients<mpfr>();
+			Vec<mpfr>& constants_mpfr = std::get<Vec<mpfr> >(constants_working_);
+			for (unsigned ii = 0; ii < Dimension(); ++ii)
+			{
+				mpfr c(0);
+				for (unsigned jj = 0; jj < NumVariables(); ++jj)
+					c -= coefficients_highest_precision_(ii,jj)*point(jj);
+
+				constants_highest_precision_(ii) = c;
+				std::get<Vec<dbl> >(constants_working_)(ii) = dbl(c);
+				constants_mpfr(ii) = c;
+				constants_mpfr(ii).precision(coefficients_precision_);
+			}
+		}
+
+
+		/**
+		\brief The slice by its first linear functions only, as the slices of the dimensions of a cascade are nested.
+
+		\param dim The number of dimensions sliced, at most that of this slice.
+
+		\throws std::runtime_error if dim is larger than the dimension of this slice.
+		*/
+		LinearSlice Leading(unsigned dim) const
+		{
+			if (dim > Dimension())
+				throw std::runtime_error("trying to take the first " + std::to_string(dim) + " linear functions of a slice of dimension " + std::to_string(Dimension()));
+
+			LinearSlice s(sliced_vars_, dim, is_homogeneous_);
+			s.precision_ = precision_;
+			s.coefficients_precision_ = coefficients_precision_;
+
+			s.coefficients_highest_precision_ = coefficients_highest_precision_.topRows(dim);
+			std::get<Mat<dbl> >(s.coefficients_working_) = std::get<Mat<dbl> >(coefficients_working_).topRows(dim);
+			std::get<Mat<mpfr> >(s.coefficients_working_) = std::get<Mat<mpfr> >(coefficients_working_).topRows(dim);
+
+			if (!is_homogeneous_)
+			{
+				s.constants_highest_precision_ = constants_highest_precision_.head(dim);
+				std::get<Vec<dbl> >(s.constants_working_) = std::get<Vec<dbl> >(constants_working_).head(dim);
+				std::get<Vec<mpfr> >(s.constants_working_) = std::get<Vec<mpfr> >(constants_working_).head(dim);
+			}
+			else
+				s.constants_highest_precision_.resize(0);
+
+			return s;
+		}
+
+
+		/**
+		\brief The slice as functions of its variables, one per dimension sliced, for use in a System.
+
+		Each is a sum of the variables times their coefficients, plus the constant if the slice is not homogeneous, with the coefficients and constants as Float nodes of their highest precision values.
+		*/
+		std::vector< std::shared_ptr<node::Node> > Functions() const
+		{
+			std::vector< std::shared_ptr<node::Node> > functions;
+			for (unsigned ii = 0; ii < Dimension(); ++ii)
+			{
+				std::shared_ptr<node::Node> f;
+				if (!is_homogeneous_)
+					f = node::MakeNode<node::Float>(constants_highest_precision_(ii));
+
+				for (unsigned jj = 0; jj < NumVariables(); ++jj)
+				{
+					auto term = node::MakeNode<node::Float>(coefficients_highest_precision_(ii,jj)) * sliced_vars_[jj];
+					f = f ? f + term : term;
+				}
+				functions.push_back(f);
+			}
+			return functions;
 		}
 
 
@@ -129,33 +274,12 @@ namespace bertini {
 		/**
 		\brief Set the precision of the slice.
 	
-		Copies the slice coefficients into correct precision for subsequent precision.
+		The change is lazy: the coefficients and constants are copied into the new precision the next time they are used in multiple precision.
 
 		\param new_precision The precision to change to.
 		*/
 		void Precision(unsigned new_precision) const
 		{
-			if (new_precision > DoublePrecision())
-			{
-				Mat<mpfr>& coefficients_mpfr = std::get<Mat<mpfr> >(coefficients_working_);
-				Vec<mpfr>& constants_mpfr = std::get<Vec<mpfr> >(constants_working_);
-				for (unsigned ii = 0; ii < Dimension(); ++ii)
-				{
-					for (unsigned jj=0; jj<NumVariables(); ++jj)
-					{
-						coefficients_mpfr(ii,jj).precision(new_precision);
-						if (new_precision>precision_)
-							coefficients_mpfr(ii,jj) = coefficients_highest_precision_(ii,jj);
-					}
-					
-					if (!is_homogeneous_)
-					{
-						constants_mpfr(ii).precision(new_precision);
-						if (new_precision>precision_)
-							constants_mpfr(ii) = constants_highest_precision_(ii);
-					}
-				}
-			}
 			precision_ = new_precision;
 		}
 
@@ -170,9 +294,54 @@ namespace bertini {
 			return sliced_vars_.size();
 		}
 
+		/**
+		\brief Whether the slice is homogeneous, having no constants.
+		*/
+		bool IsHomogeneous() const
+		{
+			return is_homogeneous_;
+		}
+
 
 	private:
 
+		/**
+		\brief Get the working coefficients in a number type, first bringing the multiple-precision coefficients and constants to the current precision of the slice if a change is pending.
+		*/
+		template<typename NumT>
+		Mat<NumT> const& WorkingCoefficients() const
+		{
+			if (std::is_same<NumT,mpfr>::value && coefficients_precision_!=precision_ && precision_ > DoublePrecision())
+				AdjustCoefficientPrecision();
+			return std::get<Mat<NumT> >(coefficients_working_);
+		}
+
+		/**
+		\brief Copy the multiple-precision working coefficients and constants into the current precision of the slice.
+		*/
+		void AdjustCoefficientPrecision() const
+		{
+			Mat<mpfr>& coefficients_mpfr = std::get<Mat<mpfr> >(coefficients_working_);
+			Vec<mpfr>& constants_mpfr = std::get<Vec<mpfr> >(constants_working_);
+			for (unsigned ii = 0; ii < Dimension(); ++ii)
+			{
+				for (unsigned jj=0; jj<NumVariables(); ++jj)
+				{
+					coefficients_mpfr(ii,jj).precision(precision_);
+					if (precision_>coefficients_precision_)
+						coefficients_mpfr(ii,jj) = coefficients_highest_precision_(ii,jj);
+				}
+				
+				if (!is_homogeneous_)
+				{
+					constants_mpfr(ii).precision(precision_);
+					if (precision_>coefficients_precision_)
+						constants_mpfr(ii) = constants_highest_precision_(ii);
+				}
+			}
+			coefficients_precision_ = precision_;
+		}
+
 		// factory function for generating slices
 		static
 		LinearSlice Make(VariableGroup const& v, unsigned dim, bool homogeneous, bool orthogonal, std::function<void(mpfr&, unsigned)> gen)
@@ -249,7 +418,7 @@ namespace bertini {
 
 
 		// the constructor for linear slices.  private because want to use the static public methods to construct them.
-		LinearSlice(VariableGroup const& v, unsigned dim, bool homogeneous) : sliced_vars_(v), precision_(DefaultPrecision()), num_dims_sliced_(dim), coefficients_highest_precision_(dim, v.size()), is_homogeneous_(homogeneous), constants_highest_precision_(dim)
+		LinearSlice(VariableGroup const& v, unsigned dim, bool homogeneous) : sliced_vars_(v), precision_(DefaultPrecision()), coefficients_precision_(precision_), num_dims_sliced_(dim), coefficients_highest_precision_(dim, v.size()), is_homogeneous_(homogeneous), constants_highest_precision_(dim)
 		{ 
 			std::get<Mat<dbl> > (coefficients_working_).resize(Dimension(), NumVariables());
 			std::get<Mat<mpfr> >(coefficients_working_).resize(Dimension(), NumVariables());
@@ -266,7 +435,10 @@ namespace bertini {
 
 		template <typename Archive>
 		void serialize(Archive& ar, const unsigned version) {
+			if (Archive::is_saving::value && precision_ > DoublePrecision())
+				AdjustCoefficientPrecision();
 			ar & precision_;
+			coefficients_precision_ = precision_;
 
 			ar & coefficients_highest_precision_;
 
@@ -32,8 +32,15 @@
 #ifndef BERTINI_START_SYSTEM_HPP
 #define BERTINI_START_SYSTEM_HPP
 
+#include <map>
+
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/filesystem/path.hpp>
+
 #include "bertini2/system.hpp"
 #include "bertini2/limbo.hpp"
+#include "bertini2/polyhedral.hpp"
 
 
 namespace bertini 
@@ -81,6 +88,10 @@ namespace bertini
 
 
 
+		template<typename T>
+		class TotalDegreeStartPointIterator;
+
+
 		/**
 		\brief StartSystem for 1-homogeneous polynomial systems.
 
@@ -90,7 +101,7 @@ namespace bertini
 
 		Note that the corresponding target system MUST be square -- have the same number of functions and variables.  The start system cannot be constructed otherwise, particularly because it is written to throw at the moment if not square.
 
-		The start points are accesses by index (mpz_int), instead of being generated all at once.
+		The start points are accesses by index (mpz_int), instead of being generated all at once.  To visit many of them in order, use StartPoints, which generates each from the last in constant time.
 		*/
 		class TotalDegree : public StartSystem
 		{
@@ -131,6 +142,16 @@ namespace bertini
 			*/
 			mpz_int NumStartPoints() const override;
 
+
+			/**
+			Visit the start points in order of index, from first, each generated from the one before it.
+
+			\tparam T The number type of the points.  For mpfr, they are at the default precision when this is called.
+			\param first The index of the first point visited.
+			*/
+			template<typename T>
+			TotalDegreeStartPointIterator<T> StartPoints(mpz_int const& first = 0) const;
+
 			TotalDegree& operator*=(Nd const& n);
 
 			TotalDegree& operator+=(System const& sys) = delete;
@@ -155,6 +176,8 @@ namespace bertini
 			std::vector<std::shared_ptr<node::Rational> > random_values_; ///< stores the random values for the start functions.  x^d-r, where r is stored in this vector.
 			std::vector<mpz_int> degrees_; ///< stores the degrees of the functions.
 
+			template<typename T>
+			friend class TotalDegreeStartPointIterator;
 
 			friend class boost::serialization::access;
 
@@ -166,6 +189,439 @@ namespace bertini
 			}
 
 		};
+
+
+
+		/**
+		\brief Walks the start points of a TotalDegree start system in order of index.
+
+		TotalDegree::StartPoint decodes the index of the point into the index of a root of each start function, by division of big integers, then computes each root by exp and pow.  Consecutive indices differ mostly in the first few of these, so here they are kept in a mixed-radix counter, incremented in place, and the \f$d_i\f$ roots of each start function \f$x_i^{d_i} - r_i\f$ are computed once, when the iterator is made.  Each point then costs a copy of the coordinates, and for a patched system, a rescaling to fit the patch.
+
+		\code
+		for (auto iter = TD.StartPoints<dbl>(); !iter.AtEnd(); ++iter)
+			Track(*iter);
+		\endcode
+
+		The iterator refers to the start system, which must outlive it.  The points match those of StartPoint, up to roundoff.
+		*/
+		template<typename T>
+		class TotalDegreeStartPointIterator
+		{
+		public:
+
+			/**
+			\param td The start system whose points to walk.
+			\param first The index of the first point.  At or past the number of start points, the iterator starts at its end.
+			*/
+			TotalDegreeStartPointIterator(TotalDegree const& td, mpz_int const& first = 0) : td_(td), index_(first), num_start_points_(td.NumStartPoints())
+			{
+				using RT = typename Eigen::NumTraits<T>::Real;
+				using std::acos;
+				using std::exp;
+				using std::pow;
+
+				const auto num_natural = td.NumNaturalVariables();
+				offset_ = td.IsPatched() ? 1 : 0;
+
+				const RT two_pi = 2*acos(RT(-1));
+				roots_.resize(num_natural);
+				for (size_t ii = 0; ii < num_natural; ++ii)
+				{
+					const unsigned degree = static_cast<unsigned>(td.degrees_[ii]);
+					const T principal_root = pow(td.random_values_[ii]->template Eval<T>(), T(1) / T(RT(degree)));
+
+					roots_[ii].resize(degree);
+					for (unsigned k = 0; k < degree; ++k)
+					{
+						const RT angle = two_pi * RT(k) / RT(degree);
+						roots_[ii][k] = exp(T(RT(0), angle)) * principal_root;
+					}
+				}
+
+				subscripts_.assign(num_natural, 0);
+				if (!AtEnd())
+				{
+					auto subscripts = IndexToSubscript(index_, td.degrees_);
+					for (size_t ii = 0; ii < num_natural; ++ii)
+						subscripts_[ii] = static_cast<unsigned>(subscripts[ii]);
+				}
+
+				unscaled_.resize(td.NumVariables());
+				if (offset_)
+					unscaled_(0) = T(1);
+				for (size_t ii = 0; ii < num_natural; ++ii)
+					unscaled_(ii+offset_) = roots_[ii][subscripts_[ii]];
+				FormPoint();
+			}
+
+
+			/**
+			\brief The current start point.  Not to be called at the end.
+			*/
+			Vec<T> const& operator*() const
+			{
+				return point_;
+			}
+
+
+			/**
+			\brief Move to the start point of the next index.
+			*/
+			TotalDegreeStartPointIterator& operator++()
+			{
+				++index_;
+				for (size_t ii = 0; ii < subscripts_.size(); ++ii)
+				{
+					if (++subscripts_[ii] < roots_[ii].size())
+					{
+						unscaled_(ii+offset_) = roots_[ii][subscripts_[ii]];
+						break;
+					}
+					subscripts_[ii] = 0;
+					unscaled_(ii+offset_) = roots_[ii][0];
+				}
+				FormPoint();
+				return *this;
+			}
+
+
+			/**
+			\brief The index of the current start point.
+			*/
+			mpz_int const& Index() const
+			{
+				return index_;
+			}
+
+
+			/**
+			\brief Whether the iterator has passed the last start point.
+			*/
+			bool AtEnd() const
+			{
+				return index_ >= num_start_points_;
+			}
+
+		private:
+
+			void FormPoint()
+			{
+				point_ = unscaled_;
+				if (offset_)
+					td_.RescalePointToFitPatchInPlace(point_);
+			}
+
+			TotalDegree const& td_; ///< The start system walked.
+			mpz_int index_; ///< The index of the current point.
+			mpz_int num_start_points_; ///< The number of start points, one past the last index.
+			unsigned offset_; ///< 1 if the system is patched, for the homogenizing coordinate, else 0.
+			std::vector< std::vector<T> > roots_; ///< The roots of each start function, in the order of their subscripts.
+			std::vector<unsigned> subscripts_; ///< The subscript of the root of each start function in the current point, least significant first.
+			Vec<T> unscaled_; ///< The current point before rescaling to fit the patch.
+			Vec<T> point_; ///< The current point.
+		};
+
+
+		template<typename T>
+		TotalDegreeStartPointIterator<T> TotalDegree::StartPoints(mpz_int const& first) const
+		{
+			return TotalDegreeStartPointIterator<T>(*this, first);
+		}
+
+
+
+		/**
+		\brief Linear-product start system for polynomial systems in several groups of variables, with the multihomogeneous Bezout number of start points.
+
+		For a system whose variables come in \f$m\f$ affine groups, of sizes \f$n_1,\ldots,n_m\f$, the start function corresponding to function \f$i\f$ of the target is 
+
+		\f[ g_i = \prod_{j=1}^m \prod_{k=1}^{d_{ij}} \ell_{ijk}(x_j), \f]
+
+		where \f$d_{ij}\f$ is the degree of function \f$i\f$ in the variables of group \f$j\f$, and each \f$\ell_{ijk}\f$ is a linear function of those variables with random complex coefficients.  A start point picks, for each function, one group and one factor in it to vanish, such that each group \f$j\f$ is picked by exactly \f$n_j\f$ functions.  The factors picked for a group are then a square linear system in its variables.  The number of such choices is the multihomogeneous Bezout number, a bound on the number of isolated solutions of the target which is far smaller than its total degree when the functions have low degree in each group.
+
+		The choices are numbered in order of function, then group, then factor, so that the start point of an index is found without listing them.  The number of ways to complete a choice for the functions from \f$i\f$ on, given how many more functions each group must be picked by, is computed once, at construction.  Decoding an index then takes a pass over the functions and groups, and the point a linear solve per group.
+
+		With one group, this is a linear-product form of the TotalDegree start system, with the same number of start points.
+
+		The target system MUST be square and polynomial, with only affine variable groups, and no path variable.
+		*/
+		class MHomogeneous : public StartSystem
+		{
+		public:
+			MHomogeneous() = default;
+			virtual ~MHomogeneous() = default;
+
+			/**
+			 Constructor for making a multihomogeneous start system from a polynomial system
+
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, or has any homogeneous variable groups.
+			*/
+			MHomogeneous(System const& s);
+
+
+			/**
+			Get the number of start points for this start system.  This is the multihomogeneous Bezout number of the target system, for its grouping of the variables.
+			*/
+			mpz_int NumStartPoints() const override;
+
+
+			/**
+			Get the degree of a function of the target system in the variables of one of its groups.
+
+			\param function_index The index of the function.
+			\param group_index The index of the affine variable group.
+			*/
+			unsigned Degree(size_t function_index, size_t group_index) const
+			{
+				return degrees_[function_index][group_index];
+			}
+
+			MHomogeneous& operator+=(System const& sys) = delete;
+
+		private:
+
+			using LinearFactor = std::vector< std::shared_ptr<node::Rational> >; ///< The coefficients of the variables of a group, followed by the constant term.
+
+			/**
+			Get the ith start point, in double precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			template<typename T>
+			Vec<T> GenerateStartPointImpl(mpz_int index) const;
+
+			/**
+			The number of ways to pick a group and factor for each function from first_function on, when group j must still be picked by remaining[j] of them.  Fills counts_.
+			*/
+			mpz_int CountCompletions(size_t first_function, std::vector<unsigned> & remaining);
+
+			std::vector< std::vector<unsigned> > degrees_; ///< The degree of each function in each group.
+			std::vector<unsigned> group_sizes_; ///< The number of variables in each affine group.
+			std::vector< std::vector< std::vector<LinearFactor> > > linear_factors_; ///< The linear factors of each start function, for each group.
+			std::map< std::vector<unsigned>, mpz_int > counts_; ///< The number of completions, by how many more functions each group must be picked by.  The number of functions already picked for is implied.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & degrees_;
+				ar & group_sizes_;
+				ar & linear_factors_;
+				ar & counts_;
+			}
+		};
+
+
+
+		/**
+		\brief Start system with the supports of the target and random coefficients, solved by polyhedral homotopies, with as many start points as the mixed volume of the supports.
+
+		The start function corresponding to function \f$i\f$ of the target is
+
+		\f[ g_i = \sum_{a \in S_i} c_{ia} x^a, \f]
+
+		where \f$S_i\f$ is the support of the target function, the exponents of its monomials, and each \f$c_{ia}\f$ is a random complex number of modulus 1.  The constant monomial is put in every support, so that the mixed volume of the supports bounds the number of isolated solutions of the target with zero coordinates, too.  For sparse systems, this bound is far below the Bezout numbers, and no paths are tracked to solutions at infinity.
+
+		Unlike for the other start systems, the start points are not known in closed form, and are computed at construction, by the polyhedral homotopy method in polyhedral.hpp -- finding the mixed cells of a random lifting of the supports, solving the binomial system of each, and tracking the lifted homotopies from their solutions in double precision.  The start points in multiple precision are refined from those by Newton's method, at the default precision.
+
+		The target system MUST be square and polynomial, with only affine variable groups, no path variable, and must not be homogenized.
+		*/
+		class Polyhedral : public StartSystem
+		{
+		public:
+			Polyhedral() = default;
+			virtual ~Polyhedral() = default;
+
+			/**
+			 Constructor for making a polyhedral start system from a polynomial system, solving it.
+
+			 \param s The target system.
+			 \param num_threads The number of threads on which to find the mixed cells and track the lifted homotopies.  0, the default, uses one per hardware thread.
+
+			 \throws std::runtime_error, if the input target system is not square, is not polynomial, has a path variable already, has any homogeneous variable groups, or is homogenized.
+			*/
+			Polyhedral(System const& s, unsigned num_threads = 0);
+
+
+			/**
+			Get the number of start points for this start system, the solutions found by the polyhedral homotopies.  This is the mixed volume, unless some path failed.
+			*/
+			mpz_int NumStartPoints() const override;
+
+
+			/**
+			Get the mixed volume of the supports of the start functions, the number of paths of the polyhedral homotopies, and the bound on the number of isolated solutions of the target.
+			*/
+			mpz_int const& MixedVolume() const
+			{
+				return mixed_volume_;
+			}
+
+
+			/**
+			Get the support of a start function, the exponents of the variables in each of its monomials.
+
+			\param function_index The index of the function.
+			*/
+			polyhedral::Support const& Support(size_t function_index) const
+			{
+				return supports_[function_index];
+			}
+
+			Polyhedral& operator+=(System const& sys) = delete;
+
+		private:
+
+			/**
+			Get the ith start point, in double precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			std::vector<polyhedral::Support> supports_; ///< The supports of the start functions.
+			std::vector< std::vector< std::shared_ptr<node::Rational> > > coefficients_; ///< The coefficient of each monomial of each start function.
+			mpz_int mixed_volume_; ///< The mixed volume of the supports.
+			std::vector< Vec<dbl> > start_points_; ///< The solutions of the start system, found by the polyhedral homotopies.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				ar & supports_;
+				ar & coefficients_;
+				ar & mixed_volume_;
+				ar & start_points_;
+			}
+		};
+
+
+
+		/**
+		\brief Start system given by the user, with its start points read from a file, as they are asked for.
+
+		For parameter homotopies, where the start points are the solutions of the system at other parameter values, and for reusing the solutions found by another run or program.  The file is either an endpoint file written by tracking::EndpointWriter, whose records are the start points in the order written, or a start file of Bertini classic, the number of points followed by their coordinates, a real and imaginary part to a line, with optional semicolons.
+
+		The file is memory mapped, and not read into memory.  For an endpoint file, the records are located by EndpointReader.  For a text file, the position of every 64th point is found at construction, and a point is read from the nearest before it.  Either way, StartPoint takes time independent of the index and of the number of points, and converts the coordinates to the precision asked for as it reads them, so that a file of tens of millions of start points is never held in memory.  The digits of a text file beyond double precision are kept for start points in multiple precision.
+
+		Copies share the mapping, which is read only, so start points may be asked for by many threads at once.  Serialization stores the name of the file, not its contents, so the file must be readable wherever the start system is loaded.
+		*/
+		class UserSupplied : public StartSystem
+		{
+		public:
+
+			/**
+			\brief The kind of file the start points are read from.
+			*/
+			enum class Format
+			{
+				Endpoints, ///< An endpoint file of tracking::EndpointWriter.
+				Classic ///< A start file of Bertini classic.
+			};
+
+			UserSupplied() = default;
+			virtual ~UserSupplied() = default;
+
+			/**
+			 Constructor for a start system from a system and a file of its solutions.
+
+			 \param s The start system.  It is copied.
+			 \param start_solutions The file of its solutions, whose kind is found from its first bytes.
+
+			 \throws std::runtime_error, if the system has a path variable already, or the file cannot be mapped, is not of either kind, has points of another number of coordinates than the system has variables, or ends before its last point.
+			*/
+			UserSupplied(System const& s, boost::filesystem::path const& start_solutions);
+
+
+			/**
+			Get the number of start points, the points in the file.
+			*/
+			mpz_int NumStartPoints() const override;
+
+
+			/**
+			Get the file the start points are read from.
+			*/
+			boost::filesystem::path const& StartSolutionsFile() const
+			{
+				return file_;
+			}
+
+
+			/**
+			Get the kind of the file the start points are read from.
+			*/
+			Format StartSolutionsFormat() const;
+
+			UserSupplied& operator+=(System const& sys) = delete;
+
+		private:
+
+			/**
+			Get the ith start point, in double precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<dbl> GenerateStartPoint(dbl,mpz_int index) const override;
+
+			/**
+			Get the ith start point, in current default precision.
+
+			Called by the base StartSystem's StartPoint(index) method.
+			*/
+			Vec<mpfr> GenerateStartPoint(mpfr,mpz_int index) const override;
+
+			/**
+			Map the file and find its points.
+			*/
+			void Open();
+
+			class Solutions;
+
+			boost::filesystem::path file_; ///< The file of start points.
+			std::shared_ptr<const Solutions> solutions_; ///< The mapping of the file, and where its points are, shared by copies.
+
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void save(Archive& ar, const unsigned version) const {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				const std::string file = file_.string();
+				ar & file;
+			}
+
+			template <typename Archive>
+			void load(Archive& ar, const unsigned version) {
+				ar & boost::serialization::base_object<StartSystem>(*this);
+				std::string file;
+				ar & file;
+				file_ = file;
+				Open();
+			}
+
+			BOOST_SERIALIZATION_SPLIT_MEMBER()
+		};
 	}
 }
 
@@ -37,6 +37,8 @@
 
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/vector.hpp>
@@ -46,9 +48,14 @@
 #include "bertini2/mpfr_complex.hpp"
 #include "bertini2/mpfr_extensions.hpp"
 #include "bertini2/eigen_extensions.hpp"
+#include "bertini2/memory_usage.hpp"
 
 
 #include "bertini2/function_tree.hpp"
+#include "bertini2/function_tree/straight_line_program.hpp"
+#include "bertini2/function_tree/polynomial_system.hpp"
+#include "bertini2/detail/thread_team.hpp"
+#include "bertini2/detail/generated_kernels.hpp"
 #include "bertini2/patch.hpp"
 
 #include "bertini2/limbo.hpp"
@@ -58,7 +65,10 @@
 
 namespace bertini {
 
-	
+	namespace detail {
+		struct StraightLineHomotopyParts;
+		struct SharedSystemAccess;
+	}
 
 	/**
 	\brief The fundamental polynomial system class for Bertini2.
@@ -79,7 +89,7 @@ namespace bertini {
 		/**
 		\brief The default constructor for a system.
 		*/
-		System() : is_differentiated_(false), have_path_variable_(false), have_ordering_(false), precision_(DefaultPrecision()), is_patched_(false)
+		System() : is_differentiated_(false), have_path_variable_(false), have_ordering_(false), precision_(DefaultPrecision()), tree_precision_(0), is_patched_(false), use_straight_line_program_(false), use_compiled_evaluation_(true), straight_line_program_failed_(false), use_forward_mode_(false), use_polynomial_system_(true), have_polynomial_system_(false), use_fused_homotopy_(true), use_compensated_evaluation_(false), use_native_code_(false), use_evaluation_cache_(true), evaluation_cache_hits_(0), have_function_dependencies_(false), have_jacobian_dependencies_(false), variables_changed_(false), path_variable_changed_(false), implicit_parameters_changed_(false), leaves_changed_(false), shares_trees_(false)
 		{}
 
 		/** 
@@ -118,6 +128,8 @@ namespace bertini {
 		/**
 		Change the precision of the entire system's functions, subfunctions, and all other nodes.
 
+		The variables and the patch take the new precision now.  The trees, and the compiled or expanded forms of them, are brought to it only when they are next used in multiple precision, and only the form actually used for evaluation pays.  So switching precision repeatedly, or to double and back, costs little.
+
 		\param new_precision The new precision, in digits, to work in.  This only affects the mpfr types, not double.  To use low-precision (doubles), use that number type in the templated functions.
 		*/
 		void precision(unsigned new_precision) const;
@@ -130,11 +142,316 @@ namespace bertini {
 			return precision_;
 		}
 
+		/**
+		\brief The memory held by the system, by component.
+
+		The function and Jacobian trees are counted by the type of their nodes, each node at the size of the common base of nodes and its links to its children, and a node shared by several trees once, in the first.  The values the nodes keep in multiple precision are counted apart, at their precision, as are the patch, the compiled forms of the system, the last evaluations, and the target and start systems of a straight-line homotopy.
+
+		The trees of a system made by CloneForThread belong to the system it was cloned from, so are not counted in its report.
+		*/
+		MemoryUsage MemoryReport() const;
+
 		/**
 		 \brief Compute and internally store the symbolic Jacobian of the system.
+
+		 Structurally identical subtrees of the functions and Jacobian are then merged, so that each is evaluated once per point.  See node::EliminateCommonSubexpressions.
+
+		 Only the rows which are missing are computed.  Functions added by AddFunction or AddFunctions, or put in place by ReplaceFunction, after the system was differentiated, are differentiated alone, and the rows of the others are kept.  Any other change, to the variables, say, or homogenizing functions which were not already homogeneous, discards the whole Jacobian.
 		*/
 		void Differentiate() const;
 
+		/**
+		 \brief Whether the symbolic Jacobian has been computed, by Differentiate or on demand, and is current, with a row for every function.
+		*/
+		bool IsDifferentiated() const
+		{
+			return is_differentiated_;
+		}
+
+
+		/**
+		\brief Switch evaluation through a compiled StraightLineProgram on or off.
+
+		When on, EvalInPlace, JacobianInPlace, and TimeDerivativeInPlace evaluate the functions, Jacobian, and time derivatives through a flat instruction tape, rather than by walking the function trees.  The program is compiled from the trees on first use after Differentiate(), and recompiled whenever the system is differentiated anew.  The two modes produce the same values.
+
+		\param use_it Whether to evaluate through the compiled program.
+		*/
+		void UseStraightLineProgram(bool use_it = true)
+		{
+			use_straight_line_program_ = use_it;
+			ForgetEvaluations();
+		}
+
+		/**
+		\brief Query whether the system evaluates through a compiled StraightLineProgram.
+		*/
+		bool UsingStraightLineProgram() const
+		{
+			return use_straight_line_program_;
+		}
+
+		/**
+		\brief Switch default evaluation through a compiled StraightLineProgram on or off.
+
+		When on, systems which are not evaluated through a PolynomialSystem are evaluated through their compiled StraightLineProgram, whose instructions are dispatched by a switch over a closed set of operations, rather than by a virtual call at every node of the trees.  Systems whose trees contain node types which cannot be compiled are evaluated through their trees, as usual.  UseForwardModeDifferentiation, UseStraightLineProgram, and UsePolynomialEvaluation take precedence.
+
+		On by default.
+
+		\param use_it Whether to evaluate through the compiled program when no other mode applies.
+		*/
+		void UseCompiledEvaluation(bool use_it = true)
+		{
+			use_compiled_evaluation_ = use_it;
+			ForgetEvaluations();
+		}
+
+		/**
+		\brief Query whether systems are evaluated through a compiled StraightLineProgram when no other mode applies.
+		*/
+		bool UsingCompiledEvaluation() const
+		{
+			return use_compiled_evaluation_;
+		}
+
+		/**
+		\brief Get the compiled program for the functions, Jacobian, and time derivatives of this system.
+
+		Differentiates the system and compiles the program if necessary.
+
+		\throws std::runtime_error if the function trees contain node types which cannot be compiled.
+		*/
+		StraightLineProgram const& GetStraightLineProgram() const;
+
+
+		/**
+		\brief Switch forward-mode automatic differentiation on or off.
+
+		When on, the system is never differentiated symbolically.  Instead, the functions alone are compiled into a StraightLineProgram, and JacobianInPlace and TimeDerivativeInPlace compute the derivatives by carrying them through one sweep over that program, see StraightLineProgram::EvalForwardMode.  EvalInPlace uses the same program.  Takes precedence over UseStraightLineProgram.
+
+		\param use_it Whether to differentiate in forward mode.
+		*/
+		void UseForwardModeDifferentiation(bool use_it = true)
+		{
+			use_forward_mode_ = use_it;
+			ForgetEvaluations();
+		}
+
+		/**
+		\brief Query whether the system uses forward-mode automatic differentiation.
+		*/
+		bool UsingForwardModeDifferentiation() const
+		{
+			return use_forward_mode_;
+		}
+
+		/**
+		\brief Get the program compiled from the functions alone, used for forward-mode differentiation and by EvalBatch.
+
+		Compiles the program if necessary.  Adding functions, variables, or parameters to the system discards it.
+
+		\throws std::runtime_error if the function trees contain node types which cannot be compiled.
+		*/
+		StraightLineProgram const& GetForwardModeProgram() const;
+
+
+		/**
+		\brief Switch evaluation through a PolynomialSystem on or off.
+
+		When on, and the functions are polynomial in the variables and path variable, EvalInPlace, JacobianInPlace, and TimeDerivativeInPlace evaluate the functions, Jacobian, and time derivatives from their expansions into monomials, rather than by walking the function trees.  No symbolic differentiation is needed.  Systems which are not polynomial are evaluated as usual, see UseCompiledEvaluation.  UseForwardModeDifferentiation and UseStraightLineProgram take precedence.
+
+		On by default.
+
+		\param use_it Whether to evaluate polynomial systems through their expansions.
+		*/
+		void UsePolynomialEvaluation(bool use_it = true)
+		{
+			use_polynomial_system_ = use_it;
+			ForgetEvaluations();
+		}
+
+		/**
+		\brief Query whether polynomial systems are evaluated through a PolynomialSystem.
+		*/
+		bool UsingPolynomialEvaluation() const
+		{
+			return use_polynomial_system_;
+		}
+
+		/**
+		\brief Whether the functions can be expanded into a PolynomialSystem.
+
+		Expands them if necessary.  Adding functions, variables, or parameters to the system discards the expansion.
+
+		\return true if the functions are polynomial in the variables and path variable.
+		*/
+		bool HavePolynomialSystem() const;
+
+		/**
+		\brief Get the expansion of the functions into monomials.
+
+		Expands them if necessary.
+
+		\throws std::runtime_error if the functions are not polynomial in the variables and path variable.
+		*/
+		PolynomialSystem const& GetPolynomialSystem() const;
+
+
+		/**
+		\brief Switch fused evaluation of a straight-line homotopy on or off.
+
+		Only applies to a system made by StraightLineHomotopy.  When on, EvalInPlace, JacobianInPlace, TimeDerivativeInPlace, and their combinations evaluate the target and start systems once each, each in its own mode, and combine the values with the scalar multipliers of the homotopy.  The time derivative is the difference of the two, with no differentiation with respect to the path variable.  When off, the homotopy is evaluated from its trees, or their compiled forms, like any other system.  Takes precedence over every other mode.
+
+		On by default.
+
+		\param use_it Whether to evaluate a straight-line homotopy through its parts.
+		*/
+		void UseFusedHomotopy(bool use_it = true)
+		{
+			use_fused_homotopy_ = use_it;
+			ForgetEvaluations();
+		}
+
+		/**
+		\brief Query whether a straight-line homotopy is evaluated through its parts.
+		*/
+		bool UsingFusedHomotopy() const
+		{
+			return use_fused_homotopy_;
+		}
+
+		/**
+		\brief Whether the system was made by StraightLineHomotopy, and has not been changed since, so can be evaluated through its parts.
+		*/
+		bool HaveFusedHomotopy() const
+		{
+			return static_cast<bool>(homotopy_parts_);
+		}
+
+
+		/**
+		\brief Switch compensated evaluation in double precision on or off.
+
+		When on, the functions, Jacobian, and time derivatives in double precision are evaluated through the compiled StraightLineProgram, run in double-double registers and rounded to double, see StraightLineProgram::Compensate.  They are then correct to about the precision of double even where the terms of the functions cancel, so adaptive precision tracking, whose configuration accounts for this, see AdaptiveMultiplePrecisionConfig::SetAMPConfigFrom, stays in double longer.  Polynomial systems are compiled rather than expanded.  UseForwardModeDifferentiation takes precedence, and is not compensated.  A straight-line homotopy switches its target and start systems as well.
+
+		Off by default.
+
+		\param use_it Whether to compensate evaluation in double precision.
+		*/
+		void UseCompensatedEvaluation(bool use_it = true);
+
+		/**
+		\brief Query whether compensated evaluation in double precision was asked for.
+		*/
+		bool UsingCompensatedEvaluation() const
+		{
+			return use_compensated_evaluation_;
+		}
+
+		/**
+		\brief Whether evaluation in double precision is in fact compensated: it was asked for, and the system is evaluated through a compiled program, not in forward mode.
+
+		May differentiate and compile the system.
+		*/
+		bool EvaluatingCompensated() const;
+
+
+		/**
+		\brief Evaluate one point on several threads, for very large systems, whose few slowest paths otherwise set the time of a run.
+
+		The functions are split into as many blocks of consecutive rows as there are threads, and each block, with its rows of the Jacobian, is evaluated on a thread of its own, through the compiled StraightLineProgram or the expanded PolynomialSystem.  Subexpressions shared between blocks are computed in each.  The correctors and predictors factor their large matrices on the same threads, see PartialPivotLU::UseThreads.  Forward mode, compensated evaluation, and walking the trees stay on the calling thread.
+
+		Copies share the threads, and their evaluations take turns on them.  A system made by CloneForThread evaluates on its own thread alone, as it is meant to be one of many.
+
+		\param num_threads The number of threads evaluating a point, counting the calling thread.  1, the default, for none but it.
+		*/
+		void UseEvaluationThreads(unsigned num_threads);
+
+		/**
+		\brief The number of threads evaluating a point, see UseEvaluationThreads.
+		*/
+		unsigned NumEvaluationThreads() const
+		{
+			return evaluation_team_ ? evaluation_team_->Size() : 1;
+		}
+
+		/**
+		\brief The threads evaluating a point, nullptr if only the calling thread does, for the linear algebra of a tracker to share.
+		*/
+		std::shared_ptr<detail::ThreadTeam> const& EvaluationTeam() const
+		{
+			return evaluation_team_;
+		}
+
+
+		/**
+		\brief Switch the cache of the last evaluations on or off.
+
+		When on, the function values, Jacobian, and time derivative last computed, in each number type, are kept along with the point, time, and precision at which they were computed.  Asking for any of them again at the same point, as a tracker does when refining a point, then correcting it, then predicting from it, copies them out rather than evaluating again.  The points are compared by value.  Any other point, a change of precision or of mode of evaluation, setting the implicit parameters, and changing the system, replace or forget what is kept.
+
+		Besides the point, time, and precision, the system watches the other Variables of its trees -- such as a parameter which is not one of its variables -- and forgets what is kept when one is given a value with set_current_value.  It cannot see a Number of the trees changed in place; after changing one, call ForgetStoredValues, or the next evaluation at the same point answers with the values from before the change.
+
+		\param use_it Whether to keep the last evaluations.
+		*/
+		void UseEvaluationCache(bool use_it = true)
+		{
+			use_evaluation_cache_ = use_it;
+			ForgetEvaluations();
+		}
+
+		/**
+		\brief Query whether the last evaluations are kept.
+		*/
+		bool UsingEvaluationCache() const
+		{
+			return use_evaluation_cache_;
+		}
+
+		/**
+		\brief The number of evaluations answered from the cache of the last evaluations, since the system was made.
+		*/
+		unsigned long long EvaluationCacheHits() const
+		{
+			return evaluation_cache_hits_;
+		}
+
+		/**
+		\brief Forget the last evaluations, so the next are computed afresh.
+
+		The system calls this itself whenever it changes, or one of the Variables of its trees is set.  After changing a Number of the trees in place, call ForgetStoredValues instead, which also resets the trees.
+		*/
+		void ForgetEvaluations() const
+		{
+			std::get<EvaluationCache<dbl> >(evaluation_cache_).Forget();
+			std::get<EvaluationCache<mpfr> >(evaluation_cache_).Forget();
+		}
+
+		/**
+		\brief Reset every node of the function trees at the next evaluation, and forget the last evaluations.
+
+		Walking the trees re-evaluates only the nodes depending on what was set through SetVariables, SetPathVariable, and SetImplicitParameters, or everything when another Variable of the trees has been given a value with set_current_value.  Call this after changing any other leaf in place, such as a Number, so that the next evaluation sees it, whichever way the system is evaluated.
+		*/
+		void ForgetStoredValues() const;
+
+
+		/**
+		\brief Make a copy of the system for evaluation on another thread, sharing the function and derivative trees, with variables and evaluation registers of its own.
+
+		The copy gets new variable nodes, and copies of the compiled form through which the system is evaluated -- its StraightLineProgram, its forward mode program, or its PolynomialSystem -- read from them.  These are flat arrays of instructions or terms, plus the registers which are their only state changing during evaluation.  By contrast, the copy constructor makes new function nodes, which must then be differentiated and compiled again, and a serialization round trip duplicates every node.
+
+		The copy is for evaluation only, as it can never walk the trees it shares.  It cannot be differentiated, nor changed, nor switched to another mode of evaluation; evaluating it after doing so throws.  Nor may the original be evaluated by walking its trees while copies are in use on other threads.  Changing precision is safe, on the original and on the copies.
+
+		\throws std::runtime_error if the system can only be evaluated by walking its trees, because they contain node types which cannot be compiled.
+		*/
+		System CloneForThread() const;
+
+		/**
+		\brief Whether this system was made by CloneForThread, so shares its trees with another.
+		*/
+		bool SharesTrees() const
+		{
+			return shares_trees_;
+		}
+
 
 		
 		
@@ -143,7 +460,7 @@ namespace bertini {
 		/**
 		 \brief Evaluate the system using the previously set variable (and time) values, in place.
 
-		It is up to YOU to ensure that the system's variables (and path variable) has been set prior to this function call.
+		It is up to YOU to ensure that the system's variables (and path variable) has been set prior to this function call.  Set them with SetVariables, SetPathVariable, and SetImplicitParameters, rather than directly on the variable nodes -- only the parts of the function trees depending on what was set through these are re-evaluated.  Other Variables of the trees, such as parameters, may be set directly with set_current_value, and the system notices.  After changing any other leaf in place, call ForgetStoredValues before evaluating.
 
 		\return The function values of the system
 		*/ 
@@ -159,22 +476,35 @@ namespace bertini {
 				throw std::runtime_error(ss.str());
 			}
 
-			// the Reset() function call traverses the entire tree, resetting everything.
-			// TODO: it has the unfortunate side effect of resetting constant functions, too.
-			for (const auto& iter : functions_) 
-				iter->Reset();
-
-
-			unsigned counter(0);
-			for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
-				(*iter)->EvalInPlace<T>(function_values(counter));
+			auto cache = EvaluationCacheAtCurrentPoint<T>();
+			if (cache && cache->Copy(cache->values, cache->have_values, function_values))
+			{
+				++evaluation_cache_hits_;
+				return;
 			}
 
+			AdjustPrecisionForEvaluation<T>();
+
+			if (EvaluatingFusedHomotopy())
+				FusedHomotopyEvalInPlace(function_values);
+			else if (generated_kernels_)
+				RunGeneratedKernel(generated_kernels_->eval, function_values);
+			else if (use_forward_mode_)
+				GetForwardModeProgram().EvalFunctions(function_values);
+			else if (EvaluatingStraightLineProgram())
+				GetStraightLineProgram().EvalFunctions(function_values);
+			else if (EvaluatingPolynomialSystem())
+				GetPolynomialSystem().EvalFunctions(function_values);
+			else
+				EvalTreesInPlace(function_values);
+
 			if (IsPatched())
 				patch_.EvalInPlace(function_values,
 									std::get<Vec<T> >(current_variable_values_));
 									// .segment(NumFunctions(),NumTotalVariableGroups())
-			
+
+			if (cache)
+				cache->Keep(cache->values, cache->have_values, function_values);
 		}
 		
 		
@@ -282,8 +612,6 @@ namespace bertini {
 		 
 		 \param variable_values The values of the variables, for the evaluation.
 		 \param path_variable_value The current value of the path variable.
-
-		 \todo The Eval() function for systems has the unfortunate side effect of resetting constant functions.  Modify the System class so that only certain parts of the tree get reset.
 		 */
 		template<typename Derived, typename OtherDerived, typename T>
 		void EvalInPlace(Eigen::MatrixBase<Derived> & function_values, const Eigen::MatrixBase<OtherDerived>& variable_values, const T & path_variable_value) const
@@ -318,8 +646,6 @@ namespace bertini {
 		 
 		 \param variable_values The values of the variables, for the evaluation.
 		 \param path_variable_value The current value of the path variable.
-
-		 \todo The Eval() function for systems has the unfortunate side effect of resetting constant functions.  Modify the System class so that only certain parts of the tree get reset.
 		 */
 		template<typename Derived, typename T>
 		Vec<T> Eval(const Eigen::MatrixBase<Derived>& variable_values, const T & path_variable_value) const
@@ -343,70 +669,356 @@ namespace bertini {
 			EvalInPlace(function_values, variable_values, path_variable_value);
 			return function_values;
 		}
-		
-		
-		
+
+
+
+
 		/**
-		 Evaluate the Jacobian matrix of the system, using the previous space and time values, in place.
+		\brief Whether the functions of the system have only real coefficients, their integers, rationals and floats all real, so that at real values of the variables and path variable the functions and their derivatives are real, and may be computed in real arithmetic by EvalReal and JacobianReal.
 
-		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		The functions may depend on nothing but the variables and path variable, and a patched system never qualifies, its patches being random complex.  Compiles the StraightLineProgram of the system, if it isn't already.
 		*/
-		template<typename Derived>
-		void JacobianInPlace(Eigen::MatrixBase<Derived> & J) const
-		{
-			typedef typename Derived::Scalar T;
+		bool HasRealCoefficients() const;
 
-			if(J.rows() != NumTotalFunctions() || J.cols() != NumVariables())
-			{
-				throw std::runtime_error("trying to evaluate jacobian of system in place, but input J doesn't have right number of columns or rows");
-			}
-			
-			const auto& vars = Variables();
+		/**
+		\brief Evaluate a system with real coefficients at real values of the variables, in real arithmetic.
 
-			if (!is_differentiated_)
-				Differentiate();
-			else
-				for (const auto& iter : jacobian_) 
-					iter->Reset();
+		Runs the StraightLineProgram of the system in real registers, whatever the mode of evaluation, at a quarter or less of the cost of a complex evaluation.  For the refinement of real solutions, and homotopies whose parameters move along the reals.  Functions which are not real at a real point, as square roots and logarithms of negative numbers, come out NaN.
 
-			for (int ii = 0; ii < NumFunctions(); ++ii)
-				for (int jj = 0; jj < NumVariables(); ++jj)
-					jacobian_[ii]->EvalJInPlace<T>(J(ii,jj),vars[jj]);
-				
-			if (IsPatched())
-				patch_.JacobianInPlace(J,std::get<Vec<T> >(current_variable_values_));
-			
-		}
+		Causes the current variable values to be set in the system, as complex numbers with zero imaginary part.
 
-		
-		
-		
-		
-		
+		\tparam RealType double or mpfr_float, the latter at the precision of the system.
+		\param variable_values The values of the variables.
+
+		\throws std::runtime_error if the system does not have real coefficients, see HasRealCoefficients, or has a path variable, or if the number of variables doesn't match.
+		*/
+		template<typename RealType>
+		Vec<RealType> EvalReal(Vec<RealType> const& variable_values) const
+		{
+			const auto& program = RealStraightLineProgram();
+			if (have_path_variable_)
+				throw std::runtime_error("not using a time value for evaluation of system, but path variable IS defined.");
 
+			SetRealVariables(variable_values);
+			Vec<RealType> function_values(NumFunctions());
+			program.EvalFunctions(function_values);
+			return function_values;
+		}
 
 		/**
-		Evaluate the Jacobian matrix of the system, using the previous space and time values.
+		\brief Evaluate a system with real coefficients at real values of the variables and path variable, in real arithmetic, see EvalReal(Vec<RealType> const&).
 
-		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		\throws std::runtime_error if the system does not have real coefficients, or has no path variable, or if the number of variables doesn't match.
 		*/
-		template<typename T>
-		Mat<T> Jacobian() const
+		template<typename RealType>
+		Vec<RealType> EvalReal(Vec<RealType> const& variable_values, RealType const& path_variable_value) const
 		{
+			const auto& program = RealStraightLineProgram();
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of system, but no path variable defined.");
 
-			Mat<T> J(NumTotalFunctions(), NumVariables());
-			JacobianInPlace(J);
+			SetRealVariables(variable_values);
+			SetRealPathVariable(path_variable_value);
+			Vec<RealType> function_values(NumFunctions());
+			program.EvalFunctions(function_values);
+			return function_values;
+		}
+
+		/**
+		\brief The Jacobian of a system with real coefficients at real values of the variables, in real arithmetic, see EvalReal.
+
+		\throws std::runtime_error if the system does not have real coefficients, or has a path variable, or if the number of variables doesn't match.
+		*/
+		template<typename RealType>
+		Mat<RealType> JacobianReal(Vec<RealType> const& variable_values) const
+		{
+			const auto& program = RealStraightLineProgram();
+			if (have_path_variable_)
+				throw std::runtime_error("not using a time value for evaluation of system, but path variable IS defined.");
 
+			SetRealVariables(variable_values);
+			Mat<RealType> J(NumFunctions(), NumVariables());
+			program.EvalJacobian(J);
 			return J;
 		}
 
-		
-
-		
 		/**
-		 Evaluate the Jacobian matrix of the system, provided the system has no path variable defined.
-		 
-		 \throws std::runtime_error, if a path variable IS defined, but you didn't pass it a value.  Also throws if the number of variables doesn't match.
+		\brief The Jacobian of a system with real coefficients at real values of the variables and path variable, in real arithmetic, see EvalReal.
+
+		\throws std::runtime_error if the system does not have real coefficients, or has no path variable, or if the number of variables doesn't match.
+		*/
+		template<typename RealType>
+		Mat<RealType> JacobianReal(Vec<RealType> const& variable_values, RealType const& path_variable_value) const
+		{
+			const auto& program = RealStraightLineProgram();
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of system, but no path variable defined.");
+
+			SetRealVariables(variable_values);
+			SetRealPathVariable(path_variable_value);
+			Mat<RealType> J(NumFunctions(), NumVariables());
+			program.EvalJacobian(J);
+			return J;
+		}
+
+
+		/**
+		\brief Switch compiling the batch evaluations, EvalBatch, EvalBatchAtParameters and EvalBatchWithDerivatives, to native code on or off.
+
+		When on, the program they run is compiled by LLVM the first time it is needed, see StraightLineProgram::CompileNative, and its arithmetic runs as vector instructions, with no dispatch on the operations.  The code is shared by every system with the same functions, so copies, and those made by CloneForThread, compile nothing.  Requires a build with --enable-llvm-jit; otherwise, or if compiling fails, the batch evaluations are interpreted as before.  Evaluation of a single point, and in multiple precision, is unchanged.
+
+		Off by default.
+
+		\param use_it Whether to compile the batch evaluations.
+		*/
+		void UseNativeCode(bool use_it = true);
+
+		/**
+		\brief Query whether compiling the batch evaluations to native code was asked for.  Whether they are compiled is up to the build, see jit::Available.
+		*/
+		bool UsingNativeCode() const
+		{
+			return use_native_code_;
+		}
+
+
+		/**
+		\brief Evaluate through kernels generated ahead of time for this system, by b2-codegen, see generated_system.hpp.
+
+		The functions, Jacobian and time derivatives, in double and multiple precision, are computed by the generated C++, with the constants read at the working precision.  The kernels take precedence over every other way of evaluating, except a straight-line homotopy's own, and are discarded when the system changes, as by homogenizing it.  The batch evaluations are unchanged.
+
+		\param kernels The kernels, see detail::MakeGeneratedKernels, or nullptr to stop using them.
+		\throws std::runtime_error if the inputs of the kernels are not the variables, path variable and implicit parameters of this system, by name.
+		*/
+		void UseGeneratedKernels(std::shared_ptr<detail::GeneratedKernels const> const& kernels);
+
+		/**
+		\brief Whether evaluation goes through generated kernels, see UseGeneratedKernels.
+		*/
+		bool EvaluatingGeneratedKernels() const
+		{
+			return bool(generated_kernels_);
+		}
+
+		/**
+		\brief The inputs of kernels generated for this system, in their order: the variables, then the path variable, if any, then the implicit parameters.
+		*/
+		VariableGroup GeneratedKernelInputs() const;
+
+
+		/**
+		\brief Evaluate the system at many points, in double precision.
+
+		The points are evaluated several at a time, through the program compiled from the functions alone, see StraightLineProgram::EvalFunctionsBatch.  When there are many points, this is much cheaper than calling Eval at each in turn.  The values of the variables set with SetVariables are not changed.
+
+		\param points The points, one per column.  Must have NumVariables() rows.
+		\return The function values, including patches, one column per point.
+
+		\throws std::runtime_error, if a path variable IS defined, or if the number of variables doesn't match.
+		*/
+		Mat<dbl> EvalBatch(Mat<dbl> const& points) const;
+
+		/**
+		\brief Evaluate the system at many points and values of the path variable, in double precision.
+
+		\param points The points, one per column.  Must have NumVariables() rows.
+		\param path_variable_values The values of the path variable, one per point.
+		\return The function values, including patches, one column per point.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the sizes don't match.
+		*/
+		Mat<dbl> EvalBatch(Mat<dbl> const& points, Vec<dbl> const& path_variable_values) const;
+
+		/**
+		\brief Evaluate the functions and patches, the Jacobian, and the derivatives with respect to the path variable, at the points of one batch, in double precision.
+
+		By forward-mode differentiation of the program compiled from the functions alone, see StraightLineProgram::EvalForwardModeBatch.  The values of the variables set with SetVariables are not changed.
+
+		\param inputs The points, NumVariables()+1 entries: the variables, then the path variable.
+		\param function_values Resized to NumTotalFunctions() entries.
+		\param jacobian Resized to NumTotalFunctions() times NumVariables() entries, row-major.
+		\param time_derivatives Resized to NumTotalFunctions() entries.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the number of inputs doesn't match.
+		*/
+		void EvalBatchWithDerivatives(BatchLanes const& inputs, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const;
+
+
+		/**
+		\brief Evaluate the system at many points, each at its own values of the implicit parameters, in double precision.
+
+		So one system evaluates many members of its family at once, as when sampling a parameter space.  The values of the implicit parameters set with SetImplicitParameters are not changed.
+
+		\param points The points, one per column.  Must have NumVariables() rows.
+		\param implicit_parameter_values The values of the implicit parameters, one column per point.  Must have NumImplicitParameters() rows.
+		\return The function values, including patches, one column per point.
+
+		\throws std::runtime_error, if a path variable IS defined, or if the sizes don't match.
+		*/
+		Mat<dbl> EvalBatchAtParameters(Mat<dbl> const& points, Mat<dbl> const& implicit_parameter_values) const;
+
+		/**
+		\brief Evaluate the system at many points, values of the path variable, and values of the implicit parameters, in double precision.
+
+		\param points The points, one per column.  Must have NumVariables() rows.
+		\param path_variable_values The values of the path variable, one per point.
+		\param implicit_parameter_values The values of the implicit parameters, one column per point.  Must have NumImplicitParameters() rows.
+		\return The function values, including patches, one column per point.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the sizes don't match.
+		*/
+		Mat<dbl> EvalBatchAtParameters(Mat<dbl> const& points, Vec<dbl> const& path_variable_values, Mat<dbl> const& implicit_parameter_values) const;
+
+		/**
+		\brief Evaluate the functions and patches, the Jacobian, and the derivatives with respect to the path variable, at the points of one batch, each lane at its own values of the implicit parameters.
+
+		As the overload without them, so that a tracker may carry paths of several members of a family of systems in one batch.
+
+		\param inputs The points, NumVariables()+1 entries: the variables, then the path variable.
+		\param implicit_parameter_values NumImplicitParameters() entries.
+		\param function_values Resized to NumTotalFunctions() entries.
+		\param jacobian Resized to NumTotalFunctions() times NumVariables() entries, row-major.
+		\param time_derivatives Resized to NumTotalFunctions() entries.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the number of inputs or implicit parameter values doesn't match.
+		*/
+		void EvalBatchWithDerivatives(BatchLanes const& inputs, BatchLanes const& implicit_parameter_values, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const;
+
+		/**
+		\brief Evaluate the functions and patches, the Jacobian, and the derivatives with respect to the path variable, at the points of one batch, in single precision.
+
+		As the overload in double precision, for the screening of easy steps of batch tracking, see BatchTracker::ScreenInSinglePrecision.  The patches are evaluated in double precision and rounded.
+		*/
+		void EvalBatchWithDerivatives(FloatBatchLanes const& inputs, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const;
+
+		/**
+		\brief Evaluate the functions and patches, the Jacobian, and the derivatives with respect to the path variable, at the points of one batch, in single precision, each lane at its own values of the implicit parameters.
+		*/
+		void EvalBatchWithDerivatives(FloatBatchLanes const& inputs, FloatBatchLanes const& implicit_parameter_values, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const;
+
+
+
+		/**
+		\brief The Taylor coefficients of the functions and patches along a curve in the variables, on which the path variable advances with the parameter of the curve.
+
+		The curve is \f$x(s) = \sum_k X_k s^k\f$, with \f$X_k\f$ the columns of variable_coefficients, at time \f$t+s\f$.  By truncated Taylor arithmetic through the program compiled from the functions alone, see StraightLineProgram::EvalTaylor, whatever the mode of evaluation otherwise.  The patches are linear, so their coefficients after the first are those of the variables, through their coefficient matrix.  The values of the variables set with SetVariables are not changed.
+
+		\param function_coefficients Resized to NumTotalFunctions() rows, and a column for each of variable_coefficients.
+		\param variable_coefficients The coefficients of the variables, NumVariables() rows, the coefficient of \f$s^k\f$ in column k.
+		\param time The value of the path variable at s=0.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the number of variables doesn't match.
+		*/
+		template<typename T, typename Derived>
+		void TaylorCoefficientsInPlace(Mat<T> & function_coefficients, Eigen::MatrixBase<Derived> const& variable_coefficients, T const& time) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must match");
+
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to evaluate Taylor coefficients of system along a curve, but no path variable defined.");
+			if (variable_coefficients.rows()!=NumVariables())
+				throw std::runtime_error("trying to evaluate Taylor coefficients of system along a curve, but number of variables doesn't match.");
+
+			const auto& program = GetForwardModeProgram();
+			if (!std::is_same<T,dbl>::value && program.precision()!=precision_)
+				program.precision(precision_);
+
+			const auto num_coefficients = variable_coefficients.cols();
+			function_coefficients.resize(NumTotalFunctions(), num_coefficients);
+			program.EvalTaylor(function_coefficients, variable_coefficients, time);
+
+			if (!IsPatched())
+				return;
+
+			const auto num_patches = NumTotalFunctions() - NumFunctions();
+			const Vec<T> x = variable_coefficients.col(0);
+			Vec<T> values(NumTotalFunctions());
+			patch_.EvalInPlace(values, x);
+			function_coefficients.col(0).tail(num_patches) = values.tail(num_patches);
+
+			if (num_coefficients>1)
+			{
+				Mat<T> patch_jacobian(num_patches, NumVariables());
+				patch_.JacobianInPlace(patch_jacobian, x);
+				function_coefficients.bottomRightCorner(num_patches, num_coefficients-1) = patch_jacobian*variable_coefficients.rightCols(num_coefficients-1);
+			}
+		}
+		
+		
+		
+		/**
+		 Evaluate the Jacobian matrix of the system, using the previous space and time values, in place.
+
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		*/
+		template<typename Derived>
+		void JacobianInPlace(Eigen::MatrixBase<Derived> & J) const
+		{
+			typedef typename Derived::Scalar T;
+
+			if(J.rows() != NumTotalFunctions() || J.cols() != NumVariables())
+			{
+				throw std::runtime_error("trying to evaluate jacobian of system in place, but input J doesn't have right number of columns or rows");
+			}
+			
+			auto cache = EvaluationCacheAtCurrentPoint<T>();
+			if (cache && cache->Copy(cache->jacobian, cache->have_jacobian, J))
+			{
+				++evaluation_cache_hits_;
+				return;
+			}
+
+			AdjustPrecisionForEvaluation<T>();
+
+			if (EvaluatingFusedHomotopy())
+				FusedHomotopyJacobianInPlace(J);
+			else if (generated_kernels_)
+				RunGeneratedKernel(generated_kernels_->jacobian, J);
+			else if (use_forward_mode_)
+				GetForwardModeProgram().EvalJacobianForwardMode(J);
+			else if (EvaluatingStraightLineProgram())
+				GetStraightLineProgram().EvalJacobian(J);
+			else if (EvaluatingPolynomialSystem())
+				GetPolynomialSystem().EvalJacobian(J);
+			else
+				JacobianTreesInPlace(J);
+				
+			if (IsPatched())
+				patch_.JacobianInPlace(J,std::get<Vec<T> >(current_variable_values_));
+
+			if (cache)
+				cache->Keep(cache->jacobian, cache->have_jacobian, J);
+		}
+
+		
+		
+		
+		
+		
+
+
+		/**
+		Evaluate the Jacobian matrix of the system, using the previous space and time values.
+
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		*/
+		template<typename T>
+		Mat<T> Jacobian() const
+		{
+
+			Mat<T> J(NumTotalFunctions(), NumVariables());
+			JacobianInPlace(J);
+
+			return J;
+		}
+
+		
+
+		
+		/**
+		 Evaluate the Jacobian matrix of the system, provided the system has no path variable defined.
+		 
+		 \throws std::runtime_error, if a path variable IS defined, but you didn't pass it a value.  Also throws if the number of variables doesn't match.
 		 \tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
 		 
 		 \param variable_values The values of the variables, for the evaluation.
@@ -532,6 +1144,144 @@ namespace bertini {
 			return J;
 		}
 
+
+
+		/**
+		\brief Get the structure of the Jacobian of the functions.
+
+		Entry (i,j) of the Jacobian can be nonzero only if function i depends on variable j.  The structure is found when the system is differentiated, so this differentiates if necessary.  Rows for the patches are not included.
+
+		\return For each function, the indices of the variables it depends on, in increasing order.
+		*/
+		std::vector< std::vector<unsigned> > const& JacobianStructure() const;
+
+
+		/**
+		\brief The number of entries of the Jacobian, including the rows for the patches, which are not identically zero.
+		*/
+		size_t NumJacobianNonzeros() const;
+
+
+		/**
+		\brief The structure of the Jacobian, including the rows for the patches, for the trackers to factor it sparsely or in a band, see PartialPivotLU::UseSparsity.
+
+		Empty if the system is not square, or too small or dense for a sparse factorization to pay and too wide in its reverse Cuthill-McKee order for a banded one, see detail::StructuredLUPays, or if it can't be differentiated to find out, as a copy made by CloneForThread before differentiating.  A straight-line homotopy evaluated through its target and start systems takes the union of theirs.
+
+		\return For each row of the Jacobian, the columns of its entries which may be nonzero.
+		*/
+		std::vector< std::vector<unsigned> > LinearSolveStructure() const;
+
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system as a sparse matrix, using the previous space and time values, in place.
+
+		Only the entries which are not identically zero, according to JacobianStructure and the patches, are stored.  When walking the trees, only those entries are evaluated.  The compiled program and forward mode evaluate the dense Jacobian, which is then compressed.
+
+		\tparam T the number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		\param J The matrix to fill.  Resized and given the structure of the Jacobian if it doesn't already have it.  A matrix filled by a previous call is overwritten without reallocating.
+		*/
+		template<typename T>
+		void SparseJacobianInPlace(SparseMat<T> & J) const
+		{
+			const auto& structure = JacobianStructure();
+
+			if (J.rows()!=NumTotalFunctions() || J.cols()!=NumVariables() || J.nonZeros()!=NumJacobianNonzeros() || !J.isCompressed())
+			{
+				std::vector< Eigen::Triplet<T> > entries;
+				entries.reserve(NumJacobianNonzeros());
+				for (unsigned ii = 0; ii < structure.size(); ++ii)
+					for (auto jj : structure[ii])
+						entries.push_back(Eigen::Triplet<T>(ii, jj, T(0)));
+
+				if (IsPatched())
+				{
+					unsigned counter(0);
+					for (unsigned ii = 0; ii < patch_.NumVariableGroups(); ++ii)
+						for (unsigned jj = 0; jj < patch_.VariableGroupSizes()[ii]; ++jj)
+							entries.push_back(Eigen::Triplet<T>(NumFunctions()+ii, counter++, T(0)));
+				}
+
+				J.resize(NumTotalFunctions(), NumVariables());
+				J.setFromTriplets(entries.begin(), entries.end());
+			}
+
+			AdjustPrecisionForEvaluation<T>();
+
+			if (EvaluatingFusedHomotopy() || generated_kernels_ || use_forward_mode_ || EvaluatingStraightLineProgram() || EvaluatingPolynomialSystem())
+			{
+				Mat<T> dense(NumTotalFunctions(), NumVariables());
+				JacobianInPlace(dense);
+				for (int jj = 0; jj < J.outerSize(); ++jj)
+					for (typename SparseMat<T>::InnerIterator iter(J, jj); iter; ++iter)
+						iter.valueRef() = dense(iter.row(), iter.col());
+				return;
+			}
+
+			ThrowIfSharingTrees();
+
+			const auto& vars = Variables();
+			ResetJacobianTrees();
+
+			for (unsigned jj = 0; jj < vars.size(); ++jj)
+			{
+				ResetDifferentialDependents();
+				for (auto ii : jacobian_columns_[jj])
+					jacobian_[ii]->entry_node()->EvalInPlace<T>(J.coeffRef(ii,jj), vars[jj]);
+			}
+
+			if (IsPatched())
+			{
+				unsigned counter(0);
+				for (unsigned ii = 0; ii < patch_.NumVariableGroups(); ++ii)
+				{
+					const auto& coefficients = patch_.Coefficients<T>(ii);
+					for (unsigned jj = 0; jj < patch_.VariableGroupSizes()[ii]; ++jj, ++counter)
+						J.coeffRef(NumFunctions()+ii, counter) = coefficients(jj);
+				}
+			}
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system as a sparse matrix, provided the system has no path variable defined.
+
+		\throws std::runtime_error, if a path variable IS defined, but you didn't pass it a value.  Also throws if the number of variables doesn't match.
+		\see SparseJacobianInPlace(SparseMat<T> &)
+		*/
+		template<typename T>
+		void SparseJacobianInPlace(SparseMat<T> & J, const Vec<T> & variable_values) const
+		{
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate jacobian, but number of variables doesn't match.");
+
+			if (HavePathVariable())
+				throw std::runtime_error("not using a time value for computation of jacobian, but a path variable is defined.");
+
+			SetVariables(variable_values);
+			SparseJacobianInPlace(J);
+		}
+
+
+		/**
+		\brief Evaluate the Jacobian matrix of the system as a sparse matrix, provided a path variable is defined for the system.
+
+		\throws std::runtime_error, if a path variable is NOT defined, and you passed it a value.  Also throws if the number of variables doesn't match.
+		\see SparseJacobianInPlace(SparseMat<T> &)
+		*/
+		template<typename T>
+		void SparseJacobianInPlace(SparseMat<T> & J, const Vec<T> & variable_values, const T & path_variable_value) const
+		{
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate jacobian, but number of variables doesn't match.");
+
+			if (!HavePathVariable())
+				throw std::runtime_error("trying to use a time value for computation of jacobian, but no path variable defined.");
+
+			SetVariables(variable_values);
+			SetPathVariable(path_variable_value);
+			SparseJacobianInPlace(J);
+		}
+
 		
 		/**
 		\brief Compute the time-derivative is a system. 
@@ -558,47 +1308,258 @@ namespace bertini {
 			if (!HavePathVariable())
 				throw std::runtime_error("computing time derivative of system with no path variable defined");
 
-			if (!is_differentiated_)
-				Differentiate();
-
 			SetVariables(variable_values.eval()); //TODO: remove this eval()
 			SetPathVariable(path_variable_value);
 
+			auto cache = EvaluationCacheAtCurrentPoint<T>();
+			if (cache && cache->Copy(cache->time_derivative, cache->have_time_derivative, ds_dt))
+			{
+				++evaluation_cache_hits_;
+				return;
+			}
 			
-			for (int ii = 0; ii < NumFunctions(); ++ii)
-				ds_dt(ii) = jacobian_[ii]->EvalJ<T>(path_variable_);
+			AdjustPrecisionForEvaluation<T>();
+
+			if (EvaluatingFusedHomotopy())
+				FusedHomotopyTimeDerivativeInPlace(ds_dt);
+			else if (generated_kernels_)
+				RunGeneratedKernel(generated_kernels_->time_derivative, ds_dt);
+			else if (use_forward_mode_)
+				GetForwardModeProgram().EvalTimeDerivativeForwardMode(ds_dt);
+			else if (EvaluatingStraightLineProgram())
+				GetStraightLineProgram().EvalTimeDerivative(ds_dt);
+			else if (EvaluatingPolynomialSystem())
+				GetPolynomialSystem().EvalTimeDerivative(ds_dt);
+			else
+				TimeDerivativeTreesInPlace(ds_dt);
 
 			if (IsPatched())
 				for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
 					ds_dt(ii+NumFunctions()) = T(0);
-			
+
+			if (cache)
+				cache->Keep(cache->time_derivative, cache->have_time_derivative, ds_dt);
+		}
+
+		
+		
+		
+		
+		
+		/**
+		\brief Compute the time-derivative is a system. 
+		
+		If \f$S\f$ is the system, and \f$t\f$ is the path variable this computes \f$\frac{dS}{dt}\f$.
+
+		\tparam T The number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
+		\throws std::runtime error if the system does not have a path variable defined.
+		*/
+		template<typename Derived, typename T>
+		Vec<T> TimeDerivative(const Eigen::MatrixBase<Derived> & variable_values, const T & path_variable_value) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
+
+			if (!HavePathVariable())
+				throw std::runtime_error("computing time derivative of system with no path variable defined");
+
+
+			Vec<T> ds_dt(NumTotalFunctions());
+			TimeDerivativeInPlace(ds_dt, variable_values, path_variable_value);
+			return ds_dt;
+		}
+
+
+
+		/**
+		\brief Evaluate the functions and the Jacobian of the system together, using the previously set variable (and time) values, in place.
+
+		Equivalent to EvalInPlace followed by JacobianInPlace, but when evaluating through a compiled program the function values are computed once and shared by the Jacobian.  In forward mode, and for a PolynomialSystem, both come from a single sweep.  The rows of the patches are filled together, in one pass over their coefficients.
+
+		\param function_values The vector into which to write the function values.  Must have at least NumTotalFunctions() entries.
+		\param J The matrix into which to write the Jacobian.  Must be NumTotalFunctions() by NumVariables().
+		*/
+		template<typename Derived, typename OtherDerived>
+		void EvalAndJacobianInPlace(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J) const
+		{
+			typedef typename Derived::Scalar T;
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+
+			const bool compiled = !use_forward_mode_ && EvaluatingStraightLineProgram();
+			const bool polynomial = !use_forward_mode_ && !compiled && EvaluatingPolynomialSystem();
+
+			if(function_values.size() < NumFunctions())
+			{
+				std::stringstream ss;
+				ss << "trying to evaluate system and jacobian in place, but number of input functions (" << function_values.size() << ") doesn't match number of system functions (" << NumFunctions() << ").";
+				throw std::runtime_error(ss.str());
+			}
+			if(J.rows() != NumTotalFunctions() || J.cols() != NumVariables())
+				throw std::runtime_error("trying to evaluate system and jacobian in place, but input J doesn't have right number of columns or rows");
+
+			auto cache = EvaluationCacheAtCurrentPoint<T>();
+			if (cache && cache->have_values && cache->have_jacobian
+			    && cache->Copy(cache->values, cache->have_values, function_values) && cache->Copy(cache->jacobian, cache->have_jacobian, J))
+			{
+				++evaluation_cache_hits_;
+				return;
+			}
+
+			AdjustPrecisionForEvaluation<T>();
+
+			if (EvaluatingFusedHomotopy())
+				FusedHomotopyEvalAndJacobianInPlace(function_values, J);
+			else if (generated_kernels_)
+			{
+				RunGeneratedKernel(generated_kernels_->eval, function_values);
+				RunGeneratedKernel(generated_kernels_->jacobian, J);
+			}
+			else if (use_forward_mode_)
+				GetForwardModeProgram().EvalForwardMode(function_values, J);
+			else if (polynomial)
+				GetPolynomialSystem().EvalFunctionsAndJacobian(function_values, J);
+			else if (compiled)
+				GetStraightLineProgram().EvalFunctionsAndJacobian(function_values, J);
+			else
+			{
+				// the trees have nothing to share between the two, since the Jacobian trees are reset for every column.
+				EvalTreesInPlace(function_values);
+				JacobianTreesInPlace(J);
+			}
+
+			// the patch rows are filled in one pass, for all the evaluators
+			if (IsPatched())
+				patch_.EvalAndJacobianInPlace(function_values, J, std::get<Vec<T> >(current_variable_values_));
+
+			if (cache)
+			{
+				cache->Keep(cache->values, cache->have_values, function_values);
+				cache->Keep(cache->jacobian, cache->have_jacobian, J);
+			}
+		}
+
+
+		/**
+		\brief Evaluate the functions and the Jacobian of the system together, in place.
+
+		The variables are set once, for both.
+
+		\throws std::runtime_error, if a path variable IS defined, or if the number of variables doesn't match.
+		*/
+		template<typename Derived, typename OtherDerived, typename ThirdDerived>
+		void EvalAndJacobianInPlace(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J, const Eigen::MatrixBase<ThirdDerived> & variable_values) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, typename ThirdDerived::Scalar>::value, "scalar types must be the same");
+
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate system and jacobian, but number of variables doesn't match.");
+			if (have_path_variable_)
+				throw std::runtime_error("not using a time value for evaluation of system and jacobian, but a path variable is defined.");
+
+			SetVariables(variable_values.eval());//TODO: remove this eval
+			EvalAndJacobianInPlace(function_values, J);
+		}
+
+
+		/**
+		\brief Evaluate the functions and the Jacobian of the system together, provided a path variable is defined for the system, in place.
+
+		The variables and path variable are set once, for both.  This is what Newton's method needs at each iteration.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the number of variables doesn't match.
+		*/
+		template<typename Derived, typename OtherDerived, typename ThirdDerived, typename T>
+		void EvalAndJacobianInPlace(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J, const Eigen::MatrixBase<ThirdDerived> & variable_values, const T & path_variable_value) const
+		{
+			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename ThirdDerived::Scalar, T>::value, "scalar types must be the same");
+
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate system and jacobian, but number of variables doesn't match.");
+			if (!have_path_variable_)
+				throw std::runtime_error("trying to use a time value for evaluation of system and jacobian, but no path variable defined.");
+
+			SetVariables(variable_values.eval());//TODO: remove this eval
+			SetPathVariable(path_variable_value);
+			EvalAndJacobianInPlace(function_values, J);
 		}
 
-		
-		
-		
-		
-		
+
 		/**
-		\brief Compute the time-derivative is a system. 
-		
-		If \f$S\f$ is the system, and \f$t\f$ is the path variable this computes \f$\frac{dS}{dt}\f$.
+		\brief Compute the Jacobian and the time-derivative of the system together, in place.
 
-		\tparam T The number-type for return.  Probably dbl=std::complex<double>, or mpfr=bertini::complex.
-		\throws std::runtime error if the system does not have a path variable defined.
+		The variables and path variable are set once, for both, and when evaluating through a compiled program the function values underlying both are computed once.  In forward mode, both come from a single sweep.  This is what the right-hand side of the Davidenko differential equation needs.
+
+		\param J The matrix into which to write the Jacobian.  Must be NumTotalFunctions() by NumVariables().
+		\param ds_dt The vector into which to write the time derivative.  Must have at least NumTotalFunctions() entries.
+		\param variable_values The values of the variables.
+		\param path_variable_value The value of the path variable.
+
+		\throws std::runtime_error, if a path variable is NOT defined, or if the sizes don't match.
 		*/
-		template<typename Derived, typename T>
-		Vec<T> TimeDerivative(const Eigen::MatrixBase<Derived> & variable_values, const T & path_variable_value) const
+		template<typename Derived, typename OtherDerived, typename ThirdDerived, typename T>
+		void JacobianAndTimeDerivativeInPlace(Eigen::MatrixBase<Derived> & J, Eigen::MatrixBase<OtherDerived> & ds_dt, const Eigen::MatrixBase<ThirdDerived> & variable_values, const T & path_variable_value) const
 		{
 			static_assert(std::is_same<typename Derived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename OtherDerived::Scalar, T>::value, "scalar types must be the same");
+			static_assert(std::is_same<typename ThirdDerived::Scalar, T>::value, "scalar types must be the same");
 
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate jacobian and time derivative, but number of variables doesn't match.");
 			if (!HavePathVariable())
 				throw std::runtime_error("computing time derivative of system with no path variable defined");
+			if(J.rows() != NumTotalFunctions() || J.cols() != NumVariables())
+				throw std::runtime_error("trying to evaluate jacobian and time derivative in place, but input J doesn't have right number of columns or rows");
+			if(ds_dt.size() < NumTotalFunctions())
+			{
+				std::stringstream ss;
+				ss << "trying to evaluate jacobian and time derivative in place, but number of entries of ds_dt (" << ds_dt.size() << ") doesn't match number of system functions (" << NumTotalFunctions() << ").";
+				throw std::runtime_error(ss.str());
+			}
+
+			SetVariables(variable_values.eval()); //TODO: remove this eval()
+			SetPathVariable(path_variable_value);
 
+			auto cache = EvaluationCacheAtCurrentPoint<T>();
+			if (cache && cache->have_jacobian && cache->have_time_derivative
+			    && cache->Copy(cache->jacobian, cache->have_jacobian, J) && cache->Copy(cache->time_derivative, cache->have_time_derivative, ds_dt))
+			{
+				++evaluation_cache_hits_;
+				return;
+			}
 
-			Vec<T> ds_dt(NumTotalFunctions());
-			TimeDerivativeInPlace(ds_dt, variable_values, path_variable_value);
-			return ds_dt;
+			AdjustPrecisionForEvaluation<T>();
+
+			if (EvaluatingFusedHomotopy())
+				FusedHomotopyJacobianAndTimeDerivativeInPlace(J, ds_dt);
+			else if (generated_kernels_)
+			{
+				RunGeneratedKernel(generated_kernels_->jacobian, J);
+				RunGeneratedKernel(generated_kernels_->time_derivative, ds_dt);
+			}
+			else if (use_forward_mode_)
+				GetForwardModeProgram().EvalJacobianAndTimeDerivativeForwardMode(J, ds_dt);
+			else if (EvaluatingStraightLineProgram())
+				GetStraightLineProgram().EvalJacobianAndTimeDerivative(J, ds_dt);
+			else if (EvaluatingPolynomialSystem())
+				GetPolynomialSystem().EvalJacobianAndTimeDerivative(J, ds_dt);
+			else
+			{
+				JacobianTreesInPlace(J);
+				TimeDerivativeTreesInPlace(ds_dt);
+			}
+
+			if (IsPatched())
+			{
+				patch_.JacobianInPlace(J,std::get<Vec<T> >(current_variable_values_));
+				for (int ii = 0; ii < NumTotalVariableGroups(); ++ii)
+					ds_dt(ii+NumFunctions()) = T(0);
+			}
+
+			if (cache)
+			{
+				cache->Keep(cache->jacobian, cache->have_jacobian, J);
+				cache->Keep(cache->time_derivative, cache->have_time_derivative, ds_dt);
+			}
 		}
 	
 		/**
@@ -754,6 +1715,7 @@ namespace bertini {
 			}
 
 			std::get<Vec<T> >(current_variable_values_) = new_values;
+			variables_changed_ = true;
 		}
 
 
@@ -773,6 +1735,8 @@ namespace bertini {
 				throw std::runtime_error("trying to set the value of the path variable, but one is not defined for this system");
 
 			path_variable_->set_current_value(new_value);
+			std::get<T>(current_path_variable_value_) = new_value;
+			path_variable_changed_ = true;
 		}
 
 
@@ -793,6 +1757,8 @@ namespace bertini {
 			size_t counter = 0;
 			for (auto iter=implicit_parameters_.begin(); iter!=implicit_parameters_.end(); iter++, counter++)
 				(*iter)->set_current_value(new_values(counter));
+			implicit_parameters_changed_ = true;
+			ForgetEvaluations();
 
 		}
 
@@ -920,6 +1886,17 @@ namespace bertini {
 		void AddFunctions(std::vector<Fn> const& F);
 
 
+		/**
+		 Put a function in place of one of the system's.  The rows of the Jacobian of the other functions are kept, see Differentiate.
+
+		 \param index The index of the function to replace.
+		 \param F The function to put in its place.
+
+		 \throws std::out_of_range if there is no function with the index.
+		 */
+		void ReplaceFunction(size_t index, Fn const& F);
+
+
 
 
 
@@ -1022,192 +1999,596 @@ namespace bertini {
 
 		 This is just as scary as you think it is.  It is up to you to make sure the function at this index exists.
 		*/
-		auto Function(unsigned index) const
-		{
-			return functions_[index];
-		}
+		auto Function(unsigned index) const
+		{
+			return functions_[index];
+		}
+
+		
+
+		/**
+		 Get the affine variable groups in the problem.
+		*/
+		auto VariableGroups() const
+		{
+			return variable_groups_;
+		}
+
+		/**
+		 Get the homogeneous (projective) variable groups in the problem.
+		*/
+		auto HomVariableGroups() const
+		{
+			return hom_variable_groups_;
+		}
+
+		/**
+		Compute an estimate of an upper bound of the absolute values of the coefficients in the system.
+		
+		\param num_evaluations The number of times to compute this estimate.  Default is 1.
+		\returns An upper bound on the absolute values of the coefficients.
+		*/
+        mpfr_float CoefficientBound(unsigned num_evaluations=1) const;
+
+
+        /**
+         \brief Compute an upper bound on the degree of the system.  
+
+         This number will be wrong if the system is non-polynomial, because degree for non-polynomial systems is not defined.
+         */
+        int DegreeBound() const;
+
+		/**
+		 \brief Get the degrees of the functions in the system, with respect to all variables.
+
+		 \return A vector containing the degrees of the functions.  Negative numbers indicate the function is non-polynomial.
+		*/
+		 std::vector<int> Degrees() const;
+
+		 /**
+		 \brief Get the degrees of the functions in the system, with respect to a group of variables.
+
+		 \return A vector containing the degrees of the functions.  Negative numbers indicate the function is non-polynomial.
+		 \param vars A group of variables with respect to which you wish to compute degrees.  Needs not be a group with respect to the system.
+		*/
+		 std::vector<int> Degrees(VariableGroup const& vars) const;
+
+		/**
+		 \brief Sort the functions so they are in DEcreasing order by degree
+		*/
+		void ReorderFunctionsByDegreeDecreasing();
+
+
+		/**
+		 \brief Sort the functions so they are in INcreasing order by degree
+		*/
+		void ReorderFunctionsByDegreeIncreasing();
+
+
+
+
+
+		/////////////
+		//
+		//  Functions regarding patches.
+		//
+		//////////////
+
+
+
+
+
+		/**
+		\brief Let the system patch itself by the selected variable ordering, using the current variable groups.  
+
+		Homogeneous variable groups and affine variable groups will be supplied a patch equation.  Ungrouped variables will not.
+
+		\todo Add example code for how to use this function.
+		*/
+		void AutoPatch()
+		{
+			AutoPatchFIFO();
+		}
+
+		/**
+		\brief Copy the patches from another system into this one.
+		*/
+		void CopyPatches(System const& other);
+
+
+		Patch GetPatch() const
+		{
+			return patch_;
+		}
+
+		/**
+		\brief Query whether a system is patched.
+		*/
+		bool IsPatched() const
+		{
+			return is_patched_;
+		}
+
+
+		template <typename T>
+		Vec<T> RescalePointToFitPatch(Vec<T> const& x) const
+		{
+			return patch_.RescalePoint(x);
+		}
+
+
+		template<typename T>
+		void RescalePointToFitPatchInPlace(Vec<T> & x) const
+		{
+			patch_.RescalePointToFitInPlace(x);
+		}
+		/**
+		 \brief Overloaded operator for printing to an arbirtary out stream.
+		 */
+		friend std::ostream& operator <<(std::ostream& out, const System & s);
+
+
+		/**
+		 \brief Clear the entire structure of variables in a system.  Reconstructing it is up to you.
+		*/
+		void ClearVariables();
+
+
+		/**
+		 \brief Copy the entire structure of variables from within one system to another.
+
+		  This copies everything -- ungrouped variables, variable groups, homogenizing variables, the path variable, the ordering of the variables.
+
+		  \param other Another system from which to copy the variable structure.  
+
+		  This operation does NOT affect the functions in any way.  It is up to the user to make the functions actually depend on these variables.
+		*/ 
+		void CopyVariableStructure(System const& other);
+		
+
+		/**
+		\brief Add two systems together.
+
+		\throws std::runtime_error, if the systems are not of compatible size -- either in number of functions, or variables.  Does not check the structure of the variables, just the numbers.
+		
+		\throws std::runtime_error, if the patches are not compatible.  The patches must be either the same, absent, or present in one system.  They propagate to the resulting system.
+		*/
+		System& operator+=(System const& rhs);
+
+		/**
+		\brief Add two systems together.
+
+		\throws std::runtime_error, if the systems are not of compatible size -- either in number of functions, or variables.  Does not check the structure of the variables, just the numbers.
+
+		\see The += operator for System also.
+		*/
+		friend const System operator+(System lhs, System const& rhs);
+
+		/**
+		\brief Multiply a system by an arbitrary node.  
+
+		Can be used for defining a coupling of a target and start system through a path variable.  Does not affect path variable declaration, or anything else.  It is up to you to ensure the system depends on this node properly.
+		*/
+		System& operator*=(Nd const& N);
+
+		/**
+		\brief Multiply a system by an arbitrary node.  
+
+		Can be used for defining a coupling of a target and start system through a path variable.  Does not affect path variable declaration, or anything else.  It is up to you to ensure the system depends on this node properly.
+		*/
+		friend const System operator*(System s, Nd const&  N);
+
+		/**
+		\brief Multiply a system by an arbitrary node.  
+
+		Can be used for defining a coupling of a target and start system through a path variable.  Does not affect path variable declaration, or anything else.  It is up to you to ensure the system depends on this node properly.
+		*/
+		friend const System operator*(Nd const&  N, System const& s);
+	private:
+
+		/**
+		\brief Reset the stored values of the nodes of the function trees which depend on whatever was set since the last evaluation of the trees.
+
+		The first time through, and after any change to the system or a call to ForgetStoredValues, resets everything, and records which nodes depend on the variables, the path variable, and the implicit parameters.  Nodes depending on none of these, such as constant subfunctions, keep their values from one evaluation to the next, until another Variable of the trees is given a value with set_current_value, which resets everything again.
+		*/
+		void ResetChangedFunctionValues() const;
+
+		/**
+		\brief Reset all the function trees and find what depends on what, unless already done since the system last changed.
+		*/
+		void EnsureFunctionDependencies() const;
+
+		/**
+		\brief Check whether a Variable of the trees which the system does not set has been set since last checked, and if so, forget the last evaluations, and reset the trees at their next walk.
+
+		A copy made by CloneForThread checks the Variables found in the trees of the original when it was made.
+		*/
+		void NoteChangedLeaves() const;
+
+		/**
+		\brief Give this copy of original variable nodes of its own, and copies of original's compiled forms reading them.  Used by CloneForThread.
+		*/
+		void MakeEvaluationPrivate(System const& original);
+
+		/**
+		\brief The nodes of the function trees, each once, in an order set by the shapes of the trees alone, so the same for a copy read back from an archive.  Numbers the constants of a program in a shared image, see SaveSharedSystem.
+
+		\throws std::runtime_error if the trees hold a node whose children are unknown.
+		*/
+		std::vector<Nd> FunctionTreeNodes() const;
 
-		
+		/**
+		\brief Hand evaluation_team_ to the compiled forms there are, and the parts of a straight-line homotopy.
+		*/
+		void ShareEvaluationTeam() const;
 
 		/**
-		 Get the affine variable groups in the problem.
+		\brief Discard the Jacobian, as for a change to the system other than of some of its functions, after which no row of it can be kept.
 		*/
-		auto VariableGroups() const
+		void ForgetDerivatives() const
 		{
-			return variable_groups_;
+			is_differentiated_ = false;
+			jacobian_.clear();
+			have_jacobian_dependencies_ = false;
 		}
 
 		/**
-		 Get the homogeneous (projective) variable groups in the problem.
+		\brief Refuse to walk the trees of a system made by CloneForThread, whose trees belong to another, and do not read its variables.
 		*/
-		auto HomVariableGroups() const
+		void ThrowIfSharingTrees() const
 		{
-			return hom_variable_groups_;
+			if (shares_trees_)
+				throw std::runtime_error("trying to walk the function trees of a system made by CloneForThread, which shares them with the original.  such a copy can only be evaluated through the compiled form it was made with.");
 		}
 
 		/**
-		Compute an estimate of an upper bound of the absolute values of the coefficients in the system.
-		
-		\param num_evaluations The number of times to compute this estimate.  Default is 1.
-		\returns An upper bound on the absolute values of the coefficients.
+		\brief Find which variables each function depends on, for the structure of the Jacobian.
 		*/
-        mpfr_float CoefficientBound(unsigned num_evaluations=1) const;
+		void ComputeJacobianStructure() const;
 
+		/**
+		\brief The affine variable groups, each with its homogenizing variable put in front, if the system has them.
+		*/
+		std::vector<VariableGroup> GroupsWithHomVariables() const;
 
-        /**
-         \brief Compute an upper bound on the degree of the system.  
+		/**
+		\brief Record, for each of the variables, the path variable, and the implicit parameters, the nodes of the function trees which depend on them.
+		*/
+		void ComputeFunctionDependencies() const;
 
-         This number will be wrong if the system is non-polynomial, because degree for non-polynomial systems is not defined.
-         */
-        int DegreeBound() const;
+		/**
+		\brief Record the nodes of the Jacobian trees which depend on a differential, and the rows of each column of the Jacobian which are not identically zero.
+		*/
+		void ComputeJacobianDependencies() const;
 
 		/**
-		 \brief Get the degrees of the functions in the system, with respect to all variables.
+		\brief Reset the stored values of all the nodes of the Jacobian trees, for an evaluation at a new point.
+		*/
+		void ResetJacobianTrees() const;
 
-		 \return A vector containing the degrees of the functions.  Negative numbers indicate the function is non-polynomial.
+		/**
+		\brief Reset the stored values of the nodes of the Jacobian trees which depend on a differential, for an evaluation of the trees with respect to another variable.  The others keep their values.
 		*/
-		 std::vector<int> Degrees() const;
+		void ResetDifferentialDependents() const
+		{
+			for (const auto& iter : differential_dependents_)
+				iter->ResetStoredValues();
+		}
 
-		 /**
-		 \brief Get the degrees of the functions in the system, with respect to a group of variables.
+		/**
+		\brief Evaluate the functions and patches at a batch of points, the rows of inputs being the variables and then the path variable if there is one.
 
-		 \return A vector containing the degrees of the functions.  Negative numbers indicate the function is non-polynomial.
-		 \param vars A group of variables with respect to which you wish to compute degrees.  Needs not be a group with respect to the system.
+		\param implicit_parameter_values If not null, the values of the implicit parameters, one column per point.  Otherwise those set are used.
 		*/
-		 std::vector<int> Degrees(VariableGroup const& vars) const;
+		Mat<dbl> EvalBatchInputs(Mat<dbl> const& inputs, Mat<dbl> const* implicit_parameter_values = nullptr) const;
 
 		/**
-		 \brief Sort the functions so they are in DEcreasing order by degree
+		\brief Evaluate the functions and patches, the Jacobian and the time derivatives at a batch of points, the implicit parameters varying by lane if their values are not null.
 		*/
-		void ReorderFunctionsByDegreeDecreasing();
-
+		template<typename S>
+		void EvalBatchWithDerivativesAt(BasicBatchLanes<S> const& inputs, BasicBatchLanes<S> const* implicit_parameter_values, BasicBatchLanes<S> & function_values, BasicBatchLanes<S> & jacobian, BasicBatchLanes<S> & time_derivatives) const;
 
 		/**
-		 \brief Sort the functions so they are in INcreasing order by degree
+		\brief Run a generated kernel at the current values of the inputs, writing its outputs into the first rows of destination, row by row.
 		*/
-		void ReorderFunctionsByDegreeIncreasing();
-
+		template<typename Derived>
+		void RunGeneratedKernel(std::tuple< detail::GeneratedKernels::Kernel<dbl>, detail::GeneratedKernels::Kernel<mpfr> > const& kernel, Eigen::MatrixBase<Derived> & destination) const
+		{
+			using T = typename Derived::Scalar;
 
+			auto& inputs = std::get<std::vector<T> >(generated_inputs_);
+			auto& outputs = std::get<std::vector<T> >(generated_outputs_);
+			const auto& constants = std::get<std::vector<T> >(generated_constants_);
 
+			inputs.clear();
+			for (const auto& v : Variables())
+				inputs.push_back(v->Eval<T>());
+			if (have_path_variable_)
+				inputs.push_back(path_variable_->Eval<T>());
+			for (const auto& v : implicit_parameters_)
+				inputs.push_back(v->Eval<T>());
 
+			const auto num_columns = destination.cols()==1 ? 1 : NumVariables();
+			outputs.resize(NumFunctions()*num_columns);
+			std::get<detail::GeneratedKernels::Kernel<T> >(kernel)(inputs.data(), constants.data(), outputs.data());
 
-		/////////////
-		//
-		//  Functions regarding patches.
-		//
-		//////////////
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				for (unsigned jj = 0; jj < num_columns; ++jj)
+					destination(ii,jj) = outputs[ii*num_columns+jj];
+		}
 
+		/**
+		\brief Read the constants of the generated kernels at the working precision, if they are not there already.
+		*/
+		void AdjustGeneratedConstants() const;
 
+		/**
+		\brief Whether the trees can be compiled into a StraightLineProgram.
 
+		Differentiates the system and compiles the program if necessary.  Only a node type the program cannot compile counts as a failure, and is remembered until the system is differentiated again.
 
+		\throws std::runtime_error from compiling, for any reason other than an UnsupportedNodeError.
+		*/
+		bool HaveStraightLineProgram() const;
 
 		/**
-		\brief Let the system patch itself by the selected variable ordering, using the current variable groups.  
-
-		Homogeneous variable groups and affine variable groups will be supplied a patch equation.  Ungrouped variables will not.
-
-		\todo Add example code for how to use this function.
+		\brief Whether evaluation goes through the compiled StraightLineProgram, either because it was asked for, or by default for systems which are not evaluated through their PolynomialSystem.
 		*/
-		void AutoPatch()
+		bool EvaluatingStraightLineProgram() const
 		{
-			AutoPatchFIFO();
+			return use_straight_line_program_ || ((use_compiled_evaluation_ || use_compensated_evaluation_) && !EvaluatingPolynomialSystem() && HaveStraightLineProgram());
 		}
 
 		/**
-		\brief Copy the patches from another system into this one.
+		\brief Whether evaluation goes through the PolynomialSystem, rather than the trees.  Not when compensating, unless the system cannot be compiled.
 		*/
-		void CopyPatches(System const& other);
-
-
-		Patch GetPatch() const
+		bool EvaluatingPolynomialSystem() const
 		{
-			return patch_;
+			return use_polynomial_system_ && !(use_compensated_evaluation_ && HaveStraightLineProgram()) && HavePolynomialSystem();
 		}
 
 		/**
-		\brief Query whether a system is patched.
+		\brief The last evaluations in one number type, and the point, time, and precision at which they were made.  See UseEvaluationCache.
 		*/
-		bool IsPatched() const
+		template<typename T>
+		struct EvaluationCache
 		{
-			return is_patched_;
-		}
+			Vec<T> point;
+			T time;
+			unsigned precision = 0;
+			bool have_point = false;
+
+			Vec<T> values;
+			Mat<T> jacobian;
+			Vec<T> time_derivative;
+			bool have_values = false;
+			bool have_jacobian = false;
+			bool have_time_derivative = false;
+
+			void Forget()
+			{
+				have_point = have_values = have_jacobian = have_time_derivative = false;
+			}
 
+			/**
+			\brief Copy a kept evaluation out, if there is one of the shape asked for.
+			*/
+			template<typename StoredT, typename Derived>
+			static bool Copy(StoredT const& stored, bool have, Eigen::MatrixBase<Derived> & result)
+			{
+				if (!have || stored.rows()!=result.rows() || stored.cols()!=result.cols())
+					return false;
+				result = stored;
+				return true;
+			}
 
-		template <typename T>
-		Vec<T> RescalePointToFitPatch(Vec<T> const& x) const
-		{
-			return patch_.RescalePoint(x);
-		}
+			template<typename StoredT, typename Derived>
+			static void Keep(StoredT & stored, bool & have, Eigen::MatrixBase<Derived> const& result)
+			{
+				stored = result;
+				have = true;
+			}
+		};
 
+		/**
+		\brief Get the cache of the last evaluations in a number type, emptied first unless they were made at the point, time, and precision now set.
 
+		\return nullptr if the cache is not in use, or the variables have not been set.
+		*/
 		template<typename T>
-		void RescalePointToFitPatchInPlace(Vec<T> & x) const
+		EvaluationCache<T>* EvaluationCacheAtCurrentPoint() const
 		{
-			patch_.RescalePointToFitInPlace(x);
+			if (!use_evaluation_cache_)
+				return nullptr;
+
+			NoteChangedLeaves();
+
+			const auto& x = std::get<Vec<T> >(current_variable_values_);
+			if (x.size()!=NumVariables())
+				return nullptr;
+
+			auto& cache = std::get<EvaluationCache<T> >(evaluation_cache_);
+			const auto& t = std::get<T>(current_path_variable_value_);
+
+			bool same = cache.have_point && cache.point.size()==x.size()
+			            && (std::is_same<T,dbl>::value || cache.precision==precision_)
+			            && (!have_path_variable_ || cache.time==t);
+			for (int ii = 0; same && ii < x.size(); ++ii)
+				same = cache.point(ii)==x(ii);
+
+			if (!same)
+			{
+				cache.Forget();
+				cache.point = x;
+				cache.time = t;
+				cache.precision = precision_;
+				cache.have_point = true;
+			}
+			return &cache;
 		}
+
 		/**
-		 \brief Overloaded operator for printing to an arbirtary out stream.
-		 */
-		friend std::ostream& operator <<(std::ostream& out, const System & s);
+		\brief Whether evaluation goes through the parts of a straight-line homotopy, rather than its own trees.
+		*/
+		bool EvaluatingFusedHomotopy() const
+		{
+			return use_fused_homotopy_ && homotopy_parts_;
+		}
 
+		/**
+		\brief Evaluate a straight-line homotopy from its parts, using the previously set variable and time values.  Does not include patches.
+
+		Defined after detail::StraightLineHomotopyParts, below.
+		*/
+		template<typename Derived>
+		void FusedHomotopyEvalInPlace(Eigen::MatrixBase<Derived> & function_values) const;
 
 		/**
-		 \brief Clear the entire structure of variables in a system.  Reconstructing it is up to you.
+		\brief Evaluate the Jacobian of a straight-line homotopy from the Jacobians of its parts.  Does not include patches.
 		*/
-		void ClearVariables();
+		template<typename Derived>
+		void FusedHomotopyJacobianInPlace(Eigen::MatrixBase<Derived> & J) const;
 
+		/**
+		\brief Evaluate the time derivative of a straight-line homotopy from the values of its parts.  Does not include patches.
+		*/
+		template<typename Derived>
+		void FusedHomotopyTimeDerivativeInPlace(Eigen::MatrixBase<Derived> & ds_dt) const;
 
 		/**
-		 \brief Copy the entire structure of variables from within one system to another.
+		\brief Evaluate a straight-line homotopy and its Jacobian from its parts, each part evaluated once for both.  Does not include patches.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void FusedHomotopyEvalAndJacobianInPlace(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J) const;
 
-		  This copies everything -- ungrouped variables, variable groups, homogenizing variables, the path variable, the ordering of the variables.
+		/**
+		\brief Evaluate the Jacobian and time derivative of a straight-line homotopy from its parts, each part evaluated once for both.  Does not include patches.
+		*/
+		template<typename Derived, typename OtherDerived>
+		void FusedHomotopyJacobianAndTimeDerivativeInPlace(Eigen::MatrixBase<Derived> & J, Eigen::MatrixBase<OtherDerived> & ds_dt) const;
 
-		  \param other Another system from which to copy the variable structure.  
+		/**
+		\brief Bring the form of the system used for evaluation to the working precision, if a change is pending.  Nothing to do for double.
+		*/
+		template<typename T>
+		void AdjustPrecisionForEvaluation() const
+		{
+			if (!std::is_same<T,dbl>::value)
+				AdjustPrecisionOfEvaluator();
+		}
 
-		  This operation does NOT affect the functions in any way.  It is up to the user to make the functions actually depend on these variables.
-		*/ 
-		void CopyVariableStructure(System const& other);
-		
+		/**
+		\brief Bring whichever of the forward mode program, the compiled program, the polynomial system, or the trees is used for evaluation to the working precision, leaving the others as they are.
+		*/
+		void AdjustPrecisionOfEvaluator() const;
 
 		/**
-		\brief Add two systems together.
+		\brief The StraightLineProgram, at the working precision, for evaluation in real arithmetic.
 
-		\throws std::runtime_error, if the systems are not of compatible size -- either in number of functions, or variables.  Does not check the structure of the variables, just the numbers.
-		
-		\throws std::runtime_error, if the patches are not compatible.  The patches must be either the same, absent, or present in one system.  They propagate to the resulting system.
+		\throws std::runtime_error if the system does not have real coefficients.
 		*/
-		System& operator+=(System const& rhs);
+		StraightLineProgram const& RealStraightLineProgram() const;
 
 		/**
-		\brief Add two systems together.
-
-		\throws std::runtime_error, if the systems are not of compatible size -- either in number of functions, or variables.  Does not check the structure of the variables, just the numbers.
+		\brief The complex number type whose real part a real type is.
+		*/
+		template<typename RealType>
+		using ComplexOf = typename std::conditional<std::is_same<RealType,double>::value, dbl, mpfr>::type;
 
-		\see The += operator for System also.
+		/**
+		\brief Set the variables to real values, as complex numbers at the precision of the system, if multiple.
 		*/
-		friend const System operator+(System lhs, System const& rhs);
+		template<typename RealType>
+		void SetRealVariables(Vec<RealType> const& variable_values) const
+		{
+			if (variable_values.size()!=NumVariables())
+				throw std::runtime_error("trying to evaluate system, but number of variables doesn't match.");
+
+			Vec<ComplexOf<RealType> > x = variable_values.template cast<ComplexOf<RealType> >();
+			if (!std::is_same<RealType,double>::value)
+				Precision(x, precision_);
+			SetVariables(x);
+		}
+
+		template<typename RealType>
+		void SetRealPathVariable(RealType const& path_variable_value) const
+		{
+			ComplexOf<RealType> t(path_variable_value);
+			if (!std::is_same<RealType,double>::value)
+				Precision(t, precision_);
+			SetPathVariable(t);
+		}
 
 		/**
-		\brief Multiply a system by an arbitrary node.  
+		\brief Change the precision of all the nodes of the trees -- functions, subfunctions, parameters, constants, and the Jacobian.
+		*/
+		void AdjustTreePrecision() const;
 
-		Can be used for defining a coupling of a target and start system through a path variable.  Does not affect path variable declaration, or anything else.  It is up to you to ensure the system depends on this node properly.
+		/**
+		\brief Evaluate the functions by walking their trees, using the previously set variable (and time) values.  Does not include patches.
 		*/
-		System& operator*=(Nd const& N);
+		template<typename Derived>
+		void EvalTreesInPlace(Eigen::MatrixBase<Derived> & function_values) const
+		{
+			typedef typename Derived::Scalar T;
+
+			ThrowIfSharingTrees();
+			ResetChangedFunctionValues();
+
+			unsigned counter(0);
+			for (auto iter=functions_.begin(); iter!=functions_.end(); iter++, counter++) {
+				(*iter)->EvalInPlace<T>(function_values(counter));
+			}
+		}
+
 
 		/**
-		\brief Multiply a system by an arbitrary node.  
+		\brief Evaluate the Jacobian by walking the Jacobian trees, using the previously set variable (and time) values.  Differentiates if necessary.  Does not include patches.
 
-		Can be used for defining a coupling of a target and start system through a path variable.  Does not affect path variable declaration, or anything else.  It is up to you to ensure the system depends on this node properly.
+		The entries are evaluated a column at a time, resetting between columns only the nodes depending on a differential.  So the values of the functions and subfunctions in the trees are evaluated once, and the derivative of a subfunction shared by several functions once per variable, and the entries of the rows using it are assembled from it by the chain rule.
 		*/
-		friend const System operator*(System s, Nd const&  N);
+		template<typename Derived>
+		void JacobianTreesInPlace(Eigen::MatrixBase<Derived> & J) const
+		{
+			typedef typename Derived::Scalar T;
 
-		/**
-		\brief Multiply a system by an arbitrary node.  
+			ThrowIfSharingTrees();
 
-		Can be used for defining a coupling of a target and start system through a path variable.  Does not affect path variable declaration, or anything else.  It is up to you to ensure the system depends on this node properly.
+			const auto& vars = Variables();
+
+			if (!is_differentiated_)
+				Differentiate();
+			ResetJacobianTrees();
+
+			// only the entries which are not identically zero are evaluated
+			J.topRows(NumFunctions()).setZero();
+			for (unsigned jj = 0; jj < vars.size(); ++jj)
+			{
+				ResetDifferentialDependents();
+				for (auto ii : jacobian_columns_[jj])
+					jacobian_[ii]->entry_node()->EvalInPlace<T>(J(ii,jj),vars[jj]);
+			}
+		}
+
+
+		/**
+		\brief Evaluate the time derivative by walking the Jacobian trees, using the previously set variable and time values.  Differentiates if necessary.  Does not include patches.
 		*/
-		friend const System operator*(Nd const&  N, System const& s);
-	private:
+		template<typename Derived>
+		void TimeDerivativeTreesInPlace(Eigen::MatrixBase<Derived> & ds_dt) const
+		{
+			typedef typename Derived::Scalar T;
+
+			ThrowIfSharingTrees();
+
+			if (!is_differentiated_)
+				Differentiate();
+			ResetJacobianTrees();
+
+			for (int ii = 0; ii < NumFunctions(); ++ii)
+				jacobian_[ii]->entry_node()->EvalInPlace<T>(ds_dt(ii), path_variable_);
+		}
+
 
 		/**
 		\brief Get the sizes according to the FIFO ordering.
@@ -1313,25 +2694,71 @@ namespace bertini {
 		class Patch patch_; ///< Patch on the variable groups.  Assumed to be in the same order as the time_order_of_variable_groups_ if the system uses FIFO ordering, or in same order as the AffHomUng variable groups if that is set.
 		bool is_patched_;	///< Indicator of whether the system has been patched.
 
-		mutable std::vector< Jac > jacobian_; ///< The generated functions from differentiation.  Created when first call for a Jacobian matrix evaluation.
+		mutable std::vector< Jac > jacobian_; ///< The generated functions from differentiation.  Created when first call for a Jacobian matrix evaluation.  A null row is of a function added or replaced since, to be differentiated.
 		mutable bool is_differentiated_; ///< indicator for whether the jacobian tree has been populated.
+		mutable std::vector< std::vector<unsigned> > jacobian_structure_; ///< For each function, the indices of the variables it depends on.  Found when differentiating.
+
+		bool use_straight_line_program_; ///< Whether to evaluate through the compiled program, rather than the trees.
+		mutable std::shared_ptr<StraightLineProgram> straight_line_program_; ///< The compiled form of functions_ and jacobian_.  Created on first use, and discarded when the system is differentiated again.  Not serialized.
+		bool use_compiled_evaluation_; ///< Whether to evaluate through straight_line_program_ when no other mode applies.
+		mutable bool straight_line_program_failed_; ///< Whether compiling straight_line_program_ failed.  Cleared when the system is differentiated again.
+		bool use_forward_mode_; ///< Whether to compute derivatives by forward-mode differentiation, rather than from the Jacobian trees.
+		mutable std::shared_ptr<StraightLineProgram> forward_mode_program_; ///< The compiled form of functions_ alone.  Created on first use, and discarded when the system changes.  Not serialized.
+		bool use_polynomial_system_; ///< Whether to evaluate polynomial systems through polynomial_system_, rather than the trees.
+		mutable bool have_polynomial_system_; ///< Whether polynomial_system_ is up to date with the functions.  If it is, but is nullptr, the functions are not polynomial.
+		mutable std::shared_ptr<PolynomialSystem> polynomial_system_; ///< The expansion of functions_ into monomials.  Created on first use.  Not serialized.
+		bool use_fused_homotopy_; ///< Whether to evaluate a straight-line homotopy through homotopy_parts_, rather than its own trees.
+		bool use_compensated_evaluation_; ///< Whether to run straight_line_program_ in double-double when evaluating in double, see UseCompensatedEvaluation.
+		bool use_native_code_; ///< Whether to compile forward_mode_program_ to native code for the batch evaluations, see UseNativeCode.
+		std::shared_ptr<detail::GeneratedKernels const> generated_kernels_; ///< The kernels generated ahead of time for this system, if any, see UseGeneratedKernels.  Discarded when the system changes.  Not serialized.
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > generated_constants_; ///< The constants of generated_kernels_, the multiple-precision ones at the working precision.
+		mutable std::tuple< std::vector<dbl>, std::vector<mpfr> > generated_inputs_, generated_outputs_; ///< Space for running generated_kernels_.
+		std::shared_ptr<detail::StraightLineHomotopyParts> homotopy_parts_; ///< The target and start systems of a straight-line homotopy, and gamma.  Set by StraightLineHomotopy, and discarded when the system changes.  Not serialized.
+		std::shared_ptr<detail::ThreadTeam> evaluation_team_; ///< The threads evaluating a point, see UseEvaluationThreads.  Shared by copies, but not by those made by CloneForThread.  Not serialized.
+
+		mutable bool have_function_dependencies_; ///< Whether the lists of dependent nodes below are current.  Cleared whenever the system changes.
+		mutable std::vector<const node::Node*> variable_dependents_; ///< The nodes of the function trees depending on the variables.  Not serialized.
+		mutable std::vector<const node::Node*> path_variable_dependents_; ///< The nodes of the function trees depending on the path variable.  Not serialized.
+		mutable std::vector<const node::Node*> implicit_parameter_dependents_; ///< The nodes of the function trees depending on the implicit parameters.  Not serialized.
+		mutable bool have_jacobian_dependencies_; ///< Whether the lists below are current with the Jacobian trees.  Cleared whenever the system is differentiated.
+		mutable std::vector<const node::Node*> differential_dependents_; ///< The nodes of the Jacobian trees depending on a differential, so on the variable differentiated with respect to.  Not serialized.
+		mutable std::vector< std::vector<unsigned> > jacobian_columns_; ///< For each variable, the functions depending on it.  The transpose of jacobian_structure_.  Not serialized.
+		mutable bool variables_changed_; ///< Whether the variables have been set since the function trees were last evaluated.
+		mutable bool path_variable_changed_; ///< Whether the path variable has been set since the function trees were last evaluated.
+		mutable bool implicit_parameters_changed_; ///< Whether the implicit parameters have been set since the function trees were last evaluated.
+		mutable std::vector< std::pair<std::shared_ptr<node::Variable>, unsigned long long> > loose_leaves_; ///< The Variables of the function trees which are none of the system's variables, path variable, or implicit parameters, with the Version of each last seen.  Found with the dependents above.  Not serialized.
+		mutable bool leaves_changed_; ///< Whether one of loose_leaves_ has been set since the function trees were last evaluated.
 
 
 		std::vector< VariableGroupType > time_order_of_variable_groups_;
 
 		mutable std::tuple< Vec<dbl>, Vec<mpfr> > current_variable_values_;
+		mutable std::tuple< dbl, mpfr > current_path_variable_value_; ///< The value the path variable was last set to, in each number type.
+
+		bool use_evaluation_cache_; ///< Whether to keep the last evaluations, see UseEvaluationCache.
+		mutable std::tuple< EvaluationCache<dbl>, EvaluationCache<mpfr> > evaluation_cache_; ///< The last evaluations in each number type.  Not copied, nor serialized.
+		mutable unsigned long long evaluation_cache_hits_; ///< The number of evaluations answered from evaluation_cache_.
 
 		mutable VariableGroup variable_ordering_; ///< The assembled ordering of the variables in the system.
 		mutable bool have_ordering_;
 
 		mutable unsigned precision_; ///< the current working precision of the system 
+		mutable unsigned tree_precision_; ///< the precision the trees were last brought to, lagging precision_ until they are next evaluated in multiple precision.  0 if unknown.
+
+		bool shares_trees_; ///< Whether this was made by CloneForThread, so its trees belong to another system, and refer to that system's variables.  Not serialized.
 
 
+		friend System StraightLineHomotopy(System const& target, System const& start, Nd const& gamma, Var const& t);
+
+		friend struct detail::SharedSystemAccess;
 		friend class boost::serialization::access;
 
 		template <typename Archive>
 		void serialize(Archive& ar, const unsigned version) {
 
+			// the trees of a copy made by CloneForThread refer to the variables of the original, not its own
+			ThrowIfSharingTrees();
+
 			ar & ungrouped_variables_;
 			ar & variable_groups_;
 			ar & hom_variable_groups_;
@@ -1358,6 +2785,19 @@ namespace bertini {
 			ar & precision_;
 			ar & is_patched_;
 			ar & patch_;
+
+			// none of the things computed from the trees are serialized, so must be redone
+			straight_line_program_.reset();
+			forward_mode_program_.reset();
+			generated_kernels_.reset();
+			homotopy_parts_.reset();
+			ForgetEvaluations();
+			have_polynomial_system_ = false;
+			have_function_dependencies_ = false;
+			have_jacobian_dependencies_ = false;
+			tree_precision_ = 0;
+			if (is_differentiated_)
+				ComputeJacobianStructure();
 		}
 
 	};
@@ -1376,6 +2816,241 @@ namespace bertini {
 	If the two patches have differing variable orderings, the call to Concatenate will throw.
 	*/
 	System Concatenate(System sys1, System const& sys2);
+
+
+	/**
+	\brief Make the straight-line homotopy \f$H(x,t) = (1-t) F(x) + t \gamma G(x)\f$ from a target system \f$F\f$ to a start system \f$G\f$.
+
+	The homotopy is tracked from the start system, at t=1, to the target, at t=0.  Its trees are those of (1-t)*target + t*gamma*start, so it prints, serializes, and evaluates like any homotopy built by hand.  But it also keeps copies of the two systems, and by default is evaluated through them, see System::UseFusedHomotopy: each is evaluated once, in its own mode, and the values combined with the scalars \f$1-t\f$ and \f$t\gamma\f$, with Jacobian \f$(1-t) J_F + t \gamma J_G\f$ and time derivative \f$\gamma G - F\f$, found without differentiating with respect to t.
+
+	Changing the homotopy -- adding functions or variables, homogenizing, multiplying it by a node -- discards the copies, and it is evaluated from its trees thereafter.
+
+	\param target The target system, F.
+	\param start The start system, G.  Must have as many functions as the target, and the same variables.
+	\param gamma The constant multiplying the start system, usually random.
+	\param t The path variable.  Neither system may have one.
+
+	\throws std::runtime_error if the systems differ in their numbers of functions or in their variables, or either has a path variable.
+	*/
+	System StraightLineHomotopy(System const& target, System const& start, System::Nd const& gamma, System::Var const& t);
+
+
+	namespace detail {
+
+		/**
+		\brief The parts of a straight-line homotopy, from which a System made by StraightLineHomotopy is evaluated.
+
+		Neither part has a path variable.  Each is evaluated at the point set in the homotopy, in its own mode, into the buffers here, which keep their size between evaluations.  The rows of the patches of the parts, if any, are ignored.
+
+		The buffers remember the point at which they were filled, and are not filled again at the same point, so evaluating the homotopy at a new time and the same space point, as the stages of a Runge-Kutta predictor and the loops of the Cauchy endgame often do, costs only the combination of the values.  The points are compared by value, and are forgotten when the precision changes.
+		*/
+		struct StraightLineHomotopyParts
+		{
+			System target; ///< F, the system at t=0.
+			System start; ///< G, the system at t=1, before multiplying by gamma.
+			System::Nd gamma; ///< The constant multiplying the start system.
+
+			mutable std::tuple< Vec<dbl>, Vec<mpfr> > target_values; ///< F at the last point.
+			mutable std::tuple< Vec<dbl>, Vec<mpfr> > start_values; ///< G at the last point.
+			mutable std::tuple< Mat<dbl>, Mat<mpfr> > target_jacobian; ///< The Jacobian of F at the last point.
+			mutable std::tuple< Mat<dbl>, Mat<mpfr> > start_jacobian; ///< The Jacobian of G at the last point.
+
+			mutable std::tuple< Vec<dbl>, Vec<mpfr> > values_point; ///< The point at which F and G were last evaluated.  Empty if none.
+			mutable std::tuple< Vec<dbl>, Vec<mpfr> > jacobian_point; ///< The point at which the Jacobians of F and G were last evaluated.  Empty if none.
+
+			template<typename T>
+			void Eval(Vec<T> const& x) const
+			{
+				if (At(values_point, x))
+					return;
+
+				target.EvalInPlace(Values<T>(target_values, target), x);
+				start.EvalInPlace(Values<T>(start_values, start), x);
+				std::get<Vec<T> >(values_point) = x;
+			}
+
+			template<typename T>
+			void Jacobians(Vec<T> const& x) const
+			{
+				if (At(jacobian_point, x))
+					return;
+
+				target.JacobianInPlace(Jacobian<T>(target_jacobian, target), x);
+				start.JacobianInPlace(Jacobian<T>(start_jacobian, start), x);
+				std::get<Vec<T> >(jacobian_point) = x;
+			}
+
+			template<typename T>
+			void EvalAndJacobians(Vec<T> const& x) const
+			{
+				const bool have_values = At(values_point, x);
+				const bool have_jacobians = At(jacobian_point, x);
+
+				if (have_values && have_jacobians)
+					return;
+				else if (have_values)
+					Jacobians(x);
+				else if (have_jacobians)
+					Eval(x);
+				else
+				{
+					target.EvalAndJacobianInPlace(Values<T>(target_values, target), Jacobian<T>(target_jacobian, target), x);
+					start.EvalAndJacobianInPlace(Values<T>(start_values, start), Jacobian<T>(start_jacobian, start), x);
+					std::get<Vec<T> >(values_point) = x;
+					std::get<Vec<T> >(jacobian_point) = x;
+				}
+			}
+
+			/**
+			\brief Forget the points at which the buffers were filled, so they are filled again on next use.
+			*/
+			void Forget() const
+			{
+				std::get<Vec<dbl> >(values_point).resize(0);
+				std::get<Vec<mpfr> >(values_point).resize(0);
+				std::get<Vec<dbl> >(jacobian_point).resize(0);
+				std::get<Vec<mpfr> >(jacobian_point).resize(0);
+			}
+
+		private:
+
+			template<typename T>
+			static bool At(std::tuple< Vec<dbl>, Vec<mpfr> > const& points, Vec<T> const& x)
+			{
+				const auto& p = std::get<Vec<T> >(points);
+				if (p.size()!=x.size())
+					return false;
+				for (int ii = 0; ii < x.size(); ++ii)
+					if (p(ii)!=x(ii))
+						return false;
+				return true;
+			}
+
+			template<typename T>
+			static Vec<T>& Values(std::tuple< Vec<dbl>, Vec<mpfr> > & buffers, System const& part)
+			{
+				auto& v = std::get<Vec<T> >(buffers);
+				if (v.size()!=part.NumTotalFunctions())
+					v.resize(part.NumTotalFunctions());
+				return v;
+			}
+
+			template<typename T>
+			static Mat<T>& Jacobian(std::tuple< Mat<dbl>, Mat<mpfr> > & buffers, System const& part)
+			{
+				auto& J = std::get<Mat<T> >(buffers);
+				if (J.rows()!=part.NumTotalFunctions() || J.cols()!=part.NumVariables())
+					J.resize(part.NumTotalFunctions(), part.NumVariables());
+				return J;
+			}
+		};
+
+	} // namespace detail
+
+
+	template<typename Derived>
+	void System::FusedHomotopyEvalInPlace(Eigen::MatrixBase<Derived> & function_values) const
+	{
+		typedef typename Derived::Scalar T;
+
+		const auto& parts = *homotopy_parts_;
+		parts.Eval(std::get<Vec<T> >(current_variable_values_));
+
+		const auto& t = std::get<T>(current_path_variable_value_);
+		const T one_minus_t = T(1) - t;
+		const T gamma_t = parts.gamma->Eval<T>() * t;
+
+		const auto& F = std::get<Vec<T> >(parts.target_values);
+		const auto& G = std::get<Vec<T> >(parts.start_values);
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+			function_values(ii) = one_minus_t*F(ii) + gamma_t*G(ii);
+	}
+
+
+	template<typename Derived>
+	void System::FusedHomotopyJacobianInPlace(Eigen::MatrixBase<Derived> & J) const
+	{
+		typedef typename Derived::Scalar T;
+
+		const auto& parts = *homotopy_parts_;
+		parts.Jacobians(std::get<Vec<T> >(current_variable_values_));
+
+		const auto& t = std::get<T>(current_path_variable_value_);
+		const T one_minus_t = T(1) - t;
+		const T gamma_t = parts.gamma->Eval<T>() * t;
+
+		const auto& JF = std::get<Mat<T> >(parts.target_jacobian);
+		const auto& JG = std::get<Mat<T> >(parts.start_jacobian);
+		for (unsigned jj = 0; jj < NumVariables(); ++jj)
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				J(ii,jj) = one_minus_t*JF(ii,jj) + gamma_t*JG(ii,jj);
+	}
+
+
+	template<typename Derived>
+	void System::FusedHomotopyTimeDerivativeInPlace(Eigen::MatrixBase<Derived> & ds_dt) const
+	{
+		typedef typename Derived::Scalar T;
+
+		const auto& parts = *homotopy_parts_;
+		parts.Eval(std::get<Vec<T> >(current_variable_values_));
+
+		const T gamma = parts.gamma->Eval<T>();
+
+		const auto& F = std::get<Vec<T> >(parts.target_values);
+		const auto& G = std::get<Vec<T> >(parts.start_values);
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+			ds_dt(ii) = gamma*G(ii) - F(ii);
+	}
+
+
+	template<typename Derived, typename OtherDerived>
+	void System::FusedHomotopyEvalAndJacobianInPlace(Eigen::MatrixBase<Derived> & function_values, Eigen::MatrixBase<OtherDerived> & J) const
+	{
+		typedef typename Derived::Scalar T;
+
+		const auto& parts = *homotopy_parts_;
+		parts.EvalAndJacobians(std::get<Vec<T> >(current_variable_values_));
+
+		const auto& t = std::get<T>(current_path_variable_value_);
+		const T one_minus_t = T(1) - t;
+		const T gamma_t = parts.gamma->Eval<T>() * t;
+
+		const auto& F = std::get<Vec<T> >(parts.target_values);
+		const auto& G = std::get<Vec<T> >(parts.start_values);
+		const auto& JF = std::get<Mat<T> >(parts.target_jacobian);
+		const auto& JG = std::get<Mat<T> >(parts.start_jacobian);
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+			function_values(ii) = one_minus_t*F(ii) + gamma_t*G(ii);
+		for (unsigned jj = 0; jj < NumVariables(); ++jj)
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				J(ii,jj) = one_minus_t*JF(ii,jj) + gamma_t*JG(ii,jj);
+	}
+
+
+	template<typename Derived, typename OtherDerived>
+	void System::FusedHomotopyJacobianAndTimeDerivativeInPlace(Eigen::MatrixBase<Derived> & J, Eigen::MatrixBase<OtherDerived> & ds_dt) const
+	{
+		typedef typename Derived::Scalar T;
+
+		const auto& parts = *homotopy_parts_;
+		parts.EvalAndJacobians(std::get<Vec<T> >(current_variable_values_));
+
+		const auto& t = std::get<T>(current_path_variable_value_);
+		const T one_minus_t = T(1) - t;
+		const T gamma = parts.gamma->Eval<T>();
+		const T gamma_t = gamma * t;
+
+		const auto& F = std::get<Vec<T> >(parts.target_values);
+		const auto& G = std::get<Vec<T> >(parts.start_values);
+		const auto& JF = std::get<Mat<T> >(parts.target_jacobian);
+		const auto& JG = std::get<Mat<T> >(parts.start_jacobian);
+		for (unsigned jj = 0; jj < NumVariables(); ++jj)
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				J(ii,jj) = one_minus_t*JF(ii,jj) + gamma_t*JG(ii,jj);
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+			ds_dt(ii) = gamma*G(ii) - F(ii);
+	}
 	
 
 
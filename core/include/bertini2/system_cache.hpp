@@ -0,0 +1,157 @@
+//This file is part of Bertini 2.
+//
+//system_cache.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//system_cache.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with system_cache.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file system_cache.hpp 
+
+\brief Provides a binary cache of fully prepared bertini::System's, keyed by the text they were parsed from.
+
+Parsing a large input file, and differentiating, homogenizing, and patching the system, can take much longer than reading back the result.  The cache file holds a short header, with the hash and length of the input text, then the text itself, then the System in a Boost binary archive.  The file is memory mapped for reading, and the hash and length, then the text, are compared before anything is deserialized, so a stale cache costs almost nothing, and a hit is never for other text.
+
+The binary archives are not portable between platforms or builds of Boost, so a cache should be treated as local to the machine which wrote it.  A cache which cannot be read is reported as a miss, never an error.
+
+A system may also be shared by the worker processes of a run, see SaveSharedSystem and MapSharedSystem, by a file they all map read-only, which holds the compiled program along with the system, so no process parses, differentiates or compiles anything, and the pages of the program are held once, however many processes run it.
+*/
+
+#ifndef BERTINI_SYSTEM_CACHE_HPP
+#define BERTINI_SYSTEM_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include "bertini2/system.hpp"
+
+
+namespace bertini {
+
+	/**
+	\brief A hash of input text which is stable between runs and builds, used as the key for cached systems.
+
+	This is the 64-bit FNV-1a hash.  It screens cache files quickly; the text is compared in full on a match.
+
+	\param input The text to hash.
+	\return The hash of the text.
+	*/
+	std::uint64_t InputHash(std::string const& input);
+
+
+	/**
+	\brief Write a system to a cache file, keyed by the text it was made from.
+
+	\param sys The system to save.  It should already be prepared: differentiated, homogenized, patched, and so on, as those steps are what the cache saves.
+	\param input The text from which the system was made.
+	\param cache_file The file to write.  Replaced if it exists, by renaming a completed file over it, so that a process reading it never sees it part written.
+
+	\throws std::runtime_error if the file cannot be written.
+	*/
+	void SaveCachedSystem(System const& sys, std::string const& input, boost::filesystem::path const& cache_file);
+
+
+	/**
+	\brief Read a system from a cache file, if the file was written for the given text.
+
+	\param sys The system to fill.  Unchanged unless the cache is used.
+	\param input The text from which the cached system should have been made.
+	\param cache_file The file to read.
+
+	\return Whether the cache was used.  False if the file does not exist, was made from different text or by a different version of the cache format, or cannot be read.
+	*/
+	bool LoadCachedSystem(System & sys, std::string const& input, boost::filesystem::path const& cache_file);
+
+
+	/**
+	\brief The bytes of a system in the format of the cache, without its key, for sending to another process of the same build, as Python's pickle does.
+
+	\param sys The system to write.  It is differentiated first if it is not yet, so the copy read back has the Jacobian, as it has the patches.
+	\return The header and the binary archive of the system.
+	*/
+	std::string SystemToBytes(System const& sys);
+
+
+	/**
+	\brief Read a system from bytes written by SystemToBytes, in place, without copying them.
+
+	\param sys The system to replace.  Unchanged if the bytes cannot be read.
+	\param data The first byte.
+	\param size The number of bytes.
+
+	\throws std::runtime_error if the bytes are not of a system, or were written by another version of the format or another kind of build.
+	*/
+	void SystemFromBytes(System & sys, char const* data, std::size_t size);
+
+
+	/**
+	\brief Write a system, and the program it is evaluated through, to a file for worker processes to map read-only, see MapSharedSystem.
+
+	The program is the one compiled from the functions alone, for forward-mode differentiation, see System::GetForwardModeProgram, compiled here if it is not yet.  Its instructions are written as they are laid out in memory, for the processes mapping the file to run in place, so the pages holding them are shared by all of them, as the bytes of the system are.  Write a system never differentiated, and its copies have no Jacobian trees, needing none.
+
+	As for a cache, the file is for processes of the same build on the same machine.
+
+	\param sys The system to share.  Not one made by CloneForThread.
+	\param file The file to write.  Replaced if it exists, by renaming a completed file over it, so that processes mapping the old one keep it intact.
+
+	\throws std::runtime_error if the functions cannot be compiled, or the file cannot be written.
+	*/
+	void SaveSharedSystem(System const& sys, boost::filesystem::path const& file);
+
+
+	/**
+	\brief Read a system written by SaveSharedSystem, mapping the file read-only, and evaluating through the program in it.
+
+	The function trees are read from the mapping in place, and the program is not compiled again, but viewed where it lies in the mapping, which is held for as long as the system, or a copy of it, such as those made by System::CloneForThread, lives.  What each process has of its own is its trees, and the registers of the program.  The system is switched to forward-mode differentiation, see System::UseForwardModeDifferentiation, so is evaluated through the program.  Changing its functions or variables discards the program, and compiles one of its own.
+
+	\param sys The system to replace.  Unchanged if the file cannot be read.
+	\param file The file written by SaveSharedSystem.
+
+	\throws std::runtime_error if the file cannot be mapped, was not written by SaveSharedSystem in a build of the same kind, or is cut short.
+	*/
+	void MapSharedSystem(System & sys, boost::filesystem::path const& file);
+
+
+	/**
+	\brief Get the prepared system for some input text, from the cache if possible, and otherwise by preparing and caching it.
+
+	\param input The text from which to make the system.
+	\param cache_file The cache file to read, or to write on a miss.
+	\param prepare A callable taking the input text, and returning the prepared System, such as one parsing with the classic parser and then homogenizing and patching.
+	\return The prepared system.
+	*/
+	template<typename PrepareT>
+	System CachedSystem(std::string const& input, boost::filesystem::path const& cache_file, PrepareT prepare)
+	{
+		System sys;
+		if (LoadCachedSystem(sys, input, cache_file))
+			return sys;
+
+		System prepared = prepare(input);
+		SaveCachedSystem(prepared, input, cache_file);
+		return prepared;
+	}
+
+} // namespace bertini
+
+
+#endif
@@ -57,8 +57,15 @@
 #include <boost/spirit/include/support_istream_iterator.hpp>
 
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
 #include <iostream>
+#include <map>
+#include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 
 
@@ -338,6 +345,16 @@ namespace bertini {
 		
 		
 		
+		/**
+		\brief The symbols met so far: variables, functions, subfunctions, constants, parameters, and the special numbers.
+
+		Once parsing is done, this table may be used by other parsers, such as a FunctionParser per thread in ParseSystemInParallel.
+		*/
+		qi::symbols<char,Nd> const& EncounteredSymbols() const
+		{
+			return encountered_symbols_;
+		}
+
 	private:
 		
 		// rule declarations.  these are member variables for the parser.
@@ -382,7 +399,7 @@ namespace bertini {
 		 */
 		void MakeAndAddFunction(Fn & F, std::string str)
 		{
-			F = std::make_shared<Function>(str);
+			F = node::MakeNode<Function>(str);
 			encountered_symbols_.add(str, F);
 			encountered_functions_.add(str,F);
 		}
@@ -393,7 +410,7 @@ namespace bertini {
 		 */
 		void MakeAndAddVariable(Var & V, std::string str)
 		{
-			V = std::make_shared<Variable>(str);
+			V = node::MakeNode<Variable>(str);
 			encountered_symbols_.add(str, V);
 		}
 		
@@ -424,6 +441,167 @@ namespace bertini {
 		using std::swap;
 		swap(sys,*this);
 	}
+
+
+	namespace detail {
+
+		/**
+		\brief A statement of an input, `name = body;`, split into its parts.  Offsets are into the input.
+		*/
+		struct Statement
+		{
+			std::size_t begin, end; ///< The whole statement, without its ;.
+			std::string name; ///< The name before an =, or the keyword beginning the statement, if either.
+			bool is_assignment; ///< Whether the statement is `name = body`.
+			std::size_t body_begin; ///< The start of the body, after the =, if an assignment.
+		};
+
+		inline
+		std::vector<Statement> SplitStatements(std::string const& input)
+		{
+			std::vector<Statement> statements;
+			std::size_t begin = 0;
+			while (true)
+			{
+				const auto end = input.find(';', begin);
+				if (end==std::string::npos)
+					break;
+
+				Statement st{begin, end, "", false, 0};
+				auto ii = begin;
+				while (ii < end && std::isspace(static_cast<unsigned char>(input[ii])))
+					++ii;
+				const auto name_begin = ii;
+				if (ii < end && std::isalpha(static_cast<unsigned char>(input[ii])))
+					while (ii < end && (std::isalnum(static_cast<unsigned char>(input[ii])) || input[ii]=='[' || input[ii]==']' || input[ii]=='_'))
+						++ii;
+				st.name = input.substr(name_begin, ii-name_begin);
+				while (ii < end && std::isspace(static_cast<unsigned char>(input[ii])))
+					++ii;
+				if (!st.name.empty() && ii < end && input[ii]=='=')
+				{
+					st.is_assignment = true;
+					st.body_begin = ii+1;
+				}
+
+				statements.push_back(st);
+				begin = end+1;
+			}
+			return statements;
+		}
+	} // namespace detail
+
+
+	/**
+	\brief Parse a system, parsing the definitions of its functions concurrently.
+
+	The input is split at its statements.  Everything but the definitions of the functions -- the declarations, subfunctions, constants, and parameters -- is parsed first, in order, by a SystemParser.  Then the definitions of the functions, which are independent of each other once the symbols are known, are parsed by a pool of threads, each with its own FunctionParser reading the symbols made in the first pass.
+
+	The result is the same as parsing serially, provided the input is in the usual order, with each symbol declared before use.  Comments must already have been stripped, see classic::PreprocessedInputFile.
+
+	\param input The text of the input section.
+	\param num_threads The number of threads to use for the definitions.  0 for the number of hardware threads.
+	\return The parsed system.
+
+	\throws std::runtime_error if the declarations, or the definition of any function, cannot be parsed.
+	*/
+	inline
+	System ParseSystemInParallel(std::string const& input, unsigned num_threads = 0)
+	{
+		const auto statements = detail::SplitStatements(input);
+
+		std::set<std::string> function_names;
+		for (const auto& st : statements)
+			if (!st.is_assignment && st.name=="function")
+			{
+				std::string names = input.substr(st.begin, st.end-st.begin);
+				names.erase(0, names.find("function") + 8);
+				std::string name;
+				for (char c : names + ",")
+					if (c==',')
+					{
+						function_names.insert(name);
+						name.clear();
+					}
+					else if (!std::isspace(static_cast<unsigned char>(c)))
+						name.push_back(c);
+			}
+
+		// the first pass, over everything but the definitions of functions.  the text after the last statement goes here too, so errors in it are reported
+		std::string declarations;
+		declarations.reserve(input.size());
+		std::vector<detail::Statement> definitions;
+		for (const auto& st : statements)
+			if (st.is_assignment && function_names.count(st.name))
+				definitions.push_back(st);
+			else
+				declarations.append(input, st.begin, st.end-st.begin+1);
+		declarations.append(input, statements.empty() ? 0 : statements.back().end+1, std::string::npos);
+
+		System sys;
+		SystemParser<std::string::const_iterator> S;
+		{
+			std::string::const_iterator iter = declarations.begin();
+			std::string::const_iterator end = declarations.end();
+			bool s = phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+			if (!s || iter!=end)
+				throw std::runtime_error("unable to correctly parse the declarations of system");
+		}
+
+		std::map<std::string, Fn> functions;
+		for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+			functions[sys.Function(ii)->name()] = sys.Function(ii);
+
+		if (num_threads==0)
+			num_threads = detail::DefaultNumWorkers();
+		num_threads = std::min<unsigned>(num_threads, std::max<std::size_t>(definitions.size(), 1));
+
+		std::atomic<std::size_t> next_definition(0);
+		std::vector<std::string> failures(num_threads);
+		const auto precision = DefaultPrecision();
+
+		auto parse_definitions = [&](unsigned thread_index)
+		{
+			// the default precision is per thread, and the numbers in the trees are made at it
+			DefaultPrecision(precision);
+			qi::symbols<char,Nd> symbols = S.EncounteredSymbols();
+			FunctionParser<std::string::const_iterator> function_parser(&symbols);
+
+			for (auto ii = next_definition++; ii < definitions.size(); ii = next_definition++)
+			{
+				const auto& st = definitions[ii];
+				std::string::const_iterator iter = input.begin() + st.body_begin;
+				std::string::const_iterator end = input.begin() + st.end;
+				Nd root;
+				bool s = false;
+				try
+				{
+					s = phrase_parse(iter, end, function_parser, boost::spirit::ascii::space, root);
+				}
+				catch (std::exception const&)
+				{}
+				if (!s || iter!=end)
+				{
+					failures[thread_index] = st.name;
+					return;
+				}
+				functions.at(st.name)->SetRoot(root);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned ii = 1; ii < num_threads; ++ii)
+			threads.emplace_back(parse_definitions, ii);
+		parse_definitions(0);
+		for (auto& t : threads)
+			t.join();
+
+		for (const auto& name : failures)
+			if (!name.empty())
+				throw std::runtime_error("unable to correctly parse the definition of function " + name);
+
+		return sys;
+	}
 	
 }
 
@@ -27,6 +27,8 @@
 
 /**
 \file system_pool.hpp 
+
+\brief Pools of systems, and of points.
 */
 
 
@@ -37,17 +39,226 @@
 #include "bertini2/detail/pool.hpp"
 #include "bertini2/system.hpp"
 
+#include <cstdint>
+#include <map>
+#include <sstream>
+
 namespace bertini {
 
+	/**
+	\brief A pool of systems, which, given a master system, owns its evaluation instances, one per worker and precision.
+
+	An instance is made the first time a worker asks for one at a precision, by System::CloneForThread, or, for a system which cannot be compiled, by a serialization round trip, and set to that precision.  Asking again gets the same instance, already at the precision, so neither the cloning nor the change of precision is paid twice.  Instances are evicted when idle, held by no one but the pool: by EvictIdle, or, past a budget of memory, the least recently used first.
+	*/
 	class SystemPool : public detail::Pool<System>
 	{
+	public:
+
+		SystemPool() = default;
+
+		/**
+		\param master The system the instances are copies of.  It must outlive the pool, and not be changed while the pool is in use.
+		*/
+		explicit SystemPool(System const& master) : master_(&master)
+		{}
+
+
+		/**
+		\brief Get the evaluation instance of the master system for a worker, at a precision, making it if there is none yet.
+
+		Safe to call from several threads.  An instance is for the one worker only, so two threads must not ask for the same worker.
+
+		\param worker The index of the worker.
+		\param precision The precision, in digits.
+
+		\throws std::runtime_error if the pool has no master system.
+		*/
+		std::shared_ptr<System> Acquire(unsigned worker, unsigned precision)
+		{
+			if (!master_)
+				throw std::runtime_error("acquiring an evaluation instance from a SystemPool without a master system");
+
+			std::lock_guard<std::mutex> lock(instances_mutex_);
+			++clock_;
+
+			const auto key = std::make_pair(worker, precision);
+			auto found = instances_.find(key);
+			if (found!=instances_.end())
+			{
+				found->second.last_use = clock_;
+				found->second.used_since_eviction = true;
+				return found->second.system;
+			}
+
+			Instance instance;
+			instance.system = std::make_shared<System>(Clone());
+			instance.system->precision(precision);
+			instance.bytes = ApproximateBytes(*instance.system, precision);
+			instance.last_use = clock_;
+			instance.used_since_eviction = true;
+			instances_[key] = instance;
+
+			EvictOverBudget();
+			return instance.system;
+		}
+
+
+		/**
+		\brief Evict the instances which are idle, and have not been acquired since the last call.
 
+		\return The number evicted.
+		*/
+		std::size_t EvictIdle()
+		{
+			std::lock_guard<std::mutex> lock(instances_mutex_);
+			std::size_t num_evicted = 0;
+			for (auto it = instances_.begin(); it!=instances_.end(); )
+			{
+				if (!it->second.used_since_eviction && it->second.system.use_count()==1)
+				{
+					it = instances_.erase(it);
+					++num_evicted;
+				}
+				else
+				{
+					it->second.used_since_eviction = false;
+					++it;
+				}
+			}
+			return num_evicted;
+		}
+
+
+		/**
+		\brief Set a budget on the memory of the instances, past which the least recently used idle ones are evicted.  0, the default, is no budget.
+		*/
+		void MaxBytes(std::size_t max_bytes)
+		{
+			std::lock_guard<std::mutex> lock(instances_mutex_);
+			max_bytes_ = max_bytes;
+			EvictOverBudget();
+		}
+
+		/**
+		\brief The number of evaluation instances.
+		*/
+		std::size_t NumInstances() const
+		{
+			std::lock_guard<std::mutex> lock(instances_mutex_);
+			return instances_.size();
+		}
+
+		/**
+		\brief An estimate of the memory of the evaluation instances, in bytes.
+		*/
+		std::size_t ApproximateBytes() const
+		{
+			std::lock_guard<std::mutex> lock(instances_mutex_);
+			std::size_t bytes = 0;
+			for (auto const& instance : instances_)
+				bytes += instance.second.bytes;
+			return bytes;
+		}
+
+	private:
+
+		struct Instance
+		{
+			std::shared_ptr<System> system;
+			std::size_t bytes = 0; ///< An estimate of its memory.
+			std::uint64_t last_use = 0; ///< The tick of the pool's clock when it was last acquired.
+			bool used_since_eviction = false;
+		};
+
+		System Clone()
+		{
+			if (archived_.empty())
+				try
+				{
+					return master_->CloneForThread();
+				}
+				catch (std::runtime_error const&)
+				{
+					// a system which cannot be compiled is evaluated by walking its trees, so needs trees of its own
+					std::ostringstream out;
+					{
+						boost::archive::binary_oarchive oa(out);
+						oa << *master_;
+					}
+					archived_ = out.str();
+				}
+
+			System copy;
+			std::istringstream in(archived_);
+			boost::archive::binary_iarchive ia(in);
+			ia >> copy;
+			return copy;
+		}
+
+		// the numbers an instance holds for evaluating: the values of its functions, Jacobian and time derivative.  a lower bound, for the registers of a compiled program are not counted
+		static std::size_t ApproximateBytes(System const& sys, unsigned precision)
+		{
+			const std::size_t num_numbers = sys.NumTotalFunctions()*(sys.NumVariables()+2);
+			const std::size_t bytes_per_number = precision<=DoublePrecision() ? sizeof(dbl)
+				: sizeof(mpfr) + 2*(static_cast<std::size_t>(precision*3.33)/64 + 1)*8;
+			return num_numbers*bytes_per_number;
+		}
+
+		void EvictOverBudget()
+		{
+			if (max_bytes_==0)
+				return;
+
+			std::size_t bytes = 0;
+			for (auto const& instance : instances_)
+				bytes += instance.second.bytes;
+
+			while (bytes > max_bytes_)
+			{
+				auto oldest = instances_.end();
+				for (auto it = instances_.begin(); it!=instances_.end(); ++it)
+					if (it->second.system.use_count()==1 && (oldest==instances_.end() || it->second.last_use < oldest->second.last_use))
+						oldest = it;
+				if (oldest==instances_.end())
+					return;
+
+				bytes -= oldest->second.bytes;
+				instances_.erase(oldest);
+			}
+		}
+
+		System const* master_ = nullptr;
+		std::string archived_; ///< The master, serialized, if it cannot be cloned for a thread.
+		std::map< std::pair<unsigned,unsigned>, Instance > instances_; ///< The instances, by worker and precision.
+		std::uint64_t clock_ = 0;
+		std::size_t max_bytes_ = 0;
+		mutable std::mutex instances_mutex_;
 	};
 
+	/**
+	\brief A pool of vectors, lent out by size.
+
+	A vector given back is lent out again only for the same size, so keeps its storage.  In multiple precision, its entries keep theirs, too, and are set to the default precision when lent out, if they are not already at it.
+	*/
 	template<typename NumT>
 	class PointPool : public detail::Pool<Vec<NumT> >
 	{
+	public:
+
+		using Handle = typename detail::Pool<Vec<NumT> >::Handle;
 
+		/**
+		\brief Borrow a vector of a given size, at the default precision.  Its entries are not set.
+		*/
+		Handle Acquire(std::size_t size)
+		{
+			auto v = detail::Pool<Vec<NumT> >::Acquire(size);
+			if (static_cast<std::size_t>(v->size())!=size)
+				v->resize(size);
+			if (!std::is_same<NumT,dbl>::value && size > 0 && Precision((*v)(0))!=DefaultPrecision())
+				Precision(*v, DefaultPrecision());
+			return v;
+		}
 	};
 
 
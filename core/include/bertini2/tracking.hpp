@@ -32,6 +32,25 @@
 #define BERTINI_TRACKING_HPP
 
 #include "bertini2/tracking/tracker.hpp"
+#include "bertini2/tracking/parallel_tracking.hpp"
+#include "bertini2/tracking/auto_tune.hpp"
+#include "bertini2/tracking/parallel_endgame.hpp"
+#include "bertini2/tracking/hybrid_endgame.hpp"
+#include "bertini2/tracking/monodromy.hpp"
+#include "bertini2/tracking/batch_tracker.hpp"
+#include "bertini2/tracking/parameter_homotopy.hpp"
+#include "bertini2/tracking/path_recorder.hpp"
+#include "bertini2/tracking/post_processing.hpp"
+#include "bertini2/tracking/cascade.hpp"
+#include "bertini2/tracking/certification.hpp"
+#include "bertini2/tracking/refine_all.hpp"
+#include "bertini2/tracking/regeneration.hpp"
+#include "bertini2/tracking/solution_database.hpp"
+#include "bertini2/tracking/staged_solve.hpp"
+#include "bertini2/tracking/tiered_endgame.hpp"
+#include "bertini2/tracking/trace.hpp"
+#include "bertini2/tracking/tracking_session.hpp"
+#include "bertini2/tracking/witness_sampling.hpp"
 
 #endif
 
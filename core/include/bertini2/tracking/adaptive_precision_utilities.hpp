@@ -42,6 +42,8 @@ namespace adaptive{
 /**
 \brief Sets the precision of each space sample to be of input precision.
 
+The precision of a sample is that of its first coordinate, so samples already at the precision are skipped, and only those which are not are converted.
+
 \param samples The samples of which to change precision.
 \param prec The new precision the samples should have.
 */
@@ -49,8 +51,9 @@ inline
 void SetPrecision(SampCont<mpfr> & samples, unsigned prec)
 {
 	for (auto& s : samples)
-		for (unsigned ii=0; ii<s.size(); ii++)
-			s(ii).precision(prec);
+		if (s.size()>0 && Precision(s(0))!=prec)
+			for (unsigned ii=0; ii<s.size(); ii++)
+				s(ii).precision(prec);
 }
 
 /**
@@ -63,7 +66,8 @@ inline
 void SetPrecision(TimeCont<mpfr> & times, unsigned prec)
 {
 	for (auto& t : times)
-		t.precision(prec);
+		if (Precision(t)!=prec)
+			t.precision(prec);
 }
 
 /**
@@ -130,7 +134,7 @@ inline
 unsigned EnsureAtUniformPrecision(TimeCont<mpfr> & times, SampCont<mpfr> & samples)
 {
 	auto def_prec = DefaultPrecision();
-	if (std::any_of(begin(samples),end(samples),[=](auto const& p){return Precision(p)!=def_prec;}))
+	if (std::any_of(samples.begin(),samples.end(),[=](auto const& p){return Precision(p)!=def_prec;}))
 	{
 		auto max_precision = max(MaxPrecision(samples), MaxPrecision(times));
 
@@ -159,9 +163,9 @@ inline
 unsigned EnsureAtUniformPrecision(TimeCont<mpfr> & times, SampCont<mpfr> & samples, SampCont<mpfr> & derivatives)
 {
 	auto def_prec = DefaultPrecision();
-	if (std::any_of(begin(samples),end(samples),[=](auto const& p){return Precision(p)!=def_prec;}) 
+	if (std::any_of(samples.begin(),samples.end(),[=](auto const& p){return Precision(p)!=def_prec;}) 
 	    || 
-	    std::any_of(begin(derivatives),end(derivatives),[=](auto const& p){return Precision(p)!=def_prec;}))
+	    std::any_of(derivatives.begin(),derivatives.end(),[=](auto const& p){return Precision(p)!=def_prec;}))
 	{
 		auto max_precision = max(MaxPrecision(samples),MaxPrecision(times),MaxPrecision(derivatives));
 
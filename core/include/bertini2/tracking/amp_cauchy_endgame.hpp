@@ -85,50 +85,28 @@ protected:
 			auto& times_d = std::get<TimeCont<dbl > >(cauchy_times_);
 
 			for (unsigned ii=0; ii<times_m.size(); ++ii)
-			{
-				times_m[ii].precision(new_precision);
-				times_m[ii] = mpfr(times_d[ii]);
-			}
+				SetAtPrecision(times_m[ii], times_d[ii], new_precision);
 
 
 			auto& samples_m = std::get<SampCont<mpfr> >(cauchy_samples_);
 			auto& samples_d = std::get<SampCont<dbl > >(cauchy_samples_);
 
 			for (unsigned ii=0; ii<times_m.size(); ++ii)
-			{
-				auto& s = samples_m[ii];
-				auto& sd = samples_d[ii];
-				for (unsigned jj=0; jj<s.size(); ++jj)
-				{
-					s(jj).precision(new_precision);
-					s(jj) = mpfr(sd(jj));
-				}
-			}
+				SetAtPrecision(samples_m[ii], samples_d[ii], new_precision);
 		}
 		{
 			auto& times_m = std::get<TimeCont<mpfr> >(pseg_times_);
 			auto& times_d = std::get<TimeCont<dbl> >(pseg_times_);
 
 			for (unsigned ii=0; ii<times_m.size(); ++ii)
-			{
-				times_m[ii].precision(new_precision);
-				times_m[ii] = mpfr(times_d[ii]);
-			}
+				SetAtPrecision(times_m[ii], times_d[ii], new_precision);
 
 
 			auto& samples_m = std::get<SampCont<mpfr> >(pseg_samples_);
 			auto& samples_d = std::get<SampCont<dbl > >(pseg_samples_);
 
 			for (unsigned ii=0; ii<times_m.size(); ++ii)
-			{
-				auto& s = samples_m[ii];
-				auto& sd = samples_d[ii];
-				for (unsigned jj=0; jj<s.size(); ++jj)
-				{
-					s(jj).precision(new_precision);
-					s(jj) = mpfr(sd(jj));
-				}
-			}
+				SetAtPrecision(samples_m[ii], samples_d[ii], new_precision);
 		}
 	}
 
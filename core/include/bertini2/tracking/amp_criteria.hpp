@@ -44,6 +44,38 @@ namespace bertini{
 			using AdaptiveMultiplePrecisionConfig = config::AdaptiveMultiplePrecisionConfig;
 
 
+			/**
+			\brief The factor by which compensated evaluation shrinks the error of evaluating in RealType, relative to its unit roundoff.
+
+			When evaluation in double is compensated, see AdaptiveMultiplePrecisionConfig::compensated_double_evaluation, the arithmetic is done in double-double and rounded to double once, so the error which \f$\Phi\f$ and \f$\Psi\f$ bound is in units of the roundoff of double-double, \f$10^{-32}\f$, rather than of double.  Otherwise 1.
+			*/
+			template<typename RealType>
+			RealType CompensationFactor(AdaptiveMultiplePrecisionConfig const& AMP_config)
+			{
+				if (std::is_same<RealType,double>::value && AMP_config.compensated_double_evaluation)
+					return RealType(std::pow(10., -double(DoubleDoublePrecision()-DoublePrecision())));
+				return RealType(1);
+			}
+
+			/**
+			\brief The bound \f$\Phi\f$ on the error of evaluating the Jacobian in RealType, in units of its roundoff.
+			*/
+			template<typename RealType>
+			RealType Phi(AdaptiveMultiplePrecisionConfig const& AMP_config)
+			{
+				return RealType(AMP_config.Phi)*CompensationFactor<RealType>(AMP_config);
+			}
+
+			/**
+			\brief The bound \f$\Psi\f$ on the error of evaluating the functions in RealType, in units of its roundoff.
+			*/
+			template<typename RealType>
+			RealType Psi(AdaptiveMultiplePrecisionConfig const& AMP_config)
+			{
+				return RealType(AMP_config.Psi)*CompensationFactor<RealType>(AMP_config);
+			}
+
+
 			/**
 			\brief Check AMP Criterion A.
 
@@ -62,7 +94,7 @@ namespace bertini{
 			template<typename RealType>
 			bool CriterionA(RealType const& norm_J, RealType const& norm_J_inverse, AdaptiveMultiplePrecisionConfig const& AMP_config)
 			{
-				return NumTraits<RealType>::NumDigits()  > AMP_config.safety_digits_1 + log10(norm_J_inverse * RealType(AMP_config.epsilon) * (norm_J + RealType(AMP_config.Phi) ) );
+				return NumTraits<RealType>::NumDigits()  > AMP_config.safety_digits_1 + log10(norm_J_inverse * RealType(AMP_config.epsilon) * (norm_J + Phi<RealType>(AMP_config) ) );
 			}
 			
 
@@ -79,7 +111,7 @@ namespace bertini{
 			template <typename RealType>
 			RealType D(RealType const& norm_J, RealType const& norm_J_inverse, AdaptiveMultiplePrecisionConfig const& AMP_config)
 			{
-				return log10(norm_J_inverse*( (RealType(2)+RealType(AMP_config.epsilon))*norm_J + RealType(AMP_config.epsilon)*RealType(AMP_config.Phi)) + RealType(1));
+				return log10(norm_J_inverse*( (RealType(2)+RealType(AMP_config.epsilon))*norm_J + RealType(AMP_config.epsilon)*Phi<RealType>(AMP_config)) + RealType(1));
 			}
 
 			/**
@@ -150,7 +182,7 @@ namespace bertini{
 			template<typename RealType>
 			RealType CriterionCRHS(RealType const& norm_J_inverse, RealType const& norm_z, RealType tracking_tolerance, AdaptiveMultiplePrecisionConfig const& AMP_config)
 			{
-				return AMP_config.safety_digits_2 + -log10(tracking_tolerance) + log10(norm_J_inverse*RealType(AMP_config.Psi) + norm_z);
+				return AMP_config.safety_digits_2 + -log10(tracking_tolerance) + log10(norm_J_inverse*Psi<RealType>(AMP_config) + norm_z);
 			}
 
 
@@ -55,15 +55,9 @@ protected:
 	void MultipleToMultipleImpl(unsigned new_precision) const override
 	{
 		// first, change precision on the final approximation
-		const auto& source_point = std::get<Vec<mpfr> >(this->final_approximation_at_origin_);
 		auto& target_point = std::get<Vec<mpfr> >(this->final_approximation_at_origin_);
-		target_point.resize(source_point.size());
-
-		for (unsigned ii=0; ii<source_point.size(); ii++)
-		{
+		for (unsigned ii=0; ii<target_point.size(); ii++)
 			target_point(ii).precision(new_precision);
-			target_point(ii) = mpfr(source_point(ii));
-		}
 
 		// then change precision of the permanent temporaries
 		auto& times = std::get<TimeCont<mpfr> >(times_);
@@ -81,37 +75,21 @@ protected:
 		const auto& source_point = std::get<Vec<dbl> >(this->final_approximation_at_origin_);
 		auto& target_point = std::get<Vec<mpfr> >(this->final_approximation_at_origin_);
 
-		target_point.resize(source_point.size());
-		for (unsigned ii=0; ii<source_point.size(); ii++)
-		{
-			target_point(ii).precision(new_precision);
-			target_point(ii) = mpfr(source_point(ii));
-		}
+		SetAtPrecision(target_point, source_point, new_precision);
 
 
 		auto& times_m = std::get<TimeCont<mpfr> >(times_);
 		auto& times_d = std::get<TimeCont<dbl> >(times_);
 
 		for (unsigned ii=0; ii<times_m.size(); ++ii)
-		{
-			times_m[ii].precision(new_precision);
-			times_m[ii] = mpfr(times_d[ii]);
-		}
+			SetAtPrecision(times_m[ii], times_d[ii], new_precision);
 
 
 		auto& samples_m = std::get< SampCont<mpfr> >(samples_);
 		auto& samples_d = std::get< SampCont<dbl > >(samples_);
 
 		for (unsigned ii=0; ii<times_m.size(); ++ii)
-		{
-			auto& s = samples_m[ii];
-			auto& sd = samples_d[ii];
-			for (unsigned jj=0; jj<s.size(); ++jj)
-			{
-				s(jj).precision(new_precision);
-				s(jj) = mpfr(sd(jj));
-			}
-		}
+			SetAtPrecision(samples_m[ii], samples_d[ii], new_precision);
 	}
 
 	void MultipleToDoubleImpl() const override
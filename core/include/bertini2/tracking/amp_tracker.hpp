@@ -35,6 +35,12 @@
 #define BERTINI_AMP_TRACKER_HPP
 
 #include "bertini2/tracking/base_tracker.hpp"
+#include "bertini2/system_pool.hpp"
+#include "bertini2/detail/thread_team.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 
 namespace bertini{
@@ -77,15 +83,103 @@ namespace bertini{
 		
 		 This function tells you the relative cost of arithmetic at a given precision. 
 
-		 \todo Recompute this cost function for boost::multiprecision::mpfr_float
+		 \see ArithmeticCostModel, for costs measured on the machine at hand.
 		*/
 		inline
 		mpfr_float ArithmeticCost(unsigned precision)
 		{
-			if (precision==DoublePrecision())
-				return 1;
-			else
-				return mpfr_float("10.35") + mpfr_float("0.13") * precision;
+			return ArithmeticCostModel::Analytic(precision);
+		}
+
+
+		/**
+		 \brief The relative cost of arithmetic at a given precision, from a cost model.
+		*/
+		inline
+		mpfr_float ArithmeticCost(unsigned precision, ArithmeticCostModel const& cost_model)
+		{
+			return cost_model.Cost(precision);
+		}
+
+
+		/**
+		\brief Measure the cost of arithmetic at several precisions, relative to double, on a system.
+
+		The measure is a short sequence of the work of a Newton step: evaluating the system and its Jacobian at a random point, factoring the Jacobian and solving with it.  It is timed in double precision and at each of the precisions, repeated until each timing lasts at least min_seconds, and the ratios make the model.  So the model reflects both the machine and the system, its size and how it is evaluated.
+
+		## Use
+
+		\code
+		auto AMP = config::AMPConfigFrom(sys);
+		AMP.arithmetic_cost = CalibrateArithmeticCost(sys);
+		tracker.PrecisionSetup(AMP);
+		\endcode
+
+		The default precision is restored afterwards, and the system is not changed, for the timings are made on a copy.
+
+		\param sys The system to time.  Square, counting its patches.
+		\param precisions The multiple precisions to measure, in digits.  Empty, the default, measures at LowestMultiplePrecision, and every 4 increments after up to 100 digits.
+		\param min_seconds The least time to spend on each measurement.
+
+		\throws std::runtime_error if the system is not square.
+		*/
+		inline
+		ArithmeticCostModel CalibrateArithmeticCost(System const& sys, std::vector<unsigned> precisions = {}, double min_seconds = 0.01)
+		{
+			if (sys.NumTotalFunctions()!=sys.NumVariables())
+				throw std::runtime_error("calibrating arithmetic cost on a system with " + std::to_string(sys.NumTotalFunctions()) + " functions, counting patches, in " + std::to_string(sys.NumVariables()) + " variables, but it must be square");
+
+			if (precisions.empty())
+				for (unsigned p = LowestMultiplePrecision(); p <= 100; p += 4*PrecisionIncrement())
+					precisions.push_back(p);
+
+			const auto initial_precision = DefaultPrecision();
+			SystemPool copies(sys);
+
+			// the seconds per Newton-like sequence, repeating until the total is long enough to trust
+			auto seconds_per_step = [&](auto const& x)
+			{
+				using ComplexType = typename std::decay<decltype(x(0))>::type;
+				System const& s = *copies.Acquire(0, Precision(x(0)));
+				const ComplexType t(0);
+
+				PartialPivotLU<ComplexType> lu(sys.NumVariables());
+				Vec<ComplexType> dx(sys.NumVariables());
+				auto step = [&]
+				{
+					const Vec<ComplexType> f = s.HavePathVariable() ? s.Eval(x, t) : s.Eval(x);
+					const Mat<ComplexType> J = s.HavePathVariable() ? s.Jacobian(x, t) : s.Jacobian(x);
+					lu.Factor(J);
+					lu.Solve(dx, f);
+				};
+
+				step(); // warm, for the first evaluation may compile the system
+				std::size_t repetitions = 1;
+				for (;;)
+				{
+					const auto start = std::chrono::steady_clock::now();
+					for (std::size_t ii = 0; ii < repetitions; ++ii)
+						step();
+					const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+					if (elapsed >= min_seconds)
+						return elapsed/repetitions;
+					repetitions *= 2;
+				}
+			};
+
+			const double double_seconds = seconds_per_step(RandomOfUnits<dbl>(sys.NumVariables()));
+
+			ArithmeticCostModel model;
+			for (auto p : precisions)
+			{
+				if (p==DoublePrecision())
+					continue;
+				DefaultPrecision(p);
+				model.Set(p, seconds_per_step(RandomOfUnits<mpfr>(sys.NumVariables())) / double_seconds);
+			}
+
+			DefaultPrecision(initial_precision);
+			return model;
 		}
 
 
@@ -141,6 +235,7 @@ namespace bertini{
 		 \param num_newton_iterations The number of allowed Newton corrector iterations.
 		 \param AMP_config The configuration of AMP settings for tracking.
 		 \param predictor_order The order of the predictor being used.  This is the order itself, not the order of the error estimate.
+		 \param cost_model The relative cost of arithmetic at each precision.  The default is the analytic model.
 
 		 \see ArithmeticCost
 		*/
@@ -150,19 +245,20 @@ namespace bertini{
 						  unsigned max_precision, mpfr_float const& max_stepsize,
 						  mpfr_float const& criterion_B_rhs,
 						  unsigned num_newton_iterations,
-						  unsigned predictor_order = 0)
+						  unsigned predictor_order = 0,
+						  ArithmeticCostModel const& cost_model = ArithmeticCostModel())
 		{
 			mpfr_float min_cost = Eigen::NumTraits<mpfr_float>::highest();
 			new_precision = MaxPrecisionAllowed()+1; // initialize to an impossible value.
 			new_stepsize = old_stepsize; // initialize to original step size.
 
 			auto minimizer_routine = 
-				[&min_cost, &new_stepsize, &new_precision, criterion_B_rhs, num_newton_iterations, predictor_order, max_stepsize](unsigned candidate_precision)
+				[&min_cost, &new_stepsize, &new_precision, &cost_model, criterion_B_rhs, num_newton_iterations, predictor_order, max_stepsize](unsigned candidate_precision)
 				{
 					mpfr_float candidate_stepsize = min(StepsizeSatisfyingCriterionB(candidate_precision, criterion_B_rhs, num_newton_iterations, predictor_order),
 					                              max_stepsize);
 
-					mpfr_float current_cost = ArithmeticCost(candidate_precision) / abs(candidate_stepsize);
+					mpfr_float current_cost = ArithmeticCost(candidate_precision, cost_model) / abs(candidate_stepsize);
 
 					if (current_cost < min_cost)
 					{
@@ -344,6 +440,37 @@ namespace bertini{
 				preserve_precision_ = should_preseve_precision;
 			}
 
+
+			/**
+			\brief Set whether each step is attempted at several step sizes at once, on threads of their own, and how.
+
+			The helpers track on copies of the system made at the start of each path, so see it as it is then.  Changes to the system, as moving a parameter homotopy to a new target, take effect for them with the next path.
+
+			\throws std::runtime_error if the number of attempts is 0.
+			\see config::Speculation
+			*/
+			void SpeculativeStepping(config::Speculation const& settings)
+			{
+				if (settings.num_attempts==0)
+					throw std::runtime_error("speculative stepping needs at least 1 attempt at each step");
+
+				speculation_config_ = settings;
+				speculative_trackers_.clear();
+				speculative_systems_.clear();
+				if (settings.num_attempts > 1)
+					speculation_team_ = std::make_shared<detail::ThreadTeam>(settings.num_attempts);
+				else
+					speculation_team_.reset();
+			}
+
+			/**
+			\brief Query whether, and how, each step is attempted at several step sizes at once.
+			*/
+			config::Speculation const& SpeculativeStepping() const
+			{
+				return speculation_config_;
+			}
+
 			
 			virtual ~AMPTracker() = default;
 
@@ -389,7 +516,7 @@ namespace bertini{
 				         );
 				#endif
 
-				NotifyObservers(Initializing<AMPTracker,mpfr>(*this,start_time, end_time, start_point));
+				NotifyObservers<Initializing<AMPTracker,mpfr>>(*this,start_time, end_time, start_point);
 
 				initial_precision_ = Precision(start_point(0));
 				DefaultPrecision(initial_precision_);
@@ -422,10 +549,62 @@ namespace bertini{
 
 				ChangePrecision<upsample_refine_off>(start_point(0).precision());
 
+				if (speculation_team_)
+					MakeSpeculativeTrackers();
+
 				return InitialRefinement();
 			}
 
 
+			/**
+			\brief Make the helpers attempting the smaller step sizes, each on a copy of the system as it is now, set up as this tracker is.
+
+			The helpers take a single step to the end of a segment, so start with a step the length of the segment.
+			*/
+			void MakeSpeculativeTrackers() const
+			{
+				SystemPool copies(tracked_system_);
+				speculative_systems_.clear();
+				speculative_trackers_.clear();
+
+				auto stepping = stepping_config_;
+				stepping.min_num_steps = 1;
+				stepping.initial_step_size = stepping.max_step_size;
+				stepping.dense_output = false; // the step of a helper ends exactly where it is adopted
+
+				for (unsigned ii = 1; ii < speculation_team_->Size(); ++ii)
+				{
+					speculative_systems_.push_back(copies.Acquire(ii, current_precision_));
+					auto helper = std::make_shared<AMPTracker>(*speculative_systems_.back());
+					helper->Setup(Predictor(), tracking_tolerance_, path_truncation_threshold_, stepping, newton_config_);
+					helper->PrecisionSetup(AMP_config_);
+					helper->PrecisionPreservation(false);
+					helper->ReinitializeInitialStepSize(true);
+					speculative_trackers_.push_back(helper);
+				}
+			}
+
+
+			/**
+			\brief Set the new end time, keeping the current time, point, step size and precision, for continuing the current path.
+
+			The end time is held at the higher of its own precision and the current one, so that later increases of precision have its digits.
+
+			\param end_time The time to which to track.
+			*/
+			SuccessCode TrackerLoopContinuation(mpfr const& end_time) const override
+			{
+				using std::max;
+				endtime_highest_precision_.precision(max<unsigned>(Precision(end_time), current_precision_));
+				endtime_highest_precision_ = end_time;
+
+				endtime_.precision(current_precision_);
+				endtime_ = end_time;
+
+				return SuccessCode::Success;
+			}
+
+
 			// SuccessCode TrackerLoopInitialization(dbl const& start_time,
 			//                                dbl const& end_time,
 			// 							   Vec<dbl> const& start_point) const override
@@ -459,6 +638,12 @@ namespace bertini{
 				num_successful_steps_since_precision_decrease_ = 0;
 				// initialize to the frequency so guaranteed to compute it the first try 	
 				num_steps_since_last_condition_number_computation_ = this->stepping_config_.frequency_of_CN_estimation;
+				previous_error_ = 0;
+				previous_required_digits_ = 0;
+				rejected_since_last_success_ = false;
+				// estimates of the norm of the inverse of the Jacobian reused along a path must come from it
+				predictor_->ResetNormJInverseEstimate();
+				corrector_->ResetNormJInverseEstimate();
 			}
 
 			/** 
@@ -474,7 +659,7 @@ namespace bertini{
 					do {
 						if (current_precision_ > AMP_config_.maximum_precision)
 						{
-							NotifyObservers(SingularStartPoint<EmitterType>(*this));
+							NotifyObservers<SingularStartPoint<EmitterType>>(*this);
 							return SuccessCode::SingularStartPoint;
 						}
 
@@ -518,7 +703,23 @@ namespace bertini{
 			{
 				if (preserve_precision_)
 					ChangePrecision(initial_precision_);
-				NotifyObservers(TrackingEnded<EmitterType>(*this));
+				NotifyObservers<TrackingEnded<EmitterType>>(*this);
+				limb_pool::ReleaseThreadCache();
+			}
+
+			void ResumeTracking() const override
+			{
+				if (DefaultPrecision()!=current_precision_)
+					DefaultPrecision(current_precision_);
+				if (tracked_system_.precision()!=current_precision_)
+					tracked_system_.precision(current_precision_);
+			}
+
+			double LatestConditionNumber() const override
+			{
+				if (current_precision_==DoublePrecision())
+					return std::get<double>(condition_number_estimate_);
+				return static_cast<double>(std::get<mpfr_float>(condition_number_estimate_));
 			}
 
 			/**
@@ -580,6 +781,17 @@ namespace bertini{
 			\return Success if the step was successful, and a non-success code if something went wrong, such as a linear algebra failure or AMP Criterion violation.
 			*/
 			SuccessCode TrackerIteration() const override
+			{
+				if (speculation_team_ && speculative_trackers_.size()+1==speculation_team_->Size())
+					return SpeculativeIteration();
+				return OwnIteration();
+			}
+
+
+			/**
+			\brief Attempt the step at the current step size and precision, on this thread alone.
+			*/
+			SuccessCode OwnIteration() const
 			{
 				if (current_precision_==DoublePrecision())
 					return TrackerIteration<dbl, double>();
@@ -588,6 +800,79 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Attempt the step at once at the current step size, by this tracker, and at smaller ones, by the helpers, see config::Speculation.
+
+			If this tracker's own attempt succeeds, the helpers' are discarded.  Otherwise the largest step a helper took is taken, at the precision the helper took it, and the step succeeds.  Only if every attempt fails does the step fail, with the step size and precision as this tracker's failure left them.
+			*/
+			SuccessCode SpeculativeIteration() const
+			{
+				const unsigned num_attempts = speculation_team_->Size();
+				const mpfr start_time = current_time_;
+				Vec<mpfr> start_point = CurrentPoint();
+				if (speculation_config_.raise_precision)
+					Precision(start_point, current_precision_==DoublePrecision() ? LowestMultiplePrecision() : current_precision_+PrecisionIncrement());
+
+				std::vector<mpfr> candidate_delta_t(num_attempts, delta_t_);
+				for (unsigned ii = 1; ii < num_attempts; ++ii)
+					candidate_delta_t[ii] = candidate_delta_t[ii-1] * mpfr(stepping_config_.step_size_fail_factor);
+
+				SuccessCode own_code = SuccessCode::Failure;
+				std::vector<char> took_step(num_attempts, 0);
+				speculation_team_->Run([&](unsigned part, unsigned)
+				{
+					if (part==0)
+					{
+						own_code = OwnIteration();
+						return;
+					}
+
+					auto const& helper = *speculative_trackers_[part-1];
+					if (helper.BeginPath(start_time, start_time + candidate_delta_t[part], start_point)!=SuccessCode::Success)
+						return;
+					Vec<mpfr> end_point;
+					took_step[part] = helper.AdvancePath(end_point, 1)==SuccessCode::Success && !helper.PathInProgress();
+				});
+
+				if (own_code==SuccessCode::Success)
+					return own_code;
+
+				for (unsigned ii = 1; ii < num_attempts; ++ii)
+					if (took_step[ii])
+					{
+						AdoptSpeculativeStep(*speculative_trackers_[ii-1], candidate_delta_t[ii]);
+						return SuccessCode::Success;
+					}
+
+				return own_code;
+			}
+
+
+			/**
+			\brief Take the step a helper took, of length delta_t from the current time, with its point, precision, and next step size.
+			*/
+			void AdoptSpeculativeStep(AMPTracker const& helper, mpfr const& delta_t) const
+			{
+				const unsigned new_precision = helper.CurrentPrecision();
+				const Vec<mpfr> point = helper.CurrentPoint();
+
+				if (new_precision > current_precision_)
+					NotifyObservers<PrecisionIncreased<EmitterType>>(*this,current_precision_,new_precision);
+				else if (new_precision < current_precision_)
+					NotifyObservers<PrecisionDecreased<EmitterType>>(*this,current_precision_,new_precision);
+				num_steps_since_last_condition_number_computation_ = this->stepping_config_.frequency_of_CN_estimation;
+
+				if (new_precision==DoublePrecision())
+					MultipleToDouble(point);
+				else
+					MultipleToMultiple(new_precision, point);
+
+				// counted on success, as the step's own, see Tracker::IncrementBaseCountersSuccess
+				delta_t_ = delta_t;
+				SetStepSize(helper.CurrentStepsize());
+			}
+
+
 			/**
 			\brief Run an iteration of AMP tracking.
 
@@ -606,7 +891,7 @@ namespace bertini{
 				assert(PrecisionSanityCheck() && "precision sanity check failed.  some internal variable is not in correct precision");
 				#endif
 
-				NotifyObservers(NewStep<EmitterType>(*this));
+				NotifyObservers<NewStep<EmitterType>>(*this);
 
 				Vec<ComplexType>& predicted_space = std::get<Vec<ComplexType> >(temporary_space_); // this will be populated in the Predict step
 				Vec<ComplexType>& current_space = std::get<Vec<ComplexType> >(current_space_); // the thing we ultimately wish to update
@@ -616,7 +901,7 @@ namespace bertini{
 				SuccessCode predictor_code = Predict<ComplexType, RealType>(predicted_space, current_space, current_time, delta_t);
 				if (predictor_code==SuccessCode::MatrixSolveFailureFirstPartOfPrediction)
 				{
-					NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 					next_stepsize_ = current_stepsize_;
 
 					if (current_precision_==DoublePrecision())
@@ -630,19 +915,19 @@ namespace bertini{
 				}
 				else if (predictor_code==SuccessCode::MatrixSolveFailure)
 				{
-					NotifyObservers(PredictorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<PredictorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();// decrease stepsize, and adjust precision as necessary
 					return predictor_code;
 				}	
 				else if (predictor_code==SuccessCode::HigherPrecisionNecessary)
 				{	
-					NotifyObservers(PredictorHigherPrecisionNecessary<EmitterType>(*this));
+					NotifyObservers<PredictorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType, RealType>();
 					return predictor_code;
 				}
 
 
-				NotifyObservers(SuccessfulPredict<AMPTracker, ComplexType>(*this, predicted_space));
+				NotifyObservers<SuccessfulPredict<AMPTracker, ComplexType>>(*this, predicted_space);
 
 				Vec<ComplexType>& tentative_next_space = std::get<Vec<ComplexType> >(tentative_space_); // this will be populated in the Correct step
 
@@ -654,13 +939,13 @@ namespace bertini{
 
 				if (corrector_code==SuccessCode::MatrixSolveFailure || corrector_code==SuccessCode::FailedToConverge)
 				{
-					NotifyObservers(CorrectorMatrixSolveFailure<EmitterType>(*this));
+					NotifyObservers<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 					NewtonConvergenceError();
 					return corrector_code;
 				}
 				else if (corrector_code == SuccessCode::HigherPrecisionNecessary)
 				{
-					NotifyObservers(CorrectorHigherPrecisionNecessary<EmitterType>(*this));
+					NotifyObservers<CorrectorHigherPrecisionNecessary<EmitterType>>(*this);
 					AMPCriterionError<ComplexType, RealType>();
 					return corrector_code;
 				}
@@ -670,7 +955,7 @@ namespace bertini{
 					return corrector_code;
 				}
 
-				NotifyObservers(SuccessfulCorrect<AMPTracker, ComplexType>(*this, tentative_next_space));
+				NotifyObservers<SuccessfulCorrect<AMPTracker, ComplexType>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -729,22 +1014,41 @@ namespace bertini{
 				unsigned min_precision = MinRequiredPrecision_BCTol<ComplexType, RealType>();
 				unsigned max_precision = max(min_precision,current_precision_);
 
-				if (num_successful_steps_since_stepsize_increase_ < stepping_config_.consecutive_successful_steps_before_stepsize_increase)
+				if (stepping_config_.step_size_controller==config::StepSizeController::PI && predictor_->HasErrorEstimate())
+					max_stepsize = min(mpfr_float(current_stepsize_ * PIStepSizeFactor<RealType>()), stepping_config_.max_step_size);
+				else if (num_successful_steps_since_stepsize_increase_ < stepping_config_.consecutive_successful_steps_before_stepsize_increase)
 					max_stepsize = current_stepsize_; // disallow stepsize changing 
 
+				// a predictor with a trust region, as near a pole of the path, bounds the step however small its error
+				const double trust_region = predictor_->TrustRegion();
+				if (std::isfinite(trust_region) && max_stepsize > trust_region)
+					max_stepsize = max(mpfr_float(trust_region), min_stepsize);
+
 
 				if ( (num_successful_steps_since_precision_decrease_ < AMP_config_.consecutive_successful_steps_before_precision_decrease)
 				    ||
 				    (num_precision_decreases_ >= AMP_config_.max_num_precision_decreases))
 					min_precision = max(min_precision, current_precision_); // disallow precision changing 
 
+				if (AMP_config_.predictive_precision)
+				{
+					// raise now what the next step is predicted to need, and lower only with room to spare
+					const unsigned predicted = static_cast<unsigned>(std::ceil(PredictedRequiredDigits<ComplexType, RealType>()));
+					const unsigned needed = std::min(predicted, AMP_config_.maximum_precision);
+					const unsigned kept = std::min(predicted + AMP_config_.precision_decrease_margin, current_precision_);
+					min_precision = max(min_precision, needed, kept);
+					if (needed > current_precision_)
+						max_precision = max(max_precision, needed + PrecisionIncrement());
+				}
+
 
 				MinimizeTrackingCost<RealType>(next_precision_, next_stepsize_, 
 							min_precision, min_stepsize,
 							max_precision, max_stepsize,
 							B_RHS<ComplexType, RealType>(),
 							newton_config_.max_num_newton_iterations,
-							predictor_order_);
+							predictor_order_,
+							AMP_config_.arithmetic_cost);
 
 
 				if ( (next_stepsize_ > current_stepsize_) || (next_precision_ < current_precision_) )
@@ -770,6 +1074,67 @@ namespace bertini{
 
 
 
+			/**
+			\brief The digits criteria B and C are predicted to require at the next step, for AdaptiveMultiplePrecisionConfig::predictive_precision.
+
+			The requirement grows smoothly with the condition of the Jacobian as a path nears a singularity, so it is extrapolated linearly from the requirements at this step and the last successful one.  Only a rise is extrapolated.  Records the requirement at this step for the next call.
+
+			\tparam ComplexType The complex number type.
+			\tparam RealType The real number type.
+			*/
+			template <typename ComplexType, typename RealType>
+			double PredictedRequiredDigits() const
+			{
+				const double required = std::max({static_cast<double>(B_RHS<ComplexType, RealType>()),
+				                                  static_cast<double>(C_RHS<ComplexType, RealType>()),
+				                                  double(digits_tracking_tolerance_)});
+
+				double predicted = required;
+				if (previous_required_digits_ > 0 && required > previous_required_digits_)
+					predicted += required - previous_required_digits_;
+
+				previous_required_digits_ = required;
+				return predicted;
+			}
+
+
+
+			/**
+			\brief The factor by which the proportional-integral controller would change the step size, from the error estimates of the step just taken and the one before it.
+
+			With \f$e_n\f$ the error estimate of the step just taken, relative to the tracking tolerance, and \f$k\f$ the order of the error estimate, the factor is
+			\f[ s \left(\frac{1}{e_n}\right)^{k_I/k} \left(\frac{e_{n-1}}{e_n}\right)^{k_P/k}, \f]
+			with the second term dropped at the start of a path.  It is kept between the fail and success factors, and is at most 1 on the first success after a failure, as a rejected step says the error was underestimated.
+
+			\tparam RealType The real number type of the step just taken.
+			*/
+			template <typename RealType>
+			double PIStepSizeFactor() const
+			{
+				using std::pow;
+				const double k = predictor_order_+1;
+				const double error = static_cast<double>(RealType(std::get<RealType>(error_estimate_) / RealType(tracking_tolerance_)));
+
+				double factor = static_cast<double>(stepping_config_.step_size_success_factor);
+				if (error > 0)
+				{
+					factor = stepping_config_.pi_safety_factor * pow(error, -stepping_config_.pi_integral_exponent/k);
+					if (previous_error_ > 0)
+						factor *= pow(previous_error_/error, stepping_config_.pi_proportional_exponent/k);
+				}
+
+				factor = std::min(factor, static_cast<double>(stepping_config_.step_size_success_factor));
+				factor = std::max(factor, static_cast<double>(stepping_config_.step_size_fail_factor));
+				if (rejected_since_last_success_)
+					factor = std::min(factor, 1.);
+
+				previous_error_ = error;
+				rejected_since_last_success_ = false;
+				return factor;
+			}
+
+
+
 			/**
 			\brief The convergence_error function from \cite AMP2.  
 	
@@ -855,7 +1220,8 @@ namespace bertini{
 							AMP_config_.maximum_precision, max_stepsize,
 							criterion_B_rhs,
 							newton_config_.max_num_newton_iterations,
-							predictor_order_);
+							predictor_order_,
+							AMP_config_.arithmetic_cost);
 				}
 
 				UpdatePrecisionAndStepsize();
@@ -871,13 +1237,27 @@ namespace bertini{
 			template<typename ComplexType, typename RealType>
 			RealType B_RHS() const
 			{	
-				return max(amp::CriterionBRHS(std::get<RealType>(norm_J_), 
+				const RealType rhs = max(amp::CriterionBRHS(std::get<RealType>(norm_J_), 
 				           					  std::get<RealType>(norm_J_inverse_), 
 				           					  newton_config_.max_num_newton_iterations, 
 				           					  RealType(tracking_tolerance_), 
 				           					  std::get<RealType>(size_proportion_), 
 				           					  AMP_config_),
 				            RealType(0));
+
+				// the criterion above counts the error of evaluation in units of the roundoff of RealType, but compensated evaluation in double makes less.  if that suffices, say so.
+				if (AMP_config_.compensated_double_evaluation && rhs > DoublePrecision())
+				{
+					const double compensated = amp::CriterionBRHS(static_cast<double>(std::get<RealType>(norm_J_)), 
+					                                              static_cast<double>(std::get<RealType>(norm_J_inverse_)), 
+					                                              newton_config_.max_num_newton_iterations, 
+					                                              static_cast<double>(tracking_tolerance_), 
+					                                              static_cast<double>(std::get<RealType>(size_proportion_)), 
+					                                              AMP_config_);
+					if (compensated <= DoublePrecision())
+						return RealType(max(compensated, 0.));
+				}
+				return rhs;
 			}
 
 
@@ -914,11 +1294,24 @@ namespace bertini{
 			template<typename ComplexType, typename RealType>
 			RealType C_RHS() const
 			{	
-				return max(amp::CriterionCRHS(std::get<RealType>(norm_J_inverse_), 
-				                              std::get<Vec<ComplexType> > (current_space_).norm(), 
+				const RealType norm_z = std::get<Vec<ComplexType> > (current_space_).norm();
+				const RealType rhs = max(amp::CriterionCRHS(std::get<RealType>(norm_J_inverse_), 
+				                              norm_z, 
 				                              RealType(tracking_tolerance_), 
 				                              AMP_config_),
 				           RealType(0));
+
+				// as for B_RHS
+				if (AMP_config_.compensated_double_evaluation && rhs > DoublePrecision())
+				{
+					const double compensated = amp::CriterionCRHS(static_cast<double>(std::get<RealType>(norm_J_inverse_)), 
+					                                              static_cast<double>(norm_z), 
+					                                              static_cast<double>(tracking_tolerance_), 
+					                                              AMP_config_);
+					if (compensated <= DoublePrecision())
+						return RealType(max(compensated, 0.));
+				}
+				return rhs;
 			}
 
 
@@ -993,7 +1386,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Tracker::IncrementBaseCountersSuccess();
-				NotifyObservers(SuccessfulStep<EmitterType>(*this));
+				NotifyObservers<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -1004,14 +1397,15 @@ namespace bertini{
 				Tracker::IncrementBaseCountersFail();
 				num_successful_steps_since_precision_decrease_ = 0;
 				num_successful_steps_since_stepsize_increase_ = 0;
-				NotifyObservers(FailedStep<EmitterType>(*this));
+				rejected_since_last_success_ = true;
+				NotifyObservers<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				NotifyObservers<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 
@@ -1030,6 +1424,8 @@ namespace bertini{
 			
 			This function computes the next predicted space value, and sets some internals based on the prediction, such as the norm of the Jacobian.
 
+			Above AdaptiveMultiplePrecisionConfig::reduced_precision_prediction_above digits, the prediction is tried in double precision first, see PredictInDouble, and made at the current precision only if that fails.
+
 			The real type and complex type must be commensurate.
 
 			\param[out] predicted_space The result of the prediction
@@ -1054,12 +1450,17 @@ namespace bertini{
 			              				"underlying complex type and the type for comparisons must match");
 				static_assert(std::is_same<typename Derived::Scalar, ComplexType>::value, "scalar types must match");
 
+				if (AMP_config_.reduced_precision_prediction_above && current_precision_ > AMP_config_.reduced_precision_prediction_above
+				    && PredictInDouble(predicted_space, current_space, current_time, delta_t)==SuccessCode::Success)
+					return SuccessCode::Success;
+
 				RealType& norm_J = std::get<RealType>(norm_J_);
 				RealType& norm_J_inverse = std::get<RealType>(norm_J_inverse_);
 				RealType& size_proportion = std::get<RealType>(size_proportion_);
 				RealType& error_estimate = std::get<RealType>(error_estimate_);
 				RealType& condition_number_estimate = std::get<RealType>(condition_number_estimate_);
 
+				BERTINI_TIME_PHASE(profile_, Predict, current_precision_);
 				if (predictor_->HasErrorEstimate())
 					return predictor_->Predict<ComplexType,RealType>(predicted_space,
 									error_estimate,
@@ -1090,6 +1491,87 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Predict in double precision, from a point in multiple precision, for Newton's method to correct at the current precision.
+
+			The stages of the predictor are run on the point rounded to double, and the prediction is rounded up to the current precision.  The prediction stands only if AMP criteria A and C hold for it in double precision, as the predictor checks, so that its solves are sound and its error is below the tracking tolerance.  Then the norms of the Jacobian and its inverse, and the error estimate, found in double, stand for those at the current precision, for the criteria of the corrector and the choice of the next precision and step size.  Otherwise nothing of the tracker's state is changed, and the prediction is to be made at the current precision.
+
+			\return Success if the prediction in double stands, else the code the predictor failed with.
+			*/
+			template<typename Derived>
+			SuccessCode PredictInDouble(Vec<mpfr> & predicted_space, 
+								const Eigen::MatrixBase<Derived>& current_space,
+								mpfr const& current_time, mpfr const& delta_t) const
+			{
+				const auto num_variables = current_space.size();
+				reduced_current_space_.resize(num_variables);
+				for (Eigen::DenseIndex ii = 0; ii < num_variables; ++ii)
+					reduced_current_space_(ii) = dbl(current_space(ii));
+
+				double norm_J, norm_J_inverse, size_proportion, error_estimate;
+				double condition_number_estimate = static_cast<double>(std::get<mpfr_float>(condition_number_estimate_));
+				unsigned num_steps_since_last_condition_number_computation = num_steps_since_last_condition_number_computation_;
+
+				SuccessCode code;
+				{
+					BERTINI_TIME_PHASE(profile_, Predict, DoublePrecision());
+					if (predictor_->HasErrorEstimate())
+						code = predictor_->Predict<dbl,double>(reduced_predicted_space_,
+										error_estimate,
+										size_proportion,
+										norm_J,
+										norm_J_inverse,
+										tracked_system_,
+										reduced_current_space_, dbl(current_time), 
+										dbl(delta_t),
+										condition_number_estimate,
+										num_steps_since_last_condition_number_computation, 
+										stepping_config_.frequency_of_CN_estimation, 
+										static_cast<double>(tracking_tolerance_),
+										AMP_config_);
+					else
+						code = predictor_->Predict<dbl,double>(reduced_predicted_space_,
+										size_proportion,
+										norm_J,
+										norm_J_inverse,
+										tracked_system_,
+										reduced_current_space_, dbl(current_time), 
+										dbl(delta_t),
+										condition_number_estimate,
+										num_steps_since_last_condition_number_computation, 
+										stepping_config_.frequency_of_CN_estimation, 
+										static_cast<double>(tracking_tolerance_),
+										AMP_config_);
+				}
+				if (code!=SuccessCode::Success)
+					return code;
+
+				std::get<mpfr_float>(norm_J_) = mpfr_float(norm_J);
+				std::get<mpfr_float>(norm_J_inverse_) = mpfr_float(norm_J_inverse);
+				std::get<mpfr_float>(size_proportion_) = mpfr_float(size_proportion);
+				if (predictor_->HasErrorEstimate())
+					std::get<mpfr_float>(error_estimate_) = mpfr_float(error_estimate);
+				std::get<mpfr_float>(condition_number_estimate_) = mpfr_float(condition_number_estimate);
+				num_steps_since_last_condition_number_computation_ = num_steps_since_last_condition_number_computation;
+
+				predicted_space.resize(num_variables);
+				for (Eigen::DenseIndex ii = 0; ii < num_variables; ++ii)
+					SetAtPrecision(predicted_space(ii), reduced_predicted_space_(ii), current_precision_);
+				return SuccessCode::Success;
+			}
+
+			/**
+			\overload
+
+			In double precision there is nothing to reduce to.
+			*/
+			template<typename Derived>
+			SuccessCode PredictInDouble(Vec<dbl> &, const Eigen::MatrixBase<Derived>&, dbl const&, dbl const&) const
+			{
+				return SuccessCode::Failure;
+			}
+
+
 
 			/**
 			\brief Run Newton's method.
@@ -1121,6 +1603,7 @@ namespace bertini{
 				RealType& condition_number_estimate = std::get<RealType>(condition_number_estimate_);
 
 
+				BERTINI_TIME_PHASE(profile_, Correct, current_precision_);
 				return corrector_->Correct(corrected_space,
 									norm_delta_z,
 									norm_J,
@@ -1199,6 +1682,7 @@ namespace bertini{
 				RealType& condition_number_estimate = std::get<RealType>(condition_number_estimate_);
 
 
+				BERTINI_TIME_PHASE(profile_, Correct, current_precision_);
 				return corrector_->Correct(new_space,
 										   norm_delta_z,
 										   norm_J,
@@ -1253,6 +1737,7 @@ namespace bertini{
 				R& norm_delta_z = std::get<R>(norm_delta_z_);
 				R& condition_number_estimate = std::get<R>(condition_number_estimate_);
 
+				BERTINI_TIME_PHASE(profile_, Correct, current_precision_);
 				return corrector_->Correct(new_space,
 							   norm_delta_z,
 								norm_J,
@@ -1301,7 +1786,12 @@ namespace bertini{
 				if (new_precision==current_precision_) // no op
 					return SuccessCode::Success;
 
-				NotifyObservers(PrecisionChanged<EmitterType>(*this,current_precision_,new_precision));
+				BERTINI_TIME_PHASE(profile_, PrecisionChange, current_precision_);
+
+				if (new_precision > current_precision_)
+					NotifyObservers<PrecisionIncreased<EmitterType>>(*this,current_precision_,new_precision);
+				else
+					NotifyObservers<PrecisionDecreased<EmitterType>>(*this,current_precision_,new_precision);
 				
 
 				bool upsampling_needed = new_precision > current_precision_;
@@ -1361,6 +1851,7 @@ namespace bertini{
 				tracked_system_.precision(16);
 
 				std::get<Vec<dbl> >(current_space_) = source_point;
+				ReleaseSpace<mpfr>();
 			}
 
 			/**
@@ -1399,6 +1890,9 @@ namespace bertini{
 				for (unsigned ii=0; ii<source_point.size(); ii++)
 					std::get<Vec<dbl> >(current_space_)(ii) = dbl(source_point(ii));
 
+				// the source may be the multiple precision space value itself, so is released only now
+				ReleaseSpace<mpfr>();
+
 				endtime_.precision(DoublePrecision());
 			}
 
@@ -1439,16 +1933,13 @@ namespace bertini{
 				predictor_->ChangePrecision(new_precision);
 				corrector_->ChangePrecision(new_precision);
 
-				endtime_ = endtime_highest_precision_;
-				endtime_.precision(new_precision);
+				// in place, so that precision changes to precisions already visited allocate nothing
+				SetAtPrecision(endtime_, endtime_highest_precision_, new_precision);
 
 				current_time_.precision(new_precision);
 
-				if (std::get<Vec<mpfr> >(current_space_).size()!=source_point.size())
-					std::get<Vec<mpfr> >(current_space_).resize(source_point.size());
-
-				for (unsigned ii=0; ii<source_point.size(); ii++)
-					std::get<Vec<mpfr> >(current_space_)(ii) = mpfr(source_point(ii));
+				SetAtPrecision(std::get<Vec<mpfr> >(current_space_), source_point, new_precision);
+				ReleaseSpace<dbl>();
 
 				AdjustTemporariesPrecision(new_precision);
 
@@ -1497,16 +1988,13 @@ namespace bertini{
 				predictor_->ChangePrecision(new_precision);
 				corrector_->ChangePrecision(new_precision);
 
-				endtime_ = endtime_highest_precision_;
-				endtime_.precision(new_precision);
+				// in place, so that precision changes to precisions already visited allocate nothing
+				SetAtPrecision(endtime_, endtime_highest_precision_, new_precision);
 
 				current_time_.precision(new_precision);
 
-				if (std::get<Vec<mpfr> >(current_space_).size()!=source_point.size())
-					std::get<Vec<mpfr> >(current_space_).resize(source_point.size());
-
-				for (unsigned ii=0; ii<source_point.size(); ii++)
-					std::get<Vec<mpfr> >(current_space_)(ii) = mpfr(source_point(ii));
+				SetAtPrecision(std::get<Vec<mpfr> >(current_space_), source_point, new_precision);
+				ReleaseSpace<dbl>();
 
 				AdjustTemporariesPrecision(new_precision);
 
@@ -1541,13 +2029,13 @@ namespace bertini{
 				unsigned num_vars = tracked_system_.NumVariables();
 
 				//  the current_space value is adjusted in the appropriate ChangePrecision function
-				std::get<Vec<mpfr> >(tentative_space_).resize(num_vars);
-				for (unsigned ii = 0; ii < num_vars; ++ii)
-					std::get<Vec<mpfr> >(tentative_space_)(ii).precision(new_precision);
+				if (std::get<Vec<mpfr> >(tentative_space_).size()!=num_vars)
+					std::get<Vec<mpfr> >(tentative_space_).resize(num_vars);
+				Precision(std::get<Vec<mpfr> >(tentative_space_), new_precision);
 
-				std::get<Vec<mpfr> >(temporary_space_).resize(num_vars);
-				for (unsigned ii = 0; ii < num_vars; ++ii)
-					std::get<Vec<mpfr> >(temporary_space_)(ii).precision(new_precision);
+				if (std::get<Vec<mpfr> >(temporary_space_).size()!=num_vars)
+					std::get<Vec<mpfr> >(temporary_space_).resize(num_vars);
+				Precision(std::get<Vec<mpfr> >(temporary_space_), new_precision);
 
 				std::get<mpfr_float>(condition_number_estimate_).precision(new_precision);
 				std::get<mpfr_float>(error_estimate_).precision(new_precision);
@@ -1619,11 +2107,21 @@ namespace bertini{
 			mutable unsigned num_precision_decreases_; ///< The number of times precision has decreased this track.
 			mutable unsigned initial_precision_; ///< The precision at the start of tracking.
 			mutable unsigned num_successful_steps_since_precision_decrease_; ///< The number of successful steps since decreased precision.
+			mutable double previous_error_; ///< The error estimate of the last successful step, relative to the tracking tolerance, for the PI step size controller.  0 if there is none.
+			mutable Vec<dbl> reduced_current_space_; ///< The current point, rounded to double, for predicting in double, see PredictInDouble.
+			mutable Vec<dbl> reduced_predicted_space_; ///< The prediction in double, before it is rounded up to the current precision.
+			mutable bool rejected_since_last_success_; ///< Whether a step has failed since the last success, for the PI step size controller.
+			mutable double previous_required_digits_; ///< The digits criteria B and C required at the last successful step, for predictive_precision.  0 if there is none.
 
 			mutable mpfr endtime_highest_precision_;
 
 			config::AdaptiveMultiplePrecisionConfig AMP_config_; ///< The Adaptive Multiple Precision settings.
 
+			config::Speculation speculation_config_; ///< Whether, and how, each step is attempted at several step sizes at once.
+			std::shared_ptr<detail::ThreadTeam> speculation_team_; ///< The threads of the speculative attempts, the calling thread making this tracker's own.  Null when speculation is off.
+			mutable std::vector< std::shared_ptr<System> > speculative_systems_; ///< The copies of the system the helpers track on, made at the start of each path.
+			mutable std::vector< std::shared_ptr<AMPTracker> > speculative_trackers_; ///< The helpers, attempting each step at the smaller step sizes.
+
 		public:
 			// functions offered for observers.
 			template<typename RT>
@@ -0,0 +1,337 @@
+//This file is part of Bertini 2.
+//
+//auto_tune.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//auto_tune.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with auto_tune.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file auto_tune.hpp
+
+\brief Choose the settings of the trackers for a run by tracking a small sample of its paths under each of several candidates.
+
+Which predictor, step sizes and corrector are fastest depends on the system, and settings safe for every system are slow for most.  AutoTune tracks the same random sample of start points under each candidate in turn, on the pool of TrackAllPaths, measuring with a metrics::Registry the time and steps each takes, and chooses the candidate which takes the least time per path it answers, among those failing hardly more paths than the best.
+
+The choice may be cached, keyed by the text of the input, beside the cached system, see system_cache.hpp, so that a system solved again is not tuned again.
+*/
+
+#ifndef BERTINI_TRACKING_AUTO_TUNE_HPP
+#define BERTINI_TRACKING_AUTO_TUNE_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+#include "bertini2/tracking/metrics.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bertini {
+	namespace tracking {
+
+		/**
+		\brief A setting of the trackers to be tried by AutoTune.
+		*/
+		template<typename TrackerType>
+		struct TuningCandidate
+		{
+			using RealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			std::string name; ///< Names the candidate in the cache, so must be unique among the candidates.
+			std::function<void(TrackerType &)> adjust; ///< Changes the settings of a tracker fresh from setup.  May be empty, to try setup as it is.
+
+			static TuningCandidate AsSetUp()
+			{
+				TuningCandidate candidate;
+				candidate.name = "as_set_up";
+				return candidate;
+			}
+
+			static TuningCandidate SwitchPredictor(config::Predictor predictor, std::string name)
+			{
+				TuningCandidate candidate;
+				candidate.name = std::move(name);
+				candidate.adjust = [predictor](TrackerType & tracker)
+					{
+						tracker.Predictor(predictor);
+					};
+				return candidate;
+			}
+
+			/**
+			\brief Multiply the initial and largest step sizes by a factor, which may be less than 1.
+			*/
+			static TuningCandidate ScaleSteps(RealType const& factor, std::string name)
+			{
+				TuningCandidate candidate;
+				candidate.name = std::move(name);
+				candidate.adjust = [factor](TrackerType & tracker)
+					{
+						auto stepping = tracker.SteppingSettings();
+						stepping.initial_step_size *= factor;
+						stepping.max_step_size *= factor;
+						tracker.SteppingSettings(stepping);
+					};
+				return candidate;
+			}
+
+			static TuningCandidate AdjustNewton(std::function<void(config::Newton &)> change, std::string name)
+			{
+				TuningCandidate candidate;
+				candidate.name = std::move(name);
+				candidate.adjust = [change](TrackerType & tracker)
+					{
+						auto newton = tracker.NewtonSettings();
+						change(newton);
+						tracker.NewtonSettings(newton);
+					};
+				return candidate;
+			}
+		};
+
+
+		/**
+		\brief The candidates AutoTune tries, and how it samples and chooses.
+		*/
+		template<typename TrackerType>
+		struct TuningPolicy
+		{
+			using RealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			std::vector< TuningCandidate<TrackerType> > candidates;
+			std::size_t sample_size = 32; ///< The number of start points tracked under each candidate, or all of them, if fewer.
+			std::uint64_t seed = 0; ///< Of the generator choosing the sample, so that tuning is repeatable.
+			double failure_tolerance = 0; ///< How much greater than the least rate of failure of any candidate that of the chosen one may be.
+
+			/**
+			\brief The settings as set up, the RK4 and RKF45 predictors, twice and half the step sizes, and the corrector with more iterations, and with its Jacobian reused.
+			*/
+			static TuningPolicy Default()
+			{
+				TuningPolicy policy;
+				policy.candidates.push_back(TuningCandidate<TrackerType>::AsSetUp());
+				policy.candidates.push_back(TuningCandidate<TrackerType>::SwitchPredictor(config::Predictor::RK4, "rk4"));
+				policy.candidates.push_back(TuningCandidate<TrackerType>::SwitchPredictor(config::Predictor::RKF45, "rkf45"));
+				policy.candidates.push_back(TuningCandidate<TrackerType>::ScaleSteps(RealType(2), "larger_steps"));
+				policy.candidates.push_back(TuningCandidate<TrackerType>::ScaleSteps(RealType(1)/RealType(2), "smaller_steps"));
+				policy.candidates.push_back(TuningCandidate<TrackerType>::AdjustNewton([](config::Newton & newton){ newton.max_num_newton_iterations = 3; }, "three_newton_iterations"));
+				policy.candidates.push_back(TuningCandidate<TrackerType>::AdjustNewton([](config::Newton & newton){ newton.reuse_jacobian = true; }, "reuse_jacobian"));
+				return policy;
+			}
+		};
+
+
+		/**
+		\brief What tracking the sample under a candidate took.
+		*/
+		struct TuningMeasurement
+		{
+			std::string name;
+			std::size_t answered = 0; ///< Paths which succeeded, or were found going to infinity.
+			std::size_t failed = 0;
+			double seconds = 0; ///< The wall time of tracking the sample.
+			std::uint64_t steps = 0; ///< Successful and failed, over all paths.
+
+			double FailureRate() const
+			{
+				return answered+failed ? static_cast<double>(failed)/(answered+failed) : 0;
+			}
+
+			/**
+			\brief The wall time per path answered, or infinity if none were.
+			*/
+			double SecondsPerAnsweredPath() const
+			{
+				return answered ? seconds/answered : std::numeric_limits<double>::infinity();
+			}
+		};
+
+
+		/**
+		\brief The outcome of AutoTune.
+		*/
+		struct TuningResult
+		{
+			std::size_t chosen = 0; ///< The index of the chosen candidate in the policy.
+			bool from_cache = false; ///< Whether the choice was read from a cache, in which case there are no measurements.
+			std::vector<TuningMeasurement> measurements; ///< One per candidate, in the order of the policy.
+		};
+
+
+		/**
+		\brief The candidate to choose from measurements: the fastest per path answered, of those failing at most the tolerance more than the best.  Ties go to the earlier candidate.
+		*/
+		std::size_t ChooseCandidate(std::vector<TuningMeasurement> const& measurements, double failure_tolerance);
+
+
+		/**
+		\brief Write the name of a chosen candidate to a cache file, keyed by the text of the input and the names of all the candidates.
+
+		\throws std::runtime_error if the file cannot be written.
+		*/
+		void SaveTuning(std::string const& input, std::vector<std::string> const& candidate_names, std::string const& chosen, boost::filesystem::path const& cache_file);
+
+		/**
+		\brief Read the name of the chosen candidate from a cache file, if it was written for this input and these candidates.
+
+		\return The name, or empty if the file does not exist, was written for other input or candidates, or cannot be read.
+		*/
+		std::string LoadTuning(std::string const& input, std::vector<std::string> const& candidate_names, boost::filesystem::path const& cache_file);
+
+
+		/**
+		\brief A setup function which calls setup, and then adjusts by a candidate.
+		*/
+		template<typename TrackerType, typename SetupFunction>
+		std::function<void(TrackerType &)> TunedSetup(SetupFunction setup, TuningCandidate<TrackerType> const& candidate)
+		{
+			auto adjust = candidate.adjust;
+			return [setup, adjust](TrackerType & tracker)
+				{
+					setup(tracker);
+					if (adjust)
+						adjust(tracker);
+				};
+		}
+
+
+		/**
+		\brief Choose among candidate settings for tracking all the paths of a homotopy, by tracking a sample of them under each.
+
+		## Use
+
+		\code
+		auto policy = TuningPolicy<AMPTracker>::Default();
+		auto tuning = AutoTune<AMPTracker>(homotopy, TD, setup, mpfr(1), mpfr(0), policy);
+		auto results = TrackAllPaths<AMPTracker>(homotopy, TD, TunedSetup<AMPTracker>(setup, policy.candidates[tuning.chosen]), mpfr(1), mpfr(0));
+		\endcode
+
+		The sample is drawn once, without replacement, and tracked in parallel by TrackAllPaths under each candidate in turn, so each is timed on the same paths, on the whole pool.  The paths of a sample are few, so the times of candidates within a few percent of each other are not told apart reliably; the choice among those matters little.
+
+		\param homotopy The system to track on.
+		\param start_system The source of the start points.
+		\param setup Configure a freshly made tracker, before the candidate adjusts it.
+		\param start_time The time at which the start points solve the homotopy.
+		\param end_time The time to track to.
+		\param policy The candidates, and how to sample and choose.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+		\param high_precision_threshold The precision, in digits, past which a path is isolated on its worker.
+
+		\return The chosen candidate, and what each took.
+
+		\throws std::runtime_error if there are no candidates.
+		\throws Whatever TrackAllPaths throws.
+		*/
+		template<typename TrackerType, typename StartSystemType, typename SetupFunction>
+		TuningResult AutoTune(System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+		                      typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+		                      typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+		                      TuningPolicy<TrackerType> const& policy = TuningPolicy<TrackerType>::Default(),
+		                      unsigned num_threads = 0,
+		                      unsigned high_precision_threshold = 64)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			if (policy.candidates.empty())
+				throw std::runtime_error("auto-tuning needs at least one candidate");
+
+			const auto num_paths = static_cast<std::size_t>(start_system.NumStartPoints());
+			std::vector<std::size_t> indices(num_paths);
+			std::iota(indices.begin(), indices.end(), std::size_t(0));
+			std::mt19937_64 generator(policy.seed);
+			std::shuffle(indices.begin(), indices.end(), generator);
+			indices.resize(std::min(policy.sample_size, num_paths));
+
+			std::vector< Vec<ComplexType> > points;
+			for (auto ii : indices)
+				points.push_back(start_system.template StartPoint<ComplexType>(ii));
+			const detail::StartPointList<ComplexType> sample(points);
+
+			TuningResult result;
+			for (auto const& candidate : policy.candidates)
+			{
+				metrics::Registry registry;
+				auto results = TrackAllPaths<TrackerType>(homotopy, sample, TunedSetup<TrackerType>(setup, candidate), start_time, end_time, num_threads, high_precision_threshold, &registry);
+				const auto snapshot = registry.TakeSnapshot();
+
+				TuningMeasurement measurement;
+				measurement.name = candidate.name;
+				measurement.seconds = snapshot.seconds;
+				measurement.steps = snapshot.Count(metrics::Counter::SuccessfulSteps) + snapshot.Count(metrics::Counter::FailedSteps);
+				for (auto const& r : results)
+					if (r.success_code==SuccessCode::Success || r.success_code==SuccessCode::GoingToInfinity)
+						++measurement.answered;
+					else
+						++measurement.failed;
+				result.measurements.push_back(measurement);
+			}
+
+			result.chosen = ChooseCandidate(result.measurements, policy.failure_tolerance);
+			return result;
+		}
+
+
+		/**
+		\brief AutoTune, unless a cache file holds the choice for this input and these candidates, and in that case, the choice from the cache.
+
+		\param input The text from which the homotopy was made, which keys the cache, as for CachedSystem.
+		\param cache_file The file to read, or to write the choice to if it does not hold one for the input.  The file of the cached system, with ".tuning" appended, is a natural place.
+
+		The other parameters are those of AutoTune.
+
+		\throws std::runtime_error if the file cannot be written, or there are no candidates.
+		*/
+		template<typename TrackerType, typename StartSystemType, typename SetupFunction>
+		TuningResult AutoTuneCached(std::string const& input, boost::filesystem::path const& cache_file,
+		                            System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+		                            typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+		                            typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+		                            TuningPolicy<TrackerType> const& policy = TuningPolicy<TrackerType>::Default(),
+		                            unsigned num_threads = 0,
+		                            unsigned high_precision_threshold = 64)
+		{
+			std::vector<std::string> names;
+			for (auto const& candidate : policy.candidates)
+				names.push_back(candidate.name);
+
+			const auto cached = LoadTuning(input, names, cache_file);
+			if (!cached.empty())
+			{
+				TuningResult result;
+				result.chosen = std::find(names.begin(), names.end(), cached) - names.begin();
+				result.from_cache = true;
+				return result;
+			}
+
+			auto result = AutoTune<TrackerType>(homotopy, start_system, setup, start_time, end_time, policy, num_threads, high_precision_threshold);
+			SaveTuning(input, names, names[result.chosen], cache_file);
+			return result;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
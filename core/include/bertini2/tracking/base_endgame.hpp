@@ -44,16 +44,32 @@
 #include "bertini2/limbo.hpp"
 
 #include "bertini2/system.hpp"
+#include "bertini2/memory_usage.hpp"
 
 #include "bertini2/enable_permuted_arguments.hpp"
 
 #include "bertini2/tracking/tracking_config.hpp"
 #include "bertini2/tracking/interpolation.hpp"
+#include "bertini2/tracking/instrumentation.hpp"
 
 #include "bertini2/logging.hpp"
 
 namespace bertini{ 
 
+	namespace memory {
+		template<typename T>
+		struct Heap< tracking::RingBuffer<T> >
+		{
+			static std::size_t Bytes(tracking::RingBuffer<T> const& r)
+			{
+				std::size_t bytes = r.capacity()*sizeof(T);
+				for (auto const& t : r)
+					bytes += HeapBytes(t);
+				return bytes;
+			}
+		};
+	}
+
 	namespace tracking {
 
 		namespace endgame {
@@ -105,6 +121,9 @@ namespace bertini{
 				// state variables
 				mutable std::tuple<Vec<dbl>, Vec<mpfr> > final_approximation_at_origin_; 
 				mutable unsigned int cycle_number_ = 0; 
+				mutable std::tuple<double, mpfr_float> approximate_error_; ///< The norm of the difference of the last two approximations at the origin.
+				mutable instrument::Profile profile_; ///< The times and counts of the phases of the endgame.  The tracking it does is in the tracker's profile.
+				mutable instrument::PathStatistics run_statistics_; ///< The kind, loops and time of the last run, see AddStatistics.  The rest of it is unused.
 
 
 				/**
@@ -148,6 +167,15 @@ namespace bertini{
 				void CycleNumber(unsigned c) { cycle_number_ = c;}
 				void IncrementCycleNumber(unsigned inc) { cycle_number_ += inc;}
 
+				/**
+				\brief Start the statistics of a run, of an endgame of a kind.  Time the run into run_statistics_.endgame_seconds after this.
+				*/
+				void BeginRunStatistics(instrument::PathStatistics::EndgameType type) const
+				{
+					run_statistics_ = instrument::PathStatistics();
+					run_statistics_.endgame = type;
+				}
+
 				
 
 				const auto& EndgameSettings() const
@@ -193,13 +221,60 @@ namespace bertini{
 				const TrackerType & GetTracker() const
 				{return tracker_;}
 
+				/**
+				\brief The memory held by the endgame, by component: its samples, and its approximations at the origin.  The tracker it uses has a report of its own.
+				*/
+				MemoryUsage MemoryReport() const
+				{
+					auto report = AsDerived().SampleMemory();
+					report.Add("approximations", memory::HeapBytes(final_approximation_at_origin_) + memory::HeapBytes(approximate_error_));
+					return report;
+				}
+
 				template<typename CT>
 				const Vec<CT>& FinalApproximation() const 
 				{return std::get<Vec<CT> >(final_approximation_at_origin_);}
 
+				/**
+				\brief An estimate of the accuracy of the final approximation, the norm of its difference from the one before it, or 1 if the endgame stopped before making two.
+				*/
+				template<typename RT>
+				const RT& ApproximateError() const 
+				{return std::get<RT>(approximate_error_);}
+
 				const System& GetSystem() const 
 				{ return tracker_.GetSystem();}
 
+				/**
+				\brief The time spent in, and number of calls to, the phases of the endgame, by precision, since construction or the last ResetProfile().
+				*/
+				instrument::Profile const& Profile() const
+				{return profile_;}
+
+				void ResetProfile()
+				{profile_.Reset();}
+
+				/**
+				\brief Set the endgame's part of a path's statistics, from its last run: its kind, loops, time, and the cycle number found.
+				*/
+				void AddStatistics(instrument::PathStatistics & statistics) const
+				{
+					statistics.endgame = run_statistics_.endgame;
+					statistics.endgame_loops = run_statistics_.endgame_loops;
+					statistics.endgame_seconds += run_statistics_.endgame_seconds;
+					statistics.cycle_number = CycleNumber();
+				}
+
+				/**
+				\brief The statistics of the tracker, with AddStatistics of the last run.  Reset the tracker's statistics before a run for those of the one path.
+				*/
+				instrument::PathStatistics Statistics() const
+				{
+					auto statistics = tracker_.Statistics();
+					AddStatistics(statistics);
+					return statistics;
+				}
+
 
 				/**
 				\brief Populates time and space samples so that we are ready to start the endgame. 
@@ -235,6 +310,7 @@ namespace bertini{
 				{	
 					using RT = typename Eigen::NumTraits<CT>::Real;
 					assert(endgame_settings_.num_sample_points>0 && "number of sample points must be positive");
+					BERTINI_TIME_PHASE(profile_, EndgameSampling, Precision(start_time));
 
 					if (TrackerTraits<TrackerType>::IsAdaptivePrec)
 					{
@@ -244,18 +320,25 @@ namespace bertini{
 
 					samples.clear();
 					times.clear();
+					// room for the samples kept, and one more, pushed before the oldest is popped as the endgame advances
+					samples.reserve(endgame_settings_.num_sample_points+1);
+					times.reserve(endgame_settings_.num_sample_points+1);
 
 					samples.push_back(x_endgame);
 					times.push_back(start_time);
 
-					auto num_vars = GetSystem().NumVariables();
 					//start at 1, because the input point is the 0th element.
 					for(int ii=1; ii < endgame_settings_.num_sample_points; ++ii)
 					{ 
-						times.emplace_back(times[ii-1] * RT(endgame_settings_.sample_factor));
-						samples.emplace_back(Vec<CT>(num_vars));
-
-						auto tracking_success = tracker_.TrackPath(samples[ii],times[ii-1],times[ii],samples[ii-1]);
+						times.push_back(times[ii-1] * RT(endgame_settings_.sample_factor));
+						samples.resize(ii+1); // the sample is written by tracking, into the storage of its slot
+
+						// a path which stepped past the last sample goes on from there, see config::Stepping::dense_output
+						auto tracking_success = (ii>1 && tracker_.SteppedPastEndTime())
+												?
+											tracker_.ContinuePath(samples[ii],times[ii])
+												:
+											tracker_.TrackPath(samples[ii],times[ii-1],times[ii],samples[ii-1]);
 						AsDerived().EnsureAtPrecision(times[ii],Precision(samples[ii]));
 
 						if (tracking_success!=SuccessCode::Success)
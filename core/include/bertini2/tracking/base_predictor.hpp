@@ -83,6 +83,12 @@ namespace bertini{
 						return 5;
 					case (Predictor::RKVerner67):
 						return 6;
+					case (Predictor::Pade):
+						return 3;
+					case (Predictor::Taylor):
+						return 4;
+					case (Predictor::Hermite):
+						return 3;
 					default:
 					{
 						throw std::runtime_error("incompatible predictor choice in Order");
@@ -109,6 +115,12 @@ namespace bertini{
 						return true;
 					case (Predictor::RKVerner67):
 						return true;
+					case (Predictor::Pade):
+						return true;
+					case (Predictor::Taylor):
+						return true;
+					case (Predictor::Hermite):
+						return true;
 					default:
 					{
 						throw std::runtime_error("incompatible predictor choice in HasErrorEstimate");
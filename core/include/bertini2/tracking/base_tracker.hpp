@@ -34,10 +34,15 @@
 #define BERTINI_BASE_TRACKER_HPP
 
 #include <algorithm>
+#include <array>
+#include <deque>
 //#include "bertini2/tracking/step.hpp"
 #include "bertini2/tracking/ode_predictors.hpp"
+#include "bertini2/tracking/order_selection.hpp"
 #include "bertini2/tracking/newton_corrector.hpp"
+#include "bertini2/tracking/instrumentation.hpp"
 #include "bertini2/limbo.hpp"
+#include "bertini2/limb_pool.hpp"
 #include "bertini2/logging.hpp"
 #include "bertini2/detail/visitable.hpp"
 
@@ -134,6 +139,9 @@ namespace bertini{
 
 		void PostTrackCleanup() override
 		{}
+
+		void ResumeTracking() override
+		{}
 		\endcode
 		where you probably want to call this base function, which is why it is protected, not private.
 
@@ -156,6 +164,8 @@ namespace bertini{
 			{
 				predictor_ = std::make_shared< predict::ExplicitRKPredictor >(predict::DefaultPredictor(), sys);
 				corrector_ = std::make_shared< correct::NewtonCorrector >(sys);
+				predictor_->Instrument(&profile_);
+				corrector_->Instrument(&profile_);
 				Predictor(predict::DefaultPredictor());
 			}
 
@@ -205,11 +215,91 @@ namespace bertini{
 									Vec<CT> const& start_point
 									) const
 			{	
+				SuccessCode initialization_code = BeginPath(start_time, endtime, start_point);
+				if (initialization_code!=SuccessCode::Success)
+					return initialization_code;
+
+				instrument::Stopwatch timer(statistics_.tracking_seconds);
+				return TrackerLoop(solution_at_endtime);
+			}
+
+
+			/**
+			\brief Continue tracking the path last tracked, from where it ended, to a new target time.
+
+			\param[out] solution_at_endtime The value of the solution at the end time.
+			\param endtime The time to track to.
+			\return A success code indicating whether tracking was successful.
+
+			Unlike TrackPath, the tracker is not initialized again.  Tracking resumes from the time and point at which it last stopped, with the step size and precision it had, and no initial refinement of the point.  The counters of steps carry on, so a path tracked in several pieces has the same budget of steps as one tracked in one.  The precision of the system is made the tracker's again, as between the pieces an endgame may change it.  Use it for tracking a path in pieces, such as around a circle in the Cauchy endgame.
+
+			\throws std::runtime_error if the tracker has not tracked a path yet.
+			*/
+			SuccessCode ContinuePath(Vec<CT> & solution_at_endtime, CT const& endtime) const
+			{
+				if (CurrentPoint().size()!=tracked_system_.NumVariables())
+					throw std::runtime_error("continuing path, but the tracker has no current point to continue from");
+
+				instrument::Stopwatch timer(statistics_.tracking_seconds);
+				ResumeTracking();
+				NotifyTrackingStarted();
+				divergence_samples_.clear();
+				boundary_samples_.clear();
+				stopped_at_endgame_boundary_ = false;
+				passed_end_time_ = false;
+				interpolation_failed_ = false;
+				SuccessCode continuation_code = TrackerLoopContinuation(endtime);
+				if (continuation_code!=SuccessCode::Success)
+				{
+					PostTrackCleanup();
+					return continuation_code;
+				}
+				path_in_progress_ = true;
+
+				return TrackerLoop(solution_at_endtime);
+			}
+
+
+			/**
+			\brief Set up to track a path a few steps at a time, with AdvancePath, rather than all at once.
+
+			\param start_time The time at which to start tracking.
+			\param endtime The time to track to.
+			\param start_point The intial space values for tracking.
+			\return The code of the initialization.  If not SuccessCode::Success, the path is not in progress.
+
+			TrackPath is BeginPath, and then AdvancePath until the path is done.  Stepping a path piecewise lets one thread interleave many paths, each with its own tracker, so that a scheduler may choose which path steps next, or gather the evaluations of several.
+
+			## Example
+
+			\code
+			std::vector< std::shared_ptr<AMPTracker> > trackers; // one for each path in flight, set up alike
+			for (unsigned ii=0; ii<trackers.size(); ++ii)
+				trackers[ii]->BeginPath(t_start, t_end, start_points[ii]);
+
+			bool any_in_progress = true;
+			while (any_in_progress)
+			{
+				any_in_progress = false;
+				for (unsigned ii=0; ii<trackers.size(); ++ii)
+					if (trackers[ii]->PathInProgress())
+					{
+						codes[ii] = trackers[ii]->AdvancePath(endpoints[ii], 10);
+						any_in_progress |= trackers[ii]->PathInProgress();
+					}
+			}
+			\endcode
+
+			\throws std::runtime_error if the start point is not the size of the system.
+			*/
+			SuccessCode BeginPath(CT const& start_time, CT const& endtime, Vec<CT> const& start_point) const
+			{
 				if (start_point.size()!=tracked_system_.NumVariables())
 					throw std::runtime_error("start point size must match the number of variables in the system to be tracked");
 
-				
-				
+				instrument::Stopwatch timer(statistics_.tracking_seconds);
+				path_in_progress_ = false;
+				NotifyTrackingStarted();
 				SuccessCode initialization_code = TrackerLoopInitialization(start_time, endtime, start_point);
 				if (initialization_code!=SuccessCode::Success)
 				{
@@ -217,46 +307,55 @@ namespace bertini{
 					return initialization_code;
 				}
 
-				// as precondition to this while loop, the correct container, either dbl or mpfr, must have the correct data.
-				while (!IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon()))
-				{	
-					SuccessCode pre_iteration_code = PreIterationCheck();
-					if (pre_iteration_code!=SuccessCode::Success)
-					{
-						PostTrackCleanup();
-						return pre_iteration_code;
-					}
+				path_in_progress_ = true;
+				return SuccessCode::Success;
+			}
 
-					using std::abs;
-					// compute the next delta_t
-					if (abs(endtime_-current_time_) < abs(current_stepsize_))
-						delta_t_ = endtime_-current_time_;
-					else
-						delta_t_ = current_stepsize_ * (endtime_ - current_time_)/abs(endtime_ - current_time_);
 
+			/**
+			\brief Take up to a number of steps along the path set up by BeginPath, stopping early at the end time, on failure, or when the precision changes.
 
-					step_success_code_ = TrackerIteration();
+			\param[out] solution_at_endtime The value of the solution at the end time, written only once the end time is reached.
+			\param max_num_steps The most steps to take, counting failed steps, before yielding.
+			\return SuccessCode::Success while the path is in progress or once it has reached the end time, and the code of the failure otherwise.  Use PathInProgress to tell the first two apart.
 
-					if (infinite_path_truncation_ && (CheckGoingToInfinity()==SuccessCode::GoingToInfinity))
-					{	
-						OnInfiniteTruncation();
-						PostTrackCleanup();
-						return SuccessCode::GoingToInfinity;
-					}
-					else if (step_success_code_==SuccessCode::Success)
-						OnStepSuccess();
-					else
-						OnStepFail();
+			A change of precision ends the steps early, so that a scheduler sees it, and can group the paths by the precision at which they are tracked.  Between calls, other trackers may step other paths, even on the same system, as the tracker makes the system's precision its own again as it resumes.
+
+			\throws std::runtime_error if no path is in progress.
+			*/
+			SuccessCode AdvancePath(Vec<CT> & solution_at_endtime, unsigned max_num_steps = 1) const
+			{
+				if (!path_in_progress_)
+					throw std::runtime_error("advancing a path, but none is in progress.  call BeginPath first");
 
-				}// re: while
+				instrument::Stopwatch timer(statistics_.tracking_seconds);
+				ResumeTracking();
+				const unsigned precision = CurrentPrecision();
+				for (unsigned ii = 0; ii < max_num_steps && !ReachedEndTime(); ++ii)
+				{
+					SuccessCode step_code = TrackerLoopStep();
+					if (step_code!=SuccessCode::Success)
+						return step_code;
 
+					if (CurrentPrecision()!=precision)
+						break;
+				}
 
-				CopyFinalSolution(solution_at_endtime);
-				PostTrackCleanup();
+				if (ReachedEndTime())
+					return FinishTrackerLoop(solution_at_endtime);
 				return SuccessCode::Success;
 			}
 
 
+			/**
+			\brief Whether a path begun by BeginPath, TrackPath or ContinuePath has yet to reach its end time or fail.
+			*/
+			bool PathInProgress() const
+			{
+				return path_in_progress_;
+			}
+
+
 
 
 			/**
@@ -316,13 +415,27 @@ namespace bertini{
 			*/
 			void Predictor(config::Predictor new_predictor_choice)
 			{
-				predictor_->PredictorMethod(new_predictor_choice);
+				configured_predictor_ = new_predictor_choice;
+				UsePredictor(new_predictor_choice);
+			}
+
+
+			/**
+			\brief Set the order of the Taylor predictor, config::Predictor::Taylor.  4 by default.
+
+			\throws std::runtime_error if the order is 0.
+			*/
+			void TaylorPredictorOrder(unsigned order)
+			{
+				predictor_->TaylorOrder(order);
 				predictor_order_ = predictor_->Order();
 			}
 
 
 			/**
-			\brief Query the currently set predictor
+			\brief Query the currently used predictor
+
+			With adaptive order selection on, this is the method the last step was predicted with, which changes along a path.
 			*/
 			config::Predictor Predictor() const
 			{
@@ -330,6 +443,107 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Set how the predictor is chosen along a path.
+
+			With adaptive selection on, each path starts from the embedded Runge-Kutta pair nearest in order to the predictor set by Predictor(), and switches among the pairs as it goes, by their cost per unit of time advanced.
+
+			\see config::OrderSelection, predict::OrderSelector
+			*/
+			void PredictorOrderSelection(config::OrderSelection const& settings)
+			{
+				order_selector_.Settings(settings);
+				if (!settings.adaptive)
+					UsePredictor(configured_predictor_);
+			}
+
+			/**
+			\brief Query how the predictor is chosen along a path.
+			*/
+			config::OrderSelection const& PredictorOrderSelection() const
+			{
+				return order_selector_.Settings();
+			}
+
+
+			/**
+			\brief Set whether paths are declared going to infinity early, from the growth of their norm, and how.
+
+			Applies only while infinite path truncation is on.
+
+			\throws std::runtime_error if the window is fewer than 3 steps.
+			\see config::Divergence
+			*/
+			void DivergenceDetection(config::Divergence const& settings)
+			{
+				if (settings.window < 3)
+					throw std::runtime_error("divergence estimate needs a window of at least 3 steps");
+				divergence_config_ = settings;
+				divergence_samples_.clear();
+			}
+
+			/**
+			\brief Query whether, and how, paths are declared going to infinity early.
+			*/
+			config::Divergence const& DivergenceDetection() const
+			{
+				return divergence_config_;
+			}
+
+
+			/**
+			\brief Set whether each path is stopped at an endgame boundary of its own, before the end time, once it shows singular behaviour, and how.
+
+			The endgames suspend it while they run, for they track where paths are singular by design.
+
+			\throws std::runtime_error if the slopes are to be measured over fewer than 3 steps, or a span of times less than 1.
+			\see config::EndgameBoundary
+			*/
+			void EndgameBoundarySelection(config::EndgameBoundary const& settings)
+			{
+				if (settings.min_steps < 3 || !(settings.time_span > 1))
+					throw std::runtime_error("endgame boundary selection needs at least 3 steps, over a span of times greater than 1");
+				boundary_config_ = settings;
+				boundary_samples_.clear();
+			}
+
+			/**
+			\brief Query whether, and how, each path is stopped at an endgame boundary of its own.
+			*/
+			config::EndgameBoundary const& EndgameBoundarySelection() const
+			{
+				return boundary_config_;
+			}
+
+			/**
+			\brief Whether the last path stopped short of its end time, at an endgame boundary chosen for it, from where an endgame should finish it.  Its time is then CurrentTime().
+			*/
+			bool StoppedAtEndgameBoundary() const
+			{
+				return stopped_at_endgame_boundary_;
+			}
+
+			/**
+			\brief Whether the last path stepped past its end time, the solution there interpolated, see config::Stepping::dense_output.  Its time is then CurrentTime(), from which ContinuePath goes on.
+			*/
+			bool SteppedPastEndTime() const
+			{
+				return passed_end_time_;
+			}
+
+			/**
+			\brief Suspend, or resume, the selection of endgame boundaries, without changing its settings.  See SuspendedBoundarySelection.
+
+			\return Whether it was suspended before.
+			*/
+			bool SuspendEndgameBoundarySelection(bool suspend) const
+			{
+				const bool was_suspended = boundary_selection_suspended_;
+				boundary_selection_suspended_ = suspend;
+				return was_suspended;
+			}
+
+
 			/**
 			\brief get a const reference to the system.
 			*/
@@ -348,6 +562,68 @@ namespace bertini{
 				return num_failed_steps_taken_ + num_successful_steps_taken_;
 			}
 
+			/**
+			\brief The time spent in, and number of calls to, each phase of tracking, by precision, since construction or the last ResetProfile().
+
+			Empty if configured with --disable-instrumentation.
+			*/
+			instrument::Profile const& Profile() const
+			{
+				return profile_;
+			}
+
+			/**
+			\brief Clear the profile.  It accumulates over paths, so call this to measure one.
+			*/
+			void ResetProfile()
+			{
+				profile_.Reset();
+			}
+
+			/**
+			\brief The steps, Newton iterations, evaluations, precisions and time of the tracking done since construction or the last ResetStatistics().
+
+			The statistics are not reset as a path begins, so that those of an endgame include all the tracking it does.  The parallel drivers reset them before each path, and return them with its result.
+			*/
+			instrument::PathStatistics Statistics() const
+			{
+				auto statistics = statistics_;
+				statistics.newton_iterations += corrector_->NumIterations() - counted_iterations_;
+				statistics.evaluations += corrector_->NumEvaluations() + predictor_->NumEvaluations() - counted_evaluations_;
+				statistics.final_precision = CurrentPrecision();
+				return statistics;
+			}
+
+			/**
+			\brief Start counting the statistics of a new path, from zero, or from those of the part of it tracked before, as by another tracker.
+			*/
+			void ResetStatistics(instrument::PathStatistics const& from = instrument::PathStatistics()) const
+			{
+				statistics_ = from;
+				counted_iterations_ = corrector_->NumIterations();
+				counted_evaluations_ = corrector_->NumEvaluations() + predictor_->NumEvaluations();
+			}
+
+			/**
+			\brief The memory held by the tracker, by component: its points, the workspaces of its predictor and corrector, and the system it tracks.
+
+			The system is not the tracker's, but each worker of a parallel run has its own, so it is counted here, beneath "system", to size a worker.
+			*/
+			MemoryUsage MemoryReport() const
+			{
+				using memory::HeapBytes;
+				MemoryUsage report;
+				report.Add("space", HeapBytes(current_space_) + HeapBytes(tentative_space_) + HeapBytes(temporary_space_) + HeapBytes(step_start_point_) + HeapBytes(interpolated_solution_));
+				report.Add("divergence_samples", HeapBytes(divergence_samples_), divergence_samples_.size());
+				report.Add("boundary_samples", HeapBytes(boundary_samples_), boundary_samples_.size());
+				if (predictor_)
+					report.Add("predictor", predictor_->MemoryReport());
+				if (corrector_)
+					report.Add("corrector", corrector_->MemoryReport());
+				report.Add("system", tracked_system_.MemoryReport());
+				return report;
+			}
+
 			/**
 			\brief Set how large the stepsize should be.
 
@@ -368,6 +644,14 @@ namespace bertini{
 			{
 				reinitialize_stepsize_ = should_reinitialize_stepsize;
 			}
+
+			/**
+			\brief Query whether the initial step size is reset to that of the stepping settings at the start of each path track.
+			*/
+			bool ReinitializeInitialStepSize() const
+			{
+				return reinitialize_stepsize_;
+			}
 			
 			virtual ~Tracker() = default;
 
@@ -376,6 +660,55 @@ namespace bertini{
 				return tracking_tolerance_;
 			}
 
+			/**
+			\brief Change the tracking tolerance, keeping the rest of the settings from Setup.
+
+			\param tracking_tolerance The new tolerance.
+			*/
+			void TrackingTolerance(RT const& tracking_tolerance)
+			{
+				tracking_tolerance_ = tracking_tolerance;
+				digits_tracking_tolerance_ = NumTraits<RT>::TolToDigits(tracking_tolerance);
+			}
+
+			/**
+			\brief The stepping settings, from Setup.
+			*/
+			config::Stepping<RT> const& SteppingSettings() const
+			{
+				return stepping_config_;
+			}
+
+			/**
+			\brief Change the stepping settings, keeping the rest of the settings from Setup.
+
+			\param stepping The new settings.  The step size is reset to their initial step size.
+			*/
+			void SteppingSettings(config::Stepping<RT> const& stepping)
+			{
+				stepping_config_ = stepping;
+				current_stepsize_ = stepping_config_.initial_step_size;
+			}
+
+			/**
+			\brief The settings of Newton's method, from Setup.
+			*/
+			config::Newton const& NewtonSettings() const
+			{
+				return newton_config_;
+			}
+
+			/**
+			\brief Change the settings of Newton's method, keeping the rest of the settings from Setup.
+
+			\param newton The new settings.
+			*/
+			void NewtonSettings(config::Newton const& newton)
+			{
+				corrector_->Settings(newton);
+				newton_config_ = newton;
+			}
+
 		private:
 
 			// convert the base tracker into the derived type.
@@ -393,6 +726,222 @@ namespace bertini{
 			*/
 			virtual
 			SuccessCode TrackerLoopInitialization(CT const& start_time, CT const& end_time, Vec<CT> const& start_point) const = 0;
+
+
+			/**
+			\brief Set up the internals for continuing the current path to a new end time, keeping the time, point, step size and precision.
+
+			\param end_time The time to which to track.
+			*/
+			virtual
+			SuccessCode TrackerLoopContinuation(CT const& end_time) const = 0;
+
+
+			/**
+			\brief The tracker loop, from the current time and point to the end time, shared by TrackPath and ContinuePath.
+
+			\param[out] solution_at_endtime The value of the solution at the end time.
+			*/
+			SuccessCode TrackerLoop(Vec<CT> & solution_at_endtime) const
+			{
+				// as precondition to this while loop, the correct container, either dbl or mpfr, must have the correct data.
+				while (!ReachedEndTime())
+				{
+					SuccessCode step_code = TrackerLoopStep();
+					if (step_code!=SuccessCode::Success)
+						return step_code;
+				}
+
+				return FinishTrackerLoop(solution_at_endtime);
+			}
+
+
+			/**
+			\brief Whether the current time is the end time, or the path has stopped at an endgame boundary of its own.
+			*/
+			bool ReachedEndTime() const
+			{
+				return stopped_at_endgame_boundary_ || passed_end_time_ || IsSymmRelDiffSmall(current_time_,endtime_, Eigen::NumTraits<CT>::epsilon());
+			}
+
+
+			/**
+			\brief One pass of the tracker loop: check, attempt a step, and count it as a success or failure.
+
+			\return SuccessCode::Success if tracking may go on, and otherwise the code with which the path ended, having been cleaned up after.
+			*/
+			SuccessCode TrackerLoopStep() const
+			{
+				SuccessCode pre_iteration_code = PreIterationCheck();
+				if (pre_iteration_code!=SuccessCode::Success)
+				{
+					path_in_progress_ = false;
+					PostTrackCleanup();
+					return pre_iteration_code;
+				}
+
+				using std::abs;
+				// compute the next delta_t
+				const bool step_past = StepsPastEndTime();
+				if (abs(endtime_-current_time_) < abs(current_stepsize_) && !step_past)
+					delta_t_ = endtime_-current_time_;
+				else
+					delta_t_ = current_stepsize_ * (endtime_ - current_time_)/abs(endtime_ - current_time_);
+
+				if (step_past)
+				{
+					step_start_point_ = CurrentPoint();
+					step_start_time_ = current_time_;
+				}
+
+				step_success_code_ = TrackerIteration();
+
+				if (infinite_path_truncation_ && (CheckGoingToInfinity()==SuccessCode::GoingToInfinity))
+				{	
+					OnInfiniteTruncation();
+					path_in_progress_ = false;
+					PostTrackCleanup();
+					return SuccessCode::GoingToInfinity;
+				}
+				else if (step_success_code_==SuccessCode::Success)
+				{
+					OnStepSuccess();
+					// the step may have been shortened, as by speculation, and fallen short of the end time
+					if (step_past && abs(current_time_-step_start_time_) >= abs(endtime_-step_start_time_))
+					{
+						passed_end_time_ = InterpolateEndTime()==SuccessCode::Success;
+						interpolation_failed_ = !passed_end_time_;
+					}
+					if (!passed_end_time_)
+						stopped_at_endgame_boundary_ = ReachesEndgameBoundary();
+				}
+				else
+					OnStepFail();
+
+				return SuccessCode::Success;
+			}
+
+
+			/**
+			\brief Whether the next step is to be taken past the end time, see config::Stepping::dense_output.
+
+			Not once the interpolation has failed on this piece of the path, which is then stepped onto its end time from wherever the failed step left it.
+			*/
+			bool StepsPastEndTime() const
+			{
+				using std::abs;
+				if (!stepping_config_.dense_output || interpolation_failed_)
+					return false;
+
+				const RT remaining = abs(endtime_-current_time_);
+				return remaining < current_stepsize_ && current_stepsize_ - remaining < abs(endtime_)/2;
+			}
+
+
+			/**
+			\brief The solution at the end time, from the step just taken past it, see config::Stepping::dense_output.
+
+			Between the start of the step at \f$t_0\f$ and its end at \f$t_1\f$, the path is interpolated by the cubic matching the points \f$x_0,x_1\f$ and tangents \f$x'_0,x'_1\f$ there.  At \f$s = (t-t_0)/h\f$ of the step \f$h = t_1-t_0\f$ it is
+			\f[ (1-s)^2(1+2s)x_0 + s(1-s)^2 h x'_0 + s^2(3-2s)x_1 - s^2(1-s) h x'_1, \f]
+			which is refined by Newton's method at the end time.  The cubic is correct to fourth order in the step, so that the refinement converges in about the iterations of a correction.
+			*/
+			SuccessCode InterpolateEndTime() const
+			{
+				const unsigned precision = CurrentPrecision();
+				Vec<CT> x0 = step_start_point_;
+				Vec<CT> x1 = CurrentPoint();
+				CT t0 = step_start_time_, t1 = current_time_, t = endtime_;
+				Precision(x0, precision); Precision(x1, precision);
+				Precision(t0, precision); Precision(t1, precision); Precision(t, precision);
+
+				Vec<CT> dx0, dx1;
+				if (!PathTangent(dx0, x0, t0) || !PathTangent(dx1, x1, t1))
+					return SuccessCode::MatrixSolveFailure;
+
+				const CT h = t1 - t0;
+				const CT s = (t - t0)/h;
+				const CT r = CT(1) - s;
+				const Vec<CT> guess = (r*r*(CT(1)+CT(2)*s))*x0 + (s*r*r*h)*dx0 + (s*s*(CT(3)-CT(2)*s))*x1 - (s*s*r*h)*dx1;
+
+				return Refine(interpolated_solution_, guess, t);
+			}
+
+
+			/**
+			\brief The tangent of the path at a point, \f$dx/dt = -(\partial H/\partial x)^{-1} \partial H/\partial t\f$.
+
+			\return Whether the Jacobian could be factored.
+			*/
+			bool PathTangent(Vec<CT> & tangent, Vec<CT> const& x, CT const& t) const
+			{
+				PartialPivotLU<CT> lu(tracked_system_.NumVariables());
+				lu.Factor(tracked_system_.Jacobian(x, t));
+				if (lu.DecompositionSuccess()!=MatrixSuccessCode::Success)
+					return false;
+
+				tangent.resize(x.size());
+				lu.SolveNegative(tangent, tracked_system_.TimeDerivative(x, t));
+				return true;
+			}
+
+
+			/**
+			\brief Record the step just taken for the choice of the endgame boundary, and say whether the path should stop, see config::EndgameBoundary.
+
+			The slopes of the logarithms of the condition number and of the step size against \f$\log|t|\f$ are fit by least squares over the steps since \f$|t|\f$ was config::EndgameBoundary::time_span times what it is now.  The condition number is the latest estimate, which is refreshed only every few steps, see config::Stepping::frequency_of_CN_estimation, and the step size the one the next step is to be tried at.
+			*/
+			bool ReachesEndgameBoundary() const
+			{
+				if (!boundary_config_.adaptive || boundary_selection_suspended_)
+					return false;
+
+				using std::abs;
+				const double time = static_cast<double>(abs(current_time_));
+				const double condition_number = LatestConditionNumber();
+				const double stepsize = static_cast<double>(current_stepsize_);
+				if (!(time <= boundary_config_.earliest_time) || !(time > 0) || !(condition_number > 0) || !(stepsize > 0))
+					return false;
+
+				const double log_span = std::log(boundary_config_.time_span);
+				boundary_samples_.push_back({{std::log(time), std::log(condition_number), std::log(stepsize)}});
+				while (boundary_samples_.size() > 1 && boundary_samples_[1][0] - boundary_samples_.back()[0] >= log_span)
+					boundary_samples_.pop_front();
+				if (boundary_samples_.size() < boundary_config_.min_steps
+				    || boundary_samples_.front()[0] - boundary_samples_.back()[0] < log_span)
+					return false;
+
+				const double n = boundary_samples_.size();
+				double sum_x = 0, sum_xx = 0, sum_c = 0, sum_xc = 0, sum_h = 0, sum_xh = 0;
+				for (auto const& sample : boundary_samples_)
+				{
+					sum_x += sample[0]; sum_xx += sample[0]*sample[0];
+					sum_c += sample[1]; sum_xc += sample[0]*sample[1];
+					sum_h += sample[2]; sum_xh += sample[0]*sample[2];
+				}
+
+				const double denominator = n*sum_xx - sum_x*sum_x;
+				if (!(denominator > 0))
+					return false;
+				const double condition_slope = (n*sum_xc - sum_x*sum_c)/denominator;
+				const double step_slope = (n*sum_xh - sum_x*sum_h)/denominator;
+
+				return -condition_slope >= boundary_config_.min_condition_growth && step_slope >= boundary_config_.min_step_shrinkage;
+			}
+
+
+			/**
+			\brief Copy out the solution at the end time, and clean up after the path.
+			*/
+			SuccessCode FinishTrackerLoop(Vec<CT> & solution_at_endtime) const
+			{
+				path_in_progress_ = false;
+				if (passed_end_time_)
+					solution_at_endtime = interpolated_solution_;
+				else
+					CopyFinalSolution(solution_at_endtime);
+				PostTrackCleanup();
+				return SuccessCode::Success;
+			}
 			
 
 			/**
@@ -411,6 +960,12 @@ namespace bertini{
 			virtual 
 			SuccessCode TrackerIteration() const = 0;
 
+			/**
+			\brief The latest estimate of the condition number of the Jacobian, in the number type the tracker is at.
+			*/
+			virtual
+			double LatestConditionNumber() const = 0;
+
 			/**
 			\brief Copy the solution from whatever internal variable it is stored in, into the output variable.
 
@@ -432,10 +987,83 @@ namespace bertini{
 			template <typename ComplexType>
 			SuccessCode CheckGoingToInfinity() const
 			{
-				if (tracked_system_.DehomogenizePoint(std::get<Vec<ComplexType> >(current_space_)).norm() > path_truncation_threshold_)
+				const auto norm = tracked_system_.DehomogenizePoint(std::get<Vec<ComplexType> >(current_space_)).norm();
+				if (norm > path_truncation_threshold_)
 					return SuccessCode::GoingToInfinity;
-				else
-					return SuccessCode::Success;
+
+				if (divergence_config_.early_detection && step_success_code_==SuccessCode::Success)
+				{
+					using std::log;
+					// the step is not yet counted, so the time of the point is one step on
+					divergence_samples_.emplace_back(static_cast<dbl>(current_time_ + delta_t_), static_cast<double>(log(norm)));
+					if (divergence_samples_.size() > divergence_config_.window)
+						divergence_samples_.pop_front();
+
+					if (DivergenceReachesThreshold())
+						return SuccessCode::GoingToInfinity;
+				}
+				return SuccessCode::Success;
+			}
+
+
+			/**
+			\brief Whether the norms of the last few steps, extrapolated to the end time, pass the truncation threshold.
+
+			Near a pole at distance \f$r^*\f$ from the end time, the norm grows as \f$(r-r^*)^{-p}\f$, where \f$r\f$ is the distance remaining, so the reciprocal of the rate of growth of its logarithm, \f$(r-r^*)/p\f$, is linear in \f$r\f$.  That line is fit by least squares to the rates between consecutive steps, and gives the pole, and the norm at the end time.  A pole before the end time, with \f$r^*\ge0\f$, is infinity reached.  Only a norm which grew at every step, and faster at each, is extrapolated.
+			*/
+			bool DivergenceReachesThreshold() const
+			{
+				auto const& samples = divergence_samples_;
+				if (samples.size() < divergence_config_.window)
+					return false;
+
+				const double log_threshold = std::log(static_cast<double>(path_truncation_threshold_));
+				const double log_norm = samples.back().second;
+				if (log_norm < divergence_config_.onset*log_threshold)
+					return false;
+
+				const dbl end = static_cast<dbl>(endtime_);
+				const double n = samples.size()-1;
+				double sum_r = 0, sum_y = 0, sum_rr = 0, sum_ry = 0;
+				for (size_t ii = 1; ii < samples.size(); ++ii)
+				{
+					const double r_before = std::abs(end - samples[ii-1].first), r_after = std::abs(end - samples[ii].first);
+					const double dr = r_before - r_after, dlog = samples[ii].second - samples[ii-1].second;
+					if (!(dr > 0) || !(dlog > 0))
+						return false;
+
+					const double r = (r_before + r_after)/2, y = dr/dlog;
+					sum_r += r; sum_y += y; sum_rr += r*r; sum_ry += r*y;
+				}
+
+				const double denominator = n*sum_rr - sum_r*sum_r;
+				if (!(denominator > 0))
+					return false;
+				const double slope = (n*sum_ry - sum_r*sum_y)/denominator;
+				if (!(slope > 0))
+					return false;
+				const double intercept = (sum_y - slope*sum_r)/n;
+
+				const double order = 1/slope, pole = -intercept/slope;
+				if (pole >= 0)
+					return true;
+
+				const double r_now = std::abs(end - samples.back().first);
+				return log_norm + order*std::log((r_now - pole)/(-pole)) > log_threshold;
+			}
+
+
+			/**
+			\brief Free the space values of a number type the tracker has left, so that only those of the type it is at hold storage.
+
+			The space values are kept one per number type, as the tracker is templated over them, but only those of the type in use are live.  A tracker in double precision otherwise carries three multiple precision vectors from the last time it was in multiple precision, each entry with its own limbs, and for thousands of trackers at once, that adds up.  They are sized again when next needed.
+			*/
+			template <typename ComplexType>
+			void ReleaseSpace() const
+			{
+				std::get<Vec<ComplexType> >(current_space_).resize(0);
+				std::get<Vec<ComplexType> >(tentative_space_).resize(0);
+				std::get<Vec<ComplexType> >(temporary_space_).resize(0);
 			}
 
 
@@ -447,6 +1075,19 @@ namespace bertini{
 			void PostTrackCleanup() const 
 			{}
 
+			void NotifyTrackingStarted() const
+			{
+				using EmitterType = typename TrackerTraits<D>::EventEmitterType;
+				NotifyObservers<TrackingStarted<EmitterType>>(static_cast<EmitterType const&>(*this));
+			}
+
+			/**
+			\brief Make the state shared with other trackers, such as the precision of the system, this tracker's again, before AdvancePath steps.
+			*/
+			virtual
+			void ResumeTracking() const
+			{}
+
 			/**
 			\brief Reset counters used during tracking.
 
@@ -466,6 +1107,15 @@ namespace bertini{
 				num_failed_steps_taken_ = 0;
 				num_consecutive_failed_steps_ = 0;
 				num_total_steps_taken_ = 0;
+				divergence_samples_.clear();
+				boundary_samples_.clear();
+				stopped_at_endgame_boundary_ = false;
+				passed_end_time_ = false;
+				interpolation_failed_ = false;
+				predictor_->ForgetHistory();
+
+				if (order_selector_.Settings().adaptive)
+					UsePredictor(order_selector_.Start(configured_predictor_));
 			}
 
 
@@ -476,10 +1126,13 @@ namespace bertini{
 			*/
 			void IncrementBaseCountersSuccess() const
 			{
+				++statistics_.steps_accepted;
+				statistics_.max_precision = std::max(statistics_.max_precision, CurrentPrecision());
 				num_successful_steps_taken_++; 
 				num_consecutive_successful_steps_++;
-				current_time_ += delta_t_;
 				num_consecutive_failed_steps_ = 0;
+				SelectPredictor(true);
+				current_time_ += delta_t_;
 			}
 
 			virtual
@@ -493,9 +1146,38 @@ namespace bertini{
 			*/
 			void IncrementBaseCountersFail() const
 			{
+				++statistics_.steps_rejected;
+				statistics_.max_precision = std::max(statistics_.max_precision, CurrentPrecision());
 				num_consecutive_successful_steps_=0;
 				num_failed_steps_taken_++;
 				num_consecutive_failed_steps_++;
+				SelectPredictor(false);
+			}
+
+
+			/**
+			\brief Predict with a method, without changing the one set up by Predictor().
+			*/
+			void UsePredictor(config::Predictor method) const
+			{
+				if (predictor_->PredictorMethod()!=method)
+					predictor_->PredictorMethod(method);
+				predictor_order_ = predictor_->Order();
+			}
+
+			/**
+			\brief Record a step with the order selector, and switch predictor if it says to.
+
+			A step is counted as costing an evaluation per stage of the predictor, and one per Newton iteration allowed the corrector.
+			*/
+			void SelectPredictor(bool success) const
+			{
+				if (!order_selector_.Settings().adaptive)
+					return;
+
+				using std::abs;
+				const unsigned cost = predictor_->NumStages() + newton_config_.max_num_newton_iterations;
+				UsePredictor(order_selector_.Record(success, static_cast<double>(abs(delta_t_)), cost, num_consecutive_failed_steps_));
 			}
 
 
@@ -529,12 +1211,30 @@ namespace bertini{
 			
 			// configuration for tracking
 			std::shared_ptr<predict::ExplicitRKPredictor > predictor_; // The predictor to use while tracking
-			unsigned predictor_order_; ///< The order of the predictor -- one less than the error estimate order.
+			mutable unsigned predictor_order_; ///< The order of the predictor -- one less than the error estimate order.
+			config::Predictor configured_predictor_; ///< The predictor set up by Predictor(), from which adaptive order selection starts each path.
+			mutable predict::OrderSelector order_selector_; ///< Chooses the predictor along a path, when adaptive.
+			config::Divergence divergence_config_; ///< Whether, and how, paths are declared going to infinity early.
+			mutable std::deque< std::pair<dbl, double> > divergence_samples_; ///< The times and logarithms of the norms of the last few successful steps, for the divergence estimate.
+			config::EndgameBoundary boundary_config_; ///< Whether, and how, each path stops at an endgame boundary of its own.
+			mutable std::deque< std::array<double,3> > boundary_samples_; ///< The logarithms of the absolute value of the time, the condition number, and the step size, of the recent successful steps, for choosing the endgame boundary.
+			mutable bool stopped_at_endgame_boundary_ = false; ///< Whether the path stopped at an endgame boundary of its own.
+			mutable bool boundary_selection_suspended_ = false; ///< Whether the selection of endgame boundaries is suspended, as by an endgame.
+			mutable bool passed_end_time_ = false; ///< Whether the path stepped past its end time, the solution there being interpolated_solution_, see config::Stepping::dense_output.
+			mutable bool interpolation_failed_ = false; ///< Whether the interpolation at the end time failed, so that the rest of this piece of the path is stepped onto it.
+			mutable Vec<CT> step_start_point_; ///< The point at the start of a step taken past the end time.
+			mutable CT step_start_time_; ///< The time at the start of a step taken past the end time.
+			mutable Vec<CT> interpolated_solution_; ///< The solution at the end time, interpolated from the step past it.
 
 			config::Stepping<RT> stepping_config_; ///< The stepping configuration.
 			std::shared_ptr<correct::NewtonCorrector> corrector_;
 			config::Newton newton_config_; ///< The newton configuration.
 
+			mutable instrument::Profile profile_; ///< The times and counts of the phases of tracking, into which the predictor and corrector also record.
+			mutable instrument::PathStatistics statistics_; ///< The steps and time of the path, see Statistics.  Its iterations and evaluations are those of the corrector and predictor, less the counts below.
+			mutable std::uint64_t counted_iterations_ = 0; ///< The iterations of the corrector at the last ResetStatistics.
+			mutable std::uint64_t counted_evaluations_ = 0; ///< The evaluations of the corrector and predictor at the last ResetStatistics.
+
 
 
 			unsigned digits_final_ = 0; ///< The number of digits to track to, due to being in endgame zone.
@@ -551,6 +1251,7 @@ namespace bertini{
 			// permanent temporaries
 			mutable RT next_stepsize_; /// The next stepsize
 			mutable SuccessCode step_success_code_; ///< The code for step success.
+			mutable bool path_in_progress_ = false; ///< Whether a path has been begun, and has neither reached its end time nor failed.
 
 
 
@@ -558,6 +1259,7 @@ namespace bertini{
 			mutable unsigned num_successful_steps_since_stepsize_increase_; ///< How many successful steps have been taken since increased stepsize.
 			mutable unsigned num_successful_steps_since_precision_decrease_; ///< The number of successful steps since decreased precision.
 
+			// only those of the number type the tracker is at hold storage, see ReleaseSpace
 			mutable std::tuple< Vec<NeededTypes>...> current_space_; ///< The current space value. 
 			mutable std::tuple< Vec<NeededTypes>...> tentative_space_; ///< After correction, the tentative next space value
 			mutable std::tuple< Vec<NeededTypes>...> temporary_space_; ///< After prediction, the tentative next space value.
@@ -584,6 +1286,14 @@ namespace bertini{
 				return current_time_;
 			}
 
+			/**
+			\brief The time the current path is being tracked to.
+			*/
+			auto EndTime() const
+			{
+				return endtime_;
+			}
+
 			auto DeltaT() const
 			{
 				return delta_t_;
@@ -597,12 +1307,50 @@ namespace bertini{
 
 			virtual Vec<CT> CurrentPoint() const = 0;
 
+			/**
+			\brief The number of entries held by the space values of a number type, current, tentative and temporary together.
+
+			Zero for a number type the tracker has left, see ReleaseSpace.
+			*/
+			template <typename ComplexType>
+			unsigned SpaceHeld() const
+			{
+				return std::get<Vec<ComplexType> >(current_space_).size()
+				     + std::get<Vec<ComplexType> >(tentative_space_).size()
+				     + std::get<Vec<ComplexType> >(temporary_space_).size();
+			}
+
 
 			virtual unsigned CurrentPrecision() const = 0;
 		};
 
 
 
+		/**
+		\brief Suspends the selection of endgame boundaries of a tracker for as long as it lives, see Tracker::EndgameBoundarySelection.  The endgames hold one while they run.
+		*/
+		template<typename TrackerType>
+		class SuspendedBoundarySelection
+		{
+		public:
+			explicit SuspendedBoundarySelection(TrackerType const& tracker) : tracker_(tracker), was_suspended_(tracker.SuspendEndgameBoundarySelection(true))
+			{}
+
+			~SuspendedBoundarySelection()
+			{
+				tracker_.SuspendEndgameBoundarySelection(was_suspended_);
+			}
+
+			SuspendedBoundarySelection(SuspendedBoundarySelection const&) = delete;
+			SuspendedBoundarySelection& operator=(SuspendedBoundarySelection const&) = delete;
+
+		private:
+			TrackerType const& tracker_;
+			bool was_suspended_;
+		};
+
+
+
 	} // re: namespace tracking
 } // re: namespace bertini
 
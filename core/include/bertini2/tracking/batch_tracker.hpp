@@ -0,0 +1,373 @@
+//This file is part of Bertini 2.
+//
+//batch_tracker.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//batch_tracker.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with batch_tracker.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file batch_tracker.hpp
+
+\brief Track many paths in double precision at once, advancing a batch of them in lockstep.
+
+Most paths stay in double precision for all of their length, and tracking them one at a time runs scalar complex arithmetic, leaving the vector units of the processor idle.  The BatchTracker instead advances BatchLanes::Width paths together.  Their points are held lane-contiguous, evaluated with their Jacobians and time derivatives by one forward-mode sweep of the compiled program across the batch, see System::EvalBatchWithDerivatives, and the small linear systems of all the lanes are factored and solved together, each lane with its own pivoting.
+
+Each lane has its own step size, and is stepped, corrected, accepted or rejected on its own, the lanes which are done, or have already converged, being masked out rather than breaking the lockstep.  A lane whose step the AMP criteria say needs more than double precision, or whose step size falls below the minimum, or whose Jacobian is singular, leaves the batch, and TrackPaths hands it to an AMPTracker, from where it stopped.
+
+Optionally, see BatchTracker::ScreenInSinglePrecision, the lanes start in single precision, their evaluations and linear algebra being in floats, of which a vector register holds twice as many as doubles, the points themselves being kept in double.  The AMP criteria are checked against the digits of single precision, and a lane which fails them is promoted to double precision, taking its step again there, for the rest of its path.  The last step of every lane, to the end time, is in double.
+
+TrackAllPathsBatched runs the batches of a whole start system on a pool of threads, for the double precision phase of a run with very many start points, up to the endgame boundary.
+*/
+
+#ifndef BERTINI_TRACKING_BATCH_TRACKER_HPP
+#define BERTINI_TRACKING_BATCH_TRACKER_HPP
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief Tracks paths in double precision, BatchLanes::Width of them in lockstep.
+
+		## Use
+
+		Set up as for the other trackers, though only Euler prediction and Newton correction are done.  The AMP settings decide when a lane needs more precision, and the AMPTracker passed to TrackPaths tracks it from there.
+
+		\code
+		BatchTracker batch(homotopy);
+		batch.Setup(1e-5, 1e5, stepping, newton);
+		batch.PrecisionSetup(AMP);
+
+		auto results = batch.TrackPaths(start_points, dbl(1), dbl(0), amp_tracker);
+		\endcode
+
+		The system must be square, counting its patches, and have a path variable.  A BatchTracker evaluates its system, so, as for the other trackers, one thread at a time.
+		*/
+		class BatchTracker
+		{
+		public:
+
+			static constexpr std::size_t Width = BatchLanes::Width; ///< The number of paths advanced together.
+
+			/**
+			\throws std::runtime_error if the system has no path variable, or is not square.
+			*/
+			BatchTracker(System const& sys);
+
+
+			/**
+			\brief Set the tolerances and the settings for stepping and for Newton's method.
+
+			\param tracking_tolerance The length of a Newton step below which the corrector has converged.
+			\param path_truncation_threshold The norm of a point beyond which the path is taken to be going to infinity.
+			\param stepping The step size settings.
+			\param newton The numbers of Newton iterations.  The settings for reusing the Jacobian and for mixed precision do not apply.
+			*/
+			void Setup(double tracking_tolerance, double path_truncation_threshold,
+			           config::Stepping<double> const& stepping,
+			           config::Newton const& newton);
+
+
+			/**
+			\brief Set the bounds used by the AMP criteria, which decide when a lane needs more than double precision.
+			*/
+			void PrecisionSetup(config::AdaptiveMultiplePrecisionConfig const& AMP_config);
+
+
+			/**
+			\brief Track from each of a set of start points in double precision, without handing off those which cannot be.
+
+			\param start_points The start points, each of NumVariables() entries.
+			\param start_time The time at which the start points are on the paths.
+			\param end_time The time to track to.
+			\param implicit_parameters If not empty, the values of the implicit parameters of the system for each path, each of NumImplicitParameters() entries, so that the paths of several members of a family of systems are tracked in the same batches.  If empty, those set in the system are used for all.
+			\return A result for each start point, in order.  The success code is Success if the path reached the end time.  Otherwise the time and endpoint are where the path stopped, which is the last point accepted.
+
+			\throws std::runtime_error if the sizes of the start points or implicit parameters don't match the system.
+			*/
+			std::vector< PathResult<dbl> > TrackPathsDouble(std::vector< Vec<dbl> > const& start_points,
+			                                               dbl const& start_time, dbl const& end_time,
+			                                               std::vector< Vec<dbl> > const& implicit_parameters = {}) const;
+
+
+			/**
+			\brief Track from each of a set of start points, in double precision where that is enough, and with an AMPTracker from where it is not.
+
+			Paths going to infinity, or taking too many steps, are not handed off, their results being those of the batch.
+
+			\param start_points The start points, each of NumVariables() entries.
+			\param start_time The time at which the start points are on the paths.
+			\param end_time The time to track to.
+			\param fallback A tracker of the same system, set up, for the paths which need more than double precision.
+			\return A result for each start point, in order.
+			*/
+			std::vector< PathResult<mpfr> > TrackPaths(std::vector< Vec<dbl> > const& start_points,
+			                                          dbl const& start_time, dbl const& end_time,
+			                                          AMPTracker const& fallback) const
+			{
+				auto batch_results = TrackPathsDouble(start_points, start_time, end_time);
+
+				std::vector< PathResult<mpfr> > results(batch_results.size());
+				for (std::size_t ii = 0; ii < batch_results.size(); ++ii)
+				{
+					auto const& from = batch_results[ii];
+					auto& result = results[ii];
+					result.index = from.index;
+
+					Vec<mpfr> point(from.endpoint.size());
+					for (int jj = 0; jj < from.endpoint.size(); ++jj)
+						point(jj) = mpfr(from.endpoint(jj));
+
+					if (!NeedsHandOff(from.success_code))
+					{
+						result.success_code = from.success_code;
+						result.time = mpfr(from.time);
+						result.endpoint = point;
+						continue;
+					}
+
+					++num_handed_off_;
+					result.success_code = fallback.TrackPath(result.endpoint, mpfr(from.time), mpfr(end_time), point);
+					result.time = fallback.CurrentTime();
+				}
+				return results;
+			}
+
+
+			/**
+			\brief Whether a path which stopped in the batch with a code should go on with a tracker in adaptive precision.
+			*/
+			static bool NeedsHandOff(SuccessCode code)
+			{
+				return code!=SuccessCode::Success && code!=SuccessCode::GoingToInfinity && code!=SuccessCode::MaxNumStepsTaken;
+			}
+
+
+			/**
+			\brief Switch screening the steps of each path in single precision on or off.
+
+			When on, each lane starts out evaluating, factoring and solving in single precision, and is promoted to double precision once the AMP criteria say single is not enough, or its Jacobian is singular in single, or it takes its last step.  Its points are kept in double all along, so that Newton's method corrects in single precision against residuals rounded to it.  The tracking tolerance must be loose enough for single precision, else every lane is promoted at its first step.  Off by default.
+			*/
+			void ScreenInSinglePrecision(bool should_screen = true)
+			{
+				screen_in_single_ = should_screen;
+			}
+
+			/**
+			\brief Whether steps are screened in single precision, see ScreenInSinglePrecision.
+			*/
+			bool ScreensInSinglePrecision() const
+			{
+				return screen_in_single_;
+			}
+
+			/**
+			\brief The number of steps accepted in single precision, since construction.
+			*/
+			std::size_t NumSinglePrecisionSteps() const
+			{
+				return num_single_precision_steps_;
+			}
+
+
+			/**
+			\brief The number of paths handed off to the fallback tracker by TrackPaths, since construction.
+			*/
+			std::size_t NumHandedOff() const
+			{
+				return num_handed_off_;
+			}
+
+		private:
+
+			/**
+			\brief Track up to Width paths in lockstep, from start_points[first] on, writing their results.
+			*/
+			void TrackBatch(std::vector< Vec<dbl> > const& start_points, std::size_t first,
+			                dbl const& start_time, dbl const& end_time,
+			                std::vector< Vec<dbl> > const& implicit_parameters,
+			                std::vector< PathResult<dbl> > & results) const;
+
+
+			System const& tracked_system_;
+			std::size_t num_variables_;
+
+			double tracking_tolerance_ = 1e-5;
+			double path_truncation_threshold_ = 1e5;
+			config::Stepping<double> stepping_;
+			config::Newton newton_;
+
+			// the AMP settings, in double precision, as they are used every step of every lane
+			double epsilon_ = 1;
+			double Phi_ = 1;
+			double Psi_ = 1;
+			int safety_digits_1_ = 1;
+			int safety_digits_2_ = 1;
+
+			Vec<dbl> random_units_; ///< Solved against for estimates of the norm of the inverse of the Jacobian.
+
+			bool screen_in_single_ = false; ///< Whether the lanes start out in single precision.
+
+			mutable std::size_t num_handed_off_ = 0;
+			mutable std::size_t num_single_precision_steps_ = 0;
+		};
+
+
+
+		/**
+		\brief Track from every start point of a start system to an end time, in batches in lockstep in double precision, on a pool of threads, handing the paths which need more precision to an AMPTracker.
+
+		Meant for the phase of a run from the start time to the endgame boundary, which most paths of large problems cross in double precision, the results being passed on to endgames.
+
+		## Use
+
+		\code
+		auto AMP = config::AMPConfigFrom(homotopy);
+		auto results = TrackAllPathsBatched(homotopy, TD, [&](BatchTracker & batch, AMPTracker & fallback)
+			{
+				batch.Setup(1e-5, 1e5, stepping_double, newton);
+				batch.PrecisionSetup(AMP);
+				fallback.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				fallback.PrecisionSetup(AMP);
+			},
+			dbl(1), dbl(0.1));
+		\endcode
+
+		Each worker has its own copy of the homotopy, made as for TrackAllPaths, and on it a BatchTracker and an AMPTracker, which it passes to setup.  So setup is called once per worker, concurrently, and must not evaluate anything shared.  The workers take batches of BatchTracker::Width consecutive start points from a shared counter, so that a batch slowed by a hard path holds up only its own worker.
+
+		\param homotopy The system to track on.  Its path variable runs from start_time to end_time.
+		\param start_system The source of the start points.
+		\param setup Configure a freshly made BatchTracker and AMPTracker.
+		\param start_time The time at which the start points solve the homotopy.
+		\param end_time The time to track to.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\return The result of each path, in the order of the start points.
+
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename StartSystemType, typename SetupFunction>
+		std::vector< PathResult<mpfr> >
+		TrackAllPathsBatched(System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+		                     dbl const& start_time, dbl const& end_time,
+		                     unsigned num_threads = 0)
+		{
+			const auto num_paths = static_cast<std::size_t>(start_system.NumStartPoints());
+			const std::size_t num_batches = (num_paths + BatchTracker::Width - 1) / BatchTracker::Width;
+
+			if (num_threads==0)
+				num_threads = detail::DefaultNumWorkers();
+			num_threads = std::min<unsigned>(num_threads, std::max<std::size_t>(num_batches, 1));
+
+			// compiled once here, so that the copies share it
+			homotopy.GetForwardModeProgram();
+
+			std::string archived_homotopy;
+			auto copy_homotopy = [&]()
+			{
+				if (archived_homotopy.empty())
+					try
+					{
+						return homotopy.CloneForThread();
+					}
+					catch (std::runtime_error const&)
+					{
+						archived_homotopy = detail::Archive(homotopy);
+					}
+				return detail::CloneFromArchive<System>(archived_homotopy);
+			};
+			const auto archived_start_system = detail::Archive(start_system);
+
+			SystemPool homotopies;
+			std::vector< std::shared_ptr<System> > worker_homotopies(num_threads);
+			std::vector< StartSystemType > worker_start_systems;
+			worker_start_systems.reserve(num_threads);
+			for (unsigned ii = 0; ii < num_threads; ++ii)
+			{
+				worker_homotopies[ii] = homotopies.NonPtrAdd(copy_homotopy());
+				worker_start_systems.push_back(detail::CloneFromArchive<StartSystemType>(archived_start_system));
+			}
+
+			std::vector< PathResult<mpfr> > results(num_paths);
+			std::atomic<std::size_t> next_path(0);
+			std::vector< std::exception_ptr > failures(num_threads);
+			const auto precision = DefaultPrecision();
+
+			auto track_batches = [&](unsigned worker)
+			{
+				try
+				{
+					DefaultPrecision(precision);
+
+					System const& sys = *worker_homotopies[worker];
+					StartSystemType const& starts = worker_start_systems[worker];
+
+					BatchTracker batch(sys);
+					AMPTracker fallback(sys);
+					setup(batch, fallback);
+
+					std::vector< Vec<dbl> > start_points;
+					std::size_t first;
+					while ((first = next_path.fetch_add(BatchTracker::Width)) < num_paths)
+					{
+						const std::size_t last = std::min<std::size_t>(first + BatchTracker::Width, num_paths);
+
+						start_points.clear();
+						for (std::size_t ii = first; ii < last; ++ii)
+							start_points.push_back(starts.template StartPoint<dbl>(ii));
+
+						DefaultPrecision(precision);
+						auto batch_results = batch.TrackPaths(start_points, start_time, end_time, fallback);
+						for (std::size_t ii = first; ii < last; ++ii)
+						{
+							results[ii] = std::move(batch_results[ii-first]);
+							results[ii].index = ii;
+						}
+					}
+				}
+				catch (...)
+				{
+					failures[worker] = std::current_exception();
+					next_path = num_paths; // stop the others at their next batch
+				}
+			};
+
+			std::vector<std::thread> threads;
+			for (unsigned ii = 1; ii < num_threads; ++ii)
+				threads.emplace_back(track_batches, ii);
+			track_batches(0);
+			for (auto& t : threads)
+				t.join();
+
+			DefaultPrecision(precision);
+
+			for (auto const& failure : failures)
+				if (failure)
+					std::rethrow_exception(failure);
+
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
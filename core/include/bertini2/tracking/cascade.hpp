@@ -0,0 +1,348 @@
+//This file is part of Bertini 2.
+//
+//cascade.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//cascade.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with cascade.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file cascade.hpp
+
+\brief Find a witness set for every dimension of the solutions of a polynomial system, by a cascade, from the top dimension down.
+
+The system \f$f\f$, in \f$N\f$ variables, is randomized to \f$N\f$ functions \f$g\f$.  With a random slice \f$L_1,\ldots,L_D\f$ of the top dimension \f$D\f$, slack variables \f$z_1,\ldots,z_D\f$ and a random \f$N \times D\f$ matrix \f$\Lambda\f$, the embedded system of dimension \f$i\f$ is
+
+\f[ E_i(x,z) = \begin{bmatrix} g(x) + \sum_{j \le i} \lambda_j z_j \\ L_j(x) + z_j, \; j \le i \end{bmatrix}. \f]
+
+Its solutions with \f$z=0\f$ are on the solutions of \f$g\f$, and on the slice \f$L_1 = \cdots = L_i = 0\f$ of dimension \f$i\f$, so include a witness point set of every component of dimension \f$i\f$.  Those with \f$z \neq 0\f$ start the homotopy to \f$E_{i-1}\f$, scaling \f$z_i\f$ by \f$t\f$, which at \f$t=0\f$ leaves \f$z_i = -L_i(x)\f$ free of the rest.  So:
+
+1. \f$E_D\f$ is solved by a total degree homotopy, by SolveInStages.
+2. At each dimension, the endpoints with vanishing slack, which solve the system, are the witness superset of the dimension.  The rest are tracked down to the next dimension, by TrackAllPaths and FinishPaths, on a pool of threads.
+3. The points of each superset on a component of higher dimension, the junk, are removed by testing their membership in the witness sets above, by IsMember, which moves the witness points of the higher dimension to a slice through the point, in parallel.
+
+The cascade tracks no more paths at a dimension than it had endpoints at the one above, so after the first homotopy, each dimension costs as much as a zero dimensional solve of its own size.  The witness sets are not broken into irreducible components here; moving their slices around loops, as in monodromy.hpp, does that.
+*/
+
+#ifndef BERTINI_TRACKING_CASCADE_HPP
+#define BERTINI_TRACKING_CASCADE_HPP
+
+#include "bertini2/tracking/regeneration.hpp"
+#include "bertini2/tracking/witness_sampling.hpp"
+#include "bertini2/start_system.hpp"
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief What happened at one dimension of a cascade.
+		*/
+		struct CascadeStage
+		{
+			unsigned dimension = 0; ///< The dimension.
+			std::size_t num_paths = 0; ///< The paths tracked to the embedded system of the dimension.
+			std::size_t num_failed = 0; ///< The paths which failed, including those which went to infinity.
+			std::size_t num_infinite = 0; ///< The endpoints too large to be finite.
+			std::size_t num_continued = 0; ///< The endpoints with nonvanishing slack, starting the paths of the next dimension down.
+			std::size_t num_nonsolutions = 0; ///< The endpoints with vanishing slack which do not solve the original system.
+			std::size_t num_duplicates = 0; ///< The witness points found by another path, too.
+			std::size_t num_junk = 0; ///< The witness points on a component of higher dimension.
+			std::size_t num_kept = 0; ///< The points of the witness set of the dimension, with the junk removed.
+		};
+
+
+		/**
+		\brief The witness set of one dimension of the solutions of a system, as found by a cascade.
+
+		The system and slice are as MoveWitnessPoints, SampleWitnessSet and IsMember take them, so the points can be sampled, tested for membership, or passed to monodromy.
+		*/
+		template<typename ComplexType>
+		struct CascadeWitnessSet
+		{
+			unsigned dimension; ///< The dimension.
+			System system; ///< The original system randomized to as many functions as the codimension, in its variables.
+			LinearSlice slice; ///< The slice, the first linear functions of the slice of the top dimension.
+			std::vector< Vec<ComplexType> > superset; ///< The witness points before the junk is removed.
+			std::vector< Vec<ComplexType> > points; ///< The witness points of the components of the dimension.
+		};
+
+
+		/**
+		\brief The outcome of a cascade, indexed by dimension, from 0 to the top dimension.
+		*/
+		template<typename ComplexType>
+		struct CascadeResults
+		{
+			std::vector< CascadeWitnessSet<ComplexType> > witness_sets; ///< The witness set of each dimension, by dimension.
+			std::vector< CascadeStage > stages; ///< What happened at each dimension, by dimension.
+		};
+
+
+		/**
+		\brief Find a witness set of every dimension of the solutions of a polynomial system, by a cascade, tracking the paths of each dimension on a pool of threads.
+
+		## Use
+
+		\code
+		config::Cascade<mpfr_float> cascade;
+		auto AMP = config::AMPConfigFrom(target);
+		auto found = Cascade<AMPTracker, EndgameSelector<AMPTracker>::PSEG>(target,
+			[&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			},
+			[](EndgameSelector<AMPTracker>::PSEG & endgame){}, mpfr("0.1"), cascade);
+
+		for (auto const& w : found.witness_sets)
+			std::cout << "dimension " << w.dimension << ": " << w.points.size() << " witness points\n";
+		\endcode
+
+		The target is affine, in one variable group.  The functions are taken in order of decreasing degree, as for Regenerate.  The trackers are configured by setup, which so must suit every homotopy of the cascade, and those moving the slices for the membership tests.
+
+		\param target The system to solve, polynomial, without a path variable.
+		\param setup Configure a freshly made tracker.  Called concurrently, once per worker of every homotopy.
+		\param endgame_setup Configure a freshly made endgame.
+		\param boundary_time The time at the endgame boundary.
+		\param cascade The top dimension, which endpoints are witness points, and whether to remove the junk.
+		\param config Which endpoints are finished by Newton's method, and which are nonsingular.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\throws std::runtime_error if the target is not polynomial, has a path variable, a function of degree 0, its variables are not in one affine group, or the top dimension is not less than the number of variables.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename EndgameType, typename SetupFunction, typename EndgameSetupFunction>
+		CascadeResults<typename TrackerTraits<TrackerType>::BaseComplexType>
+		Cascade(System const& target,
+		        SetupFunction setup, EndgameSetupFunction endgame_setup,
+		        typename TrackerTraits<TrackerType>::BaseComplexType const& boundary_time,
+		        config::Cascade<typename TrackerTraits<TrackerType>::BaseRealType> const& cascade = config::Cascade<typename TrackerTraits<TrackerType>::BaseRealType>(),
+		        StagedSolveConfig const& config = StagedSolveConfig(),
+		        unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using Nd = std::shared_ptr<node::Node>;
+
+			if (target.HavePathVariable())
+				throw std::runtime_error("running a cascade on a system with a path variable.  the cascade makes its own homotopies");
+			if (!target.IsPolynomial())
+				throw std::runtime_error("running a cascade on a non-polynomial system");
+			if (target.NumVariableGroups()!=1 || target.NumHomVariableGroups()!=0 || target.NumUngroupedVariables()!=0 || target.IsPatched())
+				throw std::runtime_error("running a cascade on a system whose variables are not in one affine variable group");
+
+			const std::size_t num_vars = target.NumVariables();
+			const std::size_t num_functions = target.NumFunctions();
+			const int top_dimension = cascade.top_dimension < 0 ? static_cast<int>(num_vars)-1 : cascade.top_dimension;
+			if (top_dimension < 0 || static_cast<std::size_t>(top_dimension) >= num_vars)
+				throw std::runtime_error("running a cascade from dimension " + std::to_string(top_dimension) + " in " + std::to_string(num_vars) + " variables.  the top dimension must be less than the number of variables");
+			const unsigned D = top_dimension;
+
+			const auto target_degrees = target.Degrees();
+			std::vector<std::size_t> order(num_functions);
+			for (std::size_t ii = 0; ii < num_functions; ++ii)
+			{
+				if (target_degrees[ii] < 1)
+					throw std::runtime_error("running a cascade on a system with function " + std::to_string(ii) + " of degree " + std::to_string(target_degrees[ii]));
+				order[ii] = ii;
+			}
+			std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b){ return target_degrees[a] > target_degrees[b]; });
+
+			auto random_coefficient = []()
+			{
+				return node::MakeNode<node::Rational>(node::Rational::Rand());
+			};
+
+			// the target randomized to a number of functions.  with fewer functions than that, the extra are random combinations of all of them
+			auto randomize = [&](std::size_t num)
+			{
+				std::vector<Nd> g(num);
+				for (std::size_t ii = 0; ii < num; ++ii)
+				{
+					if (ii < num_functions)
+					{
+						g[ii] = target.Function(order[ii]);
+						for (std::size_t jj = num; jj < num_functions; ++jj)
+							g[ii] = g[ii] + random_coefficient()*target.Function(order[jj]);
+					}
+					else
+					{
+						g[ii] = random_coefficient()*target.Function(order[0]);
+						for (std::size_t jj = 1; jj < num_functions; ++jj)
+							g[ii] = g[ii] + random_coefficient()*target.Function(order[jj]);
+					}
+				}
+				return g;
+			};
+
+			VariableGroup const& vars = target.Variables();
+
+			auto make_system = [&](VariableGroup const& v, std::vector<Nd> const& functions)
+			{
+				System sys;
+				sys.AddVariableGroup(v);
+				for (const auto& f : functions)
+					sys.AddFunction(f);
+				return sys;
+			};
+
+			const std::vector<Nd> g = randomize(num_vars);
+			const LinearSlice top_slice = LinearSlice::RandomComplex(vars, D);
+			const std::vector<Nd> ell = top_slice.Functions();
+
+			VariableGroup slack;
+			std::vector< std::vector<Nd> > lambda(num_vars);
+			for (unsigned jj = 0; jj < D; ++jj)
+				slack.push_back(node::MakeNode<node::Variable>("cascade_slack_" + std::to_string(jj)));
+			for (auto& row : lambda)
+				for (unsigned jj = 0; jj < D; ++jj)
+					row.push_back(random_coefficient());
+
+			// the embedded system of dimension i, in the variables and the first i slack variables, with the last of them scaled, if given a scale
+			auto embedded = [&](unsigned i, Nd const& scale)
+			{
+				VariableGroup v = vars;
+				v.insert(v.end(), slack.begin(), slack.begin()+i);
+
+				std::vector<Nd> functions;
+				for (std::size_t rr = 0; rr < num_vars; ++rr)
+				{
+					Nd h = g[rr];
+					for (unsigned jj = 0; jj < i; ++jj)
+						h = h + ((scale && jj+1==i) ? scale*lambda[rr][jj] : lambda[rr][jj])*slack[jj];
+					functions.push_back(h);
+				}
+				for (unsigned jj = 0; jj < i; ++jj)
+					functions.push_back(ell[jj] + slack[jj]);
+				return make_system(v, functions);
+			};
+
+			auto t = node::MakeNode<node::Variable>("t");
+
+			// the top dimension, by a total degree homotopy
+			StagedResults<ComplexType> solved;
+			{
+				const System top = embedded(D, Nd());
+				const auto TD = start_system::TotalDegree(top);
+				System homotopy = (1-t)*top + t*TD;
+				homotopy.AddPathVariable(t);
+				solved = SolveInStages<TrackerType, EndgameType>(homotopy, TD, setup, endgame_setup, ComplexType(1), boundary_time, config, num_threads);
+			}
+
+			const auto precision = DefaultPrecision();
+			std::vector< CascadeWitnessSet<ComplexType> > witness_sets; // from the top down
+			std::vector< CascadeStage > stages;
+			for (int i = D; i >= 0; --i)
+			{
+				CascadeStage stage;
+				stage.dimension = i;
+				stage.num_paths = solved.paths.size();
+
+				std::vector< Vec<ComplexType> > superset, starts;
+				for (const auto& path : solved.paths)
+				{
+					if (path.success_code!=SuccessCode::Success)
+					{
+						++stage.num_failed;
+						continue;
+					}
+
+					// the endpoints of the homotopy down have the slack variable of the dimension above last, which is dropped
+					auto const& endpoint = path.endpoint;
+					DefaultPrecision(Precision(endpoint(0)));
+					const Vec<ComplexType> x = endpoint.head(num_vars);
+
+					if (x.norm() > cascade.infinite_threshold)
+					{
+						++stage.num_infinite;
+						continue;
+					}
+
+					if (i > 0 && endpoint.segment(num_vars, i).norm() > cascade.slack_tolerance*(1 + x.norm()))
+					{
+						++stage.num_continued;
+						starts.push_back(endpoint.head(num_vars + i));
+						continue;
+					}
+
+					if (!detail::SolvesFunctions(target, x, 0, num_functions, cascade.solution_tolerance))
+					{
+						++stage.num_nonsolutions;
+						continue;
+					}
+
+					if (std::any_of(superset.begin(), superset.end(), [&](Vec<ComplexType> const& y){ return detail::SameEndpoint(x, y, static_cast<double>(cascade.solution_tolerance)); }))
+					{
+						++stage.num_duplicates;
+						continue;
+					}
+
+					superset.push_back(x);
+				}
+				DefaultPrecision(precision);
+
+				CascadeWitnessSet<ComplexType> witness_set{static_cast<unsigned>(i), make_system(vars, randomize(num_vars - i)), top_slice.Leading(i), superset, {}};
+
+				// the junk is on a component of higher dimension, so is a member of one of the witness sets above
+				for (const auto& x : superset)
+				{
+					Vec<mpfr> candidate(x.size());
+					for (Eigen::DenseIndex kk = 0; kk < x.size(); ++kk)
+						candidate(kk) = mpfr(x(kk));
+
+					const bool junk = cascade.remove_junk && std::any_of(witness_sets.begin(), witness_sets.end(), [&](CascadeWitnessSet<ComplexType> const& above)
+						{
+							return !above.points.empty()
+							       && IsMember<TrackerType>(above.system, above.slice, above.points, candidate, setup, cascade.membership_tolerance, num_threads);
+						});
+
+					if (junk)
+						++stage.num_junk;
+					else
+						witness_set.points.push_back(x);
+				}
+				stage.num_kept = witness_set.points.size();
+
+				witness_sets.push_back(std::move(witness_set));
+				stages.push_back(stage);
+
+				if (i==0)
+					break;
+
+				// down to the next dimension, scaling the last slack variable to 0
+				solved = StagedResults<ComplexType>();
+				if (!starts.empty())
+				{
+					System homotopy = embedded(i, t);
+					homotopy.AddPathVariable(t);
+					auto at_boundary = TrackAllPaths<TrackerType>(homotopy, detail::StartPointList<ComplexType>(starts), setup,
+					                                               ComplexType(1), boundary_time, num_threads);
+					solved = FinishPaths<TrackerType, EndgameType>(homotopy, at_boundary, boundary_time, setup, endgame_setup, config, num_threads);
+				}
+			}
+
+			CascadeResults<ComplexType> results;
+			results.witness_sets.assign(std::make_move_iterator(witness_sets.rbegin()), std::make_move_iterator(witness_sets.rend()));
+			results.stages.assign(stages.rbegin(), stages.rend());
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -28,11 +28,63 @@
 #pragma once
 
 #include "bertini2/tracking/base_endgame.hpp"
+#include "bertini2/tracking/trace.hpp"
 
 
 namespace bertini{ namespace tracking { namespace endgame{
 
 
+/**
+\brief The mean of the first num_samples samples, which is the trapezoid rule for the Cauchy integral over a closed loop of equally spaced samples.
+
+At multiple precision, the samples are summed in place at their precision.
+
+\param[out] result The mean.
+\param samples The samples, all of the same size and precision.
+\param num_samples How many of the samples, from the front, to average.
+*/
+template<typename CT>
+void MeanOfSamples(Vec<CT> & result, SampCont<CT> const& samples, unsigned num_samples)
+{
+	using RT = typename Eigen::NumTraits<CT>::Real;
+	assert(num_samples > 0 && num_samples <= samples.size() && "averaging more samples than there are");
+
+	result = samples[0];
+	for (unsigned ii = 1; ii < num_samples; ++ii)
+		result += samples[ii];
+	result /= static_cast<RT>(num_samples);
+}
+
+
+/**
+\brief The mean of the first num_samples samples, in double precision, by compensated summation.
+
+The samples are summed with Neumaier's compensation, so that the rounding error of the sum does not grow with the number of samples, which for a high cycle number is large.  The real and imaginary parts of all coordinates are summed together, as one array, so the compensation vectorizes.
+*/
+inline
+void MeanOfSamples(Vec<dbl> & result, SampCont<dbl> const& samples, unsigned num_samples)
+{
+	assert(num_samples > 0 && num_samples <= samples.size() && "averaging more samples than there are");
+
+	const auto num_parts = 2*samples[0].size();
+	using Parts = Eigen::Map<const Eigen::ArrayXd>;
+
+	Eigen::ArrayXd sum = Parts(reinterpret_cast<const double*>(samples[0].data()), num_parts);
+	Eigen::ArrayXd compensation = Eigen::ArrayXd::Zero(num_parts);
+	Eigen::ArrayXd next(num_parts);
+	for (unsigned ii = 1; ii < num_samples; ++ii)
+	{
+		Parts x(reinterpret_cast<const double*>(samples[ii].data()), num_parts);
+		next = sum + x;
+		compensation += (sum.abs() >= x.abs()).select((sum - next) + x, (x - next) + sum);
+		sum = next;
+	}
+
+	result.resize(samples[0].size());
+	Eigen::Map<Eigen::ArrayXd>(reinterpret_cast<double*>(result.data()), num_parts) = (sum + compensation) / num_samples;
+}
+
+
 /** 
 \class CauchyEndgame
 \brief Class used to finish tracking paths during Homotopy Continuation.
@@ -199,6 +251,14 @@ protected:
 	\brief A deque of samples collected by CircleTrack. Computed a mean of the values of this deque, after a loop has been closed, will give an approximation of the origin.
 	*/
 	mutable std::tuple<SampCont<UsedNumTs>...> cauchy_samples_;
+	/**
+	\brief The number of samples CircleTrack takes per loop around the origin.  0 until a path is run, meaning num_sample_points of the endgame settings.  With adaptive_samples_per_loop, it changes after each Cauchy approximation.
+	*/
+	unsigned samples_per_loop_ = 0;
+	/**
+	\brief The number of loops expected to close the samples around the origin, 0 if none is expected.  It is the cycle number found by the last loops closed on this path, or before any, the stabilized estimate of c/k.
+	*/
+	unsigned predicted_cycle_number_ = 0;
 
 
 
@@ -206,6 +266,33 @@ protected:
 	
 
 public:
+	/**
+	\brief The memory held by the samples, those toward the origin for the first approximation, and those around it.
+	*/
+	MemoryUsage SampleMemory() const
+	{
+		using memory::HeapBytes;
+		MemoryUsage report;
+		report.Add("samples", HeapBytes(pseg_times_) + HeapBytes(pseg_samples_) + HeapBytes(cauchy_times_) + HeapBytes(cauchy_samples_));
+		return report;
+	}
+
+	/**
+	\brief The number of samples CircleTrack takes per loop around the origin.
+	*/
+	unsigned SamplesPerLoop() const
+	{
+		return samples_per_loop_ ? samples_per_loop_ : this->EndgameSettings().num_sample_points;
+	}
+
+	/**
+	\brief The number of loops expected to close the samples around the origin, 0 if none is expected.
+	*/
+	unsigned PredictedCycleNumber() const
+	{
+		return predicted_cycle_number_;
+	}
+
 	/**
 	\brief Function that clears all samples and times from data members for the Cauchy endgame
 	*/
@@ -322,10 +409,12 @@ public:
 		using RT = typename Eigen::NumTraits<CT>::Real;
 		using std::acos;
 
-		if (this->EndgameSettings().num_sample_points < 3) // need to make sure we won't track right through the origin.
+		++this->run_statistics_.endgame_loops;
+		const auto samples_per_loop = SamplesPerLoop();
+		if (samples_per_loop < 3) // need to make sure we won't track right through the origin.
 		{
 			std::stringstream err_msg;
-			err_msg << "ERROR: The number of sample points " << this->EndgameSettings().num_sample_points << " for circle tracking must be >= 3";
+			err_msg << "ERROR: The number of sample points " << samples_per_loop << " for circle tracking must be >= 3";
 			throw std::runtime_error(err_msg.str());
 		}	
 
@@ -336,7 +425,7 @@ public:
 		
 		const auto num_vars = this->GetSystem().NumVariables();
 
-		for (unsigned ii = 0; ii < this->EndgameSettings().num_sample_points; ++ii)
+		for (unsigned ii = 0; ii < samples_per_loop; ++ii)
 		{
 			const Vec<CT>& current_sample = circle_samples.back();
 			const CT& current_time = circle_times.back();
@@ -349,14 +438,19 @@ public:
 			RT radius = abs(starting_time), angle = arg(starting_time);
 
 			auto next_sample = Vec<CT>(num_vars);
-			auto next_time = (ii==this->EndgameSettings().num_sample_points-1) 
+			auto next_time = (ii==samples_per_loop-1) 
 								?
 							  starting_time
 								:
-							  polar(radius, (ii+1)*2*acos(static_cast<RT>(-1)) / (this->EndgameSettings().num_sample_points) + angle)
+							  polar(radius, (ii+1)*2*acos(static_cast<RT>(-1)) / samples_per_loop + angle)
 							  ;
 
-			auto tracking_success = this->GetTracker().TrackPath(next_sample, current_time, next_time, current_sample);	
+			// the first piece starts the path, and the rest continue it with the tracker's step size and precision, without refining again at each sample
+			auto tracking_success = (ii==0)
+									?
+								this->GetTracker().TrackPath(next_sample, current_time, next_time, current_sample)
+									:
+								this->GetTracker().ContinuePath(next_sample, next_time);
 			if (tracking_success != SuccessCode::Success)
 			{
 				std::cout << "tracker fail in circle track, radius " << radius << ", type " << int(tracking_success) << std::endl;
@@ -380,6 +474,7 @@ public:
 			// down here next_sample and next_time should have the same precision.
 		}
 
+		trace::Record(trace::EventKind::CauchyLoop, samples_per_loop);
 		return SuccessCode::Success;
 
 	}//end CircleTrack
@@ -568,6 +663,26 @@ public:
 
 
 
+	/**
+		\brief Determine whether the loops taken so far have closed, refining to check only once the predicted number of loops has been taken.
+
+		Before the predicted cycle number is reached, the last sample is compared with the first, as they are, which costs one difference of vectors.  From then on, CheckClosedLoop also refines them if they do not match.  A cycle number in the endgame operating zone does not change as the loops shrink, so for all but the first loops of a path, the loops before the predicted number cannot close, and their refinement is saved.
+
+		\tparam CT The complex number type
+	*/
+	template<typename CT>
+	bool CheckClosedLoopAsPredicted()
+	{
+		if (this->CycleNumber() < predicted_cycle_number_)
+		{
+			const auto& samples = std::get<SampCont<CT> >(cauchy_samples_);
+			return (samples.front() - samples.back()).norm() < this->GetTracker().TrackingTolerance();
+		}
+		return CheckClosedLoop<CT>();
+	}
+
+
+
 	/**
 		\brief 	After we have used CircleTrack and have successfully closed the loop using CheckClosedLoop we need to check the maximum and minimum norms of the samples collected. 
 				If the ratio of the maximum and minimum norm are within the threshold maximum_cauchy_ratio, and the difference is greater than final tolerance than we are successful. 
@@ -601,7 +716,7 @@ public:
 		else
 		{
 			RT norm;
-			for(unsigned int ii=0; ii < this->EndgameSettings().num_sample_points; ++ii)
+			for(unsigned int ii=0; ii < SamplesPerLoop(); ++ii)
 			{
 				norm = samples[ii].norm();
 				if(norm > max)
@@ -692,9 +807,10 @@ public:
 			{ // then we believe we are in the EG operating zone, since the path is relatively flat.  i still disbelieve this is a good test (dab 20160310)
 				while (true)
 				{
-					if (CheckClosedLoop<CT>())
+					if (CheckClosedLoopAsPredicted<CT>())
 					{//error is small enough, exit the loop with success. 
 						initial_cauchy_loop_success = SuccessCode::Success;
+						predicted_cycle_number_ = this->CycleNumber();
 						continue_loop = false;
 						break;
 					}
@@ -776,7 +892,7 @@ public:
 		using RT = typename Eigen::NumTraits<CT>::Real;
 
 		//initialize array holding c_over_k estimates
-		std::deque<RT> c_over_k; 
+		TimeCont<RT> c_over_k; 
 
 		auto& ps_times = std::get<TimeCont<CT> >(pseg_times_);
 		auto& ps_samples = std::get<SampCont<CT> >(pseg_samples_);
@@ -835,6 +951,13 @@ public:
 
 		}//end while
 
+		// c/k is at most the cycle number, so once stable, at least that many loops are expected before they close
+		if (CheckForCOverKStabilization(c_over_k))
+		{
+			using std::floor;
+			predicted_cycle_number_ = unsigned(floor(c_over_k.back()));
+		}
+
 		auto cauchy_loop_success = InitialCauchyLoops<CT>();
 		if (cauchy_loop_success != SuccessCode::Success)
 			return cauchy_loop_success;
@@ -864,6 +987,7 @@ public:
 	SuccessCode ComputePSEGApproximationAtT0(Vec<CT>& result, const CT & time_t0)
 	{
 		using RT = typename Eigen::NumTraits<CT>::Real;
+		BERTINI_TIME_PHASE(this->profile_, EndgameApproximation, this->GetTracker().CurrentPrecision());
 
 		auto& ps_times = std::get<TimeCont<CT> >(pseg_times_);
 		auto& ps_samples = std::get<SampCont<CT> >(pseg_samples_);
@@ -933,37 +1057,76 @@ public:
 	template<typename CT>
 	SuccessCode ComputeCauchyApproximationOfXAtT0(Vec<CT>& result)
 	{	
-		using RT = typename Eigen::NumTraits<CT>::Real;
+		BERTINI_TIME_PHASE(this->profile_, EndgameApproximation, this->GetTracker().CurrentPrecision());
 		auto& cau_times = std::get<TimeCont<CT> >(cauchy_times_);
 		auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
 
-		if (cau_samples.size() != this->CycleNumber() * this->EndgameSettings().num_sample_points+1)
+		if (cau_samples.size() != this->CycleNumber() * SamplesPerLoop()+1)
 		{
 			std::stringstream err_msg;
-			err_msg << "to compute cauchy approximation, cauchy_samples must be of size " << this->CycleNumber() * this->EndgameSettings().num_sample_points+1 << " but is of size " << cau_samples.size() << '\n';
+			err_msg << "to compute cauchy approximation, cauchy_samples must be of size " << this->CycleNumber() * SamplesPerLoop()+1 << " but is of size " << cau_samples.size() << '\n';
 			throw std::runtime_error(err_msg.str());
 		}
 
-		result = Vec<CT>::Zero(this->GetSystem().NumVariables());//= (cau_samples[0]+cau_samples.back())/2; 
-
 		if (TrackerTraits<TrackerType>::IsAdaptivePrec)
 		{
 			//Ensure all samples are of the same precision.
 			auto new_precision = AsDerived().EnsureAtUniformPrecision(cau_times, cau_samples);
 		}
 
-		for(unsigned int ii = 0; ii < this->CycleNumber() * this->EndgameSettings().num_sample_points; ++ii)
+		const unsigned num_loop_samples = this->CycleNumber() * SamplesPerLoop();
+		for(unsigned int ii = 0; ii < num_loop_samples; ++ii)
 		{
 			auto refine_code = AsDerived().RefineSample(cau_samples[ii],cau_samples[ii],cau_times[ii]);
 			if (refine_code!=SuccessCode::Success)
 				return refine_code;
-			result += cau_samples[ii];
 		}
-		result /= static_cast<RT>(this->CycleNumber() * this->EndgameSettings().num_sample_points);
+
+		MeanOfSamples(result, cau_samples, num_loop_samples);
+
+		if (cauchy_settings_.adaptive_samples_per_loop)
+			AdaptSamplesPerLoop(result);
 		return SuccessCode::Success;
 
 	}
 
+	/**
+	\brief Adapt the number of samples per loop, for the loops around the origin taken next, to the error of the trapezoid rule over the loops just taken.
+
+	The error is estimated by the difference between the mean of all the samples on the loops, and the mean of every other one, which is the trapezoid rule with half as many samples.  The rule converges geometrically for the samples on a loop, so the error with all the samples is about the square of the estimate, relative to the size of the mean.  If the halved rule is already within the final tolerance, the number of samples per loop is halved.  If the square of the estimate is not, it is doubled.  The number stays between min_samples_per_loop and max_samples_per_loop, and is left as it is if the samples cannot be halved.
+
+	\param mean The mean of all the samples on the loops.
+	\tparam CT The complex number type.
+	*/
+	template<typename CT>
+	void AdaptSamplesPerLoop(Vec<CT> const& mean)
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::max; using std::min;
+
+		const auto& cau_samples = std::get<SampCont<CT> >(cauchy_samples_);
+		const unsigned num_loop_samples = this->CycleNumber() * SamplesPerLoop();
+		if (num_loop_samples % 2)
+			return;
+
+		Vec<CT> halved_mean = cau_samples[0];
+		for (unsigned ii = 2; ii < num_loop_samples; ii += 2)
+			halved_mean += cau_samples[ii];
+		halved_mean /= static_cast<RT>(num_loop_samples/2);
+
+		const RT halved_error = (mean - halved_mean).norm();
+		const RT scale = max(RT(mean.norm()), RT(1));
+		const auto least = max(cauchy_settings_.min_samples_per_loop, 3u);
+
+		if (halved_error < this->Tolerances().final_tolerance)
+			samples_per_loop_ = max(least, SamplesPerLoop()/2);
+		else if (halved_error*halved_error/scale > this->Tolerances().final_tolerance)
+			samples_per_loop_ = max(least, min(cauchy_settings_.max_samples_per_loop, 2*SamplesPerLoop()));
+
+		BOOST_LOG_TRIVIAL(severity_level::trace) << "trapezoid rule error with half the samples " << halved_error << ", next loops take " << SamplesPerLoop() << " samples";
+	}
+
+
 	/**
 	\brief Function that will utilize CircleTrack and CheckClosedLoop to collect all samples while tracking around the origin till we close the loop. 
 
@@ -1008,8 +1171,9 @@ public:
 				std::cout << "Cauchy loop fail tracking "<< int(tracking_success) <<"\n\n";
 				return tracking_success;
 			}
-			else if(CheckClosedLoop<CT>())
+			else if(CheckClosedLoopAsPredicted<CT>())
 			{
+				predicted_cycle_number_ = this->CycleNumber();
 				return SuccessCode::Success;
 			}
 		} 
@@ -1050,6 +1214,10 @@ public:
 		}
 
 		assert(Precision(start_time)==Precision(start_time) && ("CauchyEG Run time and point must be of matching precision"));
+		BERTINI_TIME_PHASE(this->profile_, Endgame, Precision(start_time));
+		this->BeginRunStatistics(instrument::PathStatistics::EndgameType::Cauchy);
+		instrument::Stopwatch run_timer(this->run_statistics_.endgame_seconds);
+		const SuspendedBoundarySelection<TrackerType> suspended(this->GetTracker());
 
 		using RT = typename Eigen::NumTraits<CT>::Real;
 
@@ -1061,11 +1229,14 @@ public:
 
 		ClearTimesAndSamples<CT>(); //clear times and samples before we begin.
 		this->CycleNumber(0);
+		samples_per_loop_ = this->EndgameSettings().num_sample_points;
+		predicted_cycle_number_ = 0;
 
 		CT origin(0,0); // this should really be input, not set hardcoded.
 
 		Vec<CT> prev_approx, latest_approx;
-		RT approximate_error;
+		RT& approximate_error = std::get<RT>(this->approximate_error_);
+		approximate_error = RT(1);
 		Vec<CT>& final_approx = std::get<Vec<CT> >(this->final_approximation_at_origin_);
 	
 
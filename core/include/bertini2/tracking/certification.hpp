@@ -0,0 +1,197 @@
+//This file is part of Bertini 2.
+//
+//certification.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//certification.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with certification.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file certification.hpp
+
+\brief Certify that points approximate nonsingular solutions of a polynomial system, by Smale's alpha theory, on a pool of threads.
+
+A point \f$x\f$ is an approximate solution, from which Newton's method converges quadratically from the first step to a solution, if \f$\alpha(f,x) = \beta(f,x)\gamma(f,x) < (13-3\sqrt{17})/4\f$, where \f$\beta = \|Df(x)^{-1}f(x)\|\f$ is the length of the Newton step, and \f$\gamma\f$ measures how fast the Jacobian can change.  For a square polynomial system, \f$\gamma\f$ is bounded by the structure of the polynomials,
+
+\f[ \gamma(f,x) \le \frac{\mu(f,x) D^{3/2}}{2\|x\|_1}, \quad \mu(f,x) = \max\left(1, \|f\| \, \|Df(x)^{-1}\Delta\|\right), \f]
+
+where \f$D\f$ is the largest degree, \f$\|x\|_1 = \sqrt{1+\|x\|^2}\f$, \f$\|f\|\f$ is the Bombieri-Weyl norm of the coefficients, and \f$\Delta\f$ is diagonal, with entries \f$\sqrt{d_i}\|x\|_1^{d_i-1}\f$.  The coefficients come from the PolynomialSystem of the system, so the bound costs one pass over its terms, and one inversion of the Jacobian, a fraction of the cost of tracking the path to the point.
+
+The bounds are computed first in double precision.  The inverse of the Jacobian is not exact, but how far it is from one is measured, by \f$\rho = \|I - MDf(x)\|\f$ for the computed inverse \f$M\f$, and the norms through it are enlarged by \f$1/(1-\rho)\f$.  The rounding of the function values is bounded from the absolute values of the terms, and that of the other sums by enlarging each bound by a multiple of the unit roundoff, the last rounding done upward.  This is not interval arithmetic, but errs on the side of not certifying.  A point not certified in double precision, because its Jacobian is ill conditioned, or its bounds are close to the threshold, is tried again in multiple precision.
+*/
+
+#ifndef BERTINI_TRACKING_CERTIFICATION_HPP
+#define BERTINI_TRACKING_CERTIFICATION_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace bertini {
+	namespace tracking {
+
+		/**
+		\brief The constant below which \f$\alpha\f$ certifies an approximate solution, \f$(13-3\sqrt{17})/4\f$.
+		*/
+		inline
+		double AlphaThreshold()
+		{
+			return (13 - 3*std::sqrt(17.))/4;
+		}
+
+
+		/**
+		\brief The upper bounds on \f$\alpha\f$, \f$\beta\f$ and \f$\gamma\f$ at a point, or NaN if they could not be computed.
+		*/
+		struct AlphaCertificate
+		{
+			double alpha = std::numeric_limits<double>::quiet_NaN();
+			double beta = std::numeric_limits<double>::quiet_NaN(); ///< Bounds the length of the Newton step, and so the distance to the solution, which is at most twice it.
+			double gamma = std::numeric_limits<double>::quiet_NaN();
+			unsigned precision = 0; ///< The precision, in digits, at which the bounds were computed, 16 for double, or 0 if they were not.
+
+			/**
+			\brief Whether the point is certified to be an approximate solution.
+			*/
+			bool Certified() const
+			{
+				return alpha < AlphaThreshold();
+			}
+
+			/**
+			\brief Whether the solutions of two certified points are certified to be distinct, the points being farther apart than the sum of the distances from each to its solution.
+			*/
+			template<typename ComplexType>
+			static bool Distinct(AlphaCertificate const& a, Vec<ComplexType> const& x, AlphaCertificate const& b, Vec<ComplexType> const& y)
+			{
+				return a.Certified() && b.Certified() && static_cast<double>((x-y).norm()) > 2*(a.beta + b.beta);
+			}
+		};
+
+
+		/**
+		\brief Settings for certifying points.
+		*/
+		struct CertifyConfig
+		{
+			unsigned fallback_precision = 50; ///< The precision, in digits, at which points not certified in double precision are tried again, or 0 not to.  At least the precision of a multiple precision point is used.
+			double max_inverse_residual = 0.5; ///< The largest \f$\rho\f$ of a computed inverse of the Jacobian trusted, at most 1.
+		};
+
+
+		/**
+		\brief Bound \f$\alpha\f$, \f$\beta\f$ and \f$\gamma\f$ at a point, in double precision, and, if not certified, in multiple precision.
+
+		\param sys A square polynomial system, without path variable or patches, in the variables of the point.  It is evaluated, so may not be shared with another thread.
+		\param x The point.
+		\param config The precision to fall back to.
+
+		\throws std::runtime_error if the system is not square, has a path variable or patches, or is not polynomial.
+		*/
+		AlphaCertificate Certify(System const& sys, Vec<dbl> const& x, CertifyConfig const& config = CertifyConfig());
+
+		/**
+		\overload
+		*/
+		AlphaCertificate Certify(System const& sys, Vec<mpfr> const& x, CertifyConfig const& config = CertifyConfig());
+
+
+		/**
+		\brief Certify many points, on a pool of threads.
+
+		## Use
+
+		\code
+		std::vector< Vec<dbl> > points;
+		for (auto const& r : results)
+			if (r.success_code==SuccessCode::Success)
+				points.push_back(homotopy.DehomogenizePoint(r.endpoint));
+		auto certificates = CertifyAll(target, points);
+		\endcode
+
+		Each worker evaluates its own copy of the system, made by System::CloneForThread where it can be, as for RefineAll.
+
+		\param sys A square polynomial system, without path variable or patches, in the variables of the points.
+		\param points The points to certify.
+		\param config The precision to fall back to.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\return The certificate of each point, in the order given.
+
+		\throws std::runtime_error if the system is not square, has a path variable or patches, or is not polynomial, or a point has the wrong number of coordinates.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename ComplexType>
+		std::vector<AlphaCertificate> CertifyAll(System const& sys, std::vector< Vec<ComplexType> > const& points,
+		                                         CertifyConfig const& config = CertifyConfig(),
+		                                         unsigned num_threads = 0)
+		{
+			if (sys.HavePathVariable() || sys.IsPatched() || sys.NumFunctions()!=sys.NumVariables() || !sys.HavePolynomialSystem())
+				throw std::runtime_error("certifying points, but the system is not a square polynomial system without path variable or patches");
+
+			for (const auto& p : points)
+				if (static_cast<std::size_t>(p.size())!=sys.NumVariables())
+					throw std::runtime_error("certifying points, but a point has " + std::to_string(p.size()) + " coordinates, not " + std::to_string(sys.NumVariables()));
+
+			std::vector<AlphaCertificate> certificates(points.size());
+			if (points.empty())
+				return certificates;
+
+			if (num_threads==0)
+				num_threads = detail::DefaultNumWorkers();
+			num_threads = std::min<unsigned>(num_threads, points.size());
+
+			// the copies are made here, serially, as the pool is not for concurrent use
+			std::string archived_system;
+			auto copy_system = [&]()
+			{
+				if (archived_system.empty())
+					try
+					{
+						return sys.CloneForThread();
+					}
+					catch (std::runtime_error const&)
+					{
+						archived_system = detail::Archive(sys);
+					}
+				return detail::CloneFromArchive<System>(archived_system);
+			};
+
+			SystemPool systems;
+			std::vector< std::shared_ptr<System> > worker_systems(num_threads);
+			for (unsigned ii = 0; ii < num_threads; ++ii)
+				worker_systems[ii] = systems.NonPtrAdd(copy_system());
+
+			std::atomic<bool> stop(false);
+			std::atomic<std::size_t> next(0);
+			detail::RunWorkers(num_threads, stop, [&](unsigned worker)
+			{
+				std::size_t ii;
+				while (!stop && (ii = next++) < points.size())
+					certificates[ii] = Certify(*worker_systems[worker], points[ii], config);
+			});
+
+			return certificates;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,198 @@
+//This file is part of Bertini 2.
+//
+//condition_estimate.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//condition_estimate.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with condition_estimate.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file condition_estimate.hpp
+
+\brief Estimating the norm of the inverse of the Jacobian, for the AMP criteria, from a factorization already made.
+*/
+
+#ifndef BERTINI_TRACKING_CONDITION_ESTIMATE_HPP
+#define BERTINI_TRACKING_CONDITION_ESTIMATE_HPP
+
+#include "bertini2/tracking/tracking_config.hpp"
+#include "bertini2/lu.hpp"
+
+#include <vector>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief Estimates the norm of the inverse of a factored matrix, without factoring anything.
+
+		Two methods are available.  RandomSolve solves against a vector of random units, which is made once for each precision and kept, rather than drawn every step.  Hager is the 1-norm estimator of Hager, as refined by Higham, which alternates solves with the matrix and its adjoint, at most five times each, and is nearly always exact to within a small factor.
+
+		Either way, once two estimates in a row agree to within a factor of two, the last one may be reused for a number of steps, after which a new one is made.  The matrices of neighbouring steps of a path are close, so this is usually safe, but it is off unless asked for.
+
+		\tparam ComplexType The number type of the factorization.
+		*/
+		template<typename ComplexType>
+		class NormInverseEstimator
+		{
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+		public:
+
+			/**
+			\brief Estimate the norm of the inverse of the last matrix factored into lu, or reuse the last estimate.
+
+			\param lu The factorization.
+			\param method How to estimate.
+			\param reuse_steps Make a new estimate only every this many calls, while estimates are stable.
+			*/
+			RealType Estimate(PartialPivotLU<ComplexType> const& lu, config::NormInverseEstimate method, unsigned reuse_steps = 1)
+			{
+				if (num_estimates_ >= 2 && steps_since_estimate_+1 < reuse_steps && Stable())
+				{
+					++steps_since_estimate_;
+					return last_;
+				}
+
+				previous_ = last_;
+				if (method==config::NormInverseEstimate::Hager)
+					last_ = HagerEstimate(lu);
+				else
+					last_ = RandomSolveEstimate(lu);
+
+				++num_estimates_;
+				steps_since_estimate_ = 0;
+				return last_;
+			}
+
+			/**
+			\brief Forget the estimates made, so that the next call makes a new one.  The random vectors are kept.
+			*/
+			void Reset()
+			{
+				num_estimates_ = 0;
+				steps_since_estimate_ = 0;
+			}
+
+		private:
+
+			bool Stable() const
+			{
+				return last_ <= 2*previous_ && previous_ <= 2*last_;
+			}
+
+
+			RealType RandomSolveEstimate(PartialPivotLU<ComplexType> const& lu)
+			{
+				lu.Solve(y_, RandomVector(lu.Size(), lu.FactoredPrecision()));
+				return y_.norm();
+			}
+
+			/**
+			\brief The random vector of units of a length and precision, made the first time it is asked for.
+			*/
+			Vec<ComplexType> const& RandomVector(Eigen::DenseIndex n, unsigned precision)
+			{
+				for (auto const& r : random_)
+					if (r.size()==n && Precision(r(0))==precision)
+						return r;
+
+				random_.push_back(RandomOfUnits<ComplexType>(n));
+				Precision(random_.back(), precision);
+				return random_.back();
+			}
+
+
+			/**
+			\brief Hager's estimate of the 1-norm of the inverse, in the form of Higham's Algorithm 4.1 for complex matrices.
+			*/
+			RealType HagerEstimate(PartialPivotLU<ComplexType> const& lu)
+			{
+				using std::abs;
+				using std::real;
+				using std::conj;
+
+				const auto n = lu.Size();
+				const unsigned max_iterations = 5;
+
+				x_.resize(n);
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					x_(ii) = ComplexType(1)/ComplexType(static_cast<double>(n));
+
+				RealType estimate(0);
+				for (unsigned iteration = 0; iteration < max_iterations; ++iteration)
+				{
+					lu.Solve(y_, x_);
+					RealType one_norm(0);
+					for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+						one_norm += abs(y_(ii));
+
+					if (iteration > 0 && one_norm <= estimate)
+						break;
+					estimate = one_norm;
+
+					xi_.resize(n);
+					for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					{
+						const RealType magnitude = abs(y_(ii));
+						if (magnitude==0)
+							xi_(ii) = ComplexType(1);
+						else
+							xi_(ii) = y_(ii)/magnitude;
+					}
+					lu.SolveAdjoint(z_, xi_);
+
+					Eigen::DenseIndex largest = 0;
+					RealType largest_magnitude = abs(z_(0));
+					RealType z_dot_x = real(conj(z_(0))*x_(0));
+					for (Eigen::DenseIndex ii = 1; ii < n; ++ii)
+					{
+						const RealType magnitude = abs(z_(ii));
+						if (magnitude > largest_magnitude)
+						{
+							largest_magnitude = magnitude;
+							largest = ii;
+						}
+						z_dot_x += real(conj(z_(ii))*x_(ii));
+					}
+
+					// x is already at a stationary point
+					if (largest_magnitude <= z_dot_x)
+						break;
+
+					x_.setZero();
+					x_(largest) = ComplexType(1);
+				}
+
+				return estimate;
+			}
+
+
+			std::vector< Vec<ComplexType> > random_; ///< A vector of random units for each length and precision used.
+			Vec<ComplexType> x_, y_, z_, xi_; ///< Workspace for the estimates.
+
+			RealType last_, previous_; ///< The last two estimates made.
+			unsigned num_estimates_ = 0; ///< The number of estimates made since the last reset.
+			unsigned steps_since_estimate_ = 0; ///< The number of times the last estimate has been reused.
+		};
+
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
@@ -0,0 +1,270 @@
+//This file is part of Bertini 2.
+//
+//endpoint_file.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//endpoint_file.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with endpoint_file.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file endpoint_file.hpp
+
+\brief A compact binary file of the endpoints of tracked paths, written a path at a time, and read back by random access.
+
+The file is a short header followed by one record per path, appended as each finishes, so that a run of millions of paths need not hold its endpoints in memory.  A record holds the index of the start point, the success code, the final time, the precision, cycle number, condition number and alpha certificate, the statistics of tracking the path, and the coordinates.  Each real number is stored as the sign and exponent, and the limbs of the mantissa, exactly as MPFR holds it, so nothing is lost and nothing is printed and parsed.  Doubles are stored the same way, at 53 bits, so either kind of endpoint may be read back as either.
+
+The reader memory maps the file, and finds the records with one pass over their lengths, after which any record is read in place.  A record cut short by a killed run is ignored.
+
+As with the system cache, the layout follows the machine, so a file should be treated as local to the kind of machine which wrote it.
+*/
+
+#ifndef BERTINI_TRACKING_ENDPOINT_FILE_HPP
+#define BERTINI_TRACKING_ENDPOINT_FILE_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+#include "bertini2/tracking/certification.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+namespace bertini {
+	namespace tracking {
+
+		/**
+		\brief One record of an endpoint file.
+		*/
+		template<typename ComplexType>
+		struct EndpointRecord
+		{
+			std::size_t index = 0; ///< the index of the start point
+			SuccessCode success_code = SuccessCode::Success; ///< how tracking ended
+			ComplexType time; ///< the time at which tracking ended
+			unsigned precision = 0; ///< the precision, in digits, of the endpoint
+			unsigned cycle_number = 0; ///< the cycle number from the endgame, or 0 if none was run
+			double condition_number = std::numeric_limits<double>::quiet_NaN(); ///< the estimate of the condition number of the Jacobian at the endpoint, or NaN if unknown
+			AlphaCertificate certificate; ///< the bounds of alpha theory at the endpoint, see CertifyEndpoints, or NaN if it was not certified
+			instrument::PathStatistics statistics; ///< the steps, evaluations, precisions and time of tracking the path, and of its endgame
+			Vec<ComplexType> endpoint; ///< the point at the final time
+		};
+
+
+		/**
+		\brief Appends the endpoints of paths to an endpoint file, as they finish.
+
+		Writing is serialized by a mutex, so the workers of a run may share one writer.  It may be passed directly as the sink of TrackAllPaths, which then keeps no endpoints in memory, or of mpi::TrackAllPaths.
+
+		\code
+		EndpointWriter endpoints("run.endpoints");
+		TrackAllPaths<AMPTracker>(homotopy, TD, setup, mpfr(1), mpfr(0), std::ref(endpoints));
+		\endcode
+		*/
+		class EndpointWriter
+		{
+		public:
+
+			/**
+			\param file The file to write.
+			\param append Whether to add to the records of an existing file, rather than replace it.
+
+			\throws std::runtime_error if the file cannot be opened, or exists with another layout when appending.
+			*/
+			explicit EndpointWriter(boost::filesystem::path const& file, bool append = false);
+
+			/**
+			\brief Append a record.
+
+			\throws std::runtime_error if the record cannot be written.
+			*/
+			void Write(EndpointRecord<dbl> const& record);
+
+			/**
+			\overload
+			*/
+			void Write(EndpointRecord<mpfr> const& record);
+
+			/**
+			\brief Append the record of a path tracked by one of the TrackAllPaths drivers, with its statistics.  There is no condition number for it, and its cycle number is that of its statistics.
+			*/
+			template<typename ComplexType>
+			void operator()(PathResult<ComplexType> const& result)
+			{
+				EndpointRecord<ComplexType> record;
+				record.index = result.index;
+				record.success_code = result.success_code;
+				record.time = result.time;
+				record.precision = result.endpoint.size() > 0 ? Precision(result.endpoint) : 0;
+				record.cycle_number = result.statistics.cycle_number;
+				record.statistics = result.statistics;
+				record.endpoint = result.endpoint;
+				Write(record);
+			}
+
+			/**
+			\brief Push the records written so far to the operating system, so that they survive the process being killed.
+			*/
+			void Flush();
+
+			/**
+			\brief The number of records written by this writer.
+			*/
+			std::size_t NumWritten() const
+			{
+				return num_written_;
+			}
+
+		private:
+
+			void Append(std::string const& record);
+
+			boost::filesystem::path file_;
+			boost::filesystem::ofstream out_;
+			std::mutex mutex_;
+			std::size_t num_written_ = 0;
+		};
+
+
+		/**
+		\brief Whether a file begins as an endpoint file does, of any layout.  EndpointReader checks the rest of the header.
+		*/
+		bool IsEndpointFile(boost::filesystem::path const& file);
+
+
+		/**
+		\brief Random access to the records of an endpoint file, through a memory mapping of it.
+		*/
+		class EndpointReader
+		{
+		public:
+
+			/**
+			\throws std::runtime_error if the file cannot be mapped, or is not an endpoint file of this layout.
+			*/
+			explicit EndpointReader(boost::filesystem::path const& file);
+
+			/**
+			\brief The number of complete records in the file.
+			*/
+			std::size_t NumRecords() const
+			{
+				return offsets_.size();
+			}
+
+			/**
+			\brief The length of the file up to the end of its last complete record.
+			*/
+			std::uint64_t CompleteSize() const
+			{
+				return complete_size_;
+			}
+
+			/**
+			\brief Read the record at a position in the file, which is the order they were written in, not the index of the start point.
+
+			Coordinates read into multiple precision numbers get the precision they were written at.
+
+			\throws std::out_of_range if there is no such record.
+			\throws std::runtime_error if the record is corrupt, its reals or number of coordinates not fitting in it, or its reals not ones MPFR could have written.
+			*/
+			void Read(std::size_t n, EndpointRecord<dbl> & record) const;
+
+			/**
+			\overload
+			*/
+			void Read(std::size_t n, EndpointRecord<mpfr> & record) const;
+
+			/**
+			\brief Read the record at a position in the file.
+			*/
+			template<typename ComplexType>
+			EndpointRecord<ComplexType> Get(std::size_t n) const
+			{
+				EndpointRecord<ComplexType> record;
+				Read(n, record);
+				return record;
+			}
+
+		private:
+
+			char const* Record(std::size_t n) const;
+			char const* RecordEnd(std::size_t n) const; // where the record at n ends, the next begins or the complete records end
+
+			boost::interprocess::file_mapping mapping_;
+			boost::interprocess::mapped_region region_;
+			std::vector<std::uint64_t> offsets_;
+			std::uint64_t complete_size_ = 0;
+		};
+
+
+
+		/**
+		\brief Certify the endpoints of the records of paths which succeeded, on a pool of threads, storing the certificates in the records.
+
+		\code
+		std::vector< EndpointRecord<mpfr> > records;
+		for (std::size_t ii = 0; ii < reader.NumRecords(); ++ii)
+			records.push_back(reader.Get<mpfr>(ii));
+		CertifyEndpoints(target, homotopy, records);
+		\endcode
+
+		\param target A square polynomial system, without path variable or patches, of which the endpoints should be solutions.
+		\param tracked The system the endpoints are coordinates of, by whose DehomogenizePoint they are brought to those of target.  The target itself, if it was tracked without homogenizing.
+		\param records The records, whose certificates are replaced.  Those of paths which did not succeed are left as they are.
+		\param config The precision to fall back to.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\return The number of endpoints certified.
+
+		\throws Whatever CertifyAll throws.
+		*/
+		template<typename ComplexType>
+		std::size_t CertifyEndpoints(System const& target, System const& tracked, std::vector< EndpointRecord<ComplexType> > & records,
+		                             CertifyConfig const& config = CertifyConfig(),
+		                             unsigned num_threads = 0)
+		{
+			std::vector<std::size_t> which;
+			std::vector< Vec<ComplexType> > points;
+			for (std::size_t ii = 0; ii < records.size(); ++ii)
+				if (records[ii].success_code==SuccessCode::Success)
+				{
+					which.push_back(ii);
+					points.push_back(tracked.DehomogenizePoint(records[ii].endpoint));
+				}
+
+			const auto certificates = CertifyAll(target, points, config, num_threads);
+
+			std::size_t num_certified = 0;
+			for (std::size_t ii = 0; ii < which.size(); ++ii)
+			{
+				records[which[ii]].certificate = certificates[ii];
+				if (certificates[ii].Certified())
+					++num_certified;
+			}
+			return num_certified;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -87,6 +87,7 @@ namespace bertini {
 
 		virtual ~SuccessfulPredict() = default;
 		SuccessfulPredict() = delete;
+		BERTINI_EVENT_IS_A(SuccessfulPredict, TrackingEvent<ObservedT>)
 
 		/**
 		\brief Get the resulting point of the prediction.
@@ -117,6 +118,7 @@ namespace bertini {
 
 		virtual ~SuccessfulCorrect() = default;
 		SuccessfulCorrect() = delete;
+		BERTINI_EVENT_IS_A(SuccessfulCorrect, TrackingEvent<ObservedT>)
 		
 		/**
 		\brief Get the resulting point of the correction.
@@ -155,6 +157,7 @@ namespace bertini {
 
 		virtual ~PrecisionChanged() = default;
 		PrecisionChanged() = delete;
+		BERTINI_EVENT_IS_A(PrecisionChanged, PrecisionEvent<ObservedT>)
 		
 		/**
 		\brief Get the previous precision.
@@ -173,7 +176,7 @@ namespace bertini {
 	\brief Precision increased during tracking
 	*/
 	template<class ObservedT>
-	class PrecisionIncreased : public PrecisionEvent<ObservedT>
+	class PrecisionIncreased : public PrecisionChanged<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
 		/**
@@ -188,13 +191,14 @@ namespace bertini {
 		{}
 		virtual ~PrecisionIncreased() = default;
 		PrecisionIncreased() = delete;
+		BERTINI_EVENT_IS_A(PrecisionIncreased, PrecisionChanged<ObservedT>)
 	};
 
 	/**
 	\brief Precision decreased during tracking
 	*/
 	template<class ObservedT>
-	class PrecisionDecreased : public PrecisionEvent<ObservedT>
+	class PrecisionDecreased : public PrecisionChanged<ObservedT>
 	{ BOOST_TYPE_INDEX_REGISTER_CLASS
 	public:
 		/**
@@ -209,6 +213,7 @@ namespace bertini {
 		{}
 		virtual ~PrecisionDecreased() = default;
 		PrecisionDecreased() = delete;
+		BERTINI_EVENT_IS_A(PrecisionDecreased, PrecisionChanged<ObservedT>)
 	};
 
 	/**
@@ -316,6 +321,7 @@ namespace bertini {
 
 		virtual ~Initializing() = default;
 		Initializing() = delete;
+		BERTINI_EVENT_IS_A(Initializing, TrackingEvent<ObservedT>)
 
 		/**
 		\brief Get the time (tracking wise, not clock wise) at which tracking is starting/
@@ -37,10 +37,20 @@
 
 #include "bertini2/system.hpp"
 #include "bertini2/mpfr_extensions.hpp"
-#include <Eigen/LU>
+#include "bertini2/lu.hpp"
+#include "bertini2/mpfr_slab.hpp"
+#include "bertini2/complex_kernels.hpp"
+#include "bertini2/tracking/condition_estimate.hpp"
+#include "bertini2/tracking/instrumentation.hpp"
 
 #include <boost/type_index.hpp>
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+#include <vector>
+
 
 namespace bertini{
 	namespace tracking{
@@ -93,6 +103,12 @@ namespace bertini{
 						return 5;
 					case (Predictor::RKVerner67):
 						return 6;
+					case (Predictor::Pade):
+						return 3;
+					case (Predictor::Taylor):
+						return 4;
+					case (Predictor::Hermite):
+						return 3;
 					default:
 					{
 						throw std::runtime_error("incompatible predictor choice in Order");
@@ -124,6 +140,12 @@ namespace bertini{
 						return true;
 					case (Predictor::RKVerner67):
 						return true;
+					case (Predictor::Pade):
+						return true;
+					case (Predictor::Taylor):
+						return true;
+					case (Predictor::Hermite):
+						return true;
 					default:
 					{
 						throw std::runtime_error("incompatible predictor choice in HasErrorEstimate");
@@ -132,32 +154,6 @@ namespace bertini{
 			}
 			
 			
-			namespace {
-				template<typename T>
-				struct LUSelector
-				{};
-
-				template<>
-				struct LUSelector<dbl>
-				{
-					template<typename N>
-					static Eigen::PartialPivLU<Mat<dbl>>& Run(N & n)
-					{
-						return n.GetLU_d();
-					}
-				};
-
-				template<>
-				struct LUSelector<mpfr>
-				{
-					template<typename N>
-					static Eigen::PartialPivLU<Mat<mpfr>>& Run(N & n)
-					{
-						return n.GetLU_mp();
-					}
-				};
-			}
-			
 			/**
 			 \class ExplicitRKPredictor
 			 
@@ -182,8 +178,6 @@ namespace bertini{
 			 */
 			class ExplicitRKPredictor
 			{
-				friend LUSelector<dbl>;
-				friend LUSelector<mpfr>;
 			public:
 				
 				/**
@@ -299,12 +293,49 @@ namespace bertini{
 							
 							break;
 						}
+
+						case Predictor::Pade:
+						{
+							// one stage, the tangent, at the start of the step.  the rest is by PadeStep
+							s_ = 1;
+
+							FillButcherTable<double>(s_, aEuler_, bEuler_, cEuler_);
+							FillButcherTable<mpfr_float>(s_, aEuler_, bEuler_, cEuler_);
+							FillPadeNodes<dbl>();
+							FillPadeNodes<mpfr>();
+
+							break;
+						}
+
+						case Predictor::Taylor:
+						{
+							// one stage, the tangent, at the start of the step.  the rest is by TaylorStep
+							s_ = 1;
+							p_ = taylor_order_;
+
+							FillButcherTable<double>(s_, aEuler_, bEuler_, cEuler_);
+							FillButcherTable<mpfr_float>(s_, aEuler_, bEuler_, cEuler_);
+
+							break;
+						}
 							
+						case Predictor::Hermite:
+						{
+							// the stages of RKF45, for the steps without enough history to extrapolate.  the rest is by HermiteStep
+							s_ = 6;
+
+							FillButcherTable<double>(s_, aRKF45_, bRKF45_, b_minus_bstarRKF45_, cRKF45_);
+							FillButcherTable<mpfr_float>(s_, aRKF45_, bRKF45_, b_minus_bstarRKF45_, cRKF45_);
+
+							break;
+						}
+
 						default:
 						{
 							throw std::runtime_error("incompatible predictor choice in ExplicitPredict");
 						}
 					}
+					FindStageTerms();
 					ResizeK();
 				}; // re: PredictorMethod
 				
@@ -328,15 +359,84 @@ namespace bertini{
 					std::get< Mat<mpfr> >(dh_dx_temp_).resize(numTotalFunctions_, numVariables_);
 					std::get< Vec<dbl> >(dh_dt_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(dh_dt_temp_).resize(numTotalFunctions_);
-
+					std::get< PartialPivotLU<dbl> >(LU_0_).Resize(numTotalFunctions_);
+					std::get< PartialPivotLU<mpfr> >(LU_0_).Resize(numTotalFunctions_);
+					std::get< PartialPivotLU<dbl> >(LU_stage_).Resize(numTotalFunctions_);
+					std::get< PartialPivotLU<mpfr> >(LU_stage_).Resize(numTotalFunctions_);
+					std::get< PartialPivotLU<dbl> >(LU_0_).UseThreads(S.EvaluationTeam());
+					std::get< PartialPivotLU<mpfr> >(LU_0_).UseThreads(S.EvaluationTeam());
+					std::get< PartialPivotLU<dbl> >(LU_stage_).UseThreads(S.EvaluationTeam());
+					std::get< PartialPivotLU<mpfr> >(LU_stage_).UseThreads(S.EvaluationTeam());
+
+					const auto sparsity = S.LinearSolveStructure();
+					std::get< PartialPivotLU<dbl> >(LU_0_).UseSparsity(sparsity);
+					std::get< PartialPivotLU<mpfr> >(LU_0_).UseSparsity(sparsity);
+					std::get< PartialPivotLU<dbl> >(LU_stage_).UseSparsity(sparsity);
+					std::get< PartialPivotLU<mpfr> >(LU_stage_).UseSparsity(sparsity);
+
+					ForgetStageZero();
+					ForgetHistory();
+					ResetNormJInverseEstimate();
 					ResizeK();
 				}
+
+
+				/**
+				\brief Forget the first stage kept from the last prediction, so that the next one evaluates it afresh.
+
+				Call this if the system has been changed in place, such as by setting its parameters, since the first stage is reused whenever a prediction starts from the same point of the same system.
+				*/
+				void ForgetStageZero()
+				{
+					std::get< StageZero<dbl> >(stage_0_).system = nullptr;
+					std::get< StageZero<mpfr> >(stage_0_).system = nullptr;
+				}
+				
+				
+				/**
+				\brief Forget the points and tangents of the path kept for Predictor::Hermite, so that it steps by Runge-Kutta until it has enough again.  Call this at the start of a path.
+				*/
+				void ForgetHistory()
+				{
+					std::get< PathHistory<dbl> >(history_).Clear();
+					std::get< PathHistory<mpfr> >(history_).Clear();
+				}
+
+
+				/**
+				\brief Forget the estimates of the norm of the inverse of the Jacobian, so that none is reused.  Call this at the start of a path.
+				*/
+				void ResetNormJInverseEstimate()
+				{
+					std::get< NormInverseEstimator<dbl> >(norm_J_inverse_estimator_).Reset();
+					std::get< NormInverseEstimator<mpfr> >(norm_J_inverse_estimator_).Reset();
+				}
+
+
+				/**
+				\brief Set the profile the evaluations and linear solves of predictions are timed into.  Null for none.
+				*/
+				void Instrument(instrument::Profile* profile)
+				{
+					profile_ = profile;
+				}
+
+				/**
+				\brief The evaluations of the system, its Jacobian or time derivative, or its Taylor coefficients, made since construction.
+				*/
+				std::uint64_t NumEvaluations() const
+				{
+					return num_evaluations_;
+				}
 				
 				
 				void ResizeK()
 				{
 					std::get< Mat<dbl> >(K_).resize(numTotalFunctions_, s_);
 					std::get< Mat<mpfr> >(K_).resize(numTotalFunctions_, s_);
+					stage_sum_dbl_.resize(numTotalFunctions_);
+					K_slab_.Resize(numTotalFunctions_, s_, current_precision_);
+					stage_sum_.Resize(numTotalFunctions_, current_precision_);
 				}
 				
 				
@@ -348,6 +448,19 @@ namespace bertini{
 					return current_precision_;
 				}
 
+				/**
+				\brief The memory held by the workspace of the predictor.  The factorizations of the Jacobian, and the slabs the stages are combined in, are not counted.
+				*/
+				MemoryUsage MemoryReport() const
+				{
+					using memory::HeapBytes;
+					MemoryUsage report;
+					report.Add("stages", HeapBytes(K_) + HeapBytes(stage_space_) + HeapBytes(dh_dt_temp_) + HeapBytes(stage_sum_dbl_) + StageZeroBytes<dbl>() + StageZeroBytes<mpfr>() + HistoryBytes<dbl>() + HistoryBytes<mpfr>());
+					report.Add("jacobians", HeapBytes(dh_dx_0_) + HeapBytes(dh_dx_temp_));
+					report.Add("taylor", HeapBytes(taylor_) + HeapBytes(taylor_residual_));
+					return report;
+				}
+
 				/** 
 				 /brief Change the precision of the predictor variables and reassign the Butcher table variables.
 				 
@@ -357,18 +470,32 @@ namespace bertini{
 				void ChangePrecision(unsigned new_precision)
 				{
 					Precision(std::get< Mat<mpfr> >(K_),new_precision);
+					Precision(std::get< Vec<mpfr> >(stage_space_),new_precision);
+					std::get< mpfr >(stage_time_).precision(new_precision);
+					std::get< mpfr_float >(step_scale_).precision(new_precision);
 
 					Precision(std::get< Vec<mpfr> >(dh_dt_temp_),new_precision);
 					Precision(std::get< Mat<mpfr> >(dh_dx_0_),new_precision);
 					Precision(std::get< Mat<mpfr> >(dh_dx_temp_),new_precision);
-
-					Precision(std::get< Mat<mpfr_float> >(a_),new_precision);
-					Precision(std::get< Vec<mpfr_float> >(b_),new_precision);
-					Precision(std::get< Vec<mpfr_float> >(b_minus_bstar_),new_precision);
-					Precision(std::get< Vec<mpfr_float> >(c_),new_precision);
-
-					PredictorMethod(predictor_);
-
+					std::get< PartialPivotLU<mpfr> >(LU_0_).ChangePrecision(new_precision);
+					std::get< PartialPivotLU<mpfr> >(LU_stage_).ChangePrecision(new_precision);
+
+					Precision(std::get< Mat<mpfr> >(taylor_),new_precision);
+					Precision(std::get< Vec<mpfr> >(pade_values_),new_precision);
+					Precision(std::get< Vec<mpfr> >(pade_sum_),new_precision);
+					Precision(std::get< Mat<mpfr> >(taylor_residual_),new_precision);
+					std::get< mpfr_float >(series_error_).precision(new_precision);
+
+					StashButcherTable();
+					if (!RestoreButcherTable(new_precision))
+						PredictorMethod(predictor_);
+					else if (predictor_==Predictor::Pade)
+						FillPadeNodes<mpfr>();
+					Precision(std::get< Vec<mpfr> >(pade_nodes_),new_precision);
+
+					ForgetStageZero();
+					ForgetHistory();
+					ResetNormJInverseEstimate();
 					current_precision_ = new_precision;
 
 					PrecisionSanityCheck();
@@ -422,7 +549,7 @@ namespace bertini{
 				template<typename ComplexType, typename RealType, typename Derived>
 				SuccessCode Predict(Vec<ComplexType> & next_space,
 									System const& S,
-									const Eigen::MatrixBase<Derived>& current_space, ComplexType current_time,
+									const Eigen::MatrixBase<Derived>& current_space, ComplexType const& current_time,
 									ComplexType const& delta_t,
 									RealType & condition_number_estimate,
 									unsigned & num_steps_since_last_condition_number_computation,
@@ -465,7 +592,7 @@ namespace bertini{
 									RealType & norm_J,
 									RealType & norm_J_inverse,
 									System const& S,
-									const Eigen::MatrixBase<Derived>& current_space, ComplexType current_time,
+									const Eigen::MatrixBase<Derived>& current_space, ComplexType const& current_time,
 									ComplexType const& delta_t,
 									RealType & condition_number_estimate,
 									unsigned & num_steps_since_last_condition_number_computation,
@@ -485,14 +612,11 @@ namespace bertini{
 						return success_code;
 					
 					// Calculate condition number and updated if needed
-					Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
+					PartialPivotLU<ComplexType>& LUref = std::get< PartialPivotLU<ComplexType> >(LU_0_);
 					Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
 					
-					Vec<ComplexType> randy = RandomOfUnits<ComplexType>(S.NumVariables());
-					Vec<ComplexType> temp_soln = LUref.solve(randy);
-					
-					norm_J = dhdxref.norm();
-					norm_J_inverse = temp_soln.norm();
+					FrobeniusNorm(norm_J, dhdxref);
+					norm_J_inverse = std::get< NormInverseEstimator<ComplexType> >(norm_J_inverse_estimator_).Estimate(LUref, AMP_config.norm_J_inverse_estimate, AMP_config.norm_J_inverse_reuse_steps);
 					
 					if (num_steps_since_last_condition_number_computation >= frequency_of_CN_estimation)
 					{
@@ -549,7 +673,7 @@ namespace bertini{
 									RealType & norm_J,
 									RealType & norm_J_inverse,
 									System const& S,
-									const Eigen::MatrixBase<Derived>& current_space, ComplexType current_time,
+									const Eigen::MatrixBase<Derived>& current_space, ComplexType const& current_time,
 									ComplexType const& delta_t,
 									RealType & condition_number_estimate,
 									unsigned & num_steps_since_last_condition_number_computation,
@@ -614,6 +738,36 @@ namespace bertini{
 					return p_;
 				}
 				
+				/**
+				\brief Set the order of the Taylor predictor, Predictor::Taylor.  4 by default, which predict::Order reports.
+
+				\throws std::runtime_error if the order is 0.
+				*/
+				void TaylorOrder(unsigned order)
+				{
+					if (order==0)
+						throw std::runtime_error("the order of the Taylor predictor must be at least 1");
+					taylor_order_ = order;
+					if (predictor_==Predictor::Taylor)
+						p_ = order;
+				}
+
+				/**
+				\brief Get the order of the Taylor predictor.
+				*/
+				unsigned TaylorOrder() const
+				{
+					return taylor_order_;
+				}
+
+				/**
+				\brief Get the number of stages of the currently used prediction method, each of which evaluates the system and its Jacobian.
+				*/
+				unsigned NumStages() const
+				{
+					return s_;
+				}
+
 				/**
 				\brief Get whether the current prediction method provides an error estimate.
 
@@ -623,6 +777,18 @@ namespace bertini{
 				{
 					return predict::HasErrorEstimate(predictor_);
 				}
+
+				/**
+				\brief The longest step the current method trusts from the point of the last prediction, or infinity if it sets no bound.
+
+				For the Pad\'e and Taylor methods, the distance from the point to the nearest singularity of the path, estimated from the ratios of its Taylor coefficients there.  Near a pole this is short even when the error estimate of a step is small, so trackers keep the step size within it.
+				*/
+				double TrustRegion() const
+				{
+					if (predictor_==Predictor::Pade || predictor_==Predictor::Taylor)
+						return trust_region_;
+					return std::numeric_limits<double>::infinity();
+				}
 				
 				
 				
@@ -636,24 +802,6 @@ namespace bertini{
 				//
 				////////////////////
 				
-				template <typename T>
-				Eigen::PartialPivLU<Mat<T>>& GetLU()
-				{
-					return LUSelector<T>::Run(*this);
-				}
-
-
-				Eigen::PartialPivLU<Mat<dbl>>& GetLU_d()
-				{
-					return LU_d_;
-				}
-
-				Eigen::PartialPivLU<Mat<mpfr>>& GetLU_mp()
-				{
-					assert(current_precision_==DefaultPrecision());
-					return LU_mp_[current_precision_];
-				}
-
 				/**
 				 \brief Performs a full prediction step from current_time to current_time + delta_t
 				 
@@ -673,45 +821,478 @@ namespace bertini{
 									 ComplexType const& delta_t)
 				{
 					static_assert(std::is_same<typename Derived::Scalar, ComplexType>::value, "scalar types must match");
+
+					if (predictor_==Predictor::Pade)
+						return PadeStep<ComplexType, RealType>(next_space, S, current_space, current_time, delta_t);
+					if (predictor_==Predictor::Taylor)
+						return TaylorStep<ComplexType, RealType>(next_space, S, current_space, current_time, delta_t);
 					
 					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
 					Mat<RealType>& aref = std::get< Mat<RealType> >(a_);
 					Vec<RealType>& bref = std::get< Vec<RealType> >(b_);
 					Vec<RealType>& cref = std::get< Vec<RealType> >(c_);
-					Kref.fill(ComplexType(0));
-					Vec<ComplexType> temp(S.NumTotalFunctions());
+					Vec<ComplexType>& stage_space = std::get< Vec<ComplexType> >(stage_space_);
+					ComplexType& stage_time = std::get< ComplexType >(stage_time_);
 					
 					if(EvalRHS(S, current_space, current_time, Kref, 0) != SuccessCode::Success)
 					{
 						return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 					}
+					KeepStage(Kref, 0);
+
+					if (predictor_==Predictor::Hermite)
+					{
+						extrapolated_ = RecordHistory(S, current_space, current_time, Kref.col(0), delta_t);
+						if (extrapolated_)
+							return HermiteStep<ComplexType, RealType>(next_space, delta_t);
+					}
 					
 					for(int ii = 1; ii < s_; ++ii)
 					{
-						temp.setZero();
-						for(int jj = 0; jj < ii; ++jj)
-						{
-							temp += aref(ii,jj)*Kref.col(jj);
-							
-						}
+						CombineStages(stage_space, current_space, delta_t, aref.row(ii), stage_terms_[ii]);
+						StageTime(stage_time, current_time, cref(ii), delta_t);
 						
-						if(EvalRHS(S, current_space + delta_t*temp, current_time + cref(ii)*delta_t, Kref, ii) != SuccessCode::Success)
+						if(EvalRHS(S, stage_space, stage_time, Kref, ii) != SuccessCode::Success)
 						{
 							return SuccessCode::MatrixSolveFailure;
 						}
+						KeepStage(Kref, ii);
 					}
 					
+					CombineStages(next_space, current_space, delta_t, bref, step_terms_);
 					
-					temp.setZero();
-					for(int ii = 0; ii < s_; ++ii)
+					return SuccessCode::Success;
+				};
+
+
+				/**
+				\brief A step by the Pad\'e approximant of the path, from its Taylor coefficients at the current point.
+
+				With \f$x(s)\f$ the path at time current_time + s, its Taylor coefficients \f$x_0,\ldots,x_4\f$ are found in turn.  \f$x_0\f$ is the point and \f$x_1\f$ the tangent, the first stage.  For \f$k \geq 2\f$, with \f$p_{k-1}\f$ the Taylor polynomial through \f$x_{k-1}\f$, the coefficient of \f$s^k\f$ of \f$H(x(s), t+s) = 0\f$ gives
+				\f[ J x_k = -[s^k]\, H(p_{k-1}(s), t+s), \f]
+				solved with the factorization of the Jacobian \f$J\f$ of the first stage, so a step factors one Jacobian.  The right side is taken by sampling \f$H\f$ on a circle about the current time, see TaylorResidualCoefficient, so it takes evaluations of the functions alone, not of their derivatives.
+
+				Each coordinate is then predicted by its [2/1] approximant,
+				\f[ x_0 + x_1 s + \frac{x_2 s^2}{1 - (x_3/x_2) s}, \f]
+				which matches the Taylor series through \f$s^3\f$, and has a pole where the path has one.  Its error is \f$(x_4 - x_3^2/x_2) s^4\f$ to leading order, which is the error estimate.  A coordinate whose approximant has its pole within the step, as when \f$x_2\f$ vanishes, is predicted by its Taylor polynomial instead, with error \f$x_4 s^4\f$.
+
+				The trust region is the lesser of \f$\|x_2\|/\|x_3\|\f$ and \f$\|x_3\|/\|x_4\|\f$, estimates of the radius of convergence of the series.
+				*/
+				template<typename ComplexType, typename RealType, typename Derived>
+				SuccessCode PadeStep(Vec<ComplexType> & next_space,
+									System const& S,
+									Eigen::MatrixBase<Derived> const& current_space, ComplexType const& current_time,
+									ComplexType const& delta_t)
+				{
+					using std::abs;
+
+					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
+					if(EvalRHS(S, current_space, current_time, Kref, 0) != SuccessCode::Success)
 					{
-						temp += bref(ii)*Kref.col(ii);
+						return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 					}
-										
-					next_space = current_space + delta_t*temp;
-					
+					KeepStage(Kref, 0);
+
+					const auto n = current_space.size();
+					Mat<ComplexType>& X = std::get< Mat<ComplexType> >(taylor_);
+					X.resize(n, 5);
+					X.col(0) = current_space;
+					X.col(1) = Kref.col(0);
+
+					// the circle must lie inside the disc of convergence, which the step is kept within
+					const RealType radius = RealType(abs(delta_t))/2;
+
+					PartialPivotLU<ComplexType>& LUref = std::get< PartialPivotLU<ComplexType> >(LU_0_);
+					Vec<ComplexType>& coefficient = std::get< Vec<ComplexType> >(pade_sum_);
+					for (unsigned k = 2; k <= 4; ++k)
+					{
+						TaylorResidualCoefficient(coefficient, S, X, current_time, radius, k);
+						BERTINI_TIME_PHASE(profile_, LinearSolve, current_precision_);
+						LUref.SolveNegative(X.col(k), coefficient);
+					}
+
+					// reuse the coefficient for the error of each coordinate
+					Vec<ComplexType>& error = coefficient;
+					next_space.resize(n);
+					for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+					{
+						ComplexType const& x2 = X(ii,2);
+						ComplexType const& x3 = X(ii,3);
+						if (abs(x3*delta_t) < abs(x2))
+						{
+							next_space(ii) = X(ii,0) + delta_t*(X(ii,1) + delta_t*x2*x2/(x2 - x3*delta_t));
+							error(ii) = X(ii,4) - x3*x3/x2;
+						}
+						else
+						{
+							next_space(ii) = X(ii,0) + delta_t*(X(ii,1) + delta_t*(x2 + delta_t*x3));
+							error(ii) = X(ii,4);
+						}
+					}
+					std::get< RealType >(series_error_) = error.norm();
+
+					const RealType norm_2 = X.col(2).norm(), norm_3 = X.col(3).norm(), norm_4 = X.col(4).norm();
+					trust_region_ = std::numeric_limits<double>::infinity();
+					if (norm_3 > 0)
+						trust_region_ = static_cast<double>(RealType(norm_2/norm_3));
+					if (norm_4 > 0)
+						trust_region_ = std::min(trust_region_, static_cast<double>(RealType(norm_3/norm_4)));
+
 					return SuccessCode::Success;
-				};
+				}
+
+
+				/**
+				\brief A step by the Taylor polynomial of the path, of the order of the method, from coefficients computed by Taylor arithmetic on the system.
+
+				The coefficients \f$x_0,\ldots,x_{p+1}\f$ of the path at time current_time + s are found in turn.  \f$x_0\f$ is the point and \f$x_1\f$ the tangent, the first stage.  For \f$k \geq 2\f$, with \f$p_{k-1}\f$ the Taylor polynomial through \f$x_{k-1}\f$, the coefficient of \f$s^k\f$ of \f$H(x(s), t+s) = 0\f$ gives
+				\f[ J x_k = -[s^k]\, H(p_{k-1}(s), t+s), \f]
+				whose right side is computed exactly, by truncated Taylor arithmetic, see System::TaylorCoefficientsInPlace.  Every solve reuses the factorization of the Jacobian \f$J\f$ of the first stage, so a step factors one matrix however high its order, where an explicit Runge-Kutta method factors one per stage.
+
+				The prediction is the polynomial through \f$x_p\f$, and the error estimate \f$\|x_{p+1}\| |\Delta t|^{p+1}\f$.  The trust region is \f$\|x_p\|/\|x_{p+1}\|\f$, an estimate of the radius of convergence of the series.
+				*/
+				template<typename ComplexType, typename RealType, typename Derived>
+				SuccessCode TaylorStep(Vec<ComplexType> & next_space,
+									System const& S,
+									Eigen::MatrixBase<Derived> const& current_space, ComplexType const& current_time,
+									ComplexType const& delta_t)
+				{
+					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
+					if(EvalRHS(S, current_space, current_time, Kref, 0) != SuccessCode::Success)
+					{
+						return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
+					}
+					KeepStage(Kref, 0);
+
+					const unsigned num_coefficients = p_ + 2;
+					Mat<ComplexType>& X = std::get< Mat<ComplexType> >(taylor_);
+					X.resize(current_space.size(), num_coefficients);
+					X.col(0) = current_space;
+					X.col(1) = Kref.col(0);
+
+					PartialPivotLU<ComplexType>& LUref = std::get< PartialPivotLU<ComplexType> >(LU_0_);
+					Mat<ComplexType>& residual = std::get< Mat<ComplexType> >(taylor_residual_);
+					for (unsigned k = 2; k < num_coefficients; ++k)
+					{
+						X.col(k).setZero();
+						++num_evaluations_;
+						{
+							BERTINI_TIME_PHASE(profile_, SystemEvaluation, current_precision_);
+							S.TaylorCoefficientsInPlace(residual, X.leftCols(k+1), current_time);
+						}
+						BERTINI_TIME_PHASE(profile_, LinearSolve, current_precision_);
+						LUref.SolveNegative(X.col(k), residual.col(k));
+					}
+
+					next_space = X.col(p_);
+					for (int k = static_cast<int>(p_)-1; k >= 0; --k)
+						next_space = next_space*delta_t + X.col(k);
+
+					const RealType norm_p = X.col(p_).norm();
+					std::get< RealType >(series_error_) = X.col(p_+1).norm();
+					trust_region_ = std::numeric_limits<double>::infinity();
+					if (std::get< RealType >(series_error_) > 0)
+						trust_region_ = static_cast<double>(RealType(norm_p/std::get< RealType >(series_error_)));
+
+					return SuccessCode::Success;
+				}
+
+
+				/**
+				\brief Keep the point at which a prediction starts, with the tangent there, as the latest of the history of the path for Predictor::Hermite, and say whether it extrapolates to the step.
+
+				A prediction starting where the last one did, as after a rejected step, adds nothing.  The history extrapolates if it has HermitePoints points on the same system, at distinct times, and the step is no longer than HermiteMaxStepRatio times the interval between the latest two, beyond which the extrapolation is not trusted, so that a step grown faster than that is taken by Runge-Kutta.
+				*/
+				template<typename ComplexType, typename Derived, typename TangentType>
+				bool RecordHistory(System const& S, Eigen::MatrixBase<Derived> const& space, ComplexType const& time, TangentType const& tangent, ComplexType const& delta_t)
+				{
+					using std::abs;
+
+					auto& h = std::get< PathHistory<ComplexType> >(history_);
+					if (h.system!=&S || (h.size>0 && h.points[0].size()!=space.size()))
+					{
+						h.Clear();
+						h.system = &S;
+					}
+
+					if (h.size==0 || h.times[h.size-1]!=time)
+					{
+						if (h.size==HermitePoints)
+						{
+							std::rotate(h.times.begin(), h.times.begin()+1, h.times.end());
+							std::rotate(h.points.begin(), h.points.begin()+1, h.points.end());
+							std::rotate(h.tangents.begin(), h.tangents.begin()+1, h.tangents.end());
+						}
+						else
+							++h.size;
+						h.times[h.size-1] = time;
+						h.points[h.size-1] = space;
+						h.tangents[h.size-1] = tangent;
+					}
+
+					if (h.size<HermitePoints)
+						return false;
+					if (h.times[0]==h.times[1] || h.times[0]==h.times[2])
+						return false;
+					return abs(delta_t) <= HermiteMaxStepRatio*abs(h.times[2]-h.times[1]);
+				}
+
+
+				/**
+				\brief A step by extrapolating the history of the path, its points and tangents at the starts of the last predictions, for Predictor::Hermite.
+
+				With \f$t_0,t_1,t_2\f$ the times of the history, \f$t_2\f$ the current time, the divided differences \f$c_0,\ldots,c_5\f$ of the path on the nodes \f$t_2,t_2,t_1,t_1,t_0,t_0\f$ are found from the points, the repeated nodes taking the tangents.  In this Newton form the prediction at \f$t_2 + s\f$ is the cubic Hermite interpolant of the latest two points and tangents,
+				\f[ c_0 + s(c_1 + s(c_2 + (s+h)c_3)), \qquad h = t_2 - t_1, \f]
+				and the error estimate is its difference from the quintic interpolating all three,
+				\f[ s^2(s+h)^2(c_4 + (s + t_2 - t_0)c_5). \f]
+				The tangent at the current point, the first stage, is the only one computed, so a step evaluates and factors the Jacobian once, where the Runge-Kutta methods do so at every stage.
+				*/
+				template<typename ComplexType, typename RealType>
+				SuccessCode HermiteStep(Vec<ComplexType> & next_space, ComplexType const& delta_t)
+				{
+					static_assert(HermitePoints==3, "the prediction and error of HermiteStep are written out for three points");
+
+					auto const& h = std::get< PathHistory<ComplexType> >(history_);
+					constexpr unsigned num_nodes = 2*HermitePoints;
+
+					Mat<ComplexType>& D = std::get< Mat<ComplexType> >(taylor_);
+					D.resize(h.points[0].size(), num_nodes);
+					std::array<ComplexType, num_nodes> z;
+					for (unsigned ii = 0; ii < HermitePoints; ++ii)
+					{
+						const unsigned from = HermitePoints-1-ii;
+						z[2*ii] = h.times[from];
+						z[2*ii+1] = h.times[from];
+						D.col(2*ii) = h.points[from];
+						D.col(2*ii+1) = h.points[from];
+					}
+
+					// the divided differences, in place, from the last column up, so that column k ends as c_k
+					for (unsigned k = 1; k < num_nodes; ++k)
+						for (unsigned ii = num_nodes-1; ii >= k; --ii)
+						{
+							if (k==1 && ii%2==1)
+								D.col(ii) = h.tangents[HermitePoints-1-ii/2];
+							else
+								D.col(ii) = (D.col(ii) - D.col(ii-1))/(z[ii] - z[ii-k]);
+						}
+
+					const ComplexType s_plus_h = delta_t + (z[0] - z[2]);
+					next_space = D.col(0) + delta_t*(D.col(1) + delta_t*(D.col(2) + s_plus_h*D.col(3)));
+
+					const ComplexType scale = (delta_t*s_plus_h)*(delta_t*s_plus_h);
+					Vec<ComplexType>& error = std::get< Vec<ComplexType> >(pade_sum_);
+					error = scale*(D.col(4) + (delta_t + (z[0] - z[4]))*D.col(5));
+					std::get< RealType >(series_error_) = error.norm();
+
+					return SuccessCode::Success;
+				}
+
+
+				/**
+				\brief coefficient = the coefficient of \f$s^k\f$ of \f$H(p(s), t+s)\f$, with \f$p(s) = \sum_{i<k} X_i s^i\f$ from the columns of X.
+
+				By the trapezoid rule for Cauchy's integral on the circle of the given radius about \f$s=0\f$, at PadeSamples points \f$r\omega^j\f$, with \f$\omega\f$ a primitive root of unity,
+				\f[ [s^k] g \approx \frac{1}{N r^k} \sum_j g(r\omega^j)\, \omega^{-jk}. \f]
+				This is exact but for the coefficients of \f$s^{k+N}, s^{k+2N}, \ldots\f$, which are scaled by \f$r^N\f$ and smaller.  \f$\omega^{-jk}\f$ is itself a root, so no powers are taken.
+				*/
+				template<typename ComplexType, typename RealType>
+				void TaylorResidualCoefficient(Vec<ComplexType> & coefficient, System const& S, Mat<ComplexType> const& X,
+									ComplexType const& time, RealType const& radius, unsigned k)
+				{
+					using std::pow;
+
+					Vec<ComplexType>& point = std::get< Vec<ComplexType> >(stage_space_);
+					Vec<ComplexType>& values = std::get< Vec<ComplexType> >(pade_values_);
+					ComplexType& sample_time = std::get< ComplexType >(stage_time_);
+					Vec<ComplexType> const& nodes = std::get< Vec<ComplexType> >(pade_nodes_);
+
+					values.resize(numTotalFunctions_);
+					coefficient.setZero(numTotalFunctions_);
+					for (unsigned jj = 0; jj < PadeSamples; ++jj)
+					{
+						const ComplexType s = radius*nodes(jj);
+						point = X.col(k-1);
+						for (int ii = static_cast<int>(k)-2; ii >= 0; --ii)
+							point = point*s + X.col(ii);
+						sample_time = time + s;
+
+						++num_evaluations_;
+						{
+							BERTINI_TIME_PHASE(profile_, SystemEvaluation, current_precision_);
+							S.EvalInPlace(values, point, sample_time);
+						}
+						coefficient += values*nodes((PadeSamples - (jj*k)%PadeSamples)%PadeSamples);
+					}
+					coefficient /= ComplexType(RealType(PadeSamples)*RealType(pow(radius, k)));
+				}
+
+
+				/**
+				\brief Fill the roots of unity at which TaylorResidualCoefficient samples, at the default precision.
+				*/
+				template<typename ComplexType>
+				void FillPadeNodes()
+				{
+					using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+					using std::acos;
+					using std::exp;
+
+					const RealType two_pi = 2*acos(RealType(-1));
+					Vec<ComplexType>& nodes = std::get< Vec<ComplexType> >(pade_nodes_);
+					nodes.resize(PadeSamples);
+					for (unsigned jj = 0; jj < PadeSamples; ++jj)
+						nodes(jj) = exp(ComplexType(RealType(0), two_pi*RealType(jj)/RealType(PadeSamples)));
+				}
+
+
+				/**
+				\brief Copy a stage, just computed, into the slab copy of the stages, from which they are combined in multiple precision.
+				*/
+				void KeepStage(Mat<dbl> const& K, unsigned stage)
+				{}
+
+				void KeepStage(Mat<mpfr> const& K, unsigned stage)
+				{
+					K_slab_.Resize(K.rows(), K.cols(), current_precision_);
+					slab::Assign(K_slab_.Col(stage), K.col(stage));
+				}
+
+
+				/**
+				\brief time + c delta_t, the time at which a stage is evaluated, into stage_time.
+
+				In multiple precision, by a fused multiply-add per part, into the member kept at the working precision, so without temporaries.
+				*/
+				static void StageTime(dbl & stage_time, dbl const& time, double c, dbl const& delta_t)
+				{
+					stage_time = time + c*delta_t;
+				}
+
+				static void StageTime(mpfr & stage_time, mpfr const& time, mpfr_float const& c, mpfr const& delta_t)
+				{
+					mpfr_fma(stage_time.real_data(), c.backend().data(), delta_t.real_data(), time.real_data(), MPFR_RNDN);
+					mpfr_fma(stage_time.imag_data(), c.backend().data(), delta_t.imag_data(), time.imag_data(), MPFR_RNDN);
+				}
+
+
+				/**
+				\brief next_space = space + delta_t * sum of weights(jj) K.col(jj), over the stages jj in terms.
+
+				The terms are those of the nonzero weights, see FindStageTerms, so the zeros of the Butcher table cost nothing.
+
+				The sum is taken in a member of the predictor, sized with the stages, in double precision by kernels::Axpy.  In multiple precision, it is taken in slab vectors, from the slab copy of the stages, by fused multiply-adds, so allocates nothing once the slabs are at the size and precision of the step.
+				*/
+				template<typename Derived, typename WeightsType>
+				void CombineStages(Vec<dbl> & next_space, Eigen::MatrixBase<Derived> const& space, dbl const& delta_t, WeightsType const& weights, std::vector<unsigned> const& terms)
+				{
+					Mat<dbl>& Kref = std::get< Mat<dbl> >(K_);
+					stage_sum_dbl_.setZero(Kref.rows());
+					for(auto jj : terms)
+						kernels::Axpy(Kref.rows(), dbl(weights(jj)), Kref.col(jj).data(), stage_sum_dbl_.data());
+					next_space = space + delta_t*stage_sum_dbl_;
+				}
+
+				template<typename Derived, typename WeightsType>
+				void CombineStages(Vec<mpfr> & next_space, Eigen::MatrixBase<Derived> const& space, mpfr const& delta_t, WeightsType const& weights, std::vector<unsigned> const& terms)
+				{
+					stage_sum_.Resize(K_slab_.rows(), current_precision_);
+					stage_sum_.SetZero();
+					for(auto jj : terms)
+						slab::Axpy(stage_sum_, weights(jj), K_slab_.Col(jj));
+
+					stage_point_.Resize(space.size(), current_precision_);
+					stage_point_.Assign(space);
+					slab::Axpy(stage_point_, delta_t, stage_sum_);
+					slab::CopyTo(next_space, stage_point_);
+				}
+
+
+				/**
+				\brief norm = the norm of delta_t times the sum of weights(jj) K.col(jj), over the stages of the nonzero differences of the embedded weights.
+				*/
+				template<typename WeightsType>
+				void WeightedStageNorm(double & norm, WeightsType const& weights, dbl const& delta_t)
+				{
+					Mat<dbl>& Kref = std::get< Mat<dbl> >(K_);
+					stage_sum_dbl_.setZero(Kref.rows());
+					for(auto ii : error_terms_)
+						kernels::Axpy(Kref.rows(), dbl(weights(ii)), Kref.col(ii).data(), stage_sum_dbl_.data());
+					norm = abs(delta_t)*stage_sum_dbl_.norm();
+				}
+
+				template<typename WeightsType>
+				void WeightedStageNorm(mpfr_float & norm, WeightsType const& weights, mpfr const& delta_t)
+				{
+					stage_sum_.Resize(K_slab_.rows(), current_precision_);
+					stage_sum_.SetZero();
+					for(auto ii : error_terms_)
+						slab::Axpy(stage_sum_, weights(ii), K_slab_.Col(ii));
+					slab::Norm(norm, stage_sum_);
+					norm *= AbsPower(delta_t, 1);
+				}
+
+
+				/**
+				\brief |delta_t|^power, into a member of the predictor at the working precision, so that in multiple precision it makes no temporaries.
+				*/
+				double const& AbsPower(dbl const& delta_t, unsigned power)
+				{
+					using std::pow;
+					return std::get< double >(step_scale_) = pow(abs(delta_t), power);
+				}
+
+				mpfr_float const& AbsPower(mpfr const& delta_t, unsigned power)
+				{
+					mpfr_ptr scale = std::get< mpfr_float >(step_scale_).backend().data();
+					mpfr_hypot(scale, delta_t.real_data(), delta_t.imag_data(), MPFR_RNDN);
+					if (power!=1)
+						mpfr_pow_ui(scale, scale, power, MPFR_RNDN);
+					return std::get< mpfr_float >(step_scale_);
+				}
+
+
+				/**
+				\brief norm = the Frobenius norm of J.  In multiple precision, by fused multiply-adds into norm, without temporaries.
+				*/
+				static void FrobeniusNorm(double & norm, Mat<dbl> const& J)
+				{
+					norm = J.norm();
+				}
+
+				static void FrobeniusNorm(mpfr_float & norm, Mat<mpfr> const& J)
+				{
+					mpfr_ptr result = norm.backend().data();
+					mpfr_set_zero(result, 1);
+					for (Eigen::DenseIndex jj = 0; jj < J.cols(); ++jj)
+						for (Eigen::DenseIndex ii = 0; ii < J.rows(); ++ii)
+						{
+							mpfr_fma(result, J(ii,jj).real_data(), J(ii,jj).real_data(), result, MPFR_RNDN);
+							mpfr_fma(result, J(ii,jj).imag_data(), J(ii,jj).imag_data(), result, MPFR_RNDN);
+						}
+					mpfr_sqrt(result, result, MPFR_RNDN);
+				}
+
+
+				/**
+				\brief norm = the largest magnitude of an entry of any stage.
+				*/
+				void LargestStageEntry(double & norm)
+				{
+					norm = std::get< Mat<dbl> >(K_).array().abs().maxCoeff();
+				}
+
+				void LargestStageEntry(mpfr_float & norm)
+				{
+					mpfr_float& column = std::get< mpfr_float >(step_scale_);
+					mpfr_set_zero(norm.backend().data(), 1);
+					for (int ii = 0; ii < s_; ++ii)
+					{
+						slab::InfinityNorm(column, K_slab_.Col(ii));
+						if (column > norm)
+							mpfr_set(norm.backend().data(), column.backend().data(), MPFR_RNDN);
+					}
+				}
 
 				
 				
@@ -730,21 +1311,20 @@ namespace bertini{
 				template<typename ComplexType, typename RealType>
 				SuccessCode SetErrorEstimate(RealType & error_estimate, ComplexType const& delta_t)
 				{
-					Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
-					Vec<RealType>& b_minus_bstar_ref = std::get< Vec<RealType> >(b_minus_bstar_);
-					
-					auto numFuncs = Kref.rows();
-					Vec<ComplexType> err(numFuncs);
-					
-					err.setZero();
-					for(int ii = 0; ii < s_; ++ii)
+					if (predictor_==Predictor::Pade || predictor_==Predictor::Taylor)
 					{
-						err += (b_minus_bstar_ref(ii))*Kref.col(ii);
+						error_estimate = std::get< RealType >(series_error_)*AbsPower(delta_t, p_+1);
+						return SuccessCode::Success;
 					}
+					if (predictor_==Predictor::Hermite && extrapolated_)
+					{
+						error_estimate = std::get< RealType >(series_error_);
+						return SuccessCode::Success;
+					}
+
+					Vec<RealType>& b_minus_bstar_ref = std::get< Vec<RealType> >(b_minus_bstar_);
 					
-					err *= delta_t;
-					
-					error_estimate = err.norm();
+					WeightedStageNorm(error_estimate, b_minus_bstar_ref, delta_t);
 					
 					return SuccessCode::Success;
 				};
@@ -769,19 +1349,14 @@ namespace bertini{
 				{
 					if(predict::HasErrorEstimate(predictor_))
 					{
-						RealType err_est;
-						SetErrorEstimate<ComplexType,RealType>(err_est, delta_t);
-						
-						using std::pow;
-						size_proportion = err_est/(pow(abs(delta_t), p_+1));
-						
+						SetErrorEstimate<ComplexType,RealType>(size_proportion, delta_t);
+						size_proportion /= AbsPower(delta_t, p_+1);
 						return SuccessCode::Success;
 					}
 					else
 					{
-						Mat<ComplexType>& Kref = std::get< Mat<ComplexType> >(K_);
-						using std::pow;
-						size_proportion = Kref.array().abs().maxCoeff()/(pow(abs(delta_t), p_));
+						LargestStageEntry(size_proportion);
+						size_proportion /= AbsPower(delta_t, p_);
 						return SuccessCode::Success;
 					}
 				};
@@ -811,7 +1386,7 @@ namespace bertini{
 
 					if(stage == 0)
 					{
-						Eigen::PartialPivLU<Mat<ComplexType>>& LUref = GetLU<ComplexType>();
+						PartialPivotLU<ComplexType>& LUref = std::get< PartialPivotLU<ComplexType> >(LU_0_);
 						Mat<ComplexType>& dhdxref = std::get< Mat<ComplexType> >(dh_dx_0_);
 
 						if (!std::is_same<ComplexType,dbl>::value)
@@ -824,25 +1399,38 @@ namespace bertini{
 							assert(Precision(K)==current_precision_);
 						}
 
-						S.JacobianInPlace(dhdxref, space, time);
-						LUref = dhdxref.lu();
+						// after a rejected step, the next prediction starts from the same point, where the Jacobian, its factorization, and the first stage are already known
+						auto& kept = std::get< StageZero<ComplexType> >(stage_0_);
+						if (kept.system==&S && kept.time==time && kept.space.size()==space.size() && kept.space==space)
+						{
+							K.col(stage) = kept.k;
+							return SuccessCode::Success;
+						}
+						kept.system = nullptr;
+
+						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
+						++num_evaluations_;
+						{
+							BERTINI_TIME_PHASE(profile_, JacobianEvaluation, current_precision_);
+							S.JacobianAndTimeDerivativeInPlace(dhdxref, dhdtref, space, time);
+						}
+						BERTINI_TIME_PHASE(profile_, LinearSolve, current_precision_);
+						LUref.Factor(dhdxref);
 						if (!std::is_same<ComplexType,dbl>::value)
 						{
 							assert(Precision(dhdxref)==current_precision_);
-							if (Precision(LUref.matrixLU())!=current_precision_)
-							{
-								std::cout << Precision(LUref.matrixLU())<< " " << DefaultPrecision() << " " << current_precision_ << '\n';
-								std::cout << LUref.matrixLU() << std::endl;
-							}
-							assert(Precision(LUref.matrixLU())==current_precision_);
+							assert(LUref.FactoredPrecision()==current_precision_);
 						}
 
-						if (LUPartialPivotDecompositionSuccessful(LUref.matrixLU())!=MatrixSuccessCode::Success)
+						if (LUref.DecompositionSuccess()!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 						
-						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
-						S.TimeDerivativeInPlace(dhdtref, space, time);
-						K.col(stage) = LUref.solve(-dhdtref);
+						LUref.SolveNegative(K.col(stage), dhdtref);
+
+						kept.space = space;
+						kept.time = time;
+						kept.k = K.col(stage);
+						kept.system = &S;
 						
 						return SuccessCode::Success;
 						
@@ -850,15 +1438,20 @@ namespace bertini{
 					else
 					{
 						Mat<ComplexType>& dhdxtempref = std::get< Mat<ComplexType> >(dh_dx_temp_);
-						S.JacobianInPlace(dhdxtempref,space, time);
-						auto LU = dhdxtempref.lu();
+						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
+						++num_evaluations_;
+						{
+							BERTINI_TIME_PHASE(profile_, JacobianEvaluation, current_precision_);
+							S.JacobianAndTimeDerivativeInPlace(dhdxtempref, dhdtref, space, time);
+						}
+						PartialPivotLU<ComplexType>& LUref = std::get< PartialPivotLU<ComplexType> >(LU_stage_);
+						BERTINI_TIME_PHASE(profile_, LinearSolve, current_precision_);
+						LUref.Factor(dhdxtempref);
 						
-						if (LUPartialPivotDecompositionSuccessful(LU.matrixLU())!=MatrixSuccessCode::Success)
+						if (LUref.DecompositionSuccess()!=MatrixSuccessCode::Success)
 							return SuccessCode::MatrixSolveFailureFirstPartOfPrediction;
 						
-						Vec<ComplexType>& dhdtref = std::get< Vec<ComplexType> >(dh_dt_temp_);
-						S.TimeDerivativeInPlace(dhdtref, space, time);
-						K.col(stage) = LU.solve(-dhdtref);
+						LUref.SolveNegative(K.col(stage), dhdtref);
 						
 						return SuccessCode::Success;
 					}
@@ -982,6 +1575,67 @@ namespace bertini{
 				
 				
 				
+				/**
+				\brief Record which entries of the Butcher table are nonzero, so the stage combinations skip the rest.
+
+				For each stage, the earlier stages with a nonzero coefficient in its row of a, and the stages of the nonzero weights of b and of b - bstar.  Found from the double table, whose entries are zero exactly when the rational ones are.
+				*/
+				void FindStageTerms()
+				{
+					auto const& a = std::get< Mat<double> >(a_);
+					auto const& b = std::get< Vec<double> >(b_);
+					auto const& b_minus_bstar = std::get< Vec<double> >(b_minus_bstar_);
+
+					stage_terms_.assign(s_, std::vector<unsigned>());
+					step_terms_.clear();
+					error_terms_.clear();
+					for (unsigned ii = 0; ii < s_; ++ii)
+					{
+						for (unsigned jj = 0; jj < ii; ++jj)
+							if (a(ii,jj)!=0)
+								stage_terms_[ii].push_back(jj);
+						if (b(ii)!=0)
+							step_terms_.push_back(ii);
+						if (uses_embedded_ && b_minus_bstar(ii)!=0)
+							error_terms_.push_back(ii);
+					}
+				}
+
+
+				/**
+				\brief Keep the multiple precision Butcher table of the current method, at the current precision, for a later return to it.
+
+				Moves the table into the cache, leaving the members empty.
+				*/
+				void StashButcherTable()
+				{
+					auto& table = butcher_tables_[std::make_pair(predictor_, current_precision_)];
+					std::swap(table.a, std::get< Mat<mpfr_float> >(a_));
+					std::swap(table.b, std::get< Vec<mpfr_float> >(b_));
+					std::swap(table.b_minus_bstar, std::get< Vec<mpfr_float> >(b_minus_bstar_));
+					std::swap(table.c, std::get< Vec<mpfr_float> >(c_));
+				}
+
+				/**
+				\brief Take back the multiple precision Butcher table of the current method at a precision, if kept by StashButcherTable.
+
+				\return Whether there was one.  If not, the table is yet to be filled from the rational one.
+				*/
+				bool RestoreButcherTable(unsigned precision)
+				{
+					auto iter = butcher_tables_.find(std::make_pair(predictor_, precision));
+					if (iter==butcher_tables_.end())
+						return false;
+
+					std::swap(iter->second.a, std::get< Mat<mpfr_float> >(a_));
+					std::swap(iter->second.b, std::get< Vec<mpfr_float> >(b_));
+					std::swap(iter->second.b_minus_bstar, std::get< Vec<mpfr_float> >(b_minus_bstar_));
+					std::swap(iter->second.c, std::get< Vec<mpfr_float> >(c_));
+					butcher_tables_.erase(iter);
+					return true;
+				}
+
+				
 				///////////////////////////
 				//
 				// Private Data Members
@@ -991,15 +1645,78 @@ namespace bertini{
 				unsigned numTotalFunctions_; // Number of total functions for the current system
 				unsigned numVariables_;  // Number of variables for the current system
 				mutable std::tuple< Mat<dbl>, Mat<mpfr> > K_;  // All the stage variables.  Each column represents a different stage.
+				slab::Matrix K_slab_;  // The stages in multiple precision, copied into one slab as they are computed, for combining them.
+				slab::Vector stage_sum_, stage_point_;  // The weighted sum of the stages, and the point it is added to, in multiple precision.
+				Vec<dbl> stage_sum_dbl_;  // The weighted sum of the stages, in double precision.
+				mutable std::tuple< Vec<dbl>, Vec<mpfr> > stage_space_;  // The point at which a stage after the first is evaluated.
+				std::tuple< dbl, mpfr > stage_time_;  // The time at which a stage after the first is evaluated.
+				std::tuple< double, mpfr_float > step_scale_;  // A power of the magnitude of the time step, or the largest entry of a stage, at the working precision.
 				Predictor predictor_;  // Method for prediction
 				unsigned p_;  //Order of the prediction method
 				mutable std::tuple< Mat<dbl>, Mat<mpfr> > dh_dx_0_;  // Jacobian for the initial stage.  Use for AMP testing
 				mutable std::tuple< Mat<dbl>, Mat<mpfr> > dh_dx_temp_;  // Temporary jacobian for all other stages
 				mutable std::tuple< Vec<dbl>, Vec<mpfr> > dh_dt_temp_;  // Temporary time derivative used for all stages
-				// std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_0_;  // LU from the intial stage used for AMP testing
+				mutable std::tuple< PartialPivotLU<dbl>, PartialPivotLU<mpfr> > LU_0_;  // LU from the intial stage used for AMP testing
+				mutable std::tuple< PartialPivotLU<dbl>, PartialPivotLU<mpfr> > LU_stage_;  // LU for all other stages
 
-				mutable Eigen::PartialPivLU<Mat<dbl>> LU_d_;
-				mutable std::map<unsigned,Eigen::PartialPivLU<Mat<mpfr>>> LU_mp_;
+				/**
+				\brief The point at which the first stage was last evaluated, and its value.  dh_dx_0_ and LU_0_ hold the Jacobian there.
+				*/
+				template<typename ComplexType>
+				struct StageZero
+				{
+					System const* system = nullptr; // the system it was evaluated on, or nullptr if nothing is kept
+					Vec<ComplexType> space;
+					ComplexType time;
+					Vec<ComplexType> k;
+				};
+				mutable std::tuple< StageZero<dbl>, StageZero<mpfr> > stage_0_;
+
+				template<typename ComplexType>
+				std::size_t StageZeroBytes() const
+				{
+					auto const& stage = std::get< StageZero<ComplexType> >(stage_0_);
+					return memory::HeapBytes(stage.space) + memory::HeapBytes(stage.time) + memory::HeapBytes(stage.k);
+				}
+
+				// The Hermite method
+				static constexpr unsigned HermitePoints = 3; // The number of points of the history of the path extrapolated
+				static constexpr unsigned HermiteMaxStepRatio = 2; // The longest step extrapolated, relative to the last interval of the history
+
+				/**
+				\brief The points of the path at which the last predictions started, and the tangents there, the latest last, for Predictor::Hermite.
+				*/
+				template<typename ComplexType>
+				struct PathHistory
+				{
+					System const* system = nullptr; // the system the path is on, or nullptr if nothing is kept
+					unsigned size = 0; // the number of points kept
+					std::array<ComplexType, HermitePoints> times;
+					std::array<Vec<ComplexType>, HermitePoints> points;
+					std::array<Vec<ComplexType>, HermitePoints> tangents;
+
+					void Clear()
+					{
+						system = nullptr;
+						size = 0;
+					}
+				};
+				mutable std::tuple< PathHistory<dbl>, PathHistory<mpfr> > history_;
+				bool extrapolated_ = false; // Whether the last step of Predictor::Hermite extrapolated its history, rather than falling back to Runge-Kutta
+
+				template<typename ComplexType>
+				std::size_t HistoryBytes() const
+				{
+					auto const& h = std::get< PathHistory<ComplexType> >(history_);
+					std::size_t bytes = 0;
+					for (unsigned ii = 0; ii < HermitePoints; ++ii)
+						bytes += memory::HeapBytes(h.times[ii]) + memory::HeapBytes(h.points[ii]) + memory::HeapBytes(h.tangents[ii]);
+					return bytes;
+				}
+
+				std::tuple< NormInverseEstimator<dbl>, NormInverseEstimator<mpfr> > norm_J_inverse_estimator_; // Estimates the norm of the inverse of the Jacobian from LU_0_
+				instrument::Profile* profile_ = nullptr; // The profile of the owning tracker, if any
+				mutable std::uint64_t num_evaluations_ = 0; // see NumEvaluations
 				
 				
 				// Butcher Table (notation from https://en.wikipedia.org/wiki/List_of_Runge%E2%80%93Kutta_methods)
@@ -1010,7 +1727,31 @@ namespace bertini{
 				mutable std::tuple< Vec<double>, Vec<mpfr_float> > c_;
 				
 				mutable bool uses_embedded_;
+
+				std::vector< std::vector<unsigned> > stage_terms_; // For each stage, the earlier stages of the nonzero entries of its row of a
+				std::vector<unsigned> step_terms_; // The stages of the nonzero entries of b
+				std::vector<unsigned> error_terms_; // The stages of the nonzero entries of b - bstar, if embedded
+
+				struct MPButcherTable
+				{
+					Mat<mpfr_float> a;
+					Vec<mpfr_float> b;
+					Vec<mpfr_float> b_minus_bstar;
+					Vec<mpfr_float> c;
+				};
+				std::map< std::pair<Predictor, unsigned>, MPButcherTable > butcher_tables_; // The multiple precision tables of the precisions left, by method and precision
 				mutable unsigned current_precision_;
+
+				// The Pade and Taylor methods
+				static constexpr unsigned PadeSamples = 8; // The number of points on the circle at which a Taylor coefficient is sampled
+				unsigned taylor_order_ = 4;  // The order of the Taylor method
+				std::tuple< Mat<dbl>, Mat<mpfr> > taylor_;  // The Taylor coefficients of the path at the start of the step, by columns
+				std::tuple< Mat<dbl>, Mat<mpfr> > taylor_residual_;  // The Taylor coefficients of the functions along a truncation of the path
+				std::tuple< Vec<dbl>, Vec<mpfr> > pade_nodes_;  // The roots of unity of order PadeSamples
+				std::tuple< Vec<dbl>, Vec<mpfr> > pade_values_;  // The functions at a sample point
+				std::tuple< Vec<dbl>, Vec<mpfr> > pade_sum_;  // A Taylor coefficient of the residual, then the error of each coordinate
+				std::tuple< double, mpfr_float > series_error_;  // The norm of the error of the last step, per power p+1 of the step size
+				double trust_region_ = std::numeric_limits<double>::infinity();  // The trust region of the last step
 				
 				
 				
@@ -99,6 +99,18 @@ namespace bertini{
 			}
 
 
+			/**
+			\brief Set the new end time, keeping the current time, point and step size, for continuing the current path.
+
+			\param end_time The time to which to track.
+			*/
+			SuccessCode TrackerLoopContinuation(CT const& end_time) const override
+			{
+				this->endtime_ = end_time;
+				return SuccessCode::Success;
+			}
+
+
 			/**
 			\brief Ensure that number of steps, stepsize, and precision still ok.
 
@@ -125,7 +137,13 @@ namespace bertini{
 
 			void PostTrackCleanup() const override
 			{
-				this->NotifyObservers(TrackingEnded<EmitterType>(*this));
+				this->template NotifyObservers<TrackingEnded<EmitterType>>(*this);
+				limb_pool::ReleaseThreadCache();
+			}
+
+			double LatestConditionNumber() const override
+			{
+				return static_cast<double>(std::get<RT>(this->condition_number_estimate_));
 			}
 
 			/**
@@ -165,7 +183,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
-				this->NotifyObservers(NewStep<EmitterType >(*this));
+				this->template NotifyObservers<NewStep<EmitterType>>(*this);
 
 				Vec<CT>& predicted_space = std::get<Vec<CT> >(this->temporary_space_); // this will be populated in the Predict step
 				Vec<CT>& current_space = std::get<Vec<CT> >(this->current_space_); // the thing we ultimately wish to update
@@ -176,7 +194,7 @@ namespace bertini{
 
 				if (predictor_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(FirstStepPredictorMatrixSolveFailure<EmitterType >(*this));
+					this->template NotifyObservers<FirstStepPredictorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = this->stepping_config_.step_size_fail_factor*this->current_stepsize_;
 
@@ -185,7 +203,7 @@ namespace bertini{
 					return predictor_code;
 				}
 
-				this->NotifyObservers(SuccessfulPredict<EmitterType , CT>(*this, predicted_space));
+				this->template NotifyObservers<SuccessfulPredict<EmitterType, CT>>(*this, predicted_space);
 
 				Vec<CT>& tentative_next_space = std::get<Vec<CT> >(this->tentative_space_); // this will be populated in the Correct step
 
@@ -202,7 +220,7 @@ namespace bertini{
 				}
 				else if (corrector_code!=SuccessCode::Success)
 				{
-					this->NotifyObservers(CorrectorMatrixSolveFailure<EmitterType >(*this));
+					this->template NotifyObservers<CorrectorMatrixSolveFailure<EmitterType>>(*this);
 
 					this->next_stepsize_ = this->stepping_config_.step_size_fail_factor*this->current_stepsize_;
 					UpdateStepsize();
@@ -211,7 +229,7 @@ namespace bertini{
 				}
 
 				
-				this->NotifyObservers(SuccessfulCorrect<EmitterType , CT>(*this, tentative_next_space));
+				this->template NotifyObservers<SuccessfulCorrect<EmitterType, CT>>(*this, tentative_next_space);
 
 				// copy the tentative vector into the current space vector;
 				current_space = tentative_next_space;
@@ -256,7 +274,7 @@ namespace bertini{
 			void OnStepSuccess() const override
 			{
 				Base::IncrementBaseCountersSuccess();
-				this->NotifyObservers(SuccessfulStep<EmitterType >(*this));
+				this->template NotifyObservers<SuccessfulStep<EmitterType>>(*this);
 			}
 
 			/**
@@ -266,14 +284,14 @@ namespace bertini{
 			{
 				Base::IncrementBaseCountersFail();
 				this->num_successful_steps_since_stepsize_increase_ = 0;
-				this->NotifyObservers(FailedStep<EmitterType >(*this));
+				this->template NotifyObservers<FailedStep<EmitterType>>(*this);
 			}
 
 
 
 			void OnInfiniteTruncation() const override
 			{
-				this->NotifyObservers(InfinitePathTruncation<EmitterType>(*this));
+				this->template NotifyObservers<InfinitePathTruncation<EmitterType>>(*this);
 			}
 
 			//////////////
@@ -307,6 +325,7 @@ namespace bertini{
 				RT& error_estimate = std::get<RT>(this->error_estimate_);
 				RT& condition_number_estimate = std::get<RT>(this->condition_number_estimate_);
 
+				BERTINI_TIME_PHASE(this->profile_, Predict, this->CurrentPrecision());
 				return this->predictor_->Predict(
 			                predicted_space,
 							this->tracked_system_,
@@ -346,6 +365,7 @@ namespace bertini{
 				RT& condition_number_estimate = std::get<RT>(this->condition_number_estimate_);
 
 
+				BERTINI_TIME_PHASE(this->profile_, Correct, this->CurrentPrecision());
 				return this->corrector_->Correct(corrected_space,
 												this->tracked_system_,
 												current_space,
@@ -376,6 +396,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
+				BERTINI_TIME_PHASE(this->profile_, Correct, this->CurrentPrecision());
 				return this->corrector_->Correct(new_space,
 							   this->tracked_system_,
 							   start_point,
@@ -412,6 +433,7 @@ namespace bertini{
 			              				typename Eigen::NumTraits<CT>::Real>::value,
 			              				"underlying complex type and the type for comparisons must match");
 
+				BERTINI_TIME_PHASE(this->profile_, Correct, this->CurrentPrecision());
 				return this->corrector_->Correct(new_space,
 							   this->tracked_system_,
 							   start_point,
@@ -479,7 +501,7 @@ namespace bertini{
 			                               BaseComplexType const& end_time,
 										   Vec<BaseComplexType> const& start_point) const override
 			{
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template NotifyObservers<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -529,6 +551,14 @@ namespace bertini{
 				return precision_;
 			}
 
+			void ResumeTracking() const override
+			{
+				if (DefaultPrecision()!=precision_)
+					DefaultPrecision(precision_);
+				if (tracked_system_.precision()!=precision_)
+					tracked_system_.precision(precision_);
+			}
+
 
 			/**
 			\brief Set up the internals of the tracker for a fresh start.  
@@ -566,7 +596,7 @@ namespace bertini{
 				}
 
 
-				this->NotifyObservers(Initializing<EmitterType,BaseComplexType>(*this,start_time, end_time, start_point));
+				this->template NotifyObservers<Initializing<EmitterType,BaseComplexType>>(*this,start_time, end_time, start_point);
 
 				// set up the master current time and the current step size
 				this->current_time_ = start_time;
@@ -0,0 +1,191 @@
+//This file is part of Bertini 2.
+//
+//hybrid_endgame.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//hybrid_endgame.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with hybrid_endgame.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file hybrid_endgame.hpp
+
+\brief Choose the endgame per path: the power series endgame, and the Cauchy endgame only where it does not converge.
+
+The power series endgame is the cheaper of the two for the endpoints of low cycle number, which are most of them, needing only a few samples on the path, where the Cauchy endgame tracks around loops of many.  It falters where the cycle number is high, or its estimate of it is unstable, and its approximations stop improving.  HybridEndgame runs the power series endgame with limits on those, config::HybridEndgame, and when it reaches one, or fails otherwise short of the path going to infinity, runs the Cauchy endgame from the newest sample it took, nearest the origin, so the tracking done is not repeated.
+*/
+
+#ifndef BERTINI_TRACKING_HYBRID_ENDGAME_HPP
+#define BERTINI_TRACKING_HYBRID_ENDGAME_HPP
+
+#include "bertini2/tracking/fixed_prec_powerseries_endgame.hpp"
+#include "bertini2/tracking/fixed_prec_cauchy_endgame.hpp"
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "bertini2/tracking/amp_cauchy_endgame.hpp"
+
+namespace bertini{
+	namespace tracking{
+		namespace endgame{
+
+			/**
+			\brief The power series endgame, switching to the Cauchy endgame on the samples so far when it does not converge.
+
+			## Use
+
+			\code
+			AMPTracker tracker(homotopy);
+			// ... set up the tracker
+
+			EndgameSelector<AMPTracker>::Hybrid my_endgame(tracker);
+			auto code = my_endgame.Run(t, point);
+			if (my_endgame.EndgameUsed()==instrument::PathStatistics::EndgameType::Cauchy)
+				...
+			\endcode
+
+			Settings for the two endgames are set on them, through PowerSeries() and Cauchy(), except for the limits of config::PowerSeries on giving up, which the hybrid sets from its own, HybridSettings().  It may be reused for many paths, and run by RunAllEndgames.
+
+			\tparam TrackerType The type of tracker, for EndgameSelector.
+			*/
+			template<typename TrackerType>
+			class HybridEndgame
+			{
+			public:
+				using PowerSeriesType = typename EndgameSelector<TrackerType>::PSEG;
+				using CauchyType = typename EndgameSelector<TrackerType>::Cauchy;
+
+				explicit HybridEndgame(TrackerType const& tracker, config::HybridEndgame const& settings = config::HybridEndgame())
+					: power_series_(tracker), cauchy_(tracker), settings_(settings)
+				{}
+
+				/**
+				\brief Run the power series endgame, and if it gives up or fails, the Cauchy endgame from its newest sample.
+
+				The power series endgame's failures for the path going to infinity, and its failure to take its first samples, are final.
+
+				\param start_time The time at which to start the endgame.
+				\param start_point The point on the path at start_time.
+
+				\return The code of the last endgame run.
+				*/
+				template<typename CT>
+				SuccessCode Run(CT const& start_time, Vec<CT> const& start_point)
+				{
+					auto power_series_settings = power_series_.PowerSeriesSettings();
+					power_series_settings.max_approximations = settings_.max_power_series_approximations;
+					power_series_settings.max_cycle_number_changes = settings_.max_cycle_number_changes;
+					power_series_settings.max_stalled_approximations = settings_.max_stalled_approximations;
+					power_series_.SetPowerSeriesSettings(power_series_settings);
+
+					used_ = instrument::PathStatistics::EndgameType::PowerSeries;
+					const auto code = power_series_.Run(start_time, start_point);
+
+					const auto times = power_series_.template GetTimes<CT>();
+					if (code==SuccessCode::Success || code==SuccessCode::GoingToInfinity || code==SuccessCode::SecurityMaxNormReached
+					    || times.size() < power_series_.EndgameSettings().num_sample_points)
+						return code;
+
+					const auto samples = power_series_.template GetSamples<CT>();
+					BOOST_LOG_TRIVIAL(severity_level::trace) << "power series endgame gave up, code " << int(code) << ", running the Cauchy endgame from t = " << times.back();
+
+					used_ = instrument::PathStatistics::EndgameType::Cauchy;
+					DefaultPrecision(Precision(samples.back()(0)));
+					return cauchy_.Run(times.back(), samples.back());
+				}
+
+				/**
+				\brief Which endgame finished the last run, PowerSeries or Cauchy, or None before the first.
+				*/
+				instrument::PathStatistics::EndgameType EndgameUsed() const
+				{ return used_;}
+
+				unsigned CycleNumber() const
+				{ return UsedCauchy() ? cauchy_.CycleNumber() : power_series_.CycleNumber();}
+
+				template<typename CT>
+				const Vec<CT>& FinalApproximation() const
+				{ return UsedCauchy() ? cauchy_.template FinalApproximation<CT>() : power_series_.template FinalApproximation<CT>();}
+
+				template<typename RT>
+				const RT& ApproximateError() const
+				{ return UsedCauchy() ? cauchy_.template ApproximateError<RT>() : power_series_.template ApproximateError<RT>();}
+
+				/**
+				\brief The statistics of the tracker, and of the last run.  The time in the endgame includes that of the power series endgame before a switch, and the loops and cycle number are those of the endgame which finished.
+				*/
+				instrument::PathStatistics Statistics() const
+				{
+					auto statistics = power_series_.GetTracker().Statistics();
+					power_series_.AddStatistics(statistics);
+					if (UsedCauchy())
+						cauchy_.AddStatistics(statistics);
+					return statistics;
+				}
+
+				/**
+				\brief The time spent in, and calls to, the phases of both endgames, since construction or the last ResetProfile().
+				*/
+				instrument::Profile Profile() const
+				{
+					auto profile = power_series_.Profile();
+					profile += cauchy_.Profile();
+					return profile;
+				}
+
+				void ResetProfile()
+				{
+					power_series_.ResetProfile();
+					cauchy_.ResetProfile();
+				}
+
+				const TrackerType & GetTracker() const
+				{ return power_series_.GetTracker();}
+
+				PowerSeriesType & PowerSeries()
+				{ return power_series_;}
+
+				PowerSeriesType const& PowerSeries() const
+				{ return power_series_;}
+
+				CauchyType & Cauchy()
+				{ return cauchy_;}
+
+				CauchyType const& Cauchy() const
+				{ return cauchy_;}
+
+				config::HybridEndgame const& HybridSettings() const
+				{ return settings_;}
+
+				void SetHybridSettings(config::HybridEndgame const& settings)
+				{ settings_ = settings;}
+
+			private:
+
+				bool UsedCauchy() const
+				{ return used_==instrument::PathStatistics::EndgameType::Cauchy;}
+
+				PowerSeriesType power_series_;
+				CauchyType cauchy_;
+				config::HybridEndgame settings_;
+				instrument::PathStatistics::EndgameType used_ = instrument::PathStatistics::EndgameType::None;
+			};
+
+		} // namespace endgame
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,346 @@
+//This file is part of Bertini 2.
+//
+//instrumentation.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//instrumentation.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with instrumentation.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file instrumentation.hpp
+
+\brief Cumulative time, call counts and allocations for the phases of tracking, broken down by precision.
+
+Trackers and endgames each hold a Profile, which the timers in the predictor, corrector, tracker and endgame add to as they run.  The phases nest: a prediction includes the Jacobian evaluations and linear solves made for it, and an endgame includes the tracking it does, so the times of the outer phases are not to be added to those of the inner ones.
+
+The timers read std::chrono::steady_clock, which is a few tens of nanoseconds a call, against evaluations and factorizations which take microseconds even in double precision.  Configuring with --disable-instrumentation removes them entirely, and the profiles stay empty.
+
+Apart from the profiles, which accumulate over paths, trackers and endgames keep a PathStatistics of the path they are on: its steps, Newton iterations and evaluations, its precisions, and the time spent tracking it and in its endgame.  These are a few counters, and a clock read on entering and leaving each call to track, so are kept even with --disable-instrumentation, and go with the result of the path into the endpoint file.
+
+The timers also take the number of heap allocations, and the bytes asked for, made by their thread during the phase.  These are counted only when the program links libbertini2_allocation_counting, built by configuring with --enable-allocation-counting, which replaces the global operator new and sets the GMP memory functions, through which MPFR allocates the limbs of every temporary.  Vectors and matrices taken from the pools are counted only when the pool grows, for that is when they allocate.  Without the library the counts stay zero, at the cost of reading two thread-local counters per timer.
+*/
+
+#ifndef BERTINI_TRACKING_INSTRUMENTATION_HPP
+#define BERTINI_TRACKING_INSTRUMENTATION_HPP
+
+#include "bertini2/config.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace bertini{
+	namespace tracking{
+		namespace instrument{
+
+			/**
+			\brief The phases timed.
+			*/
+			enum class Phase
+			{
+				SystemEvaluation, ///< Evaluating the functions of the system alone.
+				JacobianEvaluation, ///< Evaluating the Jacobian, with the functions or the time derivative.
+				LinearSolve, ///< Factoring the Jacobian and solving with it, including mixed precision refinement.
+				Predict, ///< A whole prediction.
+				Correct, ///< A whole run of Newton's method, for a step or a refinement.
+				PrecisionChange, ///< Changing the precision of the tracker, counted at the precision changed from.
+				EndgameSampling, ///< Computing the initial samples of an endgame.
+				EndgameApproximation, ///< Computing an approximation of the endpoint from samples.
+				Endgame, ///< A whole run of an endgame.
+				NumPhases
+			};
+
+			constexpr std::size_t NumPhases = static_cast<std::size_t>(Phase::NumPhases);
+
+
+			/**
+			\brief The heap allocations made by a thread, and the bytes asked for by them, since it started, with the requests its pools served and did not.
+
+			The allocations and bytes are added to by the replacement allocation functions of libbertini2_allocation_counting, and are zero without it.  The pools count whether or not it is linked: the limb pool, for each block of a size it keeps, and the pools of objects of detail::Pool, such as PointPool, for each object lent out.  A miss of the limb pool goes on to the heap, so is an allocation, too.
+			*/
+			struct AllocationCounts
+			{
+				std::uint64_t allocations = 0;
+				std::uint64_t bytes = 0;
+				std::uint64_t pool_hits = 0; ///< Requests served by a pool, from what was given back to it.
+				std::uint64_t pool_misses = 0; ///< Requests a pool could not serve, so made new.
+			};
+
+			/**
+			\brief The allocation counts of the calling thread.
+			*/
+			inline
+			AllocationCounts& ThreadAllocations()
+			{
+				static thread_local AllocationCounts counts;
+				return counts;
+			}
+
+
+			/**
+			\brief The number of times a phase was entered, the total time spent in it, and the allocations made in it.
+			*/
+			struct PhaseTotals
+			{
+				std::uint64_t calls = 0;
+				std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+				std::uint64_t allocations = 0; ///< The heap allocations made during the phase, counting those of nested phases.  Zero unless allocation counting is linked in.
+				std::uint64_t bytes = 0; ///< The bytes asked for by those allocations.
+				std::uint64_t pool_hits = 0; ///< The requests served by the limb pool and the pools of objects during the phase, see AllocationCounts.
+				std::uint64_t pool_misses = 0; ///< The requests those pools could not serve.
+
+				PhaseTotals& operator+=(PhaseTotals const& other)
+				{
+					calls += other.calls;
+					time += other.time;
+					allocations += other.allocations;
+					bytes += other.bytes;
+					pool_hits += other.pool_hits;
+					pool_misses += other.pool_misses;
+					return *this;
+				}
+
+				double Seconds() const
+				{
+					return std::chrono::duration<double>(time).count();
+				}
+			};
+
+
+			/**
+			\brief The totals of every phase, at every precision at which it ran.
+			*/
+			class Profile
+			{
+			public:
+
+				void Record(Phase phase, unsigned precision, std::chrono::nanoseconds elapsed, AllocationCounts const& allocated = AllocationCounts())
+				{
+					auto& totals = by_precision_[precision][static_cast<std::size_t>(phase)];
+					++totals.calls;
+					totals.time += elapsed;
+					totals.allocations += allocated.allocations;
+					totals.bytes += allocated.bytes;
+					totals.pool_hits += allocated.pool_hits;
+					totals.pool_misses += allocated.pool_misses;
+				}
+
+				/**
+				\brief The totals of a phase, over all precisions.
+				*/
+				PhaseTotals Total(Phase phase) const
+				{
+					PhaseTotals sum;
+					for (auto const& p : by_precision_)
+						sum += p.second[static_cast<std::size_t>(phase)];
+					return sum;
+				}
+
+				/**
+				\brief The totals of a phase at one precision.
+				*/
+				PhaseTotals Total(Phase phase, unsigned precision) const
+				{
+					auto found = by_precision_.find(precision);
+					if (found==by_precision_.end())
+						return PhaseTotals();
+					return found->second[static_cast<std::size_t>(phase)];
+				}
+
+				/**
+				\brief The precisions at which anything was recorded, in increasing order.
+				*/
+				std::vector<unsigned> Precisions() const
+				{
+					std::vector<unsigned> precisions;
+					for (auto const& p : by_precision_)
+						precisions.push_back(p.first);
+					return precisions;
+				}
+
+				void Reset()
+				{
+					by_precision_.clear();
+				}
+
+				/**
+				\brief Add the totals of another profile, such as that of another thread's tracker.
+				*/
+				Profile& operator+=(Profile const& other)
+				{
+					for (auto const& p : other.by_precision_)
+					{
+						auto& totals = by_precision_[p.first];
+						for (std::size_t ii = 0; ii < NumPhases; ++ii)
+							totals[ii] += p.second[ii];
+					}
+					return *this;
+				}
+
+			private:
+
+				std::map<unsigned, std::array<PhaseTotals, NumPhases> > by_precision_;
+			};
+
+
+			/**
+			\brief The cost of one path: its steps, Newton iterations, evaluations and precisions, and the time spent on it, with what its endgame found, if one was run.
+
+			Trackers count the first part from their ResetStatistics, see TrackerBase::Statistics, and endgames add the rest with AddStatistics.
+			*/
+			struct PathStatistics
+			{
+				/**
+				\brief The endgame run on the path, if any.
+				*/
+				enum class EndgameType : std::int32_t
+				{
+					None,
+					PowerSeries,
+					Cauchy
+				};
+
+				std::uint64_t steps_accepted = 0;
+				std::uint64_t steps_rejected = 0;
+				std::uint64_t newton_iterations = 0; ///< Iterations of the corrector, counting those redone with a fresh Jacobian, and refinements.
+				std::uint64_t evaluations = 0; ///< Evaluations of the system, its Jacobian, its time derivative, or several at once, by the predictor and corrector.
+				unsigned max_precision = 0; ///< The highest precision, in digits, of any step.
+				unsigned final_precision = 0; ///< The precision, in digits, in which the path ended.
+				double tracking_seconds = 0; ///< The time spent tracking, including the tracking done by the endgame.
+				double endgame_seconds = 0; ///< The time spent in the endgame, the whole of its run.
+				EndgameType endgame = EndgameType::None;
+				unsigned endgame_loops = 0; ///< The circles tracked by the Cauchy endgame, or the approximations made by the power series endgame.
+				unsigned cycle_number = 0; ///< The cycle number found by the endgame, or 0 if none was run.
+
+				template<typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					auto type = static_cast<std::int32_t>(endgame);
+					ar & steps_accepted;
+					ar & steps_rejected;
+					ar & newton_iterations;
+					ar & evaluations;
+					ar & max_precision;
+					ar & final_precision;
+					ar & tracking_seconds;
+					ar & endgame_seconds;
+					ar & type;
+					ar & endgame_loops;
+					ar & cycle_number;
+					endgame = static_cast<EndgameType>(type);
+				}
+			};
+
+
+			/**
+			\brief Adds the seconds from its construction to its destruction to a number.
+			*/
+			class Stopwatch
+			{
+				using Clock = std::chrono::steady_clock;
+
+			public:
+
+				explicit Stopwatch(double & seconds) : seconds_(seconds), start_(Clock::now())
+				{}
+
+				~Stopwatch()
+				{
+					seconds_ += std::chrono::duration<double>(Clock::now() - start_).count();
+				}
+
+				Stopwatch(Stopwatch const&) = delete;
+				Stopwatch& operator=(Stopwatch const&) = delete;
+
+			private:
+
+				double & seconds_;
+				Clock::time_point start_;
+			};
+
+
+			/**
+			\brief Adds the time from its construction to its destruction to a profile, with the allocations its thread made meanwhile.  Does nothing if the profile is null.
+			*/
+			class ScopedTimer
+			{
+				using Clock = std::chrono::steady_clock;
+
+			public:
+
+				ScopedTimer(Profile* profile, Phase phase, unsigned precision) : profile_(profile), phase_(phase), precision_(precision)
+				{
+					if (profile_)
+					{
+						allocated_at_start_ = ThreadAllocations();
+						start_ = Clock::now();
+					}
+				}
+
+				ScopedTimer(Profile& profile, Phase phase, unsigned precision) : ScopedTimer(&profile, phase, precision)
+				{}
+
+				~ScopedTimer()
+				{
+					if (profile_)
+					{
+						const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_);
+						const auto& allocated = ThreadAllocations();
+						AllocationCounts during;
+						during.allocations = allocated.allocations - allocated_at_start_.allocations;
+						during.bytes = allocated.bytes - allocated_at_start_.bytes;
+						during.pool_hits = allocated.pool_hits - allocated_at_start_.pool_hits;
+						during.pool_misses = allocated.pool_misses - allocated_at_start_.pool_misses;
+						profile_->Record(phase_, precision_, elapsed, during);
+					}
+				}
+
+				ScopedTimer(ScopedTimer const&) = delete;
+				ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+			private:
+
+				Profile* profile_;
+				Phase phase_;
+				unsigned precision_;
+				Clock::time_point start_;
+				AllocationCounts allocated_at_start_;
+			};
+
+		} // namespace instrument
+	} // namespace tracking
+} // namespace bertini
+
+
+#define BERTINI_INSTRUMENT_CONCAT_IMPL(a,b) a##b
+#define BERTINI_INSTRUMENT_CONCAT(a,b) BERTINI_INSTRUMENT_CONCAT_IMPL(a,b)
+
+/**
+\brief Time the rest of the enclosing scope as a phase, at a precision, into a profile or a pointer to one.  Expands to nothing, without evaluating its arguments, when instrumentation is disabled.
+*/
+#ifdef BERTINI_ENABLE_INSTRUMENTATION
+	#define BERTINI_TIME_PHASE(profile, phase, precision) \
+		::bertini::tracking::instrument::ScopedTimer BERTINI_INSTRUMENT_CONCAT(bertini_phase_timer_, __LINE__)(profile, ::bertini::tracking::instrument::Phase::phase, precision)
+#else
+	#define BERTINI_TIME_PHASE(profile, phase, precision) ((void)0)
+#endif
+
+#endif
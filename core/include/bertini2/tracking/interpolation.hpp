@@ -34,6 +34,148 @@
 namespace bertini{
 	namespace tracking{
 
+/**
+\brief Hermite interpolation through a window of samples which slides, one sample at a time, as an endgame advances.
+
+Each sample contributes two nodes to the table of divided differences, its time twice, with the sample and its derivative as data.  The nodes are ordered oldest first, so that the entry of the table in row i and column j is the divided difference over nodes i-j through i.  Dropping the oldest sample then removes only the first two rows, the rest of the table being untouched, and the diagonal of what remains is the one the Newton form needs.  Pushing a sample computes the two new rows, in time linear in the number of samples, rather than rebuilding the whole table.
+
+The rows are kept in a ring of preallocated storage, sized for the number of samples held, so sliding the window reuses the rows of the dropped sample.
+
+\tparam CT The complex number type.
+*/
+template<typename CT>
+class HermiteInterpolator
+{
+public:
+
+	HermiteInterpolator() = default;
+
+	/**
+	\brief Make an interpolator holding up to num_sample_points samples.
+	*/
+	explicit HermiteInterpolator(unsigned num_sample_points)
+	{
+		Reset(num_sample_points);
+	}
+
+	/**
+	\brief Forget the samples held, and make room for num_sample_points of them.  Storage is reallocated only if the number changes.
+	*/
+	void Reset(unsigned num_sample_points)
+	{
+		if (num_sample_points!=capacity_)
+		{
+			capacity_ = num_sample_points;
+			space_differences_.resize(2*capacity_, 2*capacity_);
+			time_differences_.resize(2*capacity_);
+		}
+		Clear();
+	}
+
+	/**
+	\brief Forget the samples held, keeping the storage.
+	*/
+	void Clear()
+	{
+		first_row_ = 0;
+		num_nodes_ = 0;
+	}
+
+	/**
+	\brief The number of samples held.
+	*/
+	unsigned NumSamples() const
+	{
+		return num_nodes_/2;
+	}
+
+	/**
+	\brief The most samples held at once.
+	*/
+	unsigned Capacity() const
+	{
+		return capacity_;
+	}
+
+	/**
+	\brief Add a sample, newer than those held.  If the interpolator is full, the oldest sample is dropped.
+
+	\param time The time of the sample.  It must differ from those of the other samples held.
+	\param sample The space value at time.
+	\param derivative The derivative of the space value with respect to time, at time.
+	*/
+	void Push(CT const& time, Vec<CT> const& sample, Vec<CT> const& derivative)
+	{
+		assert(capacity_ > 0 && "pushing into hermite interpolator without room for samples");
+
+		if (NumSamples()==capacity_)
+		{
+			first_row_ = Row(2);
+			num_nodes_ -= 2;
+		}
+
+		// the first node of the sample, with the divided differences ending at it
+		auto ii = num_nodes_;
+		auto row = Row(ii);
+		time_differences_(row) = time;
+		space_differences_(row,0) = sample;
+		for (unsigned jj = 1; jj <= ii; ++jj)
+			space_differences_(row,jj) = (space_differences_(row,jj-1) - space_differences_(Row(ii-1),jj-1)) / (time - time_differences_(Row(ii-jj)));
+
+		// the second, repeating the time, for which the first divided difference is the derivative
+		++ii;
+		row = Row(ii);
+		time_differences_(row) = time;
+		space_differences_(row,0) = sample;
+		space_differences_(row,1) = derivative;
+		for (unsigned jj = 2; jj <= ii; ++jj)
+			space_differences_(row,jj) = (space_differences_(row,jj-1) - space_differences_(Row(ii-1),jj-1)) / (time - time_differences_(Row(ii-jj)));
+
+		num_nodes_ += 2;
+	}
+
+	/**
+	\brief Evaluate the interpolating polynomial of the samples held.
+
+	\param[out] result The interpolated space value.
+	\param target_time The time at which to evaluate.
+	*/
+	void Interpolate(Vec<CT> & result, CT const& target_time) const
+	{
+		assert(num_nodes_ > 0 && "interpolating without samples");
+
+		// the Newton form, from the highest term down
+		result = space_differences_(Row(num_nodes_-1), num_nodes_-1);
+		for (auto ii = num_nodes_-1; ii > 0; --ii)
+			result = result * (target_time - time_differences_(Row(ii-1))) + space_differences_(Row(ii-1), ii-1);
+	}
+
+	/**
+	\brief Evaluate the interpolating polynomial of the samples held.
+	*/
+	Vec<CT> Interpolate(CT const& target_time) const
+	{
+		Vec<CT> result;
+		Interpolate(result, target_time);
+		return result;
+	}
+
+private:
+
+	unsigned Row(unsigned node) const
+	{
+		const auto row = first_row_ + node;
+		return row < 2*capacity_ ? row : row - 2*capacity_;
+	}
+
+	Mat< Vec<CT> > space_differences_; ///< The divided differences, row i holding those ending at node i, in a ring of rows.
+	Vec<CT> time_differences_; ///< The nodes, in the same ring as the rows.
+	unsigned capacity_ = 0; ///< The most samples held.
+	unsigned first_row_ = 0; ///< The row of the oldest node.
+	unsigned num_nodes_ = 0; ///< Twice the number of samples held.
+};
+
+
 /**
 
 \brief Estimates the root to interpolating polynomial.
@@ -66,56 +208,11 @@ template<typename CT>
 	assert((samples.size() >= num_sample_points) && "must have sufficient number of sample points");
 	assert((derivatives.size() >= num_sample_points) && "must have sufficient number of derivatives");
 
-	auto num_provided_samples = samples.size();
-	auto num_provided_times = times.size();
-	auto num_provided_derivs = derivatives.size();
+	HermiteInterpolator<CT> interpolator(num_sample_points);
+	for (unsigned ii = num_sample_points; ii > 0; --ii)
+		interpolator.Push(times[times.size()-ii], samples[samples.size()-ii], derivatives[derivatives.size()-ii]);
 
-	Mat< Vec<CT> > space_differences(2*num_sample_points,2*num_sample_points);
-	Vec<CT> time_differences(2*num_sample_points);
-
-
-	for(unsigned int ii=0; ii<num_sample_points; ++ii)
-	{ 
-		space_differences(2*ii,0)   = samples[    num_provided_samples-1-ii];		/*  F[2*i][0]    = samples[i];    */
-		space_differences(2*ii+1,0) = samples[    num_provided_samples-1-ii]; 		/*  F[2*i+1][0]  = samples[i];    */
-		space_differences(2*ii+1,1) = derivatives[num_provided_derivs -1-ii];	/*  F[2*i+1][1]  = derivatives[i]; */
-		time_differences(2*ii)      = times[      num_provided_times  -1-ii];				/*  z[2*i]       = times[i];       */
-		time_differences(2*ii+1)    = times[      num_provided_times  -1-ii];			/*  z[2*i+1]     = times[i];       */
-	}
-
-	//Add first round of finite differences to fill out rest of matrix. 
-	for(unsigned int ii=1; ii< num_sample_points; ++ii)
-	{
-		space_differences(2*ii,1) = (space_differences(2*ii,0) - space_differences(2*ii-1,0)) / (time_differences(2*ii) - time_differences(2*ii-1));
-	
-	}
-
-	//Filling out finite difference matrix to get the diagonal for hermite interpolation polyonomial.
-	for(unsigned int ii=2; ii < 2*num_sample_points; ++ii)
-	{
-		for(unsigned int jj=2; jj <=ii; ++jj)
-		{
-			space_differences(ii,jj) = 
-				(space_differences(ii,jj-1) - space_differences(ii-1,jj-1)) 
-					/ 
-				(time_differences(ii) - time_differences(ii-jj));						
-		}
-	}
-
-	//Start of Result from Hermite polynomial, this is using the diagonal of the 
-	//finite difference matrix.
-	auto Result = space_differences(2*num_sample_points - 1,2*num_sample_points - 1); 
-
-
-	//This builds the hermite polynomial from the highest term down. 
-	//As we multiply the previous result we will construct the highest term down to the last term.
-	for (unsigned ii=num_sample_points-1; ii >= 1; --ii)
-	{
-		Result = ((Result*(target_time - time_differences(ii)) + space_differences(2*ii, 2*ii)) * (target_time - time_differences(ii-1)) + space_differences(2*ii-1, 2*ii-1)).eval();  
-	}
-	
-	// Last term in hermite polynomial.
-	return (Result * (target_time - time_differences(0)) + space_differences(0,0)).eval(); 
+	return interpolator.Interpolate(target_time);
 } //re: HermiteInterpolateAndSolve
 
 }}  // re: namespaces
@@ -0,0 +1,317 @@
+//This file is part of Bertini 2.
+//
+//metrics.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//metrics.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with metrics.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file metrics.hpp
+
+\brief Counts of paths, steps, precision changes and endgames, and the time in each phase, over all the threads of a run, for watching a long run as it goes.
+
+A Registry holds a shard of counters for each thread which records into it, made the first time the thread does.  A thread adds only to its own shard, with relaxed atomic additions, so recording takes no lock and contends with no other thread.  A Snapshot sums the shards, also without a lock, so may be taken at any time, from any thread, while the others record; each count in it is one the registry held at some moment during the snapshot.
+
+The registry is fed by a MetricsRecorder attached to each tracker, see observers.hpp, or by passing it to TrackAllPaths or RunAllEndgames, which attach them.  A PeriodicExporter snapshots a registry at a fixed period on a thread of its own, and hands each snapshot to a function, which might write ToJSON or ToPrometheus of it where a dashboard reads it.
+*/
+
+#ifndef BERTINI_TRACKING_METRICS_HPP
+#define BERTINI_TRACKING_METRICS_HPP
+
+#include "bertini2/tracking/instrumentation.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace bertini{
+	namespace tracking{
+		namespace metrics{
+
+			/**
+			\brief The events counted.
+			*/
+			enum class Counter
+			{
+				PathsStarted, ///< Paths begun by a tracker, counting each piece of a path tracked in pieces.
+				PathsEnded, ///< Paths ended by a tracker, however they ended.
+				PathsTruncated, ///< Paths ended for going to infinity.
+				SuccessfulSteps,
+				FailedSteps,
+				PrecisionIncreases,
+				PrecisionDecreases,
+				WorkersPinned, ///< Workers of the parallel drivers pinned to a core.
+				PathsDeferred, ///< Paths put off to the slow lane for running over their budget, see PathBudget.
+				PathsRetried, ///< Failed paths tracked again by RetryFailedPaths, once for each rung.
+				PathsRecovered, ///< Failed paths which no longer fail when tracked again.
+				NumCounters
+			};
+
+			constexpr std::size_t NumCounters = static_cast<std::size_t>(Counter::NumCounters);
+
+
+			/**
+			\brief The kinds of endgame, whose outcomes are counted apart.
+			*/
+			enum class Endgame
+			{
+				PowerSeries,
+				Cauchy,
+				NumEndgames
+			};
+
+			constexpr std::size_t NumEndgames = static_cast<std::size_t>(Endgame::NumEndgames);
+
+
+			/**
+			\brief The upper bounds, in bits, of the buckets of the histogram of the precisions at which steps succeed.  The last bucket takes all above the last bound.
+			*/
+			constexpr std::array<unsigned, 8> PrecisionBucketBounds{{64, 96, 128, 192, 256, 512, 1024, 4096}};
+
+			constexpr std::size_t NumPrecisionBuckets = PrecisionBucketBounds.size()+1;
+
+			/**
+			\brief The bucket of the histogram into which a precision, in digits as DefaultPrecision counts them, falls.  Double precision is in the first.
+			*/
+			inline
+			std::size_t PrecisionBucket(unsigned digits)
+			{
+				// 3.32 bits a digit, rounded up, as mpfr_float sets its precision in bits from digits
+				const unsigned bits = (digits*3322u + 999u)/1000u;
+				std::size_t bucket = 0;
+				while (bucket < PrecisionBucketBounds.size() && bits > PrecisionBucketBounds[bucket])
+					++bucket;
+				return bucket;
+			}
+
+
+			/**
+			\brief The sums of the counters of all shards of a registry, at some moment.
+			*/
+			struct Snapshot
+			{
+				double seconds = 0; ///< The time since the registry was made, or last reset.
+				unsigned numa_nodes = 0; ///< The NUMA nodes the run could use, as last recorded, or 0 if never.
+				unsigned cpus = 0; ///< The cores the run could use, as last recorded, or 0 if never.
+				std::array<std::uint64_t, NumCounters> counters{};
+				std::array<std::uint64_t, NumPrecisionBuckets> precision_histogram{}; ///< The successful steps by the precision at which they were taken, see PrecisionBucketBounds.
+				std::array<std::array<std::uint64_t, 2>, NumEndgames> endgames{}; ///< The runs of each kind of endgame, by whether they failed, [kind][0], or succeeded, [kind][1].
+				std::array<std::uint64_t, instrument::NumPhases> phase_calls{};
+				std::array<std::uint64_t, instrument::NumPhases> phase_nanoseconds{};
+
+				std::uint64_t Count(Counter c) const
+				{
+					return counters[static_cast<std::size_t>(c)];
+				}
+
+				/**
+				\brief The paths ended per second, over the life of the registry.
+				*/
+				double PathsPerSecond() const
+				{
+					return seconds > 0 ? Count(Counter::PathsEnded)/seconds : 0;
+				}
+
+				/**
+				\brief The proportion of steps which failed, or 0 if none were taken.
+				*/
+				double StepRejectionRate() const
+				{
+					const auto total = Count(Counter::SuccessfulSteps) + Count(Counter::FailedSteps);
+					return total ? static_cast<double>(Count(Counter::FailedSteps))/total : 0;
+				}
+
+				/**
+				\brief The proportion of the runs of an endgame which succeeded, or 0 if there were none.
+				*/
+				double EndgameSuccessRate(Endgame kind) const
+				{
+					auto const& e = endgames[static_cast<std::size_t>(kind)];
+					return e[0]+e[1] ? static_cast<double>(e[1])/(e[0]+e[1]) : 0;
+				}
+			};
+
+
+			/**
+			\brief Counters sharded by thread, recorded into without locks.
+
+			Each registry has a process-unique identity, by which a thread finds its shard in a small thread-local table, so registries may come and go, and a thread may record into several.  Shards are freed with the registry, which must outlive the recording into it.
+			*/
+			class Registry
+			{
+				using Clock = std::chrono::steady_clock;
+
+				struct Shard
+				{
+					std::array<std::atomic<std::uint64_t>, NumCounters> counters{};
+					std::array<std::atomic<std::uint64_t>, NumPrecisionBuckets> precision_histogram{};
+					std::array<std::atomic<std::uint64_t>, 2*NumEndgames> endgames{};
+					std::array<std::atomic<std::uint64_t>, instrument::NumPhases> phase_calls{};
+					std::array<std::atomic<std::uint64_t>, instrument::NumPhases> phase_nanoseconds{};
+					Shard* next = nullptr;
+				};
+
+			public:
+
+				Registry();
+				~Registry();
+
+				Registry(Registry const&) = delete;
+				Registry& operator=(Registry const&) = delete;
+
+				void Increment(Counter c, std::uint64_t n = 1)
+				{
+					Add(LocalShard().counters[static_cast<std::size_t>(c)], n);
+				}
+
+				/**
+				\brief Count a successful step at a precision, in digits.
+				*/
+				void RecordStepPrecision(unsigned digits)
+				{
+					Add(LocalShard().precision_histogram[PrecisionBucket(digits)], 1);
+				}
+
+				void RecordEndgame(Endgame kind, bool success)
+				{
+					Add(LocalShard().endgames[2*static_cast<std::size_t>(kind) + (success ? 1 : 0)], 1);
+				}
+
+				void RecordPhase(instrument::Phase phase, std::uint64_t calls, std::chrono::nanoseconds time)
+				{
+					auto& shard = LocalShard();
+					Add(shard.phase_calls[static_cast<std::size_t>(phase)], calls);
+					Add(shard.phase_nanoseconds[static_cast<std::size_t>(phase)], static_cast<std::uint64_t>(time.count()));
+				}
+
+				/**
+				\brief Add the totals of every phase of a profile, over all precisions.
+				*/
+				void RecordPhases(instrument::Profile const& profile)
+				{
+					for (std::size_t ii = 0; ii < instrument::NumPhases; ++ii)
+					{
+						const auto totals = profile.Total(static_cast<instrument::Phase>(ii));
+						if (totals.calls)
+							RecordPhase(static_cast<instrument::Phase>(ii), totals.calls, totals.time);
+					}
+				}
+
+				/**
+				\brief Note the NUMA nodes and cores the run may use, as a parallel driver does as it starts, see detail::NumaTopology.
+				*/
+				void RecordTopology(unsigned numa_nodes, unsigned cpus)
+				{
+					numa_nodes_.store(numa_nodes, std::memory_order_relaxed);
+					cpus_.store(cpus, std::memory_order_relaxed);
+				}
+
+				/**
+				\brief The sums over all shards, taken without stopping the threads recording.
+				*/
+				Snapshot TakeSnapshot() const;
+
+				/**
+				\brief A registry for the whole process, for those who want one without passing it around.
+				*/
+				static Registry& Global();
+
+			private:
+
+				static void Add(std::atomic<std::uint64_t>& counter, std::uint64_t n)
+				{
+					counter.fetch_add(n, std::memory_order_relaxed);
+				}
+
+				/**
+				\brief The shard of the calling thread, made and linked in, without a lock, the first time it is asked for.
+				*/
+				Shard& LocalShard();
+
+				const std::uint64_t id_;
+				const Clock::time_point created_;
+				std::atomic<Shard*> shards_{nullptr};
+				std::atomic<unsigned> numa_nodes_{0}, cpus_{0};
+			};
+
+
+			/**
+			\brief The metrics as JSON, one object with the topology, rates, counts, histogram, endgames and phases.
+			*/
+			std::string ToJSON(Snapshot const& s);
+
+			/**
+			\brief The metrics in the Prometheus text exposition format, each name starting with a prefix.
+			*/
+			std::string ToPrometheus(Snapshot const& s, std::string const& prefix = "bertini");
+
+
+			/**
+			\brief Snapshots a registry at a fixed period, on a thread of its own, and hands each snapshot to a function, until destroyed.
+
+			\code
+			metrics::Registry registry;
+			metrics::PeriodicExporter exporter(registry, std::chrono::seconds(10), [](metrics::Snapshot const& s)
+				{
+					std::ofstream("/var/lib/node_exporter/bertini.prom") << metrics::ToPrometheus(s);
+				});
+			auto results = TrackAllPaths<AMPTracker>(homotopy, start_system, setup, t_start, t_end, CheckpointConfig(), 0, 64, &registry);
+			\endcode
+
+			The function is called on the exporter's thread, and once more with a final snapshot as the exporter is destroyed.  It should not throw; what it throws is dropped.
+			*/
+			class PeriodicExporter
+			{
+			public:
+
+				using Sink = std::function<void(Snapshot const&)>;
+
+				PeriodicExporter(Registry const& registry, std::chrono::milliseconds period, Sink sink);
+				~PeriodicExporter();
+
+				PeriodicExporter(PeriodicExporter const&) = delete;
+				PeriodicExporter& operator=(PeriodicExporter const&) = delete;
+
+			private:
+
+				void Export() const;
+
+				Registry const& registry_;
+				const std::chrono::milliseconds period_;
+				const Sink sink_;
+
+				std::mutex mutex_;
+				std::condition_variable stop_requested_;
+				bool stopping_ = false;
+				std::thread thread_;
+			};
+
+		} // namespace metrics
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,427 @@
+//This file is part of Bertini 2.
+//
+//monodromy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//monodromy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with monodromy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file monodromy.hpp
+
+\brief Solve a generic member of a parametrized family, or complete a witness set, from one solution, by tracking around loops.
+
+Moving the parameters of a family around a loop, from a generic member back to itself, permutes its solutions.  For random loops the permutations generate a group acting transitively on the solutions of an irreducible family, so tracking the known solutions around loop after loop finds the others, one by one.  The same holds for the points of a witness set of an irreducible component, moving its slice around a loop of slices.
+
+Each loop is a triangle, from the base member to two random members and back, along straight lines, each of which generically meets no singular member.  Every solution known at the start of a loop is tracked around it, on a pool of threads, and the endpoints are gathered into a SolutionSet, which recognizes the ones already known.  The solve stops once several loops in a row find nothing new, or the expected number of solutions is reached.  So its cost is in the number of solutions there are, not in any bound on it; without a known count, though, there is no proof that all are found.
+*/
+
+#ifndef BERTINI_TRACKING_MONODROMY_HPP
+#define BERTINI_TRACKING_MONODROMY_HPP
+
+#include "bertini2/tracking/parameter_homotopy.hpp"
+#include "bertini2/tracking/witness_sampling.hpp"
+
+#include <functional>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief A set of points, safe to insert into from several threads, which recognizes a point already in it.
+
+		Two points are the same if their distance is within a tolerance, relative to the norm of the one being inserted.  The points are kept ordered by the real part of a fixed random projection, a unit vector, which moves no more than the points do, so only those with projections within the tolerance are compared.
+		*/
+		template<typename ComplexType>
+		class SolutionSet
+		{
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+		public:
+
+			/**
+			\param num_variables The number of coordinates of the points.
+			\param tolerance The distance within which two points are the same, relative to the norm of the one being inserted.
+			*/
+			SolutionSet(std::size_t num_variables, double tolerance) : tolerance_(tolerance), direction_(num_variables)
+			{
+				for (std::size_t ii = 0; ii < num_variables; ++ii)
+					direction_(ii) = RandomUnit<dbl>();
+				direction_ /= direction_.norm();
+			}
+
+			/**
+			\brief Add a point, unless it is already in the set.
+
+			\return Whether the point was new.
+
+			\throws std::runtime_error if the point has the wrong number of coordinates.
+			*/
+			bool Insert(Vec<ComplexType> const& point)
+			{
+				if (point.size()!=direction_.size())
+					throw std::runtime_error("inserting a point with " + std::to_string(point.size()) + " coordinates into a set of points with " + std::to_string(direction_.size()));
+
+				const double key = Key(point);
+				const double radius = Radius(point, key);
+
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (Find(point, key, radius))
+					return false;
+				index_.emplace(key, points_.size());
+				points_.push_back(point);
+				return true;
+			}
+
+			/**
+			\brief Whether a point is in the set.
+			*/
+			bool Contains(Vec<ComplexType> const& point) const
+			{
+				const double key = Key(point);
+				const double radius = Radius(point, key);
+
+				std::lock_guard<std::mutex> lock(mutex_);
+				return Find(point, key, radius);
+			}
+
+			/**
+			\brief The number of points.
+			*/
+			std::size_t Size() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return points_.size();
+			}
+
+			/**
+			\brief A copy of the points, in the order they were inserted.
+			*/
+			std::vector< Vec<ComplexType> > Points() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return points_;
+			}
+
+		private:
+
+			double Key(Vec<ComplexType> const& point) const
+			{
+				dbl projection(0);
+				for (int ii = 0; ii < point.size(); ++ii)
+					projection += std::conj(direction_(ii)) * static_cast<dbl>(point(ii));
+				return projection.real();
+			}
+
+			// padded for the rounding of the projections to double
+			double Radius(Vec<ComplexType> const& point, double key) const
+			{
+				const double norm = static_cast<double>(point.norm());
+				return tolerance_*(1 + norm) + 1e-12*(1 + norm + std::abs(key));
+			}
+
+			bool Find(Vec<ComplexType> const& point, double key, double radius) const
+			{
+				const RealType within = RealType(tolerance_)*(1 + point.norm());
+				for (auto it = index_.lower_bound(key - radius); it != index_.end() && it->first <= key + radius; ++it)
+					if ((points_[it->second] - point).norm() <= within)
+						return true;
+				return false;
+			}
+
+			double tolerance_;
+			Vec<dbl> direction_; ///< The unit vector the points are projected onto, for ordering them.
+			std::vector< Vec<ComplexType> > points_;
+			std::multimap<double, std::size_t> index_; ///< The indices of the points, by the real part of their projection.
+			mutable std::mutex mutex_;
+		};
+
+
+		/**
+		\brief When to stop tracking around loops.
+		*/
+		struct MonodromyConfig
+		{
+			unsigned max_loops = 100; ///< The most loops to track around.
+			unsigned stall_loops = 5; ///< Stop once this many loops in a row have found no new solution.
+			std::size_t expected_count = 0; ///< Stop once this many solutions are found.  0 if the count is not known.
+			double duplicate_tolerance = 1e-8; ///< The distance within which two endpoints are the same solution, relative to the norm of the point.
+		};
+
+
+		/**
+		\brief What happened on one loop.
+		*/
+		struct MonodromyLoop
+		{
+			std::size_t num_tracked = 0; ///< The solutions tracked around the loop, all those known when it started.
+			std::size_t num_failed = 0; ///< Those whose path failed on some side of the loop.
+			std::size_t num_new = 0; ///< The endpoints which were new solutions.
+		};
+
+
+		/**
+		\brief The outcome of a solve by monodromy.
+		*/
+		template<typename ComplexType>
+		struct MonodromyResults
+		{
+			std::vector< Vec<ComplexType> > solutions; ///< The solutions found, the seeds first.
+			std::vector< MonodromyLoop > loops; ///< What happened on each loop.
+		};
+
+
+		namespace detail {
+
+			/**
+			\brief Track the known solutions around loops, until the config says to stop.
+
+			\param found The known solutions, to which the new ones are added.
+			\param track_loop Track the given points around a new random loop, calling the given function with the endpoint of each path which succeeded, and returning the number which failed.
+			*/
+			template<typename ComplexType, typename LoopFunction>
+			std::vector< MonodromyLoop > TrackLoops(SolutionSet<ComplexType> & found, MonodromyConfig const& config, LoopFunction track_loop)
+			{
+				std::vector< MonodromyLoop > loops;
+				unsigned num_stalled = 0;
+				while (loops.size() < config.max_loops && num_stalled < config.stall_loops
+				       && (config.expected_count==0 || found.Size() < config.expected_count))
+				{
+					const auto starts = found.Points();
+
+					MonodromyLoop loop;
+					loop.num_tracked = starts.size();
+
+					std::atomic<std::size_t> num_new(0);
+					loop.num_failed = track_loop(starts, [&](Vec<ComplexType> const& endpoint)
+						{
+							if (found.Insert(endpoint))
+								++num_new;
+						});
+					loop.num_new = num_new;
+
+					num_stalled = loop.num_new==0 ? num_stalled+1 : 0;
+					loops.push_back(loop);
+				}
+				return loops;
+			}
+
+			template<typename ComplexType>
+			Vec<ComplexType> FromMultiple(Vec<mpfr> const& v)
+			{
+				Vec<ComplexType> result(v.size());
+				for (int ii = 0; ii < v.size(); ++ii)
+					result(ii) = static_cast<ComplexType>(v(ii));
+				return result;
+			}
+
+		}
+
+
+		/**
+		\brief Solve a generic member of a parametrized family from some of its solutions, by moving its parameters around random loops.
+
+		## Use
+
+		Pick a point, and values of the parameters for which it is a solution, for instance by solving the family, linear in its parameters, for them.  Then
+
+		\code
+		ParameterHomotopy ph(family, {p, q});
+		auto AMP = config::AMPConfigFrom(ph.Homotopy());
+		auto solved = SolveByMonodromy<AMPTracker>(ph, values, {seed}, [&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			});
+		\endcode
+
+		The solutions known at the start of each loop are shared among a pool of threads, each tracking one around all three sides of the loop at a time.  As for TrackAllPaths, setup is called once per worker, on each loop, concurrently, so must not evaluate anything shared.
+
+		\param ph The homotopy of the family.  Its generic solve is not used.
+		\param parameters The values of the parameters of the member to solve, which should be generic.
+		\param seeds Solutions of that member, in the coordinates of the homotopy.
+		\param setup Configure a freshly made tracker.
+		\param config When to stop.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\throws std::runtime_error if there are no seeds, or the number of values of the parameters, or of coordinates of a seed, is wrong.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename SetupFunction>
+		MonodromyResults<typename TrackerTraits<TrackerType>::BaseComplexType>
+		SolveByMonodromy(ParameterHomotopy const& ph, Vec<mpfr> const& parameters, std::vector< Vec<mpfr> > const& seeds,
+		                 SetupFunction setup, MonodromyConfig const& config = MonodromyConfig(), unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			System const& homotopy = ph.Homotopy();
+
+			if (static_cast<std::size_t>(parameters.size())!=ph.NumParameters())
+				throw std::runtime_error("solving by monodromy, but given " + std::to_string(parameters.size()) + " parameter values, not " + std::to_string(ph.NumParameters()));
+			if (seeds.empty())
+				throw std::runtime_error("solving by monodromy, but given no seed solutions");
+			for (const auto& s : seeds)
+				if (static_cast<std::size_t>(s.size())!=homotopy.NumVariables())
+					throw std::runtime_error("solving by monodromy, but a seed has " + std::to_string(s.size()) + " coordinates, not " + std::to_string(homotopy.NumVariables()));
+
+			SolutionSet<ComplexType> found(homotopy.NumVariables(), config.duplicate_tolerance);
+			for (const auto& s : seeds)
+				found.Insert(detail::FromMultiple<ComplexType>(s));
+
+			if (num_threads==0)
+				num_threads = detail::DefaultNumWorkers();
+
+			// the copies are made here, serially, as is the pool.  those of a compiled homotopy share its program
+			std::string archived_homotopy;
+			auto copy_homotopy = [&]()
+			{
+				if (archived_homotopy.empty())
+					try
+					{
+						return homotopy.CloneForThread();
+					}
+					catch (std::runtime_error const&)
+					{
+						archived_homotopy = detail::Archive(homotopy);
+					}
+				return detail::CloneFromArchive<System>(archived_homotopy);
+			};
+
+			SystemPool homotopies;
+			std::vector< std::shared_ptr<System> > worker_homotopies(num_threads);
+			for (unsigned ii = 0; ii < num_threads; ++ii)
+				worker_homotopies[ii] = homotopies.NonPtrAdd(copy_homotopy());
+
+			const auto precision = DefaultPrecision();
+
+			auto track_loop = [&](std::vector< Vec<ComplexType> > const& starts, std::function<void(Vec<ComplexType> const&)> on_endpoint)
+			{
+				std::vector< Vec<mpfr> > corners{parameters, Vec<mpfr>(parameters.size()), Vec<mpfr>(parameters.size()), parameters};
+				for (unsigned cc = 1; cc < 3; ++cc)
+					for (int ii = 0; ii < parameters.size(); ++ii)
+						corners[cc](ii) = mpfr::rand();
+
+				std::atomic<std::size_t> next(0), num_failed(0);
+				std::atomic<bool> stop(false);
+				std::mutex on_endpoint_mutex;
+
+				detail::RunWorkers(num_threads, stop, [&](unsigned worker)
+				{
+					System const& sys = *worker_homotopies[worker];
+					TrackerType tracker(sys);
+					setup(tracker);
+
+					std::size_t ii;
+					while (!stop && (ii = next++) < starts.size())
+					{
+						Vec<ComplexType> point = starts[ii], start;
+						auto code = SuccessCode::Success;
+						for (unsigned side = 0; side < 3 && code==SuccessCode::Success; ++side)
+						{
+							// the values of the parameters change precision with the system, so are set anew for each side
+							DefaultPrecision(precision);
+							ph.SetPath(sys, corners[side], corners[side+1]);
+
+							start = point;
+							code = tracker.TrackPath(point, ComplexType(1), ComplexType(0), start);
+						}
+
+						if (code!=SuccessCode::Success)
+						{
+							++num_failed;
+							continue;
+						}
+
+						std::lock_guard<std::mutex> lock(on_endpoint_mutex);
+						on_endpoint(point);
+					}
+				});
+
+				return static_cast<std::size_t>(num_failed);
+			};
+
+			MonodromyResults<ComplexType> results;
+			results.loops = detail::TrackLoops(found, config, track_loop);
+			results.solutions = found.Points();
+			return results;
+		}
+
+
+		/**
+		\brief Find all the points of a witness set from some of them, by moving its slice around random loops of slices.
+
+		For each loop, the points are moved along each of its sides by MoveWitnessPoints, on a pool of threads.
+
+		\param system The functions of the component, as for MoveWitnessPoints.
+		\param slice The slice of the witness set.
+		\param points Some of its points on the component.
+		\param setup Configure a freshly made tracker.
+		\param config When to stop.  The expected count is the degree of the component, if known.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\throws std::runtime_error if there are no points, or the system and slice do not fit together, as for a witness set.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename SetupFunction>
+		MonodromyResults<typename TrackerTraits<TrackerType>::BaseComplexType>
+		CompleteWitnessSet(System const& system, LinearSlice const& slice,
+		                   std::vector< Vec<typename TrackerTraits<TrackerType>::BaseComplexType> > const& points,
+		                   SetupFunction setup, MonodromyConfig const& config = MonodromyConfig(), unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			if (points.empty())
+				throw std::runtime_error("completing witness set by monodromy, but given no witness points");
+
+			SolutionSet<ComplexType> found(system.NumVariables(), config.duplicate_tolerance);
+			for (const auto& p : points)
+				found.Insert(p);
+
+			auto track_loop = [&](std::vector< Vec<ComplexType> > const& starts, std::function<void(Vec<ComplexType> const&)> on_endpoint)
+			{
+				const std::vector< LinearSlice > corners{slice,
+				                                         LinearSlice::RandomComplex(system.Variables(), slice.Dimension(), slice.IsHomogeneous()),
+				                                         LinearSlice::RandomComplex(system.Variables(), slice.Dimension(), slice.IsHomogeneous()),
+				                                         slice};
+
+				auto current = starts;
+				for (unsigned side = 0; side < 3; ++side)
+				{
+					const auto moved = MoveWitnessPoints<TrackerType>(system, corners[side], current, corners[side+1], setup, num_threads);
+					current.clear();
+					for (const auto& path : moved)
+						if (path.success_code==SuccessCode::Success)
+							current.push_back(path.endpoint);
+				}
+
+				for (const auto& p : current)
+					on_endpoint(p);
+				return starts.size() - current.size();
+			};
+
+			MonodromyResults<ComplexType> results;
+			results.loops = detail::TrackLoops(found, config, track_loop);
+			results.solutions = found.Points();
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,380 @@
+//This file is part of Bertini 2.
+//
+//mpi_tracking.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mpi_tracking.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mpi_tracking.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file mpi_tracking.hpp
+
+\brief Track every path of a homotopy across the processes of an MPI communicator.
+
+Available when configured with --enable-mpi.  Rank 0 is the master.  It serializes the homotopy and start system once and broadcasts them, then hands out ranges of start point indices to the workers as they ask for them, and passes the endpoints they send back to a sink as they arrive.  The size of a range follows the observed cost of a path, so that a worker spends about the same time on each, whether paths take microseconds or minutes, and shrinks as the paths run out, so that the last ranges finish together.
+*/
+
+#ifndef BERTINI_TRACKING_MPI_TRACKING_HPP
+#define BERTINI_TRACKING_MPI_TRACKING_HPP
+
+#include "bertini2/config.h"
+
+#ifdef BERTINI_ENABLE_MPI
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <mpi.h>
+
+#include <climits>
+#include <exception>
+#include <stdexcept>
+
+namespace bertini {
+	namespace tracking {
+		namespace mpi {
+
+			/**
+			\brief Settings for handing out paths to workers.
+			*/
+			struct DistributionConfig
+			{
+				double target_chunk_seconds = 2; ///< The time a worker should spend on one range of paths.  Longer amortizes the messages better, shorter balances better.
+				unsigned initial_chunk_size = 1; ///< The number of paths in each range handed out before any has been timed.
+				unsigned max_chunk_size = 100000; ///< The most paths in one range, which bounds the size of a message of endpoints.
+			};
+
+
+			namespace detail {
+
+				enum MessageTag : int
+				{
+					ResultsTag = 1, ///< worker to master: the endpoints of a range, and a request for another
+					ErrorTag, ///< worker to master: what a worker threw, after which it stops
+					WorkTag, ///< master to worker: a range of start point indices
+					StopTag ///< master to worker: there is nothing more to do
+				};
+
+
+				/**
+				\brief Send a message, of at most INT_MAX bytes, as MPI counts in int.
+
+				\throws std::runtime_error if the message is longer.
+				*/
+				inline
+				void Send(std::string const& message, int destination, int tag, MPI_Comm comm)
+				{
+					if (message.size() > static_cast<std::size_t>(INT_MAX))
+						throw std::runtime_error("message of " + std::to_string(message.size()) + " bytes is longer than the " + std::to_string(INT_MAX) + " one MPI message can carry");
+					MPI_Send(const_cast<char*>(message.data()), static_cast<int>(message.size()), MPI_CHAR, destination, tag, comm);
+				}
+
+				/**
+				\brief Receive a message of any length.
+
+				\param source The rank to receive from, or MPI_ANY_SOURCE.
+				\param status Receives the source and tag of the message.
+				*/
+				inline
+				std::string Receive(int source, MPI_Comm comm, MPI_Status & status)
+				{
+					MPI_Probe(source, MPI_ANY_TAG, comm, &status);
+					int length;
+					MPI_Get_count(&status, MPI_CHAR, &length);
+
+					std::string message(length, '\0');
+					MPI_Recv(&message[0], length, MPI_CHAR, status.MPI_SOURCE, status.MPI_TAG, comm, MPI_STATUS_IGNORE);
+					return message;
+				}
+
+
+				/**
+				\brief The number of paths to hand out next.
+
+				\param remaining The number of paths not yet handed out.
+				\param num_workers The number of worker processes.
+				\param seconds The time workers have spent on the paths they have finished.
+				\param paths The number of paths finished.
+				*/
+				inline
+				mpz_int ChunkSize(mpz_int const& remaining, unsigned num_workers, double seconds, double paths, DistributionConfig const& config)
+				{
+					double wanted = config.initial_chunk_size;
+					if (paths > 0)
+						wanted = seconds > 0 ? config.target_chunk_seconds * paths / seconds : config.max_chunk_size;
+					wanted = std::min(std::max(wanted, 1.), double(config.max_chunk_size));
+
+					mpz_int chunk(static_cast<unsigned long>(wanted));
+
+					// past this, the last ranges are split finely, so that no worker is left with a long one while the others idle
+					const mpz_int tail_share = remaining / (2*num_workers);
+					if (chunk > tail_share)
+						chunk = tail_share;
+					if (chunk < 1)
+						chunk = 1;
+					return chunk;
+				}
+
+
+				template<typename TrackerType, typename StartSystemType, typename SetupFunction>
+				void Work(SetupFunction& setup, MPI_Comm comm)
+				{
+					using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+					unsigned long long length;
+					MPI_Bcast(&length, 1, MPI_UNSIGNED_LONG_LONG, 0, comm);
+					if (length==0) // the master failed to make the problem, and throws
+						return;
+					std::string problem(length, '\0');
+					MPI_Bcast(&problem[0], static_cast<int>(length), MPI_CHAR, 0, comm);
+
+					try
+					{
+						System homotopy;
+						StartSystemType start_system;
+						ComplexType start_time, end_time;
+						unsigned precision;
+						{
+							std::istringstream in(problem);
+							boost::archive::binary_iarchive ia(in);
+							ia >> precision;
+							DefaultPrecision(precision);
+							ia >> homotopy >> start_system >> start_time >> end_time;
+						}
+
+						TrackerType tracker(homotopy);
+						setup(tracker);
+
+						// the first, empty, report is the request for work
+						double seconds = 0;
+						std::vector< PathResult<ComplexType> > results;
+						while (true)
+						{
+							Send(tracking::detail::Archive(std::make_pair(seconds, results)), 0, ResultsTag, comm);
+
+							MPI_Status status;
+							auto message = Receive(0, comm, status);
+							if (status.MPI_TAG == StopTag)
+								return;
+
+							auto range = tracking::detail::CloneFromArchive< std::pair<mpz_int, mpz_int> >(message);
+
+							const double started = MPI_Wtime();
+							results.clear();
+							for (mpz_int ii = range.first; ii < range.second; ++ii)
+							{
+								DefaultPrecision(precision);
+
+								auto start_point = start_system.template StartPoint<ComplexType>(ii);
+
+								results.emplace_back();
+								results.back().index = static_cast<std::size_t>(ii);
+								tracker.ResetStatistics();
+								results.back().success_code = tracker.TrackPath(results.back().endpoint, start_time, end_time, start_point);
+								results.back().time = tracker.CurrentTime();
+								results.back().statistics = tracker.Statistics();
+							}
+							seconds = MPI_Wtime() - started;
+						}
+					}
+					catch (std::exception const& e)
+					{
+						Send(e.what(), 0, ErrorTag, comm);
+					}
+					catch (...)
+					{
+						Send("unknown exception", 0, ErrorTag, comm);
+					}
+				}
+
+
+				template<typename ComplexType, typename StartSystemType, typename ResultSink>
+				void Master(System const& homotopy, StartSystemType const& start_system,
+				            ComplexType const& start_time, ComplexType const& end_time,
+				            ResultSink& sink, MPI_Comm comm, int num_ranks, DistributionConfig const& config)
+				{
+					std::string problem;
+					try
+					{
+						std::ostringstream out;
+						{
+							boost::archive::binary_oarchive oa(out);
+							const unsigned precision = DefaultPrecision();
+							oa << precision;
+							// in one archive, so that nodes the start system shares with the homotopy stay shared
+							oa << homotopy << start_system << start_time << end_time;
+						}
+						problem = out.str();
+
+						// MPI counts in int
+						if (problem.size() > static_cast<std::size_t>(INT_MAX))
+							throw std::runtime_error("the serialized homotopy and start system take " + std::to_string(problem.size()) + " bytes, more than the " + std::to_string(INT_MAX) + " one MPI message can carry");
+					}
+					catch (...)
+					{
+						// the workers are waiting for the problem.  a length of 0 sends them home
+						unsigned long long nothing = 0;
+						MPI_Bcast(&nothing, 1, MPI_UNSIGNED_LONG_LONG, 0, comm);
+						throw;
+					}
+					unsigned long long length = problem.size();
+					MPI_Bcast(&length, 1, MPI_UNSIGNED_LONG_LONG, 0, comm);
+					MPI_Bcast(&problem[0], static_cast<int>(length), MPI_CHAR, 0, comm);
+
+					const unsigned num_workers = num_ranks-1;
+					const mpz_int num_paths = start_system.NumStartPoints();
+					mpz_int next_path(0);
+
+					double seconds = 0, paths = 0;
+					std::string failure;
+					std::exception_ptr error; // what the master itself threw, as the sink did
+
+					try
+					{
+						for (unsigned active_workers = num_workers; active_workers > 0; )
+						{
+							MPI_Status status;
+							auto message = Receive(MPI_ANY_SOURCE, comm, status);
+							const int worker = status.MPI_SOURCE;
+
+							if (status.MPI_TAG == ErrorTag)
+							{
+								if (failure.empty())
+									failure = "worker " + std::to_string(worker) + " failed: " + message;
+								next_path = num_paths; // stop the others at their next request
+								--active_workers;
+								continue;
+							}
+
+							// after a failure here, the endpoints still arriving are dropped, and every worker is answered with StopTag, so none is left waiting
+							if (!error)
+								try
+								{
+									auto report = tracking::detail::CloneFromArchive< std::pair<double, std::vector< PathResult<ComplexType> > > >(message);
+									seconds += report.first;
+									paths += report.second.size();
+									for (auto& result : report.second)
+										sink(std::move(result));
+								}
+								catch (...)
+								{
+									error = std::current_exception();
+									next_path = num_paths;
+								}
+
+							if (next_path < num_paths)
+							{
+								const mpz_int remaining = num_paths - next_path;
+								const mpz_int end_path = next_path + ChunkSize(remaining, num_workers, seconds, paths, config);
+								Send(tracking::detail::Archive(std::make_pair(next_path, end_path)), worker, WorkTag, comm);
+								next_path = end_path;
+							}
+							else
+							{
+								Send(std::string(), worker, StopTag, comm);
+								--active_workers;
+							}
+						}
+					}
+					catch (...)
+					{
+						// failing to talk to the workers at all, there is no telling them to stop
+						MPI_Abort(comm, 1);
+						throw;
+					}
+
+					if (error)
+						std::rethrow_exception(error);
+
+					if (!failure.empty())
+						throw std::runtime_error(failure);
+				}
+
+			} // namespace detail
+
+
+
+			/**
+			\brief Track from every start point of a start system, across the processes of an MPI communicator, passing each endpoint to a sink as it arrives.
+
+			Call from every rank of the communicator, after MPI_Init.  Rank 0 hands out the paths and receives the endpoints; the other ranks track.  A run of 10^7 paths never holds more than the endpoints of one range per worker at once, so the sink should write them out, or keep only what it needs.
+
+			## Use
+
+			\code
+			auto results = std::ofstream("endpoints");
+			mpi::TrackAllPaths<AMPTracker>(homotopy, TD, [&](AMPTracker & tracker)
+				{
+					tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+					tracker.PrecisionSetup(AMP);
+				},
+				mpfr(1), mpfr(0),
+				[&](PathResult<mpfr> && r)
+				{
+					results << r.index << " " << int(r.success_code) << "\n" << r.endpoint << "\n";
+				});
+			\endcode
+
+			The workers receive the homotopy, start system, times and default precision of rank 0, so the arguments for them are only read on rank 0.  Each worker builds its tracker on its copy of the homotopy and passes it to setup, which must therefore do the same thing on every rank.  Each rank tracks on one thread; run one rank per core.  On a communicator of one process, this runs TrackAllPaths on a pool of threads instead, passing the endpoints to the sink as they finish in the same way.
+
+			\param homotopy The system to track on.  Significant only on rank 0.
+			\param start_system The source of the start points.  Significant only on rank 0.
+			\param setup Configure a freshly made tracker.  Called on every worker.
+			\param start_time The time at which the start points solve the homotopy.  Significant only on rank 0.
+			\param end_time The time to track to.  Significant only on rank 0.
+			\param sink Called on rank 0 with the PathResult of each path, in the order they arrive.
+			\param comm The communicator to run on.
+			\param config How to size the ranges of paths handed out.
+
+			\throws std::runtime_error On rank 0, if a worker threw, after all workers have stopped.  The message says which worker, and what it threw.  Also if the serialized homotopy and start system are too long for one MPI message, after the workers have been sent home.
+			\throws Whatever the sink threw, on rank 0, after all workers have been told to stop.
+			*/
+			template<typename TrackerType, typename StartSystemType, typename SetupFunction, typename ResultSink>
+			void TrackAllPaths(System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+			                   typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+			                   typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+			                   ResultSink sink,
+			                   MPI_Comm comm = MPI_COMM_WORLD,
+			                   DistributionConfig const& config = DistributionConfig())
+			{
+				int rank, num_ranks;
+				MPI_Comm_rank(comm, &rank);
+				MPI_Comm_size(comm, &num_ranks);
+
+				if (num_ranks==1)
+				{
+					tracking::TrackAllPaths<TrackerType>(homotopy, start_system, setup, start_time, end_time, sink);
+					return;
+				}
+
+				if (rank==0)
+					detail::Master(homotopy, start_system, start_time, end_time, sink, comm, num_ranks, config);
+				else
+					detail::Work<TrackerType, StartSystemType>(setup, comm);
+			}
+
+		} // namespace mpi
+	} // namespace tracking
+} // namespace bertini
+
+#endif // BERTINI_ENABLE_MPI
+
+#endif
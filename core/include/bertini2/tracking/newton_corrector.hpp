@@ -12,6 +12,9 @@
 #include "bertini2/tracking/amp_criteria.hpp"
 #include "bertini2/tracking/tracking_config.hpp"
 #include "bertini2/system.hpp"
+#include "bertini2/lu.hpp"
+#include "bertini2/tracking/condition_estimate.hpp"
+#include "bertini2/tracking/instrumentation.hpp"
 
 
 namespace bertini{
@@ -67,6 +70,8 @@ namespace bertini{
 				void Settings(const config::Newton& newton_settings)
 				{
 					newton_config_ = newton_settings;
+					std::get< PartialPivotLU<dbl> >(LU_).RefinementSteps(newton_settings.lu_refinement_steps);
+					std::get< PartialPivotLU<mpfr> >(LU_).RefinementSteps(newton_settings.lu_refinement_steps);
 				}
 				
 				
@@ -84,17 +89,69 @@ namespace bertini{
 					Precision(std::get< Vec<mpfr> >(f_temp_), new_precision);
 					Precision(std::get< Vec<mpfr> >(step_temp_), new_precision);
 					Precision(std::get< Mat<mpfr> >(J_temp_), new_precision);
+					Precision(std::get< Vec<mpfr> >(trial_space_), new_precision);
+					Precision(std::get< Vec<mpfr> >(trial_f_), new_precision);
 
-					std::get< Eigen::PartialPivLU<Mat<mpfr>> >(LU_) = Eigen::PartialPivLU<Mat<mpfr>>(numTotalFunctions_);
+					std::get< PartialPivotLU<mpfr> >(LU_).ChangePrecision(new_precision);
+					Precision(residual_mp_, new_precision);
+					Precision(correction_mp_, new_precision);
 
+					ResetNormJInverseEstimate();
 					current_precision_ = new_precision;				
 				}
 
 
+				/**
+				 \brief Forget the estimates of the norm of the inverse of the Jacobian, so that none is reused.  Call this at the start of a path.
+				 */
+				void ResetNormJInverseEstimate()
+				{
+					std::get< NormInverseEstimator<dbl> >(norm_J_inverse_estimator_).Reset();
+					std::get< NormInverseEstimator<mpfr> >(norm_J_inverse_estimator_).Reset();
+				}
+
+
+				/**
+				 \brief Set the profile the evaluations and linear solves of Newton's method are timed into.  Null for none.
+				 */
+				void Instrument(instrument::Profile* profile)
+				{
+					profile_ = profile;
+				}
+
+
 				unsigned precision() const
 				{
 					return current_precision_;
 				}
+
+				/**
+				 \brief The iterations of Newton's method run since construction, counting those redone with a fresh Jacobian.
+				 */
+				std::uint64_t NumIterations() const
+				{
+					return num_iterations_;
+				}
+
+				/**
+				 \brief The evaluations of the system, alone or with its Jacobian, made since construction, counting those of the line search.
+				 */
+				std::uint64_t NumEvaluations() const
+				{
+					return num_evaluations_;
+				}
+
+				/**
+				\brief The memory held by the workspace of the corrector.  The factorizations of the Jacobian are not counted.
+				*/
+				MemoryUsage MemoryReport() const
+				{
+					using memory::HeapBytes;
+					MemoryUsage report;
+					report.Add("jacobian", HeapBytes(J_temp_));
+					report.Add("vectors", HeapBytes(f_temp_) + HeapBytes(step_temp_) + HeapBytes(trial_space_) + HeapBytes(trial_f_) + HeapBytes(residual_mp_) + HeapBytes(correction_mp_) + HeapBytes(residual_d_) + HeapBytes(correction_d_));
+					return report;
+				}
 				
 				/**
 				 \brief Change the system(number of total functions) that the predictor uses.
@@ -112,6 +169,22 @@ namespace bertini{
 					std::get< Vec<mpfr> >(f_temp_).resize(numTotalFunctions_);
 					std::get< Vec<dbl> >(step_temp_).resize(numTotalFunctions_);
 					std::get< Vec<mpfr> >(step_temp_).resize(numTotalFunctions_);
+					std::get< Vec<dbl> >(trial_space_).resize(numVariables_);
+					std::get< Vec<mpfr> >(trial_space_).resize(numVariables_);
+					std::get< Vec<dbl> >(trial_f_).resize(numTotalFunctions_);
+					std::get< Vec<mpfr> >(trial_f_).resize(numTotalFunctions_);
+					std::get< PartialPivotLU<dbl> >(LU_).Resize(numTotalFunctions_);
+					std::get< PartialPivotLU<mpfr> >(LU_).Resize(numTotalFunctions_);
+					std::get< PartialPivotLU<dbl> >(LU_).UseThreads(S.EvaluationTeam());
+					std::get< PartialPivotLU<mpfr> >(LU_).UseThreads(S.EvaluationTeam());
+					const auto sparsity = S.LinearSolveStructure();
+					std::get< PartialPivotLU<dbl> >(LU_).UseSparsity(sparsity);
+					std::get< PartialPivotLU<mpfr> >(LU_).UseSparsity(sparsity);
+					residual_mp_.resize(numTotalFunctions_);
+					correction_mp_.resize(numTotalFunctions_);
+					residual_d_.resize(numTotalFunctions_);
+					correction_d_.resize(numTotalFunctions_);
+					ResetNormJInverseEstimate();
 				}
 
 				
@@ -157,17 +230,40 @@ namespace bertini{
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
 					next_space = current_space;
-					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
+					bool refresh_jacobian = true;
+					RealType norm_previous_step(0);
+					for (unsigned ii = 0; ii < max_num_newton_iterations; )
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time, refresh_jacobian);
 						if(success_code != SuccessCode::Success)
 							return success_code;
+
+						RealType norm_step = step_ref.norm();
+						if (!refresh_jacobian && !ChordContracted(norm_step, norm_previous_step))
+						{
+							refresh_jacobian = true; // redo the iteration with a fresh Jacobian
+							continue;
+						}
+
+						if (!(norm_step < tracking_tolerance) && !LineSearch(step_ref, S, next_space, current_time))
+						{
+							if (!refresh_jacobian)
+							{
+								refresh_jacobian = true; // a stale Jacobian may point the wrong way
+								continue;
+							}
+							return SuccessCode::FailedToConverge;
+						}
 						
 						next_space += step_ref;
 						
-						if ( (step_ref.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
+						if ( (norm_step < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
+
+						norm_previous_step = norm_step;
+						refresh_jacobian = !newton_config_.reuse_jacobian;
+						++ii;
 					}
 					
 					return SuccessCode::FailedToConverge;
@@ -216,27 +312,56 @@ namespace bertini{
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
 					next_space = current_space;
-					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
+					bool refresh_jacobian = true;
+					RealType norm_previous_step(0);
+					for (unsigned ii = 0; ii < max_num_newton_iterations; )
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time, refresh_jacobian);
 						if(success_code != SuccessCode::Success)
 							return success_code;
+
+						RealType norm_step = step_ref.norm();
+						if (!refresh_jacobian && !ChordContracted(norm_step, norm_previous_step))
+						{
+							refresh_jacobian = true; // redo the iteration with a fresh Jacobian
+							continue;
+						}
+
+						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
+
+						if (!(norm_step < tracking_tolerance) && !LineSearch(step_ref, S, next_space, current_time))
+						{
+							if (!refresh_jacobian)
+							{
+								refresh_jacobian = true; // a stale Jacobian may point the wrong way
+								continue;
+							}
+							return LineSearchFailure(J_temp_ref.norm(), EstimateNormJInverse<ComplexType>(AMP_config), max_num_newton_iterations - ii, tracking_tolerance, norm_step, AMP_config);
+						}
 						
 						next_space += step_ref;
 						
-						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
-						
-						if ( (step_ref.norm() < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
+						if ( (norm_step < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
 						
-						auto norm_J_inverse = LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm();
-						if (!amp::CriterionB(J_temp_ref.norm(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, step_ref.norm(), AMP_config))
-							return SuccessCode::HigherPrecisionNecessary;
-						
-						if (!amp::CriterionC(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
+						auto norm_J_inverse = EstimateNormJInverse<ComplexType>(AMP_config);
+						if (!amp::CriterionB(J_temp_ref.norm(), norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, norm_step, AMP_config)
+						    || !amp::CriterionC(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
+						{
+							// a step from a reused Jacobian may be long for its staleness rather than the precision, so the precision is judged on a fresh one
+							if (!refresh_jacobian)
+							{
+								next_space -= step_ref;
+								refresh_jacobian = true;
+								continue;
+							}
 							return SuccessCode::HigherPrecisionNecessary;
+						}
+
+						norm_previous_step = norm_step;
+						refresh_jacobian = !newton_config_.reuse_jacobian;
+						++ii;
 					}
 					
 					return SuccessCode::FailedToConverge;
@@ -290,22 +415,41 @@ namespace bertini{
 					Vec<ComplexType>& step_ref = std::get< Vec<ComplexType> >(step_temp_);
 					
 					next_space = current_space;
-					for (unsigned ii = 0; ii < max_num_newton_iterations; ++ii)
+					bool refresh_jacobian = true;
+					RealType norm_previous_step(0);
+					for (unsigned ii = 0; ii < max_num_newton_iterations; )
 					{
 						//Update the newton iterate by one iteration
-						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time);
+						auto success_code = EvalIterationStep(step_ref, S, next_space, current_time, refresh_jacobian);
 						if(success_code != SuccessCode::Success)
 							return success_code;
-						
-						next_space += step_ref;
-						
+
+						norm_delta_z = step_ref.norm();
+						if (!refresh_jacobian && !ChordContracted(norm_delta_z, norm_previous_step))
+						{
+							refresh_jacobian = true; // redo the iteration with a fresh Jacobian
+							continue;
+						}
+
 						Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
-						Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
+
+						if (!(norm_delta_z < tracking_tolerance) && !LineSearch(step_ref, S, next_space, current_time))
+						{
+							if (!refresh_jacobian)
+							{
+								refresh_jacobian = true; // a stale Jacobian may point the wrong way
+								continue;
+							}
+							norm_J = J_temp_ref.norm();
+							norm_J_inverse = EstimateNormJInverse<ComplexType>(AMP_config);
+							condition_number_estimate = norm_J*norm_J_inverse;
+							return LineSearchFailure(norm_J, norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, norm_delta_z, AMP_config);
+						}
 						
+						next_space += step_ref;
 						
-						norm_delta_z = step_ref.norm();
 						norm_J = J_temp_ref.norm();
-						norm_J_inverse = LU_ref.solve(RandomOfUnits<ComplexType>(S.NumVariables())).norm();
+						norm_J_inverse = EstimateNormJInverse<ComplexType>(AMP_config);
 						condition_number_estimate = norm_J*norm_J_inverse;
 						
 						
@@ -313,11 +457,22 @@ namespace bertini{
 						if ( (norm_delta_z < tracking_tolerance) && (ii >= (min_num_newton_iterations-1)) )
 							return SuccessCode::Success;
 						
-						if (!amp::CriterionB(norm_J, norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, norm_delta_z, AMP_config))
-							return SuccessCode::HigherPrecisionNecessary;
-						
-						if (!amp::CriterionC(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
+						if (!amp::CriterionB(norm_J, norm_J_inverse, max_num_newton_iterations - ii, tracking_tolerance, norm_delta_z, AMP_config)
+						    || !amp::CriterionC(norm_J_inverse, next_space, tracking_tolerance, AMP_config))
+						{
+							// a step from a reused Jacobian may be long for its staleness rather than the precision, so the precision is judged on a fresh one
+							if (!refresh_jacobian)
+							{
+								next_space -= step_ref;
+								refresh_jacobian = true;
+								continue;
+							}
 							return SuccessCode::HigherPrecisionNecessary;
+						}
+
+						norm_previous_step = norm_delta_z;
+						refresh_jacobian = !newton_config_.reuse_jacobian;
+						++ii;
 					}
 					
 					return SuccessCode::FailedToConverge;
@@ -340,31 +495,234 @@ namespace bertini{
 				 \param S The system used in the computations
 				 \param current_space The space from the previous Newton iteration
 				 \param current_time The time from the previous Newton iteration
+				 \param refresh_jacobian Whether to evaluate and factor the Jacobian, rather than solve with the factorization from the last iteration, which must have been made in this correction.
 				 
 				 */
 				
 				template<typename ComplexType, typename Derived>
 				SuccessCode EvalIterationStep(Vec<ComplexType> & newton_step,
 											  const System& S,
-											  const Eigen::MatrixBase<Derived>& current_space, const ComplexType& current_time)
+											  const Eigen::MatrixBase<Derived>& current_space, const ComplexType& current_time,
+											  bool refresh_jacobian = true)
 				{
 					Vec<ComplexType>& f_temp_ref = std::get< Vec<ComplexType> >(f_temp_);
 					Mat<ComplexType>& J_temp_ref = std::get< Mat<ComplexType> >(J_temp_);
 					
-					Eigen::PartialPivLU< Mat<ComplexType> >& LU_ref = std::get< Eigen::PartialPivLU< Mat<ComplexType> > >(LU_);
+					PartialPivotLU<ComplexType>& LU_ref = std::get< PartialPivotLU<ComplexType> >(LU_);
+
+					++num_iterations_;
+					if (!refresh_jacobian)
+					{
+						++num_evaluations_;
+						{
+							BERTINI_TIME_PHASE(profile_, SystemEvaluation, current_precision_);
+							S.EvalInPlace(f_temp_ref, current_space, current_time);
+						}
+						BERTINI_TIME_PHASE(profile_, LinearSolve, current_precision_);
+						if (!last_solve_mixed_)
+						{
+							LU_ref.SolveNegative(newton_step, f_temp_ref);
+							return SuccessCode::Success;
+						}
+						// the residuals are formed with the Jacobian of the factorization, so the step is the chord step
+						if (MixedPrecisionSolve(newton_step, f_temp_ref, J_temp_ref, false))
+							return SuccessCode::Success;
+					}
 					
-					S.EvalInPlace(f_temp_ref, current_space, current_time);
-					S.JacobianInPlace(J_temp_ref, current_space, current_time);
-					LU_ref = J_temp_ref.lu();
+					++num_evaluations_;
+					{
+						BERTINI_TIME_PHASE(profile_, JacobianEvaluation, current_precision_);
+						S.EvalAndJacobianInPlace(f_temp_ref, J_temp_ref, current_space, current_time);
+					}
+
+					BERTINI_TIME_PHASE(profile_, LinearSolve, current_precision_);
+					last_solve_mixed_ = MixedPrecisionSolve(newton_step, f_temp_ref, J_temp_ref);
+					if (last_solve_mixed_)
+						return SuccessCode::Success;
+
+					LU_ref.Factor(J_temp_ref);
 					
-					if (LUPartialPivotDecompositionSuccessful(LU_ref.matrixLU())!=MatrixSuccessCode::Success)
+					if (LU_ref.DecompositionSuccess()!=MatrixSuccessCode::Success)
 						return SuccessCode::MatrixSolveFailure;
 					
-					newton_step = LU_ref.solve(-f_temp_ref);
+					LU_ref.SolveNegative(newton_step, f_temp_ref);
 					
 					return SuccessCode::Success;
 					
 				}
+
+
+				/**
+				 \brief There is no lower precision to factor in, for double precision.
+				 */
+				bool MixedPrecisionSolve(Vec<dbl> &, Vec<dbl> const&, Mat<dbl> const&, bool = true)
+				{
+					return false;
+				}
+
+				/**
+				 \brief Solve J*newton_step = -f by factoring J in double precision, and refining with residuals in the working precision.
+
+				 Each refinement costs a double precision solve and a multiple precision matrix-vector product, rather than the multiple precision factorization.  The residual is scaled to unit size before it is rounded to double, so that it neither underflows nor overflows as it shrinks.  Refinement stops when the correction is negligible at the working precision.
+
+				 \param factor Whether to factor J, rather than reuse the double factorization of the last call.
+
+				 \return Whether the step was computed.  If not, because the mode is off, the precision is below its threshold, the double factorization failed, or refinement stalled or ran out of iterations, the caller factors J in full precision.
+				 */
+				bool MixedPrecisionSolve(Vec<mpfr> & newton_step, Vec<mpfr> const& f, Mat<mpfr> const& J, bool factor = true)
+				{
+					if (!newton_config_.mixed_precision_solve || current_precision_ < newton_config_.mixed_precision_min_digits)
+						return false;
+
+					Mat<dbl>& J_d = std::get< Mat<dbl> >(J_temp_);
+					PartialPivotLU<dbl>& LU_d = std::get< PartialPivotLU<dbl> >(LU_);
+
+					if (factor)
+					{
+						for (unsigned ii = 0; ii < numTotalFunctions_; ++ii)
+							for (unsigned jj = 0; jj < numVariables_; ++jj)
+								J_d(ii,jj) = dbl(J(ii,jj));
+
+						LU_d.Factor(J_d);
+						if (LU_d.DecompositionSuccess()!=MatrixSuccessCode::Success)
+							return false;
+					}
+
+					const mpfr_float negligible = pow(mpfr_float(10), -int(current_precision_));
+
+					newton_step.resize(numVariables_);
+					for (unsigned ii = 0; ii < numVariables_; ++ii)
+						newton_step(ii) = mpfr(0);
+
+					// the residual of the zero step is -f
+					for (unsigned ii = 0; ii < numTotalFunctions_; ++ii)
+					{
+						residual_mp_(ii) = f(ii);
+						Negate(residual_mp_(ii));
+					}
+
+					mpfr_float previous_correction;
+					for (unsigned iteration = 0; iteration <= newton_config_.max_mixed_precision_refinements; ++iteration)
+					{
+						mpfr_float scale = residual_mp_.lpNorm<Eigen::Infinity>();
+						if (scale==0)
+							return true;
+						const mpfr scale_c(scale);
+
+						for (unsigned ii = 0; ii < numTotalFunctions_; ++ii)
+							residual_d_(ii) = dbl(residual_mp_(ii)/scale);
+
+						LU_d.Solve(correction_d_, residual_d_);
+
+						// the correction is scale*correction_d_.  it must shrink steadily, or the double factorization is too poorly conditioned to converge
+						mpfr_float correction_size = scale*correction_d_.lpNorm<Eigen::Infinity>();
+						if (iteration>0 && !(correction_size < previous_correction/2))
+							return false;
+						previous_correction = correction_size;
+
+						for (unsigned ii = 0; ii < numVariables_; ++ii)
+						{
+							SetAtPrecision(correction_mp_(ii), correction_d_(ii), current_precision_);
+							correction_mp_(ii) *= scale_c;
+							newton_step(ii) += correction_mp_(ii);
+						}
+
+						if (correction_mp_.lpNorm<Eigen::Infinity>() <= negligible*newton_step.lpNorm<Eigen::Infinity>())
+							return true;
+
+						// the new residual, -f - J*newton_step, in the working precision
+						for (unsigned ii = 0; ii < numTotalFunctions_; ++ii)
+						{
+							residual_mp_(ii) = f(ii);
+							Negate(residual_mp_(ii));
+							for (unsigned jj = 0; jj < numVariables_; ++jj)
+								MultiplySubtract(residual_mp_(ii), J(ii,jj), newton_step(jj));
+						}
+					}
+
+					return false;
+				}
+
+
+				/**
+				 \brief Shorten a Newton step until it decreases the norm of the functions enough, by Armijo backtracking, if line search is on.
+
+				 Lengths of 1, then line_search_backtrack, and its powers, of the step are tried, and the first at which the norm of the functions is at most 1 - c*length of their norm at current_space, with c the line_search_sufficient_decrease, is taken.  The step was computed at current_space, where the functions are in f_temp_.  The AMP criteria are judged on the whole Newton step still, as it is that step whose length they bound, and the shortened one is only where the iterate goes.
+
+				 \param newton_step The step, shortened in place to the length taken.
+
+				 \return Whether a length was taken.  Always if line search is off.
+				 */
+				template<typename ComplexType, typename Derived>
+				bool LineSearch(Vec<ComplexType> & newton_step, System const& S, Eigen::MatrixBase<Derived> const& current_space, ComplexType const& current_time)
+				{
+					using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+					if (!newton_config_.line_search)
+						return true;
+
+					Vec<ComplexType>& trial_space = std::get< Vec<ComplexType> >(trial_space_);
+					Vec<ComplexType>& trial_f = std::get< Vec<ComplexType> >(trial_f_);
+					const RealType norm_f = std::get< Vec<ComplexType> >(f_temp_).norm();
+
+					double length = 1;
+					for (unsigned ii = 0; ii <= newton_config_.max_line_search_backtracks; ++ii, length *= newton_config_.line_search_backtrack)
+					{
+						trial_space = current_space + ComplexType(length)*newton_step;
+						++num_evaluations_;
+						{
+							BERTINI_TIME_PHASE(profile_, SystemEvaluation, current_precision_);
+							S.EvalInPlace(trial_f, trial_space, current_time);
+						}
+
+						const RealType norm_trial = trial_f.norm();
+						if (norm_trial==0 || norm_trial <= RealType(1 - newton_config_.line_search_sufficient_decrease*length)*norm_f)
+						{
+							if (length < 1)
+								newton_step *= ComplexType(length);
+							return true;
+						}
+					}
+					return false;
+				}
+
+
+				/**
+				 \brief What a correction whose line search found no length to take has come to: more precision, if the whole Newton step breaks AMP criterion B, so the step was lost in the noise of the precision, and a failure to converge otherwise.
+				 */
+				template<typename RealType>
+				SuccessCode LineSearchFailure(RealType const& norm_J, RealType const& norm_J_inverse, unsigned num_newton_iterations_remaining, RealType const& tracking_tolerance, RealType const& norm_step, config::AdaptiveMultiplePrecisionConfig const& AMP_config) const
+				{
+					if (!amp::CriterionB(norm_J, norm_J_inverse, num_newton_iterations_remaining, tracking_tolerance, norm_step, AMP_config))
+						return SuccessCode::HigherPrecisionNecessary;
+					return SuccessCode::FailedToConverge;
+				}
+
+
+				/**
+				 \brief Whether a step made with a reused Jacobian shrank enough from the one before it to keep reusing the Jacobian.
+
+				 The chord iteration converges linearly, at the rate the Jacobian's staleness allows, so a slow rate is the sign to refresh it.
+				 */
+				template<typename RealType>
+				bool ChordContracted(RealType const& norm_step, RealType const& norm_previous_step) const
+				{
+					return norm_step <= RealType(newton_config_.max_chord_contraction) * norm_previous_step;
+				}
+
+
+				/**
+				 \brief Estimate the norm of the inverse of the Jacobian from the last factorization, as the AMP settings say.
+
+				 After a mixed precision solve, the factorization is the double precision one, which is plenty for an estimate.
+				 */
+				template<typename ComplexType>
+				typename Eigen::NumTraits<ComplexType>::Real EstimateNormJInverse(config::AdaptiveMultiplePrecisionConfig const& AMP_config)
+				{
+					using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+					if (last_solve_mixed_)
+						return RealType(std::get< NormInverseEstimator<dbl> >(norm_J_inverse_estimator_).Estimate(std::get< PartialPivotLU<dbl> >(LU_), AMP_config.norm_J_inverse_estimate, AMP_config.norm_J_inverse_reuse_steps));
+					return std::get< NormInverseEstimator<ComplexType> >(norm_J_inverse_estimator_).Estimate(std::get< PartialPivotLU<ComplexType> >(LU_), AMP_config.norm_J_inverse_estimate, AMP_config.norm_J_inverse_reuse_steps);
+				}
 				
 
 				
@@ -380,8 +738,21 @@ namespace bertini{
 				std::tuple< Vec<dbl>, Vec<mpfr> > f_temp_; // Variable to hold temporary evaluation of the system
 				std::tuple< Vec<dbl>, Vec<mpfr> > step_temp_; // Variable to hold temporary evaluation of the newton step
 				std::tuple< Mat<dbl>, Mat<mpfr> > J_temp_; // Variable to hold temporary evaluation of the Jacobian
+				std::tuple< Vec<dbl>, Vec<mpfr> > trial_space_; // A point tried by the line search
+				std::tuple< Vec<dbl>, Vec<mpfr> > trial_f_; // The functions at trial_space_
 				
-				std::tuple< Eigen::PartialPivLU<Mat<dbl>>, Eigen::PartialPivLU<Mat<mpfr>> > LU_; // The LU factorization from the Newton iterates
+				std::tuple< PartialPivotLU<dbl>, PartialPivotLU<mpfr> > LU_; // The LU factorization from the Newton iterates, reusing its workspace
+
+				std::tuple< NormInverseEstimator<dbl>, NormInverseEstimator<mpfr> > norm_J_inverse_estimator_; // Estimates the norm of the inverse of the Jacobian from LU_
+				instrument::Profile* profile_ = nullptr; // The profile of the owning tracker, if any
+				std::uint64_t num_iterations_ = 0; // see NumIterations
+				std::uint64_t num_evaluations_ = 0; // see NumEvaluations
+
+				bool last_solve_mixed_ = false; // Whether the last step was found by the mixed precision solve, so that LU_ holds the double factorization
+				Vec<mpfr> residual_mp_; // Residual of the linear solve, for mixed precision refinement
+				Vec<mpfr> correction_mp_; // Correction to the step, for mixed precision refinement
+				Vec<dbl> residual_d_; // The scaled residual, rounded to double
+				Vec<dbl> correction_d_; // Its double precision solution
 				
 				unsigned current_precision_;
 
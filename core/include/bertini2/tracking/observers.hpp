@@ -33,6 +33,8 @@
 
 #include "bertini2/tracking/events.hpp"
 #include "bertini2/tracking/base_tracker.hpp"
+#include "bertini2/tracking/metrics.hpp"
+#include "bertini2/tracking/trace.hpp"
 #include "bertini2/logging.hpp"
 #include <boost/type_index.hpp>
 
@@ -46,6 +48,13 @@ namespace bertini {
 
 			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
 
+		public:
+			std::vector<std::type_index> HandledEvents() const override
+			{
+				return EventTypeList< TrackingEvent<EmitterT> >();
+			}
+
+		private:
 			virtual void Observe(AnyEvent const& e) override
 			{
 				const TrackingEvent<EmitterT>* p = dynamic_cast<const TrackingEvent<EmitterT>*>(&e);
@@ -81,6 +90,13 @@ namespace bertini {
 
 			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
 
+		public:
+			std::vector<std::type_index> HandledEvents() const override
+			{
+				return EventTypeList< EventT<EmitterT> >();
+			}
+
+		private:
 			virtual void Observe(AnyEvent const& e) override
 			{
 				const EventT<EmitterT>* p = dynamic_cast<const EventT<EmitterT>*>(&e);
@@ -119,49 +135,48 @@ namespace bertini {
 			{
 				
 
+				// the values are captured, and formatted when the message is written, which is on the background thread when logging asynchronously
 				if (auto p = dynamic_cast<const Initializing<EmitterT,dbl>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "initializing, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint();// << "\n\nusing predictor " << p->Get().Predictor();
+					BERTINI_LOG_DEFERRED(severity_level::debug, [start = p->StartTime(), end = p->EndTime(), x = p->StartPoint()](std::ostream& out)
+						{ out << "initializing, tracking path\nfrom\tt = " << start << "\nto\tt = " << end << "\n from\tx = \n" << x; });
 				}
 				else if (auto p = dynamic_cast<const Initializing<EmitterT,mpfr>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "initializing, tracking path\nfrom\tt = " << p->StartTime() << "\nto\tt = " << p->EndTime() << "\n from\tx = \n" << p->StartPoint();// << "\n\nusing predictor " << p->Get().Predictor();
+					BERTINI_LOG_DEFERRED(severity_level::debug, [start = p->StartTime(), end = p->EndTime(), x = p->StartPoint()](std::ostream& out)
+						{ out << "initializing, tracking path\nfrom\tt = " << start << "\nto\tt = " << end << "\n from\tx = \n" << x; });
 				}
 
 				else if(auto p = dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracking ended";
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "tracking ended";
 
 				else if (auto p = dynamic_cast<const NewStep<EmitterT>*>(&e))
 				{
 					auto& t = p->Get();
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Tracker iteration " << t.NumTotalStepsTaken() << "\ncurrent precision: " << t.CurrentPrecision();
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "Tracker iteration " << t.NumTotalStepsTaken() << "\ncurrent precision: " << t.CurrentPrecision();
 
-					
-					BOOST_LOG_TRIVIAL(severity_level::trace) 
-						<< "t = " << t.CurrentTime() 
-						<< "\ncurrent stepsize: " << t.CurrentStepsize() 
-						<< "\ndelta_t = " << t.DeltaT() << "\ncurrent x = "
-						<< t.CurrentPoint();
+					BERTINI_LOG_DEFERRED(severity_level::trace, [time = t.CurrentTime(), stepsize = t.CurrentStepsize(), delta_t = t.DeltaT(), x = t.CurrentPoint()](std::ostream& out)
+						{ out << "t = " << time << "\ncurrent stepsize: " << stepsize << "\ndelta_t = " << delta_t << "\ncurrent x = " << x; });
 				}
 
 
 
 				else if (auto p = dynamic_cast<const SingularStartPoint<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "singular start point";
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "singular start point";
 				else if (auto p = dynamic_cast<const InfinitePathTruncation<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration indicated going to infinity, truncated path";
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "tracker iteration indicated going to infinity, truncated path";
 
 
 
 
 				else if (auto p = dynamic_cast<const SuccessfulStep<EmitterT>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration successful\n\n\n";
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "tracker iteration successful\n\n\n";
 				}
 				
 				else if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "tracker iteration unsuccessful\n\n\n";
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "tracker iteration unsuccessful\n\n\n";
 				}
 
 
@@ -171,43 +186,43 @@ namespace bertini {
 
 				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,mpfr>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "prediction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG_DEFERRED(severity_level::trace, [x = p->ResultingPoint()](std::ostream& out){ out << "prediction successful, result:\n" << x; });
 				}
 				else if (auto p = dynamic_cast<const SuccessfulPredict<EmitterT,dbl>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "prediction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG_DEFERRED(severity_level::trace, [x = p->ResultingPoint()](std::ostream& out){ out << "prediction successful, result:\n" << x; });
 				}
 
 				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,mpfr>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "correction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG_DEFERRED(severity_level::trace, [x = p->ResultingPoint()](std::ostream& out){ out << "correction successful, result:\n" << x; });
 				}
 				else if (auto p = dynamic_cast<const SuccessfulCorrect<EmitterT,dbl>*>(&e))
 				{
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "correction successful, result:\n" << p->ResultingPoint();
+					BERTINI_LOG_DEFERRED(severity_level::trace, [x = p->ResultingPoint()](std::ostream& out){ out << "correction successful, result:\n" << x; });
 				}
 
 
 				else if (auto p = dynamic_cast<const PredictorHigherPrecisionNecessary<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, higher precision necessary";
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "Predictor, higher precision necessary";
 				else if (auto p = dynamic_cast<const CorrectorHigherPrecisionNecessary<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, higher precision necessary";				
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "corrector, higher precision necessary";				
 
 
 
 				else if (auto p = dynamic_cast<const CorrectorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "corrector, matrix solve failure or failure to converge";				
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "corrector, matrix solve failure or failure to converge";				
 				else if (auto p = dynamic_cast<const PredictorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "predictor, matrix solve failure or failure to converge";	
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "predictor, matrix solve failure or failure to converge";	
 				else if (auto p = dynamic_cast<const FirstStepPredictorMatrixSolveFailure<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::trace) << "Predictor, matrix solve failure in initial solve of prediction";	
+					BERTINI_LOG_TRIVIAL(severity_level::trace) << "Predictor, matrix solve failure in initial solve of prediction";	
 
 					
 				else if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "changing precision from " << p->Previous() << " to " << p->Next();
+					BERTINI_LOG_TRIVIAL(severity_level::debug) << "changing precision from " << p->Previous() << " to " << p->Next();
 				
 				else
-					BOOST_LOG_TRIVIAL(severity_level::debug) << "unlogged event, of type: " << boost::typeindex::type_id_runtime(e).pretty_name();
+					BERTINI_LOG_TRIVIAL(severity_level::debug) << "unlogged event, of type: " << boost::typeindex::type_id_runtime(e).pretty_name();
 			}
 
 			virtual void Visit(TrackerT const& t) override
@@ -216,6 +231,121 @@ namespace bertini {
 
 
 
+		/**
+		\brief Feeds a metrics::Registry from the events of a tracker: paths begun, ended and truncated, steps and the precisions of those which succeed, precision changes, and at the end of each path, the time in each phase.
+
+		\code
+		metrics::Registry registry;
+		MetricsRecorder<AMPTracker> recorder(registry);
+		tracker.AddObserver(&recorder);
+		\endcode
+
+		The phase times are the growth of the tracker's profile since the end of the last path, so a tracker fed to one recorder should not have its profile reset while observed.
+		*/
+		template<class TrackerT>
+		class MetricsRecorder : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+		public:
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+			MetricsRecorder(metrics::Registry & registry) : registry_(registry)
+			{}
+
+			std::vector<std::type_index> HandledEvents() const override
+			{
+				return EventTypeList< SuccessfulStep<EmitterT>, FailedStep<EmitterT>, PrecisionIncreased<EmitterT>, PrecisionDecreased<EmitterT>, TrackingStarted<EmitterT>, TrackingEnded<EmitterT>, InfinitePathTruncation<EmitterT> >();
+			}
+
+			void Observe(AnyEvent const& e) override
+			{
+				if (auto p = dynamic_cast<const SuccessfulStep<EmitterT>*>(&e))
+				{
+					registry_.Increment(metrics::Counter::SuccessfulSteps);
+					registry_.RecordStepPrecision(p->Get().CurrentPrecision());
+				}
+				else if (dynamic_cast<const FailedStep<EmitterT>*>(&e))
+					registry_.Increment(metrics::Counter::FailedSteps);
+				else if (dynamic_cast<const PrecisionIncreased<EmitterT>*>(&e))
+					registry_.Increment(metrics::Counter::PrecisionIncreases);
+				else if (dynamic_cast<const PrecisionDecreased<EmitterT>*>(&e))
+					registry_.Increment(metrics::Counter::PrecisionDecreases);
+				else if (dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
+					registry_.Increment(metrics::Counter::PathsStarted);
+				else if (dynamic_cast<const InfinitePathTruncation<EmitterT>*>(&e))
+					registry_.Increment(metrics::Counter::PathsTruncated);
+				else if (auto p = dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
+				{
+					registry_.Increment(metrics::Counter::PathsEnded);
+					RecordPhases(p->Get().Profile());
+				}
+			}
+
+			void Visit(TrackerT const& t) override
+			{}
+
+		private:
+
+			void RecordPhases(instrument::Profile const& profile)
+			{
+				for (std::size_t ii = 0; ii < instrument::NumPhases; ++ii)
+				{
+					const auto phase = static_cast<instrument::Phase>(ii);
+					const auto totals = profile.Total(phase);
+					auto& seen = seen_[ii];
+					if (totals.calls < seen.calls) // the profile was reset
+						seen = instrument::PhaseTotals();
+					if (totals.calls > seen.calls)
+						registry_.RecordPhase(phase, totals.calls - seen.calls, totals.time - seen.time);
+					seen = totals;
+				}
+			}
+
+			metrics::Registry & registry_;
+			std::array<instrument::PhaseTotals, instrument::NumPhases> seen_; ///< The totals of the tracker's profile at the end of the last path.
+		};
+
+
+
+		/**
+		\brief Records the pieces of tracking a tracker does, and its changes of precision, into a trace::Trace, for the path its thread is working on.
+
+		The parallel drivers attach one to each of their trackers while a trace is active, see trace::Start.
+		*/
+		template<class TrackerT>
+		class TraceRecorder : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+		public:
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+			TraceRecorder(trace::Trace & trace) : trace_(trace)
+			{}
+
+			std::vector<std::type_index> HandledEvents() const override
+			{
+				return EventTypeList< TrackingStarted<EmitterT>, TrackingEnded<EmitterT>, PrecisionIncreased<EmitterT>, PrecisionDecreased<EmitterT> >();
+			}
+
+			void Observe(AnyEvent const& e) override
+			{
+				if (auto p = dynamic_cast<const PrecisionChanged<EmitterT>*>(&e))
+					trace_.Record(trace::EventKind::PrecisionChange, p->Next());
+				else if (dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
+					trace_.Record(trace::EventKind::TrackBegin);
+				else if (auto p = dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
+					trace_.Record(trace::EventKind::TrackEnd, p->Get().CurrentPrecision());
+			}
+
+			void Visit(TrackerT const& t) override
+			{}
+
+		private:
+			trace::Trace & trace_;
+		};
+
+
+
 		template<class TrackerT>
 		class StepFailScreenPrinter : public Observer<TrackerT>
 		{ BOOST_TYPE_INDEX_REGISTER_CLASS
@@ -223,6 +353,11 @@ namespace bertini {
 			
 			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
 
+			std::vector<std::type_index> HandledEvents() const override
+			{
+				return EventTypeList< FailedStep<EmitterT> >();
+			}
+
 			virtual void Observe(AnyEvent const& e) override
 			{
 				if (auto p = dynamic_cast<const FailedStep<EmitterT>*>(&e))
@@ -0,0 +1,192 @@
+//This file is part of Bertini 2.
+//
+//order_selection.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//order_selection.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with order_selection.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file order_selection.hpp
+
+\brief Choosing the order of the predictor while tracking, in the manner of variable order ODE solvers.
+*/
+
+#ifndef BERTINI_TRACKING_ORDER_SELECTION_HPP
+#define BERTINI_TRACKING_ORDER_SELECTION_HPP
+
+#include "bertini2/tracking/explicit_predictors.hpp"
+
+#include <array>
+
+namespace bertini{
+	namespace tracking{
+		namespace predict{
+
+			/**
+			\brief Chooses among the embedded Runge-Kutta pairs, from the record of the steps taken with them.
+
+			The methods form a ladder of increasing order: HeunEuler, RKCashKarp45, RKDormandPrince56, RKVerner67.  The cost of a method is measured over a window of steps as the time advanced per function evaluation, failed steps counting against it.  At the end of a window the selector moves down a rung if the method below was measured as cheaper, and otherwise up a rung if the window had no failure and the method above is unmeasured or was measured as cheaper.  Smooth stretches of a path thus climb to high orders and long steps, while a run of failed steps, as near a singularity, drops to cheap low order steps at once.  Measurements expire, so that a method is retried as the path changes character.
+
+			\code
+			OrderSelector selector(settings);
+			auto method = selector.Start(config::Predictor::RK4);
+			// after each step
+			method = selector.Record(success, abs(delta_t), cost, num_consecutive_failures);
+			\endcode
+			*/
+			class OrderSelector
+			{
+			public:
+
+				OrderSelector(config::OrderSelection const& settings = config::OrderSelection()) : settings_(settings)
+				{
+					Start(Predictor::HeunEuler);
+				}
+
+				/**
+				\brief The methods chosen among, from lowest order to highest.
+				*/
+				static
+				std::array<Predictor,4> const& Ladder()
+				{
+					static const std::array<Predictor,4> ladder{{Predictor::HeunEuler, Predictor::RKCashKarp45, Predictor::RKDormandPrince56, Predictor::RKVerner67}};
+					return ladder;
+				}
+
+				void Settings(config::OrderSelection const& settings)
+				{
+					settings_ = settings;
+				}
+
+				config::OrderSelection const& Settings() const
+				{
+					return settings_;
+				}
+
+				/**
+				\brief Forget all measurements, for the start of a path.
+
+				\param configured The method the tracker was set up with.  The path starts on the highest rung whose order is no more than its order.
+				\return The method to predict with.
+				*/
+				Predictor Start(Predictor configured)
+				{
+					const unsigned configured_order = Order(configured);
+					rung_ = 0;
+					for (unsigned ii = 1; ii < Ladder().size(); ++ii)
+						if (Order(Ladder()[ii]) <= configured_order)
+							rung_ = ii;
+
+					num_steps_ = 0;
+					measured_at_.fill(0);
+					ResetWindow();
+					return Current();
+				}
+
+				/**
+				\brief The method to predict with.
+				*/
+				Predictor Current() const
+				{
+					return Ladder()[rung_];
+				}
+
+				/**
+				\brief Record a step taken with the current method, and choose the method for the next.
+
+				\param success Whether the step was accepted.
+				\param time_advanced The length of the step in time, if accepted.
+				\param cost The number of evaluations of the system and its Jacobian the step took.
+				\param consecutive_failures The number of failed steps in a row, including this one.
+				\return The method to predict with next.
+				*/
+				Predictor Record(bool success, double time_advanced, unsigned cost, unsigned consecutive_failures)
+				{
+					++num_steps_;
+					++window_steps_;
+					window_cost_ += cost;
+					if (success)
+						window_time_ += time_advanced;
+					else
+						++window_failures_;
+
+					if (!success && consecutive_failures >= settings_.max_consecutive_failures && rung_ > 0)
+					{
+						MoveTo(rung_-1);
+						return Current();
+					}
+
+					if (window_steps_ < settings_.window)
+						return Current();
+
+					const double here = window_time_ / window_cost_;
+					efficiency_[rung_] = here;
+					measured_at_[rung_] = num_steps_;
+
+					if (rung_ > 0 && Measured(rung_-1) && efficiency_[rung_-1] > here)
+						MoveTo(rung_-1);
+					else if (rung_+1 < Ladder().size() && window_failures_==0 && (!Measured(rung_+1) || efficiency_[rung_+1] > here))
+						MoveTo(rung_+1);
+					else
+						ResetWindow();
+
+					return Current();
+				}
+
+			private:
+
+				bool Measured(unsigned rung) const
+				{
+					return measured_at_[rung] > 0 && num_steps_ - measured_at_[rung] <= settings_.stale_after;
+				}
+
+				void MoveTo(unsigned rung)
+				{
+					rung_ = rung;
+					ResetWindow();
+				}
+
+				void ResetWindow()
+				{
+					window_steps_ = 0;
+					window_failures_ = 0;
+					window_cost_ = 0;
+					window_time_ = 0;
+				}
+
+				config::OrderSelection settings_;
+
+				unsigned rung_; ///< The position on the ladder of the current method.
+				unsigned num_steps_; ///< The number of steps recorded since the start of the path.
+
+				unsigned window_steps_; ///< The number of steps in the current window.
+				unsigned window_failures_; ///< The number of failed steps in the current window.
+				double window_cost_; ///< The evaluations spent in the current window.
+				double window_time_; ///< The time advanced in the current window.
+
+				std::array<double,4> efficiency_; ///< The time advanced per evaluation, for each rung, when last measured.
+				std::array<unsigned,4> measured_at_; ///< The step at which each rung was last measured, or 0 if never.
+			};
+
+		} // re: namespace predict
+	} // re: namespace tracking
+} // re: namespace bertini
+
+#endif
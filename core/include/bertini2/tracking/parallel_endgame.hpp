@@ -0,0 +1,263 @@
+//This file is part of Bertini 2.
+//
+//parallel_endgame.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parallel_endgame.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parallel_endgame.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file parallel_endgame.hpp
+
+\brief Run endgames from many points at the endgame boundary, on a pool of threads.
+
+An endgame holds a reference to one tracker, which holds one system, and neither may be shared between threads.  RunAllEndgames gives each worker its own copy of the homotopy, a tracker on it, and an endgame on the tracker, and shares the points among the workers.  It needs only the points at the boundary, so it can re-run the endgames on points stored from an earlier run, with other settings, or another endgame.
+*/
+
+#ifndef BERTINI_TRACKING_PARALLEL_ENDGAME_HPP
+#define BERTINI_TRACKING_PARALLEL_ENDGAME_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+namespace bertini{
+	namespace tracking{
+
+		namespace endgame{
+			template<typename TrackerType, typename FinalEGT, typename... UsedNumTs>
+			class CauchyEndgame;
+
+			template<typename TrackerType, typename FinalPSEG, typename... UsedNumTs>
+			class PowerSeriesEndgame;
+
+			template<typename TrackerType>
+			class HybridEndgame;
+		}
+
+		namespace detail{
+
+			/**
+			\brief The kind of an endgame, for counting its outcomes, found by the endgame base class it derives from.
+			*/
+			template<typename TrackerType, typename FinalEGT, typename... UsedNumTs>
+			metrics::Endgame EndgameKind(endgame::CauchyEndgame<TrackerType, FinalEGT, UsedNumTs...> const*)
+			{
+				return metrics::Endgame::Cauchy;
+			}
+
+			template<typename TrackerType, typename FinalPSEG, typename... UsedNumTs>
+			metrics::Endgame EndgameKind(endgame::PowerSeriesEndgame<TrackerType, FinalPSEG, UsedNumTs...> const*)
+			{
+				return metrics::Endgame::PowerSeries;
+			}
+
+			/**
+			\brief The kind of the endgame which finished the last run of a hybrid endgame.
+			*/
+			template<typename TrackerType>
+			metrics::Endgame EndgameKind(endgame::HybridEndgame<TrackerType> const* e)
+			{
+				return e->EndgameUsed()==instrument::PathStatistics::EndgameType::Cauchy ? metrics::Endgame::Cauchy : metrics::Endgame::PowerSeries;
+			}
+		}
+
+
+		/**
+		\brief A point from which to run an endgame, and its time.
+		*/
+		template<typename ComplexType>
+		struct EndgameStart
+		{
+			ComplexType time; ///< The time of the point, usually that of the endgame boundary.
+			Vec<ComplexType> point; ///< The point on the path at that time.
+		};
+
+
+		/**
+		\brief The outcome of running the endgame from one point.
+		*/
+		template<typename ComplexType>
+		struct EndgameResult
+		{
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+			std::size_t index; ///< The index of the start, in the list given.
+			SuccessCode success_code; ///< How the endgame ended.
+			unsigned cycle_number; ///< The cycle number found by the endgame.
+			Vec<ComplexType> endpoint; ///< The final approximation of the endgame.
+			RealType accuracy_estimate; ///< The norm of the difference of the last two approximations made by the endgame.
+			instrument::PathStatistics statistics; ///< The tracking done by the endgame, and what it found.
+		};
+
+
+		/**
+		\brief Run an endgame from each of many points, on a pool of threads.
+
+		## Use
+
+		\code
+		std::vector< EndgameStart<mpfr> > starts = ...; // e.g. stored points at t=0.1
+		auto finished = RunAllEndgames<AMPTracker, EndgameSelector<AMPTracker>::Cauchy>(homotopy, starts,
+			tracker_setup, [](EndgameSelector<AMPTracker>::Cauchy & endgame){});
+		\endcode
+
+		Each worker evaluates its own copy of the homotopy, which it makes itself, by System::CloneForThread where it can be, so that the copy is on the worker's NUMA node.  It makes a tracker on it and passes it to setup, then makes an endgame on the tracker and passes that to endgame_setup.  Both are called once per worker, concurrently, so must not evaluate anything shared.  Each endgame is run at the precision of its start point.
+
+		\param homotopy The homotopy, with a path variable.
+		\param starts The points from which to run the endgame, and their times.
+		\param setup Configure a freshly made tracker.
+		\param endgame_setup Configure a freshly made endgame.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+		\param metrics If not null, a registry into which each worker records the outcome of each endgame, the phase times of its endgame, and, with a MetricsRecorder on its tracker, the tracking done by it.
+		\param pin_workers Whether to pin each worker to a core, spreading them over the NUMA nodes, see detail::NumaTopology::PlaceWorkers.
+
+		\return The result for each start, in the order given.
+
+		\throws std::runtime_error if a start point has the wrong number of coordinates.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename EndgameType, typename SetupFunction, typename EndgameSetupFunction>
+		std::vector< EndgameResult<typename TrackerTraits<TrackerType>::BaseComplexType> >
+		RunAllEndgames(System const& homotopy,
+		               std::vector< EndgameStart<typename TrackerTraits<TrackerType>::BaseComplexType> > const& starts,
+		               SetupFunction setup, EndgameSetupFunction endgame_setup,
+		               unsigned num_threads = 0,
+		               metrics::Registry* metrics = nullptr,
+		               bool pin_workers = false)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+			for (const auto& s : starts)
+				if (static_cast<std::size_t>(s.point.size())!=homotopy.NumVariables())
+					throw std::runtime_error("running endgames, but a start point has " + std::to_string(s.point.size()) + " coordinates, not " + std::to_string(homotopy.NumVariables()));
+
+			std::vector< EndgameResult<ComplexType> > results(starts.size());
+			if (starts.empty())
+				return results;
+
+			if (num_threads==0)
+				num_threads = detail::DefaultNumWorkers();
+			num_threads = std::min<unsigned>(num_threads, starts.size());
+
+			// each worker makes its copy, so that it is first written on the worker's NUMA node, but one at a time, as the pool is not for concurrent use
+			std::mutex copy_mutex;
+			std::string archived_homotopy;
+			auto copy_homotopy = [&]()
+			{
+				if (archived_homotopy.empty())
+					try
+					{
+						return homotopy.CloneForThread();
+					}
+					catch (std::runtime_error const&)
+					{
+						archived_homotopy = detail::Archive(homotopy);
+					}
+				return detail::CloneFromArchive<System>(archived_homotopy);
+			};
+
+			SystemPool homotopies;
+
+			auto const& topology = detail::NumaTopology::Detect();
+			if (metrics)
+				metrics->RecordTopology(topology.NumNodes(), topology.NumCpus());
+			std::vector<unsigned> worker_cpus;
+			if (pin_workers)
+				worker_cpus = topology.PlaceWorkers(num_threads);
+
+			// each path draws its random numbers from a stream of its own, as in TrackAllPaths
+			const auto path_streams = ThreadRandomStream().Fork();
+
+			std::atomic<bool> stop(false);
+			std::atomic<std::size_t> next(0);
+			detail::RunWorkers(num_threads, stop, [&](unsigned worker)
+			{
+				std::unique_ptr<detail::ScopedPin> pin;
+				if (!worker_cpus.empty())
+				{
+					pin.reset(new detail::ScopedPin(worker_cpus[worker]));
+					if (metrics && pin->Pinned())
+						metrics->Increment(metrics::Counter::WorkersPinned);
+				}
+
+				std::shared_ptr<System> worker_homotopy;
+				{
+					std::lock_guard<std::mutex> lock(copy_mutex);
+					worker_homotopy = homotopies.NonPtrAdd(copy_homotopy());
+				}
+				System const& sys = *worker_homotopy;
+
+				TrackerType tracker(sys);
+				setup(tracker);
+				EndgameType endgame(tracker);
+				endgame_setup(endgame);
+
+				std::unique_ptr< MetricsRecorder<TrackerType> > metrics_recorder;
+				if (metrics)
+				{
+					metrics_recorder.reset(new MetricsRecorder<TrackerType>(*metrics));
+					tracker.AddObserver(metrics_recorder.get());
+				}
+
+				std::unique_ptr< TraceRecorder<TrackerType> > trace_recorder;
+				if (auto timeline = trace::Active())
+				{
+					trace_recorder.reset(new TraceRecorder<TrackerType>(*timeline));
+					tracker.AddObserver(trace_recorder.get());
+				}
+
+				std::size_t ii;
+				while (!stop && (ii = next++) < starts.size())
+				{
+					auto const& start = starts[ii];
+					ScopedRandomStream random(path_streams.Substream(ii));
+					trace::ScopedPath traced(ii);
+
+					const auto precision = Precision(start.point(0));
+					DefaultPrecision(precision);
+					sys.precision(precision);
+					ComplexType t = start.time;
+					Precision(t, precision);
+
+					auto& result = results[ii];
+					result.index = ii;
+					trace::Record(trace::EventKind::EndgameBegin);
+					tracker.ResetStatistics();
+					result.success_code = endgame.Run(t, start.point);
+					trace::Record(trace::EventKind::EndgameEnd, static_cast<std::uint32_t>(result.success_code));
+					result.cycle_number = endgame.CycleNumber();
+					result.endpoint = endgame.template FinalApproximation<ComplexType>();
+					result.accuracy_estimate = endgame.template ApproximateError<RealType>();
+					result.statistics = endgame.Statistics();
+
+					if (metrics)
+						metrics->RecordEndgame(detail::EndgameKind(&endgame), result.success_code==SuccessCode::Success);
+				}
+
+				if (metrics)
+					metrics->RecordPhases(endgame.Profile());
+			});
+
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
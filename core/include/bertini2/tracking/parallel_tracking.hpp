@@ -0,0 +1,1347 @@
+//This file is part of Bertini 2.
+//
+//parallel_tracking.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parallel_tracking.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parallel_tracking.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file parallel_tracking.hpp
+
+\brief Track every path of a homotopy, from the start points of a start system, on a pool of threads.
+
+Evaluating a system writes the values cached in its nodes, so two threads may never evaluate the same system.  Each worker therefore tracks on its own copy of the homotopy, made by System::CloneForThread, which shares the trees and has private variables and registers.  Homotopies which cannot be compiled, and start systems, are deep copied by a serialization round trip instead, so that no node is shared.
+
+The cost of a path varies by orders of magnitude, most finishing in double precision and a few needing hundreds of digits.  So paths are scheduled by work stealing: each worker starts with its own block of paths, and one which runs out steals half of the remaining paths of another.  A worker whose path climbs past a threshold precision becomes a high precision lane, giving up its remaining block to a shared queue, which the others serve before stealing, so that cheap paths keep flowing while it finishes the expensive one.
+*/
+
+#ifndef BERTINI_TRACKING_PARALLEL_TRACKING_HPP
+#define BERTINI_TRACKING_PARALLEL_TRACKING_HPP
+
+#include "bertini2/tracking/tracker.hpp"
+#include "bertini2/tracking/observers.hpp"
+#include "bertini2/system_pool.hpp"
+#include "bertini2/detail/numa.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+
+namespace bertini {
+	namespace tracking {
+
+		/**
+		\brief The outcome of tracking one path.
+		*/
+		template<typename ComplexType>
+		struct PathResult
+		{
+			std::size_t index; ///< the index of the start point
+			SuccessCode success_code; ///< how tracking ended
+			ComplexType time; ///< the time at which tracking ended, the end time unless it failed
+			Vec<ComplexType> endpoint; ///< the point at the end time, in the coordinates of the homotopy.  Dehomogenize with the homotopy's DehomogenizePoint.
+			instrument::PathStatistics statistics; ///< the steps, evaluations, precisions and time of tracking the path
+
+		private:
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version)
+			{
+				auto code = static_cast<int>(success_code);
+				ar & index;
+				ar & code;
+				success_code = static_cast<SuccessCode>(code);
+				ar & time;
+				ar & endpoint;
+				ar & statistics;
+			}
+		};
+
+
+		/**
+		\brief The state of a path part way along, from which tracking can resume.
+		*/
+		template<typename ComplexType>
+		struct PathState
+		{
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+			std::size_t index; ///< the index of the start point
+			ComplexType time; ///< the time reached
+			Vec<ComplexType> space; ///< the point at that time, at the precision it was being tracked in
+			RealType stepsize; ///< the step size at that time
+			instrument::PathStatistics statistics; ///< the statistics of the path up to that time
+
+		private:
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version)
+			{
+				ar & index;
+				ar & time;
+				ar & space;
+				ar & stepsize;
+				ar & statistics;
+			}
+		};
+
+
+		/**
+		\brief The progress of a run of TrackAllPaths: the paths finished, and the state of those being tracked, as written to a checkpoint file.
+		*/
+		template<typename ComplexType>
+		struct Checkpoint
+		{
+			std::size_t num_paths = 0; ///< the number of paths of the run, to recognize a checkpoint of another
+			std::vector< PathResult<ComplexType> > finished; ///< the paths which were tracked to the end
+			std::vector< PathState<ComplexType> > in_flight; ///< the paths which were part way along
+			std::vector<std::size_t> delivered; ///< the indices of paths which were tracked to the end and passed to a sink, so are not kept
+
+			/**
+			\brief Write to a file, replacing it only once completely written, so that a run killed while writing leaves the previous checkpoint intact.
+
+			\throws std::runtime_error if the file cannot be written.
+			*/
+			void Save(boost::filesystem::path const& file) const
+			{
+				auto temp = file;
+				temp += ".tmp";
+				{
+					boost::filesystem::ofstream fout(temp, std::ios::binary | std::ios::trunc);
+					if (!fout)
+						throw std::runtime_error("unable to open checkpoint file " + temp.string() + " for writing");
+					{
+						boost::archive::binary_oarchive oa(fout);
+						oa << *this;
+					}
+					if (!fout)
+						throw std::runtime_error("failed writing checkpoint file " + temp.string());
+				}
+				boost::filesystem::rename(temp, file);
+			}
+
+			/**
+			\brief Read from a file.
+
+			\return false if there is no such file.
+			\throws std::runtime_error if the file exists but cannot be read.
+			*/
+			bool Load(boost::filesystem::path const& file)
+			{
+				if (!boost::filesystem::exists(file))
+					return false;
+
+				try
+				{
+					boost::filesystem::ifstream fin(file, std::ios::binary);
+					boost::archive::binary_iarchive ia(fin);
+					ia >> *this;
+				}
+				catch (std::exception const& e)
+				{
+					throw std::runtime_error("unable to read checkpoint file " + file.string() + ": " + e.what());
+				}
+				return true;
+			}
+
+		private:
+
+			friend class boost::serialization::access;
+
+			template <typename Archive>
+			void serialize(Archive& ar, const unsigned version)
+			{
+				ar & num_paths;
+				ar & finished;
+				ar & in_flight;
+				ar & delivered;
+			}
+		};
+
+
+		/**
+		\brief Where and how often TrackAllPaths writes checkpoints.
+		*/
+		struct CheckpointConfig
+		{
+			boost::filesystem::path file; ///< The checkpoint file.  If it exists when the run starts, the run resumes from it.  Empty for no checkpoints.
+			std::chrono::seconds interval = std::chrono::seconds(600); ///< The time between checkpoints.
+		};
+
+
+		/**
+		\brief How much a path may cost TrackAllPaths before it is put off until the cheap paths are done.
+
+		A path which takes more steps or time, or climbs to a higher precision, than its budget allows, is suspended, and its state put on a slow lane, from which it is resumed without a budget once no other paths are left to start, or by workers dedicated to the slow lane.  So a few pathological paths delay only themselves, and most results come quickly.  Each limit is off when 0, as all are by default.
+		*/
+		struct PathBudget
+		{
+			unsigned max_steps = 0; ///< The most steps, failed ones included, before a path is put off.
+			std::chrono::milliseconds max_time = std::chrono::milliseconds(0); ///< The longest a path is tracked before it is put off.
+			unsigned max_precision = 0; ///< The highest precision, in digits, a path may reach before it is put off.
+			unsigned slow_lane_workers = 0; ///< The workers which only resume paths put off.  With none, all do, once they have no other paths.  At least one worker always tracks the others.
+
+			bool Limited() const
+			{
+				return max_steps || max_time.count() || max_precision;
+			}
+
+			/**
+			\brief Whether a path which has taken a number of steps, over a time, and reached a precision, has run over.
+			*/
+			template<typename DurationT>
+			bool Exceeded(unsigned num_steps, DurationT elapsed, unsigned precision) const
+			{
+				return (max_steps && num_steps >= max_steps)
+				    || (max_time.count() && elapsed >= max_time)
+				    || (max_precision && precision > max_precision);
+			}
+		};
+
+
+		namespace detail {
+
+			/**
+			\brief A list of points, which TrackAllPaths can track from as it does from a start system.
+			*/
+			template<typename ComplexType>
+			class StartPointList
+			{
+			public:
+				StartPointList() = default;
+
+				StartPointList(std::vector< Vec<ComplexType> > points) : points_(std::move(points))
+				{}
+
+				std::size_t NumStartPoints() const
+				{
+					return points_.size();
+				}
+
+				/**
+				\brief A point, at the default precision if in multiple precision.
+				*/
+				template<typename T>
+				Vec<T> StartPoint(std::size_t index) const
+				{
+					Vec<T> point = points_[index];
+					if (!std::is_same<T,dbl>::value)
+						Precision(point, DefaultPrecision());
+					return point;
+				}
+
+			private:
+				std::vector< Vec<ComplexType> > points_;
+
+				friend class boost::serialization::access;
+
+				template <typename Archive>
+				void serialize(Archive& ar, const unsigned version)
+				{
+					ar & points_;
+				}
+			};
+
+
+			/**
+			\brief Make a copy of an object sharing nothing with the original, by reading it back from a binary archive of it.
+
+			\param archived The serialized object, as written by a boost::archive::binary_oarchive.
+			*/
+			template<typename T>
+			T CloneFromArchive(std::string const& archived)
+			{
+				T copy;
+				std::istringstream in(archived);
+				boost::archive::binary_iarchive ia(in);
+				ia >> copy;
+				return copy;
+			}
+
+			template<typename T>
+			std::string Archive(T const& obj)
+			{
+				std::ostringstream out;
+				{
+					boost::archive::binary_oarchive oa(out);
+					oa << obj;
+				}
+				return out.str();
+			}
+
+
+			/**
+			\brief Of a number of workers wanted, as many as fit in half the memory available, each holding a number of bytes, and at least one.  All of them if the memory available is unknown.
+			*/
+			inline
+			unsigned WorkersFittingMemory(unsigned wanted, std::size_t bytes_per_worker)
+			{
+				const auto available = AvailableMemory();
+				if (available==0 || bytes_per_worker==0)
+					return wanted;
+				return static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(wanted, available/2/bytes_per_worker)));
+			}
+
+			using bertini::detail::DefaultNumWorkers;
+			using bertini::detail::NumaTopology;
+			using bertini::detail::ScopedPin;
+
+
+			/**
+			\brief Run a function of the index of a worker on a pool of threads, the calling one being worker 0, at the default precision of the calling thread.
+
+			A worker which throws sets stop, for the others to see.  The first exception is rethrown once all have stopped.
+			*/
+			template<typename WorkerFunction>
+			void RunWorkers(unsigned num_threads, std::atomic<bool> & stop, WorkerFunction work)
+			{
+				std::vector< std::exception_ptr > failures(num_threads);
+				const auto precision = DefaultPrecision();
+
+				auto run = [&](unsigned worker)
+				{
+					try
+					{
+						DefaultPrecision(precision);
+						work(worker);
+					}
+					catch (...)
+					{
+						failures[worker] = std::current_exception();
+						stop = true;
+					}
+				};
+
+				std::vector<std::thread> threads;
+				for (unsigned ii = 1; ii < num_threads; ++ii)
+					threads.emplace_back(run, ii);
+				run(0);
+				for (auto& t : threads)
+					t.join();
+
+				DefaultPrecision(precision);
+
+				for (const auto& failure : failures)
+					if (failure)
+						std::rethrow_exception(failure);
+			}
+
+
+			/**
+			\brief Work-stealing queues of path indices, one per worker, and a shared one for the paths given up by workers in the high precision lane.
+			*/
+			class WorkStealingQueues
+			{
+				struct Queue
+				{
+					std::mutex mutex;
+					std::deque<std::size_t> items;
+				};
+
+			public:
+
+				/**
+				\brief Split the items 0 through num_items-1 into contiguous blocks, one per worker.
+				*/
+				WorkStealingQueues(std::size_t num_items, unsigned num_workers) : own_(num_workers), cancelled_(false)
+				{
+					for (unsigned ii = 0; ii < num_workers; ++ii)
+					{
+						own_[ii].reset(new Queue);
+						for (auto jj = num_items*ii/num_workers; jj < num_items*(ii+1)/num_workers; ++jj)
+							own_[ii]->items.push_back(jj);
+					}
+				}
+
+				/**
+				\brief Split a list of items into contiguous blocks, one per worker.
+				*/
+				WorkStealingQueues(std::vector<std::size_t> const& items, unsigned num_workers) : own_(num_workers), cancelled_(false)
+				{
+					for (unsigned ii = 0; ii < num_workers; ++ii)
+					{
+						own_[ii].reset(new Queue);
+						own_[ii]->items.assign(items.begin() + items.size()*ii/num_workers, items.begin() + items.size()*(ii+1)/num_workers);
+					}
+				}
+
+				/**
+				\brief Get the next item for a worker, from its own queue, then the shared queue, then by stealing the back half of the queue of another worker.
+
+				\return Whether there was an item.  False once all queues are empty, or after Cancel.
+				*/
+				bool Next(unsigned worker, std::size_t & item)
+				{
+					if (cancelled_)
+						return false;
+
+					if (PopFront(*own_[worker], item) || PopFront(shared_, item))
+						return true;
+
+					const auto num_workers = static_cast<unsigned>(own_.size());
+					for (unsigned offset = 1; offset < num_workers; ++offset)
+					{
+						auto& victim = *own_[(worker + offset) % num_workers];
+						std::vector<std::size_t> stolen;
+						{
+							std::lock_guard<std::mutex> lock(victim.mutex);
+							const auto num_stolen = (victim.items.size()+1)/2;
+							stolen.assign(victim.items.end()-num_stolen, victim.items.end());
+							victim.items.erase(victim.items.end()-num_stolen, victim.items.end());
+						}
+
+						if (!stolen.empty())
+						{
+							item = stolen.front();
+							std::lock_guard<std::mutex> lock(own_[worker]->mutex);
+							own_[worker]->items.insert(own_[worker]->items.end(), stolen.begin()+1, stolen.end());
+							return true;
+						}
+					}
+					return false;
+				}
+
+				/**
+				\brief Move the rest of a worker's queue to the shared one, for the others to take.
+				*/
+				void Release(unsigned worker)
+				{
+					auto& own = *own_[worker];
+					std::lock(own.mutex, shared_.mutex);
+					std::lock_guard<std::mutex> own_lock(own.mutex, std::adopt_lock);
+					std::lock_guard<std::mutex> shared_lock(shared_.mutex, std::adopt_lock);
+					shared_.items.insert(shared_.items.end(), own.items.begin(), own.items.end());
+					own.items.clear();
+				}
+
+				/**
+				\brief Stop handing out items.
+				*/
+				void Cancel()
+				{
+					cancelled_ = true;
+				}
+
+			private:
+
+				static bool PopFront(Queue & q, std::size_t & item)
+				{
+					std::lock_guard<std::mutex> lock(q.mutex);
+					if (q.items.empty())
+						return false;
+					item = q.items.front();
+					q.items.pop_front();
+					return true;
+				}
+
+				std::vector< std::unique_ptr<Queue> > own_;
+				Queue shared_;
+				std::atomic<bool> cancelled_;
+			};
+
+
+			/**
+			\brief The slow lane: the states of paths put off for running over their budget, waiting to be resumed.
+
+			Paths are put off only by workers tracking the main batch, so the slow lane is done once it is empty and all of those have finished it.
+			*/
+			template<typename ComplexType>
+			class DeferredPaths
+			{
+			public:
+
+				/**
+				\param num_main_workers The number of workers which track the main batch, and so may put paths off.
+				*/
+				explicit DeferredPaths(unsigned num_main_workers) : main_workers_(num_main_workers)
+				{}
+
+				void Push(PathState<ComplexType> state)
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						states_.push_back(std::move(state));
+					}
+					ready_.notify_one();
+				}
+
+				/**
+				\brief Note that a worker has no more of the main batch to track, and will put off no more paths.
+				*/
+				void FinishedMainBatch()
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						--main_workers_;
+					}
+					ready_.notify_all();
+				}
+
+				/**
+				\brief Wait for a path put off, or until there will be no more.
+
+				\return Whether there was one.  False once the slow lane is done, or after Cancel.
+				*/
+				bool Next(PathState<ComplexType> & state)
+				{
+					std::unique_lock<std::mutex> lock(mutex_);
+					ready_.wait(lock, [this]{ return cancelled_ || !states_.empty() || main_workers_==0; });
+					if (cancelled_ || states_.empty())
+						return false;
+					state = std::move(states_.front());
+					states_.pop_front();
+					return true;
+				}
+
+				void Cancel()
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						cancelled_ = true;
+					}
+					ready_.notify_all();
+				}
+
+				/**
+				\brief Copies of the states waiting, for a checkpoint.
+				*/
+				std::vector< PathState<ComplexType> > Waiting() const
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					return std::vector< PathState<ComplexType> >(states_.begin(), states_.end());
+				}
+
+			private:
+				mutable std::mutex mutex_;
+				std::condition_variable ready_;
+				std::deque< PathState<ComplexType> > states_;
+				unsigned main_workers_;
+				bool cancelled_ = false;
+			};
+
+
+			/**
+			\brief Watches a worker's tracker, and the first time the precision of a path increases past a threshold, moves the worker's remaining paths to the shared queue.
+			*/
+			template<class TrackerT>
+			class HighPrecisionLaneObserver : public Observer<TrackerT>
+			{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+				using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+			public:
+
+				HighPrecisionLaneObserver(WorkStealingQueues & queues, unsigned worker, unsigned threshold) : queues_(queues), worker_(worker), threshold_(threshold)
+				{}
+
+				/**
+				\brief Arm for the next path.
+				*/
+				void Reset()
+				{
+					released_ = false;
+				}
+
+				std::vector<std::type_index> HandledEvents() const override
+				{
+					return EventTypeList< PrecisionIncreased<EmitterT> >();
+				}
+
+				virtual void Observe(AnyEvent const& e) override
+				{
+					if (auto p = dynamic_cast<const PrecisionIncreased<EmitterT>*>(&e))
+						if (!released_ && p->Next() > threshold_)
+						{
+							queues_.Release(worker_);
+							released_ = true;
+						}
+				}
+
+				virtual void Visit(TrackerT const& t) override
+				{}
+
+			private:
+				WorkStealingQueues & queues_;
+				const unsigned worker_;
+				const unsigned threshold_;
+				bool released_ = false;
+			};
+
+
+			/**
+			\brief Records the state of a worker's path, at the first successful step after each request for it.
+			*/
+			template<class TrackerT>
+			class PathStateObserver : public Observer<TrackerT>
+			{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+				using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+				using ComplexType = typename TrackerTraits<TrackerT>::BaseComplexType;
+
+			public:
+
+				/**
+				\param tracker The tracker to record the state of.
+				\param state Where to record it, guarded by mutex.
+				\param requests Incremented to ask for a new record.
+				*/
+				PathStateObserver(TrackerT const& tracker, PathState<ComplexType> & state, std::mutex & mutex, std::atomic<unsigned> const& requests) : tracker_(tracker), state_(state), mutex_(mutex), requests_(requests), answered_(requests)
+				{}
+
+				/**
+				\brief Start recording a new path, replacing the state of the last.
+				*/
+				void Reset(std::size_t index)
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					state_.index = index;
+					state_.space.resize(0);
+				}
+
+				std::vector<std::type_index> HandledEvents() const override
+				{
+					return EventTypeList< SuccessfulStep<EmitterT> >();
+				}
+
+				virtual void Observe(AnyEvent const& e) override
+				{
+					if (requests_ == answered_ || !dynamic_cast<const SuccessfulStep<EmitterT>*>(&e))
+						return;
+
+					answered_ = requests_;
+					auto space = tracker_.CurrentPoint();
+					std::lock_guard<std::mutex> lock(mutex_);
+					state_.time = tracker_.CurrentTime();
+					state_.space = std::move(space);
+					state_.stepsize = tracker_.CurrentStepsize();
+					state_.statistics = tracker_.Statistics();
+				}
+
+				virtual void Visit(TrackerT const& t) override
+				{}
+
+			private:
+				TrackerT const& tracker_;
+				PathState<ComplexType> & state_;
+				std::mutex & mutex_;
+				std::atomic<unsigned> const& requests_;
+				unsigned answered_;
+			};
+		}
+
+
+		namespace detail {
+
+			/**
+			\brief Flush a sink of results which can be flushed, such as an EndpointWriter, so that what it was given survives the process being killed.
+			*/
+			template<typename SinkT>
+			auto FlushSink(SinkT & sink, int) -> decltype(sink.Flush(), void())
+			{
+				sink.Flush();
+			}
+
+			template<typename SinkT>
+			auto FlushSink(std::reference_wrapper<SinkT> & sink, int) -> decltype(sink.get().Flush(), void())
+			{
+				sink.get().Flush();
+			}
+
+			template<typename SinkT>
+			void FlushSink(SinkT &, long)
+			{}
+
+
+			/**
+			\brief The driver of the threaded TrackAllPaths overloads.
+
+			\param sink Called with the result of each path as it finishes, one at a time, unless kept is not null.
+			\param kept If not null, the results are stored in it by index instead, and written in full to the checkpoints.  Otherwise the checkpoints hold only the indices of finished paths.
+			*/
+			template<typename TrackerType, typename StartSystemType, typename SetupFunction, typename ResultSink>
+			void TrackPaths(System const& homotopy, StartSystemType const& start_system, SetupFunction & setup,
+			                typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+			                typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+			                ResultSink & sink,
+			                std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> > * kept,
+			                CheckpointConfig const& checkpoint,
+			                unsigned num_threads,
+			                unsigned high_precision_threshold,
+			                metrics::Registry* metrics,
+			                bool pin_workers,
+			                PathBudget const& budget)
+			{
+				using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+				const auto num_paths = static_cast<std::size_t>(start_system.NumStartPoints());
+				const bool checkpointing = !checkpoint.file.empty();
+
+				std::vector<char> finished(num_paths, 0);
+				std::mutex sink_mutex;
+				std::map<std::size_t, PathState<ComplexType> > resume_from;
+
+				if (checkpointing)
+				{
+					Checkpoint<ComplexType> previous;
+					if (previous.Load(checkpoint.file))
+					{
+						if (previous.num_paths != num_paths)
+							throw std::runtime_error("checkpoint file " + checkpoint.file.string() + " is of a run of " + std::to_string(previous.num_paths) + " paths, not " + std::to_string(num_paths));
+
+						if (kept && !previous.delivered.empty())
+							throw std::runtime_error("checkpoint file " + checkpoint.file.string() + " is of a run passing its endpoints to a sink, so holds which paths finished, but not their endpoints");
+
+						for (auto& result : previous.finished)
+						{
+							finished[result.index] = 1;
+							if (kept)
+								(*kept)[result.index] = std::move(result);
+							else
+								sink(std::move(result));
+						}
+						for (auto ii : previous.delivered)
+							finished[ii] = 1;
+						for (auto& state : previous.in_flight)
+							if (!finished[state.index])
+								resume_from[state.index] = std::move(state);
+					}
+				}
+
+				std::vector<std::size_t> unfinished;
+				for (std::size_t ii = 0; ii < num_paths; ++ii)
+					if (!finished[ii])
+						unfinished.push_back(ii);
+
+				if (num_threads==0)
+					num_threads = WorkersFittingMemory(DefaultNumWorkers(), homotopy.MemoryReport().TotalBytes());
+				num_threads = std::min<unsigned>(num_threads, std::max<std::size_t>(unfinished.size(), 1));
+
+				// every worker gets its own copy, from the pool, at the precision of the homotopy.  each makes its own, so that it is first written, and so placed, on the worker's NUMA node
+				const auto archived_start_system = Archive(start_system);
+				const auto homotopy_precision = homotopy.precision();
+				SystemPool homotopies(homotopy);
+
+				auto const& topology = NumaTopology::Detect();
+				if (metrics)
+					metrics->RecordTopology(topology.NumNodes(), topology.NumCpus());
+				std::vector<unsigned> worker_cpus;
+				if (pin_workers)
+					worker_cpus = topology.PlaceWorkers(num_threads);
+
+				WorkStealingQueues paths(unfinished, num_threads);
+				const unsigned num_main_workers = budget.Limited() ? num_threads - std::min(budget.slow_lane_workers, num_threads-1) : num_threads;
+				DeferredPaths<ComplexType> deferred(num_main_workers);
+				std::vector< std::exception_ptr > failures(num_threads);
+				const auto precision = DefaultPrecision();
+
+				// each path draws its random numbers from a stream of its own, so they are the same whichever worker tracks it
+				const auto path_streams = ThreadRandomStream().Fork();
+
+				// the progress of the run, read by the checkpoint writer.  finished and in_flight are guarded by progress_mutex
+				std::mutex progress_mutex;
+				std::vector< PathState<ComplexType> > in_flight(num_threads);
+				std::atomic<unsigned> state_requests(0);
+
+				auto track_paths = [&](unsigned worker)
+				{
+					try
+					{
+						std::unique_ptr<ScopedPin> pin;
+						if (!worker_cpus.empty())
+						{
+							pin.reset(new ScopedPin(worker_cpus[worker]));
+							if (metrics && pin->Pinned())
+								metrics->Increment(metrics::Counter::WorkersPinned);
+						}
+
+						// the default precision is per thread, as are the temporaries of the multiple precision types
+						DefaultPrecision(precision);
+
+						const auto worker_homotopy = homotopies.Acquire(worker, homotopy_precision);
+						System const& sys = *worker_homotopy;
+						const auto starts = CloneFromArchive<StartSystemType>(archived_start_system);
+
+						HighPrecisionLaneObserver<TrackerType> lane(paths, worker, high_precision_threshold);
+
+						TrackerType tracker(sys);
+						setup(tracker);
+						tracker.AddObserver(&lane);
+
+						PathStateObserver<TrackerType> recorder(tracker, in_flight[worker], progress_mutex, state_requests);
+						if (checkpointing)
+							tracker.AddObserver(&recorder);
+
+						std::unique_ptr< MetricsRecorder<TrackerType> > metrics_recorder;
+						if (metrics)
+						{
+							metrics_recorder.reset(new MetricsRecorder<TrackerType>(*metrics));
+							tracker.AddObserver(metrics_recorder.get());
+						}
+
+						std::unique_ptr< TraceRecorder<TrackerType> > trace_recorder;
+						if (auto timeline = trace::Active())
+						{
+							trace_recorder.reset(new TraceRecorder<TrackerType>(*timeline));
+							tracker.AddObserver(trace_recorder.get());
+						}
+
+						// track a path from its start point, or from where it was, to the end.  false if it ran over the budget, and was put off
+						auto track = [&](std::size_t ii, PathState<ComplexType> const* from, bool budgeted)
+						{
+							DefaultPrecision(precision);
+							ScopedRandomStream random(path_streams.Substream(ii));
+							trace::ScopedPath traced(ii);
+							lane.Reset();
+							recorder.Reset(ii);
+
+							PathResult<ComplexType> result;
+							result.index = ii;
+
+							const bool reinitialize = tracker.ReinitializeInitialStepSize();
+							ComplexType t0 = start_time;
+							Vec<ComplexType> start_point;
+							if (from)
+							{
+								tracker.ReinitializeInitialStepSize(false);
+								tracker.SetStepSize(from->stepsize);
+								t0 = from->time;
+								start_point = from->space;
+								tracker.ResetStatistics(from->statistics);
+							}
+							else
+							{
+								start_point = starts.template StartPoint<ComplexType>(ii);
+								tracker.ResetStatistics();
+							}
+
+							bool put_off = false;
+							auto& code = result.success_code;
+							if (!budgeted)
+								code = tracker.TrackPath(result.endpoint, t0, end_time, start_point);
+							else
+							{
+								const auto began = std::chrono::steady_clock::now();
+								code = tracker.BeginPath(t0, end_time, start_point);
+								while (code==SuccessCode::Success && tracker.PathInProgress())
+								{
+									if (budget.Exceeded(tracker.NumTotalStepsTaken(), std::chrono::steady_clock::now()-began, tracker.CurrentPrecision()))
+									{
+										put_off = true;
+										break;
+									}
+									code = tracker.AdvancePath(result.endpoint, 1);
+								}
+							}
+							tracker.ReinitializeInitialStepSize(reinitialize);
+
+							if (put_off)
+							{
+								PathState<ComplexType> state;
+								state.index = ii;
+								state.time = tracker.CurrentTime();
+								state.space = tracker.CurrentPoint();
+								state.stepsize = tracker.CurrentStepsize();
+								state.statistics = tracker.Statistics();
+								deferred.Push(std::move(state));
+								if (metrics)
+									metrics->Increment(metrics::Counter::PathsDeferred);
+								return false;
+							}
+
+							result.time = tracker.CurrentTime();
+							result.statistics = tracker.Statistics();
+
+							if (kept)
+								(*kept)[ii] = std::move(result);
+							else
+							{
+								std::lock_guard<std::mutex> lock(sink_mutex);
+								sink(std::move(result));
+							}
+
+							std::lock_guard<std::mutex> lock(progress_mutex);
+							finished[ii] = 1;
+							return true;
+						};
+
+						if (worker < num_main_workers)
+						{
+							std::size_t ii;
+							while (paths.Next(worker, ii))
+							{
+								auto resumed = resume_from.find(ii);
+								track(ii, resumed != resume_from.end() ? &resumed->second : nullptr, budget.Limited());
+							}
+							deferred.FinishedMainBatch();
+						}
+
+						PathState<ComplexType> state;
+						while (deferred.Next(state))
+							track(state.index, &state, false);
+					}
+					catch (...)
+					{
+						failures[worker] = std::current_exception();
+						paths.Cancel(); // stop the others early
+						deferred.Cancel();
+					}
+				};
+
+				auto write_checkpoint = [&]()
+				{
+					Checkpoint<ComplexType> current;
+					current.num_paths = num_paths;
+					{
+						std::lock_guard<std::mutex> lock(progress_mutex);
+						for (std::size_t ii = 0; ii < num_paths; ++ii)
+							if (finished[ii])
+							{
+								if (kept)
+									current.finished.push_back((*kept)[ii]);
+								else
+									current.delivered.push_back(ii);
+							}
+
+						std::vector<char> recorded(num_paths, 0);
+						for (auto const& state : in_flight)
+							if (state.space.size() > 0 && !finished[state.index])
+							{
+								current.in_flight.push_back(state);
+								recorded[state.index] = 1;
+							}
+
+						// paths put off to the slow lane, and not yet taken up again
+						for (auto const& state : deferred.Waiting())
+							if (!finished[state.index] && !recorded[state.index])
+							{
+								current.in_flight.push_back(state);
+								recorded[state.index] = 1;
+							}
+
+						// paths resumed from the last checkpoint, which have not yet taken a step since, or not yet been started
+						for (auto const& resumed : resume_from)
+							if (!finished[resumed.first] && !recorded[resumed.first])
+								current.in_flight.push_back(resumed.second);
+					}
+
+					// the paths recorded as finished have been passed to the sink, so must survive in it
+					if (!kept)
+					{
+						std::lock_guard<std::mutex> lock(sink_mutex);
+						FlushSink(sink, 0);
+					}
+					current.Save(checkpoint.file);
+				};
+
+				std::mutex writer_mutex;
+				std::condition_variable writer_wakeup;
+				bool done = false;
+				std::exception_ptr writer_failure;
+
+				std::thread writer;
+				if (checkpointing)
+					writer = std::thread([&]()
+					{
+						try
+						{
+							std::unique_lock<std::mutex> lock(writer_mutex);
+							while (!writer_wakeup.wait_for(lock, checkpoint.interval, [&]{ return done; }))
+							{
+								// ask for the states, and give the workers a moment to record them at their next step
+								++state_requests;
+								lock.unlock();
+								std::this_thread::sleep_for(std::chrono::milliseconds(100));
+								write_checkpoint();
+								lock.lock();
+							}
+						}
+						catch (...)
+						{
+							writer_failure = std::current_exception();
+						}
+					});
+
+				std::vector<std::thread> threads;
+				for (unsigned ii = 1; ii < num_threads; ++ii)
+					threads.emplace_back(track_paths, ii);
+				track_paths(0);
+				for (auto& t : threads)
+					t.join();
+
+				DefaultPrecision(precision);
+
+				if (checkpointing)
+				{
+					{
+						std::lock_guard<std::mutex> lock(writer_mutex);
+						done = true;
+					}
+					writer_wakeup.notify_one();
+					writer.join();
+
+					// the states recorded by the workers are of paths they have since finished, or were tracking when they failed
+					if (!writer_failure)
+						try
+						{
+							write_checkpoint();
+						}
+						catch (...)
+						{
+							writer_failure = std::current_exception();
+						}
+				}
+
+				for (const auto& failure : failures)
+					if (failure)
+						std::rethrow_exception(failure);
+
+				if (writer_failure)
+					std::rethrow_exception(writer_failure);
+			}
+
+		} // namespace detail
+
+
+		/**
+		\brief Track from every start point of a start system, on a pool of threads, collecting the endpoints, and writing checkpoints from which a killed run resumes.
+
+		## Use
+
+		\code
+		auto TD = start_system::TotalDegree(target);
+		TD.Homogenize();
+		auto homotopy = (1-t)*target + t*TD;
+		homotopy.AddPathVariable(t);
+
+		auto AMP = config::AMPConfigFrom(homotopy);
+		CheckpointConfig checkpoint;
+		checkpoint.file = "paths.checkpoint";
+		auto results = TrackAllPaths<AMPTracker>(homotopy, TD, [&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			},
+			mpfr(1), mpfr(0), checkpoint);
+		\endcode
+
+		Each worker builds its tracker on its own copy of the homotopy, and passes it to setup, which is called once per worker, concurrently.  So setup must not evaluate anything shared, such as the original homotopy; compute what it needs beforehand, as with AMP above.  Workers start each path at the default precision of the calling thread.
+
+		Each worker makes its copy of the homotopy, its tracker and its pools itself, so on a machine with several NUMA nodes their memory is on the node the worker runs on.  Pinning the workers keeps them there.
+
+		Paths are scheduled by work stealing.  When the precision of a path rises past high_precision_threshold, the worker tracking it gives up the rest of its paths to the others, and is left alone with the expensive one.  Trackers in fixed precision never do.
+
+		With a limited budget, a path which runs over it is suspended where it is, and put on a slow lane, see PathBudget.  Each worker takes from the slow lane once it can find no other path to start, and resumes the path from where it was put off, at the precision and step size it had, to the end, without a budget.  Put off paths are in the checkpoints as paths part way along.
+
+		Every checkpoint interval, each worker records the time, point and step size of its path at its next successful step, and a Checkpoint of those and the finished paths is written to the checkpoint file.  A last one is written when the run ends, also if it ends by an exception.  If the file exists when the run starts, the finished paths in it are not tracked again, and those part way along resume from where they were, at the precision they had reached.  So rerunning with the same arguments after a run was killed loses at most an interval's work.
+
+While a trace is active, see trace::Start, each worker records when it began and ended each path, and with a TraceRecorder on its tracker, the tracking and changes of precision within it.
+
+		\param homotopy The system to track on.  Its path variable runs from start_time to end_time.
+		\param start_system The source of the start points.  Its nodes are copied with the homotopy's, so any it shares with the homotopy are not evaluated concurrently.
+		\param setup Configure a freshly made tracker.
+		\param start_time The time at which the start points solve the homotopy.
+		\param end_time The time to track to.
+		\param checkpoint Where and how often to write checkpoints.  With an empty file, none are written.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread, or fewer if their copies of the homotopy, as sized by System::MemoryReport, would not fit in half the memory available.
+		\param high_precision_threshold The precision, in digits, past which a path is isolated on its worker.
+		\param metrics If not null, a registry into which each worker's tracker records its paths, steps, precision changes and phase times, see MetricsRecorder.
+		\param pin_workers Whether to pin each worker to a core, spreading them over the NUMA nodes, see detail::NumaTopology::PlaceWorkers.  The calling thread, which is a worker, is let go again at the end.
+		\param budget The steps, time and precision a path may take before it is put off to the slow lane.  Unlimited by default.
+
+		\return The result of each path, in the order of the start points.
+
+		\throws std::runtime_error if the checkpoint file is of a run with a different number of paths, or of a run passing its endpoints to a sink, or cannot be read or written.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename StartSystemType, typename SetupFunction>
+		std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> >
+		TrackAllPaths(System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+		              typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+		              typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+		              CheckpointConfig const& checkpoint,
+		              unsigned num_threads = 0,
+		              unsigned high_precision_threshold = 64,
+		              metrics::Registry* metrics = nullptr,
+		              bool pin_workers = false,
+		              PathBudget const& budget = PathBudget())
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			std::vector< PathResult<ComplexType> > results(static_cast<std::size_t>(start_system.NumStartPoints()));
+			auto unused = [](PathResult<ComplexType> &&){};
+			detail::TrackPaths<TrackerType>(homotopy, start_system, setup, start_time, end_time, unused, &results, checkpoint, num_threads, high_precision_threshold, metrics, pin_workers, budget);
+			return results;
+		}
+
+
+		/**
+		\brief Track from every start point of a start system, on a pool of threads, collecting the endpoints, without checkpoints.
+
+		See the overload taking a CheckpointConfig.
+		*/
+		template<typename TrackerType, typename StartSystemType, typename SetupFunction>
+		std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> >
+		TrackAllPaths(System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+		              typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+		              typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+		              unsigned num_threads = 0,
+		              unsigned high_precision_threshold = 64,
+		              metrics::Registry* metrics = nullptr,
+		              bool pin_workers = false,
+		              PathBudget const& budget = PathBudget())
+		{
+			return TrackAllPaths<TrackerType>(homotopy, start_system, setup, start_time, end_time, CheckpointConfig(), num_threads, high_precision_threshold, metrics, pin_workers, budget);
+		}
+
+
+		/**
+		\brief Track from every start point of a start system, on a pool of threads, passing each endpoint to a sink as it finishes, rather than collecting them.
+
+		\code
+		EndpointWriter endpoints("run.endpoints", true);
+		CheckpointConfig checkpoint;
+		checkpoint.file = "paths.checkpoint";
+		TrackAllPaths<AMPTracker>(homotopy, TD, setup, mpfr(1), mpfr(0), std::ref(endpoints), checkpoint);
+		\endcode
+
+		Otherwise as the overload returning the results, but no result is kept once passed on, so a run of 10^7 paths holds only those being tracked.  The sink is called by the workers, one at a time, in the order the paths finish.  The checkpoints hold only which paths finished, and the state of those part way along; a sink with a Flush member, such as an EndpointWriter, is flushed before each is written, so that no path recorded as finished is lost from it.  On resuming, append to the endpoints of the killed run, as above.  The results in a checkpoint written by the overload returning them are passed to the sink when resuming from it.
+
+		\param sink Called with the PathResult of each path, as an rvalue.  A reference to a sink which may not be copied may be passed with std::ref.
+
+		\throws std::runtime_error if the checkpoint file is of a run with a different number of paths, or cannot be read or written.
+		\throws Whatever a worker or the sink threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename StartSystemType, typename SetupFunction, typename ResultSink,
+		         typename = typename std::enable_if<!std::is_arithmetic<typename std::decay<ResultSink>::type>::value && !std::is_same<typename std::decay<ResultSink>::type, CheckpointConfig>::value>::type>
+		void TrackAllPaths(System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+		                   typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+		                   typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+		                   ResultSink && sink,
+		                   CheckpointConfig const& checkpoint = CheckpointConfig(),
+		                   unsigned num_threads = 0,
+		                   unsigned high_precision_threshold = 64,
+		                   metrics::Registry* metrics = nullptr,
+		                   bool pin_workers = false,
+		                   PathBudget const& budget = PathBudget())
+		{
+			detail::TrackPaths<TrackerType>(homotopy, start_system, setup, start_time, end_time, sink, nullptr, checkpoint, num_threads, high_precision_threshold, metrics, pin_workers, budget);
+		}
+
+
+
+		/**
+		\brief A rung of the ladder of settings with which RetryFailedPaths tracks failed paths again.
+		*/
+		template<typename TrackerType>
+		struct RetryRung
+		{
+			using RealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			std::function<void(TrackerType &)> adjust; ///< Changes the settings of a tracker fresh from setup, after the rungs below have.  May be empty.
+			unsigned start_precision = 0; ///< The precision, in digits, at which to start paths, if more than that the rungs below start at.  Only for trackers in multiple precision.
+
+			/**
+			\brief Divide the initial and largest step sizes by a factor.
+			*/
+			static RetryRung ShrinkSteps(unsigned factor)
+			{
+				RetryRung rung;
+				rung.adjust = [factor](TrackerType & tracker)
+					{
+						auto stepping = tracker.SteppingSettings();
+						stepping.initial_step_size /= RealType(factor);
+						stepping.max_step_size /= RealType(factor);
+						tracker.SteppingSettings(stepping);
+					};
+				return rung;
+			}
+
+			static RetryRung SwitchPredictor(config::Predictor predictor)
+			{
+				RetryRung rung;
+				rung.adjust = [predictor](TrackerType & tracker)
+					{
+						tracker.Predictor(predictor);
+					};
+				return rung;
+			}
+
+			static RetryRung StartAtPrecision(unsigned digits)
+			{
+				RetryRung rung;
+				rung.start_precision = digits;
+				return rung;
+			}
+		};
+
+
+		/**
+		\brief Which failed paths RetryFailedPaths tracks again, and with what.
+		*/
+		template<typename TrackerType>
+		struct RetryPolicy
+		{
+			std::vector< RetryRung<TrackerType> > ladder; ///< Each rung is tried on the paths still failed after those below it, with the settings of all up to it.
+
+			/**
+			\brief Whether a path which ended so is tracked again.  By default, all which did not succeed, except those going to infinity, which is an answer.
+			*/
+			std::function<bool(SuccessCode)> retry_if = [](SuccessCode code)
+				{
+					return code!=SuccessCode::Success && code!=SuccessCode::GoingToInfinity;
+				};
+
+			/**
+			\brief Ten times smaller steps, then also the RKF45 predictor, then also twice the default precision of the calling thread at the start.
+			*/
+			static RetryPolicy Default()
+			{
+				RetryPolicy policy;
+				policy.ladder.push_back(RetryRung<TrackerType>::ShrinkSteps(10));
+				policy.ladder.push_back(RetryRung<TrackerType>::SwitchPredictor(config::Predictor::RKF45));
+				policy.ladder.push_back(RetryRung<TrackerType>::StartAtPrecision(2*DefaultPrecision()));
+				return policy;
+			}
+		};
+
+
+		/**
+		\brief Track the paths of a run of TrackAllPaths which failed again, with settings escalating up a ladder, so that the run itself may use fast, aggressive settings.
+
+		## Use
+
+		\code
+		auto results = TrackAllPaths<AMPTracker>(homotopy, TD, setup, mpfr(1), mpfr(0));
+		auto num_failed = RetryFailedPaths<AMPTracker>(results, homotopy, TD, setup, mpfr(1), mpfr(0));
+		\endcode
+
+		For each rung of the ladder in turn, the paths still failed are tracked again from their start points, in parallel by TrackAllPaths, with trackers set up by setup and then adjusted by every rung up to that one.  Paths which succeed are not tracked again.  A path which fails on every rung keeps the result of the last try.
+
+		\param results The results of the run, in the order of the start points, as TrackAllPaths returns them.  Those retried are replaced.
+		\param homotopy The system the run tracked on.
+		\param start_system The source of the start points of the run.
+		\param setup Configure a freshly made tracker, as for the run.
+		\param start_time The time at which the start points solve the homotopy.
+		\param end_time The time to track to.
+		\param policy Which paths to retry, and the ladder of settings with which to.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+		\param high_precision_threshold The precision, in digits, past which a path is isolated on its worker.
+		\param metrics If not null, a registry in which to count the paths retried and recovered, and into which the trackers record.
+
+		\return The number of paths which still fail by the policy.
+
+		\throws Whatever TrackAllPaths throws.
+		*/
+		template<typename TrackerType, typename StartSystemType, typename SetupFunction>
+		std::size_t RetryFailedPaths(std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> > & results,
+		                             System const& homotopy, StartSystemType const& start_system, SetupFunction setup,
+		                             typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+		                             typename TrackerTraits<TrackerType>::BaseComplexType const& end_time,
+		                             RetryPolicy<TrackerType> const& policy = RetryPolicy<TrackerType>::Default(),
+		                             unsigned num_threads = 0,
+		                             unsigned high_precision_threshold = 64,
+		                             metrics::Registry* metrics = nullptr)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			auto still_failed = [&]()
+			{
+				std::vector<std::size_t> failed;
+				for (std::size_t ii = 0; ii < results.size(); ++ii)
+					if (policy.retry_if(results[ii].success_code))
+						failed.push_back(ii);
+				return failed;
+			};
+
+			const auto precision = DefaultPrecision();
+			unsigned start_precision = precision;
+
+			auto failed = still_failed();
+			for (std::size_t rung = 0; rung < policy.ladder.size() && !failed.empty(); ++rung)
+			{
+				if (!std::is_same<ComplexType,dbl>::value)
+					start_precision = std::max(start_precision, policy.ladder[rung].start_precision);
+
+				auto escalated = [&](TrackerType & tracker)
+				{
+					setup(tracker);
+					for (std::size_t jj = 0; jj <= rung; ++jj)
+						if (policy.ladder[jj].adjust)
+							policy.ladder[jj].adjust(tracker);
+				};
+
+				// the workers start their paths at the default precision of this thread
+				std::vector< PathResult<ComplexType> > retried;
+				DefaultPrecision(start_precision);
+				try
+				{
+					std::vector< Vec<ComplexType> > points;
+					for (auto ii : failed)
+					{
+						points.push_back(start_system.template StartPoint<ComplexType>(ii));
+						if (auto timeline = trace::Active())
+							timeline->Record(trace::EventKind::Retry, ii, static_cast<std::uint32_t>(rung));
+					}
+
+					retried = TrackAllPaths<TrackerType>(homotopy, detail::StartPointList<ComplexType>(points), escalated, start_time, end_time, num_threads, high_precision_threshold, metrics);
+				}
+				catch (...)
+				{
+					DefaultPrecision(precision);
+					throw;
+				}
+				DefaultPrecision(precision);
+
+				for (auto& result : retried)
+				{
+					const auto ii = failed[result.index];
+					result.index = ii;
+					results[ii] = std::move(result);
+					if (metrics && !policy.retry_if(results[ii].success_code))
+						metrics->Increment(metrics::Counter::PathsRecovered);
+				}
+				if (metrics)
+					metrics->Increment(metrics::Counter::PathsRetried, failed.size());
+
+				failed = still_failed();
+			}
+
+			return failed.size();
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,500 @@
+//This file is part of Bertini 2.
+//
+//parameter_homotopy.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parameter_homotopy.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parameter_homotopy.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file parameter_homotopy.hpp
+
+\brief Solve many members of a parametrized family of systems, from the solutions of one generic member.
+
+A parameter homotopy moves the parameters of a family along the straight line from generic values, at t=1, to the values of a target member, at t=0.  For generic values, every isolated solution of the target is the end of a path from a solution of the generic member, so only those paths are tracked, usually far fewer than from a total degree start system.
+
+The homotopy is built once, from the family's own parameter nodes.  Their entries become the line between the generic and target values, which are held by variable nodes, implicit parameters of the homotopy.  It is compiled once, for forward-mode differentiation, so is never differentiated symbolically.  Moving to another target only sets the values of those nodes; nothing is parsed, differentiated or compiled again.  The workers solving targets concurrently each evaluate a copy made by System::CloneForThread, which shares the trees and the compiled program.
+
+SolveEachFrom starts each target from the nearest member of a SolutionDatabase of those solved before, rather than from the generic member, and adds each target to it.
+
+SolveInLockstep instead tracks the paths of many targets together, in the batches of a BatchTracker, each lane evaluating the compiled program at its own target's parameters.
+*/
+
+#ifndef BERTINI_TRACKING_PARAMETER_HOMOTOPY_HPP
+#define BERTINI_TRACKING_PARAMETER_HOMOTOPY_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+#include "bertini2/tracking/batch_tracker.hpp"
+#include "bertini2/tracking/solution_database.hpp"
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief A homotopy between members of a parametrized family, for solving many members from one generic solve.
+
+		## Use
+
+		Build the family with its parameters as functions, added with System::AddParameter, and solve it at random complex values of the parameters, for instance by a total degree homotopy.  Then
+
+		\code
+		ParameterHomotopy ph(family, {p, q});
+		ph.SetGenericSolve(generic_values, generic_solutions);
+
+		auto AMP = config::AMPConfigFrom(ph.Homotopy());
+		auto solved = ph.Solve<AMPTracker>(targets, [&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			});
+		\endcode
+
+		The targets are shared among a pool of threads, each tracking all the paths of one target at a time.  As for TrackAllPaths, setup is called once per worker, concurrently, so must not evaluate anything shared.
+		*/
+		class ParameterHomotopy
+		{
+		public:
+
+			using Fn = std::shared_ptr<node::Function>;
+
+			/**
+			\brief Build the homotopy from a family of systems, and the parameters appearing in its functions.
+
+			The entry of each parameter is replaced by t*g + (1-t)*p, with g its generic value, p its target value, and t the path variable.  So the parameters become the homotopy's, and the family is not to be evaluated on its own afterwards.
+
+			\param family The family of systems, without a path variable.  It is copied, with its variable groups, homogenization and patch.
+			\param parameters The parameters, the nodes appearing in the functions of the family, such as those given to System::AddParameter.
+
+			\throws std::runtime_error if the family has a path variable or implicit parameters, or no parameters are given.
+			*/
+			ParameterHomotopy(System const& family, std::vector<Fn> const& parameters);
+
+
+			/**
+			\brief The homotopy, with path variable t running from the generic member at 1 to the target at 0.
+			*/
+			System const& Homotopy() const
+			{
+				return homotopy_;
+			}
+
+			/**
+			\brief The number of parameters of the family.
+			*/
+			std::size_t NumParameters() const
+			{
+				return num_parameters_;
+			}
+
+			/**
+			\brief The number of solutions of the generic member, so of paths tracked for each target.
+			*/
+			std::size_t NumGenericSolutions() const
+			{
+				return std::get< std::vector< Vec<mpfr> > >(generic_solutions_).size();
+			}
+
+
+			/**
+			\brief Give the generic member of the family, and all its solutions.
+
+			\param generic_parameters The values of the parameters, random complex numbers, so that the member is generic.
+			\param generic_solutions The solutions at those values, in the coordinates of the homotopy, so homogenized and patched as the family is.  They start the paths at the precision they are given in.
+
+			\throws std::runtime_error if the number of values, or of coordinates of a solution, is wrong.
+			*/
+			void SetGenericSolve(Vec<mpfr> const& generic_parameters, std::vector< Vec<mpfr> > const& generic_solutions);
+
+
+			/**
+			\brief Set the values of the parameters of the homotopy, or a copy of it, for a target.
+
+			Both the double and multiple precision values are set, at the current default precision.
+
+			\param sys The homotopy, or a copy made of it.
+			\param target The values of the parameters of the target member.
+
+			\throws std::runtime_error if there is no generic solve, or the number of target values is wrong.
+			*/
+			void SetTarget(System const& sys, Vec<mpfr> const& target) const;
+
+
+			/**
+			\brief Set the values of the parameters of the homotopy, or a copy of it, for the line between any two members.
+
+			Both the double and multiple precision values are set, at the current default precision.  The generic solve is neither needed nor changed.
+
+			\param sys The homotopy, or a copy made of it.
+			\param from The values of the parameters at t=1.
+			\param to The values of the parameters at t=0.
+
+			\throws std::runtime_error if the number of values at either end is wrong.
+			*/
+			void SetPath(System const& sys, Vec<mpfr> const& from, Vec<mpfr> const& to) const;
+
+
+			/**
+			\brief Solve the targets on a pool of threads, handing the paths of each target on as soon as they are all tracked.
+
+			\param targets The values of the parameters of each target member.
+			\param setup Configure a freshly made tracker.
+			\param on_solved Called with the index of a target and the results of its paths, in the order of the generic solutions.  Called from the workers, one call at a time, in no particular order of the targets.
+			\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+			\throws std::runtime_error if there is no generic solve, or a target has the wrong number of values.
+			\throws Whatever a worker threw, after all workers have stopped.
+			*/
+			template<typename TrackerType, typename SetupFunction, typename ResultFunction>
+			void SolveEach(std::vector< Vec<mpfr> > const& targets, SetupFunction setup, ResultFunction on_solved, unsigned num_threads = 0) const
+			{
+				using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+				CheckTargets(targets);
+
+				const auto generic = std::make_shared< const StartMember<ComplexType> >(StartMember<ComplexType>{generic_parameters_, std::get< std::vector< Vec<ComplexType> > >(generic_solutions_)});
+				SolveEachWith<TrackerType>(targets, setup, [&generic](std::size_t){return generic;}, on_solved, num_threads);
+			}
+
+
+			/**
+			\brief Solve the targets on a pool of threads, each from the member of a database of solved members with the nearest parameters, adding each to the database as it is solved.
+
+			A target near a member solved before is solved along a short path from it, rather than the long one from the generic member.  Only members with at least as many solutions as the generic member are started from, so that no solution is missed; failing one, a target is solved from the generic member.  Each target is added to the database, with the endpoints of its paths which succeeded, before on_solved is called, so the targets solved later in a run start from those solved earlier.
+
+			The solutions in the database are in the coordinates of the homotopy, as the generic solutions are.
+
+			\param solved The database, of members of this family.
+			\param targets The values of the parameters of each target member.
+			\param setup Configure a freshly made tracker.
+			\param on_solved Called with the index of a target and the results of its paths, one per solution of the member started from, in their order there.  Called from the workers, one call at a time, in no particular order of the targets.
+			\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+			\throws std::runtime_error if there is no generic solve, a target has the wrong number of values, the database is of members with another number of parameters, or a target cannot be added to it.
+			\throws Whatever a worker threw, after all workers have stopped.
+			*/
+			template<typename TrackerType, typename SetupFunction, typename ResultFunction>
+			void SolveEachFrom(SolutionDatabase & solved, std::vector< Vec<mpfr> > const& targets, SetupFunction setup, ResultFunction on_solved, unsigned num_threads = 0) const
+			{
+				using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+				CheckTargets(targets);
+				if (solved.NumParameters()!=num_parameters_)
+					throw std::runtime_error("solving parameter homotopy from a solution database of members with " + std::to_string(solved.NumParameters()) + " parameters, not " + std::to_string(num_parameters_));
+
+				const auto generic = std::make_shared< const StartMember<ComplexType> >(StartMember<ComplexType>{generic_parameters_, std::get< std::vector< Vec<ComplexType> > >(generic_solutions_)});
+				auto nearest = [&](std::size_t target) -> std::shared_ptr< const StartMember<ComplexType> >
+				{
+					const auto entry = solved.Nearest(targets[target], NumGenericSolutions());
+					if (entry==SolutionDatabase::None)
+						return generic;
+
+					auto member = std::make_shared< StartMember<ComplexType> >();
+					member->parameters = solved.Parameters(entry);
+					for (auto const& s : solved.Solutions(entry))
+						member->solutions.push_back(ConvertTo<ComplexType>(s));
+					return member;
+				};
+
+				SolveEachWith<TrackerType>(targets, setup, nearest,
+					[&](std::size_t target, std::vector< PathResult<ComplexType> > && results)
+					{
+						solved.Insert(targets[target], results);
+						on_solved(target, std::move(results));
+					},
+					num_threads);
+			}
+
+
+			/**
+			\brief Solve the targets on a pool of threads, collecting the results.
+
+			See SolveEach.
+
+			\return For each target, in order, the results of its paths, in the order of the generic solutions.
+			*/
+			template<typename TrackerType, typename SetupFunction>
+			std::vector< std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> > >
+			Solve(std::vector< Vec<mpfr> > const& targets, SetupFunction setup, unsigned num_threads = 0) const
+			{
+				using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+				std::vector< std::vector< PathResult<ComplexType> > > solved(targets.size());
+				SolveEach<TrackerType>(targets, setup,
+					[&solved](std::size_t target, std::vector< PathResult<ComplexType> > && results)
+					{
+						solved[target] = std::move(results);
+					},
+					num_threads);
+				return solved;
+			}
+
+
+
+			/**
+			\brief Solve the targets on a pool of threads, each from the nearest member of a database of solved members, collecting the results.
+
+			See SolveEachFrom.
+
+			\return For each target, in order, the results of its paths, one per solution of the member started from.
+			*/
+			template<typename TrackerType, typename SetupFunction>
+			std::vector< std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> > >
+			SolveFrom(SolutionDatabase & solved, std::vector< Vec<mpfr> > const& targets, SetupFunction setup, unsigned num_threads = 0) const
+			{
+				using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+				std::vector< std::vector< PathResult<ComplexType> > > results(targets.size());
+				SolveEachFrom<TrackerType>(solved, targets, setup,
+					[&results](std::size_t target, std::vector< PathResult<ComplexType> > && r)
+					{
+						results[target] = std::move(r);
+					},
+					num_threads);
+				return results;
+			}
+
+
+			/**
+			\brief Solve the targets together, the paths of all of them tracked in lockstep in double precision, BatchTracker::Width at a time, each lane at its own target's parameters.
+
+			For many targets of a small family, whose paths mostly stay in double precision, this keeps the vector units busy where SolveEach tracks one path at a time.  The paths which need more than double precision are handed to an AMPTracker, from where they stopped, one at a time.
+
+			\code
+			auto solved = ph.SolveInLockstep(targets,
+				[&](BatchTracker & batch)
+				{
+					batch.Setup(1e-6, 1e5, stepping, newton);
+					batch.PrecisionSetup(AMP);
+				},
+				[&](AMPTracker & tracker)
+				{
+					tracker.Setup(config::Predictor::RK4, tol, truncation, stepping_mp, newton);
+					tracker.PrecisionSetup(AMP);
+				});
+			\endcode
+
+			Runs on the calling thread, evaluating the homotopy itself, whose parameters are left at those of the last target handed off, if any.
+
+			\param targets The values of the parameters of each target member.
+			\param batch_setup Configure the batch tracker.
+			\param fallback_setup Configure the tracker of the paths which need more precision.
+			\return For each target, in order, the results of its paths, in the order of the generic solutions.
+
+			\throws std::runtime_error if there is no generic solve, a target has the wrong number of values, or the homotopy could not be compiled.
+			*/
+			template<typename BatchSetupFunction, typename FallbackSetupFunction>
+			std::vector< std::vector< PathResult<mpfr> > >
+			SolveInLockstep(std::vector< Vec<mpfr> > const& targets, BatchSetupFunction batch_setup, FallbackSetupFunction fallback_setup) const
+			{
+				CheckTargets(targets);
+				if (!homotopy_.UsingForwardModeDifferentiation())
+					throw std::runtime_error("solving parameter homotopy in lockstep, but the homotopy could not be compiled for batch evaluation");
+
+				const auto& starts = std::get< std::vector< Vec<dbl> > >(generic_solutions_);
+				const auto num_starts = starts.size();
+
+				// every path of every target, with the parameters of its target
+				const auto target_parameters = BatchParameters(targets);
+				std::vector< Vec<dbl> > start_points, lane_parameters;
+				start_points.reserve(targets.size()*num_starts);
+				lane_parameters.reserve(targets.size()*num_starts);
+				for (std::size_t kk = 0; kk < targets.size(); ++kk)
+					for (std::size_t ii = 0; ii < num_starts; ++ii)
+					{
+						start_points.push_back(starts[ii]);
+						lane_parameters.push_back(target_parameters[kk]);
+					}
+
+				BatchTracker batch(homotopy_);
+				batch_setup(batch);
+				const auto batch_results = batch.TrackPathsDouble(start_points, dbl(1), dbl(0), lane_parameters);
+
+				AMPTracker fallback(homotopy_);
+				fallback_setup(fallback);
+				const auto precision = DefaultPrecision();
+
+				std::vector< std::vector< PathResult<mpfr> > > solved(targets.size(), std::vector< PathResult<mpfr> >(num_starts));
+				for (std::size_t jj = 0; jj < batch_results.size(); ++jj)
+				{
+					auto const& from = batch_results[jj];
+					auto& result = solved[jj/num_starts][jj%num_starts];
+					result.index = jj%num_starts;
+
+					Vec<mpfr> point(from.endpoint.size());
+					for (int ii = 0; ii < from.endpoint.size(); ++ii)
+						point(ii) = mpfr(from.endpoint(ii));
+
+					if (!BatchTracker::NeedsHandOff(from.success_code))
+					{
+						result.success_code = from.success_code;
+						result.time = mpfr(from.time);
+						result.endpoint = point;
+						continue;
+					}
+
+					// the values of the parameters change precision with the system, so are set anew for each path
+					DefaultPrecision(precision);
+					SetTarget(homotopy_, targets[jj/num_starts]);
+					result.success_code = fallback.TrackPath(result.endpoint, mpfr(from.time), mpfr(0), point);
+					result.time = fallback.CurrentTime();
+				}
+
+				DefaultPrecision(precision);
+				return solved;
+			}
+
+		private:
+
+			/**
+			\brief A member of the family paths start from, its parameters and solutions.
+			*/
+			template<typename ComplexType>
+			struct StartMember
+			{
+				Vec<mpfr> parameters;
+				std::vector< Vec<ComplexType> > solutions;
+			};
+
+			template<typename ComplexType>
+			static Vec<ComplexType> ConvertTo(Vec<mpfr> const& v)
+			{
+				Vec<ComplexType> result(v.size());
+				for (Eigen::DenseIndex ii = 0; ii < v.size(); ++ii)
+					result(ii) = static_cast<ComplexType>(v(ii));
+				return result;
+			}
+
+
+			/**
+			\brief Solve the targets on a pool of threads, each from the member chosen for it, handing the paths of each target on as soon as they are all tracked.
+
+			\param start_for Called with the index of a target, from the workers, concurrently, giving the member to start its paths from.
+			*/
+			template<typename TrackerType, typename SetupFunction, typename StartFunction, typename ResultFunction>
+			void SolveEachWith(std::vector< Vec<mpfr> > const& targets, SetupFunction setup, StartFunction start_for, ResultFunction on_solved, unsigned num_threads) const
+			{
+				using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+				if (num_threads==0)
+					num_threads = detail::DefaultNumWorkers();
+				num_threads = std::min<unsigned>(num_threads, std::max<std::size_t>(targets.size(), 1));
+
+				// the copies are made here, serially, as is the pool.  those of a compiled homotopy share its program
+				std::string archived_homotopy;
+				auto copy_homotopy = [&]()
+				{
+					if (archived_homotopy.empty())
+						try
+						{
+							return homotopy_.CloneForThread();
+						}
+						catch (std::runtime_error const&)
+						{
+							archived_homotopy = detail::Archive(homotopy_);
+						}
+					return detail::CloneFromArchive<System>(archived_homotopy);
+				};
+
+				SystemPool homotopies;
+				std::vector< std::shared_ptr<System> > worker_homotopies(num_threads);
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					worker_homotopies[ii] = homotopies.NonPtrAdd(copy_homotopy());
+
+				std::atomic<std::size_t> next_target(0);
+				std::mutex on_solved_mutex;
+				std::vector< std::exception_ptr > failures(num_threads);
+				const auto precision = DefaultPrecision();
+
+				auto solve_targets = [&](unsigned worker)
+				{
+					try
+					{
+						DefaultPrecision(precision);
+
+						System const& sys = *worker_homotopies[worker];
+						TrackerType tracker(sys);
+						setup(tracker);
+
+						std::size_t kk;
+						while ((kk = next_target++) < targets.size())
+						{
+							const auto start = start_for(kk);
+							const auto& starts = start->solutions;
+
+							std::vector< PathResult<ComplexType> > results(starts.size());
+							for (std::size_t ii = 0; ii < starts.size(); ++ii)
+							{
+								// the values of the parameters change precision with the system, so are set anew for each path
+								DefaultPrecision(precision);
+								SetPath(sys, start->parameters, targets[kk]);
+
+								results[ii].index = ii;
+								tracker.ResetStatistics();
+								results[ii].success_code = tracker.TrackPath(results[ii].endpoint, ComplexType(1), ComplexType(0), starts[ii]);
+								results[ii].time = tracker.CurrentTime();
+								results[ii].statistics = tracker.Statistics();
+							}
+
+							std::lock_guard<std::mutex> lock(on_solved_mutex);
+							on_solved(kk, std::move(results));
+						}
+					}
+					catch (...)
+					{
+						failures[worker] = std::current_exception();
+						next_target = targets.size(); // stop the others early
+					}
+				};
+
+				std::vector<std::thread> threads;
+				for (unsigned ii = 1; ii < num_threads; ++ii)
+					threads.emplace_back(solve_targets, ii);
+				solve_targets(0);
+				for (auto& t : threads)
+					t.join();
+
+				DefaultPrecision(precision);
+
+				for (const auto& failure : failures)
+					if (failure)
+						std::rethrow_exception(failure);
+			}
+
+
+			/**
+			\throws std::runtime_error if there is no generic solve, or a target has the wrong number of values.
+			*/
+			void CheckTargets(std::vector< Vec<mpfr> > const& targets) const;
+
+			/**
+			\brief For each target, the values in double precision of the implicit parameters of the homotopy, the generic values then the target's.
+			*/
+			std::vector< Vec<dbl> > BatchParameters(std::vector< Vec<mpfr> > const& targets) const;
+
+
+			System homotopy_; ///< The family, with the parameters moving from the generic to the target values as t goes from 1 to 0.
+			std::size_t num_parameters_;
+			Vec<mpfr> generic_parameters_; ///< The values of the parameters at the generic member, empty until SetGenericSolve.
+			std::tuple< std::vector< Vec<dbl> >, std::vector< Vec<mpfr> > > generic_solutions_; ///< The solutions of the generic member, in both precisions.
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
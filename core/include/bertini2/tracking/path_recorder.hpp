@@ -0,0 +1,341 @@
+//This file is part of Bertini 2.
+//
+//path_recorder.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//path_recorder.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with path_recorder.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file path_recorder.hpp
+
+\brief Record the geometry of tracked paths with bounded memory, by keeping a sample of the steps of each, and appending them to a binary stream.
+
+AMPPathAccumulator keeps every point of a path in memory, at full precision, which for long paths, or many, is more than can be afforded.  A PathRecorder keeps only some of the steps: either geometrically spaced toward the end time, so that the approach to the endpoint is seen at every scale, and written as they are taken, or a uniform sample of fixed size, by reservoir sampling, written when the path ends.  The last point of a path is always kept.  Points are stored as doubles, unless asked to keep the precision of the tracker, or a coordinate is out of the range of double.
+
+The stream is a short header followed by one record per sample.  Many recorders, one per worker, may share one PathSampleWriter.
+
+\code
+std::ofstream out("paths.samples", std::ios::binary);
+PathSampleWriter writer(out);
+PathRecorder<AMPTracker> recorder(writer);
+tracker.AddObserver(&recorder);
+...
+std::ifstream in("paths.samples", std::ios::binary);
+auto samples = ReadPathSamples(in);
+\endcode
+*/
+
+#ifndef BERTINI_TRACKING_PATH_RECORDER_HPP
+#define BERTINI_TRACKING_PATH_RECORDER_HPP
+
+#include "bertini2/tracking/events.hpp"
+#include "bertini2/tracking/base_tracker.hpp"
+#include "bertini2/random.hpp"
+
+#include <boost/type_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <mutex>
+#include <ostream>
+
+namespace bertini {
+	namespace tracking {
+
+		/**
+		\brief How a PathRecorder chooses the steps it keeps.
+		*/
+		enum class PathSampling
+		{
+			Geometric, ///< A step whenever the distance to the end time has shrunk by a factor since the last kept, or the time has moved by a fraction of the length of the path.  Written as taken.
+			Reservoir ///< A uniform sample of the steps of each path, of a fixed size.  Held until the path ends.
+		};
+
+
+		/**
+		\brief Settings for a PathRecorder.
+		*/
+		struct PathRecorderConfig
+		{
+			PathSampling sampling = PathSampling::Geometric;
+			double distance_ratio = 2; ///< For Geometric, the factor, more than 1, by which the distance to the end time shrinks between kept steps.
+			double time_fraction = 0.05; ///< For Geometric, a step is also kept when the time has moved this fraction of the distance from the first step to the end time since the last kept.  0 for none.
+			unsigned reservoir_size = 64; ///< For Reservoir, the number of steps kept of each path, besides the last.
+			unsigned max_samples_per_path = 1000; ///< The most steps of a path kept, besides the last.
+			bool full_precision = false; ///< Whether to store points taken in multiple precision at their precision, rather than as doubles.
+		};
+
+
+		/**
+		\brief A kept step of a path.
+		*/
+		struct PathSample
+		{
+			std::uint64_t path = 0; ///< The number of the path, counted by the recorder from the first it was given, or set by PathRecorder::SetPath.
+			std::uint64_t step = 0; ///< The number of successful steps into the path.
+			dbl time;
+			unsigned precision = 0; ///< The precision, in digits, of the tracker at the step.
+			Vec<dbl> point; ///< The point, rounded to double.
+			Vec<mpfr> point_mp; ///< The point at its precision, if stored so, else empty.
+		};
+
+
+		/**
+		\brief Appends path samples to a binary stream.
+
+		Writing is serialized by a mutex, so the recorders of the workers of a run may share one writer.
+		*/
+		class PathSampleWriter
+		{
+		public:
+
+			/**
+			\param out The stream, opened in binary mode.
+			\param write_header Whether to begin with the header, which a stream being appended to already has.
+
+			\throws std::runtime_error if the header cannot be written.
+			*/
+			explicit PathSampleWriter(std::ostream & out, bool write_header = true);
+
+			/**
+			\brief Append the samples, together.
+
+			\throws std::runtime_error if they cannot be written.
+			*/
+			void Write(std::vector<PathSample> const& samples);
+
+			/**
+			\brief The number of samples written by this writer.
+			*/
+			std::size_t NumWritten() const
+			{
+				return num_written_;
+			}
+
+		private:
+			std::ostream & out_;
+			std::mutex mutex_;
+			std::size_t num_written_ = 0;
+		};
+
+
+		/**
+		\brief Read the samples of a stream written by a PathSampleWriter, in the order written.  A record cut short at the end is ignored.
+
+		\throws std::runtime_error if the stream does not begin with the header.
+		*/
+		std::vector<PathSample> ReadPathSamples(std::istream & in);
+
+
+
+		namespace detail {
+
+			inline
+			bool FitsInDouble(Vec<dbl> const&)
+			{
+				return true;
+			}
+
+			// whether no coordinate overflows, or underflows to zero, in double
+			inline
+			bool FitsInDouble(Vec<mpfr> const& x)
+			{
+				for (Eigen::DenseIndex ii = 0; ii < x.size(); ++ii)
+					for (mpfr_float const* part : {&x(ii).real(), &x(ii).imag()})
+					{
+						const double d = static_cast<double>(*part);
+						if (!std::isfinite(d) || (d==0 && *part!=0))
+							return false;
+					}
+				return true;
+			}
+
+			inline
+			void StoreFull(PathSample &, Vec<dbl> const&)
+			{}
+
+			inline
+			void StoreFull(PathSample & sample, Vec<mpfr> const& x)
+			{
+				sample.point_mp = x;
+			}
+		}
+
+
+		/**
+		\brief An observer recording a bounded sample of the steps of the paths a tracker takes, to a PathSampleWriter.
+
+		Every call of TrackPath, BeginPath or ContinuePath begins a new path, numbered consecutively.  Memory held is at most the reservoir, for PathSampling::Reservoir, and a single sample otherwise.
+
+		\tparam TrackerT The type of tracker observed.
+		*/
+		template<class TrackerT>
+		class PathRecorder : public Observer<TrackerT>
+		{ BOOST_TYPE_INDEX_REGISTER_CLASS
+
+			using EmitterT = typename TrackerTraits<TrackerT>::EventEmitterType;
+
+		public:
+
+			/**
+			\param writer The writer the samples go to, which must outlive the recorder.
+			\param config How steps are chosen, and stored.
+			\param first_path The number of the first path.
+			*/
+			PathRecorder(PathSampleWriter & writer, PathRecorderConfig const& config = PathRecorderConfig(), std::uint64_t first_path = 0) :
+				writer_(writer), config_(config), next_path_(first_path)
+			{
+				if (!(config.distance_ratio > 1))
+					throw std::runtime_error("path recorder distance ratio must be more than 1");
+			}
+
+			std::vector<std::type_index> HandledEvents() const override
+			{
+				return EventTypeList< TrackingStarted<EmitterT>, SuccessfulStep<EmitterT>, TrackingEnded<EmitterT> >();
+			}
+
+			/**
+			\brief Number the next path, and those after it from there, such as by the index of its start point.
+			*/
+			void SetPath(std::uint64_t path)
+			{
+				next_path_ = path;
+			}
+
+			void Observe(AnyEvent const& e) override
+			{
+				if (auto p = dynamic_cast<const SuccessfulStep<EmitterT>*>(&e))
+					Step(p->Get());
+				else if (dynamic_cast<const TrackingStarted<EmitterT>*>(&e))
+				{
+					path_ = next_path_++;
+					num_steps_ = 0;
+					num_kept_ = 0;
+					last_kept_step_ = 0;
+					kept_any_ = false;
+					reservoir_.clear();
+				}
+				else if (auto p = dynamic_cast<const TrackingEnded<EmitterT>*>(&e))
+					End(p->Get());
+			}
+
+			void Visit(TrackerT const& t) override
+			{}
+
+		private:
+
+			void Step(TrackerT const& t)
+			{
+				++num_steps_;
+				if (num_kept_ >= config_.max_samples_per_path)
+					return;
+
+				if (config_.sampling==PathSampling::Reservoir)
+				{
+					// algorithm R: the n-th step replaces a random one of the k kept with probability k/n
+					if (reservoir_.size() < config_.reservoir_size)
+						reservoir_.push_back(Sample(t));
+					else
+					{
+						const auto j = ThreadRandomStream()() % num_steps_;
+						if (j < config_.reservoir_size)
+							reservoir_[j] = Sample(t);
+					}
+					return;
+				}
+
+				using std::abs;
+				const double distance = static_cast<double>(abs(t.EndTime() - t.CurrentTime()));
+				if (kept_any_)
+				{
+					const bool closer = distance <= last_distance_ / config_.distance_ratio;
+					const bool moved = config_.time_fraction > 0 && std::abs(last_distance_ - distance) >= config_.time_fraction*first_distance_;
+					if (!closer && !moved)
+						return;
+				}
+				else
+					first_distance_ = distance;
+
+				last_distance_ = distance;
+				Keep(t);
+			}
+
+			void End(TrackerT const& t)
+			{
+				if (config_.sampling==PathSampling::Reservoir)
+				{
+					std::sort(reservoir_.begin(), reservoir_.end(), [](PathSample const& a, PathSample const& b){return a.step < b.step;});
+					if (num_steps_ > 0 && (reservoir_.empty() || reservoir_.back().step!=num_steps_))
+						reservoir_.push_back(Sample(t));
+					if (!reservoir_.empty())
+						writer_.Write(reservoir_);
+					reservoir_.clear();
+					return;
+				}
+
+				if (num_steps_ > 0 && (!kept_any_ || last_kept_step_!=num_steps_))
+					writer_.Write({Sample(t)});
+			}
+
+			void Keep(TrackerT const& t)
+			{
+				writer_.Write({Sample(t)});
+				kept_any_ = true;
+				last_kept_step_ = num_steps_;
+				++num_kept_;
+			}
+
+			PathSample Sample(TrackerT const& t) const
+			{
+				PathSample sample;
+				sample.path = path_;
+				sample.step = num_steps_;
+				sample.time = static_cast<dbl>(t.CurrentTime());
+				sample.precision = t.CurrentPrecision();
+
+				const auto x = t.CurrentPoint();
+				sample.point.resize(x.size());
+				for (Eigen::DenseIndex ii = 0; ii < x.size(); ++ii)
+					sample.point(ii) = static_cast<dbl>(x(ii));
+
+				if ((config_.full_precision && sample.precision > DoublePrecision()) || !detail::FitsInDouble(x))
+					detail::StoreFull(sample, x);
+				return sample;
+			}
+
+			PathSampleWriter & writer_;
+			PathRecorderConfig config_;
+			std::uint64_t next_path_;
+			std::uint64_t path_ = 0;
+			std::uint64_t num_steps_ = 0; ///< The successful steps of the current path.
+			unsigned num_kept_ = 0;
+			std::uint64_t last_kept_step_ = 0;
+			bool kept_any_ = false;
+			double first_distance_ = 0; ///< The distance to the end time at the first kept step.
+			double last_distance_ = 0; ///< The distance to the end time at the last kept step.
+			std::vector<PathSample> reservoir_;
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,217 @@
+//This file is part of Bertini 2.
+//
+//post_processing.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//post_processing.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with post_processing.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file post_processing.hpp
+
+\brief Gather the endpoints of a solve into distinct solutions, and classify them as real, finite and singular, on a pool of threads.
+
+Classifying an endpoint takes a Jacobian and a condition number estimate, so is done on a pool of threads, each evaluating its own copy of the system, as for TrackAllPaths.
+
+Finding the endpoints which are the same takes no evaluation, only distances, but comparing every pair is quadratic in the number of paths.  Instead, the endpoints are put in the cells of a spatial hash: each is projected onto three fixed random real directions, and the projections, divided by the tolerance, are rounded down to give its cell.  Endpoints within the tolerance of each other are in the same or neighbouring cells, so each is compared only with those in the 27 cells around its own, and the cost is linear in the number of endpoints, unless the tolerance is so loose that many share a cell.
+*/
+
+#ifndef BERTINI_TRACKING_POST_PROCESSING_HPP
+#define BERTINI_TRACKING_POST_PROCESSING_HPP
+
+#include "bertini2/tracking/staged_solve.hpp"
+
+#include <limits>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief A distinct endpoint of a solve, and its classification.
+		*/
+		template<typename ComplexType>
+		struct SolutionData
+		{
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+			std::size_t path_index; ///< The index of the first path ending at it.
+			Vec<ComplexType> point; ///< The endpoint of that path, in the coordinates of the system.
+			Vec<ComplexType> dehomogenized; ///< The endpoint, dehomogenized.
+			RealType condition_number; ///< The estimated condition number of the Jacobian at the endpoint, infinite if it could not be factored.
+			unsigned multiplicity; ///< The number of paths ending at it.
+			bool is_finite; ///< Whether its dehomogenized norm is below the finite threshold.
+			bool is_real; ///< Whether it is finite and its dehomogenized coordinates have imaginary parts below the real threshold.
+			bool is_singular; ///< Whether the condition number is above its threshold, or more than one path ends at it.
+		};
+
+
+		/**
+		\brief The outcome of post-processing the endpoints of a solve.
+		*/
+		template<typename ComplexType>
+		struct PostProcessResults
+		{
+			static constexpr std::size_t NoSolution = std::numeric_limits<std::size_t>::max();
+
+			std::vector< SolutionData<ComplexType> > solutions; ///< The distinct endpoints, in the order of the first path to reach each.
+			std::vector< std::size_t > solution_of; ///< For each path, the index of its endpoint among the solutions, or NoSolution if the path failed.
+
+			std::size_t num_failed = 0; ///< The paths which failed, so have no endpoint.
+			std::size_t num_finite = 0; ///< The finite solutions.
+			std::size_t num_real = 0; ///< The real solutions.
+			std::size_t num_singular = 0; ///< The singular solutions, finite or not.
+		};
+
+		template<typename ComplexType>
+		constexpr std::size_t PostProcessResults<ComplexType>::NoSolution;
+
+
+		/**
+		\brief Gather the endpoints of a solve into distinct solutions, and classify each, on a pool of threads.
+
+		## Use
+
+		\code
+		auto paths = TrackAllPaths<AMPTracker>(homotopy, TD, setup, mpfr(1), mpfr(0));
+		auto processed = PostProcess(homotopy, paths, config::PostProcessing<mpfr_float>());
+		\endcode
+
+		Two endpoints are the same if they differ by at most final_tol_times_mult, relative to their norms, in the coordinates of the system, which for a homogenized system are on its patch, so bounded even for endpoints at infinity.
+
+		\param sys The system the endpoints solve, or the homotopy they were tracked on, which is evaluated at t=0.  Square, counting its patches.
+		\param paths The results of the paths, as from TrackAllPaths.
+		\param config The thresholds for classifying and deduplicating.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\throws std::runtime_error if the system is not square.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename ComplexType, typename T>
+		PostProcessResults<ComplexType> PostProcess(System const& sys, std::vector< PathResult<ComplexType> > const& paths,
+		                                            config::PostProcessing<T> const& config, unsigned num_threads = 0)
+		{
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+			if (sys.NumTotalFunctions()!=sys.NumVariables())
+				throw std::runtime_error("post-processing endpoints of a system with " + std::to_string(sys.NumTotalFunctions()) + " functions, counting patches, in " + std::to_string(sys.NumVariables()) + " variables, but it must be square");
+
+			const auto real_threshold = static_cast<double>(config.real_threshold);
+			const auto finite_threshold = static_cast<double>(config.endpoint_finite_threshold);
+			const auto tolerance = static_cast<double>(config.final_tol_times_mult);
+			const auto condition_threshold = static_cast<double>(config.condition_number_threshold);
+
+			std::vector<std::size_t> succeeded;
+			for (std::size_t ii = 0; ii < paths.size(); ++ii)
+				if (paths[ii].success_code==SuccessCode::Success)
+					succeeded.push_back(ii);
+
+			if (num_threads==0)
+				num_threads = detail::DefaultNumWorkers();
+			num_threads = std::min<unsigned>(num_threads, std::max<std::size_t>(succeeded.size(), 1));
+
+			// the copies come from the pool, one for each worker and precision of the endpoints.  those of a compiled system share its program
+			SystemPool systems(sys);
+
+			// classified in parallel, each endpoint on its own, in the order of the succeeded paths
+			std::vector< SolutionData<ComplexType> > classified(succeeded.size());
+			std::atomic<std::size_t> next(0);
+			std::atomic<bool> stop(false);
+
+			detail::RunWorkers(num_threads, stop, [&](unsigned worker)
+			{
+				using std::sqrt;
+
+				std::size_t kk;
+				while (!stop && (kk = next++) < succeeded.size())
+				{
+					auto const& x = paths[succeeded[kk]].endpoint;
+					auto& c = classified[kk];
+
+					const auto digits = Precision(x(0));
+					DefaultPrecision(digits);
+					System const& s = *systems.Acquire(worker, digits);
+
+					c.path_index = succeeded[kk];
+					c.point = x;
+					c.dehomogenized = s.DehomogenizePoint(x);
+					c.multiplicity = 1;
+
+					const Mat<ComplexType> J = s.HavePathVariable() ? s.Jacobian(x, ComplexType(0)) : s.Jacobian(x);
+					PartialPivotLU<ComplexType> lu(J.rows());
+					lu.Factor(J);
+					c.condition_number = LUPartialPivotDecompositionSuccessful(lu.MatrixLU())==MatrixSuccessCode::Success
+						? detail::ConditionNumber(J, lu) : std::numeric_limits<RealType>::infinity();
+
+					RealType imaginary(0);
+					for (int ii = 0; ii < c.dehomogenized.size(); ++ii)
+						imaginary += c.dehomogenized(ii).imag()*c.dehomogenized(ii).imag();
+
+					c.is_finite = c.dehomogenized.norm() < finite_threshold;
+					c.is_real = c.is_finite && sqrt(imaginary) < real_threshold;
+					c.is_singular = c.condition_number > condition_threshold;
+				}
+			});
+
+			// deduplicated serially, in the order of the paths, so the first path to reach each solution is the one kept
+			RealType max_norm(0);
+			for (const auto& c : classified)
+				if (c.point.norm() > max_norm)
+					max_norm = c.point.norm();
+			detail::EndpointCells cells(sys.NumVariables(), tolerance*(1 + static_cast<double>(max_norm)) + 1e-12*(1 + static_cast<double>(max_norm)));
+
+			PostProcessResults<ComplexType> results;
+			results.solution_of.assign(paths.size(), PostProcessResults<ComplexType>::NoSolution);
+			results.num_failed = paths.size() - succeeded.size();
+
+			for (auto& c : classified)
+			{
+				const auto cell = cells.Of(c.point);
+				std::size_t same;
+				const bool found = cells.AnyNear(cell, [&](std::size_t index)
+					{
+						same = index;
+						return detail::SameEndpoint(results.solutions[index].point, c.point, tolerance);
+					});
+
+				if (found)
+				{
+					++results.solutions[same].multiplicity;
+					results.solutions[same].is_singular = true;
+					results.solution_of[c.path_index] = same;
+					continue;
+				}
+
+				cells.Add(cell, results.solutions.size());
+				results.solution_of[c.path_index] = results.solutions.size();
+				results.solutions.push_back(std::move(c));
+			}
+
+			for (const auto& s : results.solutions)
+			{
+				results.num_finite += s.is_finite;
+				results.num_real += s.is_real;
+				results.num_singular += s.is_singular;
+			}
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "bertini2/lu.hpp"
 #include "bertini2/tracking/base_endgame.hpp"
 
 
@@ -216,6 +217,48 @@ protected:
 	*/			
 	mutable std::tuple< SampCont<UsedNumTs>... > derivatives_;
 
+	/**
+	\brief An interpolator over a window of the samples, converted to the s-plane for one cycle number, with the index in the samples one past the newest it holds, and the precision they were at.
+	*/
+	template<typename CT>
+	struct SlidingInterpolant
+	{
+		HermiteInterpolator<CT> interpolator;
+		std::size_t end = 0;
+		unsigned precision = 0;
+	};
+
+	/**
+	\brief For each candidate cycle number c, at index c-1, the interpolant over the samples last interpolated with c.  As time advances, each slides to the new samples rather than being rebuilt.
+	*/
+	mutable std::tuple< std::vector< SlidingInterpolant<UsedNumTs> >... > interpolants_;
+
+	/**
+	\brief The logarithms of the times of the samples, and the precision they were computed at.  Every candidate cycle number c shares them, as s = t^(1/c) = exp(log(t)/c).
+	*/
+	template<typename CT>
+	struct LogTimes
+	{
+		std::vector<CT> logs;
+		unsigned precision = 0;
+	};
+
+	mutable std::tuple< LogTimes<UsedNumTs>... > log_times_;
+
+	/**
+	\brief Storage for computing the derivative at a sample: the Jacobian and time derivative of the homotopy, the factorization of the Jacobian, and the precision they are at.
+	*/
+	template<typename CT>
+	struct DerivativeWorkspace
+	{
+		Mat<CT> dh_dx;
+		Vec<CT> dh_dt;
+		PartialPivotLU<CT> lu;
+		unsigned precision = 0;
+	};
+
+	mutable std::tuple< DerivativeWorkspace<UsedNumTs>... > derivative_workspace_;
+
 	/**
 	\brief Random vector used in computing an upper bound on the cycle number. 
 	*/
@@ -225,6 +268,21 @@ public:
 
 	auto UpperBoundOnCycleNumber() const { return upper_bound_on_cycle_number_;}
 
+	/**
+	\brief The memory held by the samples and their derivatives, and the workspace for computing the derivatives.  The factorizations in the workspace, and the interpolants, are not counted.
+	*/
+	MemoryUsage SampleMemory() const
+	{
+		using memory::HeapBytes;
+		MemoryUsage report;
+		report.Add("samples", HeapBytes(times_) + HeapBytes(samples_) + HeapBytes(derivatives_));
+
+		std::size_t workspace = 0;
+		(void)std::initializer_list<int>{(workspace += HeapBytes(std::get< DerivativeWorkspace<UsedNumTs> >(derivative_workspace_).dh_dx) + HeapBytes(std::get< DerivativeWorkspace<UsedNumTs> >(derivative_workspace_).dh_dt), 0)...};
+		report.Add("derivative_workspace", workspace + HeapBytes(rand_vector));
+		return report;
+	}
+
 	const config::PowerSeries& PowerSeriesSettings() const
 	{
 		return power_series_settings_;
@@ -238,13 +296,26 @@ public:
 	{
 		std::get<TimeCont<CT> >(times_).clear(); 
 		std::get<SampCont<CT> >(samples_).clear();
+		std::get<SampCont<CT> >(derivatives_).clear();
+		ClearInterpolants<CT>();
+	}
+
+	/**
+	\brief Forget the interpolants over the samples, and the logarithms of their times, for when the samples are replaced rather than advanced.
+	*/
+	template<typename CT>
+	void ClearInterpolants()
+	{
+		for (auto& interpolant : std::get<std::vector< SlidingInterpolant<CT> > >(interpolants_))
+			interpolant.end = 0;
+		std::get<LogTimes<CT> >(log_times_).logs.clear();
 	}
 
 	/**
 	\brief Function to set the times used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetTimes(TimeCont<CT> times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set;}
+	void SetTimes(TimeCont<CT> times_to_set) { std::get<TimeCont<CT> >(times_) = times_to_set; std::get<SampCont<CT> >(derivatives_).clear(); ClearInterpolants<CT>();}
 
 	/**
 	\brief Function to get the times used for the Power Series endgame.
@@ -256,7 +327,7 @@ public:
 	\brief Function to set the space values used for the Power Series endgame.
 	*/	
 	template<typename CT>
-	void SetSamples(SampCont<CT> samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set;}
+	void SetSamples(SampCont<CT> samples_to_set) { std::get<SampCont<CT> >(samples_) = samples_to_set; std::get<SampCont<CT> >(derivatives_).clear(); ClearInterpolants<CT>();}
 
 	/**
 	\brief Function to get the space values used for the Power Series endgame.
@@ -264,6 +335,12 @@ public:
 	template<typename CT>
 	auto GetSamples() const {return std::get<SampCont<CT> >(samples_);}
 
+	/**
+	\brief Function to get the derivatives dx/dt at the samples, as far as they have been computed.
+	*/	
+	template<typename CT>
+	auto GetDerivatives() const {return std::get<SampCont<CT> >(derivatives_);}
+
 	/**
 	\brief Function to set the times used for the Power Series endgame.
 	// */	
@@ -302,7 +379,7 @@ public:
 			None: all data needed are class data members.
 
 	## Output:
-			upper_bound_on_cycle_number_: Used for an exhaustive search for the best cycle number for approimating the path to t = 0.
+			upper_bound_on_cycle_number_: Bounds the search for the best cycle number for approimating the path to t = 0.
 
 	##Details:
 			\tparam CT The complex number type.
@@ -360,7 +437,7 @@ public:
 
 
 	/**
-	\brief This function computes the cycle number using an exhaustive search up the upper bound computed by the above function BoundOnCyleNumber. 
+	\brief This function computes the cycle number by a search up to the upper bound computed by the above function BoundOnCyleNumber. 
 
 		## Input: 
 				None: all data needed are class data members.
@@ -370,7 +447,7 @@ public:
 
 		##Details:
 				\tparam CT The complex number type.
-			This is done by an exhaustive search from 1 to upper_bound_on_cycle_number. There is a conversion to the s-space from t-space in this function. 
+			The search starts from the estimate of the last advance, or 1 for the first, and goes down and up from there until PowerSeries::cycle_number_search_patience candidates in a row fit the samples no better than the best so far, or it reaches 1 and upper_bound_on_cycle_number, so its cost follows the cycle number rather than the bound.  With a patience of 0, every candidate from 1 to the bound is tried.  There is a conversion to the s-space from t-space in this function, from the logarithms of the times, shared by all candidates. 
 	As a by-product the derivatives at each of the samples is returned for further use. 
 	*/
 
@@ -383,13 +460,13 @@ public:
 		ComputeBoundOnCycleNumber<CT>();
 
 
-		SampCont<CT> samples = std::get<SampCont<CT> >(samples_); // take a copy...  replace this asap with something that doesn't copy the data...
+		const auto& samples = std::get<SampCont<CT> >(samples_);
 			const auto& times   = std::get<TimeCont<CT> >(times_);
 			const auto& derivatives = std::get<SampCont<CT> >(derivatives_);
 
 		assert((samples.size() == times.size()) && "must have same number of times and samples");
 
-		if (derivatives.empty())
+		if (derivatives.size()!=samples.size())
 			ComputeDerivatives<CT>();
 		else
 			assert((samples.size() == derivatives.size()) && "must have same number of samples and derivatives");
@@ -397,52 +474,66 @@ public:
 		assert((samples.size() >= this->EndgameSettings().num_sample_points) && "must have sufficiently many sample points");
 
 		
-		const Vec<CT> most_recent_sample = samples.back();  // take a copy of the vector
-		samples.pop_back();// again, this should be replaced by something that doesn't need a copy of the samples
-		const CT most_recent_time = times.back();
+		const Vec<CT>& most_recent_sample = samples.back();
 
 		//Now we actually compute the Cycle Number
 
 		//num_used_points is (num_sample_points-1)
 		//because we are using the most current sample to do an 
-		//exhaustive search for the best cycle number. 
+		//search for the best cycle number. 
 		//if there are less samples than num_sample_points return samples.size() otherwise return num_sample_points.
 		
+		const auto num_earlier_samples = samples.size()-1;
 
-		unsigned num_used_points = samples.size() < this->EndgameSettings().num_sample_points 
+		unsigned num_used_points = num_earlier_samples < this->EndgameSettings().num_sample_points 
 									?
-								   samples.size() : this->EndgameSettings().num_sample_points ;
+								   num_earlier_samples : this->EndgameSettings().num_sample_points ;
 
-		unsigned offset = samples.size() - num_used_points;
+		auto offset = num_earlier_samples - num_used_points;
 		auto min_found_difference = Eigen::NumTraits<RT>::highest();
 
-		TimeCont<CT> s_times(num_used_points);
-		SampCont<CT> s_derivatives(num_used_points);
+		auto& interpolants = std::get<std::vector< SlidingInterpolant<CT> > >(interpolants_);
+		if (interpolants.size() < upper_bound_on_cycle_number_)
+			interpolants.resize(upper_bound_on_cycle_number_);
 
+		const CT log_most_recent_time = LogTime<CT>(samples.size()-1);
 
-		for(unsigned int candidate = 1; candidate <= upper_bound_on_cycle_number_; ++candidate)
-		{			
+		Vec<CT> prediction;
+		unsigned best = 0;
+		// whether a candidate fits the samples better than the best so far, the smaller winning ties as in a search upward
+		auto try_candidate = [&](unsigned candidate)
+		{
 			BOOST_LOG_TRIVIAL(severity_level::trace) << "testing cycle candidate " << candidate;
 
-			for(unsigned int ii=0; ii<num_used_points; ++ii)// using the last sample to predict to. 
-			{   using std::pow;
-				s_times[ii] = pow(times[ii+offset],1/static_cast<RT>(candidate));
-				s_derivatives[ii] = derivatives[ii+offset] * (candidate * pow(times[ii+offset], static_cast<RT>(candidate-1)/candidate));
-			}
+			// using the last sample to predict to. 
+			auto& interpolant = interpolants[candidate-1];
+			SlideInterpolant(interpolant, candidate, offset, num_used_points);
 
-			RT curr_diff = (HermiteInterpolateAndSolve(
-			                      pow(most_recent_time,static_cast<RT>(1)/candidate), // the target time
-			                      num_used_points,s_times,samples,s_derivatives) // the input data
-			                 - 
-			                 most_recent_sample).norm();
+			using std::exp;
+			interpolant.interpolator.Interpolate(prediction, exp(log_most_recent_time/static_cast<RT>(candidate)));
+			RT curr_diff = (prediction - most_recent_sample).norm();
 
-			if (curr_diff < min_found_difference)
+			if (curr_diff < min_found_difference || (curr_diff==min_found_difference && candidate < best))
 			{
 				min_found_difference = curr_diff;
-				this->cycle_number_ = candidate;
+				best = candidate;
+				return true;
 			}
+			return false;
+		};
+
+		// from the last estimate, outward each way until patience runs out.  the estimate moves little from one advance to the next, so few candidates are tried, however large the bound
+		const auto patience = power_series_settings_.cycle_number_search_patience;
+		const auto bound = upper_bound_on_cycle_number_;
+		const unsigned start = (patience > 0 && this->cycle_number_ > 0) ? std::min(this->cycle_number_, bound) : 1;
+
+		try_candidate(start);
+		for (unsigned candidate = start, misses = 0; candidate > 1 && (patience==0 || misses < patience); )
+			misses = try_candidate(--candidate) ? 0 : misses+1;
+		for (unsigned candidate = start, misses = 0; candidate < bound && (patience==0 || misses < patience); )
+			misses = try_candidate(++candidate) ? 0 : misses+1;
 
-		}// end cc loop over cycle number possibilities
+		this->cycle_number_ = best;
 		BOOST_LOG_TRIVIAL(severity_level::trace) << "cycle number computed to be " << this->CycleNumber();
 
 		return this->cycle_number_;
@@ -450,7 +541,112 @@ public:
 
 
 	/**
-		\brief Compute a set of derivatives using internal data to the endgame.
+		\brief Bring an interpolant to hold the samples from first, in the s-plane for cycle number c, where s = t^(1/c).
+
+		The samples it already holds from first on are kept, and only the newer ones are converted and pushed.  It is rebuilt if it holds none of them, or fewer than it must, or if the precision of the samples has changed since it was made.
+
+		\param interpolant The interpolant for cycle number c.
+		\param c The cycle number.
+		\param first The index of the oldest sample to hold.
+		\param num_samples The number of samples to hold.
+	*/
+	template<typename CT>
+	void SlideInterpolant(SlidingInterpolant<CT> & interpolant, unsigned c, std::size_t first, unsigned num_samples)
+	{
+		using RT = typename Eigen::NumTraits<CT>::Real;
+		using std::exp;
+
+		const auto& samples = std::get<SampCont<CT> >(samples_);
+		const auto& times   = std::get<TimeCont<CT> >(times_);
+		const auto& derivatives  = std::get<SampCont<CT> >(derivatives_);
+
+		const auto end = first + num_samples;
+		const auto precision = Precision(times.back());
+
+		auto& interpolator = interpolant.interpolator;
+		if (interpolator.Capacity()!=num_samples || interpolant.precision!=precision
+		    || interpolant.end <= first || interpolant.end > end
+		    || interpolant.end - interpolator.NumSamples() > first)
+		{
+			interpolator.Reset(num_samples);
+			interpolant.end = first;
+			interpolant.precision = precision;
+		}
+
+		for (; interpolant.end < end; ++interpolant.end)
+		{
+			const auto& t = times[interpolant.end];
+			const CT s = exp(LogTime<CT>(interpolant.end)/static_cast<RT>(c));
+			// ds/dt = t^((1-c)/c)/c, and t^((c-1)/c) = t/s
+			interpolator.Push(s, samples[interpolant.end], derivatives[interpolant.end]*( static_cast<RT>(c)*t/s ));
+		}
+	}
+
+
+	/**
+		\brief The logarithm of the time of a sample, computed the first time it is asked for at the precision of the samples, and kept.
+
+		\param index The index of the sample.
+	*/
+	template<typename CT>
+	CT const& LogTime(std::size_t index)
+	{
+		const auto& times = std::get<TimeCont<CT> >(times_);
+		auto& cache = std::get<LogTimes<CT> >(log_times_);
+
+		const auto precision = Precision(times.back());
+		if (cache.precision!=precision)
+		{
+			cache.logs.clear();
+			cache.precision = precision;
+		}
+
+		using std::log;
+		while (cache.logs.size() <= index)
+			cache.logs.push_back(log(times[cache.logs.size()]));
+		return cache.logs[index];
+	}
+
+
+	/**
+		\brief Compute the derivative dx/dt at a sample, by solving the Davidenko equation, dH/dx dx/dt = -dH/dt.
+
+		The Jacobian and time derivative come from one evaluation of the homotopy, into storage which is reused from sample to sample.
+
+		\param[out] derivative The derivative at the sample.
+		\param sample The space value of the sample.
+		\param time The time of the sample.
+	*/
+	template<typename CT>
+	void ComputeDerivative(Vec<CT> & derivative, Vec<CT> const& sample, CT const& time)
+	{
+		auto& workspace = std::get<DerivativeWorkspace<CT> >(derivative_workspace_);
+		const auto& sys = this->GetSystem();
+
+		const auto precision = Precision(time);
+		if (workspace.dh_dx.rows()!=sys.NumTotalFunctions() || workspace.dh_dx.cols()!=sys.NumVariables())
+		{
+			workspace.dh_dx.resize(sys.NumTotalFunctions(), sys.NumVariables());
+			workspace.dh_dt.resize(sys.NumTotalFunctions());
+			workspace.lu.Resize(sys.NumVariables());
+			workspace.precision = 0;
+		}
+		if (workspace.precision!=precision)
+		{
+			Precision(workspace.dh_dx, precision);
+			Precision(workspace.dh_dt, precision);
+			workspace.lu.ChangePrecision(precision);
+			workspace.precision = precision;
+		}
+
+		sys.JacobianAndTimeDerivativeInPlace(workspace.dh_dx, workspace.dh_dt, sample, time);
+		workspace.lu.Factor(workspace.dh_dx);
+		workspace.lu.SolveNegative(derivative, workspace.dh_dt);
+	}
+
+
+	/**
+		\brief Compute the derivatives at the samples which do not yet have one.
 
 		## Input: 
 				None: all data needed are class data members.
@@ -460,6 +656,7 @@ public:
 
 		##Details:
 				\tparam CT The complex number type.
+				The derivatives are kept alongside the samples, and dropped with them when they are cleared or replaced.  As time advances, AdvanceTime computes the derivative at the new sample, so this computes only those missing, which is all of them just after the initial samples are gathered.
 	*/
 	template<typename CT>
 	void ComputeDerivatives()
@@ -470,19 +667,24 @@ public:
 
 		assert((samples.size() == times.size()) && "must have same number of times and samples");
 
+		if (derivatives.size() > samples.size())
+		{
+			derivatives.clear();
+			ClearInterpolants<CT>();
+		}
+
 		if (TrackerTraits<TrackerType>::IsAdaptivePrec) // known at compile time
 		{
-			auto max_precision = AsDerived().EnsureAtUniformPrecision(times, samples);
+			auto max_precision = AsDerived().EnsureAtUniformPrecision(times, samples, derivatives);
+			DefaultPrecision(max_precision);
 			this->GetSystem().precision(max_precision);
 		}
 
-		//Compute dx_dt for each sample.
-		derivatives.clear(); derivatives.resize(samples.size());
-		for(unsigned ii = 0; ii < samples.size(); ++ii)
-		{	
-			// uses LU look at Eigen documentation on inverse in Eigen/LU.
-		 	derivatives[ii] = -(this->GetSystem().Jacobian(samples[ii],times[ii]).inverse())*(this->GetSystem().TimeDerivative(samples[ii],times[ii]));
-		}
+		//Compute dx_dt for each sample without one.
+		auto num_computed = derivatives.size();
+		derivatives.resize(samples.size());
+		for(auto ii = num_computed; ii < samples.size(); ++ii)
+			ComputeDerivative(derivatives[ii], samples[ii], times[ii]);
 	}
 	/**
 	\brief This function computes an approximation of the space value at the time time_t0. 
@@ -504,6 +706,7 @@ public:
 	SuccessCode ComputeApproximationOfXAtT0(Vec<CT>& result, const CT & t0)
 	{	
 		using RT = typename Eigen::NumTraits<CT>::Real;
+		BERTINI_TIME_PHASE(this->profile_, EndgameApproximation, this->GetTracker().CurrentPrecision());
 
 		const auto& samples = std::get<SampCont<CT> >(samples_);
 		const auto& times   = std::get<TimeCont<CT> >(times_);
@@ -513,7 +716,7 @@ public:
 
 		assert(samples.size()==times.size() && "must have same number of samples in times and spaces");
 
-		if (derivatives.empty())
+		if (derivatives.size()!=samples.size())
 			ComputeDerivatives<CT>();
 		else
 			assert((samples.size() == derivatives.size()) && "must have same number of samples and derivatives");
@@ -524,23 +727,16 @@ public:
 
 			ComputeCycleNumber<CT>();
 		auto c = this->CycleNumber();
-		// Conversion to S-plane.
+		if (c==0)
+			throw std::runtime_error("cycle number is 0 while computing approximation of root at target time");
 
-		
-		auto offset = samples.size() - num_sample_points;
-
-		TimeCont<CT> s_times(num_sample_points);
-		SampCont<CT> s_derivatives(num_sample_points);
+		// Conversion to S-plane, sliding the interpolant for c to the newest samples.
+		auto& interpolants = std::get<std::vector< SlidingInterpolant<CT> > >(interpolants_);
+		if (interpolants.size() < c)
+			interpolants.resize(c);
+		SlideInterpolant(interpolants[c-1], c, samples.size() - num_sample_points, num_sample_points);
 
-		for(unsigned ii = 0; ii < num_sample_points; ++ii){
-			if (c==0)
-				throw std::runtime_error("cycle number is 0 while computing approximation of root at target time");
-
-			s_times[ii] = pow(times[ii+offset],static_cast<RT>(1)/c);
-			s_derivatives[ii] = derivatives[ii+offset]*( c*pow(times[ii+offset],static_cast<RT>(c-1)/c ));
-		}
-
-		result = HermiteInterpolateAndSolve(pow(t0,static_cast<RT>(1)/c), num_sample_points, s_times, samples, s_derivatives);
+		interpolants[c-1].interpolator.Interpolate(result, pow(t0,static_cast<RT>(1)/c));
 		return SuccessCode::Success;
 	}//end ComputeApproximationOfXAtT0
 
@@ -580,7 +776,13 @@ public:
 
 
   		BOOST_LOG_TRIVIAL(severity_level::trace) << "tracking to t = " << next_time << ", default precision: " << DefaultPrecision() << "\n";
-		SuccessCode tracking_success = this->GetTracker().TrackPath(next_sample,times.back(),next_time,samples.back());
+		// a path which stepped past the last sample goes on from there, see config::Stepping::dense_output
+		auto const& tracker = this->GetTracker();
+		SuccessCode tracking_success = (tracker.SteppedPastEndTime() && tracker.EndTime()==times.back())
+										?
+									tracker.ContinuePath(next_sample,next_time)
+										:
+									tracker.TrackPath(next_sample,times.back(),next_time,samples.back());
 		if (tracking_success != SuccessCode::Success)
 			return tracking_success;
 
@@ -600,7 +802,8 @@ public:
  		auto max_precision = AsDerived().EnsureAtUniformPrecision(times, samples, derivatives);
 		this->GetSystem().precision(max_precision);
 
-		derivatives.push_back(-(this->GetSystem().Jacobian(samples.back(),times.back()).inverse())*(this->GetSystem().TimeDerivative(samples.back(),times.back())));
+		derivatives.resize(samples.size());
+		ComputeDerivative(derivatives.back(), samples.back(), times.back());
 
  		return SuccessCode::Success;
 	}
@@ -620,6 +823,8 @@ public:
 	\tparam CT The complex number type.
 				Tracking forward with the number of sample points, this function will make approximations using Hermite interpolation. This process will continue until two consecutive
 				approximations are withing final tolerance of each other. 
+				If the limits of config::PowerSeries on the number of approximations, the changes of the cycle number, or the approximations in a row not improving,
+				are set, it gives up with FailedToConverge on reaching one, with its samples kept, for the Cauchy endgame to carry on from, see HybridEndgame.
 	*/		
 	template<typename CT>
 	SuccessCode Run(const CT & start_time, const Vec<CT> & start_point)
@@ -635,6 +840,11 @@ public:
 		BOOST_LOG_TRIVIAL(severity_level::trace) << "start point precision: " << Precision(start_point(0)) << "\n\n";
 
 		DefaultPrecision(Precision(start_point(0)));
+		BERTINI_TIME_PHASE(this->profile_, Endgame, Precision(start_point(0)));
+		this->BeginRunStatistics(instrument::PathStatistics::EndgameType::PowerSeries);
+		instrument::Stopwatch run_timer(this->run_statistics_.endgame_seconds);
+		const SuspendedBoundarySelection<TrackerType> suspended(this->GetTracker());
+		this->CycleNumber(0); // so the search for it starts afresh, whatever path came before
 
 		using RT = typename Eigen::NumTraits<CT>::Real;
 		//Set up for the endgame.
@@ -646,7 +856,8 @@ public:
 			Vec<CT>& final_approx = std::get<Vec<CT> >(this->final_approximation_at_origin_);
 			SetRandVec(start_point);
 
-	 	RT approx_error(1);  //setting up the error of successive approximations. 
+	 	RT& approx_error = std::get<RT>(this->approximate_error_);  //setting up the error of successive approximations. 
+	 	approx_error = RT(1);
 	 	
 	 	CT origin(0);
 
@@ -662,6 +873,7 @@ public:
 
 	 	Vec<CT> prev_approx;
 	 	auto extrapolation_code = ComputeApproximationOfXAtT0(prev_approx, origin);
+	 	++this->run_statistics_.endgame_loops;
 	 	final_approx = prev_approx;
 
 	 	if (extrapolation_code != SuccessCode::Success)
@@ -677,9 +889,21 @@ public:
 	  	Vec<CT> latest_approx;
 	    RT norm_of_dehom_of_latest_approx;
 
+	    // for the limits on giving up, all 0 unless set
+	    const auto& limits = power_series_settings_;
+	    unsigned num_approximations = 1, cycle_number_changes = 0, stalled_approximations = 0;
+	    auto prev_cycle_number = this->CycleNumber();
+	    RT prev_approx_error;
+
 
 		while (approx_error > this->Tolerances().final_tolerance)
 		{
+			if (limits.max_approximations && num_approximations >= limits.max_approximations)
+			{
+				BOOST_LOG_TRIVIAL(severity_level::trace) << "giving up after " << num_approximations << " approximations";
+				return SuccessCode::FailedToConverge;
+			}
+
 	  		auto advance_code = AdvanceTime<CT>();
 	  		if (advance_code!=SuccessCode::Success)
 	 		{
@@ -688,6 +912,7 @@ public:
 	 		}
 
 	 		extrapolation_code = ComputeApproximationOfXAtT0(latest_approx, origin);
+	 		++this->run_statistics_.endgame_loops;
 	 		if (extrapolation_code!=SuccessCode::Success)
 	 		{
 	 			BOOST_LOG_TRIVIAL(severity_level::trace) << "failed to compute the approximation at " << origin << "\n\n";
@@ -702,9 +927,25 @@ public:
 	 				return SuccessCode::SecurityMaxNormReached;
 	 		}
 
+	 		prev_approx_error = approx_error;
 	 		approx_error = (latest_approx - prev_approx).norm();
 	 		BOOST_LOG_TRIVIAL(severity_level::trace) << "consecutive approximation error:\n" << approx_error << '\n';
 
+	 		// the first error is against the initial approximation, with nothing before it to improve on
+	 		if (num_approximations++ > 1)
+	 			stalled_approximations = approx_error < prev_approx_error ? 0 : stalled_approximations+1;
+	 		if (this->CycleNumber()!=prev_cycle_number)
+	 			++cycle_number_changes;
+	 		prev_cycle_number = this->CycleNumber();
+
+	 		if ( (limits.max_cycle_number_changes && cycle_number_changes >= limits.max_cycle_number_changes)
+	 		  || (limits.max_stalled_approximations && stalled_approximations >= limits.max_stalled_approximations) )
+	 		{
+	 			final_approx = latest_approx;
+	 			BOOST_LOG_TRIVIAL(severity_level::trace) << "giving up, the cycle number having changed " << cycle_number_changes << " times, and the approximations not improving for " << stalled_approximations;
+	 			return SuccessCode::FailedToConverge;
+	 		}
+
 	 		prev_approx = latest_approx;
 	 		if(this->SecuritySettings().level <= 0)
 			    norm_of_dehom_of_prev_approx = norm_of_dehom_of_latest_approx;
@@ -0,0 +1,225 @@
+//This file is part of Bertini 2.
+//
+//refine_all.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//refine_all.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with refine_all.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file refine_all.hpp
+
+\brief Refine many points by Newton's method, on a pool of threads.
+
+Tracker::Refine works on one point, with one tracker, on one system.  RefineAll shares a list of points among workers, each with its own copy of the system and its own tracker.  Newton's method stops at each point as soon as its step is shorter than the tolerance.  With the adaptive precision tracker, a point which fails to converge is refined again at higher precision, so each point ends at the least precision, of those tried, at which it converged.
+*/
+
+#ifndef BERTINI_TRACKING_REFINE_ALL_HPP
+#define BERTINI_TRACKING_REFINE_ALL_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief Settings for refining many points.
+		*/
+		struct RefineAllConfig
+		{
+			double tolerance = 1e-11; ///< Newton's method stops at a point once its step is shorter than this.
+			unsigned max_iterations = 5; ///< The most Newton steps taken at a precision.
+			unsigned precision = 0; ///< For adaptive precision, the least precision a point is refined at.  0 refines each at its own precision first.
+			unsigned max_precision = 300; ///< For adaptive precision, the highest precision tried, before giving up on a point.
+		};
+
+
+		/**
+		\brief The outcome of refining one point.
+		*/
+		template<typename ComplexType>
+		struct RefineResult
+		{
+			std::size_t index; ///< The index of the point refined, in the list given.
+			SuccessCode success_code; ///< The code of the last refinement of the point.
+			unsigned precision; ///< The precision at which the point was last refined.
+			Vec<ComplexType> point; ///< The refined point, at that precision.
+		};
+
+
+		namespace detail {
+
+			/**
+			\brief Refine a point with a fixed precision tracker, at the precision of the point.
+			*/
+			template<typename TrackerType, typename ComplexType>
+			typename std::enable_if<TrackerTraits<TrackerType>::IsFixedPrec, SuccessCode>::type
+			RefineAtLeastPrecision(RefineResult<ComplexType> & result, TrackerType const& tracker, Vec<ComplexType> const& point, ComplexType const& time, RefineAllConfig const& config, bool &)
+			{
+				using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+				result.precision = Precision(point(0));
+				return tracker.Refine(result.point, point, time, RealType(config.tolerance), config.max_iterations);
+			}
+
+
+			/**
+			\brief Refine a point with an adaptive precision tracker, starting at the larger of the precision of the point and config.precision, and raising the precision as RefineSample in the endgames does, each time Newton's method does not converge.
+
+			\param primed Whether the tracker has held a point.  It changes precision only once it has, so the first time it is given one by tracking a path of length zero.
+			*/
+			template<typename TrackerType, typename ComplexType>
+			typename std::enable_if<TrackerTraits<TrackerType>::IsAdaptivePrec, SuccessCode>::type
+			RefineAtLeastPrecision(RefineResult<ComplexType> & result, TrackerType const& tracker, Vec<ComplexType> const& point, ComplexType const& time, RefineAllConfig const& config, bool & primed)
+			{
+				using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+				using std::max;
+
+				unsigned precision = max<unsigned>(max<unsigned>(Precision(point(0)), config.precision), LowestMultiplePrecision());
+				if (precision > config.max_precision)
+				{
+					result.precision = Precision(point(0));
+					result.point = point;
+					return SuccessCode::MaxPrecisionReached;
+				}
+
+				Vec<ComplexType> start(point.size());
+				ComplexType t;
+				auto code = SuccessCode::Success;
+				while (true)
+				{
+					DefaultPrecision(precision);
+					start = point;
+					Precision(start, precision);
+					t = time;
+					Precision(t, precision);
+
+					if (!primed)
+					{
+						Vec<ComplexType> unused;
+						tracker.TrackPath(unused, t, t, start);
+						primed = true;
+					}
+
+					code = tracker.Refine(result.point, start, t, RealType(config.tolerance), config.max_iterations);
+					result.precision = precision;
+
+					if (code!=SuccessCode::HigherPrecisionNecessary && code!=SuccessCode::FailedToConverge)
+						return code;
+
+					precision = max(precision, LowestMultiplePrecision()) + PrecisionIncrement();
+					if (precision > config.max_precision)
+						return code;
+				}
+			}
+		}
+
+
+		/**
+		\brief Refine many points by Newton's method, on a pool of threads.
+
+		## Use
+
+		\code
+		auto refined = RefineAll<AMPTracker>(sys, points, mpfr(0), [&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			});
+		\endcode
+
+		Each worker evaluates its own copy of the system, made by System::CloneForThread where it can be, and makes a tracker on it.  As for TrackAllPaths, setup is called once per worker, concurrently, so must not evaluate anything shared.  With a fixed precision tracker, each point is refined at its own precision, which must be that of the tracker.
+
+		\param sys The system, with a path variable, or the homotopy.
+		\param points The points to refine.
+		\param time The value of the path variable at which to refine.
+		\param setup Configure a freshly made tracker.
+		\param config The tolerance, number of steps, and precisions.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\return The result for each point, in the order given.  A point which failed keeps the last approximation found.
+
+		\throws std::runtime_error if a point has the wrong number of coordinates.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename SetupFunction>
+		std::vector< RefineResult<typename TrackerTraits<TrackerType>::BaseComplexType> >
+		RefineAll(System const& sys, std::vector< Vec<typename TrackerTraits<TrackerType>::BaseComplexType> > const& points,
+		          typename TrackerTraits<TrackerType>::BaseComplexType const& time, SetupFunction setup,
+		          RefineAllConfig const& config = RefineAllConfig(),
+		          unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			for (const auto& p : points)
+				if (static_cast<std::size_t>(p.size())!=sys.NumVariables())
+					throw std::runtime_error("refining points, but a point has " + std::to_string(p.size()) + " coordinates, not " + std::to_string(sys.NumVariables()));
+
+			std::vector< RefineResult<ComplexType> > results(points.size());
+			if (points.empty())
+				return results;
+
+			if (num_threads==0)
+				num_threads = detail::DefaultNumWorkers();
+			num_threads = std::min<unsigned>(num_threads, points.size());
+
+			// the copies are made here, serially, as the pool is not for concurrent use
+			std::string archived_system;
+			auto copy_system = [&]()
+			{
+				if (archived_system.empty())
+					try
+					{
+						return sys.CloneForThread();
+					}
+					catch (std::runtime_error const&)
+					{
+						archived_system = detail::Archive(sys);
+					}
+				return detail::CloneFromArchive<System>(archived_system);
+			};
+
+			SystemPool systems;
+			std::vector< std::shared_ptr<System> > worker_systems(num_threads);
+			for (unsigned ii = 0; ii < num_threads; ++ii)
+				worker_systems[ii] = systems.NonPtrAdd(copy_system());
+
+			std::atomic<bool> stop(false);
+			std::atomic<std::size_t> next(0);
+			detail::RunWorkers(num_threads, stop, [&](unsigned worker)
+			{
+				TrackerType tracker(*worker_systems[worker]);
+				setup(tracker);
+				bool primed = false;
+
+				std::size_t ii;
+				while (!stop && (ii = next++) < points.size())
+				{
+					results[ii].index = ii;
+					results[ii].success_code = detail::RefineAtLeastPrecision(results[ii], tracker, points[ii], time, config, primed);
+				}
+			});
+
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,392 @@
+//This file is part of Bertini 2.
+//
+//regeneration.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//regeneration.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with regeneration.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file regeneration.hpp
+
+\brief Solve a polynomial system equation by equation, by regeneration.
+
+A total degree homotopy tracks \f$d_1 \cdots d_n\f$ paths, however few solutions the system has.  Regeneration adds one equation at a time.  With random linear functions \f$\ell_1,\ldots,\ell_n\f$, the points of stage \f$k\f$ are the isolated solutions of \f$g_1 = \cdots = g_k = 0\f$ and \f$\ell_{k+1} = \cdots = \ell_n = 0\f$, starting from the single solution of the linear functions alone.  To make stage \f$k+1\f$:
+
+1. Each point is moved from \f$\ell_{k+1}=0\f$ to \f$L_j=0\f$, for \f$d_{k+1}-1\f$ more random linear functions \f$L_j\f$, by a linear homotopy.  The points, and the moved points, solve the system with \f$\ell_{k+1} L_1 \cdots L_{d_{k+1}-1}\f$ in place of \f$\ell_{k+1}\f$.
+2. From them, the homotopy \f$(1-t) g_{k+1} + \gamma t \, \ell_{k+1} L_1 \cdots L_{d_{k+1}-1}\f$ is tracked to \f$t=0\f$.
+3. Of the endpoints, those which failed, are at infinity, do not solve \f$g_1..g_{k+1}\f$, are singular, satisfy \f$g_{k+2}\f$ too, or repeat another, are removed before the next stage.
+
+Each stage tracks the number of points found at the last one times a degree, so when the early equations have few solutions, far fewer paths are tracked.  The paths of each homotopy are tracked on a pool of threads, by TrackAllPaths and FinishPaths.
+
+An overdetermined system is first randomized to as many equations as variables, by adding random multiples of the extra equations to the others, and the solutions of the randomized system which do not solve the original are removed at the end.
+*/
+
+#ifndef BERTINI_TRACKING_REGENERATION_HPP
+#define BERTINI_TRACKING_REGENERATION_HPP
+
+#include "bertini2/tracking/staged_solve.hpp"
+#include "bertini2/slice.hpp"
+
+#include <algorithm>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief What happened at one stage of a regeneration.
+		*/
+		struct RegenerationStage
+		{
+			std::size_t num_regenerated = 0; ///< The start points made by moving the slice of the points of the previous stage.
+			std::size_t num_paths = 0; ///< The paths tracked in the homotopy of the stage.
+			std::size_t num_failed = 0; ///< The paths which failed, moving the slices or in the homotopy of the stage.
+			std::size_t num_infinite = 0; ///< The endpoints at infinity.
+			std::size_t num_nonsolutions = 0; ///< The endpoints which do not solve the functions of the stage, or, at the last stage, those of the original system.
+			std::size_t num_singular = 0; ///< The singular endpoints.
+			std::size_t num_higher_dimensional = 0; ///< The endpoints which satisfy the next function, too.
+			std::size_t num_duplicates = 0; ///< The endpoints found by another path, too.
+			std::size_t num_kept = 0; ///< The endpoints passed to the next stage, or, at the last, the nonsingular solutions.
+		};
+
+
+		/**
+		\brief The outcome of a regeneration.
+
+		The points are in the variables of the system solved, so for a homogenized system are on its patch.
+		*/
+		template<typename ComplexType>
+		struct RegenerationResults
+		{
+			std::vector< Vec<ComplexType> > solutions; ///< The nonsingular isolated solutions.
+			std::vector< Vec<ComplexType> > singular_solutions; ///< The singular endpoints of the last stage, one per path.
+			std::vector< Vec<ComplexType> > at_infinity; ///< The endpoints at infinity of the last stage.
+			std::vector< RegenerationStage > stages; ///< What happened at each stage, one per variable.
+		};
+
+
+		namespace detail {
+
+			/**
+			\brief Whether a point solves some of the functions of a system, each to within a tolerance on its residual, relative to the norm of its gradient times that of the point.
+
+			The system is evaluated at the precision of the point.
+
+			\param sys The system, without a path variable.
+			\param x The point.
+			\param first The index of the first function tested.
+			\param last One past the index of the last function tested.
+			\param tolerance The relative tolerance on the residuals.
+			*/
+			template<typename ComplexType, typename RealType>
+			bool SolvesFunctions(System const& sys, Vec<ComplexType> const& x, std::size_t first, std::size_t last, RealType const& tolerance)
+			{
+				using std::abs;
+
+				sys.precision(Precision(x(0)));
+				const Vec<ComplexType> f = sys.Eval(x);
+				const Mat<ComplexType> J = sys.Jacobian(x);
+
+				const RealType scale = 1 + x.norm();
+				for (std::size_t ii = first; ii < last; ++ii)
+					if (abs(f(ii)) > tolerance*(1 + J.row(ii).norm()*scale))
+						return false;
+				return true;
+			}
+		}
+
+
+		/**
+		\brief Find the isolated solutions of a polynomial system by regeneration, equation by equation, tracking the paths of each stage on a pool of threads.
+
+		## Use
+
+		\code
+		config::Regeneration<mpfr_float> regeneration;
+		auto AMP = config::AMPConfigFrom(target);
+		auto solved = Regenerate<AMPTracker, EndgameSelector<AMPTracker>::PSEG>(target,
+			[&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			},
+			[](EndgameSelector<AMPTracker>::PSEG & endgame){}, mpfr("0.1"), regeneration);
+		\endcode
+
+		The target is affine, in one variable group, or homogenized and patched, when the points of every stage are on its patch, and paths to infinity stay finite.  The functions are taken in order of decreasing degree.
+
+		The homotopies of every stage, and of the moving slices, are tracked to the endgame boundary by TrackAllPaths, and finished by FinishPaths.  The trackers are configured by setup, which so must suit all of them, and for moving the slices, have their tracking tolerance set from the regeneration settings after.
+
+		\param target The system to solve, with at least as many functions as variables, and no path variable.
+		\param setup Configure a freshly made tracker.  Called concurrently, once per worker of every homotopy.
+		\param endgame_setup Configure a freshly made endgame.
+		\param boundary_time The time at the endgame boundary.
+		\param regeneration Which endpoints are removed between stages, and the tolerances for moving the slices.
+		\param config Which endpoints are finished by Newton's method, and which are nonsingular.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\throws std::runtime_error if the target is not polynomial, has a path variable, has fewer functions than variables, a function of degree 0, or its variables are not in one group, affine, or homogenized and patched.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename EndgameType, typename SetupFunction, typename EndgameSetupFunction>
+		RegenerationResults<typename TrackerTraits<TrackerType>::BaseComplexType>
+		Regenerate(System const& target,
+		           SetupFunction setup, EndgameSetupFunction endgame_setup,
+		           typename TrackerTraits<TrackerType>::BaseComplexType const& boundary_time,
+		           config::Regeneration<typename TrackerTraits<TrackerType>::BaseRealType> const& regeneration = config::Regeneration<typename TrackerTraits<TrackerType>::BaseRealType>(),
+		           StagedSolveConfig const& config = StagedSolveConfig(),
+		           unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using RealType = typename TrackerTraits<TrackerType>::BaseRealType;
+			using Nd = std::shared_ptr<node::Node>;
+
+			if (target.HavePathVariable())
+				throw std::runtime_error("regenerating a system with a path variable.  regeneration makes its own homotopies");
+			if (!target.IsPolynomial())
+				throw std::runtime_error("regenerating a non-polynomial system");
+			if (target.NumVariableGroups()!=1 || target.NumHomVariableGroups()!=0 || target.NumUngroupedVariables()!=0)
+				throw std::runtime_error("regenerating a system whose variables are not in one affine variable group");
+
+			const bool projective = target.NumHomVariables()!=0;
+			if (projective && !target.IsPatched())
+				throw std::runtime_error("regenerating a homogenized system without a patch");
+			if (!projective && target.IsPatched())
+				throw std::runtime_error("regenerating a patched system which is not homogenized");
+
+			const std::size_t num_vars = target.NumNaturalVariables();
+			const std::size_t num_functions = target.NumFunctions();
+			if (num_functions < num_vars)
+				throw std::runtime_error("regenerating a system of " + std::to_string(num_functions) + " functions in " + std::to_string(num_vars) + " variables.  regeneration finds isolated solutions, so needs at least as many functions as variables");
+
+			const auto target_degrees = target.Degrees();
+			std::vector<std::size_t> order(num_functions);
+			for (std::size_t ii = 0; ii < num_functions; ++ii)
+			{
+				if (target_degrees[ii] < 1)
+					throw std::runtime_error("regenerating a system with function " + std::to_string(ii) + " of degree " + std::to_string(target_degrees[ii]));
+				order[ii] = ii;
+			}
+			std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b){ return target_degrees[a] > target_degrees[b]; });
+
+			const auto precision = DefaultPrecision();
+			VariableGroup const& vars = target.Variables();
+
+			auto random_linears = [&](unsigned num)
+			{
+				return LinearSlice::RandomComplex(vars, num, projective).Functions();
+			};
+
+			// randomize down to as many functions as variables.  the extra functions are of no higher degree, and, for a homogenized system, are brought up to it by powers of a random linear function
+			std::vector<Nd> g(num_vars);
+			std::vector<int> degrees(num_vars);
+			const Nd homogenizer = projective ? random_linears(1)[0] : Nd();
+			for (std::size_t ii = 0; ii < num_vars; ++ii)
+			{
+				g[ii] = target.Function(order[ii]);
+				degrees[ii] = target_degrees[order[ii]];
+				for (std::size_t jj = num_vars; jj < num_functions; ++jj)
+				{
+					Nd extra = node::MakeNode<node::Rational>(node::Rational::Rand()) * target.Function(order[jj]);
+					const int difference = degrees[ii] - target_degrees[order[jj]];
+					if (projective && difference > 0)
+						extra = extra*pow(homogenizer, difference);
+					g[ii] = g[ii] + extra;
+				}
+			}
+
+			auto make_system = [&](std::vector<Nd> const& functions)
+			{
+				System sys;
+				sys.CopyVariableStructure(target);
+				for (const auto& f : functions)
+					sys.AddFunction(f);
+				if (projective)
+					sys.CopyPatches(target);
+				return sys;
+			};
+
+			const System randomized = make_system(g);
+			const std::vector<Nd> ell = random_linears(num_vars);
+
+			auto t = node::MakeNode<node::Variable>("t");
+			auto random_gamma = []()
+			{
+				return node::MakeNode<node::Rational>(node::Rational::Rand());
+			};
+
+			// the homotopy with the given function in slot k, the first k functions before it, and the linear functions after it
+			auto make_homotopy = [&](std::size_t k, Nd const& slot)
+			{
+				std::vector<Nd> functions(g.begin(), g.begin()+k);
+				functions.push_back(slot);
+				functions.insert(functions.end(), ell.begin()+k+1, ell.end());
+				System homotopy = make_system(functions);
+				homotopy.AddPathVariable(t);
+				return homotopy;
+			};
+
+			auto track = [&](System const& homotopy, std::vector< Vec<ComplexType> > const& starts,
+			                 auto tracking_setup, auto endgame_tracker_setup, StagedSolveConfig const& c)
+			{
+				auto at_boundary = TrackAllPaths<TrackerType>(homotopy, detail::StartPointList<ComplexType>(starts), tracking_setup,
+				                                               ComplexType(1), boundary_time, num_threads);
+				return FinishPaths<TrackerType, EndgameType>(homotopy, at_boundary, boundary_time, endgame_tracker_setup, endgame_setup, c, num_threads);
+			};
+
+			auto setup_before_endgame = [&](TrackerType & tracker)
+			{
+				setup(tracker);
+				tracker.TrackingTolerance(regeneration.newton_before_endgame);
+			};
+			auto setup_during_endgame = [&](TrackerType & tracker)
+			{
+				setup(tracker);
+				tracker.TrackingTolerance(regeneration.newton_during_endgame);
+			};
+			StagedSolveConfig slice_config = config;
+			slice_config.final_tolerance = static_cast<double>(regeneration.final_tolerance);
+
+			auto at_infinity = [&](Vec<ComplexType> const& x)
+			{
+				return (projective ? target.DehomogenizePoint(x).norm() : x.norm()) > regeneration.infinite_threshold;
+			};
+
+			// the one point at which the linear functions vanish
+			std::vector< Vec<ComplexType> > current;
+			{
+				const System linears = make_system(ell);
+				const Vec<ComplexType> zero = Vec<ComplexType>::Zero(linears.NumVariables());
+				PartialPivotLU<ComplexType> lu(zero.size());
+				lu.Factor(linears.Jacobian(zero));
+				Vec<ComplexType> x(zero.size());
+				lu.SolveNegative(x, linears.Eval(zero));
+				current.push_back(x);
+			}
+
+			RegenerationResults<ComplexType> results;
+			for (std::size_t k = 0; k < num_vars; ++k)
+			{
+				RegenerationStage stage;
+				const bool last = k+1==num_vars;
+				if (current.empty())
+				{
+					results.stages.push_back(stage);
+					continue;
+				}
+
+				// start points for the product of linear functions in slot k: the points of the last stage, and copies of them moved to the other linear functions
+				std::vector< Vec<ComplexType> > starts = current;
+				Nd product = ell[k];
+				for (int jj = 1; jj < degrees[k]; ++jj)
+				{
+					const Nd L = random_linears(1)[0];
+					product = product*L;
+
+					const auto moved = track(make_homotopy(k, (1-t)*L + random_gamma()*t*ell[k]), current, setup_before_endgame, setup_during_endgame, slice_config);
+					for (const auto& path : moved.paths)
+						if (path.success_code==SuccessCode::Success)
+						{
+							starts.push_back(path.endpoint);
+							++stage.num_regenerated;
+						}
+						else
+							++stage.num_failed;
+				}
+
+				const System homotopy = make_homotopy(k, (1-t)*g[k] + random_gamma()*t*product);
+				const auto solved = track(homotopy, starts, setup, setup, config);
+				stage.num_paths = starts.size();
+
+				std::vector< Vec<ComplexType> > next;
+				for (std::size_t ii = 0; ii < solved.paths.size(); ++ii)
+				{
+					auto const& path = solved.paths[ii];
+					if (path.success_code!=SuccessCode::Success)
+					{
+						++stage.num_failed;
+						continue;
+					}
+
+					auto const& x = path.endpoint;
+					const auto digits = Precision(x(0));
+					DefaultPrecision(digits);
+
+					if (at_infinity(x))
+					{
+						++stage.num_infinite;
+						if (last)
+							results.at_infinity.push_back(x);
+						else if (!regeneration.remove_infinite_endpoints)
+							next.push_back(x);
+						continue;
+					}
+
+					if (!detail::SolvesFunctions(randomized, x, 0, k+1, regeneration.solution_tolerance)
+					    || (last && !detail::SolvesFunctions(target, x, 0, num_functions, regeneration.solution_tolerance)))
+					{
+						++stage.num_nonsolutions;
+						continue;
+					}
+
+					homotopy.precision(digits);
+					const Mat<ComplexType> J = homotopy.Jacobian(x, ComplexType(0));
+					PartialPivotLU<ComplexType> lu(J.rows());
+					lu.Factor(J);
+					if (solved.cycle_numbers[ii]!=1
+					    || LUPartialPivotDecompositionSuccessful(lu.MatrixLU())!=MatrixSuccessCode::Success
+					    || detail::ConditionNumber(J, lu) > config.max_condition_number)
+					{
+						++stage.num_singular;
+						if (last)
+							results.singular_solutions.push_back(x);
+						continue;
+					}
+
+					// a generic point of a component which satisfies the next function lies on a component of too high a dimension to give isolated solutions
+					if (!last && regeneration.higher_dimension_check && detail::SolvesFunctions(randomized, x, k+1, k+2, regeneration.solution_tolerance))
+					{
+						++stage.num_higher_dimensional;
+						continue;
+					}
+
+					const RealType scale = 1 + x.norm();
+					if (std::any_of(next.begin(), next.end(), [&](Vec<ComplexType> const& y){ return (x-y).norm() <= regeneration.solution_tolerance*scale; }))
+					{
+						++stage.num_duplicates;
+						continue;
+					}
+
+					next.push_back(x);
+				}
+				DefaultPrecision(precision);
+
+				stage.num_kept = next.size();
+				results.stages.push_back(stage);
+				current = std::move(next);
+			}
+
+			results.solutions = std::move(current);
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,269 @@
+//This file is part of Bertini 2.
+//
+//ring_buffer.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//ring_buffer.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with ring_buffer.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file ring_buffer.hpp
+
+\brief A double-ended queue over a ring of slots which are reused, rather than freed, as elements leave it.
+
+The endgames keep their times and samples in queues, pushing a new sample at the back and popping the oldest from the front at every advance.  With a std::deque, each push allocates a new vector, of new multiple precision numbers.  Here, a popped slot keeps its storage, and the next push assigns into it, so that once the ring has grown to the number of samples kept, advancing allocates nothing.
+*/
+
+#ifndef BERTINI_TRACKING_RING_BUFFER_HPP
+#define BERTINI_TRACKING_RING_BUFFER_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief A queue of elements in a ring of slots, with the interface of std::deque used by the endgames.
+
+		Elements are pushed at the back, and popped from either end.  A popped slot is not destroyed, and keeps its storage for the next element pushed into it, which is assigned to it.  The ring grows, by doubling, only when it is full, and never shrinks, also when cleared.
+
+		Unlike std::deque, resize does not reset the elements it adds beyond the previous size, which hold whatever was last in their slots.  Assign them before reading them.
+		*/
+		template<typename T>
+		class RingBuffer
+		{
+		public:
+
+			using value_type = T;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = T&;
+			using const_reference = T const&;
+
+			/**
+			\brief Random access iterator over the elements, from front to back.
+			*/
+			template<typename RingT, typename ValueT>
+			class Iterator
+			{
+			public:
+				using iterator_category = std::random_access_iterator_tag;
+				using value_type = T;
+				using difference_type = std::ptrdiff_t;
+				using pointer = ValueT*;
+				using reference = ValueT&;
+
+				Iterator() = default;
+				Iterator(RingT* ring, size_type index) : ring_(ring), index_(index)
+				{}
+
+				reference operator*() const { return (*ring_)[index_]; }
+				pointer operator->() const { return &(*ring_)[index_]; }
+				reference operator[](difference_type n) const { return (*ring_)[index_+n]; }
+
+				Iterator& operator++() { ++index_; return *this; }
+				Iterator operator++(int) { auto copy = *this; ++index_; return copy; }
+				Iterator& operator--() { --index_; return *this; }
+				Iterator operator--(int) { auto copy = *this; --index_; return copy; }
+				Iterator& operator+=(difference_type n) { index_ += n; return *this; }
+				Iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+				Iterator operator+(difference_type n) const { return Iterator(ring_, index_+n); }
+				Iterator operator-(difference_type n) const { return Iterator(ring_, index_-n); }
+				difference_type operator-(Iterator const& other) const { return difference_type(index_) - difference_type(other.index_); }
+
+				bool operator==(Iterator const& other) const { return index_==other.index_; }
+				bool operator!=(Iterator const& other) const { return index_!=other.index_; }
+				bool operator<(Iterator const& other) const { return index_<other.index_; }
+				bool operator>(Iterator const& other) const { return index_>other.index_; }
+				bool operator<=(Iterator const& other) const { return index_<=other.index_; }
+				bool operator>=(Iterator const& other) const { return index_>=other.index_; }
+
+			private:
+				RingT* ring_ = nullptr;
+				size_type index_ = 0;
+			};
+
+			using iterator = Iterator<RingBuffer, T>;
+			using const_iterator = Iterator<const RingBuffer, const T>;
+
+
+			RingBuffer() = default;
+
+			/**
+			\brief Make a ring holding n value-initialized elements.
+			*/
+			explicit RingBuffer(size_type n) : slots_(n), size_(n)
+			{}
+
+
+			size_type size() const { return size_; }
+			bool empty() const { return size_==0; }
+
+			/**
+			\brief The number of elements which can be held before the ring grows.
+			*/
+			size_type capacity() const { return slots_.size(); }
+
+
+			reference operator[](size_type ii)
+			{
+				assert(ii < size_ && "index into ring buffer out of range");
+				return slots_[Slot(ii)];
+			}
+
+			const_reference operator[](size_type ii) const
+			{
+				assert(ii < size_ && "index into ring buffer out of range");
+				return slots_[Slot(ii)];
+			}
+
+			reference front() { return (*this)[0]; }
+			const_reference front() const { return (*this)[0]; }
+			reference back() { return (*this)[size_-1]; }
+			const_reference back() const { return (*this)[size_-1]; }
+
+			iterator begin() { return iterator(this, 0); }
+			iterator end() { return iterator(this, size_); }
+			const_iterator begin() const { return const_iterator(this, 0); }
+			const_iterator end() const { return const_iterator(this, size_); }
+			const_iterator cbegin() const { return begin(); }
+			const_iterator cend() const { return end(); }
+
+
+			/**
+			\brief Make room for n elements, so that holding up to that many allocates no more slots.
+			*/
+			void reserve(size_type n)
+			{
+				if (n <= slots_.size())
+					return;
+
+				// the elements are moved to the start of the new ring, so that the slots after them are the free ones
+				std::vector<T> grown(n);
+				for (size_type ii = 0; ii < size_; ++ii)
+					grown[ii] = std::move(slots_[Slot(ii)]);
+				for (size_type ii = size_; ii < slots_.size(); ++ii)
+					grown[ii] = std::move(slots_[Slot(ii)]);
+
+				slots_.swap(grown);
+				first_ = 0;
+			}
+
+
+			/**
+			\brief Assign a copy of value to the slot after the back, reusing its storage.
+
+			The value may be an element of this ring, such as its back.  It is copied before the ring grows, if it must.
+			*/
+			void push_back(T const& value)
+			{
+				if (size_==slots_.size())
+				{
+					T copy(value);
+					NextSlot() = std::move(copy);
+				}
+				else
+					NextSlot() = value;
+			}
+
+			void push_back(T && value)
+			{
+				if (size_==slots_.size())
+				{
+					T moved(std::move(value));
+					NextSlot() = std::move(moved);
+				}
+				else
+					NextSlot() = std::move(value);
+			}
+
+			template<typename... Args>
+			void emplace_back(Args&&... args)
+			{
+				T value(std::forward<Args>(args)...);
+				NextSlot() = std::move(value);
+			}
+
+
+			/**
+			\brief Remove the front element.  Its slot keeps its storage, for reuse.
+			*/
+			void pop_front()
+			{
+				assert(size_ > 0 && "popping from empty ring buffer");
+				first_ = Slot(1);
+				--size_;
+			}
+
+			/**
+			\brief Remove the back element.  Its slot keeps its storage, for reuse.
+			*/
+			void pop_back()
+			{
+				assert(size_ > 0 && "popping from empty ring buffer");
+				--size_;
+			}
+
+			/**
+			\brief Remove all the elements, keeping the slots and their storage.
+			*/
+			void clear()
+			{
+				first_ = 0;
+				size_ = 0;
+			}
+
+			/**
+			\brief Change the number of elements.  Those added hold whatever was last in their slots.
+			*/
+			void resize(size_type n)
+			{
+				reserve(n);
+				size_ = n;
+			}
+
+		private:
+
+			size_type Slot(size_type ii) const
+			{
+				const auto slot = first_ + ii;
+				return slot < slots_.size() ? slot : slot - slots_.size();
+			}
+
+			T& NextSlot()
+			{
+				if (size_==slots_.size())
+					reserve(slots_.empty() ? 4 : 2*slots_.size());
+				++size_;
+				return slots_[Slot(size_-1)];
+			}
+
+			std::vector<T> slots_; ///< The ring, holding the elements from first_, wrapping around.
+			size_type first_ = 0; ///< The slot of the front element.
+			size_type size_ = 0; ///< The number of elements.
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
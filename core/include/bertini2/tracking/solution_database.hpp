@@ -0,0 +1,174 @@
+//This file is part of Bertini 2.
+//
+//solution_database.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//solution_database.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with solution_database.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file solution_database.hpp
+
+\brief A persistent store of the solutions of members of a parametrized family, keyed by their parameter values, with an index finding the member nearest any other.
+
+Members of a family solved in production are often near members solved before.  A parameter homotopy from the nearest solved member, rather than the generic one, has paths as short as the parameters are close, see ParameterHomotopy::SolveEachFrom.  Each member solved is added to the database as it is, so later ones start from it.
+
+The database is a directory.  The solutions of each member are an endpoint file of their own, and the parameter values of the members are records of one more, in the order added, so everything is stored at the precision it was computed in.  The solutions of a member are written before its parameter values, so a member whose adding was cut short by a killed run is not found when the database is opened again.  One process at a time may have a database open.
+
+The nearest member is found by a k-d tree over the real and imaginary parts of the parameter values, rounded to double, grown as members are added.
+
+\code
+SolutionDatabase solved("solved_members", ph.NumParameters());
+ph.SolveEachFrom<AMPTracker>(solved, targets, setup, on_solved);
+\endcode
+*/
+
+#ifndef BERTINI_TRACKING_SOLUTION_DATABASE_HPP
+#define BERTINI_TRACKING_SOLUTION_DATABASE_HPP
+
+#include "bertini2/tracking/endpoint_file.hpp"
+
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace bertini {
+	namespace tracking {
+
+		/**
+		\brief Solved members of a parametrized family, stored in a directory, and found by the nearness of their parameter values.
+
+		Thread safe.
+		*/
+		class SolutionDatabase
+		{
+		public:
+
+			/**
+			\brief The entry found when there is none.
+			*/
+			static constexpr std::size_t None = std::numeric_limits<std::size_t>::max();
+
+			/**
+			\brief Open the database in a directory, made if there is none, and index the members in it.
+
+			\param directory Where the files of the database are.
+			\param num_parameters The number of parameters of the family.
+
+			\throws std::runtime_error if the directory cannot be made, or holds members with another number of parameters.
+			*/
+			SolutionDatabase(boost::filesystem::path const& directory, std::size_t num_parameters);
+
+			std::size_t NumParameters() const
+			{
+				return num_parameters_;
+			}
+
+			/**
+			\brief The number of members in the database.
+			*/
+			std::size_t NumEntries() const;
+
+			/**
+			\brief Add a member, and its solutions.
+
+			\return The number of the new entry.
+
+			\throws std::runtime_error if there is the wrong number of parameter values, or the files cannot be written.
+			*/
+			std::size_t Insert(Vec<mpfr> const& parameters, std::vector< Vec<dbl> > const& solutions);
+
+			/**
+			\overload
+			*/
+			std::size_t Insert(Vec<mpfr> const& parameters, std::vector< Vec<mpfr> > const& solutions);
+
+			/**
+			\brief Add a member, with the endpoints of those of its paths which succeeded as its solutions.
+			*/
+			template<typename ComplexType>
+			std::size_t Insert(Vec<mpfr> const& parameters, std::vector< PathResult<ComplexType> > const& results)
+			{
+				std::vector< Vec<ComplexType> > solutions;
+				for (const auto& r : results)
+					if (r.success_code==SuccessCode::Success)
+						solutions.push_back(r.endpoint);
+				return Insert(parameters, solutions);
+			}
+
+			/**
+			\brief The member whose parameter values are nearest, or None if there is no member to be found.
+
+			\param parameters The values of the parameters to be near.
+			\param min_solutions Consider only members with at least this many solutions.
+			*/
+			std::size_t Nearest(Vec<mpfr> const& parameters, std::size_t min_solutions = 0) const;
+
+			/**
+			\brief The values of the parameters of a member.
+			*/
+			Vec<mpfr> Parameters(std::size_t entry) const;
+
+			/**
+			\brief The number of solutions of a member.
+			*/
+			std::size_t NumSolutions(std::size_t entry) const;
+
+			/**
+			\brief The solutions of a member, read from its file, at the precision they were stored in.
+			*/
+			std::vector< Vec<mpfr> > Solutions(std::size_t entry) const;
+
+		private:
+
+			struct KdNode
+			{
+				std::size_t entry;
+				std::size_t children[2];
+			};
+
+			template<typename ComplexType>
+			std::size_t InsertSolutions(Vec<mpfr> const& parameters, std::vector< Vec<ComplexType> > const& solutions);
+
+			/**
+			\brief Add an entry to the index.  The mutex must be held.
+			*/
+			void Index(Vec<mpfr> const& parameters, std::size_t num_solutions);
+
+			void Search(std::size_t node, unsigned depth, std::vector<double> const& query, std::size_t min_solutions, std::size_t & best, double & best_distance) const;
+
+			std::vector<double> Coordinates(Vec<mpfr> const& parameters) const;
+
+			boost::filesystem::path SolutionsFile(std::size_t entry) const;
+
+			boost::filesystem::path directory_;
+			std::size_t num_parameters_;
+			std::unique_ptr<EndpointWriter> parameters_writer_;
+
+			mutable std::mutex mutex_;
+			std::vector< Vec<mpfr> > parameters_; ///< Of each entry.
+			std::vector<std::size_t> num_solutions_; ///< Of each entry.
+			std::vector<double> coordinates_; ///< The real and imaginary parts of the parameters of each entry, rounded to double, 2*num_parameters_ per entry.
+			std::vector<KdNode> tree_; ///< The k-d tree over coordinates_, the root first.  The axis of a node is its depth, modulo the number of coordinates.
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,700 @@
+//This file is part of Bertini 2.
+//
+//staged_solve.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//staged_solve.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with staged_solve.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file staged_solve.hpp
+
+\brief Solve a homotopy in stages: track every path to the endgame boundary, finish the nonsingular ones by Newton's method, and run endgames only on the rest.
+
+Running the endgame on each path right after tracking it interleaves cheap tracking with expensive, high precision endgames on the same thread, so that how long a run takes, and how much memory it holds, depends on the order of the paths.  Here, the stages are separate, each on a pool of threads:
+
+1. Every path is tracked to the endgame boundary, by TrackAllPaths, or, for a start system with very many points, TrackAllPathsBatched.
+2. Each point at the boundary is carried to t=0 by one Euler step, and corrected there by Newton's method.  If Newton converges quadratically, to a point at which the condition number of the Jacobian is modest, the endpoint is nonsingular, and the path is done.
+3. The paths left, suspected singular, or diverging, are queued for the endgame, run from the boundary.  A tracker choosing the boundary of each path, see config::EndgameBoundary, stops the paths which show singular behaviour before the boundary, and these skip Newton's method, their endgames starting where they stopped.  An endpoint the endgame finds singular, by its cycle number or the condition number of the Jacobian, but not to the final tolerance, is refined by deflation, see RefineByDeflation, which restores the quadratic convergence of Newton's method.
+
+Between the first two, the points at the boundary are checked for paths which crossed.  At the boundary the homotopy is generic, so its solutions are distinct, and nonsingular unless the paths are already converging to a singular endpoint.  Two paths reaching the same point, at which the Jacobian is well conditioned, means one jumped to the other.  Not knowing which, both are tracked to the boundary again, alone, with a smaller largest step size and a tighter tracking tolerance, rather than tightening the settings of every path.  The points are hashed, as for post-processing, so finding the crossings costs no more than the number of paths, and condition numbers are estimated only for points reached twice.
+*/
+
+#ifndef BERTINI_TRACKING_STAGED_SOLVE_HPP
+#define BERTINI_TRACKING_STAGED_SOLVE_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+#include "bertini2/tracking/condition_estimate.hpp"
+#include "bertini2/deflation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief Settings for deciding which paths are finished by Newton's method, rather than an endgame.
+		*/
+		struct StagedSolveConfig
+		{
+			double max_condition_number = 1e8; ///< The largest condition number of the Jacobian at an endpoint taken to be nonsingular.
+			double final_tolerance = 1e-11; ///< Newton's method at t=0 has converged once its step is this short, relative to the norm of the point.
+			unsigned max_newton_iterations = 6; ///< The number of Newton steps at t=0, before giving the path to the endgame.
+
+			unsigned max_retracks = 2; ///< The most times the paths which crossed are tracked to the boundary again, each time with tighter settings.  0 turns the check for crossings off.
+			double crossing_tolerance = 1e-8; ///< Two points at the boundary are the same if they differ by at most this, relative to their norms.
+			double retrack_tightening = 0.1; ///< The factor on the largest step size and the tracking tolerance for each retracking, so its square for the second.
+
+			unsigned max_deflations = 3; ///< The most times the homotopy at t=0 is deflated to refine a singular endpoint of the endgame.  0 turns deflation off.
+			double deflation_rank_tolerance = 1e-6; ///< Singular values of the Jacobian below this, relative to the largest, count as zero in its rank, when deflating.
+		};
+
+
+		/**
+		\brief The stage at which a path was finished.
+		*/
+		enum class FinishedBy
+		{
+			Tracking, ///< Tracking to the endgame boundary failed, so the path went no further.
+			Newton, ///< The endpoint is nonsingular, and was found by Newton's method from the boundary.
+			Endgame ///< The path was finished by the endgame.
+		};
+
+
+		/**
+		\brief The outcome of a staged solve.
+		*/
+		template<typename ComplexType>
+		struct StagedResults
+		{
+			std::vector< PathResult<ComplexType> > paths; ///< The result of each path, in the order of the start points.  The endpoint is at t=0, unless the path failed.
+			std::vector< FinishedBy > finished_by; ///< The stage at which each path was finished.
+			std::vector< unsigned > cycle_numbers; ///< The cycle number of each path, found by the endgame, 1 for those finished by Newton's method, and 0 for those which failed tracking.
+			std::vector< unsigned > retracks; ///< The number of times each path was tracked to the boundary again, after crossing another.
+			std::vector< unsigned > deflations; ///< The number of times the homotopy was deflated to refine the endpoint of each path, 0 for those not refined.
+		};
+
+
+		namespace detail {
+
+			/**
+			\brief Estimate the condition number of a matrix in the 1-norm, from its factorization.
+
+			\param J The matrix.
+			\param lu Its factorization.
+			*/
+			template<typename ComplexType>
+			typename Eigen::NumTraits<ComplexType>::Real ConditionNumber(Mat<ComplexType> const& J, PartialPivotLU<ComplexType> const& lu)
+			{
+				using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+				using std::abs;
+
+				RealType norm_J(0);
+				for (Eigen::DenseIndex jj = 0; jj < J.cols(); ++jj)
+				{
+					RealType column(0);
+					for (Eigen::DenseIndex kk = 0; kk < J.rows(); ++kk)
+						column += abs(J(kk,jj));
+					if (column > norm_J)
+						norm_J = column;
+				}
+
+				NormInverseEstimator<ComplexType> estimator;
+				return norm_J*estimator.Estimate(lu, config::NormInverseEstimate::Hager);
+			}
+
+
+			/**
+			\brief Whether two points are the same, to within a tolerance relative to their norms.
+
+			The difference is taken at the higher of their precisions, so that neither is rounded to the other's.  The points are known only to the lower precision, though, so are not asked to agree beyond it, even for a tighter tolerance.
+			*/
+			template<typename ComplexType>
+			bool SameEndpoint(Vec<ComplexType> const& a, Vec<ComplexType> const& b, double tolerance)
+			{
+				using std::max;
+				using std::min;
+
+				const unsigned digits_a = Precision(a), digits_b = Precision(b);
+				const double within = max(tolerance, 100*std::pow(10.0, -static_cast<double>(min(digits_a, digits_b))));
+
+				const auto precision = DefaultPrecision();
+				if (!std::is_same<ComplexType,dbl>::value)
+					DefaultPrecision(max(digits_a, digits_b));
+				const bool same = (a-b).norm() <= within*(1 + max(a.norm(), b.norm()));
+				DefaultPrecision(precision);
+				return same;
+			}
+
+
+			/**
+			\brief The cells of a spatial hash on points, of a given width, by their projections onto three fixed random real directions.
+			*/
+			class EndpointCells
+			{
+			public:
+
+				using Cell = std::array<long long, 3>;
+
+				/**
+				\param num_variables The number of complex coordinates of the points.
+				\param width The width of the cells.  Points closer than this are in the same or neighbouring cells.
+				*/
+				EndpointCells(std::size_t num_variables, double width) : width_(width)
+				{
+					for (auto& direction : directions_)
+					{
+						direction.resize(num_variables);
+						for (std::size_t ii = 0; ii < num_variables; ++ii)
+							direction(ii) = RandomUnit<dbl>();
+						direction /= direction.norm();
+					}
+				}
+
+				/**
+				\brief The cell of a point.
+				*/
+				template<typename ComplexType>
+				Cell Of(Vec<ComplexType> const& x) const
+				{
+					Cell cell;
+					for (unsigned jj = 0; jj < 3; ++jj)
+					{
+						// the real part of the hermitian product is the real dot product of the real and imaginary parts, so moves no more than the point does
+						dbl projection(0);
+						for (int ii = 0; ii < x.size(); ++ii)
+							projection += std::conj(directions_[jj](ii)) * static_cast<dbl>(x(ii));
+						cell[jj] = static_cast<long long>(std::floor(projection.real()/width_));
+					}
+					return cell;
+				}
+
+				/**
+				\brief Call a function with the index of each point in the cells around one, stopping once it returns true.
+
+				\return Whether the function returned true.
+				*/
+				template<typename Function>
+				bool AnyNear(Cell const& cell, Function f) const
+				{
+					for (long long d0 = -1; d0 <= 1; ++d0)
+						for (long long d1 = -1; d1 <= 1; ++d1)
+							for (long long d2 = -1; d2 <= 1; ++d2)
+							{
+								auto found = cells_.find(Cell{cell[0]+d0, cell[1]+d1, cell[2]+d2});
+								if (found!=cells_.end())
+									for (auto index : found->second)
+										if (f(index))
+											return true;
+							}
+					return false;
+				}
+
+				/**
+				\brief Put the index of a point in a cell.
+				*/
+				void Add(Cell const& cell, std::size_t index)
+				{
+					cells_[cell].push_back(index);
+				}
+
+			private:
+
+				struct CellHash
+				{
+					std::size_t operator()(Cell const& c) const
+					{
+						std::size_t h = std::hash<long long>()(c[0]);
+						h = h*1000003 ^ std::hash<long long>()(c[1]);
+						return h*1000003 ^ std::hash<long long>()(c[2]);
+					}
+				};
+
+				double width_;
+				std::array< Vec<dbl>, 3 > directions_;
+				std::unordered_map< Cell, std::vector<std::size_t>, CellHash > cells_;
+			};
+
+
+			/**
+			\brief Whether a path stopped short of the endgame boundary, at one chosen for it by its tracker, see config::EndgameBoundary, having shown singular behaviour.
+			*/
+			template<typename ComplexType>
+			bool StoppedBeforeBoundary(PathResult<ComplexType> const& result, ComplexType const& boundary_time)
+			{
+				using std::abs;
+				return static_cast<double>(abs(result.time)) > static_cast<double>(abs(boundary_time))*(1 + 1e-8);
+			}
+
+
+			/**
+			\brief The paths which crossed another on the way to the boundary: those reaching the same point, at which the Jacobian of the homotopy is well conditioned.
+
+			The homotopy is evaluated at the precision of each point, on the calling thread.
+
+			\param homotopy The homotopy tracked.
+			\param at_boundary The results of tracking each path to the boundary.
+			\param boundary_time The time at the boundary.
+			\param config The tolerance on the points, and the largest condition number of a well conditioned point.
+
+			\return The indices of the paths, in increasing order.
+			*/
+			template<typename ComplexType>
+			std::vector<std::size_t> CrossedPaths(System const& homotopy, std::vector< PathResult<ComplexType> > const& at_boundary,
+			                                      ComplexType const& boundary_time, StagedSolveConfig const& config)
+			{
+				using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+				RealType max_norm(0);
+				for (const auto& r : at_boundary)
+					if (r.success_code==SuccessCode::Success && r.endpoint.norm() > max_norm)
+						max_norm = r.endpoint.norm();
+				EndpointCells cells(homotopy.NumVariables(), config.crossing_tolerance*(1 + static_cast<double>(max_norm)) + 1e-12*(1 + static_cast<double>(max_norm)));
+
+				const auto precision = DefaultPrecision();
+				auto well_conditioned = [&](Vec<ComplexType> const& x)
+				{
+					const auto digits = Precision(x(0));
+					DefaultPrecision(digits);
+					homotopy.precision(digits);
+
+					ComplexType t = boundary_time;
+					Precision(t, digits);
+
+					const Mat<ComplexType> J = homotopy.Jacobian(x, t);
+					PartialPivotLU<ComplexType> lu(J.rows());
+					lu.Factor(J);
+					return LUPartialPivotDecompositionSuccessful(lu.MatrixLU())==MatrixSuccessCode::Success
+					       && ConditionNumber(J, lu) <= config.max_condition_number;
+				};
+
+				std::vector<char> crossed(at_boundary.size(), 0);
+				for (std::size_t ii = 0; ii < at_boundary.size(); ++ii)
+				{
+					if (at_boundary[ii].success_code!=SuccessCode::Success || StoppedBeforeBoundary(at_boundary[ii], boundary_time))
+						continue;
+
+					auto const& x = at_boundary[ii].endpoint;
+					const auto cell = cells.Of(x);
+					cells.AnyNear(cell, [&](std::size_t jj)
+						{
+							if (SameEndpoint(at_boundary[jj].endpoint, x, config.crossing_tolerance) && well_conditioned(x))
+								crossed[ii] = crossed[jj] = 1;
+							return false;
+						});
+					cells.Add(cell, ii);
+				}
+				DefaultPrecision(precision);
+
+				std::vector<std::size_t> indices;
+				for (std::size_t ii = 0; ii < crossed.size(); ++ii)
+					if (crossed[ii])
+						indices.push_back(ii);
+				return indices;
+			}
+
+
+			/**
+			\brief Tighten the settings of a tracker for tracking a path again: its largest step size, and its tracking tolerance, each by a factor.
+			*/
+			template<typename TrackerType>
+			void TightenForRetrack(TrackerType & tracker, double factor)
+			{
+				using std::min;
+
+				auto stepping = tracker.SteppingSettings();
+				stepping.max_step_size *= factor;
+				stepping.initial_step_size = min(stepping.initial_step_size, stepping.max_step_size);
+				tracker.SteppingSettings(stepping);
+				tracker.TrackingTolerance(tracker.TrackingTolerance()*factor);
+			}
+
+
+			/**
+			\brief Carry a point on a path at time t to t=0 by an Euler step, correct it there by Newton's method, and decide whether the endpoint is nonsingular.
+
+			The system is evaluated at the precision of the point.
+
+			\param endpoint The point found at t=0.
+			\param sys The homotopy.
+			\param t The time of the point, at its precision.
+			\param point A point on the path at time t.
+			\param config When Newton's method has converged, and to a nonsingular point.
+
+			\return Whether Newton's method converged quadratically, within the length of the Euler step from the predicted point, to a point at which the Jacobian has condition number at most config.max_condition_number.
+			*/
+			template<typename ComplexType>
+			bool FinishByNewton(Vec<ComplexType> & endpoint, System const& sys, ComplexType const& t, Vec<ComplexType> const& point, StagedSolveConfig const& config)
+			{
+				using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+				using std::abs;
+
+				const auto precision = Precision(point(0));
+				DefaultPrecision(precision);
+				sys.precision(precision);
+
+				const auto n = point.size();
+				PartialPivotLU<ComplexType> lu(n);
+				Vec<ComplexType> step(n);
+
+				auto factor = [&](Mat<ComplexType> const& J)
+				{
+					lu.Factor(J);
+					return LUPartialPivotDecompositionSuccessful(lu.MatrixLU())==MatrixSuccessCode::Success;
+				};
+
+				// x(0) = x(t) - t*dx/dt, with dx/dt = -J^{-1} dH/dt
+				if (!factor(sys.Jacobian(point, t)))
+					return false;
+				lu.Solve(step, sys.TimeDerivative(point, t));
+				endpoint = point + t*step;
+
+				const Vec<ComplexType> predicted = endpoint;
+				const RealType euler_length = abs(t)*step.norm();
+
+				const ComplexType zero(0);
+				RealType previous_norm(0);
+				bool converged = false;
+				for (unsigned ii = 0; ii < config.max_newton_iterations && !converged; ++ii)
+				{
+					if (!factor(sys.Jacobian(endpoint, zero)))
+						return false;
+					lu.Solve(step, sys.Eval(endpoint, zero));
+					endpoint -= step;
+
+					const RealType step_norm = step.norm();
+					converged = step_norm <= config.final_tolerance*(1+endpoint.norm());
+
+					// Newton's method converges only linearly to a singular endpoint, halving its step each time
+					if (!converged && ii > 0 && 4*step_norm > previous_norm)
+						return false;
+					previous_norm = step_norm;
+				}
+				// a correction longer than the prediction may have found the endpoint of another path
+				if (!converged || (endpoint - predicted).norm() > euler_length)
+					return false;
+
+				Mat<ComplexType> J = sys.Jacobian(endpoint, zero);
+				if (!factor(J))
+					return false;
+
+				return ConditionNumber(J, lu) <= config.max_condition_number;
+			}
+
+
+			/**
+			\brief Refine an endpoint of the endgame by deflation, if it is singular, and not already accurate to the final tolerance.
+
+			The endpoint is singular if the cycle number is above 1, or the condition number of the Jacobian at it above config.max_condition_number.  The refined point is kept only if it is within ten times the accuracy of the endgame of the endpoint, so is the same root, found more accurately.
+
+			\param endpoint The endpoint of the endgame, refined in place.
+			\param num_deflations The number of times the homotopy was deflated.
+			\param sys The homotopy, evaluated at t=0.  Its trees are evaluated by the deflated systems, so it must be a copy of its own, sharing none with another thread.
+			\param cycle_number The cycle number found by the endgame.
+			\param accuracy The estimate of the error of the endpoint, from the endgame.
+			\param config The final tolerance, the largest condition number of a nonsingular endpoint, and the settings of deflation.
+
+			\return Whether the endpoint was refined.
+			*/
+			template<typename ComplexType, typename RealType>
+			bool RefineSingularEndpoint(Vec<ComplexType> & endpoint, unsigned & num_deflations, System const& sys,
+			                            unsigned cycle_number, RealType const& accuracy, StagedSolveConfig const& config)
+			{
+				const auto precision = Precision(endpoint(0));
+				DefaultPrecision(precision);
+				sys.precision(precision);
+
+				const double target = config.final_tolerance*(1 + static_cast<double>(endpoint.norm()));
+				if (static_cast<double>(accuracy) <= target)
+					return false;
+
+				if (cycle_number <= 1)
+				{
+					const Mat<ComplexType> J = sys.Jacobian(endpoint, ComplexType(0));
+					PartialPivotLU<ComplexType> lu(J.rows());
+					lu.Factor(J);
+					if (LUPartialPivotDecompositionSuccessful(lu.MatrixLU())==MatrixSuccessCode::Success
+					    && ConditionNumber(J, lu) <= config.max_condition_number)
+						return false;
+				}
+
+				DeflationConfig deflation;
+				deflation.rank_tolerance = config.deflation_rank_tolerance;
+				deflation.tolerance = config.final_tolerance;
+				deflation.max_deflations = config.max_deflations;
+
+				Vec<ComplexType> refined;
+				try
+				{
+					if (!RefineByDeflation(refined, num_deflations, sys, endpoint, deflation))
+						return false;
+				}
+				catch (std::runtime_error const&)
+				{
+					// the multipliers could not be found, so the endpoint of the endgame stands
+					return false;
+				}
+
+				if ((refined - endpoint).norm() > 10*accuracy + target)
+					return false;
+
+				endpoint = refined;
+				return true;
+			}
+		}
+
+
+		/**
+		\brief Finish paths tracked to the endgame boundary: those with nonsingular endpoints by Newton's method, and the rest by the endgame, on a pool of threads.
+
+		## Use
+
+		\code
+		auto at_boundary = TrackAllPathsBatched(homotopy, TD, batch_setup, dbl(1), dbl(0.1));
+		auto finished = FinishPaths<AMPTracker, EndgameSelector<AMPTracker>::PSEG>(homotopy, at_boundary, mpfr("0.1"),
+			tracker_setup, [](EndgameSelector<AMPTracker>::PSEG & endgame){}, StagedSolveConfig());
+		\endcode
+
+		The Newton stage runs first, over all the paths which reached the boundary, and the endgames after it, over those it did not finish, and those which stopped before the boundary at one of their own, from where they stopped, see config::EndgameBoundary.  Singular endpoints of the endgame not accurate to config.final_tolerance are refined by deflation, unless config.max_deflations is 0.  Each worker evaluates its own copy of the homotopy, and for deflation, another sharing no trees with it, made before the endgames start.  For the endgames, each worker makes a tracker on its copy, passes it to setup, then makes an endgame on the tracker, and passes that to endgame_setup.  Both are called once per worker, concurrently, so must not evaluate anything shared.
+
+		\param homotopy The homotopy tracked.
+		\param at_boundary The results of tracking each path to the boundary, as from TrackAllPaths.
+		\param boundary_time The time at the endgame boundary.
+		\param setup Configure a freshly made tracker.
+		\param endgame_setup Configure a freshly made endgame.
+		\param config Which endpoints are finished by Newton's method.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename EndgameType, typename SetupFunction, typename EndgameSetupFunction>
+		StagedResults<typename TrackerTraits<TrackerType>::BaseComplexType>
+		FinishPaths(System const& homotopy,
+		            std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> > const& at_boundary,
+		            typename TrackerTraits<TrackerType>::BaseComplexType const& boundary_time,
+		            SetupFunction setup, EndgameSetupFunction endgame_setup,
+		            StagedSolveConfig const& config = StagedSolveConfig(),
+		            unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using RealType = typename TrackerTraits<TrackerType>::BaseRealType;
+
+			const auto num_paths = at_boundary.size();
+
+			StagedResults<ComplexType> results;
+			results.paths = at_boundary;
+			results.finished_by.assign(num_paths, FinishedBy::Tracking);
+			results.cycle_numbers.assign(num_paths, 0);
+			results.retracks.assign(num_paths, 0);
+			results.deflations.assign(num_paths, 0);
+
+			// the paths which stopped before the boundary showed singular behaviour, so go straight to the endgame
+			std::vector<std::size_t> tracked, stopped_early;
+			for (std::size_t ii = 0; ii < num_paths; ++ii)
+				if (at_boundary[ii].success_code==SuccessCode::Success)
+				{
+					if (detail::StoppedBeforeBoundary(at_boundary[ii], boundary_time))
+						stopped_early.push_back(ii);
+					else
+						tracked.push_back(ii);
+				}
+
+			if (num_threads==0)
+				num_threads = detail::DefaultNumWorkers();
+			num_threads = std::min<unsigned>(num_threads, std::max<std::size_t>(tracked.size() + stopped_early.size(), 1));
+
+			// every worker gets its own copies, from the pool: one for each precision of the points at the boundary in stage two, and one for the endgames in stage three
+			SystemPool homotopies(homotopy);
+
+			std::atomic<bool> stop(false);
+
+			// each path draws its random numbers from a stream of its own, as in TrackAllPaths
+			const auto path_streams = ThreadRandomStream().Fork();
+
+			// stage two: Newton's method at t=0, from every point at the boundary
+			std::vector<char> nonsingular(num_paths, 0);
+			std::atomic<std::size_t> next(0);
+			detail::RunWorkers(num_threads, stop, [&](unsigned worker)
+			{
+				Vec<ComplexType> endpoint;
+
+				std::size_t kk;
+				while (!stop && (kk = next++) < tracked.size())
+				{
+					const auto ii = tracked[kk];
+					auto const& point = at_boundary[ii].endpoint;
+					ScopedRandomStream random(path_streams.Substream(ii));
+					trace::ScopedPath traced(ii);
+
+					// the points at the boundary are at several precisions, and the copy for each is kept at its own
+					System const& sys = *homotopies.Acquire(worker, Precision(point(0)));
+
+					ComplexType t = boundary_time;
+					Precision(t, Precision(point(0)));
+
+					if (detail::FinishByNewton(endpoint, sys, t, point, config))
+					{
+						nonsingular[ii] = 1;
+						results.paths[ii].endpoint = endpoint;
+						results.paths[ii].time = ComplexType(0);
+						results.finished_by[ii] = FinishedBy::Newton;
+						results.cycle_numbers[ii] = 1;
+					}
+				}
+			});
+
+			// stage three: the endgame, for the rest
+			std::vector<std::size_t> suspected_singular(stopped_early);
+			for (auto ii : tracked)
+				if (!nonsingular[ii])
+					suspected_singular.push_back(ii);
+			std::sort(suspected_singular.begin(), suspected_singular.end());
+
+			const auto num_endgame_threads = std::min<unsigned>(num_threads, std::max<std::size_t>(suspected_singular.size(), 1));
+
+			// the deflated systems are built on the trees of the homotopy, so each worker deflates a copy of its own, sharing none with the pool's.  they are made here, one at a time
+			std::vector< std::shared_ptr<System> > deflation_copies;
+			if (config.max_deflations > 0 && !suspected_singular.empty())
+			{
+				const auto archived = detail::Archive(homotopy);
+				for (unsigned ii = 0; ii < num_endgame_threads; ++ii)
+					deflation_copies.push_back(std::make_shared<System>(detail::CloneFromArchive<System>(archived)));
+			}
+
+			next = 0;
+			detail::RunWorkers(num_endgame_threads, stop, [&](unsigned worker)
+			{
+				// the endgame changes the precision of its copy as it goes, so has one of its own
+				const auto held = homotopies.Acquire(num_threads + worker, homotopy.precision());
+				System const& sys = *held;
+
+				TrackerType tracker(sys);
+				setup(tracker);
+				EndgameType endgame(tracker);
+				endgame_setup(endgame);
+
+				std::unique_ptr< TraceRecorder<TrackerType> > trace_recorder;
+				if (auto timeline = trace::Active())
+				{
+					trace_recorder.reset(new TraceRecorder<TrackerType>(*timeline));
+					tracker.AddObserver(trace_recorder.get());
+				}
+
+				std::size_t kk;
+				while (!stop && (kk = next++) < suspected_singular.size())
+				{
+					const auto ii = suspected_singular[kk];
+					auto const& point = at_boundary[ii].endpoint;
+					ScopedRandomStream random(path_streams.Substream(num_paths + ii));
+					trace::ScopedPath traced(ii);
+
+					const auto precision = Precision(point(0));
+					DefaultPrecision(precision);
+					sys.precision(precision);
+					ComplexType t = detail::StoppedBeforeBoundary(at_boundary[ii], boundary_time) ? at_boundary[ii].time : boundary_time;
+					Precision(t, precision);
+
+					auto& result = results.paths[ii];
+					trace::Record(trace::EventKind::EndgameBegin);
+					result.success_code = endgame.Run(t, point);
+					trace::Record(trace::EventKind::EndgameEnd, static_cast<std::uint32_t>(result.success_code));
+					result.endpoint = endgame.template FinalApproximation<ComplexType>();
+					result.time = result.success_code==SuccessCode::Success ? ComplexType(0) : tracker.CurrentTime();
+					results.finished_by[ii] = FinishedBy::Endgame;
+					results.cycle_numbers[ii] = endgame.CycleNumber();
+
+					unsigned num_deflations;
+					if (result.success_code==SuccessCode::Success && !deflation_copies.empty()
+					    && detail::RefineSingularEndpoint(result.endpoint, num_deflations, *deflation_copies[worker],
+					                                      endgame.CycleNumber(), endgame.template ApproximateError<RealType>(), config))
+						results.deflations[ii] = num_deflations;
+				}
+			});
+
+			return results;
+		}
+
+
+		/**
+		\brief Track every path of a homotopy to the endgame boundary, then finish them in stages, each on a pool of threads.
+
+		Stage one is TrackAllPaths to the boundary, with the paths which crossed tracked again, and the others FinishPaths.  For batched tracking in double precision in stage one, call TrackAllPathsBatched and FinishPaths instead.
+
+		\param homotopy The system to track on.
+		\param start_system The source of the start points.
+		\param setup Configure a freshly made tracker, for both tracking and the endgames.
+		\param endgame_setup Configure a freshly made endgame.
+		\param start_time The time at which the start points solve the homotopy.
+		\param boundary_time The time at the endgame boundary.
+		\param config Which endpoints are finished by Newton's method, and how paths which crossed are tracked again.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+		*/
+		template<typename TrackerType, typename EndgameType, typename StartSystemType, typename SetupFunction, typename EndgameSetupFunction>
+		StagedResults<typename TrackerTraits<TrackerType>::BaseComplexType>
+		SolveInStages(System const& homotopy, StartSystemType const& start_system,
+		              SetupFunction setup, EndgameSetupFunction endgame_setup,
+		              typename TrackerTraits<TrackerType>::BaseComplexType const& start_time,
+		              typename TrackerTraits<TrackerType>::BaseComplexType const& boundary_time,
+		              StagedSolveConfig const& config = StagedSolveConfig(),
+		              unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			auto at_boundary = TrackAllPaths<TrackerType>(homotopy, start_system, setup, start_time, boundary_time, num_threads);
+
+			// the paths which crossed are queued to be tracked again, alone, each time with tighter settings than the last
+			std::vector<unsigned> retracks(at_boundary.size(), 0);
+			for (unsigned retrack = 1; retrack <= config.max_retracks; ++retrack)
+			{
+				const auto crossed = detail::CrossedPaths(homotopy, at_boundary, boundary_time, config);
+				if (crossed.empty())
+					break;
+
+				std::vector< Vec<ComplexType> > starts;
+				for (auto ii : crossed)
+					starts.push_back(start_system.template StartPoint<ComplexType>(ii));
+
+				const double factor = std::pow(config.retrack_tightening, retrack);
+				auto retracked = TrackAllPaths<TrackerType>(homotopy, detail::StartPointList<ComplexType>(starts),
+					[&](TrackerType & tracker)
+					{
+						setup(tracker);
+						detail::TightenForRetrack(tracker, factor);
+					},
+					start_time, boundary_time, num_threads);
+
+				for (std::size_t kk = 0; kk < crossed.size(); ++kk)
+				{
+					retracked[kk].index = crossed[kk];
+					at_boundary[crossed[kk]] = std::move(retracked[kk]);
+					retracks[crossed[kk]] = retrack;
+				}
+			}
+
+			auto results = FinishPaths<TrackerType, EndgameType>(homotopy, at_boundary, boundary_time, setup, endgame_setup, config, num_threads);
+			results.retracks = std::move(retracks);
+			return results;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,153 @@
+//This file is part of Bertini 2.
+//
+//tiered_endgame.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//tiered_endgame.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with tiered_endgame.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file tiered_endgame.hpp
+
+\brief Run an endgame in double precision first, and in adaptive multiple precision only if that fails.
+
+The adaptive precision endgames refine their samples to a fraction of the final tolerance, and so tend to raise precision early, even for endpoints of low cycle number which an endgame in double precision finishes as well.  RunTieredEndgame tries the double precision endgame first, and keeps its result if it converged and AMP criterion A holds where its tracker stopped, so that double precision was enough near the end of the path.  Otherwise it runs the adaptive precision endgame from the start.
+*/
+
+#ifndef BERTINI_TRACKING_TIERED_ENDGAME_HPP
+#define BERTINI_TRACKING_TIERED_ENDGAME_HPP
+
+#include "bertini2/tracking/base_endgame.hpp"
+#include "bertini2/tracking/amp_criteria.hpp"
+#include "bertini2/tracking/condition_estimate.hpp"
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief The precision at which an endgame was run.
+		*/
+		enum class EndgameTier
+		{
+			Double, ///< In double precision.
+			Multiple ///< In adaptive multiple precision.
+		};
+
+
+		/**
+		\brief The outcome of running an endgame in tiers.
+		*/
+		struct TieredEndgameResult
+		{
+			SuccessCode success_code; ///< The code of the last endgame run.
+			EndgameTier tier; ///< The tier of the last endgame run, which is the one which succeeded, if either did.
+			unsigned cycle_number; ///< The cycle number found by the last endgame run.
+			Vec<mpfr> endpoint; ///< The approximation of the endpoint, at the precision it was found at.
+		};
+
+
+		namespace detail {
+
+			/**
+			\brief Whether double precision suffices at the point where a tracker in double precision last stopped, by AMP criterion A on the Jacobian there.
+
+			The endgame stops short of the endpoint, so the Jacobian there is nonsingular, if perhaps poorly conditioned.
+			*/
+			template<typename TrackerType>
+			bool DoubleSufficesAtCurrentPoint(TrackerType const& tracker, config::AdaptiveMultiplePrecisionConfig const& AMP)
+			{
+				const Vec<dbl> point = tracker.CurrentPoint();
+				const Mat<dbl> J = tracker.GetSystem().Jacobian(point, dbl(tracker.CurrentTime()));
+
+				PartialPivotLU<dbl> lu(J.rows());
+				lu.Factor(J);
+				if (LUPartialPivotDecompositionSuccessful(lu.MatrixLU())!=MatrixSuccessCode::Success)
+					return false;
+
+				NormInverseEstimator<dbl> estimator;
+				return amp::CriterionA<double>(J.norm(), estimator.Estimate(lu, config::NormInverseEstimate::Hager), AMP);
+			}
+		}
+
+
+		/**
+		\brief Run an endgame in double precision, and if it fails, or double precision was not enough, in adaptive multiple precision.
+
+		## Use
+
+		\code
+		DoublePrecisionTracker double_tracker(homotopy);
+		AMPTracker amp_tracker(homotopy);
+		// ... set up both trackers
+
+		EndgameSelector<DoublePrecisionTracker>::Cauchy double_endgame(double_tracker);
+		EndgameSelector<AMPTracker>::Cauchy amp_endgame(amp_tracker);
+
+		auto result = RunTieredEndgame(double_endgame, amp_endgame, t, point, AMP);
+		if (result.tier==EndgameTier::Double)
+			...
+		\endcode
+
+		The endgames may be reused for many paths.  Their trackers should track the same homotopy.  The double precision endgame may well be the Cauchy endgame, whose averaging of the samples on its loops is compensated in double precision.
+
+		\param double_endgame An endgame with a tracker in double precision.
+		\param multiple_endgame An endgame with the adaptive precision tracker.
+		\param start_time The time at which to start the endgame.
+		\param start_point The point on the path at start_time.
+		\param AMP The settings for adaptive precision, for criterion A.
+
+		\return The outcome of the last endgame run, and which it was.
+		*/
+		template<typename DoubleEndgameType, typename MultipleEndgameType>
+		TieredEndgameResult RunTieredEndgame(DoubleEndgameType & double_endgame, MultipleEndgameType & multiple_endgame,
+		                                     mpfr const& start_time, Vec<mpfr> const& start_point,
+		                                     config::AdaptiveMultiplePrecisionConfig const& AMP)
+		{
+			TieredEndgameResult result;
+
+			Vec<dbl> start_point_d(start_point.size());
+			for (Eigen::DenseIndex ii = 0; ii < start_point.size(); ++ii)
+				start_point_d(ii) = dbl(start_point(ii));
+
+			result.tier = EndgameTier::Double;
+			result.success_code = double_endgame.Run(dbl(start_time), start_point_d);
+			if (result.success_code==SuccessCode::Success && detail::DoubleSufficesAtCurrentPoint(double_endgame.GetTracker(), AMP))
+			{
+				const auto& approximation = double_endgame.template FinalApproximation<dbl>();
+				result.endpoint.resize(approximation.size());
+				for (Eigen::DenseIndex ii = 0; ii < approximation.size(); ++ii)
+					SetAtPrecision(result.endpoint(ii), approximation(ii), DoublePrecision());
+				result.cycle_number = double_endgame.CycleNumber();
+				return result;
+			}
+
+			BOOST_LOG_TRIVIAL(severity_level::trace) << "endgame in double precision did not suffice, code " << int(result.success_code) << ", running in multiple precision";
+
+			result.tier = EndgameTier::Multiple;
+			DefaultPrecision(Precision(start_point(0)));
+			result.success_code = multiple_endgame.Run(start_time, start_point);
+			result.endpoint = multiple_endgame.template FinalApproximation<mpfr>();
+			result.cycle_number = multiple_endgame.CycleNumber();
+			return result;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
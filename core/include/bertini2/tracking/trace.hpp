@@ -0,0 +1,236 @@
+//This file is part of Bertini 2.
+//
+//trace.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//trace.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with trace.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file trace.hpp
+
+\brief A timeline of what each thread did, path by path, for the Chrome trace viewer and Perfetto.
+
+The counters of metrics.hpp say how much was done, but not when, nor by whom, so they cannot explain why a run waits on its last few paths.  A Trace records, for each thread, when it began and ended each path, each piece of tracking, and each endgame, the precision it tracked at as it changed, each loop of a Cauchy endgame, and each path retried.  ToChromeTrace turns the events into the JSON read by chrome://tracing and ui.perfetto.dev, with a row for each thread.
+
+An event is 24 bytes, appended to a buffer of the thread recording it, found as the shards of a metrics::Registry are, so recording takes no lock.  Events are recorded into the active trace, set by Start, from the parallel drivers, the endgames, and a TraceRecorder, see observers.hpp, which the drivers attach to their trackers while a trace is active.  With no trace active, which is the default, recording is a single load of a pointer, and no observer is attached.
+
+\code
+trace::Trace timeline;
+trace::Start(timeline);
+auto results = TrackAllPaths<AMPTracker>(homotopy, start_system, setup, t_start, t_end);
+trace::Stop();
+std::ofstream("run.trace.json") << trace::ToChromeTrace(timeline);
+\endcode
+*/
+
+#ifndef BERTINI_TRACKING_TRACE_HPP
+#define BERTINI_TRACKING_TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace bertini{
+	namespace tracking{
+		namespace trace{
+
+			/**
+			\brief The kinds of event recorded.
+			*/
+			enum class EventKind : std::uint32_t
+			{
+				PathBegin, ///< A driver began working on a path.
+				PathEnd,
+				TrackBegin, ///< A tracker began tracking, a whole path or a piece of one.
+				TrackEnd, ///< The value is the precision, in digits, at the end.
+				PrecisionChange, ///< The precision of a tracker changed.  The value is the new precision, in digits.
+				EndgameBegin,
+				EndgameEnd, ///< The value is the SuccessCode of the endgame.
+				CauchyLoop, ///< A Cauchy endgame went once around the origin.  The value is the number of samples on the loop.
+				Retry, ///< A failed path is to be tracked again.  The value is the rung of the retry policy.
+				NumKinds
+			};
+
+
+			/**
+			\brief An event, as recorded.
+			*/
+			struct Event
+			{
+				std::uint64_t nanoseconds; ///< Since the trace was made.
+				std::uint64_t path; ///< The path worked on by the thread, or NoPath.
+				std::uint32_t value;
+				EventKind kind;
+			};
+
+			/**
+			\brief The path of events recorded by a thread working on none.
+			*/
+			constexpr std::uint64_t NoPath = std::numeric_limits<std::uint64_t>::max();
+
+
+			/**
+			\brief The events recorded by one thread.
+			*/
+			struct ThreadEvents
+			{
+				unsigned thread; ///< Numbered in the order in which threads first recorded into the trace, from 0.
+				std::vector<Event> events; ///< In the order recorded.
+			};
+
+
+			/**
+			\brief Events recorded into a buffer for each thread, without locks.
+
+			Each trace has a process-unique identity, by which a thread finds its buffer in a small thread-local table, as for metrics::Registry.  A buffer stops taking events when full, and counts those it drops.  The events are read by Events, which may be called only while no thread records into the trace, such as after Stop, once the run has returned.
+			*/
+			class Trace
+			{
+				using Clock = std::chrono::steady_clock;
+
+				struct Buffer
+				{
+					unsigned thread;
+					std::vector<Event> events;
+					std::uint64_t dropped = 0;
+					Buffer* next = nullptr;
+				};
+
+			public:
+
+				/**
+				\param max_events_per_thread The most events a thread records, after which it drops them.
+				*/
+				explicit Trace(std::size_t max_events_per_thread = std::size_t(1) << 20);
+				~Trace();
+
+				Trace(Trace const&) = delete;
+				Trace& operator=(Trace const&) = delete;
+
+				/**
+				\brief Record an event, for the path the calling thread is working on.
+				*/
+				void Record(EventKind kind, std::uint32_t value = 0);
+
+				/**
+				\brief Record an event, for a given path.
+				*/
+				void Record(EventKind kind, std::uint64_t path, std::uint32_t value);
+
+				/**
+				\brief The events of each thread which recorded, in the order threads first did.
+				*/
+				std::vector<ThreadEvents> Events() const;
+
+				/**
+				\brief The events dropped by full buffers.
+				*/
+				std::uint64_t NumDropped() const;
+
+			private:
+
+				/**
+				\brief The buffer of the calling thread, made and linked in, without a lock, the first time it is asked for.
+				*/
+				Buffer& LocalBuffer();
+
+				const std::uint64_t id_;
+				const Clock::time_point created_;
+				const std::size_t max_events_per_thread_;
+				std::atomic<Buffer*> buffers_{nullptr};
+				std::atomic<unsigned> num_threads_{0};
+			};
+
+
+			namespace detail {
+				extern std::atomic<Trace*> active;
+			}
+
+			/**
+			\brief Record into a trace from here on, on all threads, until Stop.  The trace must outlive the recording.
+			*/
+			void Start(Trace & trace);
+
+			/**
+			\brief Stop recording.  Threads in the midst of recording an event may finish it.
+			*/
+			void Stop();
+
+			/**
+			\brief The trace being recorded into, or null if none.
+			*/
+			inline
+			Trace* Active()
+			{
+				return detail::active.load(std::memory_order_acquire);
+			}
+
+			/**
+			\brief Record an event into the active trace, if there is one, for the path the calling thread is working on.
+			*/
+			inline
+			void Record(EventKind kind, std::uint32_t value = 0)
+			{
+				if (auto trace = Active())
+					trace->Record(kind, value);
+			}
+
+
+			/**
+			\brief The path the calling thread is working on, as set by a ScopedPath, or NoPath.
+
+			Needs thread_local storage.  If configured with --disable-thread_local, all threads share one, and traces of more than one thread attribute their events to the wrong paths.
+			*/
+			std::uint64_t CurrentPath();
+
+			/**
+			\brief Mark the calling thread as working on a path, for the lifetime of this object, recording its beginning and end into the active trace.  Nests.
+			*/
+			class ScopedPath
+			{
+			public:
+				explicit ScopedPath(std::uint64_t path);
+				~ScopedPath();
+
+				ScopedPath(ScopedPath const&) = delete;
+				ScopedPath& operator=(ScopedPath const&) = delete;
+
+			private:
+				std::uint64_t previous_;
+			};
+
+
+			/**
+			\brief The events of a trace in the Chrome trace event format, JSON, for chrome://tracing or ui.perfetto.dev.
+
+			Paths, pieces of tracking and endgames are complete events, nested on the row of their thread, precisions a counter for each thread, and Cauchy loops and retries instant events.  A piece of tracking not ended, as when a path is put off for running over its budget, ends with what encloses it.
+
+			Not to be called while threads record into the trace.
+			*/
+			std::string ToChromeTrace(Trace const& trace);
+
+		} // namespace trace
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -35,14 +35,18 @@
 #include "bertini2/eigen_extensions.hpp"
 
 #include "bertini2/system.hpp"
+#include "bertini2/tracking/ring_buffer.hpp"
+
+#include <limits>
+#include <map>
 
 namespace bertini
 {
 	namespace tracking{
 
-		// aliases for the types used to contain space and time samples, and random vectors for the endgames.
-		template<typename T> using SampCont = std::deque<Vec<T> >;
-		template<typename T> using TimeCont = std::deque<T>;
+		// aliases for the types used to contain space and time samples, and random vectors for the endgames.  rings, so that advancing an endgame reuses the storage of the samples it drops.
+		template<typename T> using SampCont = RingBuffer<Vec<T> >;
+		template<typename T> using TimeCont = RingBuffer<T>;
 		
 		
 		enum class PrecisionType
@@ -145,12 +149,15 @@ namespace bertini
 
 		class AMPPowerSeriesEndgame;
 		class AMPCauchyEndgame;
+
+		template<typename TrackerType>
+		class HybridEndgame;
 		}
 
 		/**
 		\brief Facilitates lookup of required endgame type based on tracker type
 		
-		Your current choices are PSEG or Cauchy.
+		Your current choices are PSEG, Cauchy, or Hybrid, which runs the PSEG and switches to the Cauchy endgame when it does not converge.
 	
 		To get the Power Series Endgame for Adaptive Precision Tracker, use the following example code:
 		\code
@@ -168,6 +175,7 @@ namespace bertini
 		{
 			using PSEG = endgame::FixedPrecPowerSeriesEndgame<DoublePrecisionTracker>;
 			using Cauchy = endgame::FixedPrecCauchyEndgame<DoublePrecisionTracker>;
+			using Hybrid = endgame::HybridEndgame<DoublePrecisionTracker>;
 		};
 
 		template<>
@@ -175,6 +183,7 @@ namespace bertini
 		{
 			using PSEG = endgame::FixedPrecPowerSeriesEndgame<MultiplePrecisionTracker>;
 			using Cauchy = endgame::FixedPrecCauchyEndgame<MultiplePrecisionTracker>;
+			using Hybrid = endgame::HybridEndgame<MultiplePrecisionTracker>;
 		};
 
 		template<class D>
@@ -182,6 +191,7 @@ namespace bertini
 		{
 			using PSEG = typename EndgameSelector<D>::PSEG;
 			using Cauchy = typename EndgameSelector<D>::Cauchy;
+			using Hybrid = typename EndgameSelector<D>::Hybrid;
 		};
 
 		template<>
@@ -189,6 +199,7 @@ namespace bertini
 		{
 			using PSEG = endgame::AMPPowerSeriesEndgame;
 			using Cauchy = endgame::AMPCauchyEndgame;
+			using Hybrid = endgame::HybridEndgame<AMPTracker>;
 		};
 
 
@@ -233,12 +244,78 @@ namespace bertini
 				RKF45,
 				RKCashKarp45,
 				RKDormandPrince56,
-				RKVerner67
+				RKVerner67,
+				Pade, ///< A Pad\'e approximant of the path, built from its Taylor coefficients, see predict::ExplicitRKPredictor.
+				Taylor, ///< The Taylor polynomial of the path, its coefficients by Taylor arithmetic on the system, see predict::ExplicitRKPredictor::TaylorOrder.
+				Hermite ///< Hermite extrapolation of the points and tangents of the last steps of the path, one Jacobian per step, falling back to RKF45 where the history is short, see predict::ExplicitRKPredictor::HermiteStep.
 			};
 
 			
 
 
+			/**
+			\brief How to estimate the norm of the inverse of the Jacobian, for the AMP criteria.
+			*/
+			enum class NormInverseEstimate
+			{
+				RandomSolve, ///< The 2-norm of the solution against a random vector of units, fixed for each precision.  One solve.
+				Hager ///< The 1-norm, by the estimator of Hager and Higham, from the existing factors.  Usually two to five solves, and rarely off by much.
+			};
+
+
+			/**
+			\brief Settings for choosing among the embedded Runge-Kutta pairs while tracking.
+			*/
+			struct OrderSelection
+			{
+				bool adaptive = false; ///< switch among the embedded pairs along a path, by their cost per unit of time advanced, rather than predicting with one method throughout.
+				unsigned window = 10; ///< the number of steps over which the cost of a method is measured, before another is considered.
+				unsigned max_consecutive_failures = 2; ///< drop to the next lower order after this many failed steps in a row.
+				unsigned stale_after = 50; ///< the number of steps after which the measured cost of a method no longer counts, so that it is tried again.
+			};
+
+
+			/**
+			\brief Declaring paths going to infinity from the growth of their norm over the last few steps, before it passes the truncation threshold.
+
+			Off by default.  A path going to infinity takes ever smaller steps, and in the adaptive tracker ever higher precision, as its norm grows, so most of its cost is spent just short of the threshold.  With this on, the tracker estimates from the last few norms where the path has its pole, and how large the norm would be at the end time, and truncates the path as soon as that passes the threshold.  The norm is that of the dehomogenized point, so a homogenized system tracked on a patch is judged by its affine solutions.
+			*/
+			struct Divergence
+			{
+				bool early_detection = false; ///< estimate the divergence of the path at each step, and truncate it early.
+				unsigned window = 5; ///< the number of successful steps whose norms the estimate is made from.  At least 3.
+				double onset = 0.5; ///< the estimate is not acted on until the norm passes the truncation threshold raised to this power, so that paths which grow for a while but end finite are not truncated on the strength of a few steps.
+			};
+
+
+			/**
+			\brief Choosing the endgame boundary of each path from how it behaves, rather than tracking every path to the same time.
+
+			Off by default.  The end time given the tracker is then the latest boundary, and a path which shows singular behaviour sooner stops there, where its endgame may start, see Tracker::StoppedAtEndgameBoundary.  Approaching a singular endpoint at t=0, the condition number of the Jacobian grows as a power of \f$1/|t|\f$, and the step sizes shrink in proportion to \f$|t|\f$, where for a nonsingular endpoint neither changes much.  Each is measured as the slope of its logarithm against \f$\log|t|\f$ over the recent steps, and the path stops once both are steep enough.  Nonsingular paths reach the end time as usual, to be finished by Newton's method, see FinishPaths.
+			*/
+			struct EndgameBoundary
+			{
+				bool adaptive = false; ///< stop each path at a boundary of its own.
+				double earliest_time = 0.5; ///< no path stops while the absolute value of the time is above this.
+				double time_span = 4; ///< the slopes are measured over the steps since the absolute value of the time was this many times what it is now, so over a range of times wide enough that the growing and shrinking of the step size between failures does not hide its trend.
+				unsigned min_steps = 5; ///< the least number of successful steps the slopes are measured over.  At least 3.
+				double min_condition_growth = 0.3; ///< the least power of \f$1/|t|\f$ the condition number must grow as.  It is \f$1-1/c\f$ for an endpoint of multiplicity and cycle number c, so \f$1/2\f$ for a double root.
+				double min_step_shrinkage = 0.5; ///< the least power of \f$|t|\f$ the step size must shrink as.
+			};
+
+
+			/**
+			\brief Settings for attempting each step of an AMPTracker at several step sizes at once, for the latency of a single path.
+
+			Off by default.  Tracking one path, such as an update of a parameter homotopy in interactive use, leaves cores idle, while each failed step is retried at a smaller step size only after it fails.  With speculation, helpers on copies of the system attempt the step at once with the tracker, at step sizes smaller by successive powers of config::Stepping::step_size_fail_factor, and, if asked, at a higher precision.  If the tracker's own attempt fails, it takes the largest step which succeeded, so the retries are off the critical path.  The helpers' work is spent whether or not it is used, so speculation is for the latency of one path, not the throughput of many.
+			*/
+			struct Speculation
+			{
+				unsigned num_attempts = 1; ///< the number of attempts at each step, counting the tracker's own, each on a thread of its own.  1 is off.
+				bool raise_precision = false; ///< make the helpers' attempts at the next higher precision, as AMP would after the failure of a step for its criteria.
+			};
+
+
 			template<typename T>
 			struct Tolerances
 			{	
@@ -253,6 +330,16 @@ namespace bertini
 			};
 
 
+			/**
+			\brief How the step size is chosen after a successful step.
+			*/
+			enum class StepSizeController
+			{
+				GrowShrink, ///< Multiply by the success factor after a run of successful steps.
+				PI ///< Follow the error estimates of the embedded Runge-Kutta pairs over the last two steps, with a proportional-integral controller, every step.  Needs a predictor with an error estimate, and otherwise falls back to GrowShrink.
+			};
+
+
 			template<typename T>
 			struct Stepping
 			{
@@ -269,6 +356,13 @@ namespace bertini
 				unsigned max_num_steps = 1e5;
 
 				unsigned frequency_of_CN_estimation = 1;
+
+				StepSizeController step_size_controller = StepSizeController::GrowShrink; ///< How the step size follows successful steps.
+				double pi_safety_factor = 0.9; ///< For the PI controller, the fraction of the step size its formula gives that is taken, to keep clear of rejection.
+				double pi_integral_exponent = 0.3; ///< For the PI controller, the exponent of the error of the last step, divided by the order of the error estimate.
+				double pi_proportional_exponent = 0.4; ///< For the PI controller, the exponent of the ratio of the errors of the last two steps, divided by the order of the error estimate.
+
+				bool dense_output = false; ///< Step past the end time of a path at the step size it has, rather than shortening the last step onto it, and interpolate the solution there between the ends of the step, refined by Newton's method.  The path then stands past the end time, from where ContinuePath goes on, so that a path tracked in pieces, as by the endgames, takes no short steps onto the times of their samples.  A step which would come within half the end time's distance of t=0, where homotopies end, is shortened as usual.
 			};
 
 
@@ -277,6 +371,16 @@ namespace bertini
 			{
 				unsigned max_num_newton_iterations = 2;
 				unsigned min_num_newton_iterations = 1;
+				unsigned lu_refinement_steps = 0; ///< steps of iterative refinement after each linear solve.  0 turns refinement off.
+				bool mixed_precision_solve = false; ///< in multiple precision, factor the Jacobian in double precision and refine the step with residuals in the working precision, falling back to a full precision factorization if refinement stalls.
+				unsigned mixed_precision_min_digits = 40; ///< the mixed precision solve is used only at this many digits or more.
+				unsigned max_mixed_precision_refinements = 8; ///< refinements of the mixed precision solve, before it falls back to full precision.
+				bool reuse_jacobian = false; ///< keep the factored Jacobian of the first iteration of a correction for the following ones, evaluating only the functions, until a step fails to contract by max_chord_contraction or breaks an AMP criterion.
+				double max_chord_contraction = 0.5; ///< the largest ratio of the length of a step to that of the one before for which a reused Jacobian is kept.
+				bool line_search = false; ///< shorten each Newton step which does not decrease the norm of the functions enough, by Armijo backtracking, rather than taking it whole.  Costs an evaluation of the functions per length tried.
+				double line_search_sufficient_decrease = 1e-4; ///< the Armijo constant c: a step shortened to length l of the Newton step is taken when it decreases the norm of the functions by the factor 1 - c*l.
+				double line_search_backtrack = 0.5; ///< the factor by which the length tried is shortened each time.
+				unsigned max_line_search_backtracks = 4; ///< the times the length is shortened, before the correction fails.
 			};
 
 
@@ -311,6 +415,21 @@ namespace bertini
 			{
 				unsigned max_cycle_number = 6;
 				unsigned cycle_number_amplification = 5;
+				unsigned cycle_number_search_patience = 2; ///< The search for the cycle number starts from the last estimate, and stops going up, or down, after this many candidates in a row fit the samples no better than the best so far.  0 to try every candidate up to the bound.
+				unsigned max_approximations = 0; ///< Give up, with FailedToConverge, after this many approximations at the origin without converging.  0 for no limit.
+				unsigned max_cycle_number_changes = 0; ///< Give up, with FailedToConverge, once the cycle number estimated from one approximation to the next has changed this many times.  0 for no limit.
+				unsigned max_stalled_approximations = 0; ///< Give up, with FailedToConverge, after this many approximations in a row which do not reduce the difference between consecutive approximations.  0 for no limit.
+			};
+
+
+			/**
+			rief Settings for the hybrid endgame, which runs the power series endgame, and the Cauchy endgame from the last sample of it only when it gives up.  They are its power series endgame's limits, see PowerSeries.
+			*/
+			struct HybridEndgame
+			{
+				unsigned max_power_series_approximations = 8; ///< Switch to the Cauchy endgame after this many approximations at the origin without converging.
+				unsigned max_cycle_number_changes = 3; ///< Switch once the estimated cycle number has changed this many times.
+				unsigned max_stalled_approximations = 2; ///< Switch after this many approximations in a row which do not improve on the one before.
 			};
 
 			template<typename T>
@@ -322,6 +441,9 @@ namespace bertini
 				unsigned int num_needed_for_stabilization = 3;
 				T maximum_cauchy_ratio = T(1)/T(2);
 				unsigned int fail_safe_maximum_cycle_number = 250; //max number of loops before giving up. 
+				bool adaptive_samples_per_loop = false; // adapt the number of samples per loop to the error of the trapezoid rule, starting from num_sample_points.
+				unsigned int min_samples_per_loop = 4; // least number of samples per loop, when adapting.  at least 3.
+				unsigned int max_samples_per_loop = 64; // most number of samples per loop, when adapting.
 
 			};
 
@@ -339,12 +461,16 @@ namespace bertini
 
 
 
+			/**
+			\brief Settings for classifying and deduplicating the endpoints of a solve.  See tracking/post_processing.hpp.
+			*/
 			template<typename T>
 			struct PostProcessing{
-				T real_threshold;
-				T endpoint_finite_threshold;
-				T final_tol_multiplier;
-				T final_tol_times_mult;
+				T real_threshold = T(1)/T(100000000); ///< An endpoint is real if the imaginary parts of its dehomogenized coordinates are smaller than this in norm.
+				T endpoint_finite_threshold = T(100000); ///< An endpoint is finite if its dehomogenized norm is smaller than this.
+				T final_tol_multiplier = T(10000); ///< The final tolerance of the endgame times this is final_tol_times_mult.
+				T final_tol_times_mult = T(1)/T(10000000); ///< Two endpoints are the same if they differ by at most this, relative to their norms.
+				T condition_number_threshold = T(100000000); ///< An endpoint is singular if the condition number of the Jacobian there is larger than this.
 			};
 
 
@@ -355,15 +481,37 @@ namespace bertini
 
 
 
+			/**
+			\brief Settings for solving by regeneration, equation by equation.  See tracking/regeneration.hpp.
+			*/
 			template<typename T>
 			struct Regeneration
 			{
-				bool remove_infinite_endpoints;
-				bool higher_dimension_check;
+				bool remove_infinite_endpoints = true; ///< Drop the endpoints at infinity of each stage, rather than regenerating them at the next.  Those of the last stage are always set aside.
+				bool higher_dimension_check = true; ///< Drop the endpoints of each stage which satisfy the next function, as they lie on components of too high a dimension to give isolated solutions.
 
-				T newton_before_endgame;
-				T newton_during_endgame;
-				T final_tolerance;
+				T newton_before_endgame = T(1)/T(10000000); ///< The tracking tolerance for moving the slices, before the endgame boundary.
+				T newton_during_endgame = T(1)/T(100000000); ///< The tracking tolerance for moving the slices, past the endgame boundary.
+				T final_tolerance = T(1)/T(100000000000); ///< Newton's method finishes the moved slices once its step is this short, relative to the norm of the point.
+
+				T infinite_threshold = T(100000000); ///< An endpoint whose dehomogenized norm is larger than this is at infinity.
+				T solution_tolerance = T(1)/T(100000000); ///< An endpoint solves a function if its residual is at most this, relative to the norm of the gradient times that of the point, and two endpoints are the same if they differ by at most this, relative to their norms.
+			};
+
+
+			/**
+			\brief Settings for finding witness supersets dimension by dimension, by a cascade, and removing their junk.  See tracking/cascade.hpp.
+			*/
+			template<typename T>
+			struct Cascade
+			{
+				int top_dimension = -1; ///< The largest dimension looked for, or -1 for one less than the number of variables.
+				bool remove_junk = true; ///< Remove the points of each witness superset on a component of higher dimension, by testing their membership in the witness sets above.
+
+				T slack_tolerance = T(1)/T(100000000); ///< An endpoint whose slack variables are at most this, relative to its norm, is a witness point, and otherwise starts a path at the next dimension down.
+				T infinite_threshold = T(100000000); ///< An endpoint whose norm is larger than this is at infinity.
+				T solution_tolerance = T(1)/T(100000000); ///< A witness point solves the system if its residuals are at most this, relative to the norms of the gradients times that of the point, and two witness points are the same if they differ by at most this, relative to their norms.
+				T membership_tolerance = T(1)/T(1000000); ///< How close, relative to its norm, a moved witness point of a higher dimension must come to a point, for the point to be junk.
 			};
 
 			
@@ -389,9 +537,101 @@ namespace bertini
 			}
 
 
+			/**
+			\brief The cost of arithmetic at each precision, relative to double precision, as AMP weighs it in choosing precision and stepsize.
+
+			With no measurements, this is the analytic model \f$C(P) = 10.35 + 0.13 P\f$ of \cite AMP2 for multiple precision, and 1 for double.  The ratio of multiple to double precision differs from machine to machine, so the cost at some precisions may be set instead, say from CalibrateArithmeticCost.  Between measured precisions the cost is interpolated linearly, and beyond them extrapolated along the line through the nearest two, or held constant if there is only one.
+			*/
+			class ArithmeticCostModel
+			{
+			public:
+
+				/**
+				\brief The analytic cost of arithmetic at a precision, relative to double.
+				*/
+				static
+				mpfr_float Analytic(unsigned precision)
+				{
+					if (precision==DoublePrecision())
+						return 1;
+					else
+						return mpfr_float("10.35") + mpfr_float("0.13") * precision;
+				}
+
+				/**
+				\brief Set the cost of multiple precision arithmetic at a precision, relative to double.
+
+				\throws std::runtime_error if the precision is that of double, whose cost is 1 by definition, or the cost is not positive.
+				*/
+				void Set(unsigned precision, double relative_cost)
+				{
+					if (precision==DoublePrecision())
+						throw std::runtime_error("setting the arithmetic cost of double precision, which is 1 by definition");
+					if (!(relative_cost > 0))
+						throw std::runtime_error("arithmetic cost at precision " + std::to_string(precision) + " must be positive");
+					costs_[precision] = relative_cost;
+				}
+
+				/**
+				\brief Forget the measured costs, going back to the analytic model.
+				*/
+				void Clear()
+				{
+					costs_.clear();
+				}
+
+				/**
+				\brief Whether any costs have been set, so the analytic model is not in use.
+				*/
+				bool IsCalibrated() const
+				{
+					return !costs_.empty();
+				}
+
+				/**
+				\brief The measured costs, by precision.
+				*/
+				std::map<unsigned, double> const& Costs() const
+				{
+					return costs_;
+				}
+
+				/**
+				\brief The cost of arithmetic at a precision, relative to double.
+				*/
+				mpfr_float Cost(unsigned precision) const
+				{
+					if (precision==DoublePrecision())
+						return 1;
+					if (costs_.empty())
+						return Analytic(precision);
+					if (costs_.size()==1)
+						return costs_.begin()->second;
+
+					// the two measured precisions to interpolate or extrapolate between
+					auto upper = costs_.lower_bound(precision);
+					if (upper==costs_.end())
+						--upper;
+					else if (upper->first==precision)
+						return upper->second;
+					else if (upper==costs_.begin())
+						++upper;
+					auto lower = std::prev(upper);
+
+					const double slope = (upper->second - lower->second)/(double(upper->first) - double(lower->first));
+					const double cost = lower->second + slope*(double(precision) - double(lower->first));
+					return std::max(cost, std::numeric_limits<double>::min());
+				}
+
+			private:
+				std::map<unsigned, double> costs_; ///< Measured cost of multiple precision arithmetic, relative to double, by precision in digits.
+			};
+
+
+
 			/**
 			Holds the program parameters with respect to Adaptive Multiple Precision.
-			
+
 			These criteria are developed in \cite AMP1, \cite AMP2.
 
 			Let:
@@ -434,6 +674,18 @@ namespace bertini
 				unsigned consecutive_successful_steps_before_precision_decrease = 10;
 
 				unsigned max_num_precision_decreases = 10; ///< The maximum number of times precision can be lowered during tracking of a segment of path.
+
+				NormInverseEstimate norm_J_inverse_estimate = NormInverseEstimate::RandomSolve; ///< How the norm of the inverse of the Jacobian is estimated for the criteria.
+				ArithmeticCostModel arithmetic_cost; ///< The relative cost of arithmetic at each precision, weighed against stepsize when choosing the next precision.  Analytic unless calibrated, see CalibrateArithmeticCost.
+
+				bool compensated_double_evaluation = false; ///< Whether the system evaluates in double precision by compensated arithmetic, see System::UseCompensatedEvaluation.  If so, the error of evaluation in double counted against Phi and Psi is that of double-double.
+
+				unsigned norm_J_inverse_reuse_steps = 1; ///< While the estimates of the norm of the inverse of the Jacobian agree to within a factor of two, the predictor and the corrector each make a new one only every this many times one is wanted, reusing the last in between.  1 makes one every time.
+
+				unsigned reduced_precision_prediction_above = 0; ///< Above this precision, in digits, the stages of the predictor are run in double precision, and only Newton's method and its residuals at the current precision, as long as AMP criteria A and C hold for the prediction in double.  With compensated_double_evaluation, the stages are evaluated as accurately as in double-double.  0, the default, predicts at the current precision always.
+
+				bool predictive_precision = false; ///< Whether to raise precision after a successful step to the digits criteria B and C are predicted to require at the next, extrapolated from the digits they required at the last two, rather than waiting for the next step to fail them.
+				unsigned precision_decrease_margin = 3; ///< With predictive_precision, precision is lowered only to a precision at least this many digits above the requirement predicted for the next step, so that it is not raised again by the step after.
 				
 
 				/**
@@ -463,10 +715,14 @@ namespace bertini
 				    Psi = degree_bound*coefficient_bound;  //Psi from the AMP paper.
 				}
 
+				/**
+				 Sets values epsilon, Phi, Psi, degree_bound, and coefficient_bound from input system, and whether its evaluation in double is compensated.
+				*/
 				void SetAMPConfigFrom(System const& sys)
 				{
 					SetBoundsAndEpsilonFrom(sys);
 					SetPhiPsiFromBounds();
+					compensated_double_evaluation = sys.EvaluatingCompensated();
 				}
 
 				AdaptiveMultiplePrecisionConfig() : coefficient_bound(1000), degree_bound(5), safety_digits_1(1), safety_digits_2(1), maximum_precision(300) 
@@ -486,6 +742,10 @@ namespace bertini
 				out << "epsilon: " << AMP.epsilon << "\n";
 				out << "Phi: " << AMP.Phi << "\n";
 				out << "Psi: " << AMP.Psi << "\n";
+				out << "compensated_double_evaluation: " << AMP.compensated_double_evaluation << "\n";
+				out << "reduced_precision_prediction_above: " << AMP.reduced_precision_prediction_above << "\n";
+				out << "predictive_precision: " << AMP.predictive_precision << "\n";
+				out << "precision_decrease_margin: " << AMP.precision_decrease_margin << "\n";
 				out << "safety_digits_1: " << AMP.safety_digits_1 << "\n";
 				out << "safety_digits_2: " << AMP.safety_digits_2 << "\n";
 				out << "consecutive_successful_steps_before_precision_decrease" << AMP.consecutive_successful_steps_before_precision_decrease << "\n";
@@ -0,0 +1,268 @@
+//This file is part of Bertini 2.
+//
+//tracking_session.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//tracking_session.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with tracking_session.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file tracking_session.hpp
+
+\brief Track paths submitted one at a time, on a pool of threads, getting each result by a future as soon as its path is done.
+
+TrackAllPaths takes all the start points at once, and returns only when the last path is done.  A TrackingSession keeps its workers running, and takes start points as they come, so a caller can overlap tracking with work of its own on the results, consuming them in the order they complete.
+*/
+
+#ifndef BERTINI_TRACKING_TRACKING_SESSION_HPP
+#define BERTINI_TRACKING_TRACKING_SESSION_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief Tracks paths submitted one at a time, on a pool of threads, delivering each result through a future, and announcing it on a completion queue.
+
+		## Use
+
+		\code
+		TrackingSession<AMPTracker> session(homotopy, [&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			}, mpfr(1), mpfr(0));
+
+		std::vector< std::future< PathResult<mpfr> > > results;
+		for (auto const& p : start_points)
+			results.push_back(session.Submit(p));
+
+		std::size_t index;
+		while (session.NextCompleted(index))
+			Consume(results[index].get());
+		\endcode
+
+		Each worker builds its tracker on its own copy of the homotopy, taken when the session is made, and passes it to setup, as for TrackAllPaths.  Paths are handed to the workers in the order they are submitted, each at the default precision of the thread which made the session.
+
+		A path whose tracking throws has the exception stored in its future, and is still announced on the completion queue.  The session closes when destroyed, finishing the paths already submitted first.
+		*/
+		template<typename TrackerType>
+		class TrackingSession
+		{
+		public:
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+			using ResultType = PathResult<ComplexType>;
+
+			/**
+			\param homotopy The system to track on.  Copied for each worker here, so needs to live only as long as the constructor runs.
+			\param setup Configure a freshly made tracker.  Called once per worker, concurrently, so must not evaluate anything shared.
+			\param start_time The time at which the submitted points solve the homotopy.
+			\param end_time The time to track to.
+			\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+			*/
+			template<typename SetupFunction>
+			TrackingSession(System const& homotopy, SetupFunction setup, ComplexType const& start_time, ComplexType const& end_time, unsigned num_threads = 0)
+				: start_time_(start_time), end_time_(end_time), precision_(DefaultPrecision())
+			{
+				if (num_threads==0)
+					num_threads = detail::DefaultNumWorkers();
+
+				SystemPool homotopies(homotopy);
+				std::vector< std::shared_ptr<System> > worker_homotopies(num_threads);
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					worker_homotopies[ii] = homotopies.Acquire(ii, homotopy.precision());
+
+				const std::function<void(TrackerType &)> setup_tracker(setup);
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					workers_.emplace_back([this, setup_tracker](std::shared_ptr<System> sys){ Work(*sys, setup_tracker); }, worker_homotopies[ii]);
+			}
+
+			TrackingSession(TrackingSession const&) = delete;
+			TrackingSession& operator=(TrackingSession const&) = delete;
+
+			~TrackingSession()
+			{
+				Close();
+			}
+
+
+			/**
+			\brief Queue a path for tracking.
+
+			\param start_point A point solving the homotopy at the start time.
+			\return The future of its result, whose index is the number of paths submitted before it.
+
+			\throws std::runtime_error if the session is closed.
+			*/
+			std::future<ResultType> Submit(Vec<ComplexType> const& start_point)
+			{
+				Job job;
+				job.point = start_point;
+				auto result = job.promise.get_future();
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					if (closed_)
+						throw std::runtime_error("submitting a path to a closed tracking session");
+					job.index = num_submitted_++;
+					jobs_.push_back(std::move(job));
+				}
+				work_available_.notify_one();
+				return result;
+			}
+
+
+			/**
+			\brief Wait for the next path to complete, in the order they complete.
+
+			\param index Set to the index of the path.  Its result is in its future.
+			\return Whether there was one.  False, without waiting, if every submitted path has already been announced.
+			*/
+			bool NextCompleted(std::size_t & index)
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				completion_.wait(lock, [&]{ return !completed_.empty() || num_announced_==num_submitted_; });
+				if (completed_.empty())
+					return false;
+
+				index = completed_.front();
+				completed_.pop_front();
+				++num_announced_;
+				return true;
+			}
+
+
+			/**
+			\brief The number of paths submitted and not yet done.
+			*/
+			std::size_t NumPending() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return num_submitted_ - num_done_;
+			}
+
+
+			/**
+			\brief Stop taking paths, finish those already submitted, and stop the workers.
+			*/
+			void Close()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					if (closed_)
+						return;
+					closed_ = true;
+				}
+				work_available_.notify_all();
+				for (auto& w : workers_)
+					w.join();
+			}
+
+		private:
+
+			struct Job
+			{
+				std::size_t index;
+				Vec<ComplexType> point;
+				std::promise<ResultType> promise;
+			};
+
+			void Work(System const& sys, std::function<void(TrackerType &)> const& setup)
+			{
+				DefaultPrecision(precision_);
+
+				std::unique_ptr<TrackerType> tracker;
+				std::exception_ptr setup_failure;
+				try
+				{
+					tracker.reset(new TrackerType(sys));
+					setup(*tracker);
+				}
+				catch (...)
+				{
+					// every path this worker takes fails the same way
+					setup_failure = std::current_exception();
+				}
+
+				while (true)
+				{
+					Job job;
+					{
+						std::unique_lock<std::mutex> lock(mutex_);
+						work_available_.wait(lock, [&]{ return closed_ || !jobs_.empty(); });
+						if (jobs_.empty())
+							return;
+						job = std::move(jobs_.front());
+						jobs_.pop_front();
+					}
+
+					try
+					{
+						if (setup_failure)
+							std::rethrow_exception(setup_failure);
+
+						DefaultPrecision(precision_);
+						ResultType result;
+						result.index = job.index;
+						tracker->ResetStatistics();
+						result.success_code = tracker->TrackPath(result.endpoint, start_time_, end_time_, job.point);
+						result.time = tracker->CurrentTime();
+						result.statistics = tracker->Statistics();
+						job.promise.set_value(std::move(result));
+					}
+					catch (...)
+					{
+						job.promise.set_exception(std::current_exception());
+					}
+
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						completed_.push_back(job.index);
+						++num_done_;
+					}
+					completion_.notify_all();
+				}
+			}
+
+			const ComplexType start_time_;
+			const ComplexType end_time_;
+			const unsigned precision_;
+
+			mutable std::mutex mutex_; ///< Guards the queues, counts and closed_.
+			std::condition_variable work_available_;
+			std::condition_variable completion_;
+			std::deque<Job> jobs_;
+			std::deque<std::size_t> completed_;
+			std::size_t num_submitted_ = 0;
+			std::size_t num_done_ = 0;
+			std::size_t num_announced_ = 0;
+			bool closed_ = false;
+
+			std::vector<std::thread> workers_;
+		};
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
@@ -0,0 +1,239 @@
+//This file is part of Bertini 2.
+//
+//witness_sampling.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//witness_sampling.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with witness_sampling.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file witness_sampling.hpp
+
+\brief Move the points of a witness set to other slices, sampling its component, on a pool of threads.
+
+A witness set for a component of dimension \f$k\f$ of the zero set of a system \f$F\f$ is a generic linear slice \f$L\f$ of \f$k\f$ dimensions, and the points of the component on it.  Moving the slice to another, \f$L'\f$, along
+
+\f[ H(x,t) = \begin{bmatrix} F(x) \\ t L(x) + (1-t) L'(x) \end{bmatrix}, \f]
+
+from \f$t=1\f$ to \f$t=0\f$, carries the witness points to those of the component on \f$L'\f$.  This is the operation behind sampling a component, trace tests, which move the slice parallel to itself, and membership tests, which move it through a test point.
+
+Each move is a homotopy on its own, whose paths, one per witness point, are tracked by TrackAllPaths.  The slices are evaluated by matrix-matrix products over all the points at once, with their coefficients at each precision kept by the slice.
+*/
+
+#ifndef BERTINI_TRACKING_WITNESS_SAMPLING_HPP
+#define BERTINI_TRACKING_WITNESS_SAMPLING_HPP
+
+#include "bertini2/tracking/parallel_tracking.hpp"
+#include "bertini2/slice.hpp"
+
+namespace bertini{
+	namespace tracking{
+
+		/**
+		\brief The witness points moved to each of several slices.
+		*/
+		template<typename ComplexType>
+		struct WitnessSamples
+		{
+			std::vector< LinearSlice > slices; ///< The slices moved to.
+			std::vector< std::vector< PathResult<ComplexType> > > paths; ///< For each slice, the result of moving each witness point to it, in the order of the witness points.
+		};
+
+
+		/**
+		\brief The values of a slice at many points, by one matrix-matrix product.
+
+		\param slice The slice.
+		\param points The points.  In multiple precision, all at the current precision of the slice.
+
+		\return The norm of the values of the slice at each point.
+		*/
+		template<typename ComplexType>
+		std::vector< typename Eigen::NumTraits<ComplexType>::Real > SliceResiduals(LinearSlice const& slice, std::vector< Vec<ComplexType> > const& points)
+		{
+			using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+
+			std::vector<RealType> residuals;
+			if (points.empty())
+				return residuals;
+
+			Mat<ComplexType> X(slice.NumVariables(), points.size());
+			for (std::size_t ii = 0; ii < points.size(); ++ii)
+				X.col(ii) = points[ii];
+
+			const Mat<ComplexType> values = slice.EvalBatch(X);
+			residuals.reserve(points.size());
+			for (std::size_t ii = 0; ii < points.size(); ++ii)
+				residuals.push_back(values.col(ii).norm());
+			return residuals;
+		}
+
+
+		namespace detail {
+
+			/**
+			\brief The homotopy moving the slice of a witness set from one slice, at t=1, to another, at t=0.
+
+			\throws std::runtime_error if the system has a path variable, the slices are not on its variables, or of different dimension, or the system and the slice are not square together.
+			*/
+			inline
+			System SliceHomotopy(System const& system, LinearSlice const& from, LinearSlice const& to)
+			{
+				if (system.HavePathVariable())
+					throw std::runtime_error("moving the slice of a witness set, but the system has a path variable");
+				if (from.NumVariables()!=system.NumVariables() || to.NumVariables()!=system.NumVariables())
+					throw std::runtime_error("moving the slice of a witness set, but the slices are not on the " + std::to_string(system.NumVariables()) + " variables of the system");
+				if (from.Dimension()!=to.Dimension())
+					throw std::runtime_error("moving the slice of a witness set between slices of dimensions " + std::to_string(from.Dimension()) + " and " + std::to_string(to.Dimension()));
+				if (system.NumFunctions() + from.Dimension() + system.NumPatches()!=system.NumVariables())
+					throw std::runtime_error("moving the slice of a witness set, but " + std::to_string(system.NumFunctions()) + " functions and a slice of dimension " + std::to_string(from.Dimension()) + " are not square in " + std::to_string(system.NumVariables()) + " variables");
+
+				auto t = node::MakeNode<node::Variable>("t");
+
+				System homotopy;
+				homotopy.CopyVariableStructure(system);
+				for (unsigned ii = 0; ii < system.NumFunctions(); ++ii)
+					homotopy.AddFunction(system.Function(ii));
+
+				const auto from_functions = from.Functions();
+				const auto to_functions = to.Functions();
+				for (unsigned ii = 0; ii < from.Dimension(); ++ii)
+					homotopy.AddFunction(t*from_functions[ii] + (1-t)*to_functions[ii]);
+
+				if (system.IsPatched())
+					homotopy.CopyPatches(system);
+				homotopy.AddPathVariable(t);
+				return homotopy;
+			}
+		}
+
+
+		/**
+		\brief Move the points of a witness set from its slice to another, on a pool of threads.
+
+		## Use
+
+		\code
+		auto AMP = config::AMPConfigFrom(system);
+		auto moved = MoveWitnessPoints<AMPTracker>(system, slice, points, LinearSlice::RandomComplex(system.Variables(), slice.Dimension()),
+			[&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, tol, truncation, stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			});
+		\endcode
+
+		The slice moves along the straight line between the two, which for generic slices meets no singularity, so no endgame is needed.  The points are shared among the workers, as for TrackAllPaths, and setup is likewise called once per worker, concurrently.
+
+		\param system The functions of the component, as many as its codimension, without a path variable.  Homogenized and patched, or not.
+		\param slice The slice of the witness set.
+		\param points The witness points.
+		\param to The slice to move to, of the same dimension.
+		\param setup Configure a freshly made tracker.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\return The result of moving each point, in the order of the points.
+
+		\throws std::runtime_error if the system and slices do not fit together, as for a witness set.
+		\throws Whatever a worker threw, after all workers have stopped.
+		*/
+		template<typename TrackerType, typename SetupFunction>
+		std::vector< PathResult<typename TrackerTraits<TrackerType>::BaseComplexType> >
+		MoveWitnessPoints(System const& system, LinearSlice const& slice,
+		                  std::vector< Vec<typename TrackerTraits<TrackerType>::BaseComplexType> > const& points,
+		                  LinearSlice const& to, SetupFunction setup, unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			const System homotopy = detail::SliceHomotopy(system, slice, to);
+			return TrackAllPaths<TrackerType>(homotopy, detail::StartPointList<ComplexType>(points), setup, ComplexType(1), ComplexType(0), num_threads);
+		}
+
+
+		/**
+		\brief Sample the component of a witness set, by moving its points to several random slices.
+
+		The slices are drawn as the slice of the witness set is, random complex, of the same dimension, and homogeneous if it is.  Each move is tracked on the pool of threads, one after the other.
+
+		\param system The functions of the component.
+		\param slice The slice of the witness set.
+		\param points The witness points.
+		\param num_samples The number of slices to move to.
+		\param setup Configure a freshly made tracker.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+		*/
+		template<typename TrackerType, typename SetupFunction>
+		WitnessSamples<typename TrackerTraits<TrackerType>::BaseComplexType>
+		SampleWitnessSet(System const& system, LinearSlice const& slice,
+		                 std::vector< Vec<typename TrackerTraits<TrackerType>::BaseComplexType> > const& points,
+		                 unsigned num_samples, SetupFunction setup, unsigned num_threads = 0)
+		{
+			WitnessSamples<typename TrackerTraits<TrackerType>::BaseComplexType> samples;
+			for (unsigned ii = 0; ii < num_samples; ++ii)
+			{
+				samples.slices.push_back(LinearSlice::RandomComplex(system.Variables(), slice.Dimension(), slice.IsHomogeneous()));
+				samples.paths.push_back(MoveWitnessPoints<TrackerType>(system, slice, points, samples.slices.back(), setup, num_threads));
+			}
+			return samples;
+		}
+
+
+		/**
+		\brief Decide whether a point is on the component of a witness set, by moving its points to a random slice through the point.
+
+		The point is on the component if and only if it is one of the points of the component on that slice, for the slice is generic among those through the point.
+
+		\param system The functions of the component.
+		\param slice The slice of the witness set, not homogeneous.
+		\param points The witness points.
+		\param candidate The point to test.  It should solve the system, for the answer to mean anything.
+		\param setup Configure a freshly made tracker.
+		\param tolerance How close, relative to the norm of the candidate, one of the moved points must be.
+		\param num_threads The number of workers.  0, the default, uses one per hardware thread.
+
+		\throws std::runtime_error if the slice is homogeneous.
+		*/
+		template<typename TrackerType, typename SetupFunction>
+		bool IsMember(System const& system, LinearSlice const& slice,
+		              std::vector< Vec<typename TrackerTraits<TrackerType>::BaseComplexType> > const& points,
+		              Vec<mpfr> const& candidate, SetupFunction setup,
+		              typename TrackerTraits<TrackerType>::BaseRealType const& tolerance,
+		              unsigned num_threads = 0)
+		{
+			using ComplexType = typename TrackerTraits<TrackerType>::BaseComplexType;
+
+			auto through = LinearSlice::RandomComplex(system.Variables(), slice.Dimension(), slice.IsHomogeneous());
+			through.PassThrough(candidate);
+
+			const auto moved = MoveWitnessPoints<TrackerType>(system, slice, points, through, setup, num_threads);
+
+			Vec<ComplexType> target(candidate.size());
+			for (int ii = 0; ii < candidate.size(); ++ii)
+				target(ii) = static_cast<ComplexType>(candidate(ii));
+
+			for (const auto& path : moved)
+				if (path.success_code==SuccessCode::Success && (path.endpoint - target).norm() <= tolerance*(1 + target.norm()))
+					return true;
+			return false;
+		}
+
+	} // namespace tracking
+} // namespace bertini
+
+#endif
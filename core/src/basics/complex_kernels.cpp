@@ -0,0 +1,366 @@
+//This file is part of Bertini 2.
+//
+//complex_kernels.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//complex_kernels.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with complex_kernels.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/complex_kernels.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+	#define BERTINI_KERNELS_X86
+	#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__)
+	#define BERTINI_KERNELS_NEON
+	#include <arm_neon.h>
+#endif
+
+
+namespace bertini {
+namespace kernels {
+
+	namespace {
+
+		// std::complex<double> is laid out as double[2], real part first, by the standard
+		double const* Parts(dbl const* z)
+		{
+			return reinterpret_cast<double const*>(z);
+		}
+
+		double* Parts(dbl* z)
+		{
+			return reinterpret_cast<double*>(z);
+		}
+
+
+		void AxpyScalar(std::size_t n, dbl alpha, dbl const* x, dbl* y)
+		{
+			const double ar = alpha.real(), ai = alpha.imag();
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			for (std::size_t ii = 0; ii < n; ++ii)
+			{
+				const double xr = xd[2*ii], xi = xd[2*ii+1];
+				yd[2*ii] += ar*xr - ai*xi;
+				yd[2*ii+1] += ar*xi + ai*xr;
+			}
+		}
+
+		dbl DotScalar(std::size_t n, dbl const* x, dbl const* y)
+		{
+			double re = 0, im = 0;
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			for (std::size_t ii = 0; ii < n; ++ii)
+			{
+				re += xd[2*ii]*yd[2*ii] - xd[2*ii+1]*yd[2*ii+1];
+				im += xd[2*ii]*yd[2*ii+1] + xd[2*ii+1]*yd[2*ii];
+			}
+			return dbl(re, im);
+		}
+
+
+#ifdef BERTINI_KERNELS_X86
+
+		// alpha*x for two entries at once: with x = [xr, xi, ...] and x swapped = [xi, xr, ...], fmaddsub gives ar*xr - ai*xi in the even lanes and ar*xi + ai*xr in the odd
+		__attribute__((target("avx2,fma")))
+		void AxpyAVX2(std::size_t n, dbl alpha, dbl const* x, dbl* y)
+		{
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			const __m256d ar = _mm256_set1_pd(alpha.real());
+			const __m256d ai = _mm256_set1_pd(alpha.imag());
+
+			std::size_t ii = 0;
+			for (; ii + 2 <= n; ii += 2)
+			{
+				const __m256d xv = _mm256_loadu_pd(xd + 2*ii);
+				const __m256d product = _mm256_fmaddsub_pd(ar, xv, _mm256_mul_pd(ai, _mm256_permute_pd(xv, 0x5)));
+				_mm256_storeu_pd(yd + 2*ii, _mm256_add_pd(_mm256_loadu_pd(yd + 2*ii), product));
+			}
+			AxpyScalar(n - ii, alpha, x + ii, y + ii);
+		}
+
+		// two sums, of [xr*yr, xi*yr] and of [xi*yi, xr*yi], combined at the end
+		__attribute__((target("avx2,fma")))
+		dbl DotAVX2(std::size_t n, dbl const* x, dbl const* y)
+		{
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			__m256d by_real = _mm256_setzero_pd();
+			__m256d by_imag = _mm256_setzero_pd();
+
+			std::size_t ii = 0;
+			for (; ii + 2 <= n; ii += 2)
+			{
+				const __m256d xv = _mm256_loadu_pd(xd + 2*ii);
+				const __m256d yv = _mm256_loadu_pd(yd + 2*ii);
+				by_real = _mm256_fmadd_pd(xv, _mm256_movedup_pd(yv), by_real);
+				by_imag = _mm256_fmadd_pd(_mm256_permute_pd(xv, 0x5), _mm256_permute_pd(yv, 0xF), by_imag);
+			}
+
+			double r[4], i[4];
+			_mm256_storeu_pd(r, by_real);
+			_mm256_storeu_pd(i, by_imag);
+			return dbl(r[0] + r[2] - i[0] - i[2], r[1] + r[3] + i[1] + i[3]) + DotScalar(n - ii, x + ii, y + ii);
+		}
+
+
+		__attribute__((target("avx512f")))
+		void AxpyAVX512(std::size_t n, dbl alpha, dbl const* x, dbl* y)
+		{
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			const __m512d ar = _mm512_set1_pd(alpha.real());
+			const __m512d ai = _mm512_set1_pd(alpha.imag());
+
+			std::size_t ii = 0;
+			for (; ii + 4 <= n; ii += 4)
+			{
+				const __m512d xv = _mm512_loadu_pd(xd + 2*ii);
+				const __m512d product = _mm512_fmaddsub_pd(ar, xv, _mm512_mul_pd(ai, _mm512_permute_pd(xv, 0x55)));
+				_mm512_storeu_pd(yd + 2*ii, _mm512_add_pd(_mm512_loadu_pd(yd + 2*ii), product));
+			}
+			AxpyScalar(n - ii, alpha, x + ii, y + ii);
+		}
+
+		__attribute__((target("avx512f")))
+		dbl DotAVX512(std::size_t n, dbl const* x, dbl const* y)
+		{
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			__m512d by_real = _mm512_setzero_pd();
+			__m512d by_imag = _mm512_setzero_pd();
+
+			std::size_t ii = 0;
+			for (; ii + 4 <= n; ii += 4)
+			{
+				const __m512d xv = _mm512_loadu_pd(xd + 2*ii);
+				const __m512d yv = _mm512_loadu_pd(yd + 2*ii);
+				by_real = _mm512_fmadd_pd(xv, _mm512_movedup_pd(yv), by_real);
+				by_imag = _mm512_fmadd_pd(_mm512_permute_pd(xv, 0x55), _mm512_permute_pd(yv, 0xFF), by_imag);
+			}
+
+			double r[8], i[8];
+			_mm512_storeu_pd(r, by_real);
+			_mm512_storeu_pd(i, by_imag);
+			double re = 0, im = 0;
+			for (int lane = 0; lane < 8; lane += 2)
+			{
+				re += r[lane] - i[lane];
+				im += r[lane+1] + i[lane+1];
+			}
+			return dbl(re, im) + DotScalar(n - ii, x + ii, y + ii);
+		}
+
+#endif // BERTINI_KERNELS_X86
+
+
+#ifdef BERTINI_KERNELS_NEON
+
+		// one entry per register.  alpha*x = ar*[xr, xi] + [-ai, ai]*[xi, xr]
+		void AxpyNEON(std::size_t n, dbl alpha, dbl const* x, dbl* y)
+		{
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			const double signed_imag[2] = {-alpha.imag(), alpha.imag()};
+			const float64x2_t ar = vdupq_n_f64(alpha.real());
+			const float64x2_t ai = vld1q_f64(signed_imag);
+
+			for (std::size_t ii = 0; ii < n; ++ii)
+			{
+				const float64x2_t xv = vld1q_f64(xd + 2*ii);
+				float64x2_t yv = vld1q_f64(yd + 2*ii);
+				yv = vfmaq_f64(yv, ar, xv);
+				yv = vfmaq_f64(yv, ai, vextq_f64(xv, xv, 1));
+				vst1q_f64(yd + 2*ii, yv);
+			}
+		}
+
+		dbl DotNEON(std::size_t n, dbl const* x, dbl const* y)
+		{
+			auto xd = Parts(x);
+			auto yd = Parts(y);
+			float64x2_t by_real = vdupq_n_f64(0);
+			float64x2_t by_imag = vdupq_n_f64(0);
+
+			for (std::size_t ii = 0; ii < n; ++ii)
+			{
+				const float64x2_t xv = vld1q_f64(xd + 2*ii);
+				const float64x2_t yv = vld1q_f64(yd + 2*ii);
+				by_real = vfmaq_f64(by_real, xv, vdupq_laneq_f64(yv, 0));
+				by_imag = vfmaq_f64(by_imag, vextq_f64(xv, xv, 1), vdupq_laneq_f64(yv, 1));
+			}
+			return dbl(vgetq_lane_f64(by_real, 0) - vgetq_lane_f64(by_imag, 0), vgetq_lane_f64(by_real, 1) + vgetq_lane_f64(by_imag, 1));
+		}
+
+#endif // BERTINI_KERNELS_NEON
+
+
+		detail::KernelTable const& TableFor(InstructionSet set)
+		{
+			static const detail::KernelTable scalar{&AxpyScalar, &DotScalar};
+#ifdef BERTINI_KERNELS_X86
+			static const detail::KernelTable avx2{&AxpyAVX2, &DotAVX2};
+			static const detail::KernelTable avx512{&AxpyAVX512, &DotAVX512};
+#endif
+#ifdef BERTINI_KERNELS_NEON
+			static const detail::KernelTable neon{&AxpyNEON, &DotNEON};
+#endif
+
+			switch (set)
+			{
+#ifdef BERTINI_KERNELS_X86
+				case InstructionSet::AVX2: return avx2;
+				case InstructionSet::AVX512: return avx512;
+#endif
+#ifdef BERTINI_KERNELS_NEON
+				case InstructionSet::NEON: return neon;
+#endif
+				default: return scalar;
+			}
+		}
+
+
+		InstructionSet Best()
+		{
+			for (auto set : {InstructionSet::AVX512, InstructionSet::AVX2, InstructionSet::NEON})
+				if (Supported(set))
+					return set;
+			return InstructionSet::Scalar;
+		}
+
+
+		struct Active
+		{
+			std::atomic<InstructionSet> set;
+			std::atomic<detail::KernelTable const*> table;
+
+			Active() : set(Best()), table(&TableFor(set.load()))
+			{}
+		};
+
+		Active& ActiveState()
+		{
+			static Active active;
+			return active;
+		}
+
+	} // re: namespace
+
+
+	namespace detail {
+
+		KernelTable const& ActiveKernels()
+		{
+			return *ActiveState().table.load(std::memory_order_relaxed);
+		}
+
+	}
+
+
+	InstructionSet ActiveInstructionSet()
+	{
+		return ActiveState().set.load();
+	}
+
+
+	bool Supported(InstructionSet set)
+	{
+		switch (set)
+		{
+			case InstructionSet::Scalar:
+				return true;
+#ifdef BERTINI_KERNELS_X86
+			case InstructionSet::AVX2:
+				return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+			case InstructionSet::AVX512:
+				return __builtin_cpu_supports("avx512f");
+#endif
+#ifdef BERTINI_KERNELS_NEON
+			case InstructionSet::NEON:
+				return true;
+#endif
+			default:
+				return false;
+		}
+	}
+
+
+	void UseInstructionSet(InstructionSet set)
+	{
+		if (!Supported(set))
+			throw std::runtime_error(std::string("unable to run the complex kernels with ") + Name(set) + ", which this build or processor lacks");
+
+		auto& active = ActiveState();
+		active.table.store(&TableFor(set));
+		active.set.store(set);
+	}
+
+
+	char const* Name(InstructionSet set)
+	{
+		switch (set)
+		{
+			case InstructionSet::Scalar: return "scalar";
+			case InstructionSet::AVX2: return "AVX2";
+			case InstructionSet::AVX512: return "AVX-512";
+			case InstructionSet::NEON: return "NEON";
+		}
+		return "unknown";
+	}
+
+
+	void MatVec(std::size_t rows, std::size_t cols, dbl const* A, std::size_t lda, dbl const* x, dbl* y)
+	{
+		auto const& kernels = detail::ActiveKernels();
+		for (std::size_t ii = 0; ii < rows; ++ii)
+			y[ii] = dbl(0);
+		for (std::size_t jj = 0; jj < cols; ++jj)
+			kernels.axpy(rows, x[jj], A + jj*lda, y);
+	}
+
+
+	void SolveUnitLower(std::size_t n, dbl const* L, std::size_t ld, dbl* x)
+	{
+		auto const& kernels = detail::ActiveKernels();
+		for (std::size_t k = 0; k + 1 < n; ++k)
+			kernels.axpy(n-k-1, -x[k], L + k*ld + k+1, x + k+1);
+	}
+
+
+	void SolveUpper(std::size_t n, dbl const* U, std::size_t ld, dbl* x)
+	{
+		auto const& kernels = detail::ActiveKernels();
+		for (std::size_t k = n; k-- > 0; )
+		{
+			x[k] /= U[k*ld + k];
+			kernels.axpy(k, -x[k], U + k*ld, x);
+		}
+	}
+
+} // namespace kernels
+} // namespace bertini
@@ -0,0 +1,198 @@
+//This file is part of Bertini 2.
+//
+//double_double.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//double_double.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with double_double.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/double_double.hpp"
+
+#include <iomanip>
+
+
+namespace bertini {
+namespace dd {
+
+	namespace {
+
+		// a few guard digits beyond those of double-double, so that rounding back is the only error
+		unsigned MpfrDigits()
+		{
+			return DoubleDoublePrecision() + 4;
+		}
+
+		template<typename F>
+		dd_real ThroughMpfr(dd_real const& x, F f)
+		{
+			auto prev_precision = DefaultPrecision();
+			DefaultPrecision(MpfrDigits());
+			dd_real result(mpfr_float(f(x.ToMpfr())));
+			DefaultPrecision(prev_precision);
+			return result;
+		}
+
+		template<typename F>
+		dd_complex ThroughMpfr(dd_complex const& z, F f)
+		{
+			auto prev_precision = DefaultPrecision();
+			DefaultPrecision(MpfrDigits());
+			dd_complex result(complex(f(z.ToMpfr())));
+			DefaultPrecision(prev_precision);
+			return result;
+		}
+	}
+
+
+	dd_real::dd_real(mpfr_float const& x)
+	{
+		const double hi = x.convert_to<double>();
+		const double lo = mpfr_float(x - hi).convert_to<double>();
+		QuickTwoSum(hi, lo, hi_, lo_);
+	}
+
+
+	mpfr_float dd_real::ToMpfr() const
+	{
+		mpfr_float result(hi_);
+		result += lo_;
+		return result;
+	}
+
+
+	std::ostream& operator<<(std::ostream& out, dd_real const& x)
+	{
+		auto prev_precision = DefaultPrecision();
+		DefaultPrecision(MpfrDigits());
+		const auto prev_stream_precision = out.precision(DoubleDoublePrecision());
+		out << x.ToMpfr();
+		out.precision(prev_stream_precision);
+		DefaultPrecision(prev_precision);
+		return out;
+	}
+
+
+	dd_real exp(dd_real const& x)
+	{
+		return ThroughMpfr(x, [](mpfr_float const& y){return mpfr_float(exp(y));});
+	}
+
+	dd_real log(dd_real const& x)
+	{
+		return ThroughMpfr(x, [](mpfr_float const& y){return mpfr_float(log(y));});
+	}
+
+	dd_real sin(dd_real const& x)
+	{
+		return ThroughMpfr(x, [](mpfr_float const& y){return mpfr_float(sin(y));});
+	}
+
+	dd_real cos(dd_real const& x)
+	{
+		return ThroughMpfr(x, [](mpfr_float const& y){return mpfr_float(cos(y));});
+	}
+
+	dd_real pow(dd_real const& x, dd_real const& y)
+	{
+		auto prev_precision = DefaultPrecision();
+		DefaultPrecision(MpfrDigits());
+		dd_real result(mpfr_float(pow(x.ToMpfr(), y.ToMpfr())));
+		DefaultPrecision(prev_precision);
+		return result;
+	}
+
+
+
+
+	dd_complex pow(dd_complex const& z, int p)
+	{
+		dd_complex result(1), square = z;
+		for (long q = p < 0 ? -long(p) : long(p); q > 0; q /= 2)
+		{
+			if (q % 2)
+				result *= square;
+			if (q > 1)
+				square *= square;
+		}
+		return p < 0 ? dd_complex(1) / result : result;
+	}
+
+	dd_complex pow(dd_complex const& z, dd_complex const& w)
+	{
+		auto prev_precision = DefaultPrecision();
+		DefaultPrecision(MpfrDigits());
+		dd_complex result(pow(z.ToMpfr(), w.ToMpfr()));
+		DefaultPrecision(prev_precision);
+		return result;
+	}
+
+	dd_complex exp(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return exp(y);});
+	}
+
+	dd_complex log(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return log(y);});
+	}
+
+	dd_complex sin(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return sin(y);});
+	}
+
+	dd_complex cos(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return cos(y);});
+	}
+
+	void SinCos(dd_complex const& z, dd_complex & s, dd_complex & c)
+	{
+		auto prev_precision = DefaultPrecision();
+		DefaultPrecision(MpfrDigits());
+		complex s_mp, c_mp;
+		bertini::SinCos(z.ToMpfr(), s_mp, c_mp);
+		s = dd_complex(s_mp);
+		c = dd_complex(c_mp);
+		DefaultPrecision(prev_precision);
+	}
+
+	dd_complex tan(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return tan(y);});
+	}
+
+	dd_complex asin(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return asin(y);});
+	}
+
+	dd_complex acos(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return acos(y);});
+	}
+
+	dd_complex atan(dd_complex const& z)
+	{
+		return ThroughMpfr(z, [](complex const& y){return atan(y);});
+	}
+
+} // namespace dd
+} // namespace bertini
+
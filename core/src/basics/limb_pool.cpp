@@ -0,0 +1,271 @@
+//This file is part of Bertini 2.
+//
+//limb_pool.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//limb_pool.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with limb_pool.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/config.h"
+#include "bertini2/limb_pool.hpp"
+#include "bertini2/tracking/instrumentation.hpp"
+
+#include <gmp.h>
+#include <mpfr.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+namespace bertini {
+namespace limb_pool {
+
+	namespace {
+
+		// blocks whose size is a multiple of this many bytes, up to max_pooled_size, are pooled.  only exact sizes share a list, so a block allocated before the pool was installed, with exactly the size it is freed with, is always big enough for its list.
+		const std::size_t granularity = sizeof(mp_limb_t);
+		const std::size_t max_pooled_size = 2048;
+		const std::size_t num_size_classes = max_pooled_size/granularity + 1;
+
+		// the most blocks of one size a thread keeps, beyond which freed blocks go back to the system
+		const unsigned max_cached_per_size = 64;
+
+
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		// trivially destructible, so the lists stay usable by the destructors of other thread_local objects, which may free multiple precision numbers after this thread's cache is closed
+		struct ThreadCache
+		{
+			FreeBlock* heads[num_size_classes];
+			unsigned counts[num_size_classes];
+			Statistics stats;
+			bool closer_registered;
+			bool closed;
+		};
+
+	#ifdef USE_THREAD_LOCAL
+		thread_local ThreadCache cache{};
+	#else
+		ThreadCache cache{}; // shared by all threads, so the pool must not be installed in multithreaded programs
+	#endif
+
+
+		// releases the cache when its thread exits, after which freed blocks go straight to the system
+		struct CacheCloser
+		{
+			~CacheCloser()
+			{
+				ReleaseThreadCache();
+				cache.closed = true;
+			}
+		};
+
+		void RegisterCloser()
+		{
+		#ifdef USE_THREAD_LOCAL
+			static thread_local CacheCloser closer;
+		#else
+			static CacheCloser closer;
+		#endif
+			cache.closer_registered = true;
+		}
+
+
+		bool installed = false;
+
+		void* (*previous_allocate)(size_t) = nullptr;
+		void* (*previous_reallocate)(void*, size_t, size_t) = nullptr;
+		void  (*previous_free)(void*, size_t) = nullptr;
+
+
+		bool IsPooled(std::size_t size)
+		{
+			return size>0 && size<=max_pooled_size && size%granularity==0;
+		}
+
+		// the memory functions in place before the pool, such as those counting allocations, or GMP's own, which go to malloc
+		void* SystemAllocate(std::size_t size)
+		{
+			void* p = previous_allocate(size);
+			if (!p)
+			{
+				// as GMP's own allocator does, for GMP cannot recover from failed allocation
+				std::fprintf(stderr, "bertini limb pool: cannot allocate %zu bytes\n", size);
+				std::abort();
+			}
+			return p;
+		}
+
+
+		void SystemFree(void* ptr, std::size_t size)
+		{
+			if (previous_free)
+				previous_free(ptr, size);
+			else
+				std::free(ptr);
+		}
+
+
+		void* Allocate(size_t size)
+		{
+			++cache.stats.allocations;
+
+			if (IsPooled(size) && !cache.closed)
+			{
+				auto& counts = tracking::instrument::ThreadAllocations();
+				const auto k = size/granularity;
+				if (FreeBlock* b = cache.heads[k])
+				{
+					cache.heads[k] = b->next;
+					--cache.counts[k];
+					++cache.stats.hits;
+					++counts.pool_hits;
+					return b;
+				}
+				++counts.pool_misses;
+			}
+
+			return SystemAllocate(size);
+		}
+
+		void Free(void* ptr, size_t size)
+		{
+			if (!ptr)
+				return;
+
+			++cache.stats.frees;
+
+			if (IsPooled(size) && !cache.closed)
+			{
+				const auto k = size/granularity;
+				if (cache.counts[k] < max_cached_per_size)
+				{
+					if (!cache.closer_registered)
+						RegisterCloser();
+
+					auto b = static_cast<FreeBlock*>(ptr);
+					b->next = cache.heads[k];
+					cache.heads[k] = b;
+					++cache.counts[k];
+					return;
+				}
+			}
+
+			SystemFree(ptr, size);
+		}
+
+		void* Reallocate(void* ptr, size_t old_size, size_t new_size)
+		{
+			++cache.stats.reallocations;
+
+			if (old_size==new_size)
+				return ptr;
+
+			if (!IsPooled(old_size) && !IsPooled(new_size))
+			{
+				void* p = previous_reallocate(ptr, old_size, new_size);
+				if (!p)
+				{
+					std::fprintf(stderr, "bertini limb pool: cannot reallocate to %zu bytes\n", new_size);
+					std::abort();
+				}
+				return p;
+			}
+
+			void* p = Allocate(new_size);
+			std::memcpy(p, ptr, std::min(old_size, new_size));
+			Free(ptr, old_size);
+			return p;
+		}
+	}
+
+
+
+	void Install()
+	{
+		if (installed)
+			return;
+
+	#if MPFR_VERSION_MAJOR >= 4
+		// MPFR keeps a cache of its own from the current memory functions, which must be emptied before they change
+		mpfr_mp_memory_cleanup();
+	#endif
+
+		mp_get_memory_functions(&previous_allocate, &previous_reallocate, &previous_free);
+		mp_set_memory_functions(Allocate, Reallocate, Free);
+		installed = true;
+	}
+
+
+	void Uninstall()
+	{
+		if (!installed)
+			return;
+
+	#if MPFR_VERSION_MAJOR >= 4
+		mpfr_mp_memory_cleanup();
+	#endif
+
+		mp_set_memory_functions(previous_allocate, previous_reallocate, previous_free);
+		installed = false;
+		ReleaseThreadCache();
+	}
+
+
+	bool IsInstalled()
+	{
+		return installed;
+	}
+
+
+	void ReleaseThreadCache()
+	{
+		for (std::size_t k = 0; k < num_size_classes; ++k)
+		{
+			FreeBlock* b = cache.heads[k];
+			while (b)
+			{
+				FreeBlock* next = b->next;
+				SystemFree(b, k*granularity);
+				b = next;
+			}
+			cache.heads[k] = nullptr;
+			cache.counts[k] = 0;
+		}
+	}
+
+
+	Statistics ThreadStatistics()
+	{
+		return cache.stats;
+	}
+
+
+	void ResetThreadStatistics()
+	{
+		cache.stats = Statistics();
+	}
+
+} // namespace limb_pool
+} // namespace bertini
@@ -0,0 +1,240 @@
+//This file is part of Bertini 2.
+//
+//logging.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//logging.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with logging.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/config.h"
+#include "bertini2/logging.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+namespace bertini {
+
+	namespace {
+
+		struct Record
+		{
+			logging::trivial::severity_level level;
+			std::function<void(std::ostream&)> write;
+		};
+
+
+		// written only by the thread owning it, read only by the background thread
+		class Ring
+		{
+		public:
+
+			explicit Ring(std::size_t capacity) : slots_(capacity)
+			{}
+
+			bool Push(Record && record)
+			{
+				const auto tail = tail_.load(std::memory_order_relaxed);
+				if (tail - head_.load(std::memory_order_acquire) == slots_.size())
+					return false;
+
+				slots_[tail % slots_.size()] = std::move(record);
+				tail_.store(tail+1, std::memory_order_release);
+				return true;
+			}
+
+			template<typename F>
+			std::size_t Drain(F && f)
+			{
+				auto head = head_.load(std::memory_order_relaxed);
+				const auto tail = tail_.load(std::memory_order_acquire);
+				const std::size_t num = tail - head;
+				for (; head != tail; ++head)
+				{
+					auto& slot = slots_[head % slots_.size()];
+					f(slot);
+					slot.write = nullptr; // release what it captured now, not when the slot is reused
+				}
+				head_.store(head, std::memory_order_release);
+				return num;
+			}
+
+		private:
+			std::vector<Record> slots_;
+			std::atomic<std::size_t> head_{0};
+			std::atomic<std::size_t> tail_{0};
+		};
+
+
+		struct Backend
+		{
+			std::mutex mutex; // guards rings, and starting and stopping
+			std::vector< std::shared_ptr<Ring> > rings;
+			std::size_t ring_capacity = 4096;
+
+			std::thread worker;
+			std::condition_variable wake;
+			std::mutex wake_mutex;
+
+			std::atomic<bool> running{false};
+			std::atomic<bool> stopping{false};
+			std::atomic<unsigned> generation{0}; // increments with each Start, so that threads make new rings
+			std::atomic<std::size_t> dropped{0};
+		};
+
+		Backend& GetBackend()
+		{
+			static Backend backend;
+			return backend;
+		}
+
+
+		void Emit(Record const& record)
+		{
+			std::ostringstream text;
+			record.write(text);
+			BOOST_LOG_SEV(logging::trivial::logger::get(), record.level) << text.str();
+		}
+
+
+		std::size_t DrainAll(Backend & backend)
+		{
+			std::vector< std::shared_ptr<Ring> > rings;
+			{
+				std::lock_guard<std::mutex> lock(backend.mutex);
+				rings = backend.rings;
+			}
+
+			std::size_t num = 0;
+			for (auto& ring : rings)
+				num += ring->Drain(Emit);
+			return num;
+		}
+
+
+		void Work(Backend & backend)
+		{
+			while (!backend.stopping.load(std::memory_order_acquire))
+			{
+				if (DrainAll(backend) == 0)
+				{
+					std::unique_lock<std::mutex> lock(backend.wake_mutex);
+					backend.wake.wait_for(lock, std::chrono::milliseconds(2));
+				}
+			}
+			DrainAll(backend);
+		}
+
+
+	#ifdef USE_THREAD_LOCAL
+		struct ThreadRing
+		{
+			std::shared_ptr<Ring> ring;
+			unsigned generation = 0;
+		};
+
+		thread_local ThreadRing this_thread_ring;
+
+		Ring* ThisThreadRing(Backend & backend)
+		{
+			const auto generation = backend.generation.load(std::memory_order_acquire);
+			if (!this_thread_ring.ring || this_thread_ring.generation != generation)
+			{
+				std::lock_guard<std::mutex> lock(backend.mutex);
+				this_thread_ring.ring = std::make_shared<Ring>(backend.ring_capacity);
+				this_thread_ring.generation = generation;
+				// kept by the backend too, so that what a thread logs just before it exits is still written
+				backend.rings.push_back(this_thread_ring.ring);
+			}
+			return this_thread_ring.ring.get();
+		}
+	#endif
+	}
+
+
+
+	void LogDeferred(logging::trivial::severity_level level, std::function<void(std::ostream&)> write)
+	{
+		Record record{level, std::move(write)};
+
+	#ifdef USE_THREAD_LOCAL
+		auto& backend = GetBackend();
+		if (backend.running.load(std::memory_order_acquire))
+		{
+			if (!ThisThreadRing(backend)->Push(std::move(record)))
+				++backend.dropped;
+			return;
+		}
+	#endif
+
+		Emit(record);
+	}
+
+
+
+	void AsyncLogging::Start(std::size_t ring_capacity)
+	{
+	#ifdef USE_THREAD_LOCAL
+		auto& backend = GetBackend();
+		std::lock_guard<std::mutex> lock(backend.mutex);
+		if (backend.running)
+			return;
+
+		backend.rings.clear();
+		backend.ring_capacity = ring_capacity;
+		backend.dropped = 0;
+		backend.stopping = false;
+		++backend.generation;
+		backend.worker = std::thread(Work, std::ref(backend));
+		backend.running = true;
+	#endif
+	}
+
+
+	void AsyncLogging::Stop()
+	{
+	#ifdef USE_THREAD_LOCAL
+		auto& backend = GetBackend();
+		if (!backend.running.exchange(false))
+			return;
+
+		backend.stopping = true;
+		backend.wake.notify_one();
+		backend.worker.join();
+	#endif
+	}
+
+
+	bool AsyncLogging::Running()
+	{
+		return GetBackend().running;
+	}
+
+
+	std::size_t AsyncLogging::NumDropped()
+	{
+		return GetBackend().dropped;
+	}
+
+} // namespace bertini
@@ -0,0 +1,115 @@
+//This file is part of Bertini 2.
+//
+//memory_usage.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//memory_usage.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with memory_usage.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/memory_usage.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace bertini {
+
+	namespace {
+		// whether a component is the named one, or beneath it
+		bool Within(std::string const& component, std::string const& name)
+		{
+			return component.compare(0, name.size(), name)==0 && (component.size()==name.size() || component[name.size()]=='/');
+		}
+	}
+
+
+	void MemoryUsage::Add(std::string const& name, std::size_t bytes, std::size_t count)
+	{
+		for (auto& c : components_)
+			if (c.name==name)
+			{
+				c.bytes += bytes;
+				c.count += count;
+				return;
+			}
+		components_.push_back(Component{name, bytes, count});
+	}
+
+
+	void MemoryUsage::Add(std::string const& prefix, MemoryUsage const& other)
+	{
+		for (auto const& c : other.components_)
+			Add(prefix + "/" + c.name, c.bytes, c.count);
+	}
+
+
+	std::size_t MemoryUsage::TotalBytes() const
+	{
+		std::size_t bytes = 0;
+		for (auto const& c : components_)
+			bytes += c.bytes;
+		return bytes;
+	}
+
+
+	std::size_t MemoryUsage::Bytes(std::string const& name) const
+	{
+		std::size_t bytes = 0;
+		for (auto const& c : components_)
+			if (Within(c.name, name))
+				bytes += c.bytes;
+		return bytes;
+	}
+
+
+	std::size_t MemoryUsage::Count(std::string const& name) const
+	{
+		std::size_t count = 0;
+		for (auto const& c : components_)
+			if (Within(c.name, name))
+				count += c.count;
+		return count;
+	}
+
+
+	std::ostream& operator<<(std::ostream & out, MemoryUsage const& usage)
+	{
+		for (auto const& c : usage.Components())
+			out << c.name << ": " << c.bytes << " bytes, " << c.count << "\n";
+		out << "total: " << usage.TotalBytes() << " bytes\n";
+		return out;
+	}
+
+
+	std::size_t AvailableMemory()
+	{
+		// MemAvailable counts the page cache the kernel would give up, which sysconf's available pages do not
+		std::ifstream meminfo("/proc/meminfo");
+		std::string line;
+		while (std::getline(meminfo, line))
+			if (line.compare(0, 13, "MemAvailable:")==0)
+			{
+				std::istringstream fields(line.substr(13));
+				std::size_t kilobytes = 0;
+				if (fields >> kilobytes)
+					return kilobytes*1024;
+			}
+		return 0;
+	}
+
+} // namespace bertini
@@ -2,8 +2,8 @@
 
 namespace bertini{
 	#ifdef USE_THREAD_LOCAL
-		mpfr_float thread_local complex::temp_[8]{};
+		mpfr_float thread_local complex::temp_[10]{};
 	#else
-		mpfr_float complex::temp_[8]{};
+		mpfr_float complex::temp_[10]{};
 	#endif
 }
@@ -34,133 +34,65 @@ Particularly includes Boost.Serialize code for the mpfr_float, gmp_rational, and
 
 namespace bertini {
 
-	mpfr_float RandomMp()
+	void RandomMp(mpfr_float & a, unsigned num_digits, RandomStream & stream)
 	{
-		auto num_digits = DefaultPrecision();
-
-		if (num_digits<=50)
-			return RandomMp<50>();
-		else if (num_digits<=100)
-			return RandomMp<100>();
-		else if (num_digits<=200)
-			return RandomMp<200>();
-		else if (num_digits<=400)
-			return RandomMp<400>();
-		else if (num_digits<=800)
-			return RandomMp<800>();
-		else if (num_digits<=1600)
-			return RandomMp<1600>();
-		else if (num_digits<=3200)
-			return RandomMp<3200>();
-		else if (num_digits<=6400)
-			return RandomMp<6400>();
-		else if (num_digits<=8000)
-			return RandomMp<8000>();
-		else if (num_digits<=10000)
-			return RandomMp<10000>();
-		else if (num_digits<=12000)
-			return RandomMp<12000>();
-		else if (num_digits<=14000)
-			return RandomMp<14000>();
-		else if (num_digits<=16000)
-			return RandomMp<16000>();
-		else if (num_digits<=18000)
-			return RandomMp<18000>();
-		else if (num_digits<=20000)
-			return RandomMp<20000>();
-		else if (num_digits<=40000)
-			return RandomMp<40000>();
-		else
-			throw std::out_of_range("requesting random long number of number of digits higher than 40000.  this can be remedied by adding more cases to the generating function RandomMp.  If you have a better solution to this problem, please write the authors of this software.");
-	}
-
+		a.precision(num_digits);
 
+		// enough whole draws for the significand, as an integer scaled into [0,1), rounded toward zero so as never to reach 1
+		const auto num_words = (mpfr_get_prec(a.backend().data()) + 63)/64;
+		mpz_int significand(0);
+		for (mpfr_prec_t ii = 0; ii < num_words; ++ii)
+		{
+			significand <<= 64;
+			significand += mpz_int(stream());
+		}
+		mpfr_set_z_2exp(a.backend().data(), significand.backend().data(), -64*num_words, MPFR_RNDZ);
+	}
 
 
-	mpfr_float RandomMp(const mpfr_float & a, const mpfr_float & b)
+	void RandomMp(mpfr_float & a, unsigned num_digits)
 	{
-		auto num_digits = DefaultPrecision();
-
-		if (num_digits<=50)
-			return RandomMp<50>(a,b);
-		else if (num_digits<=100)
-			return RandomMp<100>(a,b);
-		else if (num_digits<=200)
-			return RandomMp<200>(a,b);
-		else if (num_digits<=400)
-			return RandomMp<400>(a,b);
-		else if (num_digits<=800)
-			return RandomMp<800>(a,b);
-		else if (num_digits<=1600)
-			return RandomMp<1600>(a,b);
-		else if (num_digits<=3200)
-			return RandomMp<3200>(a,b);
-		else if (num_digits<=6400)
-			return RandomMp<6400>(a,b);
-		else if (num_digits<=8000)
-			return RandomMp<8000>(a,b);
-		else if (num_digits<=10000)
-			return RandomMp<10000>(a,b);
-		else if (num_digits<=12000)
-			return RandomMp<12000>(a,b);
-		else if (num_digits<=14000)
-			return RandomMp<14000>(a,b);
-		else if (num_digits<=16000)
-			return RandomMp<16000>(a,b);
-		else if (num_digits<=18000)
-			return RandomMp<18000>(a,b);
-		else if (num_digits<=20000)
-			return RandomMp<20000>(a,b);
-		else if (num_digits<=40000)
-			return RandomMp<40000>(a,b);
-		else
-			throw std::out_of_range("requesting random long number of number of digits higher than 40000.  this can be remedied by adding more cases to the generating function RandomMp.  If you have a better solution to this problem, please write the authors of this software.");
+		RandomMp(a, num_digits, ThreadRandomStream());
 	}
 
 
+	mpfr_float RandomMp()
+	{
+		mpfr_float a;
+		RandomMp(a, DefaultPrecision());
+		return a;
+	}
 
 
+	mpfr_float RandomMp(const mpfr_float & a, const mpfr_float & b)
+	{
+		return (b-a)*RandomMp()+a;
+	}
 
 
-
-	void RandomMp(mpfr_float & a, unsigned num_digits)
+	mpz_int RandomIntOfBits(unsigned long num_bits)
 	{
-		if (num_digits<=50)
-			RandomMp<50>(a);
-		else if (num_digits<=100)
-			RandomMp<100>(a);
-		else if (num_digits<=200)
-			RandomMp<200>(a);
-		else if (num_digits<=400)
-			RandomMp<400>(a);
-		else if (num_digits<=800)
-			RandomMp<800>(a);
-		else if (num_digits<=1600)
-			RandomMp<1600>(a);
-		else if (num_digits<=3200)
-			RandomMp<3200>(a);
-		else if (num_digits<=6400)
-			RandomMp<6400>(a);
-		else if (num_digits<=8000)
-			RandomMp<8000>(a);
-		else if (num_digits<=10000)
-			RandomMp<10000>(a);
-		else if (num_digits<=12000)
-			RandomMp<12000>(a);
-		else if (num_digits<=14000)
-			RandomMp<14000>(a);
-		else if (num_digits<=16000)
-			RandomMp<16000>(a);
-		else if (num_digits<=18000)
-			RandomMp<18000>(a);
-		else if (num_digits<=20000)
-			RandomMp<20000>(a);
-		else if (num_digits<=40000)
-			RandomMp<40000>(a);
-		else
-			throw std::out_of_range("requesting random long number of number of digits higher than 40000.  this can be remedied by adding more cases to the generating function RandomMp.  If you have a better solution to this problem, please write the authors of this software.");
-
-		a.precision(num_digits);
+		auto& stream = ThreadRandomStream();
+
+		// uniform on [0, 2^(num_bits+1)] by rejection from the integers of num_bits+2 bits, at least half of which are accepted
+		const mpz_int range = (mpz_int(1) << (num_bits+1)) + 1;
+		const unsigned long num_draw_bits = num_bits + 2;
+		const mpz_int mask = (mpz_int(1) << num_draw_bits) - 1;
+
+		mpz_int x;
+		do
+		{
+			x = 0;
+			for (unsigned long drawn = 0; drawn < num_draw_bits; drawn += 64)
+			{
+				x <<= 64;
+				x += mpz_int(stream());
+			}
+			x &= mask;
+		}
+		while (x >= range);
+
+		return x - (mpz_int(1) << num_bits);
 	}
 
 
@@ -0,0 +1,141 @@
+//This file is part of Bertini 2.
+//
+//random.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//random.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with random.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/config.h"
+#include "bertini2/random.hpp"
+
+#include <atomic>
+
+
+namespace bertini {
+
+	namespace {
+
+		// the finalizer of SplitMix64, a bijection which scatters nearby inputs
+		std::uint64_t Mix(std::uint64_t x)
+		{
+			x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+			return x ^ (x >> 31);
+		}
+
+		// the streams of threads are apart from those derived by Substream, whose identities are mixed
+		const std::uint64_t thread_streams = std::uint64_t(1) << 63;
+
+		std::atomic<std::uint64_t> master_seed(0);
+		std::atomic<unsigned> seed_generation(0);
+		std::atomic<std::uint64_t> num_threads_drawn(0);
+
+		struct ThreadState
+		{
+			RandomStream stream;
+			std::uint64_t number = 0;
+			unsigned generation = 0;
+			bool numbered = false;
+			bool scoped = false;
+		};
+
+	#ifdef USE_THREAD_LOCAL
+		thread_local ThreadState state;
+	#else
+		ThreadState state; // shared by all threads
+	#endif
+	}
+
+
+	std::uint64_t RandomStream::Draw(std::uint64_t seed, std::uint64_t stream, std::uint64_t n)
+	{
+		// the 128-bit counter is the 64-bit index of the block and the stream, and each block gives two draws
+		const std::uint64_t block = n >> 1;
+		std::uint32_t x[4] = {std::uint32_t(block), std::uint32_t(block >> 32), std::uint32_t(stream), std::uint32_t(stream >> 32)};
+		std::uint32_t key[2] = {std::uint32_t(seed), std::uint32_t(seed >> 32)};
+
+		for (int round = 0; round < 10; ++round)
+		{
+			const std::uint64_t p0 = std::uint64_t(0xD2511F53u) * x[0];
+			const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u) * x[2];
+			const std::uint32_t y[4] = {std::uint32_t(p1 >> 32) ^ x[1] ^ key[0], std::uint32_t(p1), std::uint32_t(p0 >> 32) ^ x[3] ^ key[1], std::uint32_t(p0)};
+			for (int ii = 0; ii < 4; ++ii)
+				x[ii] = y[ii];
+			key[0] += 0x9E3779B9u;
+			key[1] += 0xBB67AE85u;
+		}
+
+		return (n & 1) ? (std::uint64_t(x[3]) << 32 | x[2]) : (std::uint64_t(x[1]) << 32 | x[0]);
+	}
+
+
+	RandomStream RandomStream::Substream(std::uint64_t index) const
+	{
+		return RandomStream(seed_, Mix(Mix(stream_ ^ Mix(position_)) + index) & ~thread_streams);
+	}
+
+
+
+	void SetRandomSeed(std::uint64_t seed)
+	{
+		master_seed = seed;
+		++seed_generation;
+	}
+
+
+	std::uint64_t RandomSeed()
+	{
+		return master_seed;
+	}
+
+
+	RandomStream& ThreadRandomStream()
+	{
+		if (!state.numbered)
+		{
+			state.number = num_threads_drawn++;
+			state.numbered = true;
+			state.generation = seed_generation;
+			state.stream = RandomStream(master_seed, thread_streams | state.number);
+		}
+		else if (!state.scoped && state.generation != seed_generation)
+		{
+			state.generation = seed_generation;
+			state.stream = RandomStream(master_seed, thread_streams | state.number);
+		}
+		return state.stream;
+	}
+
+
+
+	ScopedRandomStream::ScopedRandomStream(RandomStream const& stream) : previous_(ThreadRandomStream()), previous_scoped_(state.scoped)
+	{
+		state.stream = stream;
+		state.scoped = true;
+	}
+
+
+	ScopedRandomStream::~ScopedRandomStream()
+	{
+		state.stream = previous_;
+		state.scoped = previous_scoped_;
+	}
+
+} // namespace bertini
@@ -0,0 +1,692 @@
+//This file is part of Bertini 2.
+//
+//c_api.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//c_api.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with c_api.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/c_api.h"
+
+#include "bertini2/system_parsing.hpp"
+#include "bertini2/classic/parsing.hpp"
+#include "bertini2/system_cache.hpp"
+#include "bertini2/tracking/batch_tracker.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+
+using bertini::dbl;
+using bertini::mpfr;
+using bertini::mpfr_float;
+using bertini::Vec;
+using bertini::Mat;
+using bertini::BatchLanes;
+
+
+struct b2_system
+{
+	bertini::System system;
+
+	// workspace, kept between calls so that calls of the same sizes allocate nothing
+	BatchLanes inputs, function_values, jacobian, time_derivatives;
+	Vec<dbl> point_d, values_d;
+	Mat<dbl> jacobian_d;
+	Vec<mpfr> point_mp, values_mp;
+	Mat<mpfr> jacobian_mp;
+	mpfr time_mp;
+	mpfr_float real_part, imag_part;
+};
+
+
+struct b2_tracker
+{
+	explicit b2_tracker(b2_system & s) : system(s), batch(s.system), fallback(s.system)
+	{}
+
+	b2_system & system;
+	bertini::tracking::BatchTracker batch;
+	bertini::tracking::AMPTracker fallback;
+	bool adaptive_precision;
+	std::vector< Vec<dbl> > start_points;
+};
+
+
+namespace {
+
+	using bertini::tracking::SuccessCode;
+
+	static_assert(sizeof(mp_limb_t)==8, "the packed multiple precision format is of 64-bit limbs");
+	static_assert(static_cast<int>(SuccessCode::CycleNumTooHigh)==B2_PATH_CYCLE_NUM_TOO_HIGH, "b2_path_code must follow SuccessCode");
+
+	thread_local std::string last_error;
+
+	b2_status Fail(b2_status status, std::string const& message)
+	{
+		last_error = message;
+		return status;
+	}
+
+	/**
+	Thrown for arguments found bad only once their contents are read, such as packed reals, which Guard reports as B2_ERROR_ARGUMENT.
+	*/
+	class ArgumentError : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+	/**
+	Run the body of an entry point, turning whatever it throws into a status.
+	*/
+	template<typename F>
+	b2_status Guard(F f)
+	{
+		try
+		{
+			return f();
+		}
+		catch (std::bad_alloc const&)
+		{
+			return Fail(B2_ERROR_OUT_OF_MEMORY, "out of memory");
+		}
+		catch (ArgumentError const& e)
+		{
+			return Fail(B2_ERROR_ARGUMENT, e.what());
+		}
+		catch (std::exception const& e)
+		{
+			return Fail(B2_ERROR, e.what());
+		}
+		catch (...)
+		{
+			return Fail(B2_ERROR, "unknown error");
+		}
+	}
+
+
+	/**
+	The digits of a bertini precision carrying at least bits.
+	*/
+	unsigned Digits(unsigned bits)
+	{
+		return bertini::BitsToDigits(bits) + 1;
+	}
+
+	std::size_t ComplexBytes(unsigned bits)
+	{
+		return 2*b2_mp_real_bytes(bits);
+	}
+
+
+	dbl GetComplex(double const* p, std::size_t ii)
+	{
+		return dbl(p[2*ii], p[2*ii+1]);
+	}
+
+	void PutComplex(double* p, std::size_t ii, dbl const& z)
+	{
+		p[2*ii] = z.real();
+		p[2*ii+1] = z.imag();
+	}
+
+
+	bool ValidBits(unsigned bits)
+	{
+		return bits >= MPFR_PREC_MIN && static_cast<unsigned long>(bits) <= static_cast<unsigned long>(MPFR_PREC_MAX);
+	}
+
+	bool IsKind(std::int64_t kind)
+	{
+		for (std::int64_t k : {MPFR_NAN_KIND, MPFR_INF_KIND, MPFR_ZERO_KIND, MPFR_REGULAR_KIND})
+			if (kind==k || kind==-k)
+				return true;
+		return false;
+	}
+
+	/**
+	Point an mpfr_t at the limbs of a packed real, for reading.
+
+	\throws ArgumentError if the real is not one MPFR could have written at a precision of bits, so that MPFR is never handed one breaking its invariants.
+	*/
+	void ViewReal(unsigned char const* p, unsigned bits, mpfr_ptr view)
+	{
+		if (!ValidBits(bits))
+			throw ArgumentError("reading a packed real of " + std::to_string(bits) + " bits");
+
+		b2_mp_real header;
+		std::memcpy(&header, p, sizeof(header));
+		if (!IsKind(header.kind))
+			throw ArgumentError("reading a packed real of kind " + std::to_string(header.kind));
+
+		auto limbs = reinterpret_cast<mp_limb_t*>(const_cast<unsigned char*>(p + sizeof(header)));
+
+		// a regular number is normalized, its most significant bit set, and has an exponent in range
+		if (header.kind==MPFR_REGULAR_KIND || header.kind==-MPFR_REGULAR_KIND)
+		{
+			if (header.exponent < mpfr_get_emin() || header.exponent > mpfr_get_emax())
+				throw ArgumentError("reading a packed real with exponent " + std::to_string(header.exponent));
+			if (!(limbs[(bits + 63)/64 - 1] >> 63))
+				throw ArgumentError("reading a packed real which is not normalized");
+		}
+
+		mpfr_custom_init_set(view, static_cast<int>(header.kind), header.exponent, bits, limbs);
+	}
+
+	/**
+	Round x into the packed real at p, at a precision of bits, writing its limbs in place.
+	*/
+	template<typename SetFunction>
+	void PackReal(unsigned char* p, unsigned bits, SetFunction set)
+	{
+		mpfr_t view;
+		mpfr_custom_init_set(view, MPFR_ZERO_KIND, 0, bits, reinterpret_cast<mp_limb_t*>(p + sizeof(b2_mp_real)));
+		set(view);
+
+		b2_mp_real header;
+		header.kind = mpfr_custom_get_kind(view);
+		header.exponent = mpfr_regular_p(view) ? mpfr_custom_get_exp(view) : 0;
+		std::memcpy(p, &header, sizeof(header));
+	}
+
+	void PackReal(unsigned char* p, unsigned bits, mpfr_float const& x)
+	{
+		PackReal(p, bits, [&x](mpfr_ptr view){ mpfr_set(view, x.backend().data(), MPFR_RNDN); });
+	}
+
+	void PackReal(unsigned char* p, unsigned bits, double x)
+	{
+		PackReal(p, bits, [x](mpfr_ptr view){ mpfr_set_d(view, x, MPFR_RNDN); });
+	}
+
+	void UnpackComplex(b2_system & handle, void const* data, std::size_t ii, unsigned bits, mpfr & z)
+	{
+		auto p = static_cast<unsigned char const*>(data) + ii*ComplexBytes(bits);
+		mpfr_t view;
+		ViewReal(p, bits, view);
+		mpfr_set(handle.real_part.backend().data(), view, MPFR_RNDN);
+		ViewReal(p + b2_mp_real_bytes(bits), bits, view);
+		mpfr_set(handle.imag_part.backend().data(), view, MPFR_RNDN);
+		z.real(handle.real_part);
+		z.imag(handle.imag_part);
+	}
+
+	void PackComplex(void* data, std::size_t ii, unsigned bits, mpfr const& z)
+	{
+		auto p = static_cast<unsigned char*>(data) + ii*ComplexBytes(bits);
+		PackReal(p, bits, z.real());
+		PackReal(p + b2_mp_real_bytes(bits), bits, z.imag());
+	}
+
+	void PackComplex(void* data, std::size_t ii, unsigned bits, dbl const& z)
+	{
+		auto p = static_cast<unsigned char*>(data) + ii*ComplexBytes(bits);
+		PackReal(p, bits, z.real());
+		PackReal(p + b2_mp_real_bytes(bits), bits, z.imag());
+	}
+
+
+	b2_status CheckEvalArguments(b2_system const* handle, std::size_t num_points, void const* points, void const* times, void const* values)
+	{
+		if (!handle)
+			return Fail(B2_ERROR_ARGUMENT, "evaluating a null system");
+		if (num_points > 0 && (!points || !values))
+			return Fail(B2_ERROR_ARGUMENT, "evaluating at null points, or into null values");
+		if (num_points > 0 && handle->system.HavePathVariable() && !times)
+			return Fail(B2_ERROR_ARGUMENT, "evaluating a system with a path variable at null times");
+		return B2_OK;
+	}
+
+
+	/**
+	Each path variable and point into one batch, the last point filling the lanes past the end.
+	*/
+	void FillBatch(b2_system & handle, std::size_t first, std::size_t num_lanes, double const* points, double const* times)
+	{
+		const auto n = handle.system.NumVariables();
+		handle.inputs.Resize(n+1);
+		for (std::size_t lane = 0; lane < BatchLanes::Width; ++lane)
+		{
+			const auto p = first + std::min(lane, num_lanes-1);
+			for (std::size_t jj = 0; jj < n; ++jj)
+				handle.inputs.Set(jj, lane, GetComplex(points, p*n + jj));
+			handle.inputs.Set(n, lane, GetComplex(times, p));
+		}
+	}
+
+
+	void Report(b2_path_result & result, bertini::tracking::PathResult<dbl> const& from)
+	{
+		result.index = from.index;
+		result.code = static_cast<int32_t>(from.success_code);
+		result.bits = 53;
+		result.time_real = from.time.real();
+		result.time_imag = from.time.imag();
+	}
+
+	void Report(b2_path_result & result, bertini::tracking::PathResult<mpfr> const& from)
+	{
+		result.index = from.index;
+		result.code = static_cast<int32_t>(from.success_code);
+		result.bits = from.endpoint.size() > 0 ? static_cast<uint32_t>(mpfr_get_prec(from.endpoint(0).real().backend().data())) : 53;
+		result.time_real = static_cast<double>(from.time.real());
+		result.time_imag = static_cast<double>(from.time.imag());
+	}
+
+	dbl ToDouble(dbl const& z)
+	{
+		return z;
+	}
+
+	dbl ToDouble(mpfr const& z)
+	{
+		return dbl(static_cast<double>(z.real()), static_cast<double>(z.imag()));
+	}
+
+
+	/**
+	Track the paths of a tracker, handing each endpoint to store, with its index.
+	*/
+	template<typename StoreFunction>
+	b2_status Track(b2_tracker* tracker, std::size_t num_paths, double const* start_points, double start_time, double end_time, b2_path_result* results, void const* endpoints, StoreFunction store)
+	{
+		if (!tracker)
+			return Fail(B2_ERROR_ARGUMENT, "tracking with a null tracker");
+		if (num_paths > 0 && (!start_points || !results || !endpoints))
+			return Fail(B2_ERROR_ARGUMENT, "tracking from null start points, or into null results");
+
+		return Guard([&]
+		{
+			const auto n = tracker->system.system.NumVariables();
+			auto& points = tracker->start_points;
+			points.resize(num_paths);
+			for (std::size_t ii = 0; ii < num_paths; ++ii)
+			{
+				points[ii].resize(n);
+				for (std::size_t jj = 0; jj < n; ++jj)
+					points[ii](jj) = GetComplex(start_points, ii*n + jj);
+			}
+
+			auto report = [&](auto const& tracked)
+			{
+				for (std::size_t ii = 0; ii < num_paths; ++ii)
+				{
+					Report(results[ii], tracked[ii]);
+					for (std::size_t jj = 0; jj < n; ++jj)
+						store(ii*n + jj, tracked[ii].endpoint(jj));
+				}
+			};
+
+			if (tracker->adaptive_precision)
+				report(tracker->batch.TrackPaths(points, dbl(start_time), dbl(end_time), tracker->fallback));
+			else
+				report(tracker->batch.TrackPathsDouble(points, dbl(start_time), dbl(end_time)));
+			return B2_OK;
+		});
+	}
+
+} // re: namespace
+
+
+extern "C" {
+
+unsigned b2_api_version(void)
+{
+	return B2_C_API_VERSION;
+}
+
+
+char const* b2_last_error(void)
+{
+	return last_error.c_str();
+}
+
+
+size_t b2_mp_real_bytes(unsigned bits)
+{
+	return sizeof(b2_mp_real) + 8*((bits + 63)/64);
+}
+
+
+b2_status b2_mp_from_double(double x, unsigned bits, void* packed)
+{
+	if (!packed || !ValidBits(bits))
+		return Fail(B2_ERROR_ARGUMENT, "packing into a null buffer, or at a precision MPFR does not have");
+	PackReal(static_cast<unsigned char*>(packed), bits, x);
+	return B2_OK;
+}
+
+
+b2_status b2_mp_to_double(void const* packed, unsigned bits, double* x)
+{
+	if (!packed || !x)
+		return Fail(B2_ERROR_ARGUMENT, "unpacking from a null buffer, or into a null double");
+
+	return Guard([&]
+	{
+		mpfr_t view;
+		ViewReal(static_cast<unsigned char const*>(packed), bits, view);
+		*x = mpfr_get_d(view, MPFR_RNDN);
+		return B2_OK;
+	});
+}
+
+
+b2_status b2_system_from_file(char const* path, b2_system** system)
+{
+	if (!path || !system)
+		return Fail(B2_ERROR_ARGUMENT, "reading a system from a null path, or into a null handle");
+	if (!boost::filesystem::exists(path))
+		return Fail(B2_ERROR_FILE, std::string("input file ") + path + " does not exist");
+
+	return Guard([&]
+	{
+		const auto file = bertini::classic::PreprocessedInputFile::FromFile(path);
+		if (!file.Readable())
+			return Fail(B2_ERROR_PARSE, std::string("unable to split input file ") + path + " into its sections");
+
+		std::unique_ptr<b2_system> handle(new b2_system);
+		bertini::SystemParser<bertini::classic::PreprocessedInputFile::const_iterator> S;
+		if (!file.ParseInput(S, handle->system))
+			return Fail(B2_ERROR_PARSE, std::string("unable to parse the input section of ") + path);
+
+		*system = handle.release();
+		return B2_OK;
+	});
+}
+
+
+b2_status b2_system_from_bytes(void const* data, size_t size, b2_system** system)
+{
+	if (!data || !system)
+		return Fail(B2_ERROR_ARGUMENT, "reading a system from null bytes, or into a null handle");
+
+	return Guard([&]
+	{
+		std::unique_ptr<b2_system> handle(new b2_system);
+		bertini::SystemFromBytes(handle->system, static_cast<char const*>(data), size);
+		*system = handle.release();
+		return B2_OK;
+	});
+}
+
+
+b2_status b2_system_map_shared(char const* path, b2_system** system)
+{
+	if (!path || !system)
+		return Fail(B2_ERROR_ARGUMENT, "mapping a system from a null path, or into a null handle");
+	if (!boost::filesystem::exists(path))
+		return Fail(B2_ERROR_FILE, std::string("shared system file ") + path + " does not exist");
+
+	return Guard([&]
+	{
+		std::unique_ptr<b2_system> handle(new b2_system);
+		bertini::MapSharedSystem(handle->system, path);
+		*system = handle.release();
+		return B2_OK;
+	});
+}
+
+
+void b2_system_free(b2_system* system)
+{
+	delete system;
+}
+
+
+b2_status b2_system_compile(b2_system* system)
+{
+	if (!system)
+		return Fail(B2_ERROR_ARGUMENT, "compiling a null system");
+
+	return Guard([&]
+	{
+		system->system.UseForwardModeDifferentiation();
+		system->system.GetForwardModeProgram();
+		return B2_OK;
+	});
+}
+
+
+size_t b2_system_num_variables(b2_system const* system)
+{
+	return system ? system->system.NumVariables() : 0;
+}
+
+
+size_t b2_system_num_functions(b2_system const* system)
+{
+	return system ? system->system.NumTotalFunctions() : 0;
+}
+
+
+int b2_system_has_path_variable(b2_system const* system)
+{
+	return system && system->system.HavePathVariable();
+}
+
+
+b2_status b2_system_eval(b2_system* system, size_t num_points, double const* points, double const* times, double* values, double* jacobians)
+{
+	const auto status = CheckEvalArguments(system, num_points, points, times, values);
+	if (status!=B2_OK)
+		return status;
+
+	return Guard([&]
+	{
+		auto& handle = *system;
+		auto const& sys = handle.system;
+		const auto n = sys.NumVariables();
+		const auto m = sys.NumTotalFunctions();
+
+		if (sys.HavePathVariable())
+		{
+			for (std::size_t first = 0; first < num_points; first += BatchLanes::Width)
+			{
+				const auto num_lanes = std::min(BatchLanes::Width, num_points - first);
+				FillBatch(handle, first, num_lanes, points, times);
+				sys.EvalBatchWithDerivatives(handle.inputs, handle.function_values, handle.jacobian, handle.time_derivatives);
+
+				for (std::size_t lane = 0; lane < num_lanes; ++lane)
+				{
+					const auto p = first + lane;
+					for (std::size_t ii = 0; ii < m; ++ii)
+						PutComplex(values, p*m + ii, handle.function_values.Get(ii, lane));
+					if (jacobians)
+						for (std::size_t ii = 0; ii < m*n; ++ii)
+							PutComplex(jacobians, p*m*n + ii, handle.jacobian.Get(ii, lane));
+				}
+			}
+			return B2_OK;
+		}
+
+		handle.point_d.resize(n);
+		handle.values_d.resize(m);
+		handle.jacobian_d.resize(m, n);
+		for (std::size_t p = 0; p < num_points; ++p)
+		{
+			for (std::size_t jj = 0; jj < n; ++jj)
+				handle.point_d(jj) = GetComplex(points, p*n + jj);
+
+			if (jacobians)
+				sys.EvalAndJacobianInPlace(handle.values_d, handle.jacobian_d, handle.point_d);
+			else
+				sys.EvalInPlace(handle.values_d, handle.point_d);
+
+			for (std::size_t ii = 0; ii < m; ++ii)
+				PutComplex(values, p*m + ii, handle.values_d(ii));
+			if (jacobians)
+				for (std::size_t ii = 0; ii < m; ++ii)
+					for (std::size_t jj = 0; jj < n; ++jj)
+						PutComplex(jacobians, p*m*n + ii*n + jj, handle.jacobian_d(ii, jj));
+		}
+		return B2_OK;
+	});
+}
+
+
+b2_status b2_system_eval_mp(b2_system* system, unsigned bits, size_t num_points, void const* points, void const* times, void* values, void* jacobians)
+{
+	const auto status = CheckEvalArguments(system, num_points, points, times, values);
+	if (status!=B2_OK)
+		return status;
+	if (!ValidBits(bits))
+		return Fail(B2_ERROR_ARGUMENT, "evaluating at a precision MPFR does not have");
+
+	return Guard([&]
+	{
+		auto& handle = *system;
+		auto const& sys = handle.system;
+		const auto n = sys.NumVariables();
+		const auto m = sys.NumTotalFunctions();
+		const auto digits = Digits(bits);
+
+		if (sys.precision()!=digits)
+			sys.precision(digits);
+		handle.point_mp.resize(n);
+		handle.values_mp.resize(m);
+		handle.jacobian_mp.resize(m, n);
+		bertini::Precision(handle.point_mp, digits);
+		bertini::Precision(handle.values_mp, digits);
+		bertini::Precision(handle.jacobian_mp, digits);
+		handle.time_mp.precision(digits);
+		handle.real_part.precision(digits);
+		handle.imag_part.precision(digits);
+
+		for (std::size_t p = 0; p < num_points; ++p)
+		{
+			for (std::size_t jj = 0; jj < n; ++jj)
+				UnpackComplex(handle, points, p*n + jj, bits, handle.point_mp(jj));
+
+			if (sys.HavePathVariable())
+			{
+				UnpackComplex(handle, times, p, bits, handle.time_mp);
+				if (jacobians)
+					sys.EvalAndJacobianInPlace(handle.values_mp, handle.jacobian_mp, handle.point_mp, handle.time_mp);
+				else
+					sys.EvalInPlace(handle.values_mp, handle.point_mp, handle.time_mp);
+			}
+			else if (jacobians)
+				sys.EvalAndJacobianInPlace(handle.values_mp, handle.jacobian_mp, handle.point_mp);
+			else
+				sys.EvalInPlace(handle.values_mp, handle.point_mp);
+
+			for (std::size_t ii = 0; ii < m; ++ii)
+				PackComplex(values, p*m + ii, bits, handle.values_mp(ii));
+			if (jacobians)
+				for (std::size_t ii = 0; ii < m; ++ii)
+					for (std::size_t jj = 0; jj < n; ++jj)
+						PackComplex(jacobians, p*m*n + ii*n + jj, bits, handle.jacobian_mp(ii, jj));
+		}
+		return B2_OK;
+	});
+}
+
+
+void b2_tracker_default_settings(b2_tracker_settings* settings)
+{
+	if (!settings)
+		return;
+
+	const bertini::tracking::config::Stepping<double> stepping;
+	const bertini::tracking::config::Newton newton;
+	settings->tracking_tolerance = 1e-5;
+	settings->path_truncation_threshold = 1e5;
+	settings->initial_step_size = stepping.initial_step_size;
+	settings->min_step_size = stepping.min_step_size;
+	settings->max_step_size = stepping.max_step_size;
+	settings->max_num_steps = stepping.max_num_steps;
+	settings->max_num_newton_iterations = newton.max_num_newton_iterations;
+	settings->adaptive_precision = 1;
+}
+
+
+b2_status b2_tracker_create(b2_system* system, b2_tracker_settings const* settings, b2_tracker** tracker)
+{
+	if (!system || !tracker)
+		return Fail(B2_ERROR_ARGUMENT, "making a tracker of a null system, or into a null handle");
+
+	b2_tracker_settings given;
+	if (settings)
+		given = *settings;
+	else
+		b2_tracker_default_settings(&given);
+
+	return Guard([&]
+	{
+		using namespace bertini::tracking;
+
+		config::Stepping<double> stepping;
+		stepping.initial_step_size = given.initial_step_size;
+		stepping.min_step_size = given.min_step_size;
+		stepping.max_step_size = given.max_step_size;
+		stepping.max_num_steps = static_cast<unsigned>(given.max_num_steps);
+
+		config::Stepping<mpfr_float> stepping_mp;
+		stepping_mp.initial_step_size = given.initial_step_size;
+		stepping_mp.min_step_size = given.min_step_size;
+		stepping_mp.max_step_size = given.max_step_size;
+		stepping_mp.max_num_steps = stepping.max_num_steps;
+
+		config::Newton newton;
+		newton.max_num_newton_iterations = given.max_num_newton_iterations;
+
+		const auto AMP = config::AMPConfigFrom(system->system);
+
+		std::unique_ptr<b2_tracker> handle(new b2_tracker(*system));
+		handle->adaptive_precision = given.adaptive_precision!=0;
+		handle->batch.Setup(given.tracking_tolerance, given.path_truncation_threshold, stepping, newton);
+		handle->batch.PrecisionSetup(AMP);
+		handle->fallback.Setup(config::Predictor::Euler, mpfr_float(given.tracking_tolerance), mpfr_float(given.path_truncation_threshold), stepping_mp, newton);
+		handle->fallback.PrecisionSetup(AMP);
+
+		*tracker = handle.release();
+		return B2_OK;
+	});
+}
+
+
+void b2_tracker_free(b2_tracker* tracker)
+{
+	delete tracker;
+}
+
+
+b2_status b2_tracker_track(b2_tracker* tracker, size_t num_paths, double const* start_points, double start_time, double end_time, b2_path_result* results, double* endpoints)
+{
+	return Track(tracker, num_paths, start_points, start_time, end_time, results, endpoints,
+	             [endpoints](std::size_t ii, auto const& z){ PutComplex(endpoints, ii, ToDouble(z)); });
+}
+
+
+b2_status b2_tracker_track_mp(b2_tracker* tracker, size_t num_paths, double const* start_points, double start_time, double end_time, b2_path_result* results, unsigned bits, void* endpoints)
+{
+	if (!ValidBits(bits))
+		return Fail(B2_ERROR_ARGUMENT, "tracking into endpoints at a precision MPFR does not have");
+
+	return Track(tracker, num_paths, start_points, start_time, end_time, results, endpoints,
+	             [endpoints, bits](std::size_t ii, auto const& z){ PackComplex(endpoints, ii, bits, z); });
+}
+
+} // extern "C"
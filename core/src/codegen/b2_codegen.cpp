@@ -0,0 +1,159 @@
+//This file is part of Bertini 2.
+//
+//b2_codegen.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2_codegen.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2_codegen.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file b2_codegen.cpp
+
+\brief Writes a header of C++ kernels for the system of a classic input file, to compile into a program which solves that system, see code_generation.hpp.
+
+## Use
+
+\code
+b2-codegen [--name Name] [--digits 50] [--homogenize] [--output name.hpp] input_file
+\endcode
+
+The name of the struct of kernels defaults to the stem of the input file, made an identifier.  The constants are written to the given number of digits, which should be at least the highest precision at which the system will be evaluated.  With --homogenize, the kernels are of the homogenized system, and the GeneratedSystem of them homogenizes as it is made.  The header is written to standard output if no output file is given.
+
+In a Makefile, the header of a system is generated from its input as any other source,
+
+\code
+cyclic5.hpp: cyclic5.input
+	b2-codegen --name Cyclic5 --output $@ $<
+\endcode
+*/
+
+#include "bertini2/code_generation.hpp"
+#include "bertini2/classic/parsing.hpp"
+#include "bertini2/system_parsing.hpp"
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+
+
+namespace {
+
+	struct Options
+	{
+		std::string input_file;
+		std::string name;
+		std::string output;
+		unsigned digits = 50;
+		bool homogenize = false;
+	};
+
+
+	std::string IdentifierFrom(std::string const& text)
+	{
+		std::string name;
+		for (char c : text)
+			name += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+		if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+			name = "System_" + name;
+		return name;
+	}
+
+
+	Options ParseOptions(int argc, char** argv)
+	{
+		Options options;
+		for (int ii = 1; ii < argc; ++ii)
+		{
+			const std::string arg(argv[ii]);
+			auto value = [&]() -> std::string
+				{
+					if (ii+1 >= argc)
+						throw std::runtime_error("option " + arg + " needs a value");
+					return argv[++ii];
+				};
+
+			if (arg=="--name")
+				options.name = value();
+			else if (arg=="--digits")
+				options.digits = static_cast<unsigned>(std::stoul(value()));
+			else if (arg=="--homogenize")
+				options.homogenize = true;
+			else if (arg=="--output" || arg=="-o")
+				options.output = value();
+			else if (!arg.empty() && arg[0]=='-')
+				throw std::runtime_error("unknown option " + arg);
+			else if (options.input_file.empty())
+				options.input_file = arg;
+			else
+				throw std::runtime_error("more than one input file given");
+		}
+
+		if (options.input_file.empty())
+			throw std::runtime_error("no input file given.  usage: b2-codegen [--name Name] [--digits 50] [--homogenize] [--output name.hpp] input_file");
+		if (options.name.empty())
+			options.name = IdentifierFrom(boost::filesystem::path(options.input_file).stem().string());
+		return options;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	using namespace bertini;
+
+	try
+	{
+		const auto options = ParseOptions(argc, argv);
+		DefaultPrecision(options.digits);
+
+		const auto file = classic::PreprocessedInputFile::FromFile(options.input_file);
+		if (!file.Readable())
+			throw std::runtime_error("unable to split input file " + options.input_file + " into its config and input sections");
+
+		System sys;
+		SystemParser<classic::PreprocessedInputFile::const_iterator> parser;
+		if (!file.ParseInput(parser, sys))
+			throw std::runtime_error("unable to parse the input section of " + options.input_file);
+
+		if (options.homogenize)
+			sys.Homogenize();
+
+		const auto header = codegen::GenerateHeader(sys, file.Input().to_string(), options.name, options.digits);
+
+		if (options.output.empty())
+			std::cout << header;
+		else
+		{
+			std::ofstream out(options.output);
+			if (!out)
+				throw std::runtime_error("could not write " + options.output);
+			out << header;
+		}
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << "b2-codegen: " << e.what() << "\n";
+		return 1;
+	}
+
+	return 0;
+}
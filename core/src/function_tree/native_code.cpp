@@ -0,0 +1,537 @@
+//This file is part of Bertini 2.
+//
+//native_code.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//native_code.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with native_code.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/function_tree/native_code.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifdef BERTINI_ENABLE_LLVM_JIT
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Support/TargetSelect.h>
+#endif
+
+
+namespace bertini {
+
+	namespace jit {
+
+	namespace {
+
+#ifdef BERTINI_ENABLE_LLVM_JIT
+
+		constexpr size_t W = BatchLanes::Width;
+
+		// the tangent arithmetic is unrolled over the directions, so the code of a large program differentiated in many is too large to be worth compiling
+		constexpr size_t max_unrolled_operations = size_t(1) << 22;
+
+		// 64-bit FNV-1a, as InputHash, over the bytes of each value
+		void Mix(std::uint64_t & hash, std::uint64_t value)
+		{
+			for (int ii = 0; ii < 8; ++ii)
+			{
+				hash ^= (value >> (8*ii)) & 0xff;
+				hash *= 1099511628211ull;
+			}
+		}
+
+		std::uint64_t Hash(std::vector<SLPInstruction> const& instructions, std::vector<bool> const& has_tangent, size_t num_directions)
+		{
+			std::uint64_t hash = 14695981039346656037ull;
+			Mix(hash, num_directions);
+			Mix(hash, instructions.size());
+			for (auto const& instr : instructions)
+			{
+				Mix(hash, static_cast<std::uint64_t>(instr.operation));
+				Mix(hash, instr.result);
+				Mix(hash, instr.first);
+				Mix(hash, instr.second);
+			}
+			Mix(hash, has_tangent.size());
+			for (bool b : has_tangent)
+				Mix(hash, b);
+			return hash;
+		}
+
+		bool SameProgram(NativeKernels const& kernels, std::vector<SLPInstruction> const& instructions, std::vector<bool> const& has_tangent, size_t num_directions)
+		{
+			if (kernels.num_directions!=num_directions || kernels.has_tangent!=has_tangent || kernels.instructions.size()!=instructions.size())
+				return false;
+			for (size_t ii = 0; ii < instructions.size(); ++ii)
+			{
+				auto const& a = kernels.instructions[ii];
+				auto const& b = instructions[ii];
+				if (a.operation!=b.operation || a.result!=b.result || a.first!=b.first || a.second!=b.second)
+					return false;
+			}
+			return true;
+		}
+
+
+		// the compiled code of every program, for the life of the process.  a hash may be shared by more than one program, so each entry holds all those with it.
+		struct Cache
+		{
+			std::mutex mutex;
+			std::unordered_map<std::uint64_t, std::vector< std::shared_ptr<NativeKernels const> > > entries;
+		};
+
+		Cache& TheCache()
+		{
+			static Cache cache;
+			return cache;
+		}
+
+		// called by the compiled code, through their addresses, for the operations it does not inline
+		void CallValues(SLPInstruction const* instr, double * re, double * im)
+		{
+			ExecuteBatchInstruction(*instr, re, im);
+		}
+
+		void CallForward(NativeKernels const* kernels, SLPInstruction const* instr, double * re, double * im, double * tre, double * tim)
+		{
+			ExecuteBatchForwardInstruction(*instr, kernels->has_tangent, kernels->num_directions, re, im, tre, tim);
+		}
+
+
+		llvm::orc::LLJIT* TheJit()
+		{
+			static std::unique_ptr<llvm::orc::LLJIT> jit = []() -> std::unique_ptr<llvm::orc::LLJIT>
+			{
+				llvm::InitializeNativeTarget();
+				llvm::InitializeNativeTargetAsmPrinter();
+				auto made = llvm::orc::LLJITBuilder().create();
+				if (!made)
+				{
+					llvm::consumeError(made.takeError());
+					return nullptr;
+				}
+				return std::move(*made);
+			}();
+			return jit.get();
+		}
+
+
+		/**
+		The lanes of a complex register, as vectors of their real and imaginary parts.  Null parts are known to be zero, as the tangents of registers not depending on the variables are.
+		*/
+		struct Lanes
+		{
+			llvm::Value* re = nullptr;
+			llvm::Value* im = nullptr;
+
+			bool Zero() const
+			{
+				return re==nullptr;
+			}
+		};
+
+
+		/**
+		Emits the sweep over the function segment, in values alone or with tangents, into a function taking the lane-contiguous registers, and their tangents.
+
+		Each register is written once, so its value is an SSA value from the instruction computing it on, and is read from memory only if no instruction here computes it, as for the inputs and constants.  Every result is stored as well, for the outputs, and for the callbacks, which read their operands from memory, and whose results are read back from it.
+		*/
+		class SweepEmitter
+		{
+		public:
+
+			SweepEmitter(llvm::Function* function, NativeKernels const& kernels, bool forward) :
+				b_(llvm::BasicBlock::Create(function->getContext(), "entry", function)),
+				kernels_(kernels), forward_(forward),
+				double_(b_.getDoubleTy()),
+				vector_(llvm::FixedVectorType::get(double_, W)),
+				pointer_(llvm::PointerType::get(function->getContext(), 0)),
+				zero_(llvm::ConstantFP::get(vector_, 0.))
+			{
+				auto arg = function->arg_begin();
+				re_ = &*arg++;
+				im_ = &*arg++;
+				if (forward_)
+				{
+					tre_ = &*arg++;
+					tim_ = &*arg++;
+				}
+			}
+
+			void Emit()
+			{
+				for (auto const& instr : kernels_.instructions)
+				{
+					if (forward_ && kernels_.has_tangent[instr.result])
+						Forward(instr);
+					else
+						Value(instr);
+				}
+				b_.CreateRetVoid();
+			}
+
+		private:
+
+			static bool IsArithmetic(SLPOperation op)
+			{
+				return op==SLPOperation::Add || op==SLPOperation::Subtract || op==SLPOperation::Multiply || op==SLPOperation::Divide || op==SLPOperation::Negate;
+			}
+
+			llvm::Value* Address(llvm::Value* base, size_t offset)
+			{
+				return b_.CreateConstInBoundsGEP1_64(double_, base, offset);
+			}
+
+			llvm::Value* Load(llvm::Value* base, size_t offset)
+			{
+				return b_.CreateAlignedLoad(vector_, Address(base, offset), llvm::Align(alignof(double)));
+			}
+
+			void Store(llvm::Value* v, llvm::Value* base, size_t offset)
+			{
+				b_.CreateAlignedStore(v, Address(base, offset), llvm::Align(alignof(double)));
+			}
+
+			Lanes Get(size_t reg)
+			{
+				auto found = values_.find(reg);
+				if (found!=values_.end())
+					return found->second;
+				Lanes v;
+				v.re = Load(re_, reg*W);
+				v.im = Load(im_, reg*W);
+				values_[reg] = v;
+				return v;
+			}
+
+			void Set(size_t reg, Lanes const& v)
+			{
+				Store(v.re, re_, reg*W);
+				Store(v.im, im_, reg*W);
+				values_[reg] = v;
+			}
+
+			size_t TangentOffset(size_t reg, size_t k) const
+			{
+				return (reg*kernels_.num_directions + k)*W;
+			}
+
+			Lanes GetTangent(size_t reg, size_t k)
+			{
+				if (!kernels_.has_tangent[reg])
+					return Lanes();
+				auto found = tangents_.find(TangentOffset(reg, k));
+				if (found!=tangents_.end())
+					return found->second;
+				Lanes v;
+				v.re = Load(tre_, TangentOffset(reg, k));
+				v.im = Load(tim_, TangentOffset(reg, k));
+				tangents_[TangentOffset(reg, k)] = v;
+				return v;
+			}
+
+			void SetTangent(size_t reg, size_t k, Lanes v)
+			{
+				if (v.Zero())
+					v.re = v.im = zero_;
+				Store(v.re, tre_, TangentOffset(reg, k));
+				Store(v.im, tim_, TangentOffset(reg, k));
+				tangents_[TangentOffset(reg, k)] = v;
+			}
+
+			// a callback wrote the result, so it is read back from memory when next needed
+			void Forget(size_t reg)
+			{
+				values_.erase(reg);
+				if (forward_)
+					for (size_t k = 0; k < kernels_.num_directions; ++k)
+						tangents_.erase(TangentOffset(reg, k));
+			}
+
+
+			Lanes Sum(Lanes const& a, Lanes const& b)
+			{
+				if (a.Zero())
+					return b;
+				if (b.Zero())
+					return a;
+				return {b_.CreateFAdd(a.re, b.re), b_.CreateFAdd(a.im, b.im)};
+			}
+
+			Lanes Difference(Lanes const& a, Lanes const& b)
+			{
+				if (b.Zero())
+					return a;
+				if (a.Zero())
+					return Negation(b);
+				return {b_.CreateFSub(a.re, b.re), b_.CreateFSub(a.im, b.im)};
+			}
+
+			Lanes Negation(Lanes const& a)
+			{
+				if (a.Zero())
+					return a;
+				return {b_.CreateFNeg(a.re), b_.CreateFNeg(a.im)};
+			}
+
+			Lanes Product(Lanes const& a, Lanes const& b)
+			{
+				if (a.Zero() || b.Zero())
+					return Lanes();
+				return {b_.CreateFSub(b_.CreateFMul(a.re, b.re), b_.CreateFMul(a.im, b.im)),
+				        b_.CreateFAdd(b_.CreateFMul(a.re, b.im), b_.CreateFMul(a.im, b.re))};
+			}
+
+			// 1/b, as (br - i bi)/|b|^2
+			Lanes Reciprocal(Lanes const& b)
+			{
+				auto d = b_.CreateFAdd(b_.CreateFMul(b.re, b.re), b_.CreateFMul(b.im, b.im));
+				return {b_.CreateFDiv(b.re, d), b_.CreateFDiv(b_.CreateFNeg(b.im), d)};
+			}
+
+			Lanes Arithmetic(SLPOperation op, Lanes const& a, Lanes const& b)
+			{
+				switch (op)
+				{
+					case SLPOperation::Add:
+						return Sum(a, b);
+					case SLPOperation::Subtract:
+						return Difference(a, b);
+					case SLPOperation::Multiply:
+						return Product(a, b);
+					case SLPOperation::Negate:
+						return Negation(a);
+					default:
+					{
+						// as the interpreter, (a conj(b))/|b|^2
+						auto d = b_.CreateFAdd(b_.CreateFMul(b.re, b.re), b_.CreateFMul(b.im, b.im));
+						auto nr = b_.CreateFAdd(b_.CreateFMul(a.re, b.re), b_.CreateFMul(a.im, b.im));
+						auto ni = b_.CreateFSub(b_.CreateFMul(a.im, b.re), b_.CreateFMul(a.re, b.im));
+						return {b_.CreateFDiv(nr, d), b_.CreateFDiv(ni, d)};
+					}
+				}
+			}
+
+
+			llvm::Value* Constant(void const* p)
+			{
+				return b_.CreateIntToPtr(b_.getInt64(reinterpret_cast<std::uintptr_t>(p)), pointer_);
+			}
+
+			void Value(SLPInstruction const& instr)
+			{
+				if (IsArithmetic(instr.operation))
+				{
+					const bool unary = instr.operation==SLPOperation::Negate;
+					Set(instr.result, Arithmetic(instr.operation, Get(instr.first), unary ? Lanes() : Get(instr.second)));
+					return;
+				}
+
+				auto type = llvm::FunctionType::get(b_.getVoidTy(), {pointer_, pointer_, pointer_}, false);
+				b_.CreateCall(type, Constant(reinterpret_cast<void const*>(&CallValues)), {Constant(&instr), re_, im_});
+				Forget(instr.result);
+				if (instr.operation==SLPOperation::SinCos)
+					Forget(instr.second);
+			}
+
+			void Forward(SLPInstruction const& instr)
+			{
+				if (!IsArithmetic(instr.operation))
+				{
+					auto type = llvm::FunctionType::get(b_.getVoidTy(), {pointer_, pointer_, pointer_, pointer_, pointer_, pointer_}, false);
+					b_.CreateCall(type, Constant(reinterpret_cast<void const*>(&CallForward)), {Constant(&kernels_), Constant(&instr), re_, im_, tre_, tim_});
+					Forget(instr.result);
+					if (instr.operation==SLPOperation::SinCos)
+						Forget(instr.second);
+					return;
+				}
+
+				const bool unary = instr.operation==SLPOperation::Negate;
+				const Lanes a = Get(instr.first);
+				const Lanes b = unary ? Lanes() : Get(instr.second);
+				const Lanes z = Arithmetic(instr.operation, a, b);
+				Set(instr.result, z);
+
+				// d(a/b) = (da - (a/b) db) / b
+				const Lanes b_inverse = instr.operation==SLPOperation::Divide ? Reciprocal(b) : Lanes();
+
+				for (size_t k = 0; k < kernels_.num_directions; ++k)
+				{
+					const Lanes da = GetTangent(instr.first, k);
+					const Lanes db = unary ? Lanes() : GetTangent(instr.second, k);
+					switch (instr.operation)
+					{
+						case SLPOperation::Multiply:
+							SetTangent(instr.result, k, Sum(Product(da, b), Product(a, db)));
+							break;
+						case SLPOperation::Divide:
+							SetTangent(instr.result, k, Product(Difference(da, Product(z, db)), b_inverse));
+							break;
+						default:
+							SetTangent(instr.result, k, Arithmetic(instr.operation, da, db));
+					}
+				}
+			}
+
+
+			llvm::IRBuilder<> b_;
+			NativeKernels const& kernels_;
+			const bool forward_;
+
+			llvm::Type* double_;
+			llvm::Type* vector_;
+			llvm::Type* pointer_;
+			llvm::Value* zero_;
+
+			llvm::Value* re_ = nullptr;
+			llvm::Value* im_ = nullptr;
+			llvm::Value* tre_ = nullptr;
+			llvm::Value* tim_ = nullptr;
+
+			std::unordered_map<size_t, Lanes> values_; ///< By register.
+			std::unordered_map<size_t, Lanes> tangents_; ///< By offset into the tangents.
+		};
+
+
+		template<typename KernelType>
+		KernelType Lookup(llvm::orc::LLJIT & jit, std::string const& name)
+		{
+			auto found = jit.lookup(name);
+			if (!found)
+			{
+				llvm::consumeError(found.takeError());
+				return nullptr;
+			}
+#if LLVM_VERSION_MAJOR >= 17
+			return found->template toPtr<KernelType>();
+#else
+			return reinterpret_cast<KernelType>(static_cast<std::uintptr_t>(found->getAddress()));
+#endif
+		}
+
+
+		bool Build(NativeKernels & kernels)
+		{
+			static std::atomic<std::uint64_t> next_id(0);
+
+			auto jit = TheJit();
+			if (!jit)
+				return false;
+
+			auto context = std::make_unique<llvm::LLVMContext>();
+			auto module = std::make_unique<llvm::Module>("bertini_straight_line_program", *context);
+			module->setDataLayout(jit->getDataLayout());
+
+			const std::string id = std::to_string(next_id++);
+			const std::string values_name = "bertini_batch_values_" + id;
+			const std::string forward_name = "bertini_batch_forward_" + id;
+
+			auto pointer = llvm::PointerType::get(*context, 0);
+			auto void_type = llvm::Type::getVoidTy(*context);
+			auto values = llvm::Function::Create(llvm::FunctionType::get(void_type, {pointer, pointer}, false),
+			                                     llvm::Function::ExternalLinkage, values_name, module.get());
+			auto forward = llvm::Function::Create(llvm::FunctionType::get(void_type, {pointer, pointer, pointer, pointer}, false),
+			                                      llvm::Function::ExternalLinkage, forward_name, module.get());
+
+			// the real and imaginary parts, and their tangents, are separate arrays
+			for (unsigned ii = 0; ii < values->arg_size(); ++ii)
+				values->addParamAttr(ii, llvm::Attribute::NoAlias);
+			for (unsigned ii = 0; ii < forward->arg_size(); ++ii)
+				forward->addParamAttr(ii, llvm::Attribute::NoAlias);
+
+			SweepEmitter(values, kernels, false).Emit();
+			SweepEmitter(forward, kernels, true).Emit();
+
+			if (llvm::verifyModule(*module))
+				return false;
+
+			if (auto error = jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context))))
+			{
+				llvm::consumeError(std::move(error));
+				return false;
+			}
+
+			kernels.values = Lookup<BatchValuesKernel>(*jit, values_name);
+			kernels.forward = Lookup<BatchForwardKernel>(*jit, forward_name);
+			return kernels.values && kernels.forward;
+		}
+
+#endif // BERTINI_ENABLE_LLVM_JIT
+
+	} // re: namespace
+
+
+
+	bool Available()
+	{
+#ifdef BERTINI_ENABLE_LLVM_JIT
+		std::lock_guard<std::mutex> lock(TheCache().mutex);
+		return TheJit()!=nullptr;
+#else
+		return false;
+#endif
+	}
+
+
+	std::shared_ptr<NativeKernels const> Compile(std::vector<SLPInstruction> const& instructions, std::vector<bool> const& has_tangent, size_t num_directions)
+	{
+#ifdef BERTINI_ENABLE_LLVM_JIT
+		if (instructions.size()*(num_directions+1) > max_unrolled_operations)
+			return nullptr;
+
+		const auto hash = Hash(instructions, has_tangent, num_directions);
+
+		auto& cache = TheCache();
+		std::lock_guard<std::mutex> lock(cache.mutex);
+
+		auto& entry = cache.entries[hash];
+		for (auto const& kernels : entry)
+			if (SameProgram(*kernels, instructions, has_tangent, num_directions))
+				return kernels;
+
+		// the code refers to the instructions here by address, so they are copied in before it is emitted, and never moved
+		auto kernels = std::make_shared<NativeKernels>();
+		kernels->hash = hash;
+		kernels->instructions = instructions;
+		kernels->has_tangent = has_tangent;
+		kernels->num_directions = num_directions;
+		if (!Build(*kernels))
+			return nullptr;
+
+		entry.push_back(kernels);
+		return kernels;
+#else
+		(void)instructions; (void)has_tangent; (void)num_directions;
+		return nullptr;
+#endif
+	}
+
+	} // namespace jit
+
+} // namespace bertini
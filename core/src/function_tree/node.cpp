@@ -26,6 +26,9 @@
 
 #include "function_tree.hpp"
 
+#include <unordered_map>
+#include <utility>
+
 BOOST_CLASS_EXPORT(bertini::node::Variable)
 BOOST_CLASS_EXPORT(bertini::node::Differential)
 
@@ -54,3 +57,148 @@ BOOST_CLASS_EXPORT(bertini::node::PowerOperator)
 BOOST_CLASS_EXPORT(bertini::node::IntegerPowerOperator)
 BOOST_CLASS_EXPORT(bertini::node::SqrtOperator)
 BOOST_CLASS_EXPORT(bertini::node::ExpOperator)
+
+
+
+namespace bertini {
+namespace node {
+
+	namespace {
+		using DerivativeTable = std::unordered_map<Node const*, std::shared_ptr<Node>>;
+
+		// the table of the outermost open memo on this thread, if any
+		thread_local DerivativeTable* current_derivatives = nullptr;
+
+
+		// a node, and the variable or variable group with respect to which it was queried
+		using StructureKey = std::pair<Node const*, void const*>;
+
+		struct StructureKeyHash
+		{
+			std::size_t operator()(StructureKey const& k) const
+			{
+				return std::hash<Node const*>()(k.first) ^ (std::hash<void const*>()(k.second) << 1);
+			}
+		};
+
+		template<typename T>
+		using StructureMap = std::unordered_map<StructureKey, T, StructureKeyHash>;
+
+		struct StructureTable
+		{
+			StructureMap<int> degree_in_variable;
+			StructureMap<int> degree_in_group;
+			StructureMap<std::vector<int>> multidegree;
+			StructureMap<bool> homogeneous_in_variable;
+			StructureMap<bool> homogeneous_in_group;
+		};
+
+		// the table of the outermost open structure memo on this thread, if any
+		thread_local StructureTable* current_structure = nullptr;
+
+		// look up a result, computing and storing it if absent
+		template<typename T, typename F>
+		T Memoized(StructureMap<T>& table, StructureKey const& key, F compute)
+		{
+			auto found = table.find(key);
+			if (found!=table.end())
+				return found->second;
+
+			T result = compute();
+			table.emplace(key, result);
+			return result;
+		}
+	}
+
+
+	DifferentiationMemo::DifferentiationMemo() : is_outermost_(current_derivatives==nullptr)
+	{
+		if (is_outermost_)
+			current_derivatives = new DerivativeTable;
+	}
+
+	DifferentiationMemo::~DifferentiationMemo()
+	{
+		if (is_outermost_)
+		{
+			delete current_derivatives;
+			current_derivatives = nullptr;
+		}
+	}
+
+
+	std::shared_ptr<Node> Node::Differentiate() const
+	{
+		DifferentiationMemo memo;
+
+		auto found = current_derivatives->find(this);
+		if (found!=current_derivatives->end())
+			return found->second;
+
+		auto derivative = FreshDifferentiate();
+		current_derivatives->emplace(this, derivative);
+		return derivative;
+	}
+
+
+
+	StructureMemo::StructureMemo() : is_outermost_(current_structure==nullptr)
+	{
+		if (is_outermost_)
+			current_structure = new StructureTable;
+	}
+
+	StructureMemo::~StructureMemo()
+	{
+		if (is_outermost_)
+		{
+			delete current_structure;
+			current_structure = nullptr;
+		}
+	}
+
+
+	int Node::Degree(std::shared_ptr<Variable> const& v) const
+	{
+		StructureMemo memo;
+		return Memoized(current_structure->degree_in_variable, {this, v.get()},
+		                [&]{return FreshDegree(v);});
+	}
+
+	int Node::Degree(VariableGroup const& vars) const
+	{
+		StructureMemo memo;
+		return Memoized(current_structure->degree_in_group, {this, &vars},
+		                [&]{return FreshDegree(vars);});
+	}
+
+	std::vector<int> Node::MultiDegree(VariableGroup const& vars) const
+	{
+		StructureMemo memo;
+		return Memoized(current_structure->multidegree, {this, &vars},
+		                [&]{return FreshMultiDegree(vars);});
+	}
+
+	bool Node::IsHomogeneous(std::shared_ptr<Variable> const& v) const
+	{
+		StructureMemo memo;
+		return Memoized(current_structure->homogeneous_in_variable, {this, v.get()},
+		                [&]{return FreshIsHomogeneous(v);});
+	}
+
+	bool Node::IsHomogeneous(VariableGroup const& vars) const
+	{
+		StructureMemo memo;
+		return Memoized(current_structure->homogeneous_in_group, {this, &vars},
+		                [&]{return FreshIsHomogeneous(vars);});
+	}
+
+
+	std::mutex& SharedConstantsMutex()
+	{
+		static std::mutex m;
+		return m;
+	}
+
+} // namespace node
+} // namespace bertini
@@ -61,7 +61,7 @@ namespace bertini{
 			target << ")";
 		}
 		
-		std::shared_ptr<Node> SumOperator::Differentiate() const
+		std::shared_ptr<Node> SumOperator::FreshDifferentiate() const
 		{
 			unsigned int counter = 0;
 			std::shared_ptr<Node> ret_sum = Zero();
@@ -79,7 +79,7 @@ namespace bertini{
 				
 				counter++;
 				if (counter==1)
-					ret_sum = std::make_shared<SumOperator>(temp_node,children_sign_[ii]);
+					ret_sum = MakeNode<SumOperator>(temp_node,children_sign_[ii]);
 				else
 					std::dynamic_pointer_cast<SumOperator>(ret_sum)->AddChild(temp_node,children_sign_[ii]);
 				
@@ -91,7 +91,7 @@ namespace bertini{
 		
 		
 		
-		int SumOperator::Degree(std::shared_ptr<Variable> const& v) const
+		int SumOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 		{
 			int deg = 0;
 			
@@ -106,7 +106,7 @@ namespace bertini{
 			return deg;
 		}
 		
-		int SumOperator::Degree(VariableGroup const& vars) const 
+		int SumOperator::FreshDegree(VariableGroup const& vars) const 
 		{
 			auto deg = 0;
 			for (auto iter = children_.begin(); iter!=children_.end(); iter++)
@@ -123,7 +123,7 @@ namespace bertini{
 		}
 
 
-		std::vector<int> SumOperator::MultiDegree(VariableGroup const& vars) const
+		std::vector<int> SumOperator::FreshMultiDegree(VariableGroup const& vars) const
 		{
 			std::vector<int> deg(vars.size(),0);
 			for (auto iter : children_)
@@ -175,12 +175,12 @@ namespace bertini{
 					// hold the child temporarily.
 					if (degree_deficiency==1)
 					{
-						std::shared_ptr<Node> M = std::make_shared<MultOperator>(homvar,std::dynamic_pointer_cast<Node>(*iter));
+						std::shared_ptr<Node> M = MakeNode<MultOperator>(homvar,std::dynamic_pointer_cast<Node>(*iter));
 						swap(*iter,M);
 					}
 					else{
-						std::shared_ptr<Node> P = std::make_shared<IntegerPowerOperator>(std::dynamic_pointer_cast<Node>(homvar),degree_deficiency);
-						std::shared_ptr<Node> M = std::make_shared<MultOperator>(P,std::dynamic_pointer_cast<Node>(*iter));
+						std::shared_ptr<Node> P = MakeNode<IntegerPowerOperator>(std::dynamic_pointer_cast<Node>(homvar),degree_deficiency);
+						std::shared_ptr<Node> M = MakeNode<MultOperator>(P,std::dynamic_pointer_cast<Node>(*iter));
 						swap(*iter,M);
 					}
 					
@@ -191,7 +191,7 @@ namespace bertini{
 		}
 
 
-		bool SumOperator::IsHomogeneous(std::shared_ptr<Variable> const& v) const
+		bool SumOperator::FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const
 		{
 			
 			for (auto iter : children_)
@@ -218,7 +218,7 @@ namespace bertini{
 			return true;
 		}
 
-		bool SumOperator::IsHomogeneous(VariableGroup const& v) const
+		bool SumOperator::FreshIsHomogeneous(VariableGroup const& v) const
 		{
 			
 			for (auto iter : children_)
@@ -334,9 +334,9 @@ namespace bertini{
 			target << ")";
 		}
 		
-		std::shared_ptr<Node> NegateOperator::Differentiate() const
+		std::shared_ptr<Node> NegateOperator::FreshDifferentiate() const
 		{
-			return std::make_shared<NegateOperator>(child_->Differentiate());
+			return MakeNode<NegateOperator>(child_->Differentiate());
 		}
 		
 		dbl NegateOperator::FreshEval_d(std::shared_ptr<Variable> const& diff_variable) const
@@ -412,7 +412,7 @@ namespace bertini{
 		}
 		
 		
-		std::shared_ptr<Node> MultOperator::Differentiate() const
+		std::shared_ptr<Node> MultOperator::FreshDifferentiate() const
 		{
 			std::shared_ptr<Node> ret_sum = node::Zero();
 			
@@ -431,7 +431,7 @@ namespace bertini{
 				// no, the term's derivative is not 0.  
 				
 				// create the product of the remaining terms
-				auto term_ii = std::make_shared<MultOperator>(local_derivative);
+				auto term_ii = MakeNode<MultOperator>(local_derivative);
 				for (int jj = 0; jj < children_.size(); ++jj)
 				{
 					if(jj != ii)
@@ -451,7 +451,7 @@ namespace bertini{
 				
 				term_counter++;
 				if (term_counter==1)
-					ret_sum = std::make_shared<SumOperator>(term_ii,children_mult_or_div_[ii]);
+					ret_sum = MakeNode<SumOperator>(term_ii,children_mult_or_div_[ii]);
 				else
 					std::dynamic_pointer_cast<SumOperator>(ret_sum)->AddChild(term_ii,children_mult_or_div_[ii]);
 			} // re: for ii
@@ -462,7 +462,7 @@ namespace bertini{
 		
 		
 		
-		int MultOperator::Degree(std::shared_ptr<Variable> const& v) const
+		int MultOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 		{
 			int deg = 0;
 			for (auto iter = children_.begin(); iter!= children_.end(); iter++)
@@ -493,7 +493,7 @@ namespace bertini{
 		}
 		
 
-		int MultOperator::Degree(VariableGroup const& vars) const 
+		int MultOperator::FreshDegree(VariableGroup const& vars) const 
 		{
 			
 			auto deg = 0;
@@ -514,7 +514,7 @@ namespace bertini{
 			return deg;
 		}
 
-		std::vector<int> MultOperator::MultiDegree(VariableGroup const& vars) const
+		std::vector<int> MultOperator::FreshMultiDegree(VariableGroup const& vars) const
 		{
 			std::vector<int> deg(vars.size(),0);
 			for (auto iter : children_)
@@ -540,7 +540,7 @@ namespace bertini{
 		}
 
 
-		bool MultOperator::IsHomogeneous(std::shared_ptr<Variable> const& v) const
+		bool MultOperator::FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const
 		{
 			// the only hope this has of being homogeneous, is that each factor is homogeneous
 			for (auto iter : children_)
@@ -553,7 +553,7 @@ namespace bertini{
 			return true;
 		}
 		
-		bool MultOperator::IsHomogeneous(VariableGroup const& v) const
+		bool MultOperator::FreshIsHomogeneous(VariableGroup const& v) const
 		{
 			// the only hope this has of being homogeneous, is that each factor is homogeneous
 			for (auto iter : children_)
@@ -602,8 +602,17 @@ namespace bertini{
 		
 		void MultOperator::FreshEval_mp(mpfr& evaluation_value, std::shared_ptr<Variable> const& diff_variable) const
 		{
-			evaluation_value.SetOne();
-			for(int ii = 0; ii < children_.size(); ++ii)
+			// the first factor, if multiplied, goes straight into the result, saving a multiplication by one
+			int first = 0;
+			if (!children_.empty() && children_mult_or_div_[0])
+			{
+				children_[0]->EvalInPlace<mpfr>(evaluation_value, diff_variable);
+				first = 1;
+			}
+			else
+				evaluation_value.SetOne();
+
+			for(int ii = first; ii < children_.size(); ++ii)
 			{
 				if(children_mult_or_div_[ii])
 				{
@@ -640,18 +649,18 @@ namespace bertini{
 		}
 		
 		
-		std::shared_ptr<Node> PowerOperator::Differentiate() const
+		std::shared_ptr<Node> PowerOperator::FreshDifferentiate() const
 		{
 			
-			auto exp_minus_one = std::make_shared<SumOperator>(exponent_, true, std::make_shared<Float>("1.0"),false);
-			auto ret_mult = std::make_shared<MultOperator>(base_->Differentiate());
+			auto exp_minus_one = MakeNode<SumOperator>(exponent_, true, MakeNode<Float>("1.0"),false);
+			auto ret_mult = MakeNode<MultOperator>(base_->Differentiate());
 			ret_mult->AddChild(exponent_);
-			ret_mult->AddChild(std::make_shared<PowerOperator>(base_, exp_minus_one));
+			ret_mult->AddChild(MakeNode<PowerOperator>(base_, exp_minus_one));
 			return ret_mult;
 		}
 		
 		
-		int PowerOperator::Degree(std::shared_ptr<Variable> const& v) const
+		int PowerOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 		{
 			
 			auto base_deg = base_->Degree(v);
@@ -697,7 +706,7 @@ namespace bertini{
 			}
 		}
 		
-		int PowerOperator::Degree(VariableGroup const& vars) const
+		int PowerOperator::FreshDegree(VariableGroup const& vars) const
 		{
 			auto multideg = MultiDegree(vars);
 			auto deg = 0;
@@ -711,7 +720,7 @@ namespace bertini{
 		}
 
 
-		std::vector<int> PowerOperator::MultiDegree(VariableGroup const& vars) const
+		std::vector<int> PowerOperator::FreshMultiDegree(VariableGroup const& vars) const
 		{
 			std::vector<int> deg(vars.size(),0);
 			for (auto iter = vars.begin(); iter!= vars.end(); ++iter)
@@ -735,7 +744,7 @@ namespace bertini{
 			}
 		}
 
-		bool PowerOperator::IsHomogeneous(std::shared_ptr<Variable> const& v) const
+		bool PowerOperator::FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const
 		{
 			// the only hope this has of being homogeneous, is that the degree of the exponent is 0 (it's constant), and that it's an integer
 			if (exponent_->Degree(v)==0)
@@ -750,7 +759,7 @@ namespace bertini{
 		}
 
 
-		bool PowerOperator::IsHomogeneous(VariableGroup const& v) const
+		bool PowerOperator::FreshIsHomogeneous(VariableGroup const& v) const
 		{
 			// the only hope this has of being homogeneous, is that the degree of the exponent is 0 (it's constant), and that it's an integer
 			if (exponent_->Degree(v)==0)
@@ -822,27 +831,27 @@ namespace bertini{
 		}
 		
 		
-		std::shared_ptr<Node> IntegerPowerOperator::Differentiate() const
+		std::shared_ptr<Node> IntegerPowerOperator::FreshDifferentiate() const
 		{
 			
 			if (exponent_==0)
-				return std::make_shared<Integer>(0);
+				return MakeNode<Integer>(0);
 			else if (exponent_==1)
 				return child_->Differentiate();
 			else if (exponent_==2){
-				auto M = std::make_shared<MultOperator>(std::make_shared<Integer>(2), child_);
+				auto M = MakeNode<MultOperator>(MakeNode<Integer>(2), child_);
 				M->AddChild(child_->Differentiate());
 				return M;
 			}
 			else{
-				auto M = std::make_shared<MultOperator>(std::make_shared<Integer>(exponent_),
-														std::make_shared<IntegerPowerOperator>(child_, exponent_-1) );
+				auto M = MakeNode<MultOperator>(MakeNode<Integer>(exponent_),
+														MakeNode<IntegerPowerOperator>(child_, exponent_-1) );
 				M->AddChild(child_->Differentiate());
 				return M;
 			}
 		}
 		
-		int IntegerPowerOperator::Degree(std::shared_ptr<Variable> const& v) const
+		int IntegerPowerOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 		{
 			auto base_deg = child_->Degree(v);
 			if (base_deg<0)
@@ -878,15 +887,15 @@ namespace bertini{
 		
 		
 		
-		std::shared_ptr<Node> SqrtOperator::Differentiate() const
+		std::shared_ptr<Node> SqrtOperator::FreshDifferentiate() const
 		{
-			auto ret_mult = std::make_shared<MultOperator>(std::make_shared<PowerOperator>(child_, std::make_shared<Rational>(mpq_rational(-1,2),0)));
+			auto ret_mult = MakeNode<MultOperator>(MakeNode<PowerOperator>(child_, MakeNode<Rational>(mpq_rational(-1,2),0)));
 			ret_mult->AddChild(child_->Differentiate());
-			ret_mult->AddChild(std::make_shared<Rational>(mpq_rational(1,2),0));
+			ret_mult->AddChild(MakeNode<Rational>(mpq_rational(1,2),0));
 			return ret_mult;
 		}
 		
-		int SqrtOperator::Degree(std::shared_ptr<Variable> const& v) const
+		int SqrtOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 		{
 			if (child_->Degree(v)==0)
 			{
@@ -949,12 +958,12 @@ namespace bertini{
 			target << ")";
 		}
 		
-		std::shared_ptr<Node> ExpOperator::Differentiate() const
+		std::shared_ptr<Node> ExpOperator::FreshDifferentiate() const
 		{
 			return exp(child_)*child_->Differentiate();
 		}
 		
-		int ExpOperator::Degree(std::shared_ptr<Variable> const& v) const
+		int ExpOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 		{
 			if (child_->Degree(v)==0)
 			{
@@ -1012,12 +1021,12 @@ namespace bertini{
 			target << ")";
 		}
 		
-		std::shared_ptr<Node> LogOperator::Differentiate() const
+		std::shared_ptr<Node> LogOperator::FreshDifferentiate() const
 		{
-			return std::make_shared<MultOperator>(child_,false,child_->Differentiate(),true);
+			return MakeNode<MultOperator>(child_,false,child_->Differentiate(),true);
 		}
 		
-		int LogOperator::Degree(std::shared_ptr<Variable> const& v) const
+		int LogOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 		{
 			if (child_->Degree(v)==0)
 			{
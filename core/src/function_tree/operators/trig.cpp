@@ -30,7 +30,7 @@
 namespace bertini {
 namespace node{	
 
-	int TrigOperator::Degree(std::shared_ptr<Variable> const& v) const
+	int TrigOperator::FreshDegree(std::shared_ptr<Variable> const& v) const
 	{
 		if (child_->Degree(v)==0)
 		{
@@ -54,7 +54,7 @@ namespace node{
 
 
 
-	std::shared_ptr<Node> SinOperator::Differentiate() const
+	std::shared_ptr<Node> SinOperator::FreshDifferentiate() const
 	{
 		return cos(child_) * child_->Differentiate();
 	}
@@ -70,7 +70,7 @@ namespace node{
 	}
 
 
-	std::shared_ptr<Node> ArcSinOperator::Differentiate() const
+	std::shared_ptr<Node> ArcSinOperator::FreshDifferentiate() const
 	{
 		return child_->Differentiate()/sqrt(1-pow(child_,2));
 	}
@@ -85,7 +85,7 @@ namespace node{
 		target << ")";
 	}
 	
-	std::shared_ptr<Node> CosOperator::Differentiate() const
+	std::shared_ptr<Node> CosOperator::FreshDifferentiate() const
 	{
 		return -sin(child_) * child_->Differentiate();
 	}
@@ -107,7 +107,7 @@ namespace node{
 
 
 
-	std::shared_ptr<Node> ArcCosOperator::Differentiate() const
+	std::shared_ptr<Node> ArcCosOperator::FreshDifferentiate() const
 	{
 		return -child_->Differentiate()/sqrt(1-pow(child_,2));
 	}
@@ -126,7 +126,7 @@ namespace node{
 	}
 
 
-	std::shared_ptr<Node> TanOperator::Differentiate() const
+	std::shared_ptr<Node> TanOperator::FreshDifferentiate() const
 	{
 		return child_->Differentiate() /  pow(cos(child_),2);
 	}
@@ -145,7 +145,7 @@ namespace node{
 		
 
 
-	std::shared_ptr<Node> ArcTanOperator::Differentiate() const
+	std::shared_ptr<Node> ArcTanOperator::FreshDifferentiate() const
 	{
 		return child_->Differentiate() / (1 + pow(child_,2));
 	}
@@ -0,0 +1,560 @@
+//This file is part of Bertini 2.
+//
+//polynomial_system.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polynomial_system.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polynomial_system.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "function_tree/polynomial_system.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+#include <boost/type_index.hpp>
+
+
+namespace bertini {
+
+	using namespace node;
+	namespace exact = node::detail;
+
+	namespace {
+
+		using ExactValue = exact::ExactValue;
+
+		/**
+		A monomial, as pairs of the index of an input and its exponent, sorted by input.
+		*/
+		using Monomial = std::vector< std::pair<size_t, unsigned> >;
+
+		/**
+		The coefficient of a monomial is exact + inexact, where inexact is a tree for the constants which cannot be folded exactly, or nullptr if there are none.
+		*/
+		struct Coefficient
+		{
+			ExactValue exact;
+			std::shared_ptr<Node> inexact;
+		};
+
+		using Polynomial = std::map<Monomial, Coefficient>;
+
+
+		bool IsZeroCoefficient(Coefficient const& c)
+		{
+			return !c.inexact && exact::IsZero(c.exact);
+		}
+
+		// a*n
+		std::shared_ptr<Node> Scaled(ExactValue const& a, std::shared_ptr<Node> const& n)
+		{
+			if (exact::IsOne(a))
+				return n;
+			return MakeNode<MultOperator>(exact::MakeNumber(a), n);
+		}
+
+		// a+b or a-b, either of which may be nullptr
+		std::shared_ptr<Node> SumOf(std::shared_ptr<Node> const& a, std::shared_ptr<Node> const& b, bool add)
+		{
+			if (!b)
+				return a;
+			if (!a)
+				return add ? b : MakeNode<NegateOperator>(b);
+			return MakeNode<SumOperator>(a, true, b, add);
+		}
+
+		void AddTo(Coefficient & a, Coefficient const& b, bool add)
+		{
+			a.exact = add ? exact::Add(a.exact, b.exact) : exact::Subtract(a.exact, b.exact);
+			a.inexact = SumOf(a.inexact, b.inexact, add);
+		}
+
+		Coefficient Product(Coefficient const& a, Coefficient const& b)
+		{
+			Coefficient result{exact::Multiply(a.exact, b.exact), nullptr};
+			if (b.inexact && !exact::IsZero(a.exact))
+				result.inexact = SumOf(result.inexact, Scaled(a.exact, b.inexact), true);
+			if (a.inexact && !exact::IsZero(b.exact))
+				result.inexact = SumOf(result.inexact, Scaled(b.exact, a.inexact), true);
+			if (a.inexact && b.inexact)
+				result.inexact = SumOf(result.inexact, MakeNode<MultOperator>(a.inexact, b.inexact), true);
+			return result;
+		}
+
+		Monomial Product(Monomial const& a, Monomial const& b)
+		{
+			Monomial result;
+			auto ii = a.begin(), jj = b.begin();
+			while (ii!=a.end() || jj!=b.end())
+			{
+				if (jj==b.end() || (ii!=a.end() && ii->first < jj->first))
+					result.push_back(*ii++);
+				else if (ii==a.end() || jj->first < ii->first)
+					result.push_back(*jj++);
+				else
+				{
+					result.push_back(std::make_pair(ii->first, ii->second + jj->second));
+					++ii; ++jj;
+				}
+			}
+			return result;
+		}
+
+		// p += c*m, or p -= c*m
+		void Accumulate(Polynomial & p, Monomial const& m, Coefficient const& c, bool add)
+		{
+			auto found = p.find(m);
+			if (found==p.end())
+			{
+				Coefficient term{ExactValue{0,0}, nullptr};
+				AddTo(term, c, add);
+				p.insert(std::make_pair(m, term));
+			}
+			else
+			{
+				AddTo(found->second, c, add);
+				if (IsZeroCoefficient(found->second))
+					p.erase(found);
+			}
+		}
+
+
+		/**
+		Expands trees into polynomials, remembering the expansion of every node visited, so that shared subtrees are expanded once.
+		*/
+		class Expander
+		{
+		public:
+
+			Expander(std::vector<std::shared_ptr<Variable> > const& inputs, size_t max_terms) : max_terms_(max_terms)
+			{
+				for (size_t ii = 0; ii < inputs.size(); ++ii)
+					input_indices_[inputs[ii].get()] = ii;
+			}
+
+			Polynomial const& Expanded(std::shared_ptr<Node> const& n)
+			{
+				auto found = expanded_.find(n.get());
+				if (found!=expanded_.end())
+					return found->second;
+
+				auto result = Expand(n);
+				if (result.size() > max_terms_)
+					throw std::runtime_error("expanding polynomial, but expansion has more than " + std::to_string(max_terms_) + " terms");
+				return expanded_.insert(std::make_pair(n.get(), std::move(result))).first->second;
+			}
+
+		private:
+
+			bool IsConstant(std::shared_ptr<Node> const& n)
+			{
+				auto found = constant_.find(n.get());
+				if (found!=constant_.end())
+					return found->second;
+
+				bool constant = false;
+				if (std::dynamic_pointer_cast<Number>(n) || std::dynamic_pointer_cast<special_number::Pi>(n) || std::dynamic_pointer_cast<special_number::E>(n))
+					constant = true;
+				else if (std::dynamic_pointer_cast<Variable>(n) || std::dynamic_pointer_cast<Differential>(n))
+					constant = false;
+				else if (auto f = std::dynamic_pointer_cast<Function>(n))
+				{
+					f->EnsureNotEmpty();
+					constant = IsConstant(f->entry_node());
+				}
+				else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+					constant = IsConstant(u->first_child());
+				else if (auto m = std::dynamic_pointer_cast<NaryOperator>(n))
+					constant = std::all_of(m->children().begin(), m->children().end(), [this](std::shared_ptr<Node> const& c){ return IsConstant(c); });
+				else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+					constant = IsConstant(p->base()) && IsConstant(p->exponent());
+
+				constant_[n.get()] = constant;
+				return constant;
+			}
+
+
+			Polynomial Multiply(Polynomial const& a, Polynomial const& b)
+			{
+				Polynomial result;
+				for (const auto& ii : a)
+					for (const auto& jj : b)
+						Accumulate(result, Product(ii.first, jj.first), Product(ii.second, jj.second), true);
+
+				if (result.size() > max_terms_)
+					throw std::runtime_error("expanding polynomial, but expansion has more than " + std::to_string(max_terms_) + " terms");
+				return result;
+			}
+
+
+			Polynomial Power(Polynomial const& a, unsigned exponent)
+			{
+				Polynomial result;
+				result[Monomial()] = Coefficient{ExactValue{1,0}, nullptr};
+				Polynomial square = a;
+				for (; exponent > 0; exponent /= 2)
+				{
+					if (exponent % 2)
+						result = Multiply(result, square);
+					if (exponent > 1)
+						square = Multiply(square, square);
+				}
+				return result;
+			}
+
+
+			Polynomial Expand(std::shared_ptr<Node> const& n)
+			{
+				Polynomial result;
+
+				if (IsConstant(n))
+				{
+					Coefficient c{ExactValue{0,0}, nullptr};
+					if (!exact::GetExactValue(n, c.exact))
+						c.inexact = n;
+					if (!IsZeroCoefficient(c))
+						result[Monomial()] = c;
+					return result;
+				}
+
+				if (auto v = std::dynamic_pointer_cast<Variable>(n))
+				{
+					auto found = input_indices_.find(v.get());
+					if (found==input_indices_.end())
+						throw std::runtime_error("expanding polynomial, but variable " + v->name() + " is neither one of the variables nor the path variable");
+					result[Monomial{std::make_pair(found->second, 1u)}] = Coefficient{ExactValue{1,0}, nullptr};
+					return result;
+				}
+
+				if (auto f = std::dynamic_pointer_cast<Function>(n))
+					return Expanded(f->entry_node());
+
+				if (auto sum = std::dynamic_pointer_cast<SumOperator>(n))
+				{
+					const auto& signs = sum->children_signs();
+					for (size_t ii = 0; ii < sum->children_size(); ++ii)
+						for (const auto& iter : Expanded(sum->children()[ii]))
+							Accumulate(result, iter.first, iter.second, signs[ii]);
+					return result;
+				}
+
+				if (auto neg = std::dynamic_pointer_cast<NegateOperator>(n))
+				{
+					for (const auto& iter : Expanded(neg->first_child()))
+						Accumulate(result, iter.first, iter.second, false);
+					return result;
+				}
+
+				if (auto mult = std::dynamic_pointer_cast<MultOperator>(n))
+				{
+					const auto& mult_or_div = mult->children_mult_or_div();
+					result[Monomial()] = Coefficient{ExactValue{1,0}, nullptr};
+					for (size_t ii = 0; ii < mult->children_size(); ++ii)
+					{
+						const auto& child = mult->children()[ii];
+						if (mult_or_div[ii])
+						{
+							result = Multiply(result, Expanded(child));
+							continue;
+						}
+
+						if (!IsConstant(child))
+							throw std::runtime_error("expanding polynomial, but dividing by a non-constant");
+
+						Coefficient reciprocal{ExactValue{0,0}, nullptr};
+						ExactValue value;
+						if (exact::GetExactValue(child, value) && !exact::IsZero(value))
+							reciprocal.exact = exact::Divide(ExactValue{1,0}, value);
+						else
+							reciprocal.inexact = MakeNode<MultOperator>(MakeNode<Integer>(1), true, child, false);
+
+						Polynomial scaled;
+						for (const auto& iter : result)
+							Accumulate(scaled, iter.first, Product(iter.second, reciprocal), true);
+						result = std::move(scaled);
+					}
+					return result;
+				}
+
+				if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+				{
+					if (p->exponent() < 0)
+						throw std::runtime_error("expanding polynomial, but raising a non-constant to negative power");
+					return Power(Expanded(p->first_child()), unsigned(p->exponent()));
+				}
+
+				if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+				{
+					ExactValue value;
+					if (!IsConstant(p->exponent()) || !exact::GetExactValue(p->exponent(), value) || value.imag!=0 || denominator(value.real)!=1 || value.real < 0 || value.real > std::numeric_limits<int>::max())
+						throw std::runtime_error("expanding polynomial, but raising a non-constant to a power which is not a non-negative integer");
+					return Power(Expanded(p->base()), unsigned(numerator(value.real)));
+				}
+
+				throw std::runtime_error("unable to expand node of type " + boost::typeindex::type_id_runtime(*n).pretty_name() + " into polynomial");
+			}
+
+
+			size_t max_terms_;
+			std::map<const Node*, size_t> input_indices_;
+			std::map<const Node*, bool> constant_;
+			std::map<const Node*, Polynomial> expanded_;
+		};
+
+	} // re: namespace
+
+
+
+	PolynomialSystem::PolynomialSystem(std::vector<Nd> const& functions,
+	                                   VariableGroup const& variables,
+	                                   Var const& path_variable,
+	                                   size_t max_terms) :
+		num_variables_(variables.size()), path_variable_(path_variable), inputs_(variables.begin(), variables.end()), precision_(DefaultPrecision())
+	{
+		if (path_variable)
+			inputs_.push_back(path_variable);
+
+		Expander expander(inputs_, max_terms);
+		std::vector<Polynomial const*> expanded;
+		for (const auto& f : functions)
+			expanded.push_back(&expander.Expanded(f));
+
+		// the table of powers holds the zeroth through highest power of each input
+		std::vector<unsigned> highest_powers(inputs_.size(), 0);
+		for (const auto& p : expanded)
+			for (const auto& term : *p)
+				for (const auto& factor : term.first)
+					highest_powers[factor.first] = std::max(highest_powers[factor.first], factor.second);
+
+		power_offsets_.push_back(0);
+		for (auto iter : highest_powers)
+			power_offsets_.push_back(power_offsets_.back() + iter + 1);
+
+		// the terms of each function, grouped by their monomials in the variables.  the path variable is the last input, so is the last factor of a monomial if present
+		const auto time_index = num_variables_;
+		function_groups_.push_back(0);
+		group_factors_.push_back(0);
+		group_terms_.push_back(0);
+		for (const auto& p : expanded)
+		{
+			std::map<Monomial, std::vector<Polynomial::const_iterator> > groups;
+			for (auto term = p->begin(); term != p->end(); ++term)
+			{
+				Monomial in_variables = term->first;
+				if (!in_variables.empty() && in_variables.back().first==time_index)
+					in_variables.pop_back();
+				groups[in_variables].push_back(term);
+			}
+
+			for (const auto& group : groups)
+			{
+				for (const auto& factor : group.first)
+				{
+					factor_inputs_.push_back(factor.first);
+					factor_exponents_.push_back(factor.second);
+					factor_powers_.push_back(power_offsets_[factor.first] + factor.second);
+				}
+				group_factors_.push_back(factor_inputs_.size());
+
+				for (const auto& term : group.second)
+				{
+					exact_coefficients_.push_back(term->second.exact);
+					inexact_coefficients_.push_back(term->second.inexact);
+
+					const auto& m = term->first;
+					const unsigned time_exponent = (!m.empty() && m.back().first==time_index) ? m.back().second : 0;
+					term_time_exponents_.push_back(time_exponent);
+					term_time_powers_.push_back(time_exponent ? power_offsets_[time_index] + time_exponent : 0);
+				}
+				group_terms_.push_back(exact_coefficients_.size());
+			}
+			function_groups_.push_back(group_factors_.size()-1);
+		}
+
+		std::get<std::vector<dbl> >(powers_).resize(power_offsets_.back());
+		std::get<std::vector<mpfr> >(powers_).resize(power_offsets_.back());
+		std::get<std::vector<dbl> >(coefficients_).resize(NumTerms());
+		std::get<std::vector<mpfr> >(coefficients_).resize(NumTerms());
+		std::get<std::vector<dbl> >(time_derivative_coefficients_).resize(NumTerms());
+		std::get<std::vector<mpfr> >(time_derivative_coefficients_).resize(NumTerms());
+		std::get<std::vector<dbl> >(scratch_).resize(6);
+		std::get<std::vector<mpfr> >(scratch_).resize(6);
+
+		precision(precision_);
+	}
+
+
+
+	template<>
+	dbl PolynomialSystem::CoefficientValue<dbl>(size_t term) const
+	{
+		const auto& e = exact_coefficients_[term];
+		dbl value(double(e.real), double(e.imag));
+
+		if (const auto& n = inexact_coefficients_[term])
+		{
+			n->Reset();
+			value += n->Eval<dbl>();
+		}
+		return value;
+	}
+
+
+	template<>
+	mpfr PolynomialSystem::CoefficientValue<mpfr>(size_t term) const
+	{
+		const auto& e = exact_coefficients_[term];
+		mpfr value(boost::multiprecision::mpfr_float(e.real), boost::multiprecision::mpfr_float(e.imag));
+		value.precision(precision_);
+
+		if (const auto& n = inexact_coefficients_[term])
+		{
+			n->precision(precision_);
+			n->Reset();
+			value += n->Eval<mpfr>();
+		}
+		return value;
+	}
+
+
+
+	void PolynomialSystem::precision(unsigned new_precision) const
+	{
+		auto& p_d = std::get<std::vector<dbl> >(powers_);
+		auto& p_mp = std::get<std::vector<mpfr> >(powers_);
+		auto& s_mp = std::get<std::vector<mpfr> >(scratch_);
+		auto& c_mp = std::get<std::vector<mpfr> >(coefficients_);
+		auto& dc_mp = std::get<std::vector<mpfr> >(time_derivative_coefficients_);
+
+		if (new_precision!=precision_)
+		{
+			auto cached = std::find_if(precision_cache_.begin(), precision_cache_.end(),
+			                           [=](PrecisionState const& s){ return s.precision==new_precision; });
+
+			PrecisionState entering;
+			if (cached!=precision_cache_.end())
+			{
+				entering = std::move(*cached);
+				precision_cache_.erase(cached);
+			}
+			else if (precision_cache_.size()==precision_cache_size_)
+			{
+				// recycle the storage of the precision left longest ago
+				entering = std::move(precision_cache_.front());
+				entering.precision = 0;
+				precision_cache_.erase(precision_cache_.begin());
+			}
+			else
+			{
+				entering.powers = p_mp;
+				entering.coefficients = c_mp;
+				entering.time_derivative_coefficients = dc_mp;
+				entering.scratch = s_mp;
+			}
+
+			PrecisionState leaving;
+			leaving.precision = precision_;
+			leaving.powers = std::move(p_mp);
+			leaving.coefficients = std::move(c_mp);
+			leaving.time_derivative_coefficients = std::move(dc_mp);
+			leaving.scratch = std::move(s_mp);
+			precision_cache_.push_back(std::move(leaving));
+
+			p_mp = std::move(entering.powers);
+			c_mp = std::move(entering.coefficients);
+			dc_mp = std::move(entering.time_derivative_coefficients);
+			s_mp = std::move(entering.scratch);
+
+			// the zeroth powers, the coefficients, and the zero at the end of the scratch are never written by evaluation, so are as they were left
+			if (entering.precision==new_precision)
+			{
+				precision_ = new_precision;
+				return;
+			}
+		}
+
+		precision_ = new_precision;
+		for (auto& iter : p_mp)
+			iter.precision(new_precision);
+		for (size_t ii = 0; ii < inputs_.size(); ++ii)
+		{
+			p_d[power_offsets_[ii]] = dbl(1);
+			p_mp[power_offsets_[ii]] = mpfr(1);
+			p_mp[power_offsets_[ii]].precision(new_precision);
+		}
+
+		auto& s_d = std::get<std::vector<dbl> >(scratch_);
+		for (auto& iter : s_mp)
+			iter.precision(new_precision);
+		s_d.back() = dbl(0);
+		s_mp.back() = mpfr(0);
+		s_mp.back().precision(new_precision);
+
+		auto& c_d = std::get<std::vector<dbl> >(coefficients_);
+		auto& dc_d = std::get<std::vector<dbl> >(time_derivative_coefficients_);
+		// the inexact coefficients are trees, which may be shared with copies of this on other threads
+		std::lock_guard<std::mutex> lock(node::SharedConstantsMutex());
+		for (size_t tt = 0; tt < NumTerms(); ++tt)
+		{
+			c_d[tt] = CoefficientValue<dbl>(tt);
+			c_mp[tt] = CoefficientValue<mpfr>(tt);
+
+			dc_d[tt] = c_d[tt] * double(term_time_exponents_[tt]);
+			dc_mp[tt] = c_mp[tt];
+			dc_mp[tt] *= term_time_exponents_[tt];
+		}
+	}
+
+
+	void PolynomialSystem::SubstituteInputs(std::map<const node::Variable*, Var> const& substitutes)
+	{
+		for (auto& iter : inputs_)
+		{
+			auto found = substitutes.find(iter.get());
+			if (found!=substitutes.end())
+				iter = found->second;
+		}
+
+		if (path_variable_)
+		{
+			auto found = substitutes.find(path_variable_.get());
+			if (found!=substitutes.end())
+				path_variable_ = found->second;
+		}
+	}
+
+
+
+	MemoryUsage PolynomialSystem::MemoryReport() const
+	{
+		using memory::HeapBytes;
+		MemoryUsage report;
+
+		report.Add("structure", HeapBytes(power_offsets_) + HeapBytes(function_groups_) + HeapBytes(group_factors_) + HeapBytes(group_terms_) + HeapBytes(factor_inputs_) + HeapBytes(factor_powers_) + HeapBytes(factor_exponents_) + HeapBytes(term_time_powers_) + HeapBytes(term_time_exponents_), NumGroups());
+		report.Add("coefficients", exact_coefficients_.capacity()*sizeof(node::detail::ExactValue) + HeapBytes(inexact_coefficients_) + HeapBytes(coefficients_) + HeapBytes(time_derivative_coefficients_), NumTerms());
+
+		std::size_t cached = 0;
+		for (auto const& state : precision_cache_)
+			cached += HeapBytes(state.powers) + HeapBytes(state.coefficients) + HeapBytes(state.time_derivative_coefficients) + HeapBytes(state.scratch);
+		report.Add("tables", HeapBytes(powers_) + HeapBytes(scratch_) + HeapBytes(part_scratch_) + cached);
+		return report;
+	}
+
+} // namespace bertini
@@ -0,0 +1,576 @@
+//This file is part of Bertini 2.
+//
+//simplify.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//simplify.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with simplify.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "function_tree/simplify.hpp"
+
+#include <limits>
+#include <sstream>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/functional/hash.hpp>
+
+
+namespace bertini {
+namespace node{
+
+	unsigned EliminateCommonSubexpressions(std::vector< std::shared_ptr<Node> > const& roots)
+	{
+		detail::SubexpressionMerger merger;
+		for (const auto& iter : roots)
+			merger.Canonical(iter);
+		return merger.NumMerged();
+	}
+
+
+
+	unsigned SubstituteDifferentials(std::vector< std::shared_ptr<Node> > & roots, std::map< const Variable*, std::shared_ptr<Node> > const& directions)
+	{
+		detail::DifferentialSubstituter substituter(directions);
+		for (auto& iter : roots)
+			iter = substituter.Substituted(iter);
+		return substituter.NumSubstituted();
+	}
+
+
+	unsigned Simplify(std::vector< std::shared_ptr<Node> > & roots)
+	{
+		detail::Simplifier simplifier;
+		for (auto& iter : roots)
+			iter = simplifier.Simplified(iter);
+		return simplifier.NumSimplified();
+	}
+
+
+	namespace detail{
+
+		size_t SubexpressionMerger::KeyHash::operator()(Key const& k) const
+		{
+			size_t seed = k.type.hash_code();
+			for (const auto& iter : k.children)
+				boost::hash_combine(seed, iter);
+			for (const auto& iter : k.data)
+				boost::hash_combine(seed, iter);
+			boost::hash_combine(seed, k.text);
+			return seed;
+		}
+
+
+
+		std::shared_ptr<Node> SubexpressionMerger::Canonical(std::shared_ptr<Node> const& n)
+		{
+			auto found = visited_.find(n.get());
+			if (found!=visited_.end())
+				return found->second;
+
+			auto result = n;
+
+			Key key{std::type_index(typeid(*n)), {}, {}, ""};
+			if (MakeKey(n, key))
+			{
+				auto inserted = table_.insert(std::make_pair(std::move(key), n));
+				if (!inserted.second)
+				{
+					result = inserted.first->second;
+					++num_merged_;
+				}
+			}
+
+			visited_[n.get()] = result;
+			return result;
+		}
+
+
+
+		bool SubexpressionMerger::MakeKey(std::shared_ptr<Node> const& n, Key & key)
+		{
+			// roots are identified by pointer, but their trees are merged
+			if (auto f = std::dynamic_pointer_cast<Function>(n))
+			{
+				f->EnsureNotEmpty();
+				auto entry = Canonical(f->entry_node());
+				if (entry!=f->entry_node())
+					f->SetRoot(entry);
+				return false;
+			}
+
+			// leaves
+			if (std::dynamic_pointer_cast<Variable>(n))
+				return false;
+
+			if (auto d = std::dynamic_pointer_cast<Differential>(n))
+			{
+				key.children.push_back(d->GetVariable().get());
+				return true;
+			}
+
+			if (std::dynamic_pointer_cast<Integer>(n) || std::dynamic_pointer_cast<Rational>(n))
+			{
+				// these print their exact values
+				std::stringstream ss;
+				n->print(ss);
+				key.text = ss.str();
+				return true;
+			}
+
+			if (std::dynamic_pointer_cast<special_number::Pi>(n) || std::dynamic_pointer_cast<special_number::E>(n))
+				return true;
+
+			// operators.  the children are merged first, so that equal subtrees have equal children.
+			if (auto m = std::dynamic_pointer_cast<NaryOperator>(n))
+			{
+				for (size_t ii = 0; ii < m->children_size(); ++ii)
+				{
+					auto child = Canonical(m->children()[ii]);
+					if (child!=m->children()[ii])
+						m->SetChild(ii, child);
+					key.children.push_back(child.get());
+				}
+
+				if (auto sum = std::dynamic_pointer_cast<SumOperator>(n))
+					key.data.assign(sum->children_signs().begin(), sum->children_signs().end());
+				else if (auto mult = std::dynamic_pointer_cast<MultOperator>(n))
+					key.data.assign(mult->children_mult_or_div().begin(), mult->children_mult_or_div().end());
+				else
+					return false;
+
+				return true;
+			}
+
+			if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+			{
+				auto base = Canonical(p->base());
+				auto exponent = Canonical(p->exponent());
+				if (base!=p->base())
+					p->SetBase(base);
+				if (exponent!=p->exponent())
+					p->SetExponent(exponent);
+				key.children.push_back(base.get());
+				key.children.push_back(exponent.get());
+				return true;
+			}
+
+			if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+			{
+				auto child = Canonical(u->first_child());
+				if (child!=u->first_child())
+					u->SetChild(child);
+				key.children.push_back(child.get());
+
+				if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+					key.data.push_back(p->exponent());
+
+				return true;
+			}
+
+			// Floats, whose printed values may be rounded, and any other node type we don't know how to compare.
+			return false;
+		}
+
+
+
+
+		bool IsZero(ExactValue const& a)
+		{
+			return a.real==0 && a.imag==0;
+		}
+
+		bool IsOne(ExactValue const& a)
+		{
+			return a.real==1 && a.imag==0;
+		}
+
+		ExactValue Add(ExactValue const& a, ExactValue const& b)
+		{
+			return ExactValue{a.real+b.real, a.imag+b.imag};
+		}
+
+		ExactValue Subtract(ExactValue const& a, ExactValue const& b)
+		{
+			return ExactValue{a.real-b.real, a.imag-b.imag};
+		}
+
+		ExactValue Multiply(ExactValue const& a, ExactValue const& b)
+		{
+			return ExactValue{a.real*b.real - a.imag*b.imag, a.real*b.imag + a.imag*b.real};
+		}
+
+		// b must be non-zero
+		ExactValue Divide(ExactValue const& a, ExactValue const& b)
+		{
+			mpq_rational denom = b.real*b.real + b.imag*b.imag;
+			return ExactValue{(a.real*b.real + a.imag*b.imag)/denom, (a.imag*b.real - a.real*b.imag)/denom};
+		}
+
+		// a must be non-zero if p is negative
+		ExactValue Power(ExactValue const& a, int p)
+		{
+			ExactValue result{1,0};
+			ExactValue square = a;
+			for (long q = p < 0 ? -long(p) : long(p); q > 0; q /= 2)
+			{
+				if (q % 2)
+					result = Multiply(result, square);
+				square = Multiply(square, square);
+			}
+			if (p < 0)
+				result = Divide(ExactValue{1,0}, result);
+			return result;
+		}
+
+
+
+		bool GetExactValue(std::shared_ptr<Node> const& n, ExactValue & value)
+		{
+			if (auto i = std::dynamic_pointer_cast<Integer>(n))
+			{
+				value = ExactValue{mpq_rational(i->true_value()), 0};
+				return true;
+			}
+
+			if (auto r = std::dynamic_pointer_cast<Rational>(n))
+			{
+				value = ExactValue{r->true_value_real(), r->true_value_imag()};
+				return true;
+			}
+
+			if (auto f = std::dynamic_pointer_cast<Float>(n))
+			{
+				const auto& v = f->highest_precision_value();
+				if (!(boost::math::isfinite)(v.real()) || !(boost::math::isfinite)(v.imag()))
+					return false;
+				// every binary floating point number is a rational number
+				value = ExactValue{mpq_rational(v.real()), mpq_rational(v.imag())};
+				return true;
+			}
+
+			return false;
+		}
+
+
+
+		std::shared_ptr<Node> MakeNumber(ExactValue const& value)
+		{
+			if (value.imag==0 && denominator(value.real)==1)
+				return MakeNode<Integer>(mpz_int(numerator(value.real)));
+			else
+				return MakeNode<Rational>(value.real, value.imag);
+		}
+
+
+
+		std::shared_ptr<Node> Simplifier::Simplified(std::shared_ptr<Node> const& n)
+		{
+			auto found = visited_.find(n);
+			if (found!=visited_.end())
+				return found->second;
+
+			auto result = n;
+
+			if (auto f = std::dynamic_pointer_cast<Function>(n))
+			{
+				f->EnsureNotEmpty();
+				auto entry = Simplified(f->entry_node());
+				if (entry!=f->entry_node())
+					f->SetRoot(entry);
+			}
+			else if (auto sum = std::dynamic_pointer_cast<SumOperator>(n))
+				result = SimplifySum(sum);
+			else if (auto mult = std::dynamic_pointer_cast<MultOperator>(n))
+				result = SimplifyProduct(mult);
+			else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+				result = SimplifyPower(p);
+			else if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+				result = SimplifyIntegerPower(p);
+			else if (auto neg = std::dynamic_pointer_cast<NegateOperator>(n))
+				result = SimplifyNegate(neg);
+			else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+			{
+				// transcendental functions.  their arguments can be simplified, but they are not folded.
+				auto child = Simplified(u->first_child());
+				if (child!=u->first_child())
+					u->SetChild(child);
+			}
+			else if (auto m = std::dynamic_pointer_cast<NaryOperator>(n))
+			{
+				for (size_t ii = 0; ii < m->children_size(); ++ii)
+				{
+					auto child = Simplified(m->children()[ii]);
+					if (child!=m->children()[ii])
+						m->SetChild(ii, child);
+				}
+			}
+			// everything else is a leaf
+
+			if (result!=n)
+				++num_simplified_;
+
+			visited_[n] = result;
+			return result;
+		}
+
+
+
+		std::shared_ptr<Node> Simplifier::SimplifySum(std::shared_ptr<SumOperator> const& n)
+		{
+			ExactValue constant{0,0};
+			unsigned num_constants = 0;
+			std::vector< std::pair<std::shared_ptr<Node>, bool> > terms;
+			std::vector< std::shared_ptr<Node> > children(n->children_size());
+
+			for (size_t ii = 0; ii < n->children_size(); ++ii)
+			{
+				children[ii] = Simplified(n->children()[ii]);
+				bool sign = n->children_signs()[ii];
+
+				ExactValue value;
+				if (GetExactValue(children[ii], value))
+				{
+					constant = sign ? Add(constant, value) : Subtract(constant, value);
+					++num_constants;
+				}
+				else
+					terms.push_back(std::make_pair(children[ii], sign));
+			}
+
+			bool needs_rebuild = num_constants > 1 || (num_constants==1 && IsZero(constant)) || n->children_size()==1;
+			if (!needs_rebuild)
+			{
+				for (size_t ii = 0; ii < children.size(); ++ii)
+					if (children[ii]!=n->children()[ii])
+						n->SetChild(ii, children[ii]);
+				return n;
+			}
+
+			if (!IsZero(constant) || terms.empty())
+				terms.push_back(std::make_pair(MakeNumber(constant), true));
+
+			if (terms.size()==1)
+			{
+				if (terms[0].second)
+					return terms[0].first;
+				else if (auto neg = std::dynamic_pointer_cast<NegateOperator>(terms[0].first))
+					return neg->first_child();
+				else
+					return MakeNode<NegateOperator>(terms[0].first);
+			}
+
+			auto result = MakeNode<SumOperator>(terms[0].first, terms[0].second, terms[1].first, terms[1].second);
+			for (size_t ii = 2; ii < terms.size(); ++ii)
+				result->AddChild(terms[ii].first, terms[ii].second);
+			return result;
+		}
+
+
+
+		std::shared_ptr<Node> Simplifier::SimplifyProduct(std::shared_ptr<MultOperator> const& n)
+		{
+			ExactValue constant{1,0};
+			unsigned num_constants = 0;
+			std::vector< std::pair<std::shared_ptr<Node>, bool> > factors;
+			std::vector< std::shared_ptr<Node> > children(n->children_size());
+
+			for (size_t ii = 0; ii < n->children_size(); ++ii)
+			{
+				children[ii] = Simplified(n->children()[ii]);
+				bool mult = n->children_mult_or_div()[ii];
+
+				ExactValue value;
+				if (GetExactValue(children[ii], value) && (mult || !IsZero(value)))
+				{
+					if (mult && IsZero(value))
+						return MakeNumber(value);
+
+					constant = mult ? Multiply(constant, value) : Divide(constant, value);
+					++num_constants;
+				}
+				else
+					factors.push_back(std::make_pair(children[ii], mult));
+			}
+
+			bool needs_rebuild = num_constants > 1 || (num_constants==1 && IsOne(constant)) || (n->children_size()==1 && n->children_mult_or_div()[0]);
+			if (!needs_rebuild)
+			{
+				for (size_t ii = 0; ii < children.size(); ++ii)
+					if (children[ii]!=n->children()[ii])
+						n->SetChild(ii, children[ii]);
+				return n;
+			}
+
+			if (!IsOne(constant) || factors.empty())
+				factors.insert(factors.begin(), std::make_pair(MakeNumber(constant), true));
+
+			if (factors.size()==1 && factors[0].second)
+				return factors[0].first;
+
+			if (factors.size()==1)
+				factors.insert(factors.begin(), std::make_pair(MakeNode<Integer>(1), true));
+
+			auto result = MakeNode<MultOperator>(factors[0].first, factors[0].second, factors[1].first, factors[1].second);
+			for (size_t ii = 2; ii < factors.size(); ++ii)
+				result->AddChild(factors[ii].first, factors[ii].second);
+			return result;
+		}
+
+
+
+		std::shared_ptr<Node> Simplifier::IntegerPowerOf(std::shared_ptr<Node> const& base, int exponent)
+		{
+			if (exponent==0)
+				return MakeNode<Integer>(1);
+
+			if (exponent==1)
+				return base;
+
+			ExactValue value;
+			if (GetExactValue(base, value) && !(IsZero(value) && exponent < 0))
+				return MakeNumber(Power(value, exponent));
+
+			if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(base))
+				return MakeNode<IntegerPowerOperator>(p->first_child(), p->exponent()*exponent);
+
+			return nullptr;
+		}
+
+
+
+		std::shared_ptr<Node> Simplifier::SimplifyPower(std::shared_ptr<PowerOperator> const& n)
+		{
+			auto base = Simplified(n->base());
+			auto exponent = Simplified(n->exponent());
+			if (base!=n->base())
+				n->SetBase(base);
+			if (exponent!=n->exponent())
+				n->SetExponent(exponent);
+
+			ExactValue value;
+			if (!GetExactValue(exponent, value) || value.imag!=0 || denominator(value.real)!=1)
+				return n;
+
+			mpz_int p = numerator(value.real);
+			if (p > std::numeric_limits<int>::max() || p < -std::numeric_limits<int>::max())
+				return n;
+
+			auto simpler = IntegerPowerOf(base, p.convert_to<int>());
+			if (simpler)
+				return simpler;
+			else
+				return MakeNode<IntegerPowerOperator>(base, p.convert_to<int>());
+		}
+
+
+
+		std::shared_ptr<Node> Simplifier::SimplifyIntegerPower(std::shared_ptr<IntegerPowerOperator> const& n)
+		{
+			auto base = Simplified(n->first_child());
+
+			auto simpler = IntegerPowerOf(base, n->exponent());
+			if (simpler)
+				return simpler;
+
+			if (base!=n->first_child())
+				n->SetChild(base);
+			return n;
+		}
+
+
+
+		std::shared_ptr<Node> Simplifier::SimplifyNegate(std::shared_ptr<NegateOperator> const& n)
+		{
+			auto child = Simplified(n->first_child());
+
+			ExactValue value;
+			if (GetExactValue(child, value))
+				return MakeNumber(Subtract(ExactValue{0,0}, value));
+
+			if (auto neg = std::dynamic_pointer_cast<NegateOperator>(child))
+				return neg->first_child();
+
+			if (child!=n->first_child())
+				n->SetChild(child);
+			return n;
+		}
+
+
+
+
+		DifferentialSubstituter::DifferentialSubstituter(std::map< const Variable*, std::shared_ptr<Node> > const& directions) :
+			directions_(directions), zero_(MakeNode<Integer>(0))
+		{}
+
+
+
+		std::shared_ptr<Node> DifferentialSubstituter::Substituted(std::shared_ptr<Node> const& n)
+		{
+			auto found = visited_.find(n.get());
+			if (found!=visited_.end())
+				return found->second;
+
+			auto result = n;
+
+			if (auto d = std::dynamic_pointer_cast<Differential>(n))
+			{
+				auto direction = directions_.find(d->GetVariable().get());
+				result = direction!=directions_.end() ? direction->second : zero_;
+				++num_substituted_;
+			}
+			else if (auto f = std::dynamic_pointer_cast<Function>(n))
+			{
+				f->EnsureNotEmpty();
+				auto entry = Substituted(f->entry_node());
+				if (entry!=f->entry_node())
+					f->SetRoot(entry);
+			}
+			else if (auto m = std::dynamic_pointer_cast<NaryOperator>(n))
+			{
+				for (size_t ii = 0; ii < m->children_size(); ++ii)
+				{
+					auto child = Substituted(m->children()[ii]);
+					if (child!=m->children()[ii])
+						m->SetChild(ii, child);
+				}
+			}
+			else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+			{
+				auto base = Substituted(p->base());
+				auto exponent = Substituted(p->exponent());
+				if (base!=p->base())
+					p->SetBase(base);
+				if (exponent!=p->exponent())
+					p->SetExponent(exponent);
+			}
+			else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+			{
+				auto child = Substituted(u->first_child());
+				if (child!=u->first_child())
+					u->SetChild(child);
+			}
+
+			visited_[n.get()] = result;
+			return result;
+		}
+
+	} // re: namespace detail
+
+} // re: namespace node
+} // re: namespace bertini
@@ -31,33 +31,33 @@ namespace node{
 
 	std::shared_ptr<Node> Pi()
 	{
-		return std::make_shared<special_number::Pi>();
+		return MakeNode<special_number::Pi>();
 	}
 
 	std::shared_ptr<Node> E()
 	{
-		return std::make_shared<special_number::E>();
+		return MakeNode<special_number::E>();
 	}
 
 	std::shared_ptr<Node> I()
 	{
-		return std::make_shared<Float>(0,1);
+		return MakeNode<Float>(0,1);
 	}
 
 
 	std::shared_ptr<Node> Two()
 	{
-		return std::make_shared<Integer>(2);
+		return MakeNode<Integer>(2);
 	}
 
 	std::shared_ptr<Node> One()
 	{
-		return std::make_shared<Integer>(1);
+		return MakeNode<Integer>(1);
 	}
 
 	std::shared_ptr<Node> Zero()
 	{
-		return std::make_shared<Integer>(0);
+		return MakeNode<Integer>(0);
 	}
 
 }
@@ -0,0 +1,1703 @@
+//This file is part of Bertini 2.
+//
+//straight_line_program.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//straight_line_program.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with straight_line_program.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "function_tree/straight_line_program.hpp"
+#include "function_tree/simplify.hpp"
+#include "function_tree/native_code.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <string>
+
+
+namespace bertini {
+
+	using namespace node;
+
+	StraightLineProgram::StraightLineProgram(std::vector<Nd> const& functions,
+	                                         std::vector<Nd> const& derivatives,
+	                                         VariableGroup const& variables,
+	                                         Var const& path_variable) :
+		num_variables_(variables.size()), have_jacobian_(!derivatives.empty()), path_variable_(path_variable), precision_(DefaultPrecision())
+	{
+		if (have_jacobian_ && derivatives.size()!=functions.size())
+			throw std::runtime_error("compiling straight line program, but number of derivatives (" + std::to_string(derivatives.size()) + ") doesn't match number of functions (" + std::to_string(functions.size()) + ")");
+
+		for (const auto& v : variables)
+			differentiation_variables_.push_back(v.get());
+		differentiation_variables_.push_back(path_variable.get());
+
+		for (const auto& f : functions)
+			function_outputs_.push_back(Lower(f, no_differentiation_, FunctionSegment));
+		segment_end_[FunctionSegment] = instructions_.size();
+
+		if (have_jacobian_)
+			for (const auto& df : derivatives)
+				for (size_t jj = 0; jj < num_variables_; ++jj)
+					jacobian_outputs_.push_back(Lower(df, int(jj), JacobianSegment));
+		segment_end_[JacobianSegment] = instructions_.size();
+
+		if (HaveTimeDerivative())
+			for (const auto& df : derivatives)
+				time_derivative_outputs_.push_back(Lower(df, int(num_variables_), TimeDerivativeSegment));
+		segment_end_[TimeDerivativeSegment] = instructions_.size();
+
+		FuseSinCos();
+		NumberRegisters();
+
+		// which registers carry nonzero derivatives, for forward-mode differentiation.  instructions come after the instructions computing their operands, unary ones have the zero register as their unused second, and SinCos writes its second.
+		has_tangent_.assign(num_registers_, false);
+		for (const auto& iter : inputs_)
+		{
+			auto found = std::find(differentiation_variables_.begin(), differentiation_variables_.end(), iter.first.get());
+			if (found!=differentiation_variables_.end())
+			{
+				input_directions_.push_back(int(found - differentiation_variables_.begin()));
+				has_tangent_[iter.second] = true;
+			}
+			else
+				input_directions_.push_back(-1);
+		}
+		for (const auto& iter : instructions_)
+			if (iter.operation==SLPOperation::SinCos)
+				has_tangent_[iter.result] = has_tangent_[iter.second] = has_tangent_[iter.first];
+			else
+				has_tangent_[iter.result] = has_tangent_[iter.first] || has_tangent_[iter.second];
+
+		// the compilation bookkeeping refers to raw pointers into the trees, and is not needed after this point.
+		lowered_.clear();
+		depends_on_differential_.clear();
+		input_registers_.clear();
+		constant_registers_.clear();
+
+		ScheduleRegisters();
+		std::get<std::vector<dbl> >(registers_).resize(run_schedule_->num_registers);
+		std::get<std::vector<mpfr> >(registers_).resize(run_schedule_->num_registers);
+		precision(precision_);
+	}
+
+
+	void StraightLineProgram::precision(unsigned new_precision) const
+	{
+		auto& r = std::get<std::vector<mpfr> >(registers_);
+		auto& t = std::get<std::vector<mpfr> >(tangents_);
+
+		if (new_precision!=precision_)
+		{
+			// the series are written afresh by each Taylor sweep, so are not worth keeping
+			std::get<std::vector<mpfr> >(series_).clear();
+
+			auto cached = std::find_if(precision_cache_.begin(), precision_cache_.end(),
+			                           [=](PrecisionState const& s){ return s.precision==new_precision; });
+
+			PrecisionState entering;
+			if (cached!=precision_cache_.end())
+			{
+				entering = std::move(*cached);
+				precision_cache_.erase(cached);
+			}
+			else if (precision_cache_.size()==precision_cache_size_)
+			{
+				// recycle the storage of the precision left longest ago
+				entering = std::move(precision_cache_.front());
+				entering.precision = 0;
+				precision_cache_.erase(precision_cache_.begin());
+			}
+			else
+			{
+				entering.registers = r;
+				entering.tangents = t;
+			}
+
+			PrecisionState leaving;
+			leaving.precision = precision_;
+			leaving.registers = std::move(r);
+			leaving.tangents = std::move(t);
+			precision_cache_.push_back(std::move(leaving));
+
+			r = std::move(entering.registers);
+			t = std::move(entering.tangents);
+			precision_ = new_precision;
+
+			// evaluation never writes the registers of the constants, nor the tangents which are fixed, so they are as they were left
+			if (entering.precision==new_precision)
+				return;
+		}
+
+		for (auto& iter : r)
+			iter.precision(new_precision);
+		precision_ = new_precision;
+
+		SetTangentPrecision(t);
+
+		LoadConstants();
+	}
+
+
+	void StraightLineProgram::LoadConstants() const
+	{
+		auto& r_d = std::get<std::vector<dbl> >(registers_);
+		auto& r_mp = std::get<std::vector<mpfr> >(registers_);
+
+		r_d[zero_] = dbl(0); r_d[one_] = dbl(1);
+		r_mp[zero_] = mpfr(0); r_mp[one_] = mpfr(1);
+		r_mp[zero_].precision(precision_); r_mp[one_].precision(precision_);
+
+		// the trees from which the constants come are not necessarily at the working precision, so bring them there.  they may be shared with copies of the program on other threads.
+		std::lock_guard<std::mutex> lock(node::SharedConstantsMutex());
+		for (const auto& iter : constants_)
+		{
+			iter.first->precision(precision_);
+			iter.first->Reset();
+			r_d[iter.second] = iter.first->Eval<dbl>();
+			r_mp[iter.second] = iter.first->Eval<mpfr>();
+			r_mp[iter.second].precision(precision_);
+		}
+	}
+
+
+	void StraightLineProgram::LoadCompensatedConstants() const
+	{
+		auto& r = std::get<std::vector<dd_complex> >(registers_);
+		r.resize(run_schedule_->num_registers);
+
+		r[zero_] = dd_complex(0); r[one_] = dd_complex(1);
+
+		// constants such as 0.1 are not doubles, so are read at enough digits to fill both halves of their registers, and left at the working precision
+		const auto digits = std::max(precision_, DoubleDoublePrecision());
+		std::lock_guard<std::mutex> lock(node::SharedConstantsMutex());
+		for (const auto& iter : constants_)
+		{
+			iter.first->precision(digits);
+			iter.first->Reset();
+			r[iter.second] = dd_complex(iter.first->Eval<mpfr>());
+
+			iter.first->precision(precision_);
+			iter.first->Reset();
+		}
+	}
+
+
+	void StraightLineProgram::LoadRealConstants(std::vector<double> & r) const
+	{
+		if (r.size()>=run_schedule_->num_registers)
+			return;
+
+		const auto& r_d = std::get<std::vector<dbl> >(registers_);
+		r.assign(run_schedule_->num_registers, 0.);
+		r[one_] = 1.;
+		for (const auto& iter : constants_)
+			r[iter.second] = r_d[iter.second].real();
+	}
+
+
+	void StraightLineProgram::LoadRealConstants(std::vector<mpfr_float> & r) const
+	{
+		if (r.size()>=run_schedule_->num_registers && Precision(r[zero_])==precision_)
+			return;
+
+		const auto& r_mp = std::get<std::vector<mpfr> >(registers_);
+		r.resize(std::max(r.size(), run_schedule_->num_registers));
+		r[zero_] = 0; r[one_] = 1;
+		for (const auto& iter : constants_)
+			r[iter.second] = r_mp[iter.second].real();
+		for (auto& iter : r)
+			iter.precision(precision_);
+	}
+
+
+	bool StraightLineProgram::HasRealCoefficients() const
+	{
+		for (auto direction : input_directions_)
+			if (direction<0)
+				return false;
+
+		const auto& r_mp = std::get<std::vector<mpfr> >(registers_);
+		for (const auto& iter : constants_)
+			if (r_mp[iter.second].imag()!=0)
+				return false;
+		return true;
+	}
+
+
+	void StraightLineProgram::UseThreads(std::shared_ptr<detail::ThreadTeam> const& team)
+	{
+		team_ = team;
+		blocks_.clear();
+		if (!team_ || team_->Size()<2 || NumFunctions() < team_->Size())
+			return;
+
+		blocks_.resize(team_->Size());
+		for (unsigned part = 0; part < team_->Size(); ++part)
+		{
+			blocks_[part].row_begin = detail::PartBegin(NumFunctions(), part, team_->Size());
+			blocks_[part].row_end = detail::PartBegin(NumFunctions(), part+1, team_->Size());
+		}
+	}
+
+
+	std::vector<size_t> const& StraightLineProgram::BlockInstructions(RowBlock & block, unsigned outputs) const
+	{
+		auto& list = block.instructions[outputs];
+		if (block.have_instructions[outputs])
+			return list;
+
+		// every instruction writes a register of its own, so walking backward from the outputs finds all on which they depend
+		std::vector<char> needed(num_registers_, 0);
+		for (size_t ii = block.row_begin; ii < block.row_end; ++ii)
+		{
+			if (outputs & FunctionOutputs)
+				needed[function_outputs_[ii]] = 1;
+			if (outputs & JacobianOutputs)
+				for (size_t jj = 0; jj < num_variables_; ++jj)
+					needed[jacobian_outputs_[ii*num_variables_+jj]] = 1;
+			if (outputs & TimeDerivativeOutputs)
+				needed[time_derivative_outputs_[ii]] = 1;
+		}
+
+		list.clear();
+		for (size_t kk = instructions_.size(); kk-- > 0; )
+		{
+			const auto& instr = instructions_[kk];
+			const bool sincos = instr.operation==SLPOperation::SinCos;
+			if (!needed[instr.result] && !(sincos && needed[instr.second]))
+				continue;
+			list.push_back(kk);
+			needed[instr.first] = 1;
+			if (!sincos)
+				needed[instr.second] = 1;
+		}
+		std::reverse(list.begin(), list.end());
+
+		block.have_instructions[outputs] = true;
+		return list;
+	}
+
+
+	void StraightLineProgram::SubstituteInputs(std::map<const node::Variable*, Var> const& substitutes)
+	{
+		auto substitute = [&](Var const& v)
+		{
+			auto found = substitutes.find(v.get());
+			return found==substitutes.end() ? v : found->second;
+		};
+
+		for (auto& iter : inputs_)
+			iter.first = substitute(iter.first);
+
+		for (auto& iter : differentiation_variables_)
+		{
+			auto found = substitutes.find(iter);
+			if (found!=substitutes.end())
+				iter = found->second.get();
+		}
+
+		if (path_variable_)
+			path_variable_ = substitute(path_variable_);
+	}
+
+
+
+	namespace {
+
+		constexpr size_t W = StraightLineProgram::BatchWidth;
+
+		// the operations which are not vectorized, on one point
+		dbl Elementary(SLPOperation op, dbl const& a, dbl const& b)
+		{
+			switch (op)
+			{
+				case SLPOperation::Power:
+					return pow(a, b);
+				case SLPOperation::Sqrt:
+					return sqrt(a);
+				case SLPOperation::Exp:
+					return exp(a);
+				case SLPOperation::Log:
+					return log(a);
+				case SLPOperation::Sin:
+					return sin(a);
+				case SLPOperation::Cos:
+					return cos(a);
+				case SLPOperation::Tan:
+					return tan(a);
+				case SLPOperation::ArcSin:
+					return asin(a);
+				case SLPOperation::ArcCos:
+					return acos(a);
+				case SLPOperation::ArcTan:
+					return atan(a);
+				default:
+					throw std::runtime_error("unexpected arithmetic operation in straight line program batch evaluation");
+			}
+		}
+
+
+		// the result register is never an operand, so the loops do not alias.  the exponential and trigonometric functions are taken through the real functions of the parts, in loops over the lanes which the compiler can vectorize with a vector math library.
+		template<typename S>
+		void ExecuteBatchInstruction(SLPInstruction const& instr, S * re, S * im)
+		{
+			S * const zr = re + instr.result*W;
+			S * const zi = im + instr.result*W;
+			const S * const ar = re + instr.first*W;
+			const S * const ai = im + instr.first*W;
+			const S * const br = re + instr.second*W;
+			const S * const bi = im + instr.second*W;
+
+			switch (instr.operation)
+			{
+				case SLPOperation::Add:
+					for (size_t l = 0; l < W; ++l)
+					{
+						zr[l] = ar[l] + br[l]; zi[l] = ai[l] + bi[l];
+					}
+					break;
+				case SLPOperation::Subtract:
+					for (size_t l = 0; l < W; ++l)
+					{
+						zr[l] = ar[l] - br[l]; zi[l] = ai[l] - bi[l];
+					}
+					break;
+				case SLPOperation::Multiply:
+					for (size_t l = 0; l < W; ++l)
+					{
+						zr[l] = ar[l]*br[l] - ai[l]*bi[l]; zi[l] = ar[l]*bi[l] + ai[l]*br[l];
+					}
+					break;
+				case SLPOperation::Divide:
+					for (size_t l = 0; l < W; ++l)
+					{
+						const S d = br[l]*br[l] + bi[l]*bi[l];
+						zr[l] = (ar[l]*br[l] + ai[l]*bi[l])/d; zi[l] = (ai[l]*br[l] - ar[l]*bi[l])/d;
+					}
+					break;
+				case SLPOperation::Negate:
+					for (size_t l = 0; l < W; ++l)
+					{
+						zr[l] = -ar[l]; zi[l] = -ai[l];
+					}
+					break;
+				case SLPOperation::Exp:
+					// e^(a+bi) = e^a (cos b + i sin b)
+					for (size_t l = 0; l < W; ++l)
+					{
+						const S m = std::exp(ar[l]);
+						zr[l] = m*std::cos(ai[l]); zi[l] = m*std::sin(ai[l]);
+					}
+					break;
+				case SLPOperation::Sin:
+				case SLPOperation::Cos:
+				case SLPOperation::SinCos:
+				{
+					// sin(a+bi) = sin a cosh b + i cos a sinh b, and cos(a+bi) = cos a cosh b - i sin a sinh b
+					S sa[W], ca[W], sb[W], cb[W];
+					for (size_t l = 0; l < W; ++l)
+					{
+						sa[l] = std::sin(ar[l]); ca[l] = std::cos(ar[l]);
+						sb[l] = std::sinh(ai[l]); cb[l] = std::cosh(ai[l]);
+					}
+					if (instr.operation!=SLPOperation::Cos)
+						for (size_t l = 0; l < W; ++l)
+						{
+							zr[l] = sa[l]*cb[l]; zi[l] = ca[l]*sb[l];
+						}
+					if (instr.operation!=SLPOperation::Sin)
+					{
+						S * const cr = instr.operation==SLPOperation::Cos ? zr : re + instr.second*W;
+						S * const ci = instr.operation==SLPOperation::Cos ? zi : im + instr.second*W;
+						for (size_t l = 0; l < W; ++l)
+						{
+							cr[l] = ca[l]*cb[l]; ci[l] = -sa[l]*sb[l];
+						}
+					}
+					break;
+				}
+				default:
+					for (size_t l = 0; l < W; ++l)
+					{
+						const dbl z = Elementary(instr.operation, dbl(ar[l], ai[l]), dbl(br[l], bi[l]));
+						zr[l] = S(z.real()); zi[l] = S(z.imag());
+					}
+			}
+		}
+
+
+
+		// the derivatives of an operation other than the arithmetic ones with respect to its operands, at one point.  c_b is zero for the unary operations.
+		void ElementaryDerivatives(SLPOperation op, dbl const& a, dbl const& b, dbl const& result, bool a_varies, bool b_varies, dbl & c_a, dbl & c_b)
+		{
+			c_b = dbl(0);
+			switch (op)
+			{
+				case SLPOperation::Power:
+					// the log term is skipped for constant exponents, as log(a) may not exist
+					c_a = a_varies ? b*pow(a, b - 1.) : dbl(0);
+					c_b = b_varies ? result*log(a) : dbl(0);
+					return;
+				case SLPOperation::Sqrt:
+					c_a = 1./(2.*result); return;
+				case SLPOperation::Exp:
+					c_a = result; return;
+				case SLPOperation::Log:
+					c_a = 1./a; return;
+				case SLPOperation::Sin:
+					c_a = cos(a); return;
+				case SLPOperation::Cos:
+					c_a = -sin(a); return;
+				case SLPOperation::Tan:
+					c_a = 1./(cos(a)*cos(a)); return;
+				case SLPOperation::ArcSin:
+					c_a = 1./sqrt(1. - a*a); return;
+				case SLPOperation::ArcCos:
+					c_a = -1./sqrt(1. - a*a); return;
+				case SLPOperation::ArcTan:
+					c_a = 1./(1. + a*a); return;
+				default:
+					throw std::runtime_error("unexpected arithmetic operation in straight line program batch differentiation");
+			}
+		}
+
+
+		// the value of an instruction whose result depends on the variables, and its partial derivatives, across the batch.  tangents are lane-contiguous, num_directions per register.
+		template<typename S>
+		void ExecuteBatchForwardInstruction(SLPInstruction const& instr, std::vector<bool> const& has_tangent, size_t num_directions,
+		                                    S * re, S * im, S * tre, S * tim)
+		{
+			const size_t stride = num_directions*W;
+			S * const dzr = tre + instr.result*stride;
+			S * const dzi = tim + instr.result*stride;
+			const S * const dar = tre + instr.first*stride;
+			const S * const dai = tim + instr.first*stride;
+			const S * const dbr = tre + instr.second*stride;
+			const S * const dbi = tim + instr.second*stride;
+
+			const S * const ar = re + instr.first*W;
+			const S * const ai = im + instr.first*W;
+			const S * const br = re + instr.second*W;
+			const S * const bi = im + instr.second*W;
+
+			switch (instr.operation)
+			{
+				case SLPOperation::Add:
+					for (size_t kk = 0; kk < stride; ++kk)
+					{
+						dzr[kk] = dar[kk] + dbr[kk]; dzi[kk] = dai[kk] + dbi[kk];
+					}
+					break;
+				case SLPOperation::Subtract:
+					for (size_t kk = 0; kk < stride; ++kk)
+					{
+						dzr[kk] = dar[kk] - dbr[kk]; dzi[kk] = dai[kk] - dbi[kk];
+					}
+					break;
+				case SLPOperation::Negate:
+					for (size_t kk = 0; kk < stride; ++kk)
+					{
+						dzr[kk] = -dar[kk]; dzi[kk] = -dai[kk];
+					}
+					break;
+				case SLPOperation::Multiply:
+					// d(ab) = b da + a db
+					for (size_t k = 0; k < num_directions; ++k)
+						for (size_t l = 0; l < W; ++l)
+						{
+							const size_t kk = k*W + l;
+							dzr[kk] = dar[kk]*br[l] - dai[kk]*bi[l] + ar[l]*dbr[kk] - ai[l]*dbi[kk];
+							dzi[kk] = dar[kk]*bi[l] + dai[kk]*br[l] + ar[l]*dbi[kk] + ai[l]*dbr[kk];
+						}
+					break;
+				case SLPOperation::Divide:
+				{
+					// d(a/b) = (da - (a/b) db) / b, with the value computed first
+					ExecuteBatchInstruction(instr, re, im);
+					const S * const zr = re + instr.result*W;
+					const S * const zi = im + instr.result*W;
+					S ir[W], ii[W];
+					for (size_t l = 0; l < W; ++l)
+					{
+						const S d = br[l]*br[l] + bi[l]*bi[l];
+						ir[l] = br[l]/d; ii[l] = -bi[l]/d;
+					}
+					for (size_t k = 0; k < num_directions; ++k)
+						for (size_t l = 0; l < W; ++l)
+						{
+							const size_t kk = k*W + l;
+							const S nr = dar[kk] - (zr[l]*dbr[kk] - zi[l]*dbi[kk]);
+							const S ni = dai[kk] - (zr[l]*dbi[kk] + zi[l]*dbr[kk]);
+							dzr[kk] = nr*ir[l] - ni*ii[l];
+							dzi[kk] = nr*ii[l] + ni*ir[l];
+						}
+					return;
+				}
+				case SLPOperation::SinCos:
+				{
+					// d sin a = cos a da, and d cos a = -sin a da, from the values computed first
+					ExecuteBatchInstruction(instr, re, im);
+					const S * const sr = re + instr.result*W;
+					const S * const si = im + instr.result*W;
+					const S * const cr = re + instr.second*W;
+					const S * const ci = im + instr.second*W;
+					S * const dcr = tre + instr.second*stride;
+					S * const dci = tim + instr.second*stride;
+					for (size_t k = 0; k < num_directions; ++k)
+						for (size_t l = 0; l < W; ++l)
+						{
+							const size_t kk = k*W + l;
+							dzr[kk] = cr[l]*dar[kk] - ci[l]*dai[kk];
+							dzi[kk] = cr[l]*dai[kk] + ci[l]*dar[kk];
+							dcr[kk] = si[l]*dai[kk] - sr[l]*dar[kk];
+							dci[kk] = -(sr[l]*dai[kk] + si[l]*dar[kk]);
+						}
+					return;
+				}
+				default:
+				{
+					// the value and the derivatives with respect to the operands, point by point, then the chain rule across the batch
+					ExecuteBatchInstruction(instr, re, im);
+					const S * const zr = re + instr.result*W;
+					const S * const zi = im + instr.result*W;
+					S car[W], cai[W], cbr[W], cbi[W];
+					for (size_t l = 0; l < W; ++l)
+					{
+						dbl c_a, c_b;
+						ElementaryDerivatives(instr.operation, dbl(ar[l], ai[l]), dbl(br[l], bi[l]), dbl(zr[l], zi[l]),
+						                      has_tangent[instr.first], has_tangent[instr.second], c_a, c_b);
+						car[l] = S(c_a.real()); cai[l] = S(c_a.imag());
+						cbr[l] = S(c_b.real()); cbi[l] = S(c_b.imag());
+					}
+					for (size_t k = 0; k < num_directions; ++k)
+						for (size_t l = 0; l < W; ++l)
+						{
+							const size_t kk = k*W + l;
+							dzr[kk] = car[l]*dar[kk] - cai[l]*dai[kk] + cbr[l]*dbr[kk] - cbi[l]*dbi[kk];
+							dzi[kk] = car[l]*dai[kk] + cai[l]*dar[kk] + cbr[l]*dbi[kk] + cbi[l]*dbr[kk];
+						}
+					return;
+				}
+			}
+
+			ExecuteBatchInstruction(instr, re, im);
+		}
+
+
+
+		// whether n is a number, or the negation of one, with an integer value which fits in an int
+		bool GetIntegerExponent(std::shared_ptr<Node> const& n, int & exponent)
+		{
+			if (auto u = std::dynamic_pointer_cast<NegateOperator>(n))
+			{
+				if (!GetIntegerExponent(u->first_child(), exponent))
+					return false;
+				exponent = -exponent;
+				return true;
+			}
+
+			detail::ExactValue value;
+			if (!detail::GetExactValue(n, value) || value.imag!=0 || denominator(value.real)!=1)
+				return false;
+			if (abs(value.real) > std::numeric_limits<int>::max())
+				return false;
+
+			exponent = int(numerator(value.real));
+			return true;
+		}
+	} // re: namespace
+
+
+	void jit::ExecuteBatchInstruction(SLPInstruction const& instr, double * re, double * im)
+	{
+		bertini::ExecuteBatchInstruction(instr, re, im);
+	}
+
+	void jit::ExecuteBatchForwardInstruction(SLPInstruction const& instr, std::vector<bool> const& has_tangent, size_t num_directions,
+	                                         double * re, double * im, double * tangents_re, double * tangents_im)
+	{
+		bertini::ExecuteBatchForwardInstruction(instr, has_tangent, num_directions, re, im, tangents_re, tangents_im);
+	}
+
+
+	bool StraightLineProgram::CompileNative() const
+	{
+		if (native_)
+			return true;
+
+		const std::vector<SLPInstruction> segment(instructions_.begin(), instructions_.begin() + segment_end_[FunctionSegment]);
+		native_ = jit::Compile(segment, has_tangent_, NumDirections());
+		return bool(native_);
+	}
+
+
+
+	void StraightLineProgram::EvalFunctionsBatch(Mat<dbl> const& points, Mat<dbl> & function_values) const
+	{
+		EvalFunctionsBatch(points, VariableGroup(), Mat<dbl>(0, points.cols()), function_values);
+	}
+
+
+	void StraightLineProgram::EvalFunctionsBatch(Mat<dbl> const& points, VariableGroup const& lane_inputs, Mat<dbl> const& lane_input_values, Mat<dbl> & function_values) const
+	{
+		if (size_t(points.rows())!=NumDirections())
+			throw std::runtime_error("evaluating straight line program at batch of points, but number of rows of points (" + std::to_string(points.rows()) + ") doesn't match number of variables and path variable (" + std::to_string(NumDirections()) + ")");
+		if (size_t(lane_input_values.rows())!=lane_inputs.size() || lane_input_values.cols()!=points.cols())
+			throw std::runtime_error("evaluating straight line program at batch of points, but the values of the inputs varying by point are " + std::to_string(lane_input_values.rows()) + " by " + std::to_string(lane_input_values.cols()) + ", not " + std::to_string(lane_inputs.size()) + " by " + std::to_string(points.cols()));
+
+		const auto lane_registers = LaneInputRegisters(lane_inputs);
+
+		batch_real_.resize(num_registers_*W);
+		batch_imag_.resize(num_registers_*W);
+		double * const re = batch_real_.data();
+		double * const im = batch_imag_.data();
+		LoadBatchConstants(re, im);
+
+		const auto num_points = points.cols();
+		function_values.resize(NumFunctions(), num_points);
+
+		const auto end = segment_end_[FunctionSegment];
+		for (Eigen::Index begin = 0; begin < num_points; begin += W)
+		{
+			// the unused lanes of a partial last batch repeat its first point
+			for (size_t ii = 0; ii < inputs_.size(); ++ii)
+			{
+				if (input_directions_[ii] < 0)
+					continue;
+				const auto reg = inputs_[ii].second;
+				for (size_t l = 0; l < W; ++l)
+				{
+					const auto col = begin + Eigen::Index(l);
+					const auto& value = points(input_directions_[ii], col < num_points ? col : begin);
+					re[reg*W + l] = value.real();
+					im[reg*W + l] = value.imag();
+				}
+			}
+			for (size_t ii = 0; ii < lane_registers.size(); ++ii)
+			{
+				const auto reg = lane_registers[ii];
+				if (reg==no_register_)
+					continue;
+				for (size_t l = 0; l < W; ++l)
+				{
+					const auto col = begin + Eigen::Index(l);
+					const auto& value = lane_input_values(ii, col < num_points ? col : begin);
+					re[reg*W + l] = value.real();
+					im[reg*W + l] = value.imag();
+				}
+			}
+
+			if (native_)
+				native_->values(re, im);
+			else
+				for (size_t ii = 0; ii < end; ++ii)
+					ExecuteBatchInstruction(instructions_[ii], re, im);
+
+			const auto num_lanes = std::min(Eigen::Index(W), num_points - begin);
+			for (size_t ii = 0; ii < function_outputs_.size(); ++ii)
+			{
+				const auto reg = function_outputs_[ii];
+				for (Eigen::Index l = 0; l < num_lanes; ++l)
+					function_values(ii, begin + l) = dbl(re[reg*W + l], im[reg*W + l]);
+			}
+		}
+	}
+
+
+
+	void StraightLineProgram::EvalForwardModeBatch(BatchLanes const& inputs, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const
+	{
+		EvalForwardModeBatch(inputs, VariableGroup(), BatchLanes(), function_values, jacobian, time_derivatives);
+	}
+
+
+	void StraightLineProgram::EvalForwardModeBatch(BatchLanes const& inputs, VariableGroup const& lane_inputs, BatchLanes const& lane_input_values, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const
+	{
+		EvalForwardModeBatchIn(inputs, lane_inputs, lane_input_values, function_values, jacobian, time_derivatives,
+		                       batch_real_, batch_imag_, batch_tangents_real_, batch_tangents_imag_);
+	}
+
+
+	void StraightLineProgram::EvalForwardModeBatch(FloatBatchLanes const& inputs, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const
+	{
+		EvalForwardModeBatch(inputs, VariableGroup(), FloatBatchLanes(), function_values, jacobian, time_derivatives);
+	}
+
+
+	void StraightLineProgram::EvalForwardModeBatch(FloatBatchLanes const& inputs, VariableGroup const& lane_inputs, FloatBatchLanes const& lane_input_values, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const
+	{
+		EvalForwardModeBatchIn(inputs, lane_inputs, lane_input_values, function_values, jacobian, time_derivatives,
+		                       float_batch_real_, float_batch_imag_, float_batch_tangents_real_, float_batch_tangents_imag_);
+	}
+
+
+	namespace {
+
+		// run the function segment with its tangents in native code, if it has been compiled, which it is only for double precision
+		bool RunNativeForward(jit::NativeKernels const* native, double * re, double * im, double * tre, double * tim)
+		{
+			if (!native)
+				return false;
+			native->forward(re, im, tre, tim);
+			return true;
+		}
+
+		bool RunNativeForward(jit::NativeKernels const*, float *, float *, float *, float *)
+		{
+			return false;
+		}
+
+	} // re: namespace
+
+
+	template<typename S>
+	void StraightLineProgram::EvalForwardModeBatchIn(BasicBatchLanes<S> const& inputs, VariableGroup const& lane_inputs, BasicBatchLanes<S> const& lane_input_values,
+	                                                 BasicBatchLanes<S> & function_values, BasicBatchLanes<S> & jacobian, BasicBatchLanes<S> & time_derivatives,
+	                                                 std::vector<S> & real, std::vector<S> & imag, std::vector<S> & tangents_real, std::vector<S> & tangents_imag) const
+	{
+		if (!path_variable_)
+			throw std::runtime_error("evaluating time derivative of straight line program compiled without path variable");
+		if (inputs.NumEntries()!=NumDirections())
+			throw std::runtime_error("evaluating straight line program at batch of points, but number of inputs (" + std::to_string(inputs.NumEntries()) + ") doesn't match number of variables and path variable (" + std::to_string(NumDirections()) + ")");
+		if (lane_input_values.NumEntries()!=lane_inputs.size())
+			throw std::runtime_error("evaluating straight line program at batch of points, but there are " + std::to_string(lane_input_values.NumEntries()) + " values of the inputs varying by lane, for " + std::to_string(lane_inputs.size()) + " inputs");
+
+		const auto lane_registers = LaneInputRegisters(lane_inputs);
+		const auto num_directions = NumDirections();
+		const size_t stride = num_directions*W;
+
+		real.resize(num_registers_*W);
+		imag.resize(num_registers_*W);
+		S * const re = real.data();
+		S * const im = imag.data();
+		LoadBatchConstants(re, im);
+
+		// the tangents of registers not depending on the variables stay zero, and those of the variables are unit vectors
+		if (tangents_real.size()!=num_registers_*stride)
+		{
+			tangents_real.assign(num_registers_*stride, S(0));
+			tangents_imag.assign(num_registers_*stride, S(0));
+			for (size_t ii = 0; ii < inputs_.size(); ++ii)
+				if (input_directions_[ii]>=0)
+					std::fill_n(tangents_real.begin() + inputs_[ii].second*stride + input_directions_[ii]*W, W, S(1));
+		}
+		S * const tre = tangents_real.data();
+		S * const tim = tangents_imag.data();
+
+		for (size_t ii = 0; ii < inputs_.size(); ++ii)
+		{
+			if (input_directions_[ii] < 0)
+				continue;
+			const auto reg = inputs_[ii].second;
+			std::copy_n(inputs.real.begin() + input_directions_[ii]*W, W, re + reg*W);
+			std::copy_n(inputs.imag.begin() + input_directions_[ii]*W, W, im + reg*W);
+		}
+		for (size_t ii = 0; ii < lane_registers.size(); ++ii)
+			if (lane_registers[ii]!=no_register_)
+			{
+				std::copy_n(lane_input_values.real.begin() + ii*W, W, re + lane_registers[ii]*W);
+				std::copy_n(lane_input_values.imag.begin() + ii*W, W, im + lane_registers[ii]*W);
+			}
+
+		const auto end = segment_end_[FunctionSegment];
+		if (!RunNativeForward(native_.get(), re, im, tre, tim))
+			for (size_t ii = 0; ii < end; ++ii)
+			{
+				const auto& instr = instructions_[ii];
+				if (has_tangent_[instr.result])
+					ExecuteBatchForwardInstruction(instr, has_tangent_, num_directions, re, im, tre, tim);
+				else
+					ExecuteBatchInstruction(instr, re, im);
+			}
+
+		const auto num_functions = NumFunctions();
+		function_values.Resize(num_functions);
+		jacobian.Resize(num_functions*num_variables_);
+		time_derivatives.Resize(num_functions);
+		for (size_t ii = 0; ii < num_functions; ++ii)
+		{
+			const auto reg = function_outputs_[ii];
+			std::copy_n(re + reg*W, W, function_values.real.begin() + ii*W);
+			std::copy_n(im + reg*W, W, function_values.imag.begin() + ii*W);
+			std::copy_n(tre + reg*stride, num_variables_*W, jacobian.real.begin() + ii*num_variables_*W);
+			std::copy_n(tim + reg*stride, num_variables_*W, jacobian.imag.begin() + ii*num_variables_*W);
+			std::copy_n(tre + reg*stride + num_variables_*W, W, time_derivatives.real.begin() + ii*W);
+			std::copy_n(tim + reg*stride + num_variables_*W, W, time_derivatives.imag.begin() + ii*W);
+		}
+	}
+
+
+
+	template<typename S>
+	void StraightLineProgram::LoadBatchConstants(S * re, S * im) const
+	{
+		auto broadcast = [re, im](size_t reg, dbl const& value)
+		{
+			std::fill(re + reg*W, re + (reg+1)*W, S(value.real()));
+			std::fill(im + reg*W, im + (reg+1)*W, S(value.imag()));
+		};
+
+		const auto& r = std::get<std::vector<dbl> >(registers_);
+		broadcast(zero_, dbl(0));
+		broadcast(one_, dbl(1));
+		for (const auto& iter : constants_)
+			broadcast(iter.second, r[iter.second]);
+		for (size_t ii = 0; ii < inputs_.size(); ++ii)
+			if (input_directions_[ii] < 0)
+				broadcast(inputs_[ii].second, inputs_[ii].first->Eval<dbl>());
+	}
+
+
+
+	std::vector<size_t> StraightLineProgram::LaneInputRegisters(VariableGroup const& lane_inputs) const
+	{
+		std::vector<size_t> registers(lane_inputs.size(), size_t(no_register_));
+		for (size_t kk = 0; kk < lane_inputs.size(); ++kk)
+			for (size_t ii = 0; ii < inputs_.size(); ++ii)
+				if (inputs_[ii].first==lane_inputs[kk])
+				{
+					if (input_directions_[ii] >= 0)
+						throw std::runtime_error("evaluating straight line program with inputs varying by lane, but " + lane_inputs[kk]->name() + " is a variable or the path variable, whose values are the points");
+					registers[kk] = inputs_[ii].second;
+				}
+		return registers;
+	}
+
+
+
+	bool StraightLineProgram::DependsOnDifferential(Nd const& n)
+	{
+		auto found = depends_on_differential_.find(n.get());
+		if (found!=depends_on_differential_.end())
+			return found->second;
+
+		bool depends = false;
+		if (std::dynamic_pointer_cast<Differential>(n))
+			depends = true;
+		else if (auto f = std::dynamic_pointer_cast<Function>(n))
+			depends = DependsOnDifferential(f->entry_node());
+		else if (auto u = std::dynamic_pointer_cast<UnaryOperator>(n))
+			depends = DependsOnDifferential(u->first_child());
+		else if (auto m = std::dynamic_pointer_cast<NaryOperator>(n))
+		{
+			for (const auto& c : m->children())
+				if (DependsOnDifferential(c))
+				{
+					depends = true;
+					break;
+				}
+		}
+		else if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+			depends = DependsOnDifferential(p->base()) || DependsOnDifferential(p->exponent());
+
+		depends_on_differential_[n.get()] = depends;
+		return depends;
+	}
+
+
+
+	size_t StraightLineProgram::Lower(Nd const& n, int diff_index, Segment s)
+	{
+		// a node without differentials in it has the same value no matter which variable we differentiate with respect to, so it can be shared across all entries in a segment.  the function segment is always run first, so its registers can be used from any segment.
+		const int context = DependsOnDifferential(n) ? diff_index : no_differentiation_ - int(s);
+
+		if (context < 0)
+		{
+			auto found = lowered_.find(std::make_pair(n.get(), no_differentiation_ - int(FunctionSegment)));
+			if (found!=lowered_.end())
+				return found->second;
+		}
+
+		auto key = std::make_pair(n.get(), context);
+		auto found = lowered_.find(key);
+		if (found!=lowered_.end())
+			return found->second;
+
+		auto reg = LowerOperator(n, diff_index, s);
+		lowered_[key] = reg;
+		return reg;
+	}
+
+
+
+	size_t StraightLineProgram::LowerOperator(Nd const& n, int diff_index, Segment s)
+	{
+		// leaves
+		if (auto v = std::dynamic_pointer_cast<Variable>(n))
+			return Input(v);
+
+		if (auto d = std::dynamic_pointer_cast<Differential>(n))
+		{
+			if (diff_index!=no_differentiation_ && d->GetVariable().get()==differentiation_variables_[diff_index])
+				return one_;
+			else
+				return zero_;
+		}
+
+		if (std::dynamic_pointer_cast<Number>(n) || std::dynamic_pointer_cast<special_number::Pi>(n) || std::dynamic_pointer_cast<special_number::E>(n))
+			return Constant(n);
+
+		// roots are pass-through
+		if (auto f = std::dynamic_pointer_cast<Function>(n))
+		{
+			f->EnsureNotEmpty();
+			return Lower(f->entry_node(), diff_index, s);
+		}
+
+		// n-ary operators
+		if (auto sum = std::dynamic_pointer_cast<SumOperator>(n))
+		{
+			const auto& children = sum->children();
+			const auto& signs = sum->children_signs();
+
+			size_t result = zero_;
+			for (size_t ii = 0; ii < children.size(); ++ii)
+				result = AddOrSubtract(result, Lower(children[ii], diff_index, s), signs[ii]);
+			return result;
+		}
+
+		if (auto mult = std::dynamic_pointer_cast<MultOperator>(n))
+		{
+			const auto& children = mult->children();
+			const auto& mult_or_div = mult->children_mult_or_div();
+
+			size_t result = one_;
+			for (size_t ii = 0; ii < children.size(); ++ii)
+			{
+				auto c = Lower(children[ii], diff_index, s);
+				result = mult_or_div[ii] ? Multiply(result, c) : Divide(result, c);
+			}
+			return result;
+		}
+
+		if (auto p = std::dynamic_pointer_cast<PowerOperator>(n))
+		{
+			// the parser makes x^2 a PowerOperator.  integer powers are much cheaper as multiplications.
+			int exponent;
+			if (GetIntegerExponent(p->exponent(), exponent))
+				return IntegerPower(Lower(p->base(), diff_index, s), exponent, s);
+			return Emit(SLPOperation::Power, Lower(p->base(), diff_index, s), Lower(p->exponent(), diff_index, s));
+		}
+
+		// unary operators
+		if (auto p = std::dynamic_pointer_cast<IntegerPowerOperator>(n))
+			return IntegerPower(Lower(p->first_child(), diff_index, s), p->exponent(), s);
+
+		if (auto u = std::dynamic_pointer_cast<NegateOperator>(n))
+			return Negate(Lower(u->first_child(), diff_index, s));
+
+		auto unary = std::dynamic_pointer_cast<UnaryOperator>(n);
+		if (!unary)
+			throw UnsupportedNodeError("unable to compile node of type " + boost::typeindex::type_id_runtime(*n).pretty_name() + " into straight line program");
+
+		auto child = Lower(unary->first_child(), diff_index, s);
+
+		if (std::dynamic_pointer_cast<SqrtOperator>(n))
+			return Emit(SLPOperation::Sqrt, child);
+		if (std::dynamic_pointer_cast<ExpOperator>(n))
+			return Emit(SLPOperation::Exp, child);
+		if (std::dynamic_pointer_cast<LogOperator>(n))
+			return Emit(SLPOperation::Log, child);
+		if (std::dynamic_pointer_cast<SinOperator>(n))
+			return Emit(SLPOperation::Sin, child);
+		if (std::dynamic_pointer_cast<CosOperator>(n))
+			return Emit(SLPOperation::Cos, child);
+		if (std::dynamic_pointer_cast<TanOperator>(n))
+			return Emit(SLPOperation::Tan, child);
+		if (std::dynamic_pointer_cast<ArcSinOperator>(n))
+			return Emit(SLPOperation::ArcSin, child);
+		if (std::dynamic_pointer_cast<ArcCosOperator>(n))
+			return Emit(SLPOperation::ArcCos, child);
+		if (std::dynamic_pointer_cast<ArcTanOperator>(n))
+			return Emit(SLPOperation::ArcTan, child);
+
+		throw UnsupportedNodeError("unable to compile node of type " + boost::typeindex::type_id_runtime(*n).pretty_name() + " into straight line program");
+	}
+
+
+
+	size_t StraightLineProgram::NewRegister()
+	{
+		return num_registers_++;
+	}
+
+
+	size_t StraightLineProgram::Emit(SLPOperation op, size_t first, size_t second)
+	{
+		auto result = NewRegister();
+		instructions_.push_back(SLPInstruction{op, result, first, second});
+		return result;
+	}
+
+
+	size_t StraightLineProgram::AddOrSubtract(size_t a, size_t b, bool add)
+	{
+		if (b==zero_)
+			return a;
+		if (a==zero_)
+			return add ? b : Negate(b);
+		return Emit(add ? SLPOperation::Add : SLPOperation::Subtract, a, b);
+	}
+
+
+	// An exact zero is taken as a strong zero: 0*x and 0/x fold to 0 whatever x is, even where the trees would give NaN, at x infinite, or x zero for the quotient.  Folding them is what keeps the derivative segments sparse, as the Differential's lower to zero_.
+	size_t StraightLineProgram::Multiply(size_t a, size_t b)
+	{
+		if (a==zero_ || b==zero_)
+			return zero_;
+		if (a==one_)
+			return b;
+		if (b==one_)
+			return a;
+		return Emit(SLPOperation::Multiply, a, b);
+	}
+
+
+	size_t StraightLineProgram::Divide(size_t a, size_t b)
+	{
+		if (a==zero_)
+			return zero_;
+		if (b==one_)
+			return a;
+		return Emit(SLPOperation::Divide, a, b);
+	}
+
+
+	size_t StraightLineProgram::Negate(size_t a)
+	{
+		if (a==zero_)
+			return zero_;
+		return Emit(SLPOperation::Negate, a);
+	}
+
+
+	size_t StraightLineProgram::IntegerPower(size_t a, int exponent, Segment s)
+	{
+		if (exponent==0 || a==one_)
+			return one_;
+		if (exponent==1)
+			return a;
+		if (a==zero_ && exponent>0)
+			return zero_;
+		if (exponent<0)
+			return Divide(one_, IntegerPower(a, -exponent, s));
+
+		// powers computed in the function segment are available to every segment
+		for (auto segment : {FunctionSegment, s})
+		{
+			auto found = powers_.find(std::make_tuple(a, exponent, segment));
+			if (found!=powers_.end())
+				return found->second;
+		}
+
+		// square and multiply, through the table, so that all the powers of a register share their partial products.  x^2, x^3, and x^5 together take four multiplications.
+		auto reg = exponent%2==0 ? Multiply(IntegerPower(a, exponent/2, s), IntegerPower(a, exponent/2, s))
+		                         : Multiply(IntegerPower(a, exponent-1, s), a);
+		powers_[std::make_tuple(a, exponent, s)] = reg;
+		return reg;
+	}
+
+
+	size_t StraightLineProgram::Input(Var const& v)
+	{
+		auto found = input_registers_.find(v.get());
+		if (found!=input_registers_.end())
+			return found->second;
+
+		auto reg = NewRegister();
+		inputs_.push_back(std::make_pair(v, reg));
+		input_registers_[v.get()] = reg;
+		return reg;
+	}
+
+
+	size_t StraightLineProgram::Constant(Nd const& n)
+	{
+		auto found = constant_registers_.find(n.get());
+		if (found!=constant_registers_.end())
+			return found->second;
+
+		size_t reg;
+		auto as_int = std::dynamic_pointer_cast<Integer>(n);
+		if (as_int && as_int->Eval<dbl>()==dbl(0))
+			reg = zero_;
+		else if (as_int && as_int->Eval<dbl>()==dbl(1))
+			reg = one_;
+		else
+		{
+			reg = NewRegister();
+			constants_.push_back(std::make_pair(n, reg));
+		}
+
+		constant_registers_[n.get()] = reg;
+		return reg;
+	}
+
+
+	void StraightLineProgram::FuseSinCos()
+	{
+		const auto segment_of = [&](size_t ii)
+		{
+			return ii < segment_end_[FunctionSegment] ? FunctionSegment : ii < segment_end_[JacobianSegment] ? JacobianSegment : TimeDerivativeSegment;
+		};
+
+		// the earliest unfused sine and cosine of each register, by index
+		std::map<size_t, size_t> sines, cosines;
+		std::vector<char> removed(instructions_.size(), 0);
+		for (size_t ii = 0; ii < instructions_.size(); ++ii)
+		{
+			const auto& instr = instructions_[ii];
+			const bool sine = instr.operation==SLPOperation::Sin;
+			if (!sine && instr.operation!=SLPOperation::Cos)
+				continue;
+
+			auto& partners = sine ? cosines : sines;
+			auto found = partners.find(instr.first);
+			if (found==partners.end() || (segment_of(found->second)!=FunctionSegment && segment_of(found->second)!=segment_of(ii)))
+			{
+				(sine ? sines : cosines).emplace(instr.first, ii);
+				continue;
+			}
+
+			auto& earlier = instructions_.Mutable(found->second);
+			earlier = SLPInstruction{SLPOperation::SinCos, sine ? instr.result : earlier.result, instr.first, sine ? earlier.result : instr.result};
+			removed[ii] = 1;
+			partners.erase(found);
+		}
+
+		std::vector<SLPInstruction> kept;
+		std::array<size_t,3> kept_end;
+		for (size_t ii = 0, s = FunctionSegment; ii <= instructions_.size(); ++ii)
+		{
+			for (; s <= TimeDerivativeSegment && segment_end_[s]==ii; ++s)
+				kept_end[s] = kept.size();
+			if (ii < instructions_.size() && !removed[ii])
+				kept.push_back(instructions_[ii]);
+		}
+
+		instructions_.swap(kept);
+		segment_end_ = kept_end;
+	}
+
+
+	void StraightLineProgram::NumberRegisters()
+	{
+		std::vector<size_t> renumbered(num_registers_, no_register_);
+		size_t next = 0;
+		auto place = [&](size_t reg)
+		{
+			if (renumbered[reg]==no_register_)
+				renumbered[reg] = next++;
+		};
+
+		place(zero_);
+		place(one_);
+		for (const auto& iter : inputs_)
+			place(iter.second);
+		for (const auto& iter : constants_)
+			place(iter.second);
+		for (auto outputs : {&function_outputs_, &jacobian_outputs_, &time_derivative_outputs_})
+			for (auto reg : *outputs)
+				place(reg);
+		for (const auto& instr : instructions_)
+		{
+			place(instr.result);
+			if (instr.operation==SLPOperation::SinCos)
+				place(instr.second);
+		}
+		for (size_t reg = 0; reg < num_registers_; ++reg)
+			place(reg);
+
+		std::vector<SLPInstruction> instructions(instructions_.begin(), instructions_.end());
+		for (auto& instr : instructions)
+		{
+			instr.result = renumbered[instr.result];
+			instr.first = renumbered[instr.first];
+			instr.second = renumbered[instr.second];
+		}
+		instructions_.swap(instructions);
+
+		for (auto& iter : inputs_)
+			iter.second = renumbered[iter.second];
+		for (auto& iter : constants_)
+			iter.second = renumbered[iter.second];
+		for (auto outputs : {&function_outputs_, &jacobian_outputs_, &time_derivative_outputs_})
+			for (auto& reg : *outputs)
+				reg = renumbered[reg];
+	}
+
+
+	void StraightLineProgram::ScheduleRegisters()
+	{
+		auto schedule = std::make_shared<RunSchedule>();
+		const auto num_instructions = instructions_.size();
+
+		// the registers held through an evaluation, which are to be numbered first
+		std::vector<char> held(num_registers_, 0);
+		held[zero_] = held[one_] = 1;
+		for (const auto& iter : inputs_)
+			held[iter.second] = 1;
+		for (const auto& iter : constants_)
+			held[iter.second] = 1;
+		for (auto outputs : {&function_outputs_, &jacobian_outputs_, &time_derivative_outputs_})
+			for (auto reg : *outputs)
+				held[reg] = 1;
+		const auto num_held = static_cast<size_t>(std::count(held.begin(), held.end(), 1));
+
+		if (std::find(held.begin() + num_held, held.end(), 1)!=held.end())
+		{
+			schedule->instructions.assign(instructions_.begin(), instructions_.end());
+			schedule->num_registers = num_registers_;
+			run_schedule_ = schedule;
+			return;
+		}
+
+		const auto binary = [](SLPInstruction const& instr)
+		{
+			const auto op = instr.operation;
+			return op==SLPOperation::Add || op==SLPOperation::Subtract || op==SLPOperation::Multiply || op==SLPOperation::Divide || op==SLPOperation::Power;
+		};
+
+		// the instruction writing each register, and the first in the same segment to read it
+		const size_t none = no_register_;
+		std::vector<size_t> writer(num_registers_, none);
+		for (size_t ii = 0; ii < num_instructions; ++ii)
+		{
+			writer[instructions_[ii].result] = ii;
+			if (instructions_[ii].operation==SLPOperation::SinCos)
+				writer[instructions_[ii].second] = ii;
+		}
+
+		std::vector<size_t> first_reader(num_instructions, none);
+		for (int s = FunctionSegment; s <= TimeDerivativeSegment; ++s)
+			for (size_t ii = SegmentBegin(Segment(s)); ii < segment_end_[s]; ++ii)
+			{
+				const auto& instr = instructions_[ii];
+				for (auto reg : {instr.first, instr.second})
+				{
+					if (reg==instr.second && !binary(instr))
+						continue;
+					const auto w = writer[reg];
+					if (w!=none && w >= SegmentBegin(Segment(s)) && first_reader[w]==none)
+						first_reader[w] = ii;
+				}
+			}
+
+		// each instruction read in its segment is put just before the first instruction put which reads it
+		std::vector<size_t> order;
+		order.reserve(num_instructions);
+		std::vector<char> placed(num_instructions, 0);
+		std::vector< std::pair<size_t, bool> > stack;
+		auto put = [&](size_t root)
+		{
+			stack.emplace_back(root, false);
+			while (!stack.empty())
+			{
+				const auto ii = stack.back().first;
+				if (stack.back().second)
+				{
+					stack.pop_back();
+					if (!placed[ii])
+					{
+						placed[ii] = 1;
+						order.push_back(ii);
+					}
+					continue;
+				}
+				stack.back().second = true;
+
+				const auto& instr = instructions_[ii];
+				const size_t operands[2] = {instr.first, binary(instr) ? instr.second : none};
+				for (int kk = 1; kk >= 0; --kk)
+				{
+					if (operands[kk]==none)
+						continue;
+					const auto w = writer[operands[kk]];
+					if (w!=none && !placed[w] && first_reader[w]!=none)
+						stack.emplace_back(w, false);
+				}
+			}
+		};
+		for (size_t ii = 0; ii < num_instructions; ++ii)
+			if (first_reader[ii]==none)
+				put(ii);
+
+		// the last read of each register, in the new order
+		std::vector<size_t> last_read(num_registers_, none);
+		for (size_t kk = 0; kk < num_instructions; ++kk)
+		{
+			const auto& instr = instructions_[order[kk]];
+			last_read[instr.first] = kk;
+			if (binary(instr))
+				last_read[instr.second] = kk;
+		}
+
+		std::vector<size_t> slot(num_registers_, none);
+		for (size_t reg = 0; reg < num_held; ++reg)
+			slot[reg] = reg;
+		std::vector<size_t> free_slots;
+		size_t num_slots = num_held;
+
+		auto take = [&](size_t reg)
+		{
+			if (held[reg])
+				return;
+			if (free_slots.empty())
+				slot[reg] = num_slots++;
+			else
+			{
+				slot[reg] = free_slots.back();
+				free_slots.pop_back();
+			}
+		};
+		auto release_if_last = [&](size_t reg, size_t kk)
+		{
+			if (!held[reg] && last_read[reg]==kk)
+				free_slots.push_back(slot[reg]);
+		};
+
+		schedule->instructions.reserve(num_instructions);
+		for (size_t kk = 0; kk < num_instructions; ++kk)
+		{
+			const auto& instr = instructions_[order[kk]];
+			const bool sincos = instr.operation==SLPOperation::SinCos;
+
+			// the results take their registers before the operands give theirs up, so none is written while being read
+			take(instr.result);
+			if (sincos)
+				take(instr.second);
+			schedule->instructions.push_back(SLPInstruction{instr.operation, slot[instr.result], slot[instr.first], slot[instr.second]});
+
+			release_if_last(instr.first, kk);
+			if (binary(instr) && instr.second!=instr.first)
+				release_if_last(instr.second, kk);
+
+			// a result never read, as the unused half of a SinCos, is dead at once
+			release_if_last(instr.result, none);
+			if (sincos)
+				release_if_last(instr.second, none);
+		}
+
+		schedule->num_registers = num_slots;
+		run_schedule_ = schedule;
+	}
+
+
+
+	void StraightLineProgram::WriteCode(std::ostream & out, VariableGroup const& input_order, unsigned digits) const
+	{
+		// constants 0 and 1 are the registers always holding them, and the rest follow in order
+		std::vector<std::string> sources(num_registers_);
+		sources[zero_] = "constants[0]";
+		sources[one_] = "constants[1]";
+		for (size_t ii = 0; ii < constants_.size(); ++ii)
+			sources[constants_[ii].second] = "constants[" + std::to_string(ii+2) + "]";
+
+		for (const auto& iter : inputs_)
+		{
+			auto found = std::find(input_order.begin(), input_order.end(), iter.first);
+			if (found==input_order.end())
+				throw std::runtime_error("writing straight line program as code, but its input " + iter.first->name() + " is not among the inputs of the generated kernels");
+			sources[iter.second] = "inputs[" + std::to_string(found - input_order.begin()) + "]";
+		}
+
+		out << "\tstatic std::vector< std::pair<char const*, char const*> > Constants()\n\t{\n\t\treturn {\n";
+		out << "\t\t\t{\"0\", \"0\"},\n\t\t\t{\"1\", \"0\"}";
+		{
+			const auto previous = DefaultPrecision();
+			DefaultPrecision(digits);
+			std::lock_guard<std::mutex> lock(node::SharedConstantsMutex());
+			for (const auto& iter : constants_)
+			{
+				iter.first->precision(digits);
+				iter.first->Reset();
+				const mpfr value = iter.first->Eval<mpfr>();
+				out << ",\n\t\t\t{\"" << value.real().str(digits, std::ios_base::scientific) << "\", \"" << value.imag().str(digits, std::ios_base::scientific) << "\"}";
+				iter.first->precision(precision_);
+				iter.first->Reset();
+			}
+			DefaultPrecision(previous);
+		}
+		out << "\n\t\t};\n\t}\n";
+
+		const auto binary = [](SLPOperation op)
+		{
+			return op==SLPOperation::Add || op==SLPOperation::Subtract || op==SLPOperation::Multiply || op==SLPOperation::Divide || op==SLPOperation::Power;
+		};
+
+		const auto write_kernel = [&](std::string const& name, std::string const& output_name, std::vector<size_t> const& outputs)
+		{
+			// walk backward from the outputs, keeping the instructions on which they depend, as BlockInstructions does
+			std::vector<bool> needed(num_registers_, false);
+			for (auto reg : outputs)
+				needed[reg] = true;
+			std::vector<size_t> kept;
+			for (size_t ii = instructions_.size(); ii-- > 0;)
+			{
+				const auto& instr = instructions_[ii];
+				if (!needed[instr.result] && !(instr.operation==SLPOperation::SinCos && needed[instr.second]))
+					continue;
+				kept.push_back(ii);
+				needed[instr.first] = true;
+				if (binary(instr.operation))
+					needed[instr.second] = true;
+			}
+			std::reverse(kept.begin(), kept.end());
+
+			out << "\n\ttemplate<typename T>\n\tstatic void " << name << "(T const* inputs, T const* constants, T* " << output_name << ")\n\t{\n";
+			for (size_t reg = 0; reg < num_registers_; ++reg)
+				if (needed[reg] && !sources[reg].empty())
+					out << "\t\tconst T& r" << reg << " = " << sources[reg] << ";\n";
+			for (auto ii : kept)
+			{
+				const auto& instr = instructions_[ii];
+				const auto a = "r" + std::to_string(instr.first), b = "r" + std::to_string(instr.second);
+				out << "\t\tconst T r" << instr.result << " = ";
+				switch (instr.operation)
+				{
+					case SLPOperation::Add: out << a << " + " << b; break;
+					case SLPOperation::Subtract: out << a << " - " << b; break;
+					case SLPOperation::Multiply: out << a << " * " << b; break;
+					case SLPOperation::Divide: out << a << " / " << b; break;
+					case SLPOperation::Negate: out << "-" << a; break;
+					case SLPOperation::Power: out << "pow(" << a << ", " << b << ")"; break;
+					case SLPOperation::Sqrt: out << "sqrt(" << a << ")"; break;
+					case SLPOperation::Exp: out << "exp(" << a << ")"; break;
+					case SLPOperation::Log: out << "log(" << a << ")"; break;
+					case SLPOperation::Sin: out << "sin(" << a << ")"; break;
+					case SLPOperation::Cos: out << "cos(" << a << ")"; break;
+					case SLPOperation::Tan: out << "tan(" << a << ")"; break;
+					case SLPOperation::ArcSin: out << "asin(" << a << ")"; break;
+					case SLPOperation::ArcCos: out << "acos(" << a << ")"; break;
+					case SLPOperation::ArcTan: out << "atan(" << a << ")"; break;
+					case SLPOperation::SinCos: out << "sin(" << a << ");\n\t\tconst T " << b << " = cos(" << a << ")"; break;
+				}
+				out << ";\n";
+			}
+			for (size_t ii = 0; ii < outputs.size(); ++ii)
+				out << "\t\t" << output_name << "[" << ii << "] = r" << outputs[ii] << ";\n";
+			out << "\t}\n";
+		};
+
+		write_kernel("Eval", "function_values", function_outputs_);
+		write_kernel("Jacobian", "jacobian", jacobian_outputs_);
+		write_kernel("TimeDerivative", "time_derivatives", time_derivative_outputs_);
+	}
+
+
+
+	namespace {
+
+		// the sizes leading an image, as 64-bit words, followed by the instructions, then the tables, each padded to a multiple of 8 bytes
+		struct ImageHeader
+		{
+			std::uint64_t num_instructions;
+			std::uint64_t segment_end[3];
+			std::uint64_t num_registers;
+			std::uint64_t num_variables;
+			std::uint64_t have_jacobian;
+			std::uint64_t path_variable; // its input number, or no_image_id
+			std::uint64_t num_inputs;
+			std::uint64_t num_constants;
+			std::uint64_t num_function_outputs;
+			std::uint64_t num_jacobian_outputs;
+			std::uint64_t num_time_derivative_outputs;
+		};
+
+		const std::uint64_t no_image_id = std::numeric_limits<std::uint64_t>::max();
+
+		void WriteWords(std::ostream & out, std::vector<std::uint64_t> const& words)
+		{
+			out.write(reinterpret_cast<char const*>(words.data()), words.size()*sizeof(std::uint64_t));
+		}
+
+		// reads an image, throwing if it runs out
+		class ImageReader
+		{
+		public:
+			ImageReader(char const* data, std::size_t size) : data_(data), remaining_(size)
+			{}
+
+			char const* Take(std::size_t bytes)
+			{
+				const auto padded = (bytes + 7)/8*8;
+				if (padded > remaining_)
+					throw std::runtime_error("reading straight line program from an image cut short");
+				auto taken = data_;
+				data_ += padded;
+				remaining_ -= padded;
+				return taken;
+			}
+
+			std::uint64_t const* Words(std::size_t n)
+			{
+				return reinterpret_cast<std::uint64_t const*>(Take(n*sizeof(std::uint64_t)));
+			}
+
+		private:
+			char const* data_;
+			std::size_t remaining_;
+		};
+	}
+
+
+	void StraightLineProgram::WriteImage(std::ostream & out, std::function<std::uint64_t(Var const&)> const& input_id, std::function<std::uint64_t(Nd const&)> const& constant_id) const
+	{
+		ImageHeader header;
+		header.num_instructions = instructions_.size();
+		for (int ii = 0; ii < 3; ++ii)
+			header.segment_end[ii] = segment_end_[ii];
+		header.num_registers = num_registers_;
+		header.num_variables = num_variables_;
+		header.have_jacobian = have_jacobian_;
+		header.path_variable = path_variable_ ? input_id(path_variable_) : no_image_id;
+		header.num_inputs = inputs_.size();
+		header.num_constants = constants_.size();
+		header.num_function_outputs = function_outputs_.size();
+		header.num_jacobian_outputs = jacobian_outputs_.size();
+		header.num_time_derivative_outputs = time_derivative_outputs_.size();
+		out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+		// 32 bytes each, so the tables after them stay aligned
+		static_assert(sizeof(SLPInstruction)%8==0, "instructions must keep the image aligned");
+		out.write(reinterpret_cast<char const*>(instructions_.data()), instructions_.size()*sizeof(SLPInstruction));
+
+		std::vector<std::uint64_t> words;
+		for (size_t ii = 0; ii < inputs_.size(); ++ii)
+		{
+			words.push_back(input_id(inputs_[ii].first));
+			words.push_back(inputs_[ii].second);
+			words.push_back(static_cast<std::uint64_t>(static_cast<std::int64_t>(input_directions_[ii])));
+		}
+		for (const auto& iter : constants_)
+		{
+			words.push_back(constant_id(iter.first));
+			words.push_back(iter.second);
+		}
+		words.insert(words.end(), function_outputs_.begin(), function_outputs_.end());
+		words.insert(words.end(), jacobian_outputs_.begin(), jacobian_outputs_.end());
+		words.insert(words.end(), time_derivative_outputs_.begin(), time_derivative_outputs_.end());
+		WriteWords(out, words);
+
+		std::vector<char> has_tangent(num_registers_, 0);
+		for (size_t ii = 0; ii < num_registers_; ++ii)
+			has_tangent[ii] = has_tangent_[ii];
+		has_tangent.resize((num_registers_ + 7)/8*8, 0);
+		out.write(has_tangent.data(), has_tangent.size());
+	}
+
+
+	std::shared_ptr<StraightLineProgram> StraightLineProgram::FromImage(char const* data, std::size_t size, std::shared_ptr<void const> const& owner, std::function<Var(std::uint64_t)> const& input, std::function<Nd(std::uint64_t)> const& constant)
+	{
+		ImageReader reader(data, size);
+		ImageHeader header;
+		std::memcpy(&header, reader.Take(sizeof(header)), sizeof(header));
+
+		std::shared_ptr<StraightLineProgram> program(new StraightLineProgram());
+		auto& p = *program;
+
+		const auto num_registers = header.num_registers;
+		auto check_register = [num_registers](std::uint64_t reg)
+		{
+			if (reg >= num_registers)
+				throw std::runtime_error("reading straight line program from an image referring to register " + std::to_string(reg) + " of " + std::to_string(num_registers));
+			return static_cast<size_t>(reg);
+		};
+
+		auto instructions = reinterpret_cast<SLPInstruction const*>(reader.Take(header.num_instructions*sizeof(SLPInstruction)));
+		for (std::uint64_t ii = 0; ii < header.num_instructions; ++ii)
+		{
+			check_register(instructions[ii].result);
+			check_register(instructions[ii].first);
+			check_register(instructions[ii].second);
+		}
+		p.instructions_ = detail::SharedArray<SLPInstruction>(instructions, header.num_instructions, owner);
+
+		for (int ii = 0; ii < 3; ++ii)
+		{
+			if (header.segment_end[ii] > header.num_instructions)
+				throw std::runtime_error("reading straight line program from an image with a segment ending past its instructions");
+			p.segment_end_[ii] = header.segment_end[ii];
+		}
+		p.num_registers_ = num_registers;
+		p.num_variables_ = header.num_variables;
+		p.have_jacobian_ = header.have_jacobian!=0;
+		if (header.path_variable!=no_image_id)
+			p.path_variable_ = input(header.path_variable);
+
+		auto words = reader.Words(3*header.num_inputs);
+		for (std::uint64_t ii = 0; ii < header.num_inputs; ++ii, words += 3)
+		{
+			p.inputs_.push_back(std::make_pair(input(words[0]), check_register(words[1])));
+			p.input_directions_.push_back(static_cast<int>(static_cast<std::int64_t>(words[2])));
+		}
+
+		words = reader.Words(2*header.num_constants);
+		for (std::uint64_t ii = 0; ii < header.num_constants; ++ii, words += 2)
+			p.constants_.push_back(std::make_pair(constant(words[0]), check_register(words[1])));
+
+		auto read_outputs = [&](std::vector<size_t> & outputs, std::uint64_t n)
+		{
+			auto w = reader.Words(n);
+			for (std::uint64_t ii = 0; ii < n; ++ii)
+				outputs.push_back(check_register(w[ii]));
+		};
+		read_outputs(p.function_outputs_, header.num_function_outputs);
+		read_outputs(p.jacobian_outputs_, header.num_jacobian_outputs);
+		read_outputs(p.time_derivative_outputs_, header.num_time_derivative_outputs);
+
+		auto has_tangent = reader.Take(num_registers);
+		p.has_tangent_.assign(has_tangent, has_tangent + num_registers);
+
+		p.ScheduleRegisters();
+		std::get<std::vector<dbl> >(p.registers_).resize(p.run_schedule_->num_registers);
+		std::get<std::vector<mpfr> >(p.registers_).resize(p.run_schedule_->num_registers);
+		p.precision(p.precision_);
+		return program;
+	}
+
+
+
+	MemoryUsage StraightLineProgram::MemoryReport() const
+	{
+		using memory::HeapBytes;
+		MemoryUsage report;
+
+		report.Add("instructions", HeapBytes(instructions_) + HeapBytes(run_schedule_->instructions) + HeapBytes(function_outputs_) + HeapBytes(jacobian_outputs_) + HeapBytes(time_derivative_outputs_) + HeapBytes(inputs_) + HeapBytes(constants_), instructions_.size());
+
+		std::size_t cached = 0;
+		for (auto const& state : precision_cache_)
+			cached += HeapBytes(state.registers) + HeapBytes(state.tangents);
+		report.Add("registers", HeapBytes(registers_) + cached + HeapBytes(batch_real_) + HeapBytes(batch_imag_) + HeapBytes(float_batch_real_) + HeapBytes(float_batch_imag_), NumRegisters());
+
+		std::size_t blocks = 0;
+		for (auto const& block : blocks_)
+			blocks += HeapBytes(block.registers);
+		if (blocks)
+			report.Add("block_registers", blocks, blocks_.size());
+
+		report.Add("tangents", HeapBytes(tangents_) + HeapBytes(batch_tangents_real_) + HeapBytes(batch_tangents_imag_) + HeapBytes(float_batch_tangents_real_) + HeapBytes(float_batch_tangents_imag_));
+		report.Add("series", HeapBytes(series_) + HeapBytes(series_scratch_));
+		return report;
+	}
+
+} // namespace bertini
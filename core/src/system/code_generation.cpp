@@ -0,0 +1,94 @@
+//This file is part of Bertini 2.
+//
+//code_generation.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//code_generation.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with code_generation.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/code_generation.hpp"
+
+#include <cctype>
+#include <locale>
+#include <sstream>
+
+
+namespace bertini {
+
+	namespace codegen {
+
+	namespace {
+
+		// the input is embedded as a raw string literal, closed by this
+		const std::string raw_delimiter = "b2codegen";
+
+		bool IsIdentifier(std::string const& name)
+		{
+			if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+				return false;
+			for (char c : name)
+				if (!std::isalnum(static_cast<unsigned char>(c)) && c!='_')
+					return false;
+			return true;
+		}
+	}
+
+
+	std::string GenerateHeader(System const& sys, std::string const& input, std::string const& name, unsigned digits)
+	{
+		if (!IsIdentifier(name))
+			throw std::runtime_error("generating kernels named " + name + ", which is not a C++ identifier");
+		if (input.find(")" + raw_delimiter + "\"")!=std::string::npos)
+			throw std::runtime_error("generating kernels, but the input contains the delimiter of the string in which it is embedded");
+
+		const auto inputs = sys.GeneratedKernelInputs();
+
+		std::string guard = "BERTINI_GENERATED_" + name + "_HPP";
+		for (auto& c : guard)
+			c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+		std::ostringstream out;
+		out.imbue(std::locale::classic());
+
+		out << "// kernels for a fixed system, written by b2-codegen.  generate them again from the input, rather than editing them.\n\n";
+		out << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+		out << "#include \"bertini2/generated_system.hpp\"\n\n";
+		out << "namespace bertini {\n\n\tnamespace generated {\n\n";
+		out << "\tstruct " << name << "\n\t{\n";
+
+		out << "\tstatic char const* Input()\n\t{\n\t\treturn R\"" << raw_delimiter << "(" << input << ")" << raw_delimiter << "\";\n\t}\n\n";
+
+		out << "\tstatic constexpr bool homogenized = " << (sys.NumHomVariables() ? "true" : "false") << ";\n\n";
+
+		out << "\tstatic std::vector<char const*> InputNames()\n\t{\n\t\treturn {";
+		for (size_t ii = 0; ii < inputs.size(); ++ii)
+			out << (ii ? ", " : "") << '"' << inputs[ii]->name() << '"';
+		out << "};\n\t}\n\n";
+
+		sys.GetStraightLineProgram().WriteCode(out, inputs, digits);
+
+		out << "\t};\n\n";
+		out << "\tusing " << name << "System = GeneratedSystem<" << name << ">;\n\n";
+		out << "\t} // namespace generated\n\n} // namespace bertini\n\n#endif\n";
+		return out.str();
+	}
+
+	} // namespace codegen
+
+} // namespace bertini
@@ -0,0 +1,146 @@
+//This file is part of Bertini 2.
+//
+//deflation.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//deflation.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with deflation.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/deflation.hpp"
+#include "bertini2/function_tree/simplify.hpp"
+
+#include <map>
+#include <stdexcept>
+
+namespace bertini {
+
+	namespace {
+
+		using Nd = std::shared_ptr<node::Node>;
+
+		// the sum of the products of the coefficients and the terms
+		Nd LinearCombination(std::vector<Nd> const& coefficients, std::vector<Nd> const& terms)
+		{
+			auto sum = node::MakeNode<node::SumOperator>(coefficients[0]*terms[0], true);
+			for (size_t ii = 1; ii < terms.size(); ++ii)
+				sum->AddChild(coefficients[ii]*terms[ii]);
+			return sum;
+		}
+	}
+
+
+	unsigned NumericalRank(Mat<dbl> const& J, double relative_tolerance)
+	{
+		if (J.rows()==0 || J.cols()==0)
+			return 0;
+
+		const Vec<double> singular_values = Eigen::JacobiSVD< Mat<dbl> >(J).singularValues();
+		unsigned rank = 0;
+		for (Eigen::DenseIndex ii = 0; ii < singular_values.size(); ++ii)
+			if (singular_values(ii) > relative_tolerance*singular_values(0))
+				++rank;
+		return rank;
+	}
+
+
+
+	DeflatedSystem::DeflatedSystem(System const& sys, unsigned rank) : rank_(rank)
+	{
+		const auto n = sys.NumVariables();
+		if (sys.NumTotalFunctions()!=n)
+			throw std::runtime_error("deflating a system with " + std::to_string(sys.NumTotalFunctions()) + " functions, counting patches, in " + std::to_string(n) + " variables, but it must be square");
+		if (rank >= n)
+			throw std::runtime_error("deflating a system at a root at which its Jacobian has rank " + std::to_string(rank) + ", but it must be below the number of variables, " + std::to_string(n));
+
+		const unsigned m = rank + 1;
+		for (unsigned kk = 0; kk < m; ++kk)
+			multipliers_.push_back(node::MakeNode<node::Variable>("deflation_lambda_" + std::to_string(n + kk)));
+
+		null_space_mixing_.resize(n*m);
+		for (auto& iter : null_space_mixing_)
+			iter = node::MakeNode<node::Rational>(node::Rational::Rand());
+		normalization_.resize(m);
+		for (auto& iter : normalization_)
+			iter = node::MakeNode<node::Rational>(node::Rational::Rand());
+
+		// the null vector v = B lambda, one entry for each variable of the system
+		const auto& variables = sys.Variables();
+		std::map< const node::Variable*, Nd > directions;
+		std::vector<Nd> v(n);
+		for (unsigned jj = 0; jj < n; ++jj)
+		{
+			std::vector<Nd> row(null_space_mixing_.begin() + jj*m, null_space_mixing_.begin() + (jj+1)*m);
+			v[jj] = LinearCombination(row, std::vector<Nd>(multipliers_.begin(), multipliers_.end()));
+			directions[variables[jj].get()] = v[jj];
+		}
+
+		// the functions, and their derivatives in the direction v
+		std::vector<Nd> equations, derivatives;
+		{
+			node::DifferentiationMemo memo;
+			for (unsigned ii = 0; ii < sys.NumFunctions(); ++ii)
+			{
+				equations.push_back(sys.Function(ii)->entry_node());
+				derivatives.push_back(sys.Function(ii)->Differentiate());
+			}
+		}
+		node::SubstituteDifferentials(derivatives, directions);
+		equations.insert(equations.end(), derivatives.begin(), derivatives.end());
+
+		// the patches are linear, so their derivatives in the direction v are their coefficients on it
+		if (sys.IsPatched())
+		{
+			const auto patch = sys.GetPatch();
+			const auto& sizes = patch.VariableGroupSizes();
+			unsigned column = 0;
+			for (unsigned group = 0; group < patch.NumVariableGroups(); ++group)
+			{
+				auto const& coefficients = patch.Coefficients<mpfr>(group);
+				std::vector<Nd> c, terms;
+				for (unsigned jj = 0; jj < sizes[group]; ++jj, ++column)
+				{
+					c.push_back(node::MakeNode<node::Float>(coefficients(jj)));
+					terms.push_back(v[column]);
+				}
+				equations.push_back(LinearCombination(c, terms));
+			}
+		}
+
+		std::vector<Nd> normalization(normalization_.begin(), normalization_.end());
+		equations.push_back(LinearCombination(normalization, std::vector<Nd>(multipliers_.begin(), multipliers_.end())) - 1);
+
+		deflated_.CopyVariableStructure(sys);
+		deflated_.AddUngroupedVariables(multipliers_);
+		if (sys.IsPatched())
+			deflated_.CopyPatches(sys);
+
+		// square, counting the patches, by random combinations of the equations
+		const auto num_functions = n + m - sys.NumPatches();
+		for (unsigned ii = 0; ii < num_functions; ++ii)
+		{
+			std::vector<Nd> randomizer(equations.size());
+			for (auto& iter : randomizer)
+				iter = node::MakeNode<node::Rational>(node::Rational::Rand());
+			deflated_.AddFunction(LinearCombination(randomizer, equations));
+		}
+
+		deflated_.precision(sys.precision());
+	}
+
+} // namespace bertini
@@ -0,0 +1,793 @@
+//This file is part of Bertini 2.
+//
+//polyhedral.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polyhedral.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polyhedral.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/polyhedral.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace bertini {
+	namespace start_system {
+		namespace polyhedral {
+
+			namespace {
+
+				/**
+				Call work(job) for each job from 0 to num_jobs, on num_threads threads, and rethrow the first exception any threw, once all have stopped.
+				*/
+				template<typename WorkFunction>
+				void RunJobs(size_t num_jobs, unsigned num_threads, WorkFunction work)
+				{
+					if (num_threads==0)
+						num_threads = detail::DefaultNumWorkers();
+					num_threads = static_cast<unsigned>(std::min<size_t>(num_threads, num_jobs));
+					if (num_threads==0)
+						return;
+
+					std::atomic<size_t> next(0);
+					std::atomic<bool> stop(false);
+					std::exception_ptr error;
+					std::mutex error_mutex;
+
+					auto worker = [&](unsigned thread_index)
+					{
+						try
+						{
+							size_t job;
+							while (!stop && (job = next++) < num_jobs)
+								work(thread_index, job);
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(error_mutex);
+							if (!error)
+								error = std::current_exception();
+							stop = true;
+						}
+					};
+
+					std::vector<std::thread> threads;
+					for (unsigned ii = 1; ii < num_threads; ++ii)
+						threads.emplace_back(worker, ii);
+					worker(0);
+					for (auto& t : threads)
+						t.join();
+
+					if (error)
+						std::rethrow_exception(error);
+				}
+
+
+
+				/**
+				Whether there is an x with the rows of A times x equal to b where is_equality, and at least b elsewhere.  x is free.
+
+				The first phase of the simplex method, on a dense tableau, with Bland's rule.  x is split into its positive and negative parts, the inequalities get surplus variables, and every row an artificial variable, whose sum is minimized.
+				*/
+				bool Feasible(std::vector< std::vector<double> > const& A, std::vector<double> const& b, std::vector<bool> const& is_equality)
+				{
+					const size_t m = A.size();
+					if (m==0)
+						return true;
+					const size_t n = A[0].size();
+					const size_t num_inequalities = std::count(is_equality.begin(), is_equality.end(), false);
+
+					const size_t num_structural = 2*n + num_inequalities;
+					const size_t num_columns = num_structural + m;
+					const size_t rhs = num_columns;
+
+					std::vector< std::vector<double> > T(m+1, std::vector<double>(num_columns+1, 0));
+					std::vector<size_t> basis(m);
+
+					double scale = 1;
+					size_t surplus = 2*n;
+					for (size_t rr = 0; rr < m; ++rr)
+					{
+						auto& row = T[rr];
+						for (size_t jj = 0; jj < n; ++jj)
+						{
+							row[jj] = A[rr][jj];
+							row[n+jj] = -A[rr][jj];
+						}
+						if (!is_equality[rr])
+							row[surplus++] = -1;
+						row[rhs] = b[rr];
+
+						if (row[rhs] < 0)
+							for (auto& v : row)
+								v = -v;
+
+						row[num_structural+rr] = 1;
+						basis[rr] = num_structural+rr;
+						scale = std::max(scale, std::abs(row[rhs]));
+					}
+
+					auto& objective = T[m];
+					for (size_t rr = 0; rr < m; ++rr)
+					{
+						for (size_t jj = 0; jj < num_structural; ++jj)
+							objective[jj] -= T[rr][jj];
+						objective[rhs] -= T[rr][rhs];
+					}
+
+					const double pivot_tolerance = 1e-11;
+					const size_t max_iterations = 50*(m+num_columns);
+					for (size_t iteration = 0; iteration < max_iterations; ++iteration)
+					{
+						size_t entering = num_columns;
+						for (size_t jj = 0; jj < num_structural; ++jj)
+							if (objective[jj] < -pivot_tolerance)
+							{
+								entering = jj;
+								break;
+							}
+						if (entering==num_columns)
+							break;
+
+						size_t leaving = m;
+						double best_ratio = 0;
+						for (size_t rr = 0; rr < m; ++rr)
+							if (T[rr][entering] > pivot_tolerance)
+							{
+								const double ratio = T[rr][rhs] / T[rr][entering];
+								if (leaving==m || ratio < best_ratio - pivot_tolerance || (ratio <= best_ratio + pivot_tolerance && basis[rr] < basis[leaving]))
+								{
+									leaving = rr;
+									best_ratio = ratio;
+								}
+							}
+						if (leaving==m) // cannot happen in the first phase, whose objective is bounded below
+							break;
+
+						auto& pivot_row = T[leaving];
+						const double pivot = pivot_row[entering];
+						for (auto& v : pivot_row)
+							v /= pivot;
+						for (size_t rr = 0; rr <= m; ++rr)
+						{
+							if (rr==leaving)
+								continue;
+							const double factor = T[rr][entering];
+							if (factor==0)
+								continue;
+							for (size_t jj = 0; jj <= num_columns; ++jj)
+								T[rr][jj] -= factor * pivot_row[jj];
+						}
+						basis[leaving] = entering;
+					}
+
+					// the objective row holds minus the sum of the artificial variables
+					return -objective[rhs] <= 1e-9 * scale;
+				}
+
+
+
+				/**
+				The absolute determinant of a square integer matrix, by fraction-free elimination.
+				*/
+				mpz_int AbsoluteDeterminant(std::vector< std::vector<int> > const& rows)
+				{
+					const size_t n = rows.size();
+					std::vector< std::vector<mpz_int> > M(n, std::vector<mpz_int>(n));
+					for (size_t ii = 0; ii < n; ++ii)
+						for (size_t jj = 0; jj < n; ++jj)
+							M[ii][jj] = rows[ii][jj];
+
+					mpz_int previous_pivot = 1;
+					for (size_t kk = 0; kk < n; ++kk)
+					{
+						if (M[kk][kk]==0)
+						{
+							size_t swap = kk+1;
+							while (swap < n && M[swap][kk]==0)
+								++swap;
+							if (swap==n)
+								return 0;
+							std::swap(M[kk], M[swap]);
+						}
+
+						for (size_t ii = kk+1; ii < n; ++ii)
+						{
+							for (size_t jj = kk+1; jj < n; ++jj)
+								M[ii][jj] = mpz_int(M[ii][jj]*M[kk][kk] - M[ii][kk]*M[kk][jj]) / previous_pivot;
+							M[ii][kk] = 0;
+						}
+						previous_pivot = M[kk][kk];
+					}
+
+					return abs(M[n-1][n-1]);
+				}
+
+
+
+				/**
+				Depth first search for the mixed cells, choosing an edge of one support at each level.
+
+				Only the lower edges of each lifted support, those lowest in it for some alpha, can be in a cell, and they are found first, each by a linear program on its support alone, shared among the threads.  There are usually far fewer of them than pairs of points.
+				*/
+				class CellSearch
+				{
+				public:
+					CellSearch(std::vector<Support> const& supports, std::vector<Lifting> const& liftings, unsigned num_threads) : supports_(supports), liftings_(liftings), dimension_(supports.size())
+					{
+						std::vector< std::pair<size_t, std::pair<size_t, size_t> > > candidates;
+						for (size_t kk = 0; kk < dimension_; ++kk)
+							for (size_t ii = 0; ii < supports_[kk].size(); ++ii)
+								for (size_t jj = ii+1; jj < supports_[kk].size(); ++jj)
+									candidates.emplace_back(kk, std::make_pair(ii,jj));
+
+						std::vector<char> is_lower(candidates.size(), 0);
+						RunJobs(candidates.size(), num_threads, [&](unsigned, size_t job)
+							{
+								std::vector< std::vector<double> > A;
+								std::vector<double> b;
+								std::vector<bool> is_equality;
+								AddConstraints(candidates[job].first, candidates[job].second, A, b, is_equality);
+								is_lower[job] = Feasible(A, b, is_equality);
+							});
+
+						lower_edges_.resize(dimension_);
+						for (size_t cc = 0; cc < candidates.size(); ++cc)
+							if (is_lower[cc])
+								lower_edges_[candidates[cc].first].push_back(candidates[cc].second);
+					}
+
+					/**
+					The lower edges of the first support, the edges with which to start the search.
+					*/
+					std::vector< std::pair<size_t, size_t> > const& FirstEdges() const
+					{
+						return lower_edges_[0];
+					}
+
+					/**
+					Find the cells whose edge in the first support is the given one.
+					*/
+					void Search(std::pair<size_t, size_t> const& first_edge, std::vector<MixedCell> & cells) const
+					{
+						std::vector< std::pair<size_t, size_t> > edges{first_edge};
+						Search(edges, cells);
+					}
+
+				private:
+
+					void Search(std::vector< std::pair<size_t, size_t> > & edges, std::vector<MixedCell> & cells) const
+					{
+						const auto level = edges.size();
+						if (level==dimension_)
+						{
+							MakeCell(edges, cells);
+							return;
+						}
+
+						for (const auto& edge : lower_edges_[level])
+						{
+							edges.push_back(edge);
+							if (level+1==dimension_ || Extendable(edges))
+								Search(edges, cells);
+							edges.pop_back();
+						}
+					}
+
+
+					/**
+					Add the constraints on alpha making an edge lowest in its lifted support: for each point p other than the first end of the edge, \f$\langle a_p - a_{first}, \alpha\rangle \geq w(first) - w(p)\f$, with equality for the other end.
+					*/
+					void AddConstraints(size_t support_index, std::pair<size_t, size_t> const& edge,
+					                    std::vector< std::vector<double> > & A, std::vector<double> & b, std::vector<bool> & is_equality) const
+					{
+						const auto& S = supports_[support_index];
+						const auto& w = liftings_[support_index];
+						const auto first = edge.first, second = edge.second;
+
+						for (size_t pp = 0; pp < S.size(); ++pp)
+						{
+							if (pp==first)
+								continue;
+
+							std::vector<double> row(dimension_);
+							for (size_t dd = 0; dd < dimension_; ++dd)
+								row[dd] = S[pp][dd] - S[first][dd];
+							A.push_back(std::move(row));
+							b.push_back(double(w[first] - w[pp]));
+							is_equality.push_back(pp==second);
+						}
+					}
+
+
+					/**
+					Whether some alpha makes each of the edges chosen lowest in its lifted support, as a necessary condition for a cell to contain them.
+					*/
+					bool Extendable(std::vector< std::pair<size_t, size_t> > const& edges) const
+					{
+						std::vector< std::vector<double> > A;
+						std::vector<double> b;
+						std::vector<bool> is_equality;
+
+						for (size_t kk = 0; kk < edges.size(); ++kk)
+							AddConstraints(kk, edges[kk], A, b, is_equality);
+
+						return Feasible(A, b, is_equality);
+					}
+
+
+					/**
+					Check a full choice of edges, which is a cell if they are independent and each is lowest in its support, strictly.
+					*/
+					void MakeCell(std::vector< std::pair<size_t, size_t> > const& edges, std::vector<MixedCell> & cells) const
+					{
+						std::vector< std::vector<int> > differences(dimension_, std::vector<int>(dimension_));
+						Eigen::MatrixXd V(dimension_, dimension_);
+						Eigen::VectorXd r(dimension_);
+						for (size_t kk = 0; kk < dimension_; ++kk)
+						{
+							const auto& S = supports_[kk];
+							const auto first = edges[kk].first, second = edges[kk].second;
+							for (size_t dd = 0; dd < dimension_; ++dd)
+							{
+								differences[kk][dd] = S[second][dd] - S[first][dd];
+								V(kk,dd) = differences[kk][dd];
+							}
+							r(kk) = double(liftings_[kk][first] - liftings_[kk][second]);
+						}
+
+						auto volume = AbsoluteDeterminant(differences);
+						if (volume==0)
+							return;
+
+						const Eigen::VectorXd alpha = V.fullPivLu().solve(r);
+
+						for (size_t kk = 0; kk < dimension_; ++kk)
+						{
+							const auto& S = supports_[kk];
+							const auto& w = liftings_[kk];
+							const auto first = edges[kk].first, second = edges[kk].second;
+							for (size_t pp = 0; pp < S.size(); ++pp)
+							{
+								if (pp==first || pp==second)
+									continue;
+
+								// the slack is a sum of large terms, which cancel if the lifting is not generic
+								double slack = double(w[pp] - w[first]);
+								double magnitude = std::abs(double(w[pp])) + std::abs(double(w[first]));
+								for (size_t dd = 0; dd < dimension_; ++dd)
+								{
+									const double term = (S[pp][dd] - S[first][dd]) * alpha(dd);
+									slack += term;
+									magnitude += std::abs(term);
+								}
+
+								const double tolerance = 1e-9 * (1+magnitude);
+								if (slack < -tolerance)
+									return;
+								if (slack <= tolerance)
+									throw std::runtime_error("computing mixed cells, but the lifting is not generic");
+							}
+						}
+
+						MixedCell cell;
+						cell.edges = edges;
+						cell.inner_normal.assign(alpha.data(), alpha.data()+dimension_);
+						cell.volume = volume;
+						cells.push_back(std::move(cell));
+					}
+
+					std::vector<Support> const& supports_;
+					std::vector<Lifting> const& liftings_;
+					const size_t dimension_;
+					std::vector< std::vector< std::pair<size_t, size_t> > > lower_edges_; ///< The lower edges of each lifted support.
+				};
+
+
+
+				/**
+				The lifted homotopy of one mixed cell, in the variable tau.  Each function is a sum of terms, each a coefficient times a monomial in y times a power of tau.
+				*/
+				class CellHomotopy
+				{
+				public:
+					CellHomotopy(std::vector<Support> const& supports, std::vector<Lifting> const& liftings,
+					             std::vector< std::vector<dbl> > const& coefficients, MixedCell const& cell) : supports_(supports), coefficients_(coefficients), dimension_(supports.size())
+					{
+						// the exponent of s of each point, less the least in its support, which is attained at the edge of the cell
+						exponents_.resize(dimension_);
+						double least_positive = 0;
+						for (size_t kk = 0; kk < dimension_; ++kk)
+						{
+							const auto& S = supports[kk];
+							const auto first = cell.edges[kk].first, second = cell.edges[kk].second;
+
+							exponents_[kk].resize(S.size());
+							for (size_t pp = 0; pp < S.size(); ++pp)
+							{
+								if (pp==first || pp==second)
+								{
+									exponents_[kk][pp] = 0;
+									continue;
+								}
+
+								double e = double(liftings[kk][pp] - liftings[kk][first]);
+								for (size_t dd = 0; dd < dimension_; ++dd)
+									e += (S[pp][dd] - S[first][dd]) * cell.inner_normal[dd];
+								exponents_[kk][pp] = e;
+								if (least_positive==0 || e < least_positive)
+									least_positive = e;
+							}
+						}
+
+						// s = tau^(1/least_positive) makes every exponent of tau 0 or at least 1
+						for (auto& E : exponents_)
+							for (auto& e : E)
+								e /= least_positive;
+					}
+
+
+					/**
+					The functions, their Jacobian in y, and their derivative in tau.
+					*/
+					void Eval(Vec<dbl> const& y, double tau, Vec<dbl> & H, Mat<dbl> & J, Vec<dbl> & H_tau) const
+					{
+						H.setZero(dimension_);
+						J.setZero(dimension_, dimension_);
+						H_tau.setZero(dimension_);
+
+						for (size_t kk = 0; kk < dimension_; ++kk)
+						{
+							const auto& S = supports_[kk];
+							for (size_t pp = 0; pp < S.size(); ++pp)
+							{
+								const auto e = exponents_[kk][pp];
+								const double tau_power = e==0 ? 1 : std::pow(tau, e);
+								const dbl c = coefficients_[kk][pp];
+
+								dbl monomial = c;
+								for (size_t dd = 0; dd < dimension_; ++dd)
+									if (S[pp][dd])
+										monomial *= std::pow(y(dd), S[pp][dd]);
+
+								H(kk) += monomial * tau_power;
+								if (e!=0)
+									H_tau(kk) += monomial * (e * std::pow(tau, e-1));
+
+								for (size_t dd = 0; dd < dimension_; ++dd)
+								{
+									if (!S[pp][dd])
+										continue;
+
+									dbl derivative = c * tau_power * double(S[pp][dd]) * std::pow(y(dd), S[pp][dd]-1);
+									for (size_t oo = 0; oo < dimension_; ++oo)
+										if (oo!=dd && S[pp][oo])
+											derivative *= std::pow(y(oo), S[pp][oo]);
+									J(kk,dd) += derivative;
+								}
+							}
+						}
+					}
+
+
+					/**
+					Track a path from tau=0 to tau=1.
+
+					\return Whether it got there.
+					*/
+					bool Track(Vec<dbl> & y) const
+					{
+						double tau = 0, step = 0.02;
+						unsigned successes = 0;
+
+						while (tau < 1)
+						{
+							step = std::min(step, 1-tau);
+							Vec<dbl> next;
+							if (Predict(y, tau, step, next) && Correct(next, tau+step))
+							{
+								y = next;
+								tau = (step==1-tau) ? 1 : tau+step;
+								if (++successes==3)
+								{
+									step = std::min(2*step, 0.1);
+									successes = 0;
+								}
+							}
+							else
+							{
+								step /= 2;
+								successes = 0;
+								if (step < 1e-13)
+									return false;
+							}
+						}
+
+						for (unsigned ii = 0; ii < 5; ++ii)
+							if (!NewtonStep(y, 1))
+								return false;
+						return y.allFinite();
+					}
+
+				private:
+
+					bool Tangent(Vec<dbl> const& y, double tau, Vec<dbl> & tangent) const
+					{
+						Vec<dbl> H, H_tau;
+						Mat<dbl> J;
+						Eval(y, tau, H, J, H_tau);
+						tangent = -J.partialPivLu().solve(H_tau);
+						return tangent.allFinite();
+					}
+
+					/**
+					Fourth order Runge-Kutta, for the path dy/dtau = -J^{-1} dH/dtau.
+					*/
+					bool Predict(Vec<dbl> const& y, double tau, double step, Vec<dbl> & next) const
+					{
+						Vec<dbl> k1, k2, k3, k4;
+						if (!Tangent(y, tau, k1) || !Tangent(y + (step/2)*k1, tau + step/2, k2)
+						    || !Tangent(y + (step/2)*k2, tau + step/2, k3) || !Tangent(y + step*k3, tau + step, k4))
+							return false;
+						next = y + (step/6)*(k1 + 2*k2 + 2*k3 + k4);
+						return true;
+					}
+
+					bool NewtonStep(Vec<dbl> & y, double tau, double* correction_norm = nullptr) const
+					{
+						Vec<dbl> H, H_tau;
+						Mat<dbl> J;
+						Eval(y, tau, H, J, H_tau);
+						const Vec<dbl> delta = J.partialPivLu().solve(H);
+						if (!delta.allFinite())
+							return false;
+						y -= delta;
+						if (correction_norm)
+							*correction_norm = delta.norm();
+						return true;
+					}
+
+					/**
+					Newton's method at tau, which must converge quickly from the prediction for the step to be taken.
+					*/
+					bool Correct(Vec<dbl> & y, double tau) const
+					{
+						double previous = 0;
+						for (unsigned ii = 0; ii < 3; ++ii)
+						{
+							double norm;
+							if (!NewtonStep(y, tau, &norm))
+								return false;
+							if (ii > 0 && norm > previous/2)
+								return false;
+							if (norm <= 1e-10 * (1 + y.norm()))
+								return true;
+							previous = norm;
+						}
+						return false;
+					}
+
+					std::vector<Support> const& supports_;
+					std::vector< std::vector<dbl> > const& coefficients_;
+					std::vector< std::vector<double> > exponents_; ///< The exponent of tau of each point of each support.
+					const size_t dimension_;
+				};
+
+			} // re: anonymous namespace
+
+
+
+			std::vector<MixedCell> MixedCells(std::vector<Support> const& supports, std::vector<Lifting> const& liftings, unsigned num_threads)
+			{
+				const auto dimension = supports.size();
+				if (liftings.size()!=dimension)
+					throw std::runtime_error("computing mixed cells, but the number of liftings does not match the number of supports");
+				for (size_t kk = 0; kk < dimension; ++kk)
+				{
+					if (liftings[kk].size()!=supports[kk].size())
+						throw std::runtime_error("computing mixed cells, but a lifting does not match its support");
+					for (const auto& point : supports[kk])
+						if (point.size()!=dimension)
+							throw std::runtime_error("computing mixed cells, but the dimension of a point does not match the number of supports");
+				}
+
+				if (dimension==0)
+					return {};
+
+				if (num_threads==0)
+					num_threads = detail::DefaultNumWorkers();
+				std::vector< std::vector<MixedCell> > found(num_threads);
+
+				CellSearch search(supports, liftings, num_threads);
+				const auto& first_edges = search.FirstEdges();
+				RunJobs(first_edges.size(), num_threads, [&](unsigned thread_index, size_t job)
+					{
+						search.Search(first_edges[job], found[thread_index]);
+					});
+
+				std::vector<MixedCell> cells;
+				for (auto& f : found)
+					std::move(f.begin(), f.end(), std::back_inserter(cells));
+				std::sort(cells.begin(), cells.end(), [](MixedCell const& a, MixedCell const& b){ return a.edges < b.edges; });
+				return cells;
+			}
+
+
+
+			mpz_int MixedVolume(std::vector<MixedCell> const& cells)
+			{
+				mpz_int volume = 0;
+				for (const auto& c : cells)
+					volume += c.volume;
+				return volume;
+			}
+
+
+
+			std::vector< Vec<dbl> > SolveBinomialSystem(std::vector< std::vector<int> > const& exponents, std::vector<dbl> const& right_hand_sides)
+			{
+				const size_t n = exponents.size();
+
+				// H = U V, upper triangular with positive diagonal, U unimodular
+				std::vector< std::vector<long> > H(n, std::vector<long>(n)), U(n, std::vector<long>(n, 0));
+				for (size_t ii = 0; ii < n; ++ii)
+				{
+					for (size_t jj = 0; jj < n; ++jj)
+						H[ii][jj] = exponents[ii][jj];
+					U[ii][ii] = 1;
+				}
+
+				for (size_t cc = 0; cc < n; ++cc)
+				{
+					// Euclid's algorithm down the column, until only row cc is nonzero in it
+					while (true)
+					{
+						size_t pivot = n;
+						for (size_t rr = cc; rr < n; ++rr)
+							if (H[rr][cc]!=0 && (pivot==n || std::abs(H[rr][cc]) < std::abs(H[pivot][cc])))
+								pivot = rr;
+						if (pivot==n)
+							throw std::runtime_error("solving binomial system, but the exponents are linearly dependent");
+
+						std::swap(H[cc], H[pivot]);
+						std::swap(U[cc], U[pivot]);
+
+						bool reduced = true;
+						for (size_t rr = cc+1; rr < n; ++rr)
+						{
+							const long q = H[rr][cc] / H[cc][cc];
+							if (q!=0)
+								for (size_t jj = 0; jj < n; ++jj)
+								{
+									H[rr][jj] -= q*H[cc][jj];
+									U[rr][jj] -= q*U[cc][jj];
+								}
+							if (H[rr][cc]!=0)
+								reduced = false;
+						}
+						if (reduced)
+							break;
+					}
+
+					if (H[cc][cc] < 0)
+						for (size_t jj = 0; jj < n; ++jj)
+						{
+							H[cc][jj] = -H[cc][jj];
+							U[cc][jj] = -U[cc][jj];
+						}
+				}
+
+				// in logarithms, H z = U log(b) + 2 pi i m, for integers m
+				std::vector<dbl> log_b(n);
+				for (size_t kk = 0; kk < n; ++kk)
+					log_b[kk] = std::log(right_hand_sides[kk]);
+
+				std::vector<dbl> rhs(n, dbl(0));
+				for (size_t jj = 0; jj < n; ++jj)
+					for (size_t kk = 0; kk < n; ++kk)
+						rhs[jj] += double(U[jj][kk]) * log_b[kk];
+
+				const double two_pi = 2*std::acos(-1.0);
+				std::vector< Vec<dbl> > solutions;
+				std::vector<long> branch(n, 0);
+				Vec<dbl> z(n);
+				while (true)
+				{
+					for (size_t jj = n; jj-- > 0; )
+					{
+						dbl value = rhs[jj] + dbl(0, two_pi * double(branch[jj]));
+						for (size_t ll = jj+1; ll < n; ++ll)
+							value -= double(H[jj][ll]) * z(ll);
+						z(jj) = value / double(H[jj][jj]);
+					}
+
+					Vec<dbl> y(n);
+					for (size_t jj = 0; jj < n; ++jj)
+						y(jj) = std::exp(z(jj));
+					solutions.push_back(std::move(y));
+
+					size_t jj = 0;
+					for (; jj < n; ++jj)
+					{
+						if (++branch[jj] < H[jj][jj])
+							break;
+						branch[jj] = 0;
+					}
+					if (jj==n)
+						break;
+				}
+
+				return solutions;
+			}
+
+
+
+			std::vector< Vec<dbl> > TrackLiftedHomotopies(std::vector<Support> const& supports, std::vector<Lifting> const& liftings,
+			                                               std::vector< std::vector<dbl> > const& coefficients,
+			                                               std::vector<MixedCell> const& cells, unsigned num_threads)
+			{
+				struct Path
+				{
+					size_t cell;
+					Vec<dbl> point;
+					bool success = false;
+				};
+
+				std::vector<CellHomotopy> homotopies;
+				std::vector<Path> paths;
+				for (size_t cc = 0; cc < cells.size(); ++cc)
+				{
+					const auto& cell = cells[cc];
+					homotopies.emplace_back(supports, liftings, coefficients, cell);
+
+					// at s=0, each function is its two terms on the edge, c_first y^first + c_second y^second = 0
+					std::vector< std::vector<int> > exponents(supports.size(), std::vector<int>(supports.size()));
+					std::vector<dbl> right_hand_sides(supports.size());
+					for (size_t kk = 0; kk < supports.size(); ++kk)
+					{
+						const auto first = cell.edges[kk].first, second = cell.edges[kk].second;
+						for (size_t dd = 0; dd < supports.size(); ++dd)
+							exponents[kk][dd] = supports[kk][first][dd] - supports[kk][second][dd];
+						right_hand_sides[kk] = -coefficients[kk][second] / coefficients[kk][first];
+					}
+
+					for (auto& y : SolveBinomialSystem(exponents, right_hand_sides))
+						paths.push_back(Path{cc, std::move(y)});
+				}
+
+				RunJobs(paths.size(), num_threads, [&](unsigned, size_t job)
+					{
+						auto& path = paths[job];
+						path.success = homotopies[path.cell].Track(path.point);
+					});
+
+				std::vector< Vec<dbl> > endpoints;
+				for (auto& path : paths)
+					if (path.success)
+						endpoints.push_back(std::move(path.point));
+				return endpoints;
+			}
+
+		} // namespace polyhedral
+	} // namespace start_system
+} // namespace bertini
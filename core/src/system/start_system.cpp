@@ -26,6 +26,9 @@
 
 
 BOOST_CLASS_EXPORT(bertini::start_system::TotalDegree);
+BOOST_CLASS_EXPORT(bertini::start_system::MHomogeneous);
+BOOST_CLASS_EXPORT(bertini::start_system::Polyhedral);
+BOOST_CLASS_EXPORT(bertini::start_system::UserSupplied);
 
 
 namespace bertini {
@@ -67,7 +70,7 @@ namespace bertini {
 			// auto prev_prec = boost::multiprecision::DefaultPrecision();
 			// boost::multiprecision::DefaultPrecision(4000);
 			for (unsigned ii = 0; ii < s.NumFunctions(); ++ii)
-				random_values_[ii] = std::make_shared<node::Rational>(node::Rational::Rand());
+				random_values_[ii] = node::MakeNode<node::Rational>(node::Rational::Rand());
 
 			// by hypothesis, the system has a single variable group.
 			VariableGroup v = this->AffineVariableGroup(0);
@@ -80,7 +83,7 @@ namespace bertini {
 			if (s.IsPatched())
 				CopyPatches(s);
 
-			gamma_ = std::make_shared<node::Rational>(node::Rational::Rand());
+			gamma_ = node::MakeNode<node::Rational>(node::Rational::Rand());
 			// *this *= static_cast<std::shared_ptr<node::Node> >(gamma_);
 			// boost::multiprecision::DefaultPrecision(prev_prec);
 		}// total degree constructor
@@ -151,6 +154,543 @@ namespace bertini {
 			return start_point;
 		}
 
+		// constructor for MHomogeneous start system, from any other *suitable* system.
+		MHomogeneous::MHomogeneous(System const& s)
+		{
+			if (s.NumHomVariableGroups() > 0)
+				throw std::runtime_error("a homogeneous variable group is present.  currently unallowed");
+
+			if (s.NumTotalFunctions() != s.NumVariables())
+				throw std::runtime_error("attempting to construct multihomogeneous start system from non-square target system");
+
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct multihomogeneous start system, but target system has path varible declared already");
+
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to construct multihomogeneous start system from non-polynomial target system");
+
+			const auto groups = s.VariableGroups();
+			size_t num_grouped = 0;
+			for (const auto& g : groups)
+			{
+				group_sizes_.push_back(g.size());
+				num_grouped += g.size();
+			}
+			if (num_grouped != s.NumNaturalVariables())
+				throw std::runtime_error("attempting to construct multihomogeneous start system, but not every variable is in an affine variable group");
+
+			const auto num_functions = s.NumFunctions();
+			if (num_functions != num_grouped)
+				throw std::runtime_error("attempting to construct multihomogeneous start system, but the number of functions does not match the number of variables");
+
+			degrees_.assign(num_functions, std::vector<unsigned>(groups.size(), 0));
+			for (size_t jj = 0; jj < groups.size(); ++jj)
+			{
+				auto deg = s.Degrees(groups[jj]);
+				for (size_t ii = 0; ii < num_functions; ++ii)
+					degrees_[ii][jj] = static_cast<unsigned>(deg[ii]);
+			}
+
+			CopyVariableStructure(s);
+
+			linear_factors_.resize(num_functions);
+			for (size_t ii = 0; ii < num_functions; ++ii)
+			{
+				linear_factors_[ii].resize(groups.size());
+
+				std::shared_ptr<node::Node> product;
+				for (size_t jj = 0; jj < groups.size(); ++jj)
+					for (unsigned kk = 0; kk < degrees_[ii][jj]; ++kk)
+					{
+						LinearFactor factor(groups[jj].size()+1);
+						for (auto& c : factor)
+							c = node::MakeNode<node::Rational>(node::Rational::Rand());
+
+						std::shared_ptr<node::Node> linear = factor.back();
+						for (size_t vv = 0; vv < groups[jj].size(); ++vv)
+							linear = linear + factor[vv]*groups[jj][vv];
+
+						product = product ? product*linear : linear;
+						linear_factors_[ii][jj].push_back(std::move(factor));
+					}
+
+				if (!product)
+					product = node::MakeNode<node::Integer>(1);
+				AddFunction(product);
+			}
+
+			if (s.IsHomogeneous())
+				Homogenize();
+
+			if (s.IsPatched())
+				CopyPatches(s);
+
+			auto remaining = group_sizes_;
+			CountCompletions(0, remaining);
+		}// multihomogeneous constructor
+
+
+
+		mpz_int MHomogeneous::CountCompletions(size_t first_function, std::vector<unsigned> & remaining)
+		{
+			auto found = counts_.find(remaining);
+			if (found!=counts_.end())
+				return found->second;
+
+			mpz_int count = 0;
+			if (first_function==degrees_.size())
+				count = 1;
+			else
+				for (size_t jj = 0; jj < remaining.size(); ++jj)
+				{
+					if (remaining[jj]==0 || degrees_[first_function][jj]==0)
+						continue;
+
+					--remaining[jj];
+					count += degrees_[first_function][jj] * CountCompletions(first_function+1, remaining);
+					++remaining[jj];
+				}
+
+			counts_[remaining] = count;
+			return count;
+		}
+
+
+
+		mpz_int MHomogeneous::NumStartPoints() const
+		{
+			return counts_.at(group_sizes_);
+		}
+
+
+
+		template<typename T>
+		Vec<T> MHomogeneous::GenerateStartPointImpl(mpz_int index) const
+		{
+			if (index >= NumStartPoints())
+				throw std::out_of_range("in MHomogeneous::GenerateStartPoint, index exceeds the number of start points");
+
+			const auto num_groups = group_sizes_.size();
+
+			// decode the index into the group, and the factor within it, picked for each function
+			std::vector< std::vector< LinearFactor const* > > picked(num_groups);
+			auto remaining = group_sizes_;
+			for (size_t ii = 0; ii < degrees_.size(); ++ii)
+				for (size_t jj = 0; jj < num_groups; ++jj)
+				{
+					if (remaining[jj]==0 || degrees_[ii][jj]==0)
+						continue;
+
+					--remaining[jj];
+					const auto& completions = counts_.at(remaining);
+					const mpz_int block = degrees_[ii][jj] * completions;
+					if (index < block)
+					{
+						picked[jj].push_back(&linear_factors_[ii][jj][static_cast<unsigned>(mpz_int(index / completions))]);
+						index %= completions;
+						break;
+					}
+					index -= block;
+					++remaining[jj];
+				}
+
+			// the picked factors of each group are a square linear system in its variables
+			const bool homogenized = NumVariables() > NumNaturalVariables();
+			Vec<T> start_point(NumVariables());
+			size_t offset = 0;
+			for (size_t jj = 0; jj < num_groups; ++jj)
+			{
+				const auto n = group_sizes_[jj];
+				Mat<T> A(n,n);
+				Vec<T> b(n);
+				for (unsigned rr = 0; rr < n; ++rr)
+				{
+					const auto& factor = *picked[jj][rr];
+					for (unsigned cc = 0; cc < n; ++cc)
+						A(rr,cc) = factor[cc]->Eval<T>();
+					b(rr) = -factor[n]->Eval<T>();
+				}
+
+				if (homogenized)
+					start_point(offset++) = T(1);
+				start_point.segment(offset, n) = A.lu().solve(b);
+				offset += n;
+			}
+
+			if (IsPatched())
+				RescalePointToFitPatchInPlace(start_point);
+
+			return start_point;
+		}
+
+
+		Vec<dbl> MHomogeneous::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			return GenerateStartPointImpl<dbl>(index);
+		}
+
+
+		Vec<mpfr> MHomogeneous::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			return GenerateStartPointImpl<mpfr>(index);
+		}
+
+
+
+		// constructor for Polyhedral start system, from any other *suitable* system.
+		Polyhedral::Polyhedral(System const& s, unsigned num_threads)
+		{
+			if (s.NumHomVariableGroups() > 0)
+				throw std::runtime_error("a homogeneous variable group is present.  currently unallowed");
+
+			if (s.NumTotalFunctions() != s.NumVariables())
+				throw std::runtime_error("attempting to construct polyhedral start system from non-square target system");
+
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct polyhedral start system, but target system has path varible declared already");
+
+			if (s.IsHomogeneous() || s.IsPatched())
+				throw std::runtime_error("attempting to construct polyhedral start system from homogenized target system.  currently unallowed");
+
+			if (!s.IsPolynomial())
+				throw std::runtime_error("attempting to construct polyhedral start system from non-polynomial target system");
+
+			const auto& polynomial_system = s.GetPolynomialSystem();
+			const auto num_functions = s.NumFunctions();
+			const auto num_variables = s.NumVariables();
+
+			// the supports of the target, each with the constant monomial
+			const std::vector<int> origin(num_variables, 0);
+			supports_.resize(num_functions);
+			for (size_t ii = 0; ii < num_functions; ++ii)
+			{
+				for (const auto& exponents : polynomial_system.Support(ii))
+					supports_[ii].emplace_back(exponents.begin(), exponents.end());
+				if (std::find(supports_[ii].begin(), supports_[ii].end(), origin)==supports_[ii].end())
+					supports_[ii].push_back(origin);
+			}
+
+			CopyVariableStructure(s);
+			const auto variables = s.Variables();
+
+			// coefficients of modulus 1, exactly, at the rational points ((1-u^2) + 2ui)/(1+u^2) of the unit circle
+			coefficients_.resize(num_functions);
+			std::vector< std::vector<dbl> > coefficient_values(num_functions);
+			for (size_t ii = 0; ii < num_functions; ++ii)
+			{
+				std::shared_ptr<node::Node> function;
+				for (const auto& exponents : supports_[ii])
+				{
+					const mpq_rational u(RandomInt<5>(), mpz_int(1) << 16);
+					const mpq_rational denominator = 1 + u*u;
+					auto c = node::MakeNode<node::Rational>(mpq_rational((1 - u*u) / denominator), mpq_rational(2*u / denominator));
+					coefficients_[ii].push_back(c);
+					coefficient_values[ii].push_back(c->Eval<dbl>());
+
+					std::shared_ptr<node::Node> term = c;
+					for (size_t vv = 0; vv < num_variables; ++vv)
+						if (exponents[vv]==1)
+							term = term*variables[vv];
+						else if (exponents[vv] > 1)
+							term = term*pow(variables[vv], exponents[vv]);
+
+					function = function ? function+term : term;
+				}
+				AddFunction(function);
+			}
+
+			// a lifting which is not generic is detected, and replaced
+			std::vector<polyhedral::MixedCell> cells;
+			std::vector<polyhedral::Lifting> liftings(num_functions);
+			const unsigned max_attempts = 10;
+			for (unsigned attempt = 1; ; ++attempt)
+			{
+				for (size_t ii = 0; ii < num_functions; ++ii)
+				{
+					liftings[ii].clear();
+					for (size_t pp = 0; pp < supports_[ii].size(); ++pp)
+						liftings[ii].push_back(RandomInt<6>().convert_to<long>());
+				}
+
+				try
+				{
+					cells = polyhedral::MixedCells(supports_, liftings, num_threads);
+					break;
+				}
+				catch (std::runtime_error const&)
+				{
+					if (attempt==max_attempts)
+						throw;
+				}
+			}
+
+			mixed_volume_ = polyhedral::MixedVolume(cells);
+			start_points_ = polyhedral::TrackLiftedHomotopies(supports_, liftings, coefficient_values, cells, num_threads);
+		}// polyhedral constructor
+
+
+
+		mpz_int Polyhedral::NumStartPoints() const
+		{
+			return start_points_.size();
+		}
+
+
+
+		Vec<dbl> Polyhedral::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			if (index >= NumStartPoints())
+				throw std::out_of_range("in Polyhedral::GenerateStartPoint, index exceeds the number of start points");
+
+			return start_points_[static_cast<size_t>(index)];
+		}
+
+
+		Vec<mpfr> Polyhedral::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			const auto& point_d = GenerateStartPoint(dbl(), index);
+
+			Vec<mpfr> start_point(point_d.size());
+			for (Eigen::DenseIndex ii = 0; ii < point_d.size(); ++ii)
+				start_point(ii) = mpfr(point_d(ii));
+
+			// Newton's method doubles the correct digits at every step, from those of double precision
+			const auto digits = DefaultPrecision();
+			this->precision(digits);
+			const mpfr_float tolerance = pow(mpfr_float(10), -static_cast<int>(digits)+3);
+			for (unsigned ii = 0; ii < 20; ++ii)
+			{
+				const Vec<mpfr> delta = Jacobian(start_point).lu().solve(Eval(start_point));
+				start_point -= delta;
+				if (delta.norm() <= tolerance * (1 + start_point.norm()))
+					break;
+			}
+
+			return start_point;
+		}
+
+
+
+		namespace {
+
+			// a point of a text file is found from the nearest before it of every this many
+			const std::size_t classic_checkpoint_spacing = 64;
+
+			bool IsSeparator(char c)
+			{
+				return std::isspace(static_cast<unsigned char>(c)) || c==';';
+			}
+
+			// the next number in a text file, advancing past it, or an empty token at the end
+			std::pair<char const*, char const*> NextToken(char const* & p, char const* end)
+			{
+				while (p!=end && IsSeparator(*p))
+					++p;
+				char const* begin = p;
+				while (p!=end && !IsSeparator(*p))
+					++p;
+				return {begin, p};
+			}
+		}
+
+
+		/**
+		The mapping of a file of start points, and where they are in it.
+		*/
+		class UserSupplied::Solutions
+		{
+		public:
+
+			Solutions(boost::filesystem::path const& file, std::size_t num_variables) : num_variables_(num_variables)
+			{
+				if (tracking::IsEndpointFile(file))
+				{
+					format_ = Format::Endpoints;
+					endpoints_.reset(new tracking::EndpointReader(file));
+					num_points_ = endpoints_->NumRecords();
+					if (num_points_ > 0)
+						CheckSize(endpoints_->Get<dbl>(0).endpoint.size());
+					return;
+				}
+
+				format_ = Format::Classic;
+				boost::system::error_code ec;
+				if (boost::filesystem::file_size(file, ec)==0 || ec)
+					throw std::runtime_error("start solutions file " + file.string() + " is missing or empty");
+				try
+				{
+					using namespace boost::interprocess;
+					mapping_ = file_mapping(file.string().c_str(), read_only);
+					mapped_region region(mapping_, read_only);
+					region_.swap(region);
+				}
+				catch (std::exception const& e)
+				{
+					throw std::runtime_error("unable to map start solutions file " + file.string() + ": " + e.what());
+				}
+
+				char const* p = Begin();
+				const auto count_token = NextToken(p, End());
+				const std::string count(count_token.first, count_token.second);
+				char* parsed_to;
+				const auto num_points = std::strtoull(count.c_str(), &parsed_to, 10);
+				if (count.empty() || *parsed_to!='\0')
+					throw std::runtime_error(file.string() + " is neither an endpoint file nor a start file, which begins with the number of points");
+				num_points_ = num_points;
+
+				for (std::size_t ii = 0; ii < num_points_; ++ii)
+				{
+					if (ii % classic_checkpoint_spacing==0)
+						checkpoints_.push_back(p - Begin());
+					for (std::size_t jj = 0; jj < 2*num_variables_; ++jj)
+						if (NextToken(p, End()).first==p)
+							throw std::runtime_error("start solutions file " + file.string() + " ends in point " + std::to_string(ii) + " of its " + std::to_string(num_points_) + ", or its points have fewer than " + std::to_string(num_variables_) + " coordinates");
+				}
+			}
+
+			Format GetFormat() const
+			{
+				return format_;
+			}
+
+			std::size_t NumPoints() const
+			{
+				return num_points_;
+			}
+
+			Vec<dbl> PointDouble(std::size_t index) const
+			{
+				if (format_==Format::Endpoints)
+				{
+					Vec<dbl> point = endpoints_->Get<dbl>(index).endpoint;
+					CheckSize(point.size());
+					return point;
+				}
+
+				Vec<dbl> point(num_variables_);
+				char const* p = Locate(index);
+				for (std::size_t ii = 0; ii < num_variables_; ++ii)
+				{
+					const double re = ParseDouble(NextToken(p, End()));
+					const double im = ParseDouble(NextToken(p, End()));
+					point(ii) = dbl(re, im);
+				}
+				return point;
+			}
+
+			Vec<mpfr> PointMultiple(std::size_t index) const
+			{
+				const auto digits = DefaultPrecision();
+				if (format_==Format::Endpoints)
+				{
+					Vec<mpfr> point = endpoints_->Get<mpfr>(index).endpoint;
+					CheckSize(point.size());
+					Precision(point, digits);
+					return point;
+				}
+
+				Vec<mpfr> point(num_variables_);
+				char const* p = Locate(index);
+				for (std::size_t ii = 0; ii < num_variables_; ++ii)
+				{
+					const auto re = NextToken(p, End());
+					const auto im = NextToken(p, End());
+					point(ii) = mpfr(std::string(re.first, re.second), std::string(im.first, im.second));
+				}
+				return point;
+			}
+
+		private:
+
+			char const* Begin() const
+			{
+				return static_cast<char const*>(region_.get_address());
+			}
+
+			char const* End() const
+			{
+				return Begin() + region_.get_size();
+			}
+
+			// the first coordinate of a point of a text file
+			char const* Locate(std::size_t index) const
+			{
+				char const* p = Begin() + checkpoints_[index / classic_checkpoint_spacing];
+				for (std::size_t ii = 0; ii < 2*num_variables_*(index % classic_checkpoint_spacing); ++ii)
+					NextToken(p, End());
+				return p;
+			}
+
+			static double ParseDouble(std::pair<char const*, char const*> const& token)
+			{
+				return std::strtod(std::string(token.first, token.second).c_str(), nullptr);
+			}
+
+			void CheckSize(Eigen::DenseIndex size) const
+			{
+				if (static_cast<std::size_t>(size)!=num_variables_)
+					throw std::runtime_error("start point of " + std::to_string(size) + " coordinates, for a start system with " + std::to_string(num_variables_) + " variables");
+			}
+
+			Format format_;
+			std::size_t num_variables_;
+			std::size_t num_points_ = 0;
+			std::unique_ptr<tracking::EndpointReader> endpoints_; ///< For an endpoint file.
+			boost::interprocess::file_mapping mapping_; ///< For a text file.
+			boost::interprocess::mapped_region region_;
+			std::vector<std::size_t> checkpoints_; ///< The offset of every classic_checkpoint_spacing-th point of a text file.
+		};
+
+
+
+		// constructor for UserSupplied start system, from the start system and its solutions.
+		UserSupplied::UserSupplied(System const& s, boost::filesystem::path const& start_solutions) : file_(start_solutions)
+		{
+			if (s.HavePathVariable())
+				throw std::runtime_error("attempting to construct user supplied start system, but the system has path varible declared already");
+
+			System::operator=(s);
+			Open();
+		}
+
+
+		void UserSupplied::Open()
+		{
+			solutions_ = std::make_shared<const Solutions>(file_, NumVariables());
+		}
+
+
+		mpz_int UserSupplied::NumStartPoints() const
+		{
+			return solutions_->NumPoints();
+		}
+
+
+		UserSupplied::Format UserSupplied::StartSolutionsFormat() const
+		{
+			return solutions_->GetFormat();
+		}
+
+
+		Vec<dbl> UserSupplied::GenerateStartPoint(dbl,mpz_int index) const
+		{
+			if (index >= NumStartPoints())
+				throw std::out_of_range("in UserSupplied::GenerateStartPoint, index exceeds the number of start points");
+
+			return solutions_->PointDouble(static_cast<size_t>(index));
+		}
+
+
+		Vec<mpfr> UserSupplied::GenerateStartPoint(mpfr,mpz_int index) const
+		{
+			if (index >= NumStartPoints())
+				throw std::out_of_range("in UserSupplied::GenerateStartPoint, index exceeds the number of start points");
+
+			return solutions_->PointMultiple(static_cast<size_t>(index));
+		}
+
+
+
 		inline
 		TotalDegree operator*(TotalDegree td, std::shared_ptr<node::Node> const& n)
 		{
@@ -24,6 +24,16 @@
 
 
 #include "system.hpp"
+#include "function_tree/simplify.hpp"
+#include "lu.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 template<typename NumType> using Vec = bertini::Vec<NumType>;
 template<typename NumType> using Mat = bertini::Mat<NumType>;
@@ -35,6 +45,20 @@ BOOST_CLASS_EXPORT(bertini::System)
 namespace bertini 
 {
 
+	namespace {
+
+		/**
+		The number of threads among which to share differentiating the functions of a system.  Each takes at least MinFunctionsPerThread functions, for below that the threads cost more than they save.
+		*/
+		unsigned NumDifferentiationThreads(std::size_t num_functions)
+		{
+			constexpr std::size_t MinFunctionsPerThread = 8;
+			const std::size_t hardware = detail::DefaultNumWorkers();
+			return static_cast<unsigned>(std::max<std::size_t>(1, std::min(hardware, num_functions/MinFunctionsPerThread)));
+		}
+	}
+
+
 	void swap(System & a, System & b)
 	{
 		using std::swap;
@@ -61,8 +85,44 @@ namespace bertini
 
 		swap(a.is_differentiated_,b.is_differentiated_);
 		swap(a.jacobian_,b.jacobian_);
+		swap(a.jacobian_structure_,b.jacobian_structure_);
+
+		swap(a.use_straight_line_program_,b.use_straight_line_program_);
+		swap(a.straight_line_program_,b.straight_line_program_);
+		swap(a.use_compiled_evaluation_,b.use_compiled_evaluation_);
+		swap(a.straight_line_program_failed_,b.straight_line_program_failed_);
+		swap(a.use_forward_mode_,b.use_forward_mode_);
+		swap(a.forward_mode_program_,b.forward_mode_program_);
+		swap(a.use_polynomial_system_,b.use_polynomial_system_);
+		swap(a.have_polynomial_system_,b.have_polynomial_system_);
+		swap(a.polynomial_system_,b.polynomial_system_);
+		swap(a.use_fused_homotopy_,b.use_fused_homotopy_);
+		swap(a.use_compensated_evaluation_,b.use_compensated_evaluation_);
+		swap(a.use_native_code_,b.use_native_code_);
+		swap(a.generated_kernels_,b.generated_kernels_);
+		swap(a.generated_constants_,b.generated_constants_);
+		swap(a.homotopy_parts_,b.homotopy_parts_);
+		swap(a.evaluation_team_,b.evaluation_team_);
+		swap(a.use_evaluation_cache_,b.use_evaluation_cache_);
+		swap(a.evaluation_cache_,b.evaluation_cache_);
+		swap(a.evaluation_cache_hits_,b.evaluation_cache_hits_);
+
+		swap(a.have_function_dependencies_,b.have_function_dependencies_);
+		swap(a.variable_dependents_,b.variable_dependents_);
+		swap(a.path_variable_dependents_,b.path_variable_dependents_);
+		swap(a.implicit_parameter_dependents_,b.implicit_parameter_dependents_);
+		swap(a.have_jacobian_dependencies_,b.have_jacobian_dependencies_);
+		swap(a.differential_dependents_,b.differential_dependents_);
+		swap(a.jacobian_columns_,b.jacobian_columns_);
+		swap(a.variables_changed_,b.variables_changed_);
+		swap(a.path_variable_changed_,b.path_variable_changed_);
+		swap(a.implicit_parameters_changed_,b.implicit_parameters_changed_);
+		swap(a.loose_leaves_,b.loose_leaves_);
+		swap(a.leaves_changed_,b.leaves_changed_);
 
 		swap(a.precision_,b.precision_);
+		swap(a.tree_precision_,b.tree_precision_);
+		swap(a.shares_trees_,b.shares_trees_);
 		swap(a.is_patched_,b.is_patched_);
 		swap(a.patch_,b.patch_);
 	}
@@ -83,11 +143,33 @@ namespace bertini
 
 		jacobian_ = other.jacobian_;
 		is_differentiated_ = other.is_differentiated_;
+		jacobian_structure_ = other.jacobian_structure_;
+
+		// the compiled program holds its own registers, so is not shared.  the copy compiles its own on first use.
+		use_straight_line_program_ = other.use_straight_line_program_;
+		use_compiled_evaluation_ = other.use_compiled_evaluation_;
+		use_forward_mode_ = other.use_forward_mode_;
+		use_polynomial_system_ = other.use_polynomial_system_;
+		use_fused_homotopy_ = other.use_fused_homotopy_;
+		use_compensated_evaluation_ = other.use_compensated_evaluation_;
+		use_native_code_ = other.use_native_code_;
+		use_evaluation_cache_ = other.use_evaluation_cache_;
 
+		// generated kernels are code, so are shared
+		generated_kernels_ = other.generated_kernels_;
+		generated_constants_ = other.generated_constants_;
+
+		// the parts of a straight-line homotopy hold buffers, so are copied, not shared
+		if (other.homotopy_parts_)
+			homotopy_parts_ = std::make_shared<detail::StraightLineHomotopyParts>(*other.homotopy_parts_);
+
+		// the threads are shared.  runs on them take turns.
+		evaluation_team_ = other.evaluation_team_;
 
 		time_order_of_variable_groups_ = other.time_order_of_variable_groups_;
 
 		current_variable_values_ = other.current_variable_values_;
+		current_path_variable_value_ = other.current_path_variable_value_;
 
 		variable_ordering_ = other.variable_ordering_;
 		have_ordering_ =  other.have_ordering_;
@@ -97,19 +179,23 @@ namespace bertini
 		// now to do the members which are not simply copied
 		constant_subfunctions_.resize(other.constant_subfunctions_.size());
 		for (unsigned ii = 0; ii < constant_subfunctions_.size(); ++ii)
-			constant_subfunctions_[ii] = std::make_shared<bertini::node::Function>(other.constant_subfunctions_[ii]->entry_node());
+			constant_subfunctions_[ii] = bertini::node::MakeNode<bertini::node::Function>(other.constant_subfunctions_[ii]->entry_node());
 
 		subfunctions_.resize(other.subfunctions_.size());
 		for (unsigned ii = 0; ii < subfunctions_.size(); ++ii)
-			subfunctions_[ii] = std::make_shared<bertini::node::Function>(other.subfunctions_[ii]->entry_node());
+			subfunctions_[ii] = bertini::node::MakeNode<bertini::node::Function>(other.subfunctions_[ii]->entry_node());
 
 		functions_.resize(other.functions_.size());
 		for (unsigned ii = 0; ii < functions_.size(); ++ii)
-			functions_[ii] = std::make_shared<bertini::node::Function>(other.functions_[ii]->entry_node());
+			functions_[ii] = bertini::node::MakeNode<bertini::node::Function>(other.functions_[ii]->entry_node());
 
 		explicit_parameters_.resize(other.explicit_parameters_.size());
 		for (unsigned ii = 0; ii < explicit_parameters_.size(); ++ii)
-			explicit_parameters_[ii] = std::make_shared<bertini::node::Function>(other.explicit_parameters_[ii]->entry_node());
+			explicit_parameters_[ii] = bertini::node::MakeNode<bertini::node::Function>(other.explicit_parameters_[ii]->entry_node());
+
+		// a copy of a copy made by CloneForThread can't compile anything from the trees it shares, so is made the same way
+		if (other.shares_trees_)
+			MakeEvaluationPrivate(other);
 	}
 
 	// the assignment operator
@@ -202,34 +288,12 @@ namespace bertini
 
 	void System::precision(unsigned new_precision) const
 	{
-		for (const auto& iter : functions_) {
-			iter->precision(new_precision);
-		}
-
-		for (const auto& iter : subfunctions_) {
-			iter->precision(new_precision);
-		}
-
-		for (const auto& iter : explicit_parameters_) {
-			iter->precision(new_precision);
-		}
-
-
-		for (const auto& iter :implicit_parameters_) {
-			iter->precision(new_precision);
-		}
-
-		for (const auto& iter : constant_subfunctions_) {
-			iter->precision(new_precision);
-		}
-
-		if (is_differentiated_)
-			for (const auto& iter : jacobian_)
-				iter->precision(new_precision);
-
+		// the variables are checked against the precision of the system when set, so change now.  they are few.
 		if (have_path_variable_)
 			path_variable_->precision(new_precision);
 
+		for (const auto& iter :implicit_parameters_)
+			iter->precision(new_precision);
 
 		for (const auto& iter : homogenizing_variables_)
 			iter->precision(new_precision);
@@ -248,23 +312,1069 @@ namespace bertini
 		using bertini::Precision;
 		Precision(std::get<Vec<mpfr> >(current_variable_values_),new_precision);
 
+		// the patch defers re-rounding its coefficients until they are used
 		if (IsPatched())
 			patch_.Precision(new_precision);
 
+		if (homotopy_parts_)
+		{
+			homotopy_parts_->target.precision(new_precision);
+			homotopy_parts_->start.precision(new_precision);
+			homotopy_parts_->gamma->precision(new_precision);
+			homotopy_parts_->Forget();
+			Precision(std::get<mpfr>(current_path_variable_value_), new_precision);
+		}
+
+		// the trees and the programs follow in AdjustPrecisionOfEvaluator, when next evaluated in multiple precision
 		precision_ = new_precision;
 	}
 
 
+	void System::AdjustPrecisionOfEvaluator() const
+	{
+		// the parts of a straight-line homotopy adjust their own, when evaluated
+		if (EvaluatingFusedHomotopy())
+			return;
+
+		if (generated_kernels_)
+			AdjustGeneratedConstants();
+		else if (use_forward_mode_)
+		{
+			const auto& program = GetForwardModeProgram();
+			if (program.precision()!=precision_)
+				program.precision(precision_);
+		}
+		else if (EvaluatingStraightLineProgram())
+		{
+			const auto& program = GetStraightLineProgram();
+			if (program.precision()!=precision_)
+				program.precision(precision_);
+		}
+		else if (EvaluatingPolynomialSystem())
+		{
+			const auto& poly = GetPolynomialSystem();
+			if (poly.precision()!=precision_)
+				poly.precision(precision_);
+		}
+		else if (tree_precision_!=precision_)
+			AdjustTreePrecision();
+	}
+
+
+	void System::AdjustTreePrecision() const
+	{
+		for (const auto& iter : functions_)
+			iter->precision(precision_);
+
+		for (const auto& iter : subfunctions_)
+			iter->precision(precision_);
+
+		for (const auto& iter : explicit_parameters_)
+			iter->precision(precision_);
+
+		for (const auto& iter : constant_subfunctions_)
+			iter->precision(precision_);
+
+		if (is_differentiated_)
+			for (const auto& iter : jacobian_)
+				iter->precision(precision_);
+
+		// the stored values of the nodes, constant or not, are at the old precision
+		have_function_dependencies_ = false;
+
+		tree_precision_ = precision_;
+	}
+
+
 	void System::Differentiate() const
 	{
+			ThrowIfSharingTrees();
+
+			// the rows there are belong to functions unchanged since they were differentiated, so only the missing ones are made
 			jacobian_.resize(NumFunctions());
-			auto num_functions = NumFunctions();
-			for (int ii = 0; ii < num_functions; ++ii)
-				jacobian_[ii] = std::make_shared<bertini::node::Jacobian>(functions_[ii]->Differentiate());
+			std::vector<size_t> missing_rows;
+			for (size_t ii = 0; ii < NumFunctions(); ++ii)
+				if (!jacobian_[ii])
+					missing_rows.push_back(ii);
+			auto num_functions = missing_rows.size();
+
+			// the functions are differentiated in contiguous blocks, one per thread, each into its own entries of the jacobian.  differentiating only reads the function trees, and the nodes it makes are its own, so the threads share nothing but the node allocator, which is locked.
+			const unsigned num_threads = NumDifferentiationThreads(num_functions);
+			const auto digits = DefaultPrecision();
+			std::vector<std::exception_ptr> errors(num_threads);
+			auto differentiate_block = [&](unsigned thread)
+			{
+				try
+				{
+					// the new nodes are made at the default precision of the thread making them
+					if (thread>0)
+						DefaultPrecision(digits);
+					// the functions share subfunctions, so differentiate each of those only once per block.  a subfunction shared across blocks is differentiated in each, and the copies are merged below.
+					node::DifferentiationMemo memo;
+					for (auto ii = num_functions*thread/num_threads; ii < num_functions*(thread+1)/num_threads; ++ii)
+						jacobian_[missing_rows[ii]] = bertini::node::MakeNode<bertini::node::Jacobian>(functions_[missing_rows[ii]]->Differentiate());
+				}
+				catch (...)
+				{
+					errors[thread] = std::current_exception();
+				}
+			};
+
+			{
+				std::vector<std::thread> threads;
+				for (unsigned thread = 1; thread < num_threads; ++thread)
+					threads.emplace_back(differentiate_block, thread);
+				differentiate_block(0);
+				for (auto& t : threads)
+					t.join();
+			}
+			for (const auto& e : errors)
+				if (e)
+					std::rethrow_exception(e);
+
+			// differentiation leaves behind many terms which are 0 or 1, so clean them up.  the jacobians are Functions, so keep their identities.  the rows kept were cleaned when they were made.
+			std::vector<Nd> derivatives;
+			for (auto ii : missing_rows)
+				derivatives.push_back(jacobian_[ii]);
+			node::Simplify(derivatives);
+
+			// differentiation copies the same subtrees into many entries of the jacobian, so merge them, together with those of the functions.  the trees kept are merged already, so what merging there is, is of the new ones.
+			std::vector<Nd> roots(functions_.begin(), functions_.end());
+			roots.insert(roots.end(), jacobian_.begin(), jacobian_.end());
+			node::EliminateCommonSubexpressions(roots);
+
+			ComputeJacobianStructure();
 
 			is_differentiated_ = true;
+			tree_precision_ = 0; // the new jacobian nodes are at the default precision
+			straight_line_program_.reset();
+			straight_line_program_failed_ = false;
+			have_function_dependencies_ = false;
+			have_jacobian_dependencies_ = false;
+		}
+
+
+	StraightLineProgram const& System::GetStraightLineProgram() const
+	{
+		if (!is_differentiated_)
+			Differentiate();
+
+		if (!straight_line_program_)
+		{
+			std::vector<Nd> functions(functions_.begin(), functions_.end());
+			std::vector<Nd> derivatives(jacobian_.begin(), jacobian_.end());
+
+			straight_line_program_ = std::make_shared<StraightLineProgram>(functions, derivatives, Variables(), have_path_variable_ ? path_variable_ : nullptr);
+			straight_line_program_->precision(precision_);
+			straight_line_program_->Compensate(use_compensated_evaluation_);
+			straight_line_program_->UseThreads(evaluation_team_);
 		}
 
+		return *straight_line_program_;
+	}
+
+
+	bool System::HasRealCoefficients() const
+	{
+		return !IsPatched() && GetStraightLineProgram().HasRealCoefficients();
+	}
+
+
+	StraightLineProgram const& System::RealStraightLineProgram() const
+	{
+		if (!HasRealCoefficients())
+			throw std::runtime_error("evaluating in real arithmetic a system without real coefficients");
+
+		const auto& program = GetStraightLineProgram();
+		program.precision(precision_);
+		return program;
+	}
+
+
+	void System::UseEvaluationThreads(unsigned num_threads)
+	{
+		if (num_threads==NumEvaluationThreads())
+			return;
+
+		if (num_threads > 1)
+			evaluation_team_ = std::make_shared<detail::ThreadTeam>(num_threads);
+		else
+			evaluation_team_.reset();
+		ShareEvaluationTeam();
+	}
+
+
+	void System::ShareEvaluationTeam() const
+	{
+		if (straight_line_program_)
+			straight_line_program_->UseThreads(evaluation_team_);
+		if (polynomial_system_)
+			polynomial_system_->UseThreads(evaluation_team_);
+		if (homotopy_parts_)
+		{
+			homotopy_parts_->target.evaluation_team_ = evaluation_team_;
+			homotopy_parts_->target.ShareEvaluationTeam();
+			homotopy_parts_->start.evaluation_team_ = evaluation_team_;
+			homotopy_parts_->start.ShareEvaluationTeam();
+		}
+	}
+
+
+	void System::UseCompensatedEvaluation(bool use_it)
+	{
+		use_compensated_evaluation_ = use_it;
+		if (straight_line_program_)
+			straight_line_program_->Compensate(use_it);
+
+		if (homotopy_parts_)
+		{
+			homotopy_parts_->target.UseCompensatedEvaluation(use_it);
+			homotopy_parts_->start.UseCompensatedEvaluation(use_it);
+			homotopy_parts_->Forget();
+		}
+		ForgetEvaluations();
+	}
+
+
+	bool System::EvaluatingCompensated() const
+	{
+		if (EvaluatingFusedHomotopy())
+			return homotopy_parts_->target.EvaluatingCompensated() && homotopy_parts_->start.EvaluatingCompensated();
+
+		return use_compensated_evaluation_ && !use_forward_mode_ && EvaluatingStraightLineProgram();
+	}
+
+
+	bool System::HaveStraightLineProgram() const
+	{
+		if (!is_differentiated_)
+			Differentiate();
+
+		if (!straight_line_program_ && !straight_line_program_failed_)
+		{
+			try
+			{
+				GetStraightLineProgram();
+			}
+			catch (UnsupportedNodeError const&)
+			{
+				// a node type the program doesn't know.  the trees it is.  any other error is a real one, and propagates.
+				straight_line_program_failed_ = true;
+			}
+		}
+
+		return straight_line_program_!=nullptr;
+	}
+
+
+	StraightLineProgram const& System::GetForwardModeProgram() const
+	{
+		if (!forward_mode_program_)
+		{
+			std::vector<Nd> functions(functions_.begin(), functions_.end());
+
+			forward_mode_program_ = std::make_shared<StraightLineProgram>(functions, std::vector<Nd>(), Variables(), have_path_variable_ ? path_variable_ : nullptr);
+			forward_mode_program_->precision(precision_);
+			if (use_native_code_)
+				forward_mode_program_->CompileNative();
+		}
+
+		return *forward_mode_program_;
+	}
+
+
+	VariableGroup System::GeneratedKernelInputs() const
+	{
+		VariableGroup inputs = Variables();
+		if (have_path_variable_)
+			inputs.push_back(path_variable_);
+		inputs.insert(inputs.end(), implicit_parameters_.begin(), implicit_parameters_.end());
+		return inputs;
+	}
+
+
+	void System::UseGeneratedKernels(std::shared_ptr<detail::GeneratedKernels const> const& kernels)
+	{
+		if (kernels)
+		{
+			std::vector<std::string> names;
+			for (const auto& v : GeneratedKernelInputs())
+				names.push_back(v->name());
+
+			if (names!=kernels->input_names)
+				throw std::runtime_error("using generated kernels with " + std::to_string(kernels->input_names.size()) + " inputs for system whose variables, path variable and implicit parameters (" + std::to_string(names.size()) + ") are not theirs, in their order");
+
+			auto& c = std::get<std::vector<dbl> >(generated_constants_);
+			c.clear();
+			for (const auto& iter : kernels->constants)
+				c.push_back(dbl(mpfr_float(iter.first).convert_to<double>(), mpfr_float(iter.second).convert_to<double>()));
+		}
+
+		generated_kernels_ = kernels;
+		std::get<std::vector<mpfr> >(generated_constants_).clear();
+		ForgetEvaluations();
+	}
+
+
+	void System::AdjustGeneratedConstants() const
+	{
+		auto& c = std::get<std::vector<mpfr> >(generated_constants_);
+		if (c.size()==generated_kernels_->constants.size() && !c.empty() && Precision(c.front())==precision_)
+			return;
+
+		// read from their digits afresh, rather than rounded from another precision
+		const auto previous = DefaultPrecision();
+		DefaultPrecision(precision_);
+		c.clear();
+		for (const auto& iter : generated_kernels_->constants)
+			c.push_back(mpfr(mpfr_float(iter.first), mpfr_float(iter.second)));
+		DefaultPrecision(previous);
+	}
+
+
+	void System::UseNativeCode(bool use_it)
+	{
+		use_native_code_ = use_it;
+		if (!forward_mode_program_)
+			return;
+
+		if (use_it)
+			forward_mode_program_->CompileNative();
+		else if (forward_mode_program_->CompiledNative())
+			forward_mode_program_.reset(); // interpreted again when next compiled
+	}
+
+
+	Mat<dbl> System::EvalBatch(Mat<dbl> const& points) const
+	{
+		if (points.rows()!=NumVariables())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of variables doesn't match.");
+		if (have_path_variable_)
+			throw std::runtime_error("not using a time value for evaluation of system at batch of points, but a path variable is defined.");
+
+		return EvalBatchInputs(points);
+	}
+
+
+	Mat<dbl> System::EvalBatch(Mat<dbl> const& points, Vec<dbl> const& path_variable_values) const
+	{
+		if (points.rows()!=NumVariables())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of variables doesn't match.");
+		if (!have_path_variable_)
+			throw std::runtime_error("trying to use time values for evaluation of system at batch of points, but no path variable defined.");
+		if (path_variable_values.size()!=points.cols())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of time values (" + std::to_string(path_variable_values.size()) + ") doesn't match number of points (" + std::to_string(points.cols()) + ").");
+
+		Mat<dbl> inputs(points.rows()+1, points.cols());
+		inputs.topRows(points.rows()) = points;
+		inputs.bottomRows(1) = path_variable_values.transpose();
+		return EvalBatchInputs(inputs);
+	}
+
+
+	Mat<dbl> System::EvalBatchAtParameters(Mat<dbl> const& points, Mat<dbl> const& implicit_parameter_values) const
+	{
+		if (points.rows()!=NumVariables())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of variables doesn't match.");
+		if (have_path_variable_)
+			throw std::runtime_error("not using a time value for evaluation of system at batch of points, but a path variable is defined.");
+		if (size_t(implicit_parameter_values.rows())!=NumImplicitParameters() || implicit_parameter_values.cols()!=points.cols())
+			throw std::runtime_error("trying to evaluate system at batch of points, but the implicit parameter values are " + std::to_string(implicit_parameter_values.rows()) + " by " + std::to_string(implicit_parameter_values.cols()) + ", not " + std::to_string(NumImplicitParameters()) + " by " + std::to_string(points.cols()) + ".");
+
+		return EvalBatchInputs(points, &implicit_parameter_values);
+	}
+
+
+	Mat<dbl> System::EvalBatchAtParameters(Mat<dbl> const& points, Vec<dbl> const& path_variable_values, Mat<dbl> const& implicit_parameter_values) const
+	{
+		if (points.rows()!=NumVariables())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of variables doesn't match.");
+		if (!have_path_variable_)
+			throw std::runtime_error("trying to use time values for evaluation of system at batch of points, but no path variable defined.");
+		if (path_variable_values.size()!=points.cols())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of time values (" + std::to_string(path_variable_values.size()) + ") doesn't match number of points (" + std::to_string(points.cols()) + ").");
+		if (size_t(implicit_parameter_values.rows())!=NumImplicitParameters() || implicit_parameter_values.cols()!=points.cols())
+			throw std::runtime_error("trying to evaluate system at batch of points, but the implicit parameter values are " + std::to_string(implicit_parameter_values.rows()) + " by " + std::to_string(implicit_parameter_values.cols()) + ", not " + std::to_string(NumImplicitParameters()) + " by " + std::to_string(points.cols()) + ".");
+
+		Mat<dbl> inputs(points.rows()+1, points.cols());
+		inputs.topRows(points.rows()) = points;
+		inputs.bottomRows(1) = path_variable_values.transpose();
+		return EvalBatchInputs(inputs, &implicit_parameter_values);
+	}
+
+
+	void System::EvalBatchWithDerivatives(BatchLanes const& inputs, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const
+	{
+		EvalBatchWithDerivativesAt(inputs, nullptr, function_values, jacobian, time_derivatives);
+	}
+
+
+	void System::EvalBatchWithDerivatives(BatchLanes const& inputs, BatchLanes const& implicit_parameter_values, BatchLanes & function_values, BatchLanes & jacobian, BatchLanes & time_derivatives) const
+	{
+		if (implicit_parameter_values.NumEntries()!=NumImplicitParameters())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of implicit parameter values (" + std::to_string(implicit_parameter_values.NumEntries()) + ") doesn't match number of implicit parameters (" + std::to_string(NumImplicitParameters()) + ").");
+
+		EvalBatchWithDerivativesAt(inputs, &implicit_parameter_values, function_values, jacobian, time_derivatives);
+	}
+
+
+	void System::EvalBatchWithDerivatives(FloatBatchLanes const& inputs, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const
+	{
+		EvalBatchWithDerivativesAt(inputs, nullptr, function_values, jacobian, time_derivatives);
+	}
+
+
+	void System::EvalBatchWithDerivatives(FloatBatchLanes const& inputs, FloatBatchLanes const& implicit_parameter_values, FloatBatchLanes & function_values, FloatBatchLanes & jacobian, FloatBatchLanes & time_derivatives) const
+	{
+		if (implicit_parameter_values.NumEntries()!=NumImplicitParameters())
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of implicit parameter values (" + std::to_string(implicit_parameter_values.NumEntries()) + ") doesn't match number of implicit parameters (" + std::to_string(NumImplicitParameters()) + ").");
+
+		EvalBatchWithDerivativesAt(inputs, &implicit_parameter_values, function_values, jacobian, time_derivatives);
+	}
+
+
+	template<typename S>
+	void System::EvalBatchWithDerivativesAt(BasicBatchLanes<S> const& inputs, BasicBatchLanes<S> const* implicit_parameter_values, BasicBatchLanes<S> & function_values, BasicBatchLanes<S> & jacobian, BasicBatchLanes<S> & time_derivatives) const
+	{
+		if (!have_path_variable_)
+			throw std::runtime_error("trying to evaluate time derivatives of system at batch of points, but no path variable defined.");
+		if (inputs.NumEntries()!=size_t(NumVariables())+1)
+			throw std::runtime_error("trying to evaluate system at batch of points, but number of inputs (" + std::to_string(inputs.NumEntries()) + ") doesn't match number of variables and path variable (" + std::to_string(NumVariables()+1) + ").");
+
+		if (implicit_parameter_values)
+			GetForwardModeProgram().EvalForwardModeBatch(inputs, implicit_parameters_, *implicit_parameter_values, function_values, jacobian, time_derivatives);
+		else
+			GetForwardModeProgram().EvalForwardModeBatch(inputs, function_values, jacobian, time_derivatives);
+
+		if (!IsPatched())
+			return;
+
+		// the patches are linear in the variables, and do not depend on the path variable
+		constexpr size_t W = BasicBatchLanes<S>::Width;
+		const size_t num_functions = NumFunctions();
+		const size_t num_variables = NumVariables();
+		const size_t num_total_functions = NumTotalFunctions();
+		function_values.Resize(num_total_functions);
+		jacobian.Resize(num_total_functions*num_variables);
+		time_derivatives.Resize(num_total_functions);
+
+		Vec<dbl> x(num_variables);
+		Vec<dbl> values(num_total_functions);
+		for (size_t l = 0; l < W; ++l)
+		{
+			for (size_t jj = 0; jj < num_variables; ++jj)
+				x(jj) = inputs.Get(jj, l);
+			patch_.EvalInPlace(values, x);
+			for (size_t ii = num_functions; ii < num_total_functions; ++ii)
+				function_values.Set(ii, l, values(ii));
+		}
+
+		Mat<dbl> patch_jacobian(num_total_functions - num_functions, num_variables);
+		patch_.JacobianInPlace(patch_jacobian, x);
+		for (size_t ii = num_functions; ii < num_total_functions; ++ii)
+		{
+			for (size_t jj = 0; jj < num_variables; ++jj)
+			{
+				const auto& c = patch_jacobian(ii - num_functions, jj);
+				std::fill_n(jacobian.real.begin() + (ii*num_variables + jj)*W, W, S(c.real()));
+				std::fill_n(jacobian.imag.begin() + (ii*num_variables + jj)*W, W, S(c.imag()));
+			}
+			std::fill_n(time_derivatives.real.begin() + ii*W, W, S(0));
+			std::fill_n(time_derivatives.imag.begin() + ii*W, W, S(0));
+		}
+	}
+
+
+	Mat<dbl> System::EvalBatchInputs(Mat<dbl> const& inputs, Mat<dbl> const* implicit_parameter_values) const
+	{
+		Mat<dbl> function_values;
+		if (implicit_parameter_values)
+			GetForwardModeProgram().EvalFunctionsBatch(inputs, implicit_parameters_, *implicit_parameter_values, function_values);
+		else
+			GetForwardModeProgram().EvalFunctionsBatch(inputs, function_values);
+
+		if (!IsPatched())
+			return function_values;
+
+		Mat<dbl> total_values(NumTotalFunctions(), inputs.cols());
+		total_values.topRows(NumFunctions()) = function_values;
+
+		Vec<dbl> values(NumTotalFunctions());
+		Vec<dbl> x(NumVariables());
+		for (int ii = 0; ii < inputs.cols(); ++ii)
+		{
+			x = inputs.col(ii).head(NumVariables());
+			patch_.EvalInPlace(values, x);
+			total_values.col(ii).tail(NumTotalVariableGroups()) = values.tail(NumTotalVariableGroups());
+		}
+		return total_values;
+	}
+
+
+	bool System::HavePolynomialSystem() const
+	{
+		if (!have_polynomial_system_)
+		{
+			std::vector<Nd> functions(functions_.begin(), functions_.end());
+
+			try
+			{
+				polynomial_system_ = std::make_shared<PolynomialSystem>(functions, Variables(), have_path_variable_ ? path_variable_ : nullptr);
+				polynomial_system_->precision(precision_);
+				polynomial_system_->UseThreads(evaluation_team_);
+			}
+			catch (std::runtime_error const&)
+			{
+				// not polynomial, or too large when expanded.  the trees it is.
+				polynomial_system_.reset();
+			}
+			have_polynomial_system_ = true;
+		}
+
+		return polynomial_system_!=nullptr;
+	}
+
+
+	PolynomialSystem const& System::GetPolynomialSystem() const
+	{
+		if (!HavePolynomialSystem())
+			throw std::runtime_error("trying to get polynomial system, but the functions are not polynomial in the variables and path variable");
+
+		return *polynomial_system_;
+	}
+
+
+	System System::CloneForThread() const
+	{
+		// the copy can't make the compiled form from the trees, so make it here.  the parts of a straight-line homotopy are cloned instead, in MakeEvaluationPrivate
+		if (use_forward_mode_ && !EvaluatingFusedHomotopy())
+			GetForwardModeProgram();
+		else if (!EvaluatingFusedHomotopy() && !EvaluatingStraightLineProgram() && !EvaluatingPolynomialSystem())
+			throw std::runtime_error("trying to clone system for thread, but it can only be evaluated by walking its trees");
+
+		Variables(); // the ordering is copied with the variables
+
+		System clone(*this);
+		if (!shares_trees_) // else the copy constructor did it
+			clone.MakeEvaluationPrivate(*this);
+		return clone;
+	}
+
+
+	void System::MakeEvaluationPrivate(System const& original)
+	{
+		std::map<const node::Variable*, Var> substitutes;
+		auto substitute = [&](Var & v)
+		{
+			auto& s = substitutes[v.get()];
+			if (!s)
+			{
+				s = node::MakeNode<node::Variable>(v->name());
+				s->precision(precision_);
+			}
+			v = s;
+		};
+
+		for (auto& iter : ungrouped_variables_)
+			substitute(iter);
+		for (auto& iter : variable_groups_)
+			for (auto& jter : iter)
+				substitute(jter);
+		for (auto& iter : hom_variable_groups_)
+			for (auto& jter : iter)
+				substitute(jter);
+		for (auto& iter : homogenizing_variables_)
+			substitute(iter);
+		for (auto& iter : implicit_parameters_)
+			substitute(iter);
+		for (auto& iter : variable_ordering_)
+			substitute(iter);
+		if (have_path_variable_)
+			substitute(path_variable_);
+
+		// copying the compiled forms copies their registers, the only state which changes when evaluating them
+		if (original.forward_mode_program_)
+		{
+			forward_mode_program_ = std::make_shared<StraightLineProgram>(*original.forward_mode_program_);
+			forward_mode_program_->SubstituteInputs(substitutes);
+		}
+		if (original.straight_line_program_)
+		{
+			straight_line_program_ = std::make_shared<StraightLineProgram>(*original.straight_line_program_);
+			straight_line_program_->SubstituteInputs(substitutes);
+		}
+		straight_line_program_failed_ = original.straight_line_program_failed_;
+		if (original.have_polynomial_system_ && original.polynomial_system_)
+		{
+			polynomial_system_ = std::make_shared<PolynomialSystem>(*original.polynomial_system_);
+			polynomial_system_->SubstituteInputs(substitutes);
+		}
+		have_polynomial_system_ = original.have_polynomial_system_;
+
+		// the compiled forms read the other leaves of the trees from the original's nodes, so watch the same ones
+		if (!original.shares_trees_)
+			original.EnsureFunctionDependencies();
+		loose_leaves_ = original.loose_leaves_;
+
+		if (original.EvaluatingFusedHomotopy())
+		{
+			auto const& parts = *original.homotopy_parts_;
+			homotopy_parts_ = std::make_shared<detail::StraightLineHomotopyParts>(detail::StraightLineHomotopyParts{parts.target.CloneForThread(), parts.start.CloneForThread(), parts.gamma});
+		}
+		else
+			homotopy_parts_.reset();
+
+		// the copied compiled forms came with the team of the original
+		evaluation_team_.reset();
+		ShareEvaluationTeam();
+
+		shares_trees_ = true;
+	}
+
+
+
+	namespace {
+
+		enum DependencySource : unsigned
+		{
+			VariableSource = 1,
+			PathVariableSource = 2,
+			ImplicitParameterSource = 4,
+			DifferentialSource = 8,
+			AllSources = 15
+		};
+
+		/**
+		\brief Get the children of a node.
+
+		\return false if n is of a type whose children we don't know, true if children was filled.  Leaves have no children.
+		*/
+		bool GetChildren(std::shared_ptr<node::Node> const& n, std::vector< std::shared_ptr<node::Node> > & children)
+		{
+			children.clear();
+			if (auto f = std::dynamic_pointer_cast<node::Function>(n))
+				children.push_back(f->entry_node());
+			else if (auto m = std::dynamic_pointer_cast<node::NaryOperator>(n))
+				children = m->children();
+			else if (auto p = std::dynamic_pointer_cast<node::PowerOperator>(n))
+			{
+				children.push_back(p->base());
+				children.push_back(p->exponent());
+			}
+			else if (auto u = std::dynamic_pointer_cast<node::UnaryOperator>(n))
+				children.push_back(u->first_child());
+			else if (!std::dynamic_pointer_cast<node::Variable>(n) && !std::dynamic_pointer_cast<node::Number>(n) && !std::dynamic_pointer_cast<node::special_number::Pi>(n) && !std::dynamic_pointer_cast<node::special_number::E>(n))
+				return false;
+			return true;
+		}
+
+		/**
+		\brief Compute which sources a node depends on, as a bitwise or of DependencySource's, memoizing the result for every node below it.
+
+		\param loose If not null, gets each Variable below the node which is none of the sources, once.
+		*/
+		unsigned DependencyMask(std::shared_ptr<node::Node> const& n, std::unordered_map<const node::Node*, unsigned> const& sources, std::unordered_map<const node::Node*, unsigned> & masks, std::vector< std::shared_ptr<node::Variable> > * loose = nullptr)
+		{
+			auto found = masks.find(n.get());
+			if (found!=masks.end())
+				return found->second;
+
+			unsigned mask = 0;
+			std::vector< std::shared_ptr<node::Node> > children;
+			if (auto v = std::dynamic_pointer_cast<node::Variable>(n))
+			{
+				auto source = sources.find(n.get());
+				if (source!=sources.end())
+					mask = source->second;
+				else if (loose)
+					loose->push_back(v);
+			}
+			else if (std::dynamic_pointer_cast<node::Differential>(n))
+				mask = DifferentialSource;
+			else if (GetChildren(n, children))
+			{
+				for (const auto& iter : children)
+					mask |= DependencyMask(iter, sources, masks, loose);
+			}
+			else
+				// a node we don't know the children of.  assume it depends on everything.
+				mask = AllSources;
+
+			masks[n.get()] = mask;
+			return mask;
+		}
+
+		/**
+		\brief Collect the indices of the variables a tree depends on.
+
+		\return false if the tree contains a node whose children we don't know, so it may depend on any variable.
+		*/
+		bool CollectVariables(std::shared_ptr<node::Node> const& n, std::unordered_map<const node::Node*, unsigned> const& indices, std::unordered_set<const node::Node*> & visited, std::set<unsigned> & found)
+		{
+			if (!visited.insert(n.get()).second)
+				return true;
+
+			if (std::dynamic_pointer_cast<node::Variable>(n))
+			{
+				auto index = indices.find(n.get());
+				if (index!=indices.end())
+					found.insert(index->second);
+				return true;
+			}
+
+			std::vector< std::shared_ptr<node::Node> > children;
+			if (!GetChildren(n, children))
+				return false;
+
+			for (const auto& iter : children)
+				if (!CollectVariables(iter, indices, visited, found))
+					return false;
+			return true;
+		}
+
+		/**
+		\brief Tally the nodes of a tree not already visited into a component of a report, by their type, and the multiple-precision values they keep into another.
+		*/
+		void TallyNodes(std::shared_ptr<node::Node> const& root, std::unordered_set<const node::Node*> & visited, std::string const& component, MemoryUsage & report)
+		{
+			std::vector< std::shared_ptr<node::Node> > pending{root}, children;
+			while (!pending.empty())
+			{
+				auto n = pending.back();
+				pending.pop_back();
+				if (!n || !visited.insert(n.get()).second)
+					continue;
+
+				// nodes we don't know the children of are counted as leaves
+				if (!GetChildren(n, children))
+					children.clear();
+
+				auto type = boost::typeindex::type_id_runtime(*n).pretty_name();
+				const auto colons = type.rfind("::");
+				if (colons!=std::string::npos)
+					type = type.substr(colons+2);
+				report.Add(component + "/" + type, sizeof(node::Node) + children.size()*sizeof(std::shared_ptr<node::Node>), 1);
+
+				if (n->HasMultiplePrecisionValue())
+					report.Add("node_values", sizeof(std::pair<mpfr, bool>) + 2*memory::SignificandBytes(n->precision()), 1);
+
+				pending.insert(pending.end(), children.begin(), children.end());
+			}
+		}
+	} // re: namespace
+
+
+	MemoryUsage System::MemoryReport() const
+	{
+		using memory::HeapBytes;
+		MemoryUsage report;
+
+		if (!shares_trees_)
+		{
+			std::unordered_set<const node::Node*> visited;
+			for (auto group : {&functions_, &subfunctions_, &explicit_parameters_, &constant_subfunctions_})
+				for (auto const& iter : *group)
+					TallyNodes(iter, visited, "function_trees", report);
+			for (auto const& iter : Variables())
+				TallyNodes(iter, visited, "function_trees", report);
+			for (auto const& iter : implicit_parameters_)
+				TallyNodes(iter, visited, "function_trees", report);
+			if (have_path_variable_)
+				TallyNodes(path_variable_, visited, "function_trees", report);
+
+			for (auto const& iter : jacobian_)
+				TallyNodes(iter, visited, "jacobian_trees", report);
+		}
+
+		std::size_t structure = HeapBytes(jacobian_structure_);
+		for (auto const& iter : jacobian_structure_)
+			structure += HeapBytes(iter);
+		structure += HeapBytes(jacobian_columns_);
+		for (auto const& iter : jacobian_columns_)
+			structure += HeapBytes(iter);
+		report.Add("dependencies", structure + HeapBytes(variable_dependents_) + HeapBytes(path_variable_dependents_) + HeapBytes(implicit_parameter_dependents_) + HeapBytes(differential_dependents_));
+
+		if (is_patched_)
+			report.Add("patch", patch_.MemoryReport());
+
+		if (straight_line_program_)
+			report.Add("straight_line_program", straight_line_program_->MemoryReport());
+		if (forward_mode_program_)
+			report.Add("forward_mode_program", forward_mode_program_->MemoryReport());
+		if (polynomial_system_)
+			report.Add("polynomial_system", polynomial_system_->MemoryReport());
+		if (generated_kernels_)
+			report.Add("generated_kernels", HeapBytes(generated_constants_) + HeapBytes(generated_inputs_) + HeapBytes(generated_outputs_));
+
+		report.Add("variable_values", HeapBytes(current_variable_values_) + HeapBytes(current_path_variable_value_));
+
+		auto const& cache_dbl = std::get<EvaluationCache<dbl> >(evaluation_cache_);
+		auto const& cache_mp = std::get<EvaluationCache<mpfr> >(evaluation_cache_);
+		report.Add("evaluation_cache",
+		           HeapBytes(cache_dbl.point) + HeapBytes(cache_dbl.values) + HeapBytes(cache_dbl.jacobian) + HeapBytes(cache_dbl.time_derivative) +
+		           HeapBytes(cache_mp.point) + HeapBytes(cache_mp.time) + HeapBytes(cache_mp.values) + HeapBytes(cache_mp.jacobian) + HeapBytes(cache_mp.time_derivative));
+
+		if (homotopy_parts_)
+		{
+			auto const& parts = *homotopy_parts_;
+			report.Add("homotopy/target", parts.target.MemoryReport());
+			report.Add("homotopy/start", parts.start.MemoryReport());
+			report.Add("homotopy/buffers",
+			           HeapBytes(parts.target_values) + HeapBytes(parts.start_values) + HeapBytes(parts.target_jacobian) + HeapBytes(parts.start_jacobian) + HeapBytes(parts.values_point) + HeapBytes(parts.jacobian_point));
+		}
+
+		return report;
+	}
+
+
+	std::vector<System::Nd> System::FunctionTreeNodes() const
+	{
+		ThrowIfSharingTrees();
+
+		// depth first, children in their order, each node when first reached
+		std::vector<Nd> nodes;
+		std::unordered_set<const node::Node*> visited;
+		std::vector<Nd> stack, children;
+		for (auto const& f : functions_)
+		{
+			stack.push_back(f);
+			while (!stack.empty())
+			{
+				auto n = stack.back();
+				stack.pop_back();
+				if (!visited.insert(n.get()).second)
+					continue;
+				nodes.push_back(n);
+
+				if (!GetChildren(n, children))
+					throw std::runtime_error("numbering the nodes of the function trees, but one is of a type whose children are unknown");
+				stack.insert(stack.end(), children.rbegin(), children.rend());
+			}
+		}
+		return nodes;
+	}
+
+
+	void System::ComputeFunctionDependencies() const
+	{
+		std::unordered_map<const node::Node*, unsigned> sources;
+		for (const auto& iter : Variables())
+			sources[iter.get()] |= VariableSource;
+		if (have_path_variable_)
+			sources[path_variable_.get()] |= PathVariableSource;
+		for (const auto& iter : implicit_parameters_)
+			sources[iter.get()] |= ImplicitParameterSource;
+
+		std::unordered_map<const node::Node*, unsigned> masks;
+		std::vector< std::shared_ptr<node::Variable> > loose;
+		for (const auto& iter : functions_)
+			DependencyMask(iter, sources, masks, &loose);
+
+		loose_leaves_.clear();
+		for (const auto& iter : loose)
+			loose_leaves_.emplace_back(iter, iter->Version());
+
+		variable_dependents_.clear();
+		path_variable_dependents_.clear();
+		implicit_parameter_dependents_.clear();
+		for (const auto& iter : masks)
+		{
+			if (iter.second & VariableSource)
+				variable_dependents_.push_back(iter.first);
+			if (iter.second & PathVariableSource)
+				path_variable_dependents_.push_back(iter.first);
+			if (iter.second & ImplicitParameterSource)
+				implicit_parameter_dependents_.push_back(iter.first);
+		}
+
+		have_function_dependencies_ = true;
+	}
+
+
+	void System::ComputeJacobianDependencies() const
+	{
+		std::unordered_map<const node::Node*, unsigned> sources;
+		std::unordered_map<const node::Node*, unsigned> masks;
+		for (const auto& iter : jacobian_)
+			DependencyMask(iter, sources, masks);
+
+		differential_dependents_.clear();
+		for (const auto& iter : masks)
+			if (iter.second & DifferentialSource)
+				differential_dependents_.push_back(iter.first);
+
+		jacobian_columns_.assign(Variables().size(), std::vector<unsigned>());
+		for (unsigned ii = 0; ii < jacobian_structure_.size(); ++ii)
+			for (auto jj : jacobian_structure_[ii])
+				jacobian_columns_[jj].push_back(ii);
+
+		have_jacobian_dependencies_ = true;
+	}
+
+
+	void System::ResetJacobianTrees() const
+	{
+		if (!have_jacobian_dependencies_)
+			ComputeJacobianDependencies();
+
+		for (const auto& iter : jacobian_)
+			iter->Reset();
+	}
+
+
+	void System::ComputeJacobianStructure() const
+	{
+		const auto& vars = Variables();
+		std::unordered_map<const node::Node*, unsigned> indices;
+		for (unsigned ii = 0; ii < vars.size(); ++ii)
+			indices[vars[ii].get()] = ii;
+
+		jacobian_structure_.resize(NumFunctions());
+		for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+		{
+			std::unordered_set<const node::Node*> visited;
+			std::set<unsigned> found;
+			jacobian_structure_[ii].clear();
+			if (CollectVariables(functions_[ii], indices, visited, found))
+				jacobian_structure_[ii].assign(found.begin(), found.end());
+			else
+				for (unsigned jj = 0; jj < vars.size(); ++jj)
+					jacobian_structure_[ii].push_back(jj);
+		}
+	}
+
+
+	std::vector< std::vector<unsigned> > const& System::JacobianStructure() const
+	{
+		if (!is_differentiated_)
+			Differentiate();
+		return jacobian_structure_;
+	}
+
+
+	size_t System::NumJacobianNonzeros() const
+	{
+		size_t num_nonzeros = 0;
+		for (const auto& iter : JacobianStructure())
+			num_nonzeros += iter.size();
+
+		if (IsPatched())
+			for (const auto& iter : patch_.VariableGroupSizes())
+				num_nonzeros += iter;
+
+		return num_nonzeros;
+	}
+
+
+	std::vector< std::vector<unsigned> > System::LinearSolveStructure() const
+	{
+		std::vector< std::vector<unsigned> > structure;
+		if (NumTotalFunctions()!=NumVariables() || NumVariables() < std::min(detail::MinSparseLUSize, detail::MinBandedLUSize))
+			return structure;
+
+		auto can_differentiate = [](System const& s){ return s.is_differentiated_ || !s.shares_trees_; };
+
+		if (EvaluatingFusedHomotopy())
+		{
+			if (!can_differentiate(homotopy_parts_->target) || !can_differentiate(homotopy_parts_->start))
+				return structure;
+			auto const& target = homotopy_parts_->target.JacobianStructure();
+			auto const& start = homotopy_parts_->start.JacobianStructure();
+			structure.resize(NumFunctions());
+			for (unsigned ii = 0; ii < NumFunctions(); ++ii)
+				std::set_union(target[ii].begin(), target[ii].end(), start[ii].begin(), start[ii].end(), std::back_inserter(structure[ii]));
+		}
+		else if (can_differentiate(*this))
+			structure = JacobianStructure();
+		else
+			return structure;
+
+		if (IsPatched())
+		{
+			unsigned counter(0);
+			for (unsigned ii = 0; ii < patch_.NumVariableGroups(); ++ii)
+			{
+				structure.emplace_back();
+				for (unsigned jj = 0; jj < patch_.VariableGroupSizes()[ii]; ++jj)
+					structure.back().push_back(counter++);
+			}
+		}
+
+		if (!detail::StructuredLUPays(structure))
+			structure.clear();
+		return structure;
+	}
+
+
+	void System::ForgetStoredValues() const
+	{
+		// the next walk of the trees resets them all, as after any change to the system
+		have_function_dependencies_ = false;
+		ForgetEvaluations();
+	}
+
+
+	void System::EnsureFunctionDependencies() const
+	{
+		if (have_function_dependencies_)
+			return;
+
+		for (const auto& iter : functions_)
+			iter->Reset();
+		ComputeFunctionDependencies();
+	}
+
+
+	void System::NoteChangedLeaves() const
+	{
+		// a copy made by CloneForThread has the leaves of the original, found when it was made
+		if (!shares_trees_)
+			EnsureFunctionDependencies();
+
+		bool changed = false;
+		for (auto& iter : loose_leaves_)
+			if (iter.first->Version()!=iter.second)
+			{
+				iter.second = iter.first->Version();
+				changed = true;
+			}
+
+		if (changed)
+		{
+			leaves_changed_ = true;
+			ForgetEvaluations();
+		}
+	}
+
+
+	void System::ResetChangedFunctionValues() const
+	{
+		NoteChangedLeaves();
+
+		if (leaves_changed_)
+		{
+			for (const auto& iter : functions_)
+				iter->Reset();
+		}
+		else
+		{
+			if (variables_changed_)
+				for (const auto& iter : variable_dependents_)
+					iter->ResetStoredValues();
+			if (path_variable_changed_)
+				for (const auto& iter : path_variable_dependents_)
+					iter->ResetStoredValues();
+			if (implicit_parameters_changed_)
+				for (const auto& iter : implicit_parameter_dependents_)
+					iter->ResetStoredValues();
+		}
+
+		variables_changed_ = false;
+		path_variable_changed_ = false;
+		implicit_parameters_changed_ = false;
+		leaves_changed_ = false;
+	}
+
 
 
 
@@ -280,17 +1390,21 @@ namespace bertini
 		//    * not partially homogenized, in the sense that some groups have been homogenized, and others haven't
 		//    
 		//
-		for (const auto& curr_function : functions_)
-		{	
-			for (const auto& curr_var_gp : hom_variable_groups_)
-			{
-				if (!curr_function->IsHomogeneous(curr_var_gp))
-					throw std::runtime_error("inhomogeneous function, with homogeneous variable group");
+		{
+			// the memo must close before any function is changed
+			node::StructureMemo memo;
+			for (const auto& curr_function : functions_)
+			{	
+				for (const auto& curr_var_gp : hom_variable_groups_)
+				{
+					if (!curr_function->IsHomogeneous(curr_var_gp))
+						throw std::runtime_error("inhomogeneous function, with homogeneous variable group");
+				}
 			}
-		}
 
-		if (!IsPolynomial())
-			throw std::runtime_error("trying to homogenize a non-polynomial system.");
+			if (!IsPolynomial())
+				throw std::runtime_error("trying to homogenize a non-polynomial system.");
+		}
 
 		bool already_had_homvars = NumHomVariables()!=0;
 		
@@ -301,6 +1415,7 @@ namespace bertini
 			homogenizing_variables_.resize(NumVariableGroups());
 
 
+		bool changed = !already_had_homvars;
 		auto group_counter = 0;
 		for (auto curr_var_gp = variable_groups_.begin(); curr_var_gp!=variable_groups_.end(); curr_var_gp++)
 		{
@@ -312,12 +1427,20 @@ namespace bertini
 				Var hom_var = homogenizing_variables_[group_counter];
 				VariableGroup temp_group = *curr_var_gp;
 				temp_group.push_front(hom_var);
-				for (const auto& curr_function : functions_)
-					curr_function->Homogenize(temp_group, hom_var);
+				// the functions homogenized already, as before others were added, are left as they are, so keep their rows of the jacobian
+				for (size_t ii = 0; ii < functions_.size(); ++ii)
+				{
+					if (functions_[ii]->IsHomogeneous(temp_group))
+						continue;
+					functions_[ii]->Homogenize(temp_group, hom_var);
+					if (ii < jacobian_.size())
+						jacobian_[ii].reset();
+					changed = true;
+				}
 			}
 			else
 			{
-				Var hom_var = std::make_shared<bertini::node::Variable>(converter.str());
+				Var hom_var = bertini::node::MakeNode<bertini::node::Variable>(converter.str());
 				homogenizing_variables_[group_counter] = hom_var;
 				for (const auto& curr_function : functions_)
 					curr_function->Homogenize(*curr_var_gp, hom_var);
@@ -331,31 +1454,59 @@ namespace bertini
 		#ifndef BERTINI_DISABLE_ASSERTS
 		assert(homogenizing_variables_.size() == variable_groups_.size());
 		#endif
+
+		if (!changed)
+			return;
+
+		// the homogenizing variables are new, so the ordering must be rebuilt, and the jacobian has columns for them
+		have_ordering_ = false;
+		if (already_had_homvars)
+			is_differentiated_ = false;
+		else
+			ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
 
 
-	bool System::IsHomogeneous() const
+	std::vector<VariableGroup> System::GroupsWithHomVariables() const
 	{
 		bool have_homvars = NumHomVariables()!=0;
 
+		std::vector<VariableGroup> groups;
+		groups.reserve(variable_groups_.size());
+		auto counter = 0;
+		for (const auto& vars : variable_groups_)
+		{
+			groups.push_back(vars);
+			if (have_homvars)
+				groups.back().push_front(homogenizing_variables_[counter]);
+			counter++;
+		}
+		return groups;
+	}
+
+
+	bool System::IsHomogeneous() const
+	{
 		if (NumHomVariables()!=NumVariableGroups())
 			return false;
 
+		// shared subtrees are checked once per group, so the groups must outlive the memo
+		const auto groups = GroupsWithHomVariables();
+		node::StructureMemo memo;
+
 		for (const auto& iter : functions_)
 		{
-			auto counter = 0;
-			for (const auto& vars : variable_groups_)
-			{
-				auto tempvars = vars;
-				if (have_homvars)
-					tempvars.push_front(homogenizing_variables_[counter]);
-				counter++;
-
+			for (const auto& tempvars : groups)
 				if (!iter->IsHomogeneous(tempvars))
 					return false;
-			}
 
 			for (const auto& vars : hom_variable_groups_)
 				if (!iter->IsHomogeneous(vars))
@@ -376,21 +1527,15 @@ namespace bertini
 			throw std::runtime_error("trying to check polynomiality on a partially-formed system.  mismatch between number of homogenizing variables, and number of variable groups");
 
 
+		// shared subtrees are checked once per group, so the groups must outlive the memo
+		const auto groups = GroupsWithHomVariables();
+		node::StructureMemo memo;
+
 		for (const auto& iter : functions_)
 		{
-			auto counter = 0;
-			for (const auto& vars : variable_groups_)
-			{
-				auto tempvars = vars;
-				if (have_homvars)
-					tempvars.push_front(homogenizing_variables_[counter]);
-
-				counter++;
-
+			for (const auto& tempvars : groups)
 				if (!iter->IsPolynomial(tempvars))
 					return false;
-
-			}
 			for (const auto& vars : hom_variable_groups_)
 				if (!iter->IsPolynomial(vars))
 					return false;
@@ -419,7 +1564,13 @@ namespace bertini
 	void System::AddVariableGroup(VariableGroup const& v)
 	{
 		variable_groups_.push_back(v);
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		time_order_of_variable_groups_.push_back( VariableGroupType::Affine);
@@ -431,7 +1582,13 @@ namespace bertini
 	void System::AddHomVariableGroup(VariableGroup const& v)
 	{
 		hom_variable_groups_.push_back(v);
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		time_order_of_variable_groups_.push_back( VariableGroupType::Homogeneous);
@@ -444,7 +1601,13 @@ namespace bertini
 	void System::AddUngroupedVariable(Var const& v)
 	{
 		ungrouped_variables_.push_back(v);
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		time_order_of_variable_groups_.push_back( VariableGroupType::Ungrouped);
@@ -456,7 +1619,13 @@ namespace bertini
 	void System::AddUngroupedVariables(VariableGroup const& v)
 	{
 		ungrouped_variables_.insert( ungrouped_variables_.end(), v.begin(), v.end() );
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 		have_ordering_ = false;
 		is_patched_ = false;
 		for (const auto& iter : v)
@@ -469,7 +1638,13 @@ namespace bertini
 	void System::AddImplicitParameter(Var const& v)
 	{
 		implicit_parameters_.push_back(v);
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -478,7 +1653,13 @@ namespace bertini
 	void System::AddImplicitParameters(VariableGroup const& v)
 	{
 		implicit_parameters_.insert( implicit_parameters_.end(), v.begin(), v.end() );
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -492,7 +1673,13 @@ namespace bertini
 	void System::AddParameter(Fn const& F)
 	{
 		explicit_parameters_.push_back(F);
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -500,7 +1687,13 @@ namespace bertini
 	void System::AddParameters(std::vector<Fn> const& v)
 	{
 		explicit_parameters_.insert( explicit_parameters_.end(), v.begin(), v.end() );
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -510,7 +1703,13 @@ namespace bertini
 	void System::AddSubfunction(Fn const& F)
 	{
 		subfunctions_.push_back(F);
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -518,7 +1717,13 @@ namespace bertini
 	void System::AddSubfunctions(std::vector<Fn> const& v)
 	{
 		subfunctions_.insert( subfunctions_.end(), v.begin(), v.end() );
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -528,16 +1733,28 @@ namespace bertini
 	void System::AddFunction(Fn const& F)
 	{
 		functions_.push_back(F);
-		is_differentiated_ = false;
+		is_differentiated_ = false; // the rows of the functions there were are kept, see Differentiate
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
 
 	void System::AddFunction(Nd const& N)
 	{
-		Fn F = std::make_shared<node::Function>(N);
+		Fn F = node::MakeNode<node::Function>(N);
 		functions_.push_back(F);
-		is_differentiated_ = false;
+		is_differentiated_ = false; // the rows of the functions there were are kept, see Differentiate
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -545,7 +1762,35 @@ namespace bertini
 	void System::AddFunctions(std::vector<Fn> const& v)
 	{
 		functions_.insert( functions_.end(), v.begin(), v.end() );
+		is_differentiated_ = false; // the rows of the functions there were are kept, see Differentiate
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
+	}
+
+
+
+
+
+
+	void System::ReplaceFunction(size_t index, Fn const& F)
+	{
+		if (index >= NumFunctions())
+			throw std::out_of_range("replacing function " + std::to_string(index) + " of a system with " + std::to_string(NumFunctions()) + " functions");
+
+		functions_[index] = F;
+		if (index < jacobian_.size())
+			jacobian_[index].reset();
 		is_differentiated_ = false;
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -556,14 +1801,26 @@ namespace bertini
 	void System::AddConstant(Fn const& F)
 	{
 		constant_subfunctions_.push_back(F);
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
 	void System::AddConstants(std::vector<Fn> const& v)
 	{
 		constant_subfunctions_.insert( constant_subfunctions_.end(), v.begin(), v.end() );
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -574,7 +1831,13 @@ namespace bertini
 	void System::AddPathVariable(Var const& v)
 	{
 		path_variable_ = v;
-		is_differentiated_ = false;
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 		have_path_variable_ = true;
 	}
 
@@ -693,6 +1956,14 @@ namespace bertini
 
 		variable_ordering_ = other.variable_ordering_; 
 		have_ordering_ = other.have_ordering_;
+
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -732,6 +2003,7 @@ namespace bertini
 		patch_ = Patch(VariableGroupSizesFIFO());
 
 		is_patched_ = true;
+		ForgetEvaluations();
 	}
 
 
@@ -743,6 +2015,7 @@ namespace bertini
 
 		this->patch_ = other.patch_;
 		is_patched_ = true;
+		ForgetEvaluations();
 	}
 
 
@@ -797,6 +2070,7 @@ namespace bertini
 
 	std::vector<int> System::Degrees() const
 	{
+		node::StructureMemo memo;
 		std::vector<int> degs;
 		for (const auto& iter : functions_)
 			degs.push_back(iter->Degree());
@@ -806,6 +2080,7 @@ namespace bertini
 
 	std::vector<int> System::Degrees(VariableGroup const& vars) const
 	{
+		node::StructureMemo memo;
 		std::vector<int> degs;
 		for (const auto& iter : functions_)
 			degs.push_back(iter->Degree(vars));
@@ -836,6 +2111,14 @@ namespace bertini
 		}
 
 		swap(functions_, re_ordered_functions);
+
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -863,6 +2146,14 @@ namespace bertini
 		}
 
 		swap(functions_, re_ordered_functions);
+
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -890,6 +2181,14 @@ namespace bertini
 
 		path_variable_.reset();
 		have_path_variable_ = false;
+
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
 	}
 
 
@@ -1029,6 +2328,14 @@ namespace bertini
 		for (auto iter=functions_.begin(); iter!=functions_.end(); iter++)
 			(*iter)->SetRoot( (*(rhs.functions_.begin()+(iter-functions_.begin())))->entry_node() + (*iter)->entry_node());
 
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
+
 		return *this;
 	}
 
@@ -1044,6 +2351,15 @@ namespace bertini
 		{
 			(*iter)->SetRoot( N * (*iter)->entry_node());
 		}
+
+		ForgetDerivatives();
+		forward_mode_program_.reset();
+		generated_kernels_.reset();
+		homotopy_parts_.reset();
+		ForgetEvaluations();
+		have_polynomial_system_ = false;
+		have_function_dependencies_ = false;
+
 		return *this;
 	}
 
@@ -1061,6 +2377,33 @@ namespace bertini
 
 
 	
+	System StraightLineHomotopy(System const& target, System const& start, System::Nd const& gamma, System::Var const& t)
+	{
+		if (target.NumFunctions()!=start.NumFunctions())
+			throw std::runtime_error("making straight-line homotopy from target system with " + std::to_string(target.NumFunctions()) + " functions, and start system with " + std::to_string(start.NumFunctions()) + ", but they must have the same number");
+
+		if (target.HavePathVariable() || start.HavePathVariable())
+			throw std::runtime_error("making straight-line homotopy, but the target or start system has a path variable already");
+
+		if (target.Variables()!=start.Variables())
+			throw std::runtime_error("making straight-line homotopy from target and start systems with differing variables");
+
+		System homotopy = (1-t)*target + t*gamma*start;
+		homotopy.AddPathVariable(t);
+
+		homotopy.homotopy_parts_ = std::make_shared<detail::StraightLineHomotopyParts>(detail::StraightLineHomotopyParts{target, start, gamma});
+		homotopy.homotopy_parts_->target.precision(homotopy.precision());
+		homotopy.homotopy_parts_->start.precision(homotopy.precision());
+
+		// the parts keep their values at the last point themselves, see detail::StraightLineHomotopyParts
+		homotopy.homotopy_parts_->target.UseEvaluationCache(false);
+		homotopy.homotopy_parts_->start.UseEvaluationCache(false);
+		homotopy.ShareEvaluationTeam();
+
+		return homotopy;
+	}
+
+
 	System Concatenate(System sys1, System const& sys2)
 	{
 		// first we will deal with the variable structure
@@ -0,0 +1,401 @@
+//This file is part of Bertini 2.
+//
+//system_cache.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//system_cache.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with system_cache.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license, 
+// as well as COPYING.  Bertini2 is provided with permitted 
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/system_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <streambuf>
+#include <unordered_map>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+
+namespace bertini {
+
+	namespace {
+
+		const char cache_magic[8] = {'b','2','s','y','s','c','c','h'};
+
+		// bump whenever the layout of the header, or the serialization of System, changes
+		const std::uint32_t cache_format_version = 2;
+
+		struct CacheHeader
+		{
+			char magic[8];
+			std::uint32_t format_version;
+			std::uint32_t pointer_size;
+			std::uint64_t input_hash;
+			std::uint64_t input_length;
+		};
+
+		CacheHeader MakeHeader(std::string const& input)
+		{
+			CacheHeader header;
+			std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+			header.format_version = cache_format_version;
+			header.pointer_size = sizeof(void*);
+			header.input_hash = InputHash(input);
+			header.input_length = input.size();
+			return header;
+		}
+
+		// read-only stream buffer over memory, so the archive reads the mapping in place
+		class MemoryBuffer : public std::streambuf
+		{
+		public:
+			MemoryBuffer(char const* begin, std::size_t size)
+			{
+				char* b = const_cast<char*>(begin);
+				setg(b, b, b + size);
+			}
+		};
+
+		bool SameFormat(CacheHeader const& header, CacheHeader const& expected)
+		{
+			return !std::memcmp(header.magic, expected.magic, sizeof(cache_magic)) && header.format_version == expected.format_version && header.pointer_size == expected.pointer_size;
+		}
+
+		// the header, then the input text itself, compared in full on loading, then the system
+		void WriteSystem(std::ostream & out, System const& sys, std::string const& input)
+		{
+			if (!sys.IsDifferentiated())
+				sys.Differentiate();
+
+			const CacheHeader header = MakeHeader(input);
+			out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+			out.write(input.data(), input.size());
+
+			boost::archive::binary_oarchive oa(out);
+			oa << sys;
+		}
+
+		// the system after the header and the input text, read in place
+		System ReadSystem(char const* data, std::size_t size, std::uint64_t input_length)
+		{
+			const auto offset = sizeof(CacheHeader) + input_length;
+			MemoryBuffer buffer(data + offset, size - offset);
+			std::istream in(&buffer);
+
+			System loaded;
+			boost::archive::binary_iarchive ia(in);
+			ia >> loaded;
+			return loaded;
+		}
+	}
+
+
+	namespace detail {
+
+		struct SharedSystemAccess
+		{
+			static std::vector<System::Nd> FunctionTreeNodes(System const& sys)
+			{
+				return sys.FunctionTreeNodes();
+			}
+
+			static void UseProgram(System & sys, std::shared_ptr<StraightLineProgram> const& program)
+			{
+				sys.UseForwardModeDifferentiation();
+				sys.forward_mode_program_ = program;
+			}
+		};
+
+	} // namespace detail
+
+
+	namespace {
+
+		const char shared_magic[8] = {'b','2','s','y','s','s','h','r'};
+
+		// bump whenever the layout of the header, the serialization of System, or the image of a StraightLineProgram, changes
+		const std::uint32_t shared_format_version = 1;
+
+		struct SharedHeader
+		{
+			char magic[8];
+			std::uint32_t format_version;
+			std::uint32_t pointer_size;
+			std::uint64_t archive_offset;
+			std::uint64_t archive_size;
+			std::uint64_t program_offset;
+			std::uint64_t program_size;
+		};
+
+		void PadTo8(std::ostream & out, std::uint64_t & offset)
+		{
+			static const char zeros[8] = {};
+			const auto padding = (8 - offset%8)%8;
+			out.write(zeros, padding);
+			offset += padding;
+		}
+
+		// write a file under a unique name next to it, then rename it into place, so that a process reading or mapping the file never sees it part written, a failed write leaves the old one, and processes writing it at once do not clobber each other
+		template<typename WriteFunction>
+		void ReplaceFile(boost::filesystem::path const& file, std::string const& what, WriteFunction write)
+		{
+			auto temp = file;
+			temp += boost::filesystem::unique_path(".%%%%-%%%%-%%%%.tmp");
+			try
+			{
+				{
+					boost::filesystem::ofstream fout(temp, std::ios::binary | std::ios::trunc);
+					if (!fout)
+						throw std::runtime_error("unable to open " + what + " " + temp.string() + " for writing");
+
+					write(fout);
+
+					if (!fout)
+						throw std::runtime_error("failed writing " + what + " " + temp.string());
+				}
+				boost::filesystem::rename(temp, file);
+			}
+			catch (...)
+			{
+				boost::system::error_code ec;
+				boost::filesystem::remove(temp, ec);
+				throw;
+			}
+		}
+	}
+
+
+	std::uint64_t InputHash(std::string const& input)
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		for (unsigned char c : input)
+		{
+			hash ^= c;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+
+	void SaveCachedSystem(System const& sys, std::string const& input, boost::filesystem::path const& cache_file)
+	{
+		ReplaceFile(cache_file, "system cache file", [&](std::ostream & out)
+			{
+				WriteSystem(out, sys, input);
+			});
+	}
+
+
+	bool LoadCachedSystem(System & sys, std::string const& input, boost::filesystem::path const& cache_file)
+	{
+		boost::system::error_code ec;
+		const auto file_size = boost::filesystem::file_size(cache_file, ec);
+		if (ec || file_size <= sizeof(CacheHeader))
+			return false;
+
+		try
+		{
+			using namespace boost::interprocess;
+			file_mapping mapping(cache_file.string().c_str(), read_only);
+			mapped_region region(mapping, read_only);
+			char const* data = static_cast<char const*>(region.get_address());
+
+			CacheHeader header;
+			std::memcpy(&header, data, sizeof(header));
+			const CacheHeader expected = MakeHeader(input);
+			if (!SameFormat(header, expected) || header.input_hash != expected.input_hash || header.input_length != expected.input_length)
+				return false;
+
+			// the hash only screens.  a hit is the same text
+			if (region.get_size() <= sizeof(header) + input.size() || std::memcmp(data + sizeof(header), input.data(), input.size()))
+				return false;
+
+			System loaded = ReadSystem(data, region.get_size(), header.input_length);
+			swap(sys, loaded);
+			return true;
+		}
+		catch (std::exception const&)
+		{
+			return false;
+		}
+	}
+
+
+	std::string SystemToBytes(System const& sys)
+	{
+		std::ostringstream out(std::ios::binary);
+		WriteSystem(out, sys, std::string());
+		return out.str();
+	}
+
+
+	void SystemFromBytes(System & sys, char const* data, std::size_t size)
+	{
+		CacheHeader header;
+		if (size <= sizeof(header))
+			throw std::runtime_error("reading a system from " + std::to_string(size) + " bytes, too few to be one");
+
+		std::memcpy(&header, data, sizeof(header));
+		if (!SameFormat(header, MakeHeader(std::string())))
+			throw std::runtime_error("reading a system from bytes not written by this version of the system format, or by another kind of build");
+		if (header.input_length >= size - sizeof(header))
+			throw std::runtime_error("reading a system from " + std::to_string(size) + " bytes, cut short");
+
+		System loaded;
+		try
+		{
+			loaded = ReadSystem(data, size, header.input_length);
+		}
+		catch (std::exception const& e)
+		{
+			throw std::runtime_error(std::string("reading a system from bytes: ") + e.what());
+		}
+		swap(sys, loaded);
+	}
+
+
+
+	void SaveSharedSystem(System const& sys, boost::filesystem::path const& file)
+	{
+		if (sys.SharesTrees())
+			throw std::runtime_error("trying to share a system made by CloneForThread, which has no trees of its own to write");
+
+		auto const& program = sys.GetForwardModeProgram();
+
+		std::ostringstream archive(std::ios::binary);
+		{
+			boost::archive::binary_oarchive oa(archive);
+			oa << sys;
+		}
+		const auto archive_bytes = archive.str();
+
+		// the constants of the program are numbered by their place among the nodes of the trees, the inputs by theirs among the variables and parameters
+		std::unordered_map<const node::Node*, std::uint64_t> node_numbers;
+		const auto nodes = detail::SharedSystemAccess::FunctionTreeNodes(sys);
+		for (std::size_t ii = 0; ii < nodes.size(); ++ii)
+			node_numbers[nodes[ii].get()] = ii;
+
+		const auto inputs = sys.GeneratedKernelInputs();
+		auto input_id = [&](System::Var const& v) -> std::uint64_t
+		{
+			auto found = std::find(inputs.begin(), inputs.end(), v);
+			if (found==inputs.end())
+				throw std::runtime_error("trying to share a system whose program reads variable " + v->name() + ", which is neither a variable, the path variable, nor an implicit parameter");
+			return found - inputs.begin();
+		};
+		auto constant_id = [&](System::Nd const& n) -> std::uint64_t
+		{
+			auto found = node_numbers.find(n.get());
+			if (found==node_numbers.end())
+				throw std::runtime_error("trying to share a system whose program reads a number not in its function trees");
+			return found->second;
+		};
+
+		std::ostringstream image(std::ios::binary);
+		program.WriteImage(image, input_id, constant_id);
+		const auto image_bytes = image.str();
+
+		SharedHeader header;
+		std::memcpy(header.magic, shared_magic, sizeof(shared_magic));
+		header.format_version = shared_format_version;
+		header.pointer_size = sizeof(void*);
+		header.archive_offset = sizeof(SharedHeader);
+		header.archive_size = archive_bytes.size();
+		header.program_offset = (header.archive_offset + header.archive_size + 7)/8*8;
+		header.program_size = image_bytes.size();
+
+		// workers may have the old file mapped, and would fault on its pages if it were truncated under them
+		ReplaceFile(file, "shared system file", [&](std::ostream & out)
+			{
+				std::uint64_t offset = sizeof(header);
+				out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+				out.write(archive_bytes.data(), archive_bytes.size());
+				offset += archive_bytes.size();
+				PadTo8(out, offset);
+				out.write(image_bytes.data(), image_bytes.size());
+			});
+	}
+
+
+	void MapSharedSystem(System & sys, boost::filesystem::path const& file)
+	{
+		using namespace boost::interprocess;
+
+		std::shared_ptr<mapped_region> region;
+		try
+		{
+			file_mapping mapping(file.string().c_str(), read_only);
+			region = std::make_shared<mapped_region>(mapping, read_only);
+		}
+		catch (interprocess_exception const& e)
+		{
+			throw std::runtime_error("unable to map shared system file " + file.string() + ": " + e.what());
+		}
+
+		char const* data = static_cast<char const*>(region->get_address());
+		const std::uint64_t size = region->get_size();
+
+		SharedHeader header;
+		if (size < sizeof(header))
+			throw std::runtime_error("shared system file " + file.string() + " is too short to be one");
+		std::memcpy(&header, data, sizeof(header));
+		if (std::memcmp(header.magic, shared_magic, sizeof(shared_magic)) || header.format_version!=shared_format_version || header.pointer_size!=sizeof(void*))
+			throw std::runtime_error("shared system file " + file.string() + " was not written by this version of the format, or by another kind of build");
+		if (header.archive_offset > size || header.archive_size > size - header.archive_offset || header.program_offset > size || header.program_size > size - header.program_offset || header.program_offset%8!=0)
+			throw std::runtime_error("shared system file " + file.string() + " is cut short");
+
+		System loaded;
+		try
+		{
+			MemoryBuffer buffer(data + header.archive_offset, header.archive_size);
+			std::istream in(&buffer);
+			boost::archive::binary_iarchive ia(in);
+			ia >> loaded;
+		}
+		catch (std::exception const& e)
+		{
+			throw std::runtime_error("reading shared system file " + file.string() + ": " + e.what());
+		}
+
+		const auto nodes = detail::SharedSystemAccess::FunctionTreeNodes(loaded);
+		const auto inputs = loaded.GeneratedKernelInputs();
+		auto input = [&](std::uint64_t id) -> System::Var
+		{
+			if (id >= inputs.size())
+				throw std::runtime_error("shared system file " + file.string() + " refers to input " + std::to_string(id) + " of " + std::to_string(inputs.size()));
+			return inputs[id];
+		};
+		auto constant = [&](std::uint64_t id) -> System::Nd
+		{
+			if (id >= nodes.size())
+				throw std::runtime_error("shared system file " + file.string() + " refers to node " + std::to_string(id) + " of " + std::to_string(nodes.size()));
+			return nodes[id];
+		};
+
+		auto program = StraightLineProgram::FromImage(data + header.program_offset, header.program_size, region, input, constant);
+		program->precision(loaded.precision());
+		detail::SharedSystemAccess::UseProgram(loaded, program);
+
+		swap(sys, loaded);
+	}
+
+} // namespace bertini
@@ -0,0 +1,140 @@
+//This file is part of Bertini 2.
+//
+//allocation_counting.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//allocation_counting.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with allocation_counting.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file allocation_counting.cpp
+
+\brief Counting allocations per thread, for the phase timers of the instrumentation.
+
+The only translation unit of libbertini2_allocation_counting, built with --enable-allocation-counting.  Linking it into a program replaces the global operator new and delete, and sets the GMP memory functions when the library is loaded, so that every allocation of the program, of the standard library, Eigen, and the limbs of MPFR alike, adds to the counts of its thread, see instrument::ThreadAllocations.  All go to malloc and free, as the defaults do, so memory allocated before the library is loaded is freed correctly.  The limb pool, installed later, keeps the GMP functions set here as the ones behind it, so the blocks it cannot serve from its free lists are counted, too.
+*/
+
+#include "bertini2/tracking/instrumentation.hpp"
+
+#include <gmp.h>
+
+#include <cstdlib>
+#include <new>
+
+
+namespace {
+
+	using bertini::tracking::instrument::ThreadAllocations;
+
+	void Count(std::size_t size)
+	{
+		auto& counts = ThreadAllocations();
+		++counts.allocations;
+		counts.bytes += size;
+	}
+
+	void* CountedMalloc(std::size_t size)
+	{
+		Count(size);
+		if (void* p = std::malloc(size ? size : 1))
+			return p;
+		throw std::bad_alloc();
+	}
+
+
+	void* GMPAllocate(std::size_t size)
+	{
+		Count(size);
+		return std::malloc(size);
+	}
+
+	void* GMPReallocate(void* p, std::size_t, std::size_t new_size)
+	{
+		Count(new_size);
+		return std::realloc(p, new_size);
+	}
+
+	void GMPFree(void* p, std::size_t)
+	{
+		std::free(p);
+	}
+
+
+	// sets the GMP memory functions when the library is loaded, before main
+	struct InstallGMPMemoryFunctions
+	{
+		InstallGMPMemoryFunctions()
+		{
+			mp_set_memory_functions(&GMPAllocate, &GMPReallocate, &GMPFree);
+		}
+	} install_gmp_memory_functions;
+}
+
+
+void* operator new(std::size_t size)
+{
+	return CountedMalloc(size);
+}
+
+void* operator new[](std::size_t size)
+{
+	return CountedMalloc(size);
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+	Count(size);
+	return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+	Count(size);
+	return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::nothrow_t const&) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void* p, std::nothrow_t const&) noexcept
+{
+	std::free(p);
+}
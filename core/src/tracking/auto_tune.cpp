@@ -0,0 +1,106 @@
+//This file is part of Bertini 2.
+//
+//auto_tune.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//auto_tune.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with auto_tune.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/auto_tune.hpp"
+#include "bertini2/system_cache.hpp"
+
+#include <boost/filesystem/fstream.hpp>
+
+
+namespace bertini {
+	namespace tracking {
+
+		namespace {
+
+			const std::string tuning_magic = "b2tuning 1";
+
+			// the candidates are part of the key, as a choice among others is no choice among these
+			std::uint64_t TuningKey(std::string const& input, std::vector<std::string> const& candidate_names)
+			{
+				std::string key = input;
+				for (auto const& name : candidate_names)
+					key += '\n' + name;
+				return InputHash(key);
+			}
+		}
+
+
+		std::size_t ChooseCandidate(std::vector<TuningMeasurement> const& measurements, double failure_tolerance)
+		{
+			double least_failure = 1;
+			for (auto const& m : measurements)
+				least_failure = std::min(least_failure, m.FailureRate());
+
+			std::size_t chosen = 0;
+			double fastest = std::numeric_limits<double>::infinity();
+			bool found = false;
+			for (std::size_t ii = 0; ii < measurements.size(); ++ii)
+			{
+				auto const& m = measurements[ii];
+				if (m.FailureRate() > least_failure + failure_tolerance)
+					continue;
+				if (!found || m.SecondsPerAnsweredPath() < fastest)
+				{
+					chosen = ii;
+					fastest = m.SecondsPerAnsweredPath();
+					found = true;
+				}
+			}
+			return chosen;
+		}
+
+
+		void SaveTuning(std::string const& input, std::vector<std::string> const& candidate_names, std::string const& chosen, boost::filesystem::path const& cache_file)
+		{
+			boost::filesystem::ofstream fout(cache_file, std::ios::trunc);
+			if (!fout)
+				throw std::runtime_error("unable to open tuning cache file " + cache_file.string() + " for writing");
+
+			fout << tuning_magic << '\n' << TuningKey(input, candidate_names) << '\n' << chosen << '\n';
+			if (!fout)
+				throw std::runtime_error("unable to write tuning cache file " + cache_file.string());
+		}
+
+
+		std::string LoadTuning(std::string const& input, std::vector<std::string> const& candidate_names, boost::filesystem::path const& cache_file)
+		{
+			boost::filesystem::ifstream fin(cache_file);
+			if (!fin)
+				return std::string();
+
+			std::string magic, key, chosen;
+			if (!std::getline(fin, magic) || !std::getline(fin, key) || !std::getline(fin, chosen))
+				return std::string();
+
+			if (magic!=tuning_magic || key!=std::to_string(TuningKey(input, candidate_names)))
+				return std::string();
+
+			if (std::find(candidate_names.begin(), candidate_names.end(), chosen)==candidate_names.end())
+				return std::string();
+
+			return chosen;
+		}
+
+	} // namespace tracking
+} // namespace bertini
@@ -0,0 +1,575 @@
+//This file is part of Bertini 2.
+//
+//batch_tracker.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//batch_tracker.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with batch_tracker.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/batch_tracker.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace bertini {
+	namespace tracking {
+
+		namespace {
+
+			constexpr std::size_t W = BatchLanes::Width;
+
+			template<typename T>
+			using Lanes = std::array<T, W>;
+
+
+			/**
+			LU factorization with partial pivoting of the n by n matrices of all the lanes at once, in place, row-major with the lanes of each entry contiguous.  The pivot rows are chosen, and the rows swapped, lane by lane; the elimination runs across the lanes.  A lane with a zero pivot is marked singular, and its factors are garbage.
+			*/
+			template<typename S>
+			void FactorBatch(std::size_t n, S * ar, S * ai, std::vector<std::size_t> & pivots, Lanes<bool> & singular)
+			{
+				pivots.resize(n*W);
+				singular.fill(false);
+
+				auto at = [n](std::size_t row, std::size_t col){ return (row*n + col)*W; };
+
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					for (std::size_t l = 0; l < W; ++l)
+					{
+						std::size_t pivot = k;
+						S largest = 0;
+						for (std::size_t i = k; i < n; ++i)
+						{
+							const S size = std::abs(ar[at(i,k)+l]) + std::abs(ai[at(i,k)+l]);
+							if (size > largest)
+							{
+								largest = size;
+								pivot = i;
+							}
+						}
+						if (largest==0)
+							singular[l] = true;
+
+						pivots[k*W+l] = pivot;
+						if (pivot!=k)
+							for (std::size_t j = 0; j < n; ++j)
+							{
+								std::swap(ar[at(k,j)+l], ar[at(pivot,j)+l]);
+								std::swap(ai[at(k,j)+l], ai[at(pivot,j)+l]);
+							}
+					}
+
+					S inv_r[W], inv_i[W];
+					for (std::size_t l = 0; l < W; ++l)
+					{
+						const S pr = ar[at(k,k)+l], pi = ai[at(k,k)+l];
+						const S d = pr*pr + pi*pi;
+						inv_r[l] = pr/d; inv_i[l] = -pi/d;
+					}
+
+					for (std::size_t i = k+1; i < n; ++i)
+					{
+						S * const mr = ar + at(i,k);
+						S * const mi = ai + at(i,k);
+						for (std::size_t l = 0; l < W; ++l)
+						{
+							const S t = mr[l]*inv_r[l] - mi[l]*inv_i[l];
+							mi[l] = mr[l]*inv_i[l] + mi[l]*inv_r[l];
+							mr[l] = t;
+						}
+
+						for (std::size_t j = k+1; j < n; ++j)
+						{
+							S * const zr = ar + at(i,j);
+							S * const zi = ai + at(i,j);
+							const S * const ur = ar + at(k,j);
+							const S * const ui = ai + at(k,j);
+							for (std::size_t l = 0; l < W; ++l)
+							{
+								zr[l] -= mr[l]*ur[l] - mi[l]*ui[l];
+								zi[l] -= mr[l]*ui[l] + mi[l]*ur[l];
+							}
+						}
+					}
+				}
+			}
+
+
+			/**
+			Solve with the factors from FactorBatch, in place, the right hand sides having n entries with the lanes contiguous.
+			*/
+			template<typename S>
+			void SolveBatch(std::size_t n, const S * ar, const S * ai, std::vector<std::size_t> const& pivots, S * br, S * bi)
+			{
+				auto at = [n](std::size_t row, std::size_t col){ return (row*n + col)*W; };
+
+				for (std::size_t k = 0; k < n; ++k)
+					for (std::size_t l = 0; l < W; ++l)
+					{
+						const auto p = pivots[k*W+l];
+						if (p!=k)
+						{
+							std::swap(br[k*W+l], br[p*W+l]);
+							std::swap(bi[k*W+l], bi[p*W+l]);
+						}
+					}
+
+				for (std::size_t i = 1; i < n; ++i)
+					for (std::size_t k = 0; k < i; ++k)
+						for (std::size_t l = 0; l < W; ++l)
+						{
+							const S mr = ar[at(i,k)+l], mi = ai[at(i,k)+l];
+							br[i*W+l] -= mr*br[k*W+l] - mi*bi[k*W+l];
+							bi[i*W+l] -= mr*bi[k*W+l] + mi*br[k*W+l];
+						}
+
+				for (std::size_t i = n; i-- > 0; )
+				{
+					for (std::size_t k = i+1; k < n; ++k)
+						for (std::size_t l = 0; l < W; ++l)
+						{
+							const S ur = ar[at(i,k)+l], ui = ai[at(i,k)+l];
+							br[i*W+l] -= ur*br[k*W+l] - ui*bi[k*W+l];
+							bi[i*W+l] -= ur*bi[k*W+l] + ui*br[k*W+l];
+						}
+					for (std::size_t l = 0; l < W; ++l)
+					{
+						const S ur = ar[at(i,i)+l], ui = ai[at(i,i)+l];
+						const S d = ur*ur + ui*ui;
+						const S zr = (br[i*W+l]*ur + bi[i*W+l]*ui)/d;
+						bi[i*W+l] = (bi[i*W+l]*ur - br[i*W+l]*ui)/d;
+						br[i*W+l] = zr;
+					}
+				}
+			}
+
+
+			// the 2-norms of the first num_entries entries of each lane
+			template<typename S>
+			Lanes<double> Norms(BasicBatchLanes<S> const& v, std::size_t num_entries)
+			{
+				Lanes<double> squares;
+				squares.fill(0);
+				for (std::size_t i = 0; i < num_entries; ++i)
+					for (std::size_t l = 0; l < W; ++l)
+						squares[l] += double(v.real[i*W+l])*v.real[i*W+l] + double(v.imag[i*W+l])*v.imag[i*W+l];
+				for (auto& s : squares)
+					s = std::sqrt(s);
+				return squares;
+			}
+
+
+			/**
+			The parts of the batch the predictor and corrector share: the evaluation, the factorization, and the estimate of the norm of the inverse of the Jacobian against a fixed vector of random units, as for NormInverseEstimate::RandomSolve.  In double precision, or in single for the lanes being screened, the point being rounded to it for the evaluation.
+			*/
+			template<typename S>
+			struct Workspace
+			{
+				BasicBatchLanes<S> point, parameters, values, jacobian, time_derivatives, step, norm_estimate;
+				bool have_parameters = false;
+				std::vector<std::size_t> pivots;
+				Lanes<bool> singular;
+				Lanes<double> norm_J, norm_J_inverse;
+
+				void SetParameters(BatchLanes const& implicit_parameters)
+				{
+					parameters.real.assign(implicit_parameters.real.begin(), implicit_parameters.real.end());
+					parameters.imag.assign(implicit_parameters.imag.begin(), implicit_parameters.imag.end());
+					have_parameters = true;
+				}
+
+				void EvaluateAndFactor(System const& sys, BatchLanes const& at, Vec<dbl> const& random_units)
+				{
+					point.real.assign(at.real.begin(), at.real.end());
+					point.imag.assign(at.imag.begin(), at.imag.end());
+					if (have_parameters)
+						sys.EvalBatchWithDerivatives(point, parameters, values, jacobian, time_derivatives);
+					else
+						sys.EvalBatchWithDerivatives(point, values, jacobian, time_derivatives);
+
+					const std::size_t n = random_units.size();
+					norm_J = Norms(jacobian, n*n); // the Frobenius norm, as Eigen's norm() for a matrix
+					FactorBatch(n, jacobian.real.data(), jacobian.imag.data(), pivots, singular);
+
+					norm_estimate.Resize(n);
+					for (std::size_t i = 0; i < n; ++i)
+						for (std::size_t l = 0; l < W; ++l)
+							norm_estimate.Set(i, l, random_units(i));
+					SolveBatch(n, jacobian.real.data(), jacobian.imag.data(), pivots, norm_estimate.real.data(), norm_estimate.imag.data());
+					norm_J_inverse = Norms(norm_estimate, n);
+				}
+
+				void Solve(std::size_t n, BasicBatchLanes<S> & rhs) const
+				{
+					SolveBatch(n, jacobian.real.data(), jacobian.imag.data(), pivots, rhs.real.data(), rhs.imag.data());
+				}
+			};
+
+		} // re: namespace
+
+
+
+		BatchTracker::BatchTracker(System const& sys) : tracked_system_(sys), num_variables_(sys.NumVariables())
+		{
+			if (!sys.HavePathVariable())
+				throw std::runtime_error("batch tracking needs a system with a path variable");
+			if (sys.NumTotalFunctions()!=sys.NumVariables())
+				throw std::runtime_error("batch tracking needs a square system, but the system has " + std::to_string(sys.NumTotalFunctions()) + " functions and patches, and " + std::to_string(sys.NumVariables()) + " variables");
+
+			random_units_ = RandomOfUnits<dbl>(num_variables_);
+		}
+
+
+
+		void BatchTracker::Setup(double tracking_tolerance, double path_truncation_threshold,
+		                         config::Stepping<double> const& stepping,
+		                         config::Newton const& newton)
+		{
+			tracking_tolerance_ = tracking_tolerance;
+			path_truncation_threshold_ = path_truncation_threshold;
+			stepping_ = stepping;
+			newton_ = newton;
+		}
+
+
+
+		void BatchTracker::PrecisionSetup(config::AdaptiveMultiplePrecisionConfig const& AMP_config)
+		{
+			epsilon_ = double(AMP_config.epsilon);
+			Phi_ = double(AMP_config.Phi);
+			Psi_ = double(AMP_config.Psi);
+			safety_digits_1_ = AMP_config.safety_digits_1;
+			safety_digits_2_ = AMP_config.safety_digits_2;
+		}
+
+
+
+		std::vector< PathResult<dbl> > BatchTracker::TrackPathsDouble(std::vector< Vec<dbl> > const& start_points,
+		                                                             dbl const& start_time, dbl const& end_time,
+		                                                             std::vector< Vec<dbl> > const& implicit_parameters) const
+		{
+			for (auto const& p : start_points)
+				if (std::size_t(p.size())!=num_variables_)
+					throw std::runtime_error("start point size must match the number of variables in the system to be tracked");
+			if (!implicit_parameters.empty())
+			{
+				if (implicit_parameters.size()!=start_points.size())
+					throw std::runtime_error("batch tracking with implicit parameters for each path, but there are " + std::to_string(implicit_parameters.size()) + " sets of them for " + std::to_string(start_points.size()) + " start points");
+				for (auto const& p : implicit_parameters)
+					if (std::size_t(p.size())!=tracked_system_.NumImplicitParameters())
+						throw std::runtime_error("implicit parameter values must match the number of implicit parameters in the system to be tracked");
+			}
+
+			std::vector< PathResult<dbl> > results(start_points.size());
+			for (std::size_t first = 0; first < start_points.size(); first += Width)
+				TrackBatch(start_points, first, start_time, end_time, implicit_parameters, results);
+			return results;
+		}
+
+
+
+		void BatchTracker::TrackBatch(std::vector< Vec<dbl> > const& start_points, std::size_t first,
+		                              dbl const& start_time, dbl const& end_time,
+		                              std::vector< Vec<dbl> > const& implicit_parameters,
+		                              std::vector< PathResult<dbl> > & results) const
+		{
+			const std::size_t n = num_variables_;
+			const std::size_t num_lanes = std::min(W, start_points.size() - first);
+			const double log_tolerance = std::log10(tracking_tolerance_);
+
+			// the AMP criteria of amp_criteria.hpp, in double precision, for a number of digits, of double or of single precision
+			auto criterion_A = [&](double digits, double norm_J, double norm_J_inverse)
+			{
+				return digits > safety_digits_1_ + std::log10(norm_J_inverse*epsilon_*(norm_J + Phi_));
+			};
+			auto criterion_B = [&](double digits, double norm_J, double norm_J_inverse, unsigned iterations_remaining, double norm_step)
+			{
+				const double D = std::log10(norm_J_inverse*((2+epsilon_)*norm_J + epsilon_*Phi_) + 1);
+				return digits > safety_digits_1_ + D + (-log_tolerance + std::log10(norm_step))/iterations_remaining;
+			};
+			auto criterion_C = [&](double digits, double norm_J_inverse, double norm_z)
+			{
+				return digits > safety_digits_2_ - log_tolerance + std::log10(norm_J_inverse*Psi_ + norm_z);
+			};
+
+			// the accepted points and times, the variables followed by the path variable.  the unused lanes of a partial batch repeat its first path, and are never active.
+			BatchLanes current(n+1), trial(n+1);
+			for (std::size_t l = 0; l < W; ++l)
+			{
+				const auto& start = start_points[first + (l < num_lanes ? l : 0)];
+				for (std::size_t i = 0; i < n; ++i)
+					current.Set(i, l, start(i));
+				current.Set(n, l, start_time);
+			}
+
+			Workspace<double> work;
+			Workspace<float> single_work;
+
+			// the implicit parameters of each lane's member of the family, if they vary by path, fixed for its whole length
+			if (!implicit_parameters.empty())
+			{
+				BatchLanes lane_parameters(tracked_system_.NumImplicitParameters());
+				for (std::size_t l = 0; l < W; ++l)
+				{
+					const auto& p = implicit_parameters[first + (l < num_lanes ? l : 0)];
+					for (int i = 0; i < p.size(); ++i)
+						lane_parameters.Set(i, l, p(i));
+				}
+				work.SetParameters(lane_parameters);
+				single_work.SetParameters(lane_parameters);
+			}
+
+			Lanes<bool> active, single;
+			Lanes<double> step_size;
+			Lanes<unsigned> num_steps, consecutive_successes;
+			Lanes<dbl> delta_t;
+			Lanes<bool> final_step;
+			for (std::size_t l = 0; l < W; ++l)
+			{
+				active[l] = l < num_lanes;
+				single[l] = active[l] && screen_in_single_;
+				step_size[l] = stepping_.initial_step_size;
+				num_steps[l] = 0;
+				consecutive_successes[l] = 0;
+			}
+
+			auto finish = [&](std::size_t l, SuccessCode code)
+			{
+				auto& result = results[first+l];
+				result.index = first+l;
+				result.success_code = code;
+				result.time = current.Get(n, l);
+				result.endpoint.resize(n);
+				for (std::size_t i = 0; i < n; ++i)
+					result.endpoint(i) = current.Get(i, l);
+				active[l] = false;
+			};
+
+			// whether any of the lanes which are set in among are in single precision, and whether any are in double
+			auto tiers_in = [&](Lanes<bool> const& among, bool & any_single, bool & any_double)
+			{
+				any_single = any_double = false;
+				for (std::size_t l = 0; l < W; ++l)
+					if (among[l])
+						(single[l] ? any_single : any_double) = true;
+			};
+
+			// the step of each lane, from the workspace of its tier
+			auto step_of = [&](std::size_t i, std::size_t l)
+			{
+				return single[l] ? single_work.step.Get(i, l) : work.step.Get(i, l);
+			};
+
+			auto predict = [&](auto & w)
+			{
+				w.EvaluateAndFactor(tracked_system_, current, random_units_);
+				w.step.Resize(n);
+				for (std::size_t i = 0; i < n; ++i)
+					for (std::size_t l = 0; l < W; ++l)
+						w.step.Set(i, l, -w.time_derivatives.Get(i, l)*delta_t[l]);
+				w.Solve(n, w.step);
+			};
+
+			auto newton_step = [&](auto & w)
+			{
+				w.EvaluateAndFactor(tracked_system_, trial, random_units_);
+				w.step = w.values;
+				w.Solve(n, w.step);
+			};
+
+			Lanes<bool> correcting, converged, promoted;
+			bool any_single, any_double;
+
+			// a lane too poorly conditioned for single precision goes on in double, taking its step again
+			auto promote = [&](std::size_t l)
+			{
+				single[l] = false;
+				promoted[l] = true;
+			};
+
+			while (std::find(active.begin(), active.end(), true)!=active.end())
+			{
+				for (std::size_t l = 0; l < W; ++l)
+				{
+					const dbl remaining = end_time - current.Get(n, l);
+					const double distance = std::abs(remaining);
+					final_step[l] = distance <= step_size[l];
+					delta_t[l] = final_step[l] ? remaining : remaining*(step_size[l]/distance);
+
+					// the endpoint is always corrected in double precision
+					if (final_step[l])
+						single[l] = false;
+				}
+				promoted.fill(false);
+
+				// predict, by Euler's method: solve J dx = -dH/dt delta_t, in the precision of each lane's tier
+				tiers_in(active, any_single, any_double);
+				if (any_single)
+					predict(single_work);
+				if (any_double)
+					predict(work);
+				const auto norm_current = Norms(current, n);
+
+				for (std::size_t l = 0; l < W; ++l)
+				{
+					if (!active[l])
+						continue;
+
+					if (single[l])
+					{
+						const double digits = NumTraits<float>::NumDigits();
+						if (single_work.singular[l]
+						    || !criterion_A(digits, single_work.norm_J[l], single_work.norm_J_inverse[l])
+						    || !criterion_C(digits, single_work.norm_J_inverse[l], norm_current[l]))
+							promote(l);
+						continue;
+					}
+
+					const double digits = NumTraits<double>::NumDigits();
+					if (work.singular[l])
+						finish(l, SuccessCode::MatrixSolveFailure);
+					else if (!criterion_A(digits, work.norm_J[l], work.norm_J_inverse[l]) || !criterion_C(digits, work.norm_J_inverse[l], norm_current[l]))
+						finish(l, SuccessCode::HigherPrecisionNecessary);
+				}
+
+				trial = current;
+				for (std::size_t i = 0; i < n; ++i)
+					for (std::size_t l = 0; l < W; ++l)
+						if (active[l] && !promoted[l])
+						{
+							const dbl step = step_of(i, l);
+							trial.real[i*W+l] += step.real();
+							trial.imag[i*W+l] += step.imag();
+						}
+				// landing exactly on the end time, so that reaching it is seen
+				for (std::size_t l = 0; l < W; ++l)
+					trial.Set(n, l, final_step[l] ? end_time : current.Get(n, l) + delta_t[l]);
+
+				// correct, by Newton's method, the lanes which have converged being left as they are
+				for (std::size_t l = 0; l < W; ++l)
+					correcting[l] = active[l] && !promoted[l];
+				converged.fill(false);
+				for (unsigned ii = 0; ii < newton_.max_num_newton_iterations; ++ii)
+				{
+					if (std::find(correcting.begin(), correcting.end(), true)==correcting.end())
+						break;
+
+					tiers_in(correcting, any_single, any_double);
+					if (any_single)
+						newton_step(single_work);
+					if (any_double)
+						newton_step(work);
+
+					Lanes<double> norm_step;
+					norm_step.fill(0);
+					for (std::size_t i = 0; i < n; ++i)
+						for (std::size_t l = 0; l < W; ++l)
+							if (correcting[l])
+							{
+								const dbl step = step_of(i, l);
+								trial.real[i*W+l] -= step.real();
+								trial.imag[i*W+l] -= step.imag();
+								norm_step[l] += std::norm(step);
+							}
+					for (auto& s : norm_step)
+						s = std::sqrt(s);
+
+					const auto norm_trial = Norms(trial, n);
+					for (std::size_t l = 0; l < W; ++l)
+					{
+						if (!correcting[l])
+							continue;
+
+						auto const& w_singular = single[l] ? single_work.singular : work.singular;
+						auto const& w_norm_J = single[l] ? single_work.norm_J : work.norm_J;
+						auto const& w_norm_J_inverse = single[l] ? single_work.norm_J_inverse : work.norm_J_inverse;
+						const double digits = single[l] ? NumTraits<float>::NumDigits() : NumTraits<double>::NumDigits();
+
+						if (w_singular[l])
+						{
+							correcting[l] = false;
+							if (single[l])
+								promote(l);
+							else
+								finish(l, SuccessCode::MatrixSolveFailure);
+						}
+						else if (norm_step[l] < tracking_tolerance_ && ii+1 >= newton_.min_num_newton_iterations)
+						{
+							correcting[l] = false;
+							converged[l] = true;
+						}
+						else if (!criterion_B(digits, w_norm_J[l], w_norm_J_inverse[l], newton_.max_num_newton_iterations - ii, norm_step[l])
+						         || !criterion_C(digits, w_norm_J_inverse[l], norm_trial[l]))
+						{
+							correcting[l] = false;
+							if (single[l])
+								promote(l);
+							else
+								finish(l, SuccessCode::HigherPrecisionNecessary);
+						}
+					}
+				}
+
+				// accept or reject each lane's step, and adjust its step size.  a lane promoted to double precision takes the same step again.
+				const auto norm_trial = Norms(trial, n);
+				for (std::size_t l = 0; l < W; ++l)
+				{
+					if (!active[l] || promoted[l])
+						continue;
+
+					++num_steps[l];
+					if (converged[l])
+					{
+						if (single[l])
+							++num_single_precision_steps_;
+
+						for (std::size_t i = 0; i <= n; ++i)
+							current.Set(i, l, trial.Get(i, l));
+
+						if (++consecutive_successes[l] >= stepping_.consecutive_successful_steps_before_stepsize_increase)
+						{
+							step_size[l] = std::min(step_size[l]*stepping_.step_size_success_factor, stepping_.max_step_size);
+							consecutive_successes[l] = 0;
+						}
+
+						if (norm_trial[l] > path_truncation_threshold_)
+							finish(l, SuccessCode::GoingToInfinity);
+						else if (final_step[l])
+							finish(l, SuccessCode::Success);
+					}
+					else
+					{
+						consecutive_successes[l] = 0;
+						step_size[l] *= stepping_.step_size_fail_factor;
+						if (step_size[l] < stepping_.min_step_size)
+							finish(l, SuccessCode::MinStepSizeReached);
+					}
+
+					if (active[l] && num_steps[l] >= stepping_.max_num_steps)
+						finish(l, SuccessCode::MaxNumStepsTaken);
+				}
+			}
+		}
+
+	} // namespace tracking
+} // namespace bertini
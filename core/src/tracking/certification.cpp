@@ -0,0 +1,227 @@
+//This file is part of Bertini 2.
+//
+//certification.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//certification.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with certification.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/certification.hpp"
+
+#include <numeric>
+
+
+namespace bertini {
+	namespace tracking {
+
+		namespace {
+
+			void CheckSystem(System const& sys)
+			{
+				if (sys.HavePathVariable() || sys.IsPatched() || sys.NumFunctions()!=sys.NumVariables() || !sys.HavePolynomialSystem())
+					throw std::runtime_error("certifying a point, but the system is not a square polynomial system without path variable or patches");
+			}
+
+			// rounded up, so the bounds stay bounds
+			double UpperDouble(double x)
+			{
+				return x;
+			}
+
+			double UpperDouble(mpfr_float const& x)
+			{
+				return mpfr_get_d(x.backend().data(), MPFR_RNDU);
+			}
+
+			/**
+			The multinomial coefficient d!/(a_0! a_1! ... a_n!), where a_0 = d - |a| is the exponent of the homogenizing coordinate.
+			*/
+			template<typename RealType>
+			RealType Multinomial(unsigned d, std::vector<unsigned> const& a)
+			{
+				RealType result(1);
+				unsigned remaining = d;
+				auto binomial = [&](unsigned e)
+				{
+					for (unsigned k = 1; k <= e; ++k)
+					{
+						result *= RealType(remaining - e + k);
+						result /= RealType(k);
+					}
+					remaining -= e;
+				};
+
+				for (auto e : a)
+					binomial(e);
+				return result;
+			}
+
+
+			/**
+			The bounds at a point, in the precision of its type, and for multiple precision, the current default precision, to which the system must have been brought.
+			*/
+			template<typename ComplexType>
+			AlphaCertificate Bounds(System const& sys, Vec<ComplexType> const& x, CertifyConfig const& config, unsigned digits)
+			{
+				using RealType = typename Eigen::NumTraits<ComplexType>::Real;
+				using std::abs;
+				using std::sqrt;
+				using std::pow;
+				using std::max;
+
+				const auto n = x.size();
+				const RealType u = Eigen::NumTraits<ComplexType>::epsilon();
+				auto const& polynomials = sys.GetPolynomialSystem();
+
+				const Vec<ComplexType> f = sys.Eval(x);
+				const Mat<ComplexType> J = sys.Jacobian(x);
+
+				const RealType norm_x1 = sqrt(RealType(1) + x.squaredNorm());
+
+				// the Bombieri-Weyl norm, the scaling by the degrees, and the error of evaluating each function, from the absolute values of its terms
+				RealType weyl_squared(0);
+				unsigned D = 1;
+				Vec<ComplexType> delta(n);
+				Vec<RealType> evaluation_error(n);
+				for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+				{
+					const auto support = polynomials.Support(ii);
+					const auto coefficients = polynomials.template Coefficients<ComplexType>(ii);
+
+					unsigned d = 0;
+					for (auto const& a : support)
+						d = max(d, std::accumulate(a.begin(), a.end(), 0u));
+					D = max(D, d);
+
+					RealType absolute_sum(0);
+					for (size_t kk = 0; kk < support.size(); ++kk)
+					{
+						const RealType magnitude = abs(coefficients[kk]);
+						weyl_squared += magnitude*magnitude / Multinomial<RealType>(d, support[kk]);
+
+						RealType term = magnitude;
+						for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+							if (support[kk][jj])
+								term *= pow(abs(x(jj)), static_cast<int>(support[kk][jj]));
+						absolute_sum += term;
+					}
+
+					evaluation_error(ii) = RealType(2*(d+2))*u*absolute_sum;
+					delta(ii) = ComplexType(d ? sqrt(RealType(d)) * pow(norm_x1, static_cast<int>(d)-1) : RealType(0));
+				}
+
+				// the computed inverse, and how far it is from one, by which the norms through it are enlarged
+				const Mat<ComplexType> M = J.lu().inverse();
+				const RealType rho = (Mat<ComplexType>::Identity(n,n) - M*J).norm();
+				if (!(rho < RealType(config.max_inverse_residual)))
+					return AlphaCertificate();
+				const RealType scale = RealType(1)/(RealType(1)-rho);
+				const RealType M_norm = M.norm();
+
+				const Vec<ComplexType> step = M*f;
+				RealType beta = (step.norm() + M_norm*evaluation_error.norm() + RealType(n)*u*M_norm*f.norm()) * scale;
+
+				Mat<ComplexType> M_delta = M;
+				for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+					M_delta.col(jj) *= delta(jj);
+				const RealType mu = max(RealType(1), sqrt(weyl_squared) * M_delta.norm() * scale);
+				RealType gamma = mu * RealType(D) * sqrt(RealType(D)) / (RealType(2)*norm_x1);
+
+				// the rounding of the sums and products above, generously
+				const RealType inflation = RealType(1) + RealType(8*(n+D+4))*u;
+				beta *= inflation;
+				gamma *= inflation;
+				const RealType alpha = beta*gamma*inflation;
+
+				AlphaCertificate certificate;
+				certificate.alpha = UpperDouble(alpha);
+				certificate.beta = UpperDouble(beta);
+				certificate.gamma = UpperDouble(gamma);
+				certificate.precision = digits;
+				return certificate;
+			}
+
+
+			/**
+			The bounds in multiple precision, with the system and the default precision of the thread at digits while computing them.
+			*/
+			template<typename ComplexType>
+			AlphaCertificate BoundsAtPrecision(System const& sys, Vec<ComplexType> const& x, CertifyConfig const& config, unsigned digits)
+			{
+				const auto default_precision = DefaultPrecision();
+				const auto system_precision = sys.precision();
+
+				DefaultPrecision(digits);
+				sys.precision(digits);
+
+				AlphaCertificate certificate;
+				try
+				{
+					Vec<mpfr> y(x.size());
+					for (Eigen::DenseIndex ii = 0; ii < x.size(); ++ii)
+					{
+						y(ii) = mpfr(x(ii));
+						y(ii).precision(digits);
+					}
+					certificate = Bounds(sys, y, config, digits);
+				}
+				catch (...)
+				{
+					sys.precision(system_precision);
+					DefaultPrecision(default_precision);
+					throw;
+				}
+
+				sys.precision(system_precision);
+				DefaultPrecision(default_precision);
+				return certificate;
+			}
+		}
+
+
+
+		AlphaCertificate Certify(System const& sys, Vec<dbl> const& x, CertifyConfig const& config)
+		{
+			CheckSystem(sys);
+
+			auto certificate = Bounds(sys, x, config, DoublePrecision());
+			if (certificate.Certified() || config.fallback_precision==0)
+				return certificate;
+
+			return BoundsAtPrecision(sys, x, config, config.fallback_precision);
+		}
+
+
+		AlphaCertificate Certify(System const& sys, Vec<mpfr> const& x, CertifyConfig const& config)
+		{
+			CheckSystem(sys);
+
+			Vec<dbl> x_d(x.size());
+			for (Eigen::DenseIndex ii = 0; ii < x.size(); ++ii)
+				x_d(ii) = static_cast<dbl>(x(ii));
+
+			auto certificate = Bounds(sys, x_d, config, DoublePrecision());
+			if (certificate.Certified() || config.fallback_precision==0)
+				return certificate;
+
+			return BoundsAtPrecision(sys, x, config, std::max(config.fallback_precision, Precision(x)));
+		}
+
+	} // namespace tracking
+} // namespace bertini
@@ -0,0 +1,487 @@
+//This file is part of Bertini 2.
+//
+//endpoint_file.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//endpoint_file.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with endpoint_file.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/endpoint_file.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+
+namespace bertini {
+	namespace tracking {
+
+		namespace {
+
+			const char endpoint_magic[8] = {'b','2','e','n','d','p','t','s'};
+
+			// bump whenever the layout of the header or the records changes
+			const std::uint32_t endpoint_format_version = 3;
+
+			struct FileHeader
+			{
+				char magic[8];
+				std::uint32_t format_version;
+				std::uint32_t limb_size;
+			};
+
+			struct RecordHeader
+			{
+				std::uint64_t size; // of the whole record, this header included
+				std::uint64_t index;
+				std::int32_t success_code;
+				std::uint32_t precision;
+				std::uint32_t cycle_number;
+				std::uint32_t num_coordinates;
+				double condition_number;
+				double alpha;
+				double beta;
+				double gamma;
+				std::uint64_t certificate_precision;
+			};
+
+			// follows the record header
+			struct StatisticsRecord
+			{
+				std::uint64_t steps_accepted;
+				std::uint64_t steps_rejected;
+				std::uint64_t newton_iterations;
+				std::uint64_t evaluations;
+				std::uint32_t max_precision;
+				std::uint32_t final_precision;
+				double tracking_seconds;
+				double endgame_seconds;
+				std::int32_t endgame;
+				std::uint32_t endgame_loops;
+				std::uint32_t cycle_number;
+				std::uint32_t padding;
+			};
+
+			StatisticsRecord EncodeStatistics(instrument::PathStatistics const& s)
+			{
+				StatisticsRecord record;
+				record.steps_accepted = s.steps_accepted;
+				record.steps_rejected = s.steps_rejected;
+				record.newton_iterations = s.newton_iterations;
+				record.evaluations = s.evaluations;
+				record.max_precision = s.max_precision;
+				record.final_precision = s.final_precision;
+				record.tracking_seconds = s.tracking_seconds;
+				record.endgame_seconds = s.endgame_seconds;
+				record.endgame = static_cast<std::int32_t>(s.endgame);
+				record.endgame_loops = s.endgame_loops;
+				record.cycle_number = s.cycle_number;
+				record.padding = 0;
+				return record;
+			}
+
+			instrument::PathStatistics DecodeStatistics(StatisticsRecord const& record)
+			{
+				instrument::PathStatistics s;
+				s.steps_accepted = record.steps_accepted;
+				s.steps_rejected = record.steps_rejected;
+				s.newton_iterations = record.newton_iterations;
+				s.evaluations = record.evaluations;
+				s.max_precision = record.max_precision;
+				s.final_precision = record.final_precision;
+				s.tracking_seconds = record.tracking_seconds;
+				s.endgame_seconds = record.endgame_seconds;
+				s.endgame = static_cast<instrument::PathStatistics::EndgameType>(record.endgame);
+				s.endgame_loops = record.endgame_loops;
+				s.cycle_number = record.cycle_number;
+				return s;
+			}
+
+			// followed by the limbs of the mantissa, mpfr_custom_get_size(bits) bytes of them
+			struct RealHeader
+			{
+				std::int32_t kind;
+				std::uint32_t bits;
+				std::int64_t exponent;
+			};
+
+			FileHeader MakeHeader()
+			{
+				FileHeader header;
+				std::memcpy(header.magic, endpoint_magic, sizeof(endpoint_magic));
+				header.format_version = endpoint_format_version;
+				header.limb_size = sizeof(mp_limb_t);
+				return header;
+			}
+
+			bool HeaderMatches(FileHeader const& header)
+			{
+				const FileHeader expected = MakeHeader();
+				return !std::memcmp(header.magic, expected.magic, sizeof(endpoint_magic)) && header.format_version==expected.format_version && header.limb_size==expected.limb_size;
+			}
+
+
+			template<typename T>
+			void AppendBytes(std::string & buffer, T const& t)
+			{
+				buffer.append(reinterpret_cast<char const*>(&t), sizeof(T));
+			}
+
+			void AppendReal(std::string & buffer, mpfr_srcptr x)
+			{
+				RealHeader header;
+				header.kind = mpfr_custom_get_kind(x);
+				header.bits = static_cast<std::uint32_t>(mpfr_get_prec(x));
+				header.exponent = mpfr_regular_p(x) ? mpfr_custom_get_exp(x) : 0;
+				AppendBytes(buffer, header);
+
+				const auto size = mpfr_custom_get_size(header.bits);
+				if (mpfr_regular_p(x))
+					buffer.append(static_cast<char const*>(mpfr_custom_get_significand(x)), size);
+				else
+					buffer.append(size, '\0');
+			}
+
+			void AppendReal(std::string & buffer, mpfr_float const& x)
+			{
+				AppendReal(buffer, x.backend().data());
+			}
+
+			void AppendReal(std::string & buffer, double x)
+			{
+				mp_limb_t limbs[(53 + GMP_NUMB_BITS - 1)/GMP_NUMB_BITS];
+				mpfr_t y;
+				mpfr_custom_init(limbs, 53);
+				mpfr_custom_init_set(y, MPFR_ZERO_KIND, 0, 53, limbs);
+				mpfr_set_d(y, x, MPFR_RNDN);
+				AppendReal(buffer, y);
+			}
+
+			template<typename ComplexType>
+			std::string EncodeRecord(EndpointRecord<ComplexType> const& record)
+			{
+				std::string buffer;
+				RecordHeader header;
+				header.size = 0;
+				header.index = record.index;
+				header.success_code = static_cast<std::int32_t>(record.success_code);
+				header.precision = record.precision;
+				header.cycle_number = record.cycle_number;
+				header.num_coordinates = static_cast<std::uint32_t>(record.endpoint.size());
+				header.condition_number = record.condition_number;
+				header.alpha = record.certificate.alpha;
+				header.beta = record.certificate.beta;
+				header.gamma = record.certificate.gamma;
+				header.certificate_precision = record.certificate.precision;
+				AppendBytes(buffer, header);
+				AppendBytes(buffer, EncodeStatistics(record.statistics));
+
+				AppendReal(buffer, real(record.time));
+				AppendReal(buffer, imag(record.time));
+				for (Eigen::DenseIndex ii = 0; ii < record.endpoint.size(); ++ii)
+				{
+					AppendReal(buffer, real(record.endpoint(ii)));
+					AppendReal(buffer, imag(record.endpoint(ii)));
+				}
+
+				const std::uint64_t size = buffer.size();
+				std::memcpy(&buffer[0], &size, sizeof(size));
+				return buffer;
+			}
+
+
+			void CorruptRecord(std::string const& what)
+			{
+				throw std::runtime_error("corrupt record in endpoint file: " + what);
+			}
+
+			bool IsKind(std::int32_t kind)
+			{
+				for (std::int32_t k : {MPFR_NAN_KIND, MPFR_INF_KIND, MPFR_ZERO_KIND, MPFR_REGULAR_KIND})
+					if (kind==k || kind==-k)
+						return true;
+				return false;
+			}
+
+			/**
+			Point an mpfr_t at the limbs of a stored real, which must end by end.  The limbs are copied out of the mapping, which need not be aligned for them.
+
+			\throws std::runtime_error if the real is not one MPFR could have written, or runs past end.
+			*/
+			char const* ViewReal(char const* p, char const* end, mpfr_ptr view, std::vector<mp_limb_t> & limbs)
+			{
+				RealHeader header;
+				if (static_cast<std::size_t>(end - p) < sizeof(header))
+					CorruptRecord("a real runs past the end of its record");
+				std::memcpy(&header, p, sizeof(header));
+				p += sizeof(header);
+
+				const auto bits = static_cast<mpfr_prec_t>(header.bits);
+				if (bits < MPFR_PREC_MIN || bits > MPFR_PREC_MAX)
+					CorruptRecord("a real has precision of " + std::to_string(header.bits) + " bits");
+				if (!IsKind(header.kind))
+					CorruptRecord("a real has kind " + std::to_string(header.kind));
+
+				const auto size = mpfr_custom_get_size(header.bits);
+				if (static_cast<std::size_t>(end - p) < size)
+					CorruptRecord("the limbs of a real run past the end of its record");
+				limbs.resize(size/sizeof(mp_limb_t));
+				std::memcpy(limbs.data(), p, size);
+
+				// a regular number is normalized, its most significant bit set, and has an exponent in range
+				if (header.kind==MPFR_REGULAR_KIND || header.kind==-MPFR_REGULAR_KIND)
+				{
+					if (header.exponent < mpfr_get_emin() || header.exponent > mpfr_get_emax())
+						CorruptRecord("a real has exponent " + std::to_string(header.exponent));
+					if (!(limbs.back() >> (GMP_NUMB_BITS-1)))
+						CorruptRecord("a real is not normalized");
+				}
+
+				mpfr_custom_init_set(view, header.kind, header.exponent, header.bits, limbs.data());
+				return p + size;
+			}
+
+			char const* ReadReal(char const* p, char const* end, mpfr_float & x, std::vector<mp_limb_t> & limbs)
+			{
+				mpfr_t view;
+				p = ViewReal(p, end, view, limbs);
+				mpfr_set_prec(x.backend().data(), mpfr_get_prec(view));
+				mpfr_set(x.backend().data(), view, MPFR_RNDN);
+				return p;
+			}
+
+			char const* ReadReal(char const* p, char const* end, double & x, std::vector<mp_limb_t> & limbs)
+			{
+				mpfr_t view;
+				p = ViewReal(p, end, view, limbs);
+				x = mpfr_get_d(view, MPFR_RNDN);
+				return p;
+			}
+
+			char const* ReadComplex(char const* p, char const* end, dbl & z, std::vector<mp_limb_t> & limbs)
+			{
+				double re, im;
+				p = ReadReal(p, end, re, limbs);
+				p = ReadReal(p, end, im, limbs);
+				z = dbl(re, im);
+				return p;
+			}
+
+			char const* ReadComplex(char const* p, char const* end, mpfr & z, std::vector<mp_limb_t> & limbs)
+			{
+				mpfr_float re, im;
+				p = ReadReal(p, end, re, limbs);
+				p = ReadReal(p, end, im, limbs);
+				z.precision(re.precision());
+				z.real(re);
+				z.imag(im);
+				return p;
+			}
+
+			/**
+			Decode the record from p to end, checking everything read from it against end, so that a corrupt file is not read past.
+
+			\throws std::runtime_error if the record is corrupt.
+			*/
+			template<typename ComplexType>
+			void DecodeRecord(char const* p, char const* end, EndpointRecord<ComplexType> & record)
+			{
+				if (static_cast<std::size_t>(end - p) < sizeof(RecordHeader) + sizeof(StatisticsRecord))
+					CorruptRecord("the record is shorter than its header");
+
+				RecordHeader header;
+				std::memcpy(&header, p, sizeof(header));
+				p += sizeof(header);
+
+				record.index = header.index;
+				record.success_code = static_cast<SuccessCode>(header.success_code);
+				record.precision = header.precision;
+				record.cycle_number = header.cycle_number;
+				record.condition_number = header.condition_number;
+				record.certificate.alpha = header.alpha;
+				record.certificate.beta = header.beta;
+				record.certificate.gamma = header.gamma;
+				record.certificate.precision = static_cast<unsigned>(header.certificate_precision);
+
+				StatisticsRecord statistics;
+				std::memcpy(&statistics, p, sizeof(statistics));
+				p += sizeof(statistics);
+				record.statistics = DecodeStatistics(statistics);
+
+				std::vector<mp_limb_t> limbs;
+				p = ReadComplex(p, end, record.time, limbs);
+
+				// each coordinate takes two reals, each at least a header and a limb
+				const std::size_t min_coordinate_size = 2*(sizeof(RealHeader) + mpfr_custom_get_size(MPFR_PREC_MIN));
+				if (header.num_coordinates > static_cast<std::size_t>(end - p)/min_coordinate_size)
+					CorruptRecord(std::to_string(header.num_coordinates) + " coordinates cannot fit in the rest of the record");
+
+				record.endpoint.resize(header.num_coordinates);
+				for (Eigen::DenseIndex ii = 0; ii < record.endpoint.size(); ++ii)
+					p = ReadComplex(p, end, record.endpoint(ii), limbs);
+
+				if (p!=end)
+					CorruptRecord("the record has " + std::to_string(end - p) + " bytes past its coordinates");
+			}
+
+
+			/**
+			The offsets of the complete records in a file's contents, stopping at the first which is cut short, and where the last complete one ends.
+			*/
+			std::vector<std::uint64_t> FindRecords(char const* data, std::uint64_t file_size, std::uint64_t & end)
+			{
+				std::vector<std::uint64_t> offsets;
+				std::uint64_t offset = sizeof(FileHeader);
+				while (offset + sizeof(RecordHeader) <= file_size)
+				{
+					std::uint64_t size;
+					std::memcpy(&size, data + offset, sizeof(size));
+					if (size < sizeof(RecordHeader) + sizeof(StatisticsRecord) || size > file_size - offset)
+						break;
+					offsets.push_back(offset);
+					offset += size;
+				}
+				end = offset;
+				return offsets;
+			}
+		}
+
+
+
+		EndpointWriter::EndpointWriter(boost::filesystem::path const& file, bool append) : file_(file)
+		{
+			boost::system::error_code ec;
+			const auto existing_size = boost::filesystem::file_size(file, ec);
+
+			if (append && !ec && existing_size > 0)
+			{
+				// drop a record cut short by a killed run, so that the new ones follow the last complete one
+				const auto keep = EndpointReader(file).CompleteSize();
+				if (keep < existing_size)
+					boost::filesystem::resize_file(file, keep);
+
+				out_.open(file, std::ios::binary | std::ios::app);
+				if (!out_)
+					throw std::runtime_error("unable to open endpoint file " + file.string() + " for appending");
+				return;
+			}
+
+			out_.open(file, std::ios::binary | std::ios::trunc);
+			if (!out_)
+				throw std::runtime_error("unable to open endpoint file " + file.string() + " for writing");
+
+			const FileHeader header = MakeHeader();
+			out_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+			out_.flush();
+			if (!out_)
+				throw std::runtime_error("failed writing endpoint file " + file.string());
+		}
+
+
+		void EndpointWriter::Write(EndpointRecord<dbl> const& record)
+		{
+			Append(EncodeRecord(record));
+		}
+
+		void EndpointWriter::Write(EndpointRecord<mpfr> const& record)
+		{
+			Append(EncodeRecord(record));
+		}
+
+		void EndpointWriter::Append(std::string const& record)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			out_.write(record.data(), record.size());
+			if (!out_)
+				throw std::runtime_error("failed writing endpoint file " + file_.string());
+			++num_written_;
+		}
+
+		void EndpointWriter::Flush()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			out_.flush();
+			if (!out_)
+				throw std::runtime_error("failed writing endpoint file " + file_.string());
+		}
+
+
+
+		bool IsEndpointFile(boost::filesystem::path const& file)
+		{
+			char magic[sizeof(endpoint_magic)];
+			boost::filesystem::ifstream in(file, std::ios::binary);
+			return in.read(magic, sizeof(magic)) && !std::memcmp(magic, endpoint_magic, sizeof(magic));
+		}
+
+
+		EndpointReader::EndpointReader(boost::filesystem::path const& file)
+		{
+			boost::system::error_code ec;
+			const auto file_size = boost::filesystem::file_size(file, ec);
+			if (ec || file_size < sizeof(FileHeader))
+				throw std::runtime_error("endpoint file " + file.string() + " is missing or too short");
+
+			try
+			{
+				using namespace boost::interprocess;
+				mapping_ = file_mapping(file.string().c_str(), read_only);
+				mapped_region region(mapping_, read_only);
+				region_.swap(region);
+			}
+			catch (std::exception const& e)
+			{
+				throw std::runtime_error("unable to map endpoint file " + file.string() + ": " + e.what());
+			}
+
+			char const* data = static_cast<char const*>(region_.get_address());
+
+			FileHeader header;
+			std::memcpy(&header, data, sizeof(header));
+			if (!HeaderMatches(header))
+				throw std::runtime_error(file.string() + " is not an endpoint file of this format, or was written on another kind of machine");
+
+			offsets_ = FindRecords(data, region_.get_size(), complete_size_);
+		}
+
+
+		char const* EndpointReader::Record(std::size_t n) const
+		{
+			if (n >= offsets_.size())
+				throw std::out_of_range("endpoint file has " + std::to_string(offsets_.size()) + " records, so none at position " + std::to_string(n));
+			return static_cast<char const*>(region_.get_address()) + offsets_[n];
+		}
+
+		char const* EndpointReader::RecordEnd(std::size_t n) const
+		{
+			const std::uint64_t end = n+1 < offsets_.size() ? offsets_[n+1] : complete_size_;
+			return static_cast<char const*>(region_.get_address()) + end;
+		}
+
+		void EndpointReader::Read(std::size_t n, EndpointRecord<dbl> & record) const
+		{
+			DecodeRecord(Record(n), RecordEnd(n), record);
+		}
+
+		void EndpointReader::Read(std::size_t n, EndpointRecord<mpfr> & record) const
+		{
+			DecodeRecord(Record(n), RecordEnd(n), record);
+		}
+
+	} // namespace tracking
+} // namespace bertini
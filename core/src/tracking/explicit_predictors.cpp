@@ -295,6 +295,11 @@ const mpq_rational ExplicitRKPredictor::cRKV67Ptr_[] =
 const Eigen::Matrix<mpq_rational,10,1> ExplicitRKPredictor::cRKV67_(cRKV67Ptr_);
 
 
+constexpr unsigned ExplicitRKPredictor::PadeSamples;
+constexpr unsigned ExplicitRKPredictor::HermitePoints;
+constexpr unsigned ExplicitRKPredictor::HermiteMaxStepRatio;
+
+
 
 			
 		} // re: predict
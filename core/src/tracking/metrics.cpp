@@ -0,0 +1,280 @@
+//This file is part of Bertini 2.
+//
+//metrics.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//metrics.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with metrics.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/metrics.hpp"
+
+#include <locale>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+
+namespace bertini {
+	namespace tracking {
+		namespace metrics {
+
+		namespace {
+
+			std::atomic<std::uint64_t> next_registry_id(0);
+
+			const char* const counter_names[NumCounters] = {
+				"paths_started",
+				"paths_ended",
+				"paths_truncated",
+				"successful_steps",
+				"failed_steps",
+				"precision_increases",
+				"precision_decreases",
+				"workers_pinned",
+				"paths_deferred",
+				"paths_retried",
+				"paths_recovered"};
+
+			const char* const endgame_names[NumEndgames] = {
+				"power_series",
+				"cauchy"};
+
+			const char* const phase_names[instrument::NumPhases] = {
+				"system_evaluation",
+				"jacobian_evaluation",
+				"linear_solve",
+				"predict",
+				"correct",
+				"precision_change",
+				"endgame_sampling",
+				"endgame_approximation",
+				"endgame"};
+
+			template<std::size_t N>
+			std::uint64_t Load(std::array<std::atomic<std::uint64_t>, N> const& a, std::size_t ii)
+			{
+				return a[ii].load(std::memory_order_relaxed);
+			}
+
+			std::ostringstream MakeStream()
+			{
+				std::ostringstream out;
+				out.imbue(std::locale::classic());
+				out.precision(17);
+				return out;
+			}
+		}
+
+
+
+		Registry::Registry() : id_(next_registry_id++), created_(Clock::now())
+		{}
+
+		Registry::~Registry()
+		{
+			Shard* shard = shards_.load();
+			while (shard)
+			{
+				Shard* next = shard->next;
+				delete shard;
+				shard = next;
+			}
+		}
+
+
+		Registry& Registry::Global()
+		{
+			static Registry global;
+			return global;
+		}
+
+
+		Registry::Shard& Registry::LocalShard()
+		{
+			// the identities of registries are never reused, so a stale entry for one destroyed is never found
+			static thread_local std::vector< std::pair<std::uint64_t, Shard*> > shards_of_thread;
+			for (auto const& entry : shards_of_thread)
+				if (entry.first==id_)
+					return *entry.second;
+
+			Shard* shard = new Shard;
+			shard->next = shards_.load(std::memory_order_relaxed);
+			while (!shards_.compare_exchange_weak(shard->next, shard, std::memory_order_release, std::memory_order_relaxed))
+			{}
+
+			shards_of_thread.emplace_back(id_, shard);
+			return *shard;
+		}
+
+
+		Snapshot Registry::TakeSnapshot() const
+		{
+			Snapshot s;
+			s.seconds = std::chrono::duration<double>(Clock::now() - created_).count();
+			s.numa_nodes = numa_nodes_.load(std::memory_order_relaxed);
+			s.cpus = cpus_.load(std::memory_order_relaxed);
+
+			for (Shard const* shard = shards_.load(std::memory_order_acquire); shard; shard = shard->next)
+			{
+				for (std::size_t ii = 0; ii < NumCounters; ++ii)
+					s.counters[ii] += Load(shard->counters, ii);
+				for (std::size_t ii = 0; ii < NumPrecisionBuckets; ++ii)
+					s.precision_histogram[ii] += Load(shard->precision_histogram, ii);
+				for (std::size_t ii = 0; ii < NumEndgames; ++ii)
+				{
+					s.endgames[ii][0] += Load(shard->endgames, 2*ii);
+					s.endgames[ii][1] += Load(shard->endgames, 2*ii+1);
+				}
+				for (std::size_t ii = 0; ii < instrument::NumPhases; ++ii)
+				{
+					s.phase_calls[ii] += Load(shard->phase_calls, ii);
+					s.phase_nanoseconds[ii] += Load(shard->phase_nanoseconds, ii);
+				}
+			}
+			return s;
+		}
+
+
+
+		std::string ToJSON(Snapshot const& s)
+		{
+			auto out = MakeStream();
+			out << "{\"seconds\":" << s.seconds
+			    << ",\"numa_nodes\":" << s.numa_nodes
+			    << ",\"cpus\":" << s.cpus
+			    << ",\"paths_per_second\":" << s.PathsPerSecond()
+			    << ",\"step_rejection_rate\":" << s.StepRejectionRate()
+			    << ",\"counters\":{";
+			for (std::size_t ii = 0; ii < NumCounters; ++ii)
+				out << (ii ? "," : "") << '"' << counter_names[ii] << "\":" << s.counters[ii];
+
+			out << "},\"precision_histogram\":[";
+			for (std::size_t ii = 0; ii < NumPrecisionBuckets; ++ii)
+			{
+				out << (ii ? "," : "") << "{\"max_bits\":";
+				if (ii < PrecisionBucketBounds.size())
+					out << PrecisionBucketBounds[ii];
+				else
+					out << "null";
+				out << ",\"steps\":" << s.precision_histogram[ii] << '}';
+			}
+
+			out << "],\"endgames\":{";
+			for (std::size_t ii = 0; ii < NumEndgames; ++ii)
+				out << (ii ? "," : "") << '"' << endgame_names[ii] << "\":{\"success\":" << s.endgames[ii][1] << ",\"failure\":" << s.endgames[ii][0] << '}';
+
+			out << "},\"phases\":{";
+			for (std::size_t ii = 0; ii < instrument::NumPhases; ++ii)
+				out << (ii ? "," : "") << '"' << phase_names[ii] << "\":{\"calls\":" << s.phase_calls[ii] << ",\"seconds\":" << s.phase_nanoseconds[ii]*1e-9 << '}';
+			out << "}}";
+			return out.str();
+		}
+
+
+		std::string ToPrometheus(Snapshot const& s, std::string const& prefix)
+		{
+			auto out = MakeStream();
+
+			for (std::size_t ii = 0; ii < NumCounters; ++ii)
+			{
+				const std::string name = prefix + '_' + counter_names[ii] + "_total";
+				out << "# TYPE " << name << " counter\n" << name << ' ' << s.counters[ii] << '\n';
+			}
+
+			out << "# TYPE " << prefix << "_numa_nodes gauge\n" << prefix << "_numa_nodes " << s.numa_nodes << '\n';
+			out << "# TYPE " << prefix << "_cpus gauge\n" << prefix << "_cpus " << s.cpus << '\n';
+			out << "# TYPE " << prefix << "_paths_per_second gauge\n" << prefix << "_paths_per_second " << s.PathsPerSecond() << '\n';
+			out << "# TYPE " << prefix << "_step_rejection_rate gauge\n" << prefix << "_step_rejection_rate " << s.StepRejectionRate() << '\n';
+
+			// cumulative, as Prometheus histograms are
+			const std::string histogram = prefix + "_step_precision_bits";
+			out << "# TYPE " << histogram << " histogram\n";
+			std::uint64_t cumulative = 0;
+			for (std::size_t ii = 0; ii < NumPrecisionBuckets; ++ii)
+			{
+				cumulative += s.precision_histogram[ii];
+				out << histogram << "_bucket{le=\"";
+				if (ii < PrecisionBucketBounds.size())
+					out << PrecisionBucketBounds[ii];
+				else
+					out << "+Inf";
+				out << "\"} " << cumulative << '\n';
+			}
+			out << histogram << "_count " << cumulative << '\n';
+
+			const std::string endgames = prefix + "_endgames_total";
+			out << "# TYPE " << endgames << " counter\n";
+			for (std::size_t ii = 0; ii < NumEndgames; ++ii)
+			{
+				out << endgames << "{type=\"" << endgame_names[ii] << "\",outcome=\"success\"} " << s.endgames[ii][1] << '\n';
+				out << endgames << "{type=\"" << endgame_names[ii] << "\",outcome=\"failure\"} " << s.endgames[ii][0] << '\n';
+			}
+
+			const std::string calls = prefix + "_phase_calls_total", seconds = prefix + "_phase_seconds_total";
+			out << "# TYPE " << calls << " counter\n";
+			for (std::size_t ii = 0; ii < instrument::NumPhases; ++ii)
+				out << calls << "{phase=\"" << phase_names[ii] << "\"} " << s.phase_calls[ii] << '\n';
+			out << "# TYPE " << seconds << " counter\n";
+			for (std::size_t ii = 0; ii < instrument::NumPhases; ++ii)
+				out << seconds << "{phase=\"" << phase_names[ii] << "\"} " << s.phase_nanoseconds[ii]*1e-9 << '\n';
+
+			return out.str();
+		}
+
+
+
+		PeriodicExporter::PeriodicExporter(Registry const& registry, std::chrono::milliseconds period, Sink sink) :
+			registry_(registry), period_(period), sink_(std::move(sink))
+		{
+			thread_ = std::thread([this]()
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				while (!stop_requested_.wait_for(lock, period_, [this](){ return stopping_; }))
+				{
+					lock.unlock();
+					Export();
+					lock.lock();
+				}
+			});
+		}
+
+		PeriodicExporter::~PeriodicExporter()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			stop_requested_.notify_one();
+			thread_.join();
+			Export();
+		}
+
+		void PeriodicExporter::Export() const
+		{
+			try
+			{
+				sink_(registry_.TakeSnapshot());
+			}
+			catch (...)
+			{}
+		}
+
+		} // namespace metrics
+	} // namespace tracking
+} // namespace bertini
@@ -0,0 +1,155 @@
+//This file is part of Bertini 2.
+//
+//parameter_homotopy.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parameter_homotopy.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parameter_homotopy.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/parameter_homotopy.hpp"
+
+#include <stdexcept>
+
+
+namespace bertini {
+	namespace tracking {
+
+		namespace {
+
+			Vec<dbl> ToDouble(Vec<mpfr> const& v)
+			{
+				Vec<dbl> result(v.size());
+				for (int ii = 0; ii < v.size(); ++ii)
+					result(ii) = static_cast<dbl>(v(ii));
+				return result;
+			}
+
+		}
+
+
+		ParameterHomotopy::ParameterHomotopy(System const& family, std::vector<Fn> const& parameters) : homotopy_(family), num_parameters_(parameters.size())
+		{
+			if (family.HavePathVariable())
+				throw std::runtime_error("building parameter homotopy, but the family already has a path variable");
+			if (family.NumImplicitParameters()!=0)
+				throw std::runtime_error("building parameter homotopy, but the family has implicit parameters, which would be mixed up with the values of the parameters");
+			if (parameters.empty())
+				throw std::runtime_error("building parameter homotopy, but no parameters were given");
+
+			auto t = node::MakeNode<node::Variable>("t");
+			t->precision(homotopy_.precision());
+
+			VariableGroup generic, target;
+			for (const auto& p : parameters)
+			{
+				generic.push_back(node::MakeNode<node::Variable>(p->name() + "_generic"));
+				target.push_back(node::MakeNode<node::Variable>(p->name() + "_target"));
+				generic.back()->precision(homotopy_.precision());
+				target.back()->precision(homotopy_.precision());
+
+				p->SetRoot(t*generic.back() + (1-t)*target.back());
+			}
+
+			homotopy_.AddImplicitParameters(generic);
+			homotopy_.AddImplicitParameters(target);
+			homotopy_.AddPathVariable(t);
+
+			// compiled once, here, and shared by every copy for a worker.  a homotopy which cannot be compiled is differentiated symbolically, on first use
+			homotopy_.UseForwardModeDifferentiation();
+			try
+			{
+				homotopy_.GetForwardModeProgram();
+			}
+			catch (std::runtime_error const&)
+			{
+				homotopy_.UseForwardModeDifferentiation(false);
+			}
+		}
+
+
+		void ParameterHomotopy::SetGenericSolve(Vec<mpfr> const& generic_parameters, std::vector< Vec<mpfr> > const& generic_solutions)
+		{
+			if (static_cast<std::size_t>(generic_parameters.size())!=num_parameters_)
+				throw std::runtime_error("setting generic solve of parameter homotopy, but given " + std::to_string(generic_parameters.size()) + " parameter values, not " + std::to_string(num_parameters_));
+			for (const auto& s : generic_solutions)
+				if (static_cast<std::size_t>(s.size())!=homotopy_.NumVariables())
+					throw std::runtime_error("setting generic solve of parameter homotopy, but a solution has " + std::to_string(s.size()) + " coordinates, not " + std::to_string(homotopy_.NumVariables()));
+
+			generic_parameters_ = generic_parameters;
+
+			auto& as_double = std::get< std::vector< Vec<dbl> > >(generic_solutions_);
+			as_double.clear();
+			for (const auto& s : generic_solutions)
+				as_double.push_back(ToDouble(s));
+			std::get< std::vector< Vec<mpfr> > >(generic_solutions_) = generic_solutions;
+		}
+
+
+		void ParameterHomotopy::SetTarget(System const& sys, Vec<mpfr> const& target) const
+		{
+			if (generic_parameters_.size()==0)
+				throw std::runtime_error("setting target of parameter homotopy, but the generic solve has not been given");
+			if (static_cast<std::size_t>(target.size())!=num_parameters_)
+				throw std::runtime_error("setting target of parameter homotopy, but given " + std::to_string(target.size()) + " values, not " + std::to_string(num_parameters_));
+
+			SetPath(sys, generic_parameters_, target);
+		}
+
+
+		void ParameterHomotopy::CheckTargets(std::vector< Vec<mpfr> > const& targets) const
+		{
+			if (NumGenericSolutions()==0)
+				throw std::runtime_error("solving parameter homotopy, but the generic solve has not been given");
+			for (const auto& target : targets)
+				if (static_cast<std::size_t>(target.size())!=num_parameters_)
+					throw std::runtime_error("solving parameter homotopy, but a target has " + std::to_string(target.size()) + " values, not " + std::to_string(num_parameters_));
+		}
+
+
+		std::vector< Vec<dbl> > ParameterHomotopy::BatchParameters(std::vector< Vec<mpfr> > const& targets) const
+		{
+			std::vector< Vec<dbl> > values(targets.size(), Vec<dbl>(2*num_parameters_));
+			for (std::size_t kk = 0; kk < targets.size(); ++kk)
+				for (std::size_t ii = 0; ii < num_parameters_; ++ii)
+				{
+					values[kk](ii) = static_cast<dbl>(generic_parameters_(ii));
+					values[kk](num_parameters_+ii) = static_cast<dbl>(targets[kk](ii));
+				}
+			return values;
+		}
+
+
+		void ParameterHomotopy::SetPath(System const& sys, Vec<mpfr> const& from, Vec<mpfr> const& to) const
+		{
+			if (static_cast<std::size_t>(from.size())!=num_parameters_ || static_cast<std::size_t>(to.size())!=num_parameters_)
+				throw std::runtime_error("setting path of parameter homotopy, but given " + std::to_string(from.size()) + " and " + std::to_string(to.size()) + " values, not " + std::to_string(num_parameters_));
+
+			Vec<mpfr> values(2*num_parameters_);
+			for (std::size_t ii = 0; ii < num_parameters_; ++ii)
+			{
+				values(ii) = from(ii);
+				values(num_parameters_+ii) = to(ii);
+			}
+
+			sys.SetImplicitParameters(ToDouble(values));
+			sys.SetImplicitParameters(values);
+		}
+
+	} // namespace tracking
+} // namespace bertini
@@ -0,0 +1,226 @@
+//This file is part of Bertini 2.
+//
+//path_recorder.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//path_recorder.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with path_recorder.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/path_recorder.hpp"
+
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+
+namespace bertini {
+	namespace tracking {
+
+		namespace {
+
+			const char sample_magic[8] = {'b','2','s','a','m','p','l','e'};
+
+			// bump whenever the layout of the header or the records changes
+			const std::uint32_t sample_format_version = 1;
+
+			struct StreamHeader
+			{
+				char magic[8];
+				std::uint32_t format_version;
+				std::uint32_t reserved;
+			};
+
+			// followed by 2n doubles, or for a point stored in full, 2n decimal strings, each preceded by its length as a std::uint32_t
+			struct RecordHeader
+			{
+				std::uint64_t size; // of the whole record, this header included
+				std::uint64_t path;
+				std::uint64_t step;
+				double time_real;
+				double time_imag;
+				std::uint32_t precision;
+				std::uint32_t num_coordinates;
+				std::uint32_t full;
+				std::uint32_t reserved;
+			};
+
+			template<typename T>
+			void AppendBytes(std::string & buffer, T const& t)
+			{
+				buffer.append(reinterpret_cast<char const*>(&t), sizeof(T));
+			}
+
+			void AppendReal(std::string & buffer, mpfr_float const& x)
+			{
+				const std::string digits = x.str(0, std::ios_base::scientific);
+				AppendBytes(buffer, static_cast<std::uint32_t>(digits.size()));
+				buffer.append(digits);
+			}
+
+			std::string EncodeRecord(PathSample const& sample)
+			{
+				const bool full = sample.point_mp.size() > 0;
+
+				std::string buffer;
+				RecordHeader header;
+				header.size = 0;
+				header.path = sample.path;
+				header.step = sample.step;
+				header.time_real = sample.time.real();
+				header.time_imag = sample.time.imag();
+				header.precision = sample.precision;
+				header.num_coordinates = static_cast<std::uint32_t>(full ? sample.point_mp.size() : sample.point.size());
+				header.full = full;
+				header.reserved = 0;
+				AppendBytes(buffer, header);
+
+				for (Eigen::DenseIndex ii = 0; ii < static_cast<Eigen::DenseIndex>(header.num_coordinates); ++ii)
+					if (full)
+					{
+						AppendReal(buffer, sample.point_mp(ii).real());
+						AppendReal(buffer, sample.point_mp(ii).imag());
+					}
+					else
+					{
+						AppendBytes(buffer, sample.point(ii).real());
+						AppendBytes(buffer, sample.point(ii).imag());
+					}
+
+				const std::uint64_t size = buffer.size();
+				std::memcpy(&buffer[0], &size, sizeof(size));
+				return buffer;
+			}
+
+
+			template<typename T>
+			char const* ReadBytes(char const* p, T & t)
+			{
+				std::memcpy(&t, p, sizeof(T));
+				return p + sizeof(T);
+			}
+
+			char const* ReadReal(char const* p, mpfr_float & x, unsigned precision)
+			{
+				std::uint32_t length;
+				p = ReadBytes(p, length);
+				mpfr_set_prec(x.backend().data(), DigitsToBits(precision));
+				mpfr_set_str(x.backend().data(), std::string(p, length).c_str(), 10, MPFR_RNDN);
+				return p + length;
+			}
+
+			void DecodeRecord(char const* p, PathSample & sample)
+			{
+				RecordHeader header;
+				p = ReadBytes(p, header);
+
+				sample.path = header.path;
+				sample.step = header.step;
+				sample.time = dbl(header.time_real, header.time_imag);
+				sample.precision = header.precision;
+				sample.point.resize(header.num_coordinates);
+
+				if (header.full)
+				{
+					sample.point_mp.resize(header.num_coordinates);
+					mpfr_float re, im;
+					for (Eigen::DenseIndex ii = 0; ii < sample.point.size(); ++ii)
+					{
+						p = ReadReal(p, re, header.precision);
+						p = ReadReal(p, im, header.precision);
+						sample.point_mp(ii).precision(header.precision);
+						sample.point_mp(ii).real(re);
+						sample.point_mp(ii).imag(im);
+						sample.point(ii) = static_cast<dbl>(sample.point_mp(ii));
+					}
+				}
+				else
+				{
+					sample.point_mp.resize(0);
+					double re, im;
+					for (Eigen::DenseIndex ii = 0; ii < sample.point.size(); ++ii)
+					{
+						p = ReadBytes(p, re);
+						p = ReadBytes(p, im);
+						sample.point(ii) = dbl(re, im);
+					}
+				}
+			}
+		}
+
+
+
+		PathSampleWriter::PathSampleWriter(std::ostream & out, bool write_header) : out_(out)
+		{
+			if (!write_header)
+				return;
+
+			StreamHeader header;
+			std::memcpy(header.magic, sample_magic, sizeof(sample_magic));
+			header.format_version = sample_format_version;
+			header.reserved = 0;
+			out_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+			if (!out_)
+				throw std::runtime_error("failed to write the header of a stream of path samples");
+		}
+
+
+		void PathSampleWriter::Write(std::vector<PathSample> const& samples)
+		{
+			std::string buffer;
+			for (auto const& sample : samples)
+				buffer += EncodeRecord(sample);
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			out_.write(buffer.data(), buffer.size());
+			if (!out_)
+				throw std::runtime_error("failed to write path samples");
+			num_written_ += samples.size();
+		}
+
+
+		std::vector<PathSample> ReadPathSamples(std::istream & in)
+		{
+			const std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+			StreamHeader header;
+			if (contents.size() < sizeof(header))
+				throw std::runtime_error("stream of path samples is too short to have a header");
+			std::memcpy(&header, contents.data(), sizeof(header));
+			if (std::memcmp(header.magic, sample_magic, sizeof(sample_magic)) || header.format_version!=sample_format_version)
+				throw std::runtime_error("stream is not path samples written by this version of Bertini");
+
+			std::vector<PathSample> samples;
+			std::uint64_t offset = sizeof(header);
+			const std::uint64_t end = contents.size();
+			while (offset + sizeof(RecordHeader) <= end)
+			{
+				std::uint64_t size;
+				std::memcpy(&size, contents.data() + offset, sizeof(size));
+				if (size < sizeof(RecordHeader) || size > end - offset)
+					break;
+
+				samples.emplace_back();
+				DecodeRecord(contents.data() + offset, samples.back());
+				offset += size;
+			}
+			return samples;
+		}
+
+	} // namespace tracking
+} // namespace bertini
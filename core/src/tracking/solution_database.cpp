@@ -0,0 +1,267 @@
+//This file is part of Bertini 2.
+//
+//solution_database.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//solution_database.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with solution_database.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/solution_database.hpp"
+
+#include <stdexcept>
+
+
+namespace bertini {
+	namespace tracking {
+
+		namespace {
+
+			const std::size_t no_child = SolutionDatabase::None;
+
+			boost::filesystem::path ParametersFile(boost::filesystem::path const& directory)
+			{
+				return directory / "parameters.endpoints";
+			}
+		}
+
+
+		constexpr std::size_t SolutionDatabase::None;
+
+
+		SolutionDatabase::SolutionDatabase(boost::filesystem::path const& directory, std::size_t num_parameters) : directory_(directory), num_parameters_(num_parameters)
+		{
+			boost::system::error_code ec;
+			boost::filesystem::create_directories(directory_ / "solutions", ec);
+			if (ec)
+				throw std::runtime_error("unable to make solution database directory " + directory_.string() + ": " + ec.message());
+
+			if (boost::filesystem::exists(ParametersFile(directory_)))
+			{
+				EndpointReader reader(ParametersFile(directory_));
+				for (std::size_t ii = 0; ii < reader.NumRecords(); ++ii)
+				{
+					const auto record = reader.Get<mpfr>(ii);
+					if (static_cast<std::size_t>(record.endpoint.size())!=num_parameters_)
+						throw std::runtime_error("solution database " + directory_.string() + " holds members with " + std::to_string(record.endpoint.size()) + " parameters, not " + std::to_string(num_parameters_));
+
+					// a member whose solutions are missing was not meant to be, so is indexed with none
+					std::size_t num_solutions = 0;
+					if (boost::filesystem::exists(SolutionsFile(parameters_.size())))
+						num_solutions = EndpointReader(SolutionsFile(parameters_.size())).NumRecords();
+					Index(record.endpoint, num_solutions);
+				}
+			}
+
+			parameters_writer_.reset(new EndpointWriter(ParametersFile(directory_), true));
+		}
+
+
+		std::size_t SolutionDatabase::NumEntries() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return parameters_.size();
+		}
+
+
+		std::size_t SolutionDatabase::Insert(Vec<mpfr> const& parameters, std::vector< Vec<dbl> > const& solutions)
+		{
+			return InsertSolutions(parameters, solutions);
+		}
+
+		std::size_t SolutionDatabase::Insert(Vec<mpfr> const& parameters, std::vector< Vec<mpfr> > const& solutions)
+		{
+			return InsertSolutions(parameters, solutions);
+		}
+
+
+		template<typename ComplexType>
+		std::size_t SolutionDatabase::InsertSolutions(Vec<mpfr> const& parameters, std::vector< Vec<ComplexType> > const& solutions)
+		{
+			if (static_cast<std::size_t>(parameters.size())!=num_parameters_)
+				throw std::runtime_error("inserting a member with " + std::to_string(parameters.size()) + " parameters into a solution database of members with " + std::to_string(num_parameters_));
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			const auto entry = parameters_.size();
+
+			// the solutions first, so that the member is found only once they are all there
+			{
+				EndpointWriter writer(SolutionsFile(entry));
+				for (std::size_t ii = 0; ii < solutions.size(); ++ii)
+				{
+					EndpointRecord<ComplexType> record;
+					record.index = ii;
+					record.time = ComplexType(0);
+					record.precision = solutions[ii].size() > 0 ? Precision(solutions[ii]) : 0;
+					record.endpoint = solutions[ii];
+					writer.Write(record);
+				}
+				writer.Flush();
+			}
+
+			EndpointRecord<mpfr> record;
+			record.index = entry;
+			record.time = mpfr(0);
+			record.precision = parameters.size() > 0 ? Precision(parameters) : 0;
+			record.endpoint = parameters;
+			parameters_writer_->Write(record);
+			parameters_writer_->Flush();
+
+			Index(parameters, solutions.size());
+			return entry;
+		}
+
+
+		void SolutionDatabase::Index(Vec<mpfr> const& parameters, std::size_t num_solutions)
+		{
+			const auto entry = parameters_.size();
+			parameters_.push_back(parameters);
+			num_solutions_.push_back(num_solutions);
+			const auto coordinates = Coordinates(parameters);
+			coordinates_.insert(coordinates_.end(), coordinates.begin(), coordinates.end());
+
+			tree_.push_back(KdNode{entry, {no_child, no_child}});
+			if (entry==0 || coordinates.empty())
+			{
+				if (entry > 0) // no coordinates to split by, so a list
+					tree_[entry-1].children[0] = entry;
+				return;
+			}
+
+			std::size_t node = 0;
+			for (unsigned depth = 0; ; ++depth)
+			{
+				const auto axis = depth % coordinates.size();
+				const auto side = coordinates[axis] < coordinates_[tree_[node].entry*coordinates.size() + axis] ? 0 : 1;
+				if (tree_[node].children[side]==no_child)
+				{
+					tree_[node].children[side] = entry;
+					return;
+				}
+				node = tree_[node].children[side];
+			}
+		}
+
+
+		std::size_t SolutionDatabase::Nearest(Vec<mpfr> const& parameters, std::size_t min_solutions) const
+		{
+			if (static_cast<std::size_t>(parameters.size())!=num_parameters_)
+				throw std::runtime_error("looking for a member with " + std::to_string(parameters.size()) + " parameters in a solution database of members with " + std::to_string(num_parameters_));
+
+			const auto query = Coordinates(parameters);
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			std::size_t best = None;
+			double best_distance = std::numeric_limits<double>::infinity();
+			if (!tree_.empty())
+				Search(0, 0, query, min_solutions, best, best_distance);
+			return best;
+		}
+
+
+		void SolutionDatabase::Search(std::size_t node, unsigned depth, std::vector<double> const& query, std::size_t min_solutions, std::size_t & best, double & best_distance) const
+		{
+			// iterative along the nearer side, recursive along the farther, so a list made of a tree with no coordinates takes no stack
+			while (node!=no_child)
+			{
+				const auto entry = tree_[node].entry;
+				const double* point = coordinates_.data() + entry*query.size();
+
+				if (num_solutions_[entry] >= min_solutions)
+				{
+					double distance = 0;
+					for (std::size_t ii = 0; ii < query.size(); ++ii)
+						distance += (query[ii]-point[ii])*(query[ii]-point[ii]);
+					if (distance < best_distance || best==None)
+					{
+						best = entry;
+						best_distance = distance;
+					}
+				}
+
+				if (query.empty())
+				{
+					node = tree_[node].children[0];
+					continue;
+				}
+
+				const auto axis = depth % query.size();
+				const double offset = query[axis] - point[axis];
+				const auto nearer = offset < 0 ? 0 : 1;
+
+				// the farther side holds a point nearer than the best only if the splitting plane is
+				if (tree_[node].children[1-nearer]!=no_child && offset*offset < best_distance)
+					Search(tree_[node].children[1-nearer], depth+1, query, min_solutions, best, best_distance);
+
+				node = tree_[node].children[nearer];
+				++depth;
+			}
+		}
+
+
+		std::vector<double> SolutionDatabase::Coordinates(Vec<mpfr> const& parameters) const
+		{
+			std::vector<double> coordinates(2*parameters.size());
+			for (Eigen::DenseIndex ii = 0; ii < parameters.size(); ++ii)
+			{
+				coordinates[2*ii] = static_cast<double>(parameters(ii).real());
+				coordinates[2*ii+1] = static_cast<double>(parameters(ii).imag());
+			}
+			return coordinates;
+		}
+
+
+		Vec<mpfr> SolutionDatabase::Parameters(std::size_t entry) const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (entry >= parameters_.size())
+				throw std::runtime_error("asking for the parameters of entry " + std::to_string(entry) + " of a solution database of " + std::to_string(parameters_.size()));
+			return parameters_[entry];
+		}
+
+
+		std::size_t SolutionDatabase::NumSolutions(std::size_t entry) const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (entry >= num_solutions_.size())
+				throw std::runtime_error("asking for the number of solutions of entry " + std::to_string(entry) + " of a solution database of " + std::to_string(num_solutions_.size()));
+			return num_solutions_[entry];
+		}
+
+
+		std::vector< Vec<mpfr> > SolutionDatabase::Solutions(std::size_t entry) const
+		{
+			if (NumSolutions(entry)==0)
+				return {};
+
+			EndpointReader reader(SolutionsFile(entry));
+			std::vector< Vec<mpfr> > solutions;
+			solutions.reserve(reader.NumRecords());
+			for (std::size_t ii = 0; ii < reader.NumRecords(); ++ii)
+				solutions.push_back(reader.Get<mpfr>(ii).endpoint);
+			return solutions;
+		}
+
+
+		boost::filesystem::path SolutionDatabase::SolutionsFile(std::size_t entry) const
+		{
+			return directory_ / "solutions" / (std::to_string(entry) + ".endpoints");
+		}
+
+	} // namespace tracking
+} // namespace bertini
@@ -0,0 +1,332 @@
+//This file is part of Bertini 2.
+//
+//trace.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//trace.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with trace.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+#include "bertini2/tracking/trace.hpp"
+
+#include "bertini2/config.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include <utility>
+
+
+namespace bertini {
+	namespace tracking {
+		namespace trace {
+
+		namespace detail {
+			std::atomic<Trace*> active(nullptr);
+		}
+
+		namespace {
+
+			std::atomic<std::uint64_t> next_trace_id(0);
+
+		#ifdef USE_THREAD_LOCAL
+			thread_local std::uint64_t current_path = NoPath;
+		#else
+			std::uint64_t current_path = NoPath; // shared by all threads
+		#endif
+
+			struct OpenSpan
+			{
+				EventKind kind;
+				Event begin;
+			};
+
+			// the end of each kind of span, or NumKinds for those which are not the beginning of one
+			EventKind EndOf(EventKind kind)
+			{
+				switch (kind)
+				{
+					case EventKind::PathBegin: return EventKind::PathEnd;
+					case EventKind::TrackBegin: return EventKind::TrackEnd;
+					case EventKind::EndgameBegin: return EventKind::EndgameEnd;
+					default: return EventKind::NumKinds;
+				}
+			}
+
+			bool IsEnd(EventKind kind)
+			{
+				return kind==EventKind::PathEnd || kind==EventKind::TrackEnd || kind==EventKind::EndgameEnd;
+			}
+
+			class ChromeWriter
+			{
+			public:
+				ChromeWriter()
+				{
+					out_.imbue(std::locale::classic());
+					out_ << std::fixed << std::setprecision(3);
+					out_ << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+				}
+
+				void ThreadName(unsigned thread)
+				{
+					Open();
+					out_ << "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread << ",\"args\":{\"name\":\"thread " << thread << "\"}}";
+				}
+
+				// a complete event, from the beginning of a span to the end, which may be null if it was never ended
+				void Complete(unsigned thread, Event const& begin, std::uint64_t end_nanoseconds, Event const* end)
+				{
+					Open();
+					switch (begin.kind)
+					{
+						case EventKind::PathBegin:
+							out_ << "\"name\":\"path " << begin.path << "\",\"cat\":\"path\""; break;
+						case EventKind::TrackBegin:
+							out_ << "\"name\":\"track\",\"cat\":\"tracking\""; break;
+						default:
+							out_ << "\"name\":\"endgame\",\"cat\":\"endgame\""; break;
+					}
+					out_ << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread
+					     << ",\"ts\":" << Microseconds(begin.nanoseconds)
+					     << ",\"dur\":" << Microseconds(end_nanoseconds - begin.nanoseconds)
+					     << ",\"args\":{\"path\":";
+					Path(begin.path);
+					if (begin.kind==EventKind::TrackBegin && end)
+						out_ << ",\"end_digits\":" << end->value;
+					else if (begin.kind==EventKind::EndgameBegin && end)
+						out_ << ",\"success_code\":" << static_cast<std::int32_t>(end->value);
+					if (!end)
+						out_ << ",\"ended\":false";
+					out_ << "}}";
+				}
+
+				void Precision(unsigned thread, Event const& e)
+				{
+					Open();
+					out_ << "\"name\":\"precision, thread " << thread << "\",\"ph\":\"C\",\"pid\":1,\"tid\":" << thread
+					     << ",\"ts\":" << Microseconds(e.nanoseconds) << ",\"args\":{\"digits\":" << e.value << "}}";
+				}
+
+				void Instant(unsigned thread, Event const& e)
+				{
+					Open();
+					if (e.kind==EventKind::CauchyLoop)
+						out_ << "\"name\":\"cauchy loop\",\"cat\":\"endgame\"";
+					else
+						out_ << "\"name\":\"retry\",\"cat\":\"path\"";
+					out_ << ",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << thread
+					     << ",\"ts\":" << Microseconds(e.nanoseconds) << ",\"args\":{\"path\":";
+					Path(e.path);
+					out_ << (e.kind==EventKind::CauchyLoop ? ",\"samples\":" : ",\"rung\":") << e.value << "}}";
+				}
+
+				std::string Finish()
+				{
+					out_ << "]}";
+					return out_.str();
+				}
+
+			private:
+
+				void Open()
+				{
+					out_ << (first_ ? "" : ",") << "\n{";
+					first_ = false;
+				}
+
+				void Path(std::uint64_t path)
+				{
+					if (path==NoPath)
+						out_ << "null";
+					else
+						out_ << path;
+				}
+
+				static double Microseconds(std::uint64_t nanoseconds)
+				{
+					return nanoseconds*1e-3;
+				}
+
+				std::ostringstream out_;
+				bool first_ = true;
+			};
+		}
+
+
+
+		Trace::Trace(std::size_t max_events_per_thread) : id_(next_trace_id++), created_(Clock::now()), max_events_per_thread_(max_events_per_thread)
+		{}
+
+		Trace::~Trace()
+		{
+			Trace* self = this;
+			detail::active.compare_exchange_strong(self, nullptr);
+
+			Buffer* buffer = buffers_.load();
+			while (buffer)
+			{
+				Buffer* next = buffer->next;
+				delete buffer;
+				buffer = next;
+			}
+		}
+
+
+		void Trace::Record(EventKind kind, std::uint32_t value)
+		{
+			Record(kind, CurrentPath(), value);
+		}
+
+
+		void Trace::Record(EventKind kind, std::uint64_t path, std::uint32_t value)
+		{
+			const auto now = Clock::now();
+			auto& buffer = LocalBuffer();
+			if (buffer.events.size() >= max_events_per_thread_)
+			{
+				++buffer.dropped;
+				return;
+			}
+
+			Event e;
+			e.nanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - created_).count());
+			e.path = path;
+			e.value = value;
+			e.kind = kind;
+			buffer.events.push_back(e);
+		}
+
+
+		Trace::Buffer& Trace::LocalBuffer()
+		{
+			// the identities of traces are never reused, so a stale entry for one destroyed is never found
+			static thread_local std::vector< std::pair<std::uint64_t, Buffer*> > buffers_of_thread;
+			for (auto const& entry : buffers_of_thread)
+				if (entry.first==id_)
+					return *entry.second;
+
+			Buffer* buffer = new Buffer;
+			buffer->thread = num_threads_++;
+			buffer->next = buffers_.load(std::memory_order_relaxed);
+			while (!buffers_.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed))
+			{}
+
+			buffers_of_thread.emplace_back(id_, buffer);
+			return *buffer;
+		}
+
+
+		std::vector<ThreadEvents> Trace::Events() const
+		{
+			std::vector<ThreadEvents> events;
+			for (Buffer const* buffer = buffers_.load(std::memory_order_acquire); buffer; buffer = buffer->next)
+				events.push_back(ThreadEvents{buffer->thread, buffer->events});
+
+			std::sort(events.begin(), events.end(), [](ThreadEvents const& a, ThreadEvents const& b){return a.thread < b.thread;});
+			return events;
+		}
+
+
+		std::uint64_t Trace::NumDropped() const
+		{
+			std::uint64_t dropped = 0;
+			for (Buffer const* buffer = buffers_.load(std::memory_order_acquire); buffer; buffer = buffer->next)
+				dropped += buffer->dropped;
+			return dropped;
+		}
+
+
+
+		void Start(Trace & trace)
+		{
+			detail::active.store(&trace, std::memory_order_release);
+		}
+
+		void Stop()
+		{
+			detail::active.store(nullptr, std::memory_order_release);
+		}
+
+
+		std::uint64_t CurrentPath()
+		{
+			return current_path;
+		}
+
+
+		ScopedPath::ScopedPath(std::uint64_t path) : previous_(current_path)
+		{
+			current_path = path;
+			Record(EventKind::PathBegin);
+		}
+
+		ScopedPath::~ScopedPath()
+		{
+			Record(EventKind::PathEnd);
+			current_path = previous_;
+		}
+
+
+
+		std::string ToChromeTrace(Trace const& trace)
+		{
+			ChromeWriter writer;
+			for (auto const& thread : trace.Events())
+			{
+				writer.ThreadName(thread.thread);
+
+				std::vector<OpenSpan> open;
+				for (auto const& e : thread.events)
+				{
+					if (EndOf(e.kind)!=EventKind::NumKinds)
+						open.push_back(OpenSpan{EndOf(e.kind), e});
+					else if (IsEnd(e.kind))
+					{
+						// an end closes the innermost span of its kind, and any left open within it
+						const auto match = std::find_if(open.rbegin(), open.rend(), [&](OpenSpan const& s){return s.kind==e.kind;});
+						if (match==open.rend())
+							continue;
+						while (open.back().kind!=e.kind)
+						{
+							writer.Complete(thread.thread, open.back().begin, e.nanoseconds, nullptr);
+							open.pop_back();
+						}
+						writer.Complete(thread.thread, open.back().begin, e.nanoseconds, &e);
+						open.pop_back();
+					}
+					else if (e.kind==EventKind::PrecisionChange)
+						writer.Precision(thread.thread, e);
+					else
+						writer.Instant(thread.thread, e);
+				}
+
+				const auto last = thread.events.empty() ? 0 : thread.events.back().nanoseconds;
+				while (!open.empty())
+				{
+					writer.Complete(thread.thread, open.back().begin, last, nullptr);
+					open.pop_back();
+				}
+			}
+			return writer.Finish();
+		}
+
+		} // namespace trace
+	} // namespace tracking
+} // namespace bertini
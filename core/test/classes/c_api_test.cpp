@@ -0,0 +1,277 @@
+//This file is part of Bertini 2.
+//
+//c_api_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//c_api_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with c_api_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file c_api_test.cpp Unit testing for the C interface, c_api.h.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "bertini2/c_api.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <complex>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using dbl = std::complex<double>;
+
+
+BOOST_AUTO_TEST_SUITE(c_api)
+
+
+/**
+The system of AMP_simple_nonhomogeneous_system_trackable_initialprecision16, in a classic input file, removed when done.
+*/
+struct InputFile
+{
+	InputFile() : path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_c_api_%%%%-%%%%"))
+	{
+		boost::filesystem::ofstream out(path);
+		out << "INPUT\n"
+		       "variable_group x, y;\n"
+		       "function f1, f2;\n"
+		       "pathvariable t;\n"
+		       "parameter s;\n"
+		       "s = t;\n"
+		       "f1 = x^2 + (1-t)*x - 1;\n"
+		       "f2 = y^2 + (1-t)*x*y - 2;\n"
+		       "END;\n";
+	}
+
+	~InputFile()
+	{
+		boost::filesystem::remove(path);
+	}
+
+	// the functions and Jacobian, row-major, of the system, to check against
+	static std::vector<dbl> Expected(dbl x, dbl y, dbl t)
+	{
+		return {x*x + (1.-t)*x - 1., y*y + (1.-t)*x*y - 2.,
+		        2.*x + (1.-t), 0., (1.-t)*y, 2.*y + (1.-t)*x};
+	}
+
+	boost::filesystem::path path;
+};
+
+
+/**
+\test \b c_api_evaluates_in_batches The functions and Jacobian at more points than fill a batch, the last batch only partly, are those of the system.
+*/
+BOOST_AUTO_TEST_CASE(c_api_evaluates_in_batches)
+{
+	InputFile input;
+	b2_system* sys = nullptr;
+	BOOST_REQUIRE_EQUAL(b2_system_from_file(input.path.string().c_str(), &sys), B2_OK);
+	BOOST_REQUIRE_EQUAL(b2_system_compile(sys), B2_OK);
+	BOOST_CHECK_EQUAL(b2_system_num_variables(sys), 2);
+	BOOST_CHECK_EQUAL(b2_system_num_functions(sys), 2);
+	BOOST_CHECK(b2_system_has_path_variable(sys));
+
+	const std::size_t num_points = 11;
+	std::vector<double> points(4*num_points), times(2*num_points), values(4*num_points), jacobians(8*num_points);
+	for (std::size_t p = 0; p < num_points; ++p)
+	{
+		points[4*p] = 0.1*p; points[4*p+1] = -0.3;
+		points[4*p+2] = 1.5; points[4*p+3] = 0.2*p;
+		times[2*p] = 1 - 0.05*p; times[2*p+1] = 0.01;
+	}
+
+	BOOST_REQUIRE_EQUAL(b2_system_eval(sys, num_points, points.data(), times.data(), values.data(), jacobians.data()), B2_OK);
+
+	for (std::size_t p = 0; p < num_points; ++p)
+	{
+		const auto expected = InputFile::Expected(dbl(points[4*p], points[4*p+1]), dbl(points[4*p+2], points[4*p+3]), dbl(times[2*p], times[2*p+1]));
+		for (std::size_t ii = 0; ii < 2; ++ii)
+			BOOST_CHECK(std::abs(dbl(values[4*p+2*ii], values[4*p+2*ii+1]) - expected[ii]) < 1e-14);
+		for (std::size_t ii = 0; ii < 4; ++ii)
+			BOOST_CHECK(std::abs(dbl(jacobians[8*p+2*ii], jacobians[8*p+2*ii+1]) - expected[2+ii]) < 1e-14);
+	}
+
+	b2_system_free(sys);
+}
+
+
+/**
+\test \b c_api_evaluates_in_multiple_precision Packed multiple precision points evaluate to the double values, rounded, and the results come back packed at the precision asked for.
+*/
+BOOST_AUTO_TEST_CASE(c_api_evaluates_in_multiple_precision)
+{
+	InputFile input;
+	b2_system* sys = nullptr;
+	BOOST_REQUIRE_EQUAL(b2_system_from_file(input.path.string().c_str(), &sys), B2_OK);
+
+	const unsigned bits = 200;
+	const std::size_t real_bytes = b2_mp_real_bytes(bits);
+	BOOST_CHECK_EQUAL(real_bytes, sizeof(b2_mp_real) + 4*8);
+
+	const std::vector<double> point{0.25, -0.5, 1.25, 0.75}, time{0.5, 0.125};
+	std::vector<std::uint64_t> packed_point(4*real_bytes/8), packed_time(2*real_bytes/8), packed_values(4*real_bytes/8), packed_jacobian(8*real_bytes/8);
+	for (std::size_t ii = 0; ii < 4; ++ii)
+		BOOST_REQUIRE_EQUAL(b2_mp_from_double(point[ii], bits, reinterpret_cast<char*>(packed_point.data()) + ii*real_bytes), B2_OK);
+	for (std::size_t ii = 0; ii < 2; ++ii)
+		BOOST_REQUIRE_EQUAL(b2_mp_from_double(time[ii], bits, reinterpret_cast<char*>(packed_time.data()) + ii*real_bytes), B2_OK);
+
+	BOOST_REQUIRE_EQUAL(b2_system_eval_mp(sys, bits, 1, packed_point.data(), packed_time.data(), packed_values.data(), packed_jacobian.data()), B2_OK);
+
+	auto unpack = [&](std::vector<std::uint64_t> const& packed, std::size_t ii)
+	{
+		auto p = reinterpret_cast<char const*>(packed.data()) + 2*ii*real_bytes;
+		double re, im;
+		BOOST_REQUIRE_EQUAL(b2_mp_to_double(p, bits, &re), B2_OK);
+		BOOST_REQUIRE_EQUAL(b2_mp_to_double(p + real_bytes, bits, &im), B2_OK);
+		return dbl(re, im);
+	};
+
+	const auto expected = InputFile::Expected(dbl(point[0], point[1]), dbl(point[2], point[3]), dbl(time[0], time[1]));
+	for (std::size_t ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(std::abs(unpack(packed_values, ii) - expected[ii]) < 1e-15);
+	for (std::size_t ii = 0; ii < 4; ++ii)
+		BOOST_CHECK(std::abs(unpack(packed_jacobian, ii) - expected[2+ii]) < 1e-15);
+
+	b2_system_free(sys);
+}
+
+
+/**
+\test \b c_api_refuses_bad_packed_reals Packed reals MPFR could not have written, of an unknown kind, an exponent out of range, or not normalized, and null buffers, are refused with B2_ERROR_ARGUMENT, when unpacked and when evaluated at.
+*/
+BOOST_AUTO_TEST_CASE(c_api_refuses_bad_packed_reals)
+{
+	const unsigned bits = 128;
+	const std::size_t real_bytes = b2_mp_real_bytes(bits);
+	std::vector<std::uint64_t> packed(real_bytes/8);
+	double x;
+
+	BOOST_REQUIRE_EQUAL(b2_mp_from_double(0.75, bits, packed.data()), B2_OK);
+	BOOST_REQUIRE_EQUAL(b2_mp_to_double(packed.data(), bits, &x), B2_OK);
+	BOOST_CHECK_EQUAL(x, 0.75);
+
+	BOOST_CHECK_EQUAL(b2_mp_to_double(nullptr, bits, &x), B2_ERROR_ARGUMENT);
+	BOOST_CHECK_EQUAL(b2_mp_to_double(packed.data(), bits, nullptr), B2_ERROR_ARGUMENT);
+	BOOST_CHECK_EQUAL(b2_mp_to_double(packed.data(), 0, &x), B2_ERROR_ARGUMENT);
+	BOOST_CHECK_EQUAL(b2_mp_from_double(0.75, 0, packed.data()), B2_ERROR_ARGUMENT);
+
+	// the kinds of b2_mp_real
+	const std::int64_t zero_kind = 2, regular = 3;
+
+	auto with_header = [&](std::int64_t kind, std::int64_t exponent)
+	{
+		auto bad = packed;
+		b2_mp_real header;
+		header.kind = kind;
+		header.exponent = exponent;
+		std::memcpy(bad.data(), &header, sizeof(header));
+		return bad;
+	};
+
+	BOOST_CHECK_EQUAL(b2_mp_to_double(with_header(7, 0).data(), bits, &x), B2_ERROR_ARGUMENT);
+	BOOST_CHECK_EQUAL(b2_mp_to_double(with_header(regular, std::numeric_limits<std::int64_t>::max()).data(), bits, &x), B2_ERROR_ARGUMENT);
+	BOOST_CHECK_EQUAL(b2_mp_to_double(with_header(-regular, std::numeric_limits<std::int64_t>::min()).data(), bits, &x), B2_ERROR_ARGUMENT);
+
+	auto unnormalized = packed;
+	unnormalized.back() = 1;
+	BOOST_CHECK_EQUAL(b2_mp_to_double(unnormalized.data(), bits, &x), B2_ERROR_ARGUMENT);
+
+	// zero takes no limbs, so any will do
+	auto zero = with_header(zero_kind, 0);
+	zero.back() = 1;
+	BOOST_REQUIRE_EQUAL(b2_mp_to_double(zero.data(), bits, &x), B2_OK);
+	BOOST_CHECK_EQUAL(x, 0.0);
+
+	InputFile input;
+	b2_system* sys = nullptr;
+	BOOST_REQUIRE_EQUAL(b2_system_from_file(input.path.string().c_str(), &sys), B2_OK);
+
+	std::vector<std::uint64_t> point(4*real_bytes/8), time(2*real_bytes/8), values(4*real_bytes/8);
+	for (std::size_t ii = 0; ii < 4; ++ii)
+		BOOST_REQUIRE_EQUAL(b2_mp_from_double(0.5, bits, reinterpret_cast<char*>(point.data()) + ii*real_bytes), B2_OK);
+	for (std::size_t ii = 0; ii < 2; ++ii)
+		BOOST_REQUIRE_EQUAL(b2_mp_from_double(0.5, bits, reinterpret_cast<char*>(time.data()) + ii*real_bytes), B2_OK);
+	BOOST_REQUIRE_EQUAL(b2_system_eval_mp(sys, bits, 1, point.data(), time.data(), values.data(), nullptr), B2_OK);
+
+	std::copy(unnormalized.begin(), unnormalized.end(), time.begin());
+	BOOST_CHECK_EQUAL(b2_system_eval_mp(sys, bits, 1, point.data(), time.data(), values.data(), nullptr), B2_ERROR_ARGUMENT);
+
+	b2_system_free(sys);
+}
+
+
+/**
+\test \b c_api_tracks_paths The paths from the four start points of the system at t=1 reach the four solutions at t=0.
+*/
+BOOST_AUTO_TEST_CASE(c_api_tracks_paths)
+{
+	InputFile input;
+	b2_system* sys = nullptr;
+	BOOST_REQUIRE_EQUAL(b2_system_from_file(input.path.string().c_str(), &sys), B2_OK);
+
+	b2_tracker* tracker = nullptr;
+	BOOST_REQUIRE_EQUAL(b2_tracker_create(sys, nullptr, &tracker), B2_OK);
+
+	const double r = std::sqrt(2.);
+	const std::vector<double> start_points{1,0, r,0,  1,0, -r,0,  -1,0, r,0,  -1,0, -r,0};
+	std::vector<b2_path_result> results(4);
+	std::vector<double> endpoints(16);
+	BOOST_REQUIRE_EQUAL(b2_tracker_track(tracker, 4, start_points.data(), 1, 0, results.data(), endpoints.data()), B2_OK);
+
+	for (std::size_t ii = 0; ii < 4; ++ii)
+	{
+		BOOST_CHECK_EQUAL(results[ii].index, ii);
+		BOOST_CHECK_EQUAL(results[ii].code, B2_PATH_SUCCESS);
+		BOOST_CHECK_EQUAL(results[ii].time_real, 0);
+		const dbl x(endpoints[4*ii], endpoints[4*ii+1]), y(endpoints[4*ii+2], endpoints[4*ii+3]);
+		BOOST_CHECK(std::abs(x*x + x - 1.) < 1e-10);
+		BOOST_CHECK(std::abs(y*y + x*y - 2.) < 1e-10);
+	}
+
+	b2_tracker_free(tracker);
+	b2_system_free(sys);
+}
+
+
+/**
+\test \b c_api_reports_errors Failures come back as statuses, with a message, rather than as exceptions.
+*/
+BOOST_AUTO_TEST_CASE(c_api_reports_errors)
+{
+	b2_system* sys = nullptr;
+	BOOST_CHECK_EQUAL(b2_system_from_file("no_such_input_file", &sys), B2_ERROR_FILE);
+	BOOST_CHECK(sys==nullptr);
+	BOOST_CHECK(std::strlen(b2_last_error()) > 0);
+
+	double value[2];
+	BOOST_CHECK_EQUAL(b2_system_eval(nullptr, 1, value, value, value, nullptr), B2_ERROR_ARGUMENT);
+
+	const char garbage[] = "not a system";
+	BOOST_CHECK_EQUAL(b2_system_from_bytes(garbage, sizeof(garbage), &sys), B2_ERROR);
+	BOOST_CHECK(sys==nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
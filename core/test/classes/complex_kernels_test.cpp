@@ -0,0 +1,135 @@
+//This file is part of Bertini 2.
+//
+//complex_kernels_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//complex_kernels_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with complex_kernels_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file complex_kernels_test.cpp Unit testing for the kernels on complex doubles, with every set of instructions the processor has.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/complex_kernels.hpp"
+
+using dbl = bertini::dbl;
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+
+namespace kernels = bertini::kernels;
+
+
+BOOST_AUTO_TEST_SUITE(complex_kernels)
+
+
+/**
+Run a test with each set of instructions this build and processor have, restoring the one active before.
+*/
+template<typename Test>
+void ForEachInstructionSet(Test test)
+{
+	const auto active = kernels::ActiveInstructionSet();
+	for (auto set : {kernels::InstructionSet::Scalar, kernels::InstructionSet::AVX2, kernels::InstructionSet::AVX512, kernels::InstructionSet::NEON})
+		if (kernels::Supported(set))
+		{
+			BOOST_TEST_MESSAGE("with " << kernels::Name(set));
+			kernels::UseInstructionSet(set);
+			test();
+		}
+	kernels::UseInstructionSet(active);
+}
+
+
+/**
+\test \b complex_kernels_multiply_matches_std The textbook products agree with those of std::complex for finite numbers.
+*/
+BOOST_AUTO_TEST_CASE(complex_kernels_multiply_matches_std)
+{
+	const dbl a(0.3,-1.7), b(-2.2,0.45);
+	BOOST_CHECK(abs(kernels::Multiply(a,b) - a*b) < 1e-15);
+
+	dbl c(1.25,0.5);
+	const dbl expected = c + a*b;
+	kernels::MultiplyAdd(c, a, b);
+	BOOST_CHECK(abs(c - expected) < 1e-15);
+}
+
+
+/**
+\test \b complex_kernels_match_eigen Axpy and Dot, at lengths with and without a remainder past the vector registers, and the matrix-vector product, agree with Eigen.
+*/
+BOOST_AUTO_TEST_CASE(complex_kernels_match_eigen)
+{
+	ForEachInstructionSet([]()
+	{
+		for (int n : {0, 1, 2, 3, 7, 8, 13})
+		{
+			const Vec<dbl> x = Vec<dbl>::Random(n);
+			Vec<dbl> y = Vec<dbl>::Random(n);
+			const dbl alpha(0.7,-1.3);
+
+			const Vec<dbl> expected_axpy = y + alpha*x;
+			kernels::Axpy(n, alpha, x.data(), y.data());
+			BOOST_CHECK((y - expected_axpy).norm() < 1e-14);
+
+			BOOST_CHECK(abs(kernels::Dot(n, x.data(), y.data()) - x.cwiseProduct(y).sum()) < 1e-13);
+		}
+
+		const Mat<dbl> A = Mat<dbl>::Random(6,5);
+		const Vec<dbl> x = Vec<dbl>::Random(5);
+		Vec<dbl> y(6);
+		kernels::MatVec(6, 5, A.data(), A.rows(), x.data(), y.data());
+		BOOST_CHECK((y - A*x).norm() < 1e-14);
+	});
+}
+
+
+/**
+\test \b complex_kernels_triangular_solves The unit lower and the upper triangular solves agree with Eigen's, and read only their triangles.
+*/
+BOOST_AUTO_TEST_CASE(complex_kernels_triangular_solves)
+{
+	ForEachInstructionSet([]()
+	{
+		const int n = 7;
+		Mat<dbl> T = Mat<dbl>::Random(n,n);
+		T.diagonal().array() += dbl(4);
+		const Vec<dbl> b = Vec<dbl>::Random(n);
+
+		Vec<dbl> x = b;
+		kernels::SolveUnitLower(n, T.data(), n, x.data());
+		BOOST_CHECK((T.triangularView<Eigen::UnitLower>()*x - b).norm() < 1e-13);
+
+		x = b;
+		kernels::SolveUpper(n, T.data(), n, x.data());
+		BOOST_CHECK((T.triangularView<Eigen::Upper>()*x - b).norm() < 1e-13);
+	});
+}
+
+
+BOOST_AUTO_TEST_CASE(complex_kernels_unsupported_set_throws)
+{
+	for (auto set : {kernels::InstructionSet::AVX2, kernels::InstructionSet::AVX512, kernels::InstructionSet::NEON})
+		if (!kernels::Supported(set))
+			BOOST_CHECK_THROW(kernels::UseInstructionSet(set), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -678,6 +678,43 @@ BOOST_AUTO_TEST_CASE(precision_random_highest)
 }
 
 
+BOOST_AUTO_TEST_CASE(fused_multiply_add)
+{
+	using namespace bertini;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	bertini::complex a("0.3","2.5"), b("-1.25","0.75"), c("4.5","-0.5");
+
+	bertini::complex r(c);
+	MultiplyAdd(r, a, b);
+	BOOST_CHECK(abs(r - (a*b + c)) < threshold_clearance_mp);
+	BOOST_CHECK_EQUAL(Precision(r), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	FusedMultiplyAdd(r, a, b, c);
+	BOOST_CHECK(abs(r.real() - mpfr_float("2.25")) < threshold_clearance_mp);
+	BOOST_CHECK(abs(r.imag() - mpfr_float("-3.4")) < threshold_clearance_mp);
+
+	// the result may be any of the arguments
+	bertini::complex s(a);
+	FusedMultiplyAdd(s, s, s, s);
+	BOOST_CHECK(abs(s - (a*a + a)) < threshold_clearance_mp);
+
+	bertini::complex q(a);
+	q *= q;
+	BOOST_CHECK(abs(q.real() - mpfr_float("-6.16")) < threshold_clearance_mp);
+	BOOST_CHECK(abs(q.imag() - mpfr_float("1.5")) < threshold_clearance_mp);
+	q /= a;
+	BOOST_CHECK(abs(q - a) < threshold_clearance_mp);
+	BOOST_CHECK(abs(a.abs2() - mpfr_float("6.34")) < threshold_clearance_mp);
+
+	Eigen::Matrix<bertini::complex, 2, 2> A, B;
+	A << a, b, c, a;
+	B << c, a, b, c;
+	Eigen::Matrix<bertini::complex, 2, 2> C = A*B;
+	BOOST_CHECK(abs(C(0,0) - (a*c + b*b)) < threshold_clearance_mp);
+	BOOST_CHECK(abs(C(1,1) - (c*a + a*c)) < threshold_clearance_mp);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
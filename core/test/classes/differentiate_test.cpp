@@ -1208,4 +1208,43 @@ BOOST_AUTO_TEST_CASE(integer_power_system)
 	BOOST_CHECK(abs( imag(J(0,0)) - mpfr_float("0.871779788708134710447396396772")) < threshold_clearance_mp);
 }
 
+
+
+/**
+\test \b differentiate_shared_subtrees_once A node reached along many paths is differentiated once, and within a memo the derivative is the same node each time.  Squaring twenty times over has a million paths to x, which would be far too many to differentiate one by one.  The tolerance accounts for the rounding in the million-fold power.
+*/
+BOOST_AUTO_TEST_CASE(differentiate_shared_subtrees_once)
+{
+	using System = bertini::System;
+	bertini::Var x = bertini::node::MakeNode<Variable>("x");
+
+	std::shared_ptr<Node> g = exp(x*x);
+	{
+		bertini::node::DifferentiationMemo memo;
+		BOOST_CHECK(g->Differentiate()==g->Differentiate());
+	}
+	BOOST_CHECK(g->Differentiate()!=g->Differentiate());
+
+	std::shared_ptr<Node> h = x;
+	const int num_squarings = 20;
+	for (int ii = 0; ii < num_squarings; ++ii)
+		h = h*h;
+
+	System sys;
+	sys.AddFunction(h);
+	sys.AddFunction(g*h);
+	sys.AddVariableGroup(bertini::VariableGroup({x}));
+
+	bertini::Vec<dbl> values(1);
+	values << std::polar(1.0, 1e-3);
+	auto J = sys.Jacobian(values);
+
+	const double n = std::pow(2.0, num_squarings);
+	dbl x_n = std::polar(1.0, 1e-3*n), x_nm1 = std::polar(1.0, 1e-3*(n-1));
+	dbl dh = n*x_nm1;
+	dbl dgh = 2.0*values(0)*exp(values(0)*values(0))*x_n + exp(values(0)*values(0))*dh;
+	BOOST_CHECK(abs(J(0,0) - dh) < 1e-8*abs(dh));
+	BOOST_CHECK(abs(J(1,0) - dgh) < 1e-8*abs(dgh));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+//This file is part of Bertini 2.
+//
+//double_double_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//double_double_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with double_double_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file double_double_test.cpp Unit testing for the double-double number types, bertini::dd_real and bertini::dd_complex.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/num_traits.hpp"
+#include "bertini2/eigen_extensions.hpp"
+#include <Eigen/Dense>
+
+#include "externs.hpp"
+
+using mpfr_float = bertini::mpfr_float;
+using dd_real = bertini::dd_real;
+using dd_complex = bertini::dd_complex;
+
+// a little looser than 2^-104, for the few roundings in each operation
+const mpfr_float threshold_clearance_dd("1e-30");
+
+
+BOOST_AUTO_TEST_SUITE(double_double)
+
+
+/**
+\test \b dd_real_arithmetic Sums, products, quotients, and square roots of double-doubles agree with multiple precision to about 32 digits, well beyond double.
+*/
+BOOST_AUTO_TEST_CASE(dd_real_arithmetic)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	dd_real third = dd_real(1) / dd_real(3);
+	mpfr_float third_mp = mpfr_float(1)/3;
+	BOOST_CHECK(abs(third.ToMpfr() - third_mp) < threshold_clearance_dd);
+	BOOST_CHECK(abs(mpfr_float(third.hi()) - third_mp) > mpfr_float("1e-18"));
+
+	dd_real root_two = sqrt(dd_real(2));
+	BOOST_CHECK(abs(root_two.ToMpfr() - sqrt(mpfr_float(2))) < threshold_clearance_dd);
+	BOOST_CHECK(abs((root_two*root_two - 2).ToMpfr()) < threshold_clearance_dd);
+
+	// 1 + 1e-20 is not representable in double
+	dd_real x = dd_real(1) + dd_real(1e-20);
+	BOOST_CHECK(abs((x - 1).ToMpfr() - mpfr_float(1e-20)) < threshold_clearance_dd);
+
+	dd_real y = (third + root_two) * (third - root_two) / root_two;
+	mpfr_float y_mp = (third_mp + sqrt(mpfr_float(2))) * (third_mp - sqrt(mpfr_float(2))) / sqrt(mpfr_float(2));
+	BOOST_CHECK(abs(y.ToMpfr() - y_mp) < threshold_clearance_dd);
+}
+
+
+/**
+\test \b dd_real_conversion Reading a double-double from a string, and rounding from and to multiple precision, keeps about 32 digits.
+*/
+BOOST_AUTO_TEST_CASE(dd_real_conversion)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	mpfr_float pi_mp = boost::math::constants::pi<mpfr_float>();
+	dd_real pi(pi_mp);
+	BOOST_CHECK(abs(pi.ToMpfr() - pi_mp) < threshold_clearance_dd);
+
+	dd_real tenth = bertini::NumTraits<dd_real>::FromString("0.1");
+	BOOST_CHECK(abs(tenth.ToMpfr() - mpfr_float("0.1")) < threshold_clearance_dd);
+
+	BOOST_CHECK(dd_real(1) < dd_real(1) + 1e-20);
+	BOOST_CHECK(-dd_real(2) < dd_real(-1));
+	BOOST_CHECK_EQUAL(bertini::NumTraits<dd_complex>::NumDigits(), bertini::DoubleDoublePrecision());
+}
+
+
+/**
+\test \b dd_complex_arithmetic Complex double-double arithmetic and elementary functions agree with bertini::complex to about 32 digits.
+*/
+BOOST_AUTO_TEST_CASE(dd_complex_arithmetic)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::complex z_mp("0.1","1.2"), w_mp("-2.3","0.7");
+	dd_complex z(z_mp), w(w_mp);
+
+	BOOST_CHECK(abs((z*w).ToMpfr() - z_mp*w_mp) < threshold_clearance_dd);
+	BOOST_CHECK(abs((z/w).ToMpfr() - z_mp/w_mp) < threshold_clearance_dd);
+	BOOST_CHECK(abs((z-w).ToMpfr() - (z_mp-w_mp)) < threshold_clearance_dd);
+	BOOST_CHECK(abs(sqrt(z).ToMpfr() - sqrt(z_mp)) < threshold_clearance_dd);
+	BOOST_CHECK(abs(sqrt(w).ToMpfr() - sqrt(w_mp)) < threshold_clearance_dd);
+	BOOST_CHECK(abs(pow(z,5).ToMpfr() - pow(z_mp,5)) < threshold_clearance_dd);
+	BOOST_CHECK(abs(pow(z,-3).ToMpfr() - pow(z_mp,-3)) < threshold_clearance_dd);
+	BOOST_CHECK(abs(exp(z).ToMpfr() - exp(z_mp)) < threshold_clearance_dd);
+	BOOST_CHECK(abs(log(w).ToMpfr() - log(w_mp)) < threshold_clearance_dd);
+	BOOST_CHECK(abs(abs(w).ToMpfr() - abs(w_mp)) < threshold_clearance_dd);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
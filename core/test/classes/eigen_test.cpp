@@ -530,6 +530,37 @@ BOOST_AUTO_TEST_SUITE(kahan_matrix_solving_LU)
 		BOOST_CHECK_EQUAL(A(0,0).precision(),100);
 	}
 
+	// moving between precisions already visited keeps each entry's limbs, so allocates nothing
+	BOOST_AUTO_TEST_CASE(set_at_precision_in_place)
+	{
+		using bertini::Precision;
+		using data_type = bertini::mpfr;
+		bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+		bertini::Vec<bertini::dbl> d(2);
+		d << bertini::dbl(0.5,-1.25), bertini::dbl(3,4);
+
+		bertini::Vec<data_type> v;
+		bertini::SetAtPrecision(v, d, 96);
+		BOOST_CHECK_EQUAL(v.size(), 2);
+		BOOST_CHECK_EQUAL(Precision(v), 96);
+		BOOST_CHECK(v(0) == data_type("0.5","-1.25"));
+
+		const auto limbs = v(1).real().backend().data()[0]._mpfr_d;
+
+		bertini::SetAtPrecision(v, d, 64);
+		BOOST_CHECK_EQUAL(Precision(v), 64);
+		bertini::SetAtPrecision(v, v, 96);
+		BOOST_CHECK_EQUAL(Precision(v), 96);
+		BOOST_CHECK(v(1) == data_type("3","4"));
+		BOOST_CHECK(v(1).real().backend().data()[0]._mpfr_d == limbs);
+
+		bertini::Vec<data_type> w(2);
+		bertini::SetAtPrecision(w, v, 30);
+		BOOST_CHECK_EQUAL(Precision(w), 30);
+		BOOST_CHECK(abs(w(0) - v(0)) < mpfr_float("1e-28"));
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 	
@@ -1823,6 +1823,99 @@ BOOST_AUTO_TEST_CASE(function_tree_combine_product_of_two_integer_powers)
 
 
 
+BOOST_AUTO_TEST_CASE(pooled_nodes_behave_as_shared)
+{
+	using bertini::node::MakeNode;
+
+	std::weak_ptr<Node> observer;
+	{
+		std::shared_ptr<Variable> x = MakeNode<Variable>("x");
+		std::shared_ptr<Node> N = x*x + MakeNode<Float>("1.5");
+		observer = N;
+
+		// Differentiate relies on shared_from_this, which must work for pooled nodes
+		auto J = std::make_shared<bertini::node::Jacobian>(N->Differentiate());
+
+		x->set_current_value(dbl(2.0,1.0));
+		N->Reset(); J->Reset();
+		BOOST_CHECK(abs(N->Eval<dbl>() - (dbl(2.0,1.0)*dbl(2.0,1.0) + 1.5)) < threshold_clearance_d);
+		BOOST_CHECK(abs(J->EvalJ<dbl>(x) - dbl(4.0,2.0)) < threshold_clearance_d);
+		BOOST_CHECK(!observer.expired());
+	}
+	BOOST_CHECK(observer.expired());
+}
+
+
+
+/**
+\test \b nodes_make_multiple_precision_values_on_first_use Evaluating a tree in double precision alone leaves its nodes without multiple precision values.  The first evaluation in multiple precision makes them, at the precision last set.
+*/
+BOOST_AUTO_TEST_CASE(nodes_make_multiple_precision_values_on_first_use)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	using bertini::node::MakeNode;
+
+	std::shared_ptr<Variable> x = MakeNode<Variable>("x");
+	std::shared_ptr<Variable> y = MakeNode<Variable>("y");
+	std::shared_ptr<Node> sum = x*y + x;
+	std::shared_ptr<Node> f = pow(sum,2);
+
+	x->set_current_value(dbl(2));
+	y->set_current_value(dbl(3));
+	BOOST_CHECK(abs(f->Eval<dbl>() - dbl(64)) < threshold_clearance_d);
+	BOOST_CHECK(!f->HasMultiplePrecisionValue());
+	BOOST_CHECK(!sum->HasMultiplePrecisionValue());
+	BOOST_CHECK(!x->HasMultiplePrecisionValue());
+	BOOST_CHECK_EQUAL(f->precision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	f->precision(50);
+	BOOST_CHECK_EQUAL(f->precision(), 50);
+	BOOST_CHECK(!f->HasMultiplePrecisionValue());
+
+	bertini::DefaultPrecision(50);
+	x->set_current_value(mpfr(2));
+	y->set_current_value(mpfr(3));
+	f->Reset();
+	const mpfr value = f->Eval<mpfr>();
+	BOOST_CHECK(f->HasMultiplePrecisionValue());
+	BOOST_CHECK(sum->HasMultiplePrecisionValue());
+	BOOST_CHECK_EQUAL(f->precision(), 50);
+	BOOST_CHECK(abs(value - mpfr(64)) < threshold_clearance_mp);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+BOOST_AUTO_TEST_CASE(constants_rounded_to_each_precision)
+{
+	using mpfr_float = bertini::mpfr_float;
+
+	auto third = bertini::node::MakeNode<bertini::node::Rational>(mpq_rational(1,3), mpq_rational(0));
+	auto pi = bertini::node::Pi();
+	auto tenth = bertini::node::MakeNode<Float>(std::string("0.1"));
+
+	for (unsigned digits : {30u, 100u, 30u, 100u})
+	{
+		bertini::DefaultPrecision(digits);
+		const mpfr_float tolerance = pow(mpfr_float(10), -int(digits)+2);
+		for (auto const& n : std::vector<std::shared_ptr<Node>>{third, pi, tenth})
+		{
+			n->precision(digits);
+			n->Reset();
+		}
+
+		const mpfr third_value = third->Eval<mpfr>();
+		BOOST_CHECK_EQUAL(third_value.precision(), digits);
+		BOOST_CHECK(abs(third_value.real() - mpfr_float(1)/3) < tolerance);
+		BOOST_CHECK(abs(pi->Eval<mpfr>().real() - acos(mpfr_float(-1))) < tolerance);
+		BOOST_CHECK(abs(tenth->Eval<mpfr>().real() - mpfr_float("0.1")) < tolerance);
+	}
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -487,6 +487,55 @@ BOOST_AUTO_TEST_CASE(not_homogeneous_summands_inhomogeneous)
 }
 
 
+
+// squaring twenty times over makes a million paths to x, so these are computable only if each shared node is visited once
+BOOST_AUTO_TEST_CASE(structural_queries_of_shared_subtrees)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x");
+	Var y = std::make_shared<bertini::node::Variable>("y");
+
+	std::shared_ptr<bertini::node::Node> h = x;
+	const int num_squarings = 20;
+	for (int ii = 0; ii < num_squarings; ++ii)
+		h = h*h;
+
+	BOOST_CHECK_EQUAL(h->Degree(), 1<<num_squarings);
+	BOOST_CHECK_EQUAL(h->Degree(x), 1<<num_squarings);
+	BOOST_CHECK_EQUAL(h->Degree(y), 0);
+	BOOST_CHECK(h->IsHomogeneous());
+	BOOST_CHECK(h->IsPolynomial());
+
+	auto f = h + y;
+	VariableGroup vars{x,y};
+	{
+		bertini::node::StructureMemo memo;
+		BOOST_CHECK_EQUAL(f->Degree(vars), 1<<num_squarings);
+		BOOST_CHECK_EQUAL(f->Degree(y), 1);
+		BOOST_CHECK(!f->IsHomogeneous(vars));
+		BOOST_CHECK(!f->IsHomogeneous(y));
+		BOOST_CHECK( h->IsHomogeneous(y));
+		BOOST_CHECK(h->IsHomogeneous(vars));
+
+		auto multideg = f->MultiDegree(vars);
+		BOOST_CHECK_EQUAL(multideg.size(), 2);
+		BOOST_CHECK_EQUAL(multideg[0], 1<<num_squarings);
+		BOOST_CHECK_EQUAL(multideg[1], 1);
+	}
+
+	bertini::System sys;
+	sys.AddFunction(h);
+	sys.AddFunction(f);
+	sys.AddVariableGroup(vars);
+
+	auto degs = sys.Degrees();
+	BOOST_CHECK_EQUAL(degs.size(), 2);
+	BOOST_CHECK_EQUAL(degs[0], 1<<num_squarings);
+	BOOST_CHECK_EQUAL(degs[1], 1<<num_squarings);
+	BOOST_CHECK(sys.IsPolynomial());
+	BOOST_CHECK(!sys.IsHomogeneous());
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
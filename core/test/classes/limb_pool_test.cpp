@@ -0,0 +1,76 @@
+//This file is part of Bertini 2.
+//
+//limb_pool_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//limb_pool_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with limb_pool_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file limb_pool_test.cpp Unit testing for the pooled allocator of multiple precision limbs.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/limb_pool.hpp"
+#include "bertini2/num_traits.hpp"
+
+#include "externs.hpp"
+
+using mpfr_float = bertini::mpfr_float;
+
+
+BOOST_AUTO_TEST_SUITE(limb_pool)
+
+
+/**
+\test \b limb_pool_reuses_blocks With the pool installed, repeated complex arithmetic is served mostly from the free lists, and gives the same values as without it.  Numbers made before installing outlive the pool.
+*/
+BOOST_AUTO_TEST_CASE(limb_pool_reuses_blocks)
+{
+	using namespace bertini;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::complex a("0.3","2.5"), b("-1.25","0.75");
+	bertini::complex expected = (a*b + a)/b;
+
+	limb_pool::Install();
+	BOOST_CHECK(limb_pool::IsInstalled());
+	limb_pool::ResetThreadStatistics();
+
+	bertini::complex r;
+	for (int ii = 0; ii < 100; ++ii)
+		r = (a*b + a)/b;
+
+	auto stats = limb_pool::ThreadStatistics();
+	BOOST_CHECK(stats.allocations > 0);
+	BOOST_CHECK(stats.HitRate() > 0.5);
+	BOOST_CHECK(abs(r - expected) < threshold_clearance_mp);
+
+	limb_pool::ReleaseThreadCache();
+	limb_pool::Uninstall();
+	BOOST_CHECK(!limb_pool::IsInstalled());
+
+	// r's limbs came from the pool, and are freed by the system allocator
+	r = a*b;
+	BOOST_CHECK(abs(r - a*b) < threshold_clearance_mp);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
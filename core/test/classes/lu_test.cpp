@@ -0,0 +1,534 @@
+//This file is part of Bertini 2.
+//
+//lu_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//lu_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with lu_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file lu_test.cpp Unit testing for the reusable LU factorization, bertini::PartialPivotLU.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/lu.hpp"
+#include "bertini2/limb_pool.hpp"
+#include "bertini2/tracking/condition_estimate.hpp"
+
+#include "externs.hpp"
+
+using mpfr_float = bertini::mpfr_float;
+using mpfr = bertini::complex;
+using dbl = bertini::dbl;
+template<typename T> using Mat = bertini::Mat<T>;
+template<typename T> using Vec = bertini::Vec<T>;
+
+
+BOOST_AUTO_TEST_SUITE(partial_pivot_lu)
+
+
+/**
+\test \b lu_solves_like_eigen The multiple precision LU solves a system needing row exchanges to working precision, and the double one agrees with Eigen.
+*/
+BOOST_AUTO_TEST_CASE(lu_solves_like_eigen)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Mat<mpfr> A(3,3);
+	A << mpfr("0.0","0.1"), mpfr("2.0"), mpfr("-0.3","1.1"),
+	     mpfr("0.2","-0.7"), mpfr("1.5","0.5"), mpfr("0.9"),
+	     mpfr("-1.2"), mpfr("0.4","0.4"), mpfr("2.1","-0.2");
+	Vec<mpfr> b(3);
+	b << mpfr("1"), mpfr("0","1"), mpfr("0.3","0.3");
+
+	bertini::PartialPivotLU<mpfr> lu(3);
+	lu.Factor(A);
+	BOOST_CHECK(bertini::LUPartialPivotDecompositionSuccessful(lu.MatrixLU())==bertini::MatrixSuccessCode::Success);
+
+	Vec<mpfr> x(3);
+	lu.Solve(x, b);
+	Vec<mpfr> r = A*x - b;
+	BOOST_CHECK(r.norm() < threshold_clearance_mp);
+
+	lu.SolveNegative(x, b);
+	r = A*x + b;
+	BOOST_CHECK(r.norm() < threshold_clearance_mp);
+
+	// a column of a matrix can receive the solution
+	Mat<mpfr> K(3,2);
+	lu.Solve(K.col(1), b);
+	r = A*K.col(1) - b;
+	BOOST_CHECK(r.norm() < threshold_clearance_mp);
+
+	Mat<dbl> A_d(3,3);
+	for (int ii = 0; ii < 3; ++ii)
+		for (int jj = 0; jj < 3; ++jj)
+			A_d(ii,jj) = dbl(A(ii,jj));
+	Vec<dbl> b_d(3);
+	b_d << dbl(1), dbl(0,1), dbl(0.3,0.3);
+
+	bertini::PartialPivotLU<dbl> lu_d(3);
+	lu_d.Factor(A_d);
+	Vec<dbl> x_d(3);
+	lu_d.SolveNegative(x_d, b_d);
+	BOOST_CHECK((x_d + A_d.lu().solve(b_d)).norm() < threshold_clearance_d);
+}
+
+
+/**
+\test \b lu_refactor_without_allocating Once sized and warmed up, factoring and solving at the same precision allocates no limbs, and changing precision keeps working.
+*/
+BOOST_AUTO_TEST_CASE(lu_refactor_without_allocating)
+{
+	using namespace bertini;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	// heavy on the antidiagonal, so that pivoting exchanges rows
+	Mat<mpfr> A(6,6);
+	for (int ii = 0; ii < 6; ++ii)
+		for (int jj = 0; jj < 6; ++jj)
+			A(ii,jj) = mpfr(double(ii*jj % 5) - 1.5, double(ii+2*jj)/4);
+	for (int ii = 0; ii < 6; ++ii)
+		A(ii,5-ii) += mpfr(10);
+
+	Vec<mpfr> b(6), x(6);
+	for (int ii = 0; ii < 6; ++ii)
+		b(ii) = mpfr(double(ii+1), double(-ii));
+
+	PartialPivotLU<mpfr> lu(6);
+	lu.Factor(A);
+	lu.Solve(x, b);
+
+	limb_pool::Install();
+	limb_pool::ResetThreadStatistics();
+
+	lu.Factor(A);
+	lu.SolveNegative(x, b);
+
+	BOOST_CHECK_EQUAL(limb_pool::ThreadStatistics().allocations, std::size_t(0));
+
+	limb_pool::ReleaseThreadCache();
+	limb_pool::Uninstall();
+
+	Vec<mpfr> r = A*x + b;
+	BOOST_CHECK(r.norm() < threshold_clearance_mp);
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS+20);
+	Precision(A, CLASS_TEST_MPFR_DEFAULT_DIGITS+20);
+	Precision(b, CLASS_TEST_MPFR_DEFAULT_DIGITS+20);
+	Precision(x, CLASS_TEST_MPFR_DEFAULT_DIGITS+20);
+	lu.ChangePrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS+20);
+
+	lu.Factor(A);
+	BOOST_CHECK_EQUAL(Precision(lu.MatrixLU()), CLASS_TEST_MPFR_DEFAULT_DIGITS+20);
+	lu.Solve(x, b);
+	r = A*x - b;
+	BOOST_CHECK(r.norm() < threshold_clearance_mp);
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b lu_iterative_refinement Solving an ill-conditioned system with refinement gives a small residual, and agrees with the unrefined solution to within the conditioning.
+*/
+BOOST_AUTO_TEST_CASE(lu_iterative_refinement)
+{
+	using namespace bertini;
+	DefaultPrecision(30);
+
+	// the Hilbert matrix, whose condition number grows exponentially with its size
+	const int n = 10;
+	Mat<mpfr> A(n,n);
+	for (int ii = 0; ii < n; ++ii)
+		for (int jj = 0; jj < n; ++jj)
+			A(ii,jj) = mpfr(1)/mpfr(ii+jj+1);
+	Vec<mpfr> b(n);
+	for (int ii = 0; ii < n; ++ii)
+		b(ii) = mpfr(1);
+
+	PartialPivotLU<mpfr> plain(n), refined(n);
+	refined.RefinementSteps(2);
+	BOOST_CHECK_EQUAL(refined.RefinementSteps(), 2);
+
+	plain.Factor(A);
+	refined.Factor(A);
+
+	Vec<mpfr> x_plain(n), x_refined(n);
+	plain.Solve(x_plain, b);
+	refined.Solve(x_refined, b);
+
+	// residuals formed at higher precision, so that their own rounding does not hide them
+	DefaultPrecision(60);
+	Mat<mpfr> A_hi = A; Precision(A_hi, 60);
+	Vec<mpfr> b_hi = b; Precision(b_hi, 60);
+	Vec<mpfr> xp = x_plain; Precision(xp, 60);
+	Vec<mpfr> xr = x_refined; Precision(xr, 60);
+	mpfr_float residual_plain = (A_hi*xp - b_hi).norm();
+	mpfr_float residual_refined = (A_hi*xr - b_hi).norm();
+
+	BOOST_CHECK(residual_plain < mpfr_float("1e-15"));
+	BOOST_CHECK(residual_refined < mpfr_float("1e-15"));
+	BOOST_CHECK((xr - xp).norm() < mpfr_float("1e-10")*xp.norm());
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b lu_solves_with_adjoint The same factors solve with the conjugate transpose, in both precisions.
+*/
+BOOST_AUTO_TEST_CASE(lu_solves_with_adjoint)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Mat<mpfr> A(3,3);
+	A << mpfr("0.0","0.1"), mpfr("2.0"), mpfr("-0.3","1.1"),
+	     mpfr("0.2","-0.7"), mpfr("1.5","0.5"), mpfr("0.9"),
+	     mpfr("-1.2"), mpfr("0.4","0.4"), mpfr("2.1","-0.2");
+	Vec<mpfr> b(3);
+	b << mpfr("1"), mpfr("0","1"), mpfr("0.3","0.3");
+
+	bertini::PartialPivotLU<mpfr> lu(3);
+	lu.Factor(A);
+
+	Vec<mpfr> x(3);
+	lu.SolveAdjoint(x, b);
+	Vec<mpfr> r = A.adjoint()*x - b;
+	BOOST_CHECK(r.norm() < threshold_clearance_mp);
+
+	Mat<dbl> A_d(3,3);
+	for (int ii = 0; ii < 3; ++ii)
+		for (int jj = 0; jj < 3; ++jj)
+			A_d(ii,jj) = dbl(A(ii,jj));
+	Vec<dbl> b_d(3);
+	for (int ii = 0; ii < 3; ++ii)
+		b_d(ii) = dbl(b(ii));
+
+	bertini::PartialPivotLU<dbl> lu_d(3);
+	lu_d.Factor(A_d);
+	Vec<dbl> x_d(3);
+	lu_d.SolveAdjoint(x_d, b_d);
+	BOOST_CHECK((A_d.adjoint()*x_d - b_d).norm() < threshold_clearance_d);
+}
+
+
+/**
+\test \b lu_fixed_size_kernels_match_eigen For every size up to the largest with a fixed-size kernel, and one past it, the double LU solves as Eigen does, with the adjoint too.  A singular small matrix is reported as such.
+*/
+BOOST_AUTO_TEST_CASE(lu_fixed_size_kernels_match_eigen)
+{
+	using namespace bertini;
+
+	bertini::PartialPivotLU<dbl> lu;
+	for (Eigen::DenseIndex n = 1; n <= detail::MaxSmallLUSize+1; ++n)
+	{
+		Mat<dbl> A = Mat<dbl>::Random(n,n);
+		Vec<dbl> b = Vec<dbl>::Random(n);
+
+		lu.Resize(n);
+		lu.Factor(A);
+		const Eigen::PartialPivLU<Mat<dbl>> eigen_lu(A);
+		BOOST_CHECK(LUPartialPivotDecompositionSuccessful(lu.MatrixLU())==MatrixSuccessCode::Success);
+
+		Vec<dbl> x(n);
+		lu.Solve(x, b);
+		BOOST_CHECK((x - eigen_lu.solve(b)).norm() < threshold_clearance_d);
+
+		lu.SolveAdjoint(x, b);
+		BOOST_CHECK((A.adjoint()*x - b).norm() < threshold_clearance_d);
+	}
+
+	Mat<dbl> S(3,3);
+	S << dbl(1), dbl(2), dbl(3),
+	     dbl(2), dbl(4), dbl(6),
+	     dbl(0,1), dbl(1), dbl(-1);
+	lu.Factor(S);
+	BOOST_CHECK(LUPartialPivotDecompositionSuccessful(lu.MatrixLU())!=MatrixSuccessCode::Success);
+}
+
+
+/**
+\test \b lu_on_a_team_matches_one_thread Factoring a matrix large enough to split among a team of threads gives the same factors, to the bit in multiple precision, and solutions as close as any in double.
+*/
+BOOST_AUTO_TEST_CASE(lu_on_a_team_matches_one_thread)
+{
+	using namespace bertini;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	auto team = std::make_shared<detail::ThreadTeam>(3);
+	const Eigen::DenseIndex n = detail::MinBlockedLUSize + 7;
+
+	Mat<mpfr> A_mp(n,n);
+	for (Eigen::DenseIndex ii = 0; ii < n; ++ii)
+		for (Eigen::DenseIndex jj = 0; jj < n; ++jj)
+			A_mp(ii,jj) = mpfr::RandomUnit();
+
+	PartialPivotLU<mpfr> one(n), split(n);
+	split.UseThreads(team);
+	one.Factor(A_mp);
+	split.Factor(A_mp);
+	BOOST_CHECK(one.MatrixLU()==split.MatrixLU());
+
+	Mat<dbl> A_d = Mat<dbl>::Random(n,n);
+	Vec<dbl> b = Vec<dbl>::Random(n);
+	PartialPivotLU<dbl> lu_d(n);
+	lu_d.UseThreads(team);
+	lu_d.Factor(A_d);
+	BOOST_CHECK(LUPartialPivotDecompositionSuccessful(lu_d.MatrixLU())==MatrixSuccessCode::Success);
+
+	Vec<dbl> x(n);
+	lu_d.Solve(x, b);
+	BOOST_CHECK((A_d*x - b).norm() < 1e-10*b.norm()*A_d.norm());
+	lu_d.SolveAdjoint(x, b);
+	BOOST_CHECK((A_d.adjoint()*x - b).norm() < 1e-10*b.norm()*A_d.norm());
+}
+
+
+/**
+\test \b lu_sparse_path_matches_dense A large tridiagonal matrix with its pattern given is factored sparsely, in double and multiple precision, and solves as the dense factorization does, also on a copy, and for the adjoint.  Small or dense patterns are factored densely.
+*/
+BOOST_AUTO_TEST_CASE(lu_sparse_path_matches_dense)
+{
+	using namespace bertini;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	const unsigned n = detail::MinSparseLUSize + 10;
+	std::vector< std::vector<unsigned> > structure(n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		for (unsigned jj = (ii>0 ? ii-1 : 0); jj <= std::min(ii+1, n-1); ++jj)
+			structure[ii].push_back(jj);
+
+	Mat<dbl> A_d = Mat<dbl>::Zero(n,n);
+	Mat<mpfr> A_mp(n,n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		for (unsigned jj = 0; jj < n; ++jj)
+			A_mp(ii,jj) = mpfr(0);
+	for (unsigned ii = 0; ii < n; ++ii)
+		for (auto jj : structure[ii])
+		{
+			A_d(ii,jj) = dbl(std::sin(ii+2.0*jj), std::cos(3.0*ii-jj)) + (ii==jj ? dbl(0.5) : dbl(0));
+			A_mp(ii,jj) = mpfr(A_d(ii,jj).real(), A_d(ii,jj).imag());
+		}
+
+	Vec<dbl> b_d = Vec<dbl>::Random(n);
+	Vec<mpfr> b_mp(n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		b_mp(ii) = mpfr(b_d(ii).real(), b_d(ii).imag());
+
+	PartialPivotLU<dbl> sparse_d(n);
+	BOOST_CHECK(sparse_d.UseSparsity(structure));
+	sparse_d.Factor(A_d);
+	BOOST_CHECK(sparse_d.DecompositionSuccess()==MatrixSuccessCode::Success);
+	BOOST_CHECK_THROW(sparse_d.MatrixLU(), std::runtime_error);
+	BOOST_CHECK_EQUAL(sparse_d.Size(), static_cast<Eigen::DenseIndex>(n));
+
+	Vec<dbl> x_d(n);
+	sparse_d.Solve(x_d, b_d);
+	BOOST_CHECK((x_d - A_d.partialPivLu().solve(b_d)).norm() < 1e-10*x_d.norm());
+	sparse_d.SolveAdjoint(x_d, b_d);
+	BOOST_CHECK((A_d.adjoint()*x_d - b_d).norm() < 1e-10*b_d.norm()*A_d.norm());
+
+	auto copy_d = sparse_d;
+	copy_d.Factor(A_d);
+	Vec<dbl> y_d(n);
+	copy_d.Solve(y_d, b_d);
+	sparse_d.Solve(x_d, b_d);
+	BOOST_CHECK((x_d - y_d).norm() < 1e-12*x_d.norm());
+
+	PartialPivotLU<mpfr> sparse_mp(n), dense_mp(n);
+	BOOST_CHECK(sparse_mp.UseSparsity(structure));
+	sparse_mp.Factor(A_mp);
+	dense_mp.Factor(A_mp);
+	BOOST_CHECK(sparse_mp.DecompositionSuccess()==MatrixSuccessCode::Success);
+	BOOST_CHECK_EQUAL(sparse_mp.FactoredPrecision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Vec<mpfr> x_mp(n), y_mp(n);
+	sparse_mp.Solve(x_mp, b_mp);
+	dense_mp.Solve(y_mp, b_mp);
+	BOOST_CHECK((x_mp - y_mp).norm() < threshold_clearance_mp*x_mp.norm());
+	sparse_mp.SolveNegative(y_mp, b_mp);
+	BOOST_CHECK((x_mp + y_mp).norm() < threshold_clearance_mp*x_mp.norm());
+
+	// a singular matrix with the pattern fails
+	Mat<dbl> S_d = A_d;
+	S_d.row(3).setZero();
+	sparse_d.Factor(S_d);
+	BOOST_CHECK(sparse_d.DecompositionSuccess()!=MatrixSuccessCode::Success);
+
+	// too small, or too dense, and it stays dense
+	PartialPivotLU<dbl> small(4);
+	BOOST_CHECK(!small.UseSparsity(std::vector< std::vector<unsigned> >(4, {0,1,2,3})));
+	std::vector< std::vector<unsigned> > dense(n);
+	for (auto& row : dense)
+		for (unsigned jj = 0; jj < n; ++jj)
+			row.push_back(jj);
+	BOOST_CHECK(!sparse_d.UseSparsity(dense));
+	sparse_d.Factor(A_d);
+	BOOST_CHECK(LUPartialPivotDecompositionSuccessful(sparse_d.MatrixLU())==MatrixSuccessCode::Success);
+}
+
+
+/**
+\test \b lu_banded_path_matches_dense A matrix too small for the sparse factorization, banded with its rows and columns scrambled, is factored in the band of its reverse Cuthill-McKee order, in double and multiple precision, and solves as the dense factorization does, in the original order, also for the adjoint.  A wide band stays dense.
+*/
+BOOST_AUTO_TEST_CASE(lu_banded_path_matches_dense)
+{
+	using namespace bertini;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	const unsigned n = 100;
+	std::vector<unsigned> scramble(n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		scramble[ii] = (37*ii) % n;
+
+	// two subdiagonals and one superdiagonal, before scrambling
+	std::vector< std::vector<unsigned> > structure(n);
+	Mat<dbl> A_d = Mat<dbl>::Zero(n,n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		for (unsigned jj = (ii>1 ? ii-2 : 0); jj <= std::min(ii+1, n-1); ++jj)
+		{
+			structure[scramble[ii]].push_back(scramble[jj]);
+			A_d(scramble[ii],scramble[jj]) = dbl(std::sin(ii+2.0*jj), std::cos(3.0*ii-jj));
+		}
+	for (auto& row : structure)
+		std::sort(row.begin(), row.end());
+
+	BOOST_CHECK(detail::StructuredLUPays(structure));
+	const auto widths = detail::Bandwidths(structure, detail::ReverseCuthillMcKee(structure));
+	BOOST_CHECK(widths.first + widths.second <= 4);
+
+	Mat<mpfr> A_mp(n,n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		for (unsigned jj = 0; jj < n; ++jj)
+			A_mp(ii,jj) = mpfr(A_d(ii,jj).real(), A_d(ii,jj).imag());
+
+	Vec<dbl> b_d = Vec<dbl>::Random(n);
+	Vec<mpfr> b_mp(n);
+	for (unsigned ii = 0; ii < n; ++ii)
+		b_mp(ii) = mpfr(b_d(ii).real(), b_d(ii).imag());
+
+	PartialPivotLU<dbl> banded_d(n);
+	BOOST_CHECK(banded_d.UseSparsity(structure));
+	banded_d.Factor(A_d);
+	BOOST_CHECK(banded_d.DecompositionSuccess()==MatrixSuccessCode::Success);
+	BOOST_CHECK_THROW(banded_d.MatrixLU(), std::runtime_error);
+	BOOST_CHECK_EQUAL(banded_d.Size(), static_cast<Eigen::DenseIndex>(n));
+
+	Vec<dbl> x_d(n);
+	banded_d.Solve(x_d, b_d);
+	BOOST_CHECK((x_d - A_d.partialPivLu().solve(b_d)).norm() < 1e-10*x_d.norm());
+	banded_d.SolveAdjoint(x_d, b_d);
+	BOOST_CHECK((A_d.adjoint()*x_d - b_d).norm() < 1e-10*b_d.norm()*A_d.norm());
+
+	PartialPivotLU<mpfr> banded_mp(n), dense_mp(n);
+	BOOST_CHECK(banded_mp.UseSparsity(structure));
+	banded_mp.Factor(A_mp);
+	dense_mp.Factor(A_mp);
+	BOOST_CHECK(banded_mp.DecompositionSuccess()==MatrixSuccessCode::Success);
+	BOOST_CHECK_EQUAL(banded_mp.FactoredPrecision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Vec<mpfr> x_mp(n), y_mp(n);
+	banded_mp.Solve(x_mp, b_mp);
+	dense_mp.Solve(y_mp, b_mp);
+	BOOST_CHECK((x_mp - y_mp).norm() < threshold_clearance_mp*x_mp.norm());
+	banded_mp.SolveAdjoint(x_mp, b_mp);
+	dense_mp.SolveAdjoint(y_mp, b_mp);
+	BOOST_CHECK((x_mp - y_mp).norm() < threshold_clearance_mp*x_mp.norm());
+
+	// a singular matrix with the pattern fails
+	Mat<dbl> S_d = A_d;
+	S_d.row(3).setZero();
+	banded_d.Factor(S_d);
+	BOOST_CHECK(banded_d.DecompositionSuccess()!=MatrixSuccessCode::Success);
+
+	// an arrow, whose dense row and column no ordering narrows, stays dense
+	std::vector< std::vector<unsigned> > arrow(n);
+	for (unsigned ii = 0; ii < n; ++ii)
+	{
+		arrow[ii].push_back(0);
+		if (ii>0)
+			arrow[ii].push_back(ii);
+	}
+	for (unsigned jj = 1; jj < n; ++jj)
+		arrow[0].push_back(jj);
+	BOOST_CHECK(!detail::StructuredLUPays(arrow));
+	BOOST_CHECK(!banded_d.UseSparsity(arrow));
+	banded_d.Factor(A_d);
+	BOOST_CHECK(LUPartialPivotDecompositionSuccessful(banded_d.MatrixLU())==MatrixSuccessCode::Success);
+}
+
+
+/**
+\test \b hager_estimates_norm_of_inverse The Hager estimate of the 1-norm of the inverse is exact for a diagonal matrix, is never more than the true norm, and is close to it for a general one.  A stable estimate is reused as many times as asked.
+*/
+BOOST_AUTO_TEST_CASE(hager_estimates_norm_of_inverse)
+{
+	using namespace bertini;
+	using bertini::tracking::NormInverseEstimator;
+	using bertini::tracking::config::NormInverseEstimate;
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Mat<mpfr> D = Mat<mpfr>::Zero(3,3);
+	D(0,0) = mpfr(1); D(1,1) = mpfr("0.001"); D(2,2) = mpfr(2);
+	PartialPivotLU<mpfr> lu(3);
+	lu.Factor(D);
+
+	NormInverseEstimator<mpfr> estimator;
+	BOOST_CHECK(abs(estimator.Estimate(lu, NormInverseEstimate::Hager) - mpfr_float(1000)) < threshold_clearance_mp*1000);
+
+	Mat<mpfr> A(3,3);
+	A << mpfr("0.0","0.1"), mpfr("2.0"), mpfr("-0.3","1.1"),
+	     mpfr("0.2","-0.7"), mpfr("1.5","0.5"), mpfr("0.9"),
+	     mpfr("-1.2"), mpfr("0.4","0.4"), mpfr("2.1","-0.2");
+	lu.Factor(A);
+
+	Mat<mpfr> A_inverse(3,3);
+	for (int jj = 0; jj < 3; ++jj)
+	{
+		Vec<mpfr> e = Vec<mpfr>::Zero(3);
+		e(jj) = mpfr(1);
+		lu.Solve(A_inverse.col(jj), e);
+	}
+	mpfr_float exact(0);
+	for (int jj = 0; jj < 3; ++jj)
+	{
+		mpfr_float column_sum(0);
+		for (int ii = 0; ii < 3; ++ii)
+			column_sum += abs(A_inverse(ii,jj));
+		if (column_sum > exact)
+			exact = column_sum;
+	}
+
+	estimator.Reset();
+	mpfr_float estimate = estimator.Estimate(lu, NormInverseEstimate::Hager, 3);
+	BOOST_CHECK(estimate <= exact*(1+threshold_clearance_mp));
+	BOOST_CHECK(estimate >= exact/3);
+
+	// a second agreeing estimate makes it stable, after which it is reused twice before the next
+	BOOST_CHECK(abs(estimator.Estimate(lu, NormInverseEstimate::Hager, 3) - estimate) < threshold_clearance_mp*exact);
+	lu.Factor(D);
+	BOOST_CHECK(estimator.Estimate(lu, NormInverseEstimate::Hager, 3) < 2*exact);
+	BOOST_CHECK(estimator.Estimate(lu, NormInverseEstimate::Hager, 3) < 2*exact);
+	BOOST_CHECK(estimator.Estimate(lu, NormInverseEstimate::Hager, 3) > 500);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
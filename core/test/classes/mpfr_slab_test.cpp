@@ -0,0 +1,157 @@
+//This file is part of Bertini 2.
+//
+//mpfr_slab_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mpfr_slab_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mpfr_slab_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file mpfr_slab_test.cpp Unit testing for the slab vectors and matrices of multiple precision complex numbers, and their kernels.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/mpfr_slab.hpp"
+#include "bertini2/limb_pool.hpp"
+
+#include "externs.hpp"
+
+using mpfr_float = bertini::mpfr_float;
+using mpfr = bertini::mpfr;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+
+namespace slab = bertini::slab;
+
+
+BOOST_AUTO_TEST_SUITE(mpfr_slab)
+
+
+/**
+\test \b slab_kernels_match_eigen Axpy, the dot product, the norms and the matrix-vector product of slab vectors agree with the same operations on Vec<mpfr>.
+*/
+BOOST_AUTO_TEST_CASE(slab_kernels_match_eigen)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	const mpfr_float tol = pow(mpfr_float(10), -int(CLASS_TEST_MPFR_DEFAULT_DIGITS-3));
+
+	Vec<mpfr> x(3), y(3);
+	x << mpfr("0.1","1.2"), mpfr("-2.3","0.7"), mpfr("1.5","-0.4");
+	y << mpfr("0.6","-0.2"), mpfr("1.1","2.5"), mpfr("-0.3","0.9");
+	mpfr a("0.25","-1.5");
+	mpfr_float r("0.75");
+
+	slab::Vector x_s(3), y_s(3);
+	x_s.Assign(x);
+	y_s.Assign(y);
+	BOOST_CHECK_EQUAL(x_s.size(), 3);
+	BOOST_CHECK_EQUAL(x_s.precision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	BOOST_CHECK(abs(slab::Dot(x_s, y_s) - x.dot(y)) < tol);
+	BOOST_CHECK(abs(slab::Norm(x_s) - x.norm()) < tol);
+	BOOST_CHECK(abs(slab::SquaredNorm(x_s) - x.squaredNorm()) < tol);
+	BOOST_CHECK(abs(slab::InfinityNorm(x_s) - abs(x(1))) < tol);
+
+	slab::Axpy(y_s, a, x_s);
+	slab::Axpy(y_s, r, x_s);
+	Vec<mpfr> expected = y + a*x + mpfr(r)*x;
+
+	Vec<mpfr> result;
+	slab::CopyTo(result, y_s);
+	BOOST_CHECK((result - expected).norm() < tol);
+
+	Mat<mpfr> A(2,3);
+	A << mpfr("1","2"), mpfr("-1","0.5"), mpfr("0.3","0"),
+	     mpfr("0","-1"), mpfr("2","2"), mpfr("-0.7","0.1");
+	slab::Matrix A_s(2,3);
+	A_s.Assign(A);
+
+	slab::Vector Ax_s(2);
+	slab::MatVec(Ax_s, A_s, x_s);
+	slab::CopyTo(result, Ax_s);
+	BOOST_CHECK((result - A*x).norm() < tol);
+}
+
+
+/**
+\test \b slab_copies_own_their_limbs A copy of a slab vector has its own limbs, so changing one leaves the other, and a vector made at a precision keeps it.
+*/
+BOOST_AUTO_TEST_CASE(slab_copies_own_their_limbs)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Vec<mpfr> x(2);
+	x << mpfr("1","2"), mpfr("3","4");
+
+	slab::Vector x_s(2);
+	x_s.Assign(x);
+	slab::Vector copy(x_s);
+
+	slab::Axpy(x_s, mpfr_float(1), copy);
+	BOOST_CHECK_EQUAL(copy(1), mpfr("3","4"));
+	BOOST_CHECK_EQUAL(x_s(1), mpfr("6","8"));
+
+	slab::Vector high(2, 2*CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	high.Assign(x);
+	BOOST_CHECK_EQUAL(high.precision(), 2*CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	BOOST_CHECK_EQUAL(high(0).precision(), 2*CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	slab::Vector wrong_size(3);
+	BOOST_CHECK_THROW(slab::Copy(wrong_size, x_s), std::runtime_error);
+}
+
+
+
+/**
+\test \b slab_norms_into_a_number_without_allocating The norms written into a number already at the precision of the vector agree with those returned, and allocate no limbs.
+*/
+BOOST_AUTO_TEST_CASE(slab_norms_into_a_number_without_allocating)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Vec<mpfr> x(3);
+	x << mpfr("0.1","1.2"), mpfr("-2.3","0.7"), mpfr("1.5","-0.4");
+	slab::Vector x_s(3);
+	x_s.Assign(x);
+
+	mpfr_float norm(0), squared_norm(0), infinity_norm(0);
+	slab::InfinityNorm(infinity_norm, x_s);
+
+	bertini::limb_pool::Install();
+	bertini::limb_pool::ResetThreadStatistics();
+
+	slab::Norm(norm, x_s);
+	slab::SquaredNorm(squared_norm, x_s);
+	slab::InfinityNorm(infinity_norm, x_s);
+
+	BOOST_CHECK_EQUAL(bertini::limb_pool::ThreadStatistics().allocations, std::size_t(0));
+
+	bertini::limb_pool::ReleaseThreadCache();
+	bertini::limb_pool::Uninstall();
+
+	BOOST_CHECK_EQUAL(norm, slab::Norm(x_s));
+	BOOST_CHECK_EQUAL(squared_norm, slab::SquaredNorm(x_s));
+	BOOST_CHECK_EQUAL(infinity_norm, slab::InfinityNorm(x_s));
+	BOOST_CHECK_EQUAL(norm.precision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
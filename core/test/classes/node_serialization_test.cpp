@@ -45,10 +45,14 @@
 #include <boost/test/unit_test.hpp>
 
 #include <fstream>
+#include <iterator>
 
 #include "bertini2/function_tree.hpp"
 #include "bertini2/system.hpp"
 #include "bertini2/system_parsing.hpp"
+#include "bertini2/system_cache.hpp"
+
+#include <boost/filesystem/fstream.hpp>
 
 using Variable = bertini::node::Variable;
 using Node = bertini::node::Node;
@@ -207,6 +211,179 @@ BOOST_AUTO_TEST_CASE(system_serialize)
 }
 
 
+/**
+\test \b system_cache_round_trip A parsed, homogenized, and patched system read back from a binary cache evaluates as the original, and a cache made from other text is never used.
+*/
+BOOST_AUTO_TEST_CASE(system_cache_round_trip)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y - 3; f2 = x1*y + x2^2;";
+	const boost::filesystem::path cache_file("serialization_test_system_cache");
+	boost::filesystem::remove(cache_file);
+
+	int num_prepared = 0;
+	auto prepare = [&num_prepared](std::string const& input)
+	{
+		++num_prepared;
+		System sys;
+		std::string::const_iterator iter = input.begin();
+		std::string::const_iterator end = input.end();
+		bertini::SystemParser<std::string::const_iterator> S;
+		phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+		sys.Homogenize();
+		sys.AutoPatch();
+		return sys;
+	};
+
+	System sys1 = bertini::CachedSystem(str, cache_file, prepare);
+	System sys2 = bertini::CachedSystem(str, cache_file, prepare);
+	BOOST_CHECK_EQUAL(num_prepared, 1);
+	BOOST_CHECK(sys2.IsDifferentiated());
+	BOOST_CHECK(sys2.IsPatched());
+
+	Vec<dbl> values(3);
+	values << dbl(1.1,0.2), dbl(0.4,-1.2), dbl(2.1,0.3);
+	Vec<dbl> f1 = sys1.Eval(values), f2 = sys2.Eval(values);
+	Mat<dbl> J1 = sys1.Jacobian(values), J2 = sys2.Jacobian(values);
+	BOOST_CHECK_EQUAL(f2.size(), 3);
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(abs(f1(ii) - f2(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 3; ++jj)
+			BOOST_CHECK(abs(J1(ii,jj) - J2(ii,jj)) < threshold_clearance_d);
+	}
+
+	System sys3;
+	BOOST_CHECK(!bertini::LoadCachedSystem(sys3, str + " ", cache_file));
+	BOOST_CHECK(!bertini::LoadCachedSystem(sys3, str, "no_such_system_cache"));
+	BOOST_CHECK_EQUAL(sys3.NumFunctions(), 0);
+
+	// the file is written aside and renamed into place, leaving nothing else behind
+	for (boost::filesystem::directory_iterator iter("."), end; iter!=end; ++iter)
+	{
+		const auto name = iter->path().filename().string();
+		BOOST_CHECK(name==cache_file.string() || name.find(cache_file.string())!=0);
+	}
+
+	// a file whose hash matches, but whose text does not, as if by a collision, is not used
+	std::string bytes;
+	{
+		boost::filesystem::ifstream fin(cache_file, std::ios::binary);
+		bytes.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+	}
+	const auto text = bytes.find(str);
+	BOOST_REQUIRE(text!=std::string::npos);
+	bytes[text] = 'g';
+	{
+		boost::filesystem::ofstream fout(cache_file, std::ios::binary | std::ios::trunc);
+		fout.write(bytes.data(), bytes.size());
+	}
+	BOOST_CHECK(!bertini::LoadCachedSystem(sys3, str, cache_file));
+	BOOST_CHECK_EQUAL(sys3.NumFunctions(), 0);
+
+	boost::filesystem::remove(cache_file);
+}
+
+
+/**
+\test \b system_bytes_round_trip A patched system written to bytes in the cache format, as for pickling, reads back differentiated and patched, and evaluates as the original.  Bytes not of a system are refused, leaving the system as it was.
+*/
+BOOST_AUTO_TEST_CASE(system_bytes_round_trip)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y - 3; f2 = x1*y + x2^2;";
+	System sys1;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys1);
+	sys1.Homogenize();
+	sys1.AutoPatch();
+
+	const std::string bytes = bertini::SystemToBytes(sys1);
+
+	System sys2;
+	bertini::SystemFromBytes(sys2, bytes.data(), bytes.size());
+	BOOST_CHECK(sys2.IsDifferentiated());
+	BOOST_CHECK(sys2.IsPatched());
+
+	Vec<dbl> values(3);
+	values << dbl(1.1,0.2), dbl(0.4,-1.2), dbl(2.1,0.3);
+	Vec<dbl> f1 = sys1.Eval(values), f2 = sys2.Eval(values);
+	Mat<dbl> J1 = sys1.Jacobian(values), J2 = sys2.Jacobian(values);
+	BOOST_CHECK_EQUAL(f2.size(), 3);
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(abs(f1(ii) - f2(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 3; ++jj)
+			BOOST_CHECK(abs(J1(ii,jj) - J2(ii,jj)) < threshold_clearance_d);
+	}
+
+	std::string garbled = bytes;
+	garbled[0] = 'x';
+	BOOST_CHECK_THROW(bertini::SystemFromBytes(sys2, garbled.data(), garbled.size()), std::runtime_error);
+	BOOST_CHECK_THROW(bertini::SystemFromBytes(sys2, bytes.data(), 10), std::runtime_error);
+	BOOST_CHECK_EQUAL(sys2.NumFunctions(), sys1.NumFunctions());
+}
+
+
+/**
+\test \b system_shared_through_mapped_file A system with a parameter written to a shared file, mapped twice, evaluates as the original through the program in the file, with the copies viewing the same instructions, and a copy of a mapped system evaluating on its own.  Files not of a shared system are refused.
+*/
+BOOST_AUTO_TEST_CASE(system_shared_through_mapped_file)
+{
+	std::string str = "function f1, f2; variable_group x1, x2; y = x1*x2; f1 = y*y - 3.5; f2 = x1*y + x2^2 + sin(x1);";
+	System sys1;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys1);
+	sys1.Homogenize();
+	sys1.AutoPatch();
+
+	auto file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_shared_%%%%-%%%%");
+	bertini::SaveSharedSystem(sys1, file);
+
+	System sys2, sys3;
+	bertini::MapSharedSystem(sys2, file);
+	bertini::MapSharedSystem(sys3, file);
+	BOOST_CHECK(sys2.UsingForwardModeDifferentiation());
+	BOOST_CHECK(!sys2.IsDifferentiated());
+	BOOST_CHECK_EQUAL(sys2.GetForwardModeProgram().NumInstructions(), sys1.GetForwardModeProgram().NumInstructions());
+
+	// the instructions are in the mapping, so are not counted as held
+	BOOST_CHECK(sys2.MemoryReport().Bytes("forward_mode_program/instructions") < sys1.MemoryReport().Bytes("forward_mode_program/instructions"));
+
+	System sys4 = sys3.CloneForThread();
+
+	Vec<dbl> values(3);
+	values << dbl(1.1,0.2), dbl(0.4,-1.2), dbl(2.1,0.3);
+	Vec<dbl> f1 = sys1.Eval(values);
+	Mat<dbl> J1 = sys1.Jacobian(values);
+	for (System const* shared : {&sys2, &sys3, &sys4})
+	{
+		Vec<dbl> f = shared->Eval(values);
+		Mat<dbl> J = shared->Jacobian(values);
+		BOOST_CHECK_EQUAL(f.size(), 3);
+		for (int ii = 0; ii < 3; ++ii)
+		{
+			BOOST_CHECK(abs(f1(ii) - f(ii)) < threshold_clearance_d);
+			for (int jj = 0; jj < 3; ++jj)
+				BOOST_CHECK(abs(J1(ii,jj) - J(ii,jj)) < threshold_clearance_d);
+		}
+	}
+
+	System sys5;
+	BOOST_CHECK_THROW(bertini::MapSharedSystem(sys5, "no_such_shared_system"), std::runtime_error);
+	{
+		boost::filesystem::ofstream garbled(file, std::ios::binary | std::ios::trunc);
+		garbled << "not a shared system, nor long enough to be one, really, is it";
+	}
+	BOOST_CHECK_THROW(bertini::MapSharedSystem(sys5, file), std::runtime_error);
+	BOOST_CHECK_EQUAL(sys5.NumFunctions(), 0);
+
+	boost::filesystem::remove(file);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -169,6 +169,48 @@ BOOST_AUTO_TEST_CASE(patch_jacobian_two_variable_groups_prec30)
 
 
 
+BOOST_AUTO_TEST_CASE(patch_eval_and_jacobian_match_separate_passes)
+{
+	DefaultPrecision(30);
+
+	std::vector<unsigned> s{2,3};
+
+	Patch p(s);
+	p.Precision(30);
+
+	Vec<mpfr> v(5);
+	v << mpfr(1,2),  mpfr(-1),  mpfr(3,1),  mpfr(0,1),  mpfr(2);
+
+	// one row for a function, ahead of the patch rows
+	Vec<mpfr> f(3);
+	Mat<mpfr> J = Mat<mpfr>::Zero(3,5);
+	p.EvalAndJacobianInPlace(f, J, v);
+
+	auto f_separate = p.Eval(v);
+	auto J_separate = p.Jacobian(v);
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK_EQUAL(f(ii+1), f_separate(ii));
+		for (unsigned jj = 0; jj < 5; ++jj)
+			BOOST_CHECK_EQUAL(J(ii+1,jj), J_separate(ii,jj));
+	}
+
+	Vec<dbl> v_d(5);
+	v_d << dbl(1,2),  dbl(-1),  dbl(3,1),  dbl(0,1),  dbl(2);
+	Vec<dbl> f_d(2);
+	Mat<dbl> J_d = Mat<dbl>::Zero(2,5);
+	p.EvalAndJacobianInPlace(f_d, J_d, v_d);
+
+	BOOST_CHECK(abs(f_d(0) - p.Eval(v_d)(0)) < 1e-15);
+	BOOST_CHECK(abs(f_d(1) - p.Eval(v_d)(1)) < 1e-15);
+	BOOST_CHECK_EQUAL(J_d(0,0), p.Coefficients<dbl>(0)(0));
+	BOOST_CHECK_EQUAL(J_d(1,4), p.Coefficients<dbl>(1)(2));
+	BOOST_CHECK_EQUAL(J_d(0,2), dbl(0));
+}
+
+
+
+
 BOOST_AUTO_TEST_CASE(patch_rescale_and_evaluate_prec16)
 {
 	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
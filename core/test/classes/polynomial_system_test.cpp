@@ -0,0 +1,236 @@
+//This file is part of Bertini 2.
+//
+//polynomial_system_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//polynomial_system_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with polynomial_system_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file polynomial_system_test.cpp Unit testing for the bertini::PolynomialSystem class, and its use by bertini::System.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/system.hpp"
+#include "bertini2/system_parsing.hpp"
+#include "bertini2/start_system.hpp"
+
+using System = bertini::System;
+
+using dbl = bertini::dbl;
+using mpfr = bertini::mpfr;
+
+#include "externs.hpp"
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+
+
+BOOST_AUTO_TEST_SUITE(polynomial_system)
+
+
+System ParseSystem(std::string const& str)
+{
+	System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+	return sys;
+}
+
+
+/**
+\class bertini::PolynomialSystem
+\test \b polynomial_matches_tree_double Expand a system with a path variable and a parameter, and check that the functions, Jacobian, and time derivatives, separately and fused, match those from the trees, in double precision.
+*/
+BOOST_AUTO_TEST_CASE(polynomial_matches_tree_double)
+{
+	System sys = ParseSystem("function f1, f2; variable_group x, y; pathvariable t; parameter s; s = t; f1 = (x + 2*y - 1)^3 - t*x*y/3 + 0.5; f2 = x^2*(y - s)^2 + 1.5*x*t - 2;");
+	BOOST_CHECK(sys.HavePolynomialSystem());
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+	dbl time(0.3,0.1);
+
+	Vec<dbl> f_poly = sys.Eval(values, time);
+	Mat<dbl> J_poly = sys.Jacobian(values, time);
+	Vec<dbl> dt_poly = sys.TimeDerivative(values, time);
+
+	Vec<dbl> f_fused(2);
+	Mat<dbl> J_fused(2,2), J_fused_t(2,2);
+	Vec<dbl> dt_fused(2);
+	sys.EvalAndJacobianInPlace(f_fused, J_fused, values, time);
+	sys.JacobianAndTimeDerivativeInPlace(J_fused_t, dt_fused, values, time);
+
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+	Vec<dbl> f_tree = sys.Eval(values, time);
+	Mat<dbl> J_tree = sys.Jacobian(values, time);
+	Vec<dbl> dt_tree = sys.TimeDerivative(values, time);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_poly(ii)) < relaxed_threshold_clearance_d*abs(f_tree(ii)));
+		BOOST_CHECK(abs(f_tree(ii) - f_fused(ii)) < relaxed_threshold_clearance_d*abs(f_tree(ii)));
+		BOOST_CHECK(abs(dt_tree(ii) - dt_poly(ii)) < relaxed_threshold_clearance_d*abs(dt_tree(ii)));
+		BOOST_CHECK(abs(dt_tree(ii) - dt_fused(ii)) < relaxed_threshold_clearance_d*abs(dt_tree(ii)));
+		for (int jj = 0; jj < 2; ++jj)
+		{
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_poly(ii,jj)) < relaxed_threshold_clearance_d*abs(J_tree(ii,jj)));
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_fused(ii,jj)) < relaxed_threshold_clearance_d*abs(J_tree(ii,jj)));
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_fused_t(ii,jj)) < relaxed_threshold_clearance_d*abs(J_tree(ii,jj)));
+		}
+	}
+}
+
+
+/**
+\class bertini::PolynomialSystem
+\test \b polynomial_matches_tree_mpfr Expand a homogenized and patched system with a constant which is not exactly known, and check that the functions and Jacobian match those from the trees, in multiple precision.
+*/
+BOOST_AUTO_TEST_CASE(polynomial_matches_tree_mpfr)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	System sys = ParseSystem("function f1, f2; variable_group x, y; constant c; c = Pi; f1 = c*x^2*y - y^3/7 + 1; f2 = (x - c)*(y + 0.25);");
+	sys.Homogenize();
+	sys.AutoPatch();
+	sys.precision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	BOOST_CHECK(sys.HavePolynomialSystem());
+
+	Vec<mpfr> values(3);
+	values << mpfr("1.1","0.2"), mpfr("0.4","-1.2"), mpfr("2.1","0.3");
+
+	Vec<mpfr> f_poly = sys.Eval(values);
+	Mat<mpfr> J_poly = sys.Jacobian(values);
+
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+	Vec<mpfr> f_tree = sys.Eval(values);
+	Mat<mpfr> J_tree = sys.Jacobian(values);
+
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_poly(ii)) < threshold_clearance_mp);
+		for (int jj = 0; jj < 3; ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_poly(ii,jj)) < threshold_clearance_mp);
+	}
+}
+
+
+/**
+\class bertini::PolynomialSystem
+\test \b polynomial_expansion_collects_terms Like monomials are collected when expanding, and cancelling terms disappear.
+*/
+BOOST_AUTO_TEST_CASE(polynomial_expansion_collects_terms)
+{
+	System sys = ParseSystem("function f1, f2, f3; variable_group x, y; f1 = (x+y)^2 - 2*x*y; f2 = (x-y)*(x+y) + y^2; f3 = x - x;");
+
+	const auto& poly = sys.GetPolynomialSystem();
+	BOOST_CHECK_EQUAL(poly.NumFunctions(), 3);
+	BOOST_CHECK_EQUAL(poly.NumTerms(0), 2);
+	BOOST_CHECK_EQUAL(poly.NumTerms(1), 1);
+	BOOST_CHECK_EQUAL(poly.NumTerms(2), 0);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+	Vec<dbl> f = sys.Eval(values);
+	dbl x = values(0), y = values(1);
+	BOOST_CHECK(abs(f(0) - (x*x + y*y)) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - x*x) < threshold_clearance_d);
+	BOOST_CHECK_EQUAL(f(2), dbl(0));
+}
+
+
+/**
+\class bertini::PolynomialSystem
+\test \b polynomial_homotopy_groups_by_path_variable The terms of a total degree homotopy which differ only in their power of the path variable are grouped under one monomial in the variables, and the functions, Jacobian, and time derivatives still match those from the trees.
+*/
+BOOST_AUTO_TEST_CASE(polynomial_homotopy_groups_by_path_variable)
+{
+	using Variable = bertini::node::Variable;
+	auto x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+
+	System target;
+	target.AddVariableGroup(bertini::VariableGroup{x,y});
+	target.AddFunction(x*y + 2);
+	target.AddFunction(y*y - 3*x);
+
+	bertini::start_system::TotalDegree TD(target);
+
+	System homotopy = (1-t)*target + t*TD;
+	homotopy.AddPathVariable(t);
+	BOOST_CHECK(homotopy.HavePolynomialSystem());
+
+	// x*y and -t*x*y, 2 and t*(-2-r_1), and t*x^2.  y^2 cancels to one term, -3*x and 3*t*x, and -t*r_2
+	const auto& poly = homotopy.GetPolynomialSystem();
+	BOOST_CHECK_EQUAL(poly.NumTerms(0), 5);
+	BOOST_CHECK_EQUAL(poly.NumTerms(1), 4);
+	BOOST_CHECK_EQUAL(poly.NumGroups(), 6);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+	dbl time(0.3,0.1);
+
+	Vec<dbl> f_poly = homotopy.Eval(values, time);
+	Mat<dbl> J_poly(2,2);
+	Vec<dbl> dt_poly(2);
+	homotopy.JacobianAndTimeDerivativeInPlace(J_poly, dt_poly, values, time);
+
+	homotopy.UsePolynomialEvaluation(false);
+	homotopy.UseCompiledEvaluation(false);
+	Vec<dbl> f_tree = homotopy.Eval(values, time);
+	Mat<dbl> J_tree = homotopy.Jacobian(values, time);
+	Vec<dbl> dt_tree = homotopy.TimeDerivative(values, time);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_poly(ii)) < relaxed_threshold_clearance_d*abs(f_tree(ii)));
+		BOOST_CHECK(abs(dt_tree(ii) - dt_poly(ii)) < relaxed_threshold_clearance_d*abs(dt_tree(ii)));
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_poly(ii,jj)) < relaxed_threshold_clearance_d*(1+abs(J_tree(ii,jj))));
+	}
+}
+
+
+/**
+\class bertini::PolynomialSystem
+\test \b non_polynomial_uses_trees Systems with transcendental functions of the variables, division by the variables, or non-integer powers are not expanded, and are evaluated through their trees.
+*/
+BOOST_AUTO_TEST_CASE(non_polynomial_uses_trees)
+{
+	for (const auto& str : {"function f; variable_group x, y; f = sin(x) + y;",
+	                        "function f; variable_group x, y; f = x/y;",
+	                        "function f; variable_group x, y; f = x^0.5 + y;"})
+	{
+		System sys = ParseSystem(str);
+		BOOST_CHECK(!sys.HavePolynomialSystem());
+		BOOST_CHECK_THROW(sys.GetPolynomialSystem(), std::runtime_error);
+
+		Vec<dbl> values(2);
+		values << dbl(0.4,-1.2), dbl(2.1,0.3);
+		BOOST_CHECK_EQUAL(sys.Eval(values).size(), 1);
+	}
+}
+
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,172 @@
+//This file is part of Bertini 2.
+//
+//random_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//random_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with random_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file random_test.cpp Unit testing for the counter-based random streams.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/random.hpp"
+#include "bertini2/num_traits.hpp"
+#include "bertini2/patch.hpp"
+
+#include <thread>
+
+#include "externs.hpp"
+
+using mpfr_float = bertini::mpfr_float;
+using dbl = bertini::dbl;
+
+
+BOOST_AUTO_TEST_SUITE(random_streams)
+
+
+/**
+\test \b stream_draws_are_counter_based A stream draws the same numbers as a copy of it, and as the same stream made anew, skipping ahead lands where drawing does, and different seeds and streams differ.
+*/
+BOOST_AUTO_TEST_CASE(stream_draws_are_counter_based)
+{
+	using bertini::RandomStream;
+
+	RandomStream a(7, 3), b(7, 3), other_stream(7, 4), other_seed(8, 3);
+	std::vector<std::uint64_t> draws;
+	for (int ii = 0; ii < 10; ++ii)
+		draws.push_back(a());
+
+	for (int ii = 0; ii < 10; ++ii)
+	{
+		BOOST_CHECK_EQUAL(b(), draws[ii]);
+		BOOST_CHECK_EQUAL(RandomStream::Draw(7, 3, ii), draws[ii]);
+	}
+
+	BOOST_CHECK(other_stream() != draws[0]);
+	BOOST_CHECK(other_seed() != draws[0]);
+
+	RandomStream c(7, 3);
+	c.Discard(5);
+	BOOST_CHECK_EQUAL(c(), draws[5]);
+	BOOST_CHECK_EQUAL(c.Position(), 6);
+
+	const double u = RandomStream(7, 3).UniformDouble();
+	BOOST_CHECK(u >= 0 && u < 1);
+}
+
+
+/**
+\test \b substreams_and_forks Substreams depend only on the stream, its position and the index, and successive forks differ.
+*/
+BOOST_AUTO_TEST_CASE(substreams_and_forks)
+{
+	using bertini::RandomStream;
+
+	RandomStream a(11, 0);
+	BOOST_CHECK_EQUAL(a.Substream(5)(), a.Substream(5)());
+	BOOST_CHECK(a.Substream(5)() != a.Substream(6)());
+
+	auto first = a.Fork();
+	auto second = a.Fork();
+	BOOST_CHECK(first() != second());
+	BOOST_CHECK_EQUAL(a.Position(), 2);
+}
+
+
+/**
+\test \b seed_reproduces_multiple_precision Setting the seed reproduces random multiple precision numbers, and random patches, at high precision, and the numbers are in [0,1) at the precision asked for.
+*/
+BOOST_AUTO_TEST_CASE(seed_reproduces_multiple_precision)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::SetRandomSeed(12345);
+	mpfr_float x;
+	bertini::RandomMp(x, 1000);
+	const bertini::Patch p({3,2});
+
+	bertini::SetRandomSeed(12345);
+	mpfr_float y;
+	bertini::RandomMp(y, 1000);
+	const bertini::Patch q({3,2});
+
+	BOOST_CHECK_EQUAL(x, y);
+	BOOST_CHECK_EQUAL(x.precision(), 1000);
+	BOOST_CHECK(x >= 0 && x < 1);
+	BOOST_CHECK(p == q);
+
+	mpfr_float z;
+	bertini::RandomMp(z, 1000);
+	BOOST_CHECK(z != x);
+
+	const auto n = bertini::RandomInt<10>();
+	BOOST_CHECK(abs(n) <= (bertini::mpz_int(1) << (10*1000L/301L)));
+
+	bertini::SetRandomSeed(0);
+}
+
+
+/**
+\test \b scoped_streams_are_per_thread A stream put in force by ScopedRandomStream gives the same numbers on any thread, and the stream in force before is restored where it was.
+*/
+BOOST_AUTO_TEST_CASE(scoped_streams_are_per_thread)
+{
+	using bertini::RandomStream;
+	using bertini::ScopedRandomStream;
+
+	const auto paths = bertini::ThreadRandomStream().Fork();
+
+	std::vector<dbl> serial(4), threaded(4);
+	for (int ii = 0; ii < 4; ++ii)
+	{
+		ScopedRandomStream scoped(paths.Substream(ii));
+		serial[ii] = bertini::RandomUnit<dbl>();
+	}
+
+	std::vector<std::thread> threads;
+	for (int ii = 0; ii < 4; ++ii)
+		threads.emplace_back([&, ii]()
+		{
+			ScopedRandomStream scoped(paths.Substream(ii));
+			threaded[ii] = bertini::RandomUnit<dbl>();
+		});
+	for (auto& t : threads)
+		t.join();
+
+	for (int ii = 0; ii < 4; ++ii)
+	{
+		BOOST_CHECK_EQUAL(serial[ii], threaded[ii]);
+		BOOST_CHECK_CLOSE(abs(serial[ii]), 1.0, 1e-12);
+	}
+	BOOST_CHECK(serial[0] != serial[1]);
+
+	const auto before = bertini::ThreadRandomStream().Position();
+	{
+		ScopedRandomStream scoped(RandomStream(1, 2));
+		bertini::ThreadRandomStream()();
+		BOOST_CHECK_EQUAL(bertini::ThreadRandomStream().Stream(), 2);
+	}
+	BOOST_CHECK_EQUAL(bertini::ThreadRandomStream().Position(), before);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
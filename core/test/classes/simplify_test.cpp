@@ -0,0 +1,265 @@
+//This file is part of Bertini 2.
+//
+//simplify_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//simplify_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with simplify_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file simplify_test.cpp Unit testing for the passes which simplify function trees.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/function_tree/simplify.hpp"
+#include "bertini2/system.hpp"
+#include "bertini2/system_parsing.hpp"
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+using Node = bertini::node::Node;
+
+using dbl = bertini::dbl;
+using mpfr = bertini::mpfr;
+using mpq_rational = bertini::mpq_rational;
+
+#include "externs.hpp"
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+
+
+BOOST_AUTO_TEST_SUITE(simplify)
+
+
+System ParseSystem(std::string const& str)
+{
+	System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+	return sys;
+}
+
+
+/**
+\test \b cse_merges_repeated_subtrees Two separately made copies of x^2*y, in two different trees, are merged into one node, and the values of the trees are unchanged.
+*/
+BOOST_AUTO_TEST_CASE(cse_merges_repeated_subtrees)
+{
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+
+	std::shared_ptr<Node> f = pow(x,2)*y + x;
+	std::shared_ptr<Node> g = sin(pow(x,2)*y) - y;
+
+	x->set_current_value(dbl(0.3,-0.7));
+	y->set_current_value(dbl(-1.1,0.2));
+	dbl f_before = f->Eval<dbl>();
+	dbl g_before = g->Eval<dbl>();
+
+	// pow, then the product, in g
+	BOOST_CHECK_EQUAL(bertini::node::EliminateCommonSubexpressions({f,g}), 2);
+
+	f->Reset(); g->Reset();
+	BOOST_CHECK(abs(f->Eval<dbl>() - f_before) < threshold_clearance_d);
+	BOOST_CHECK(abs(g->Eval<dbl>() - g_before) < threshold_clearance_d);
+
+	// doing it again finds nothing new
+	BOOST_CHECK_EQUAL(bertini::node::EliminateCommonSubexpressions({f,g}), 0);
+}
+
+
+/**
+\test \b cse_respects_structure Subtrees differing in an operation, exponent, or operand order are not merged.
+*/
+BOOST_AUTO_TEST_CASE(cse_respects_structure)
+{
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+
+	std::shared_ptr<Node> f = pow(x,2) + pow(x,3) + x*y + y*x + x/y + cos(x) + sin(x);
+
+	BOOST_CHECK_EQUAL(bertini::node::EliminateCommonSubexpressions({f}), 0);
+}
+
+
+/**
+\test \b cse_system_jacobian_unchanged Differentiating a system merges the repeated subtrees of its Jacobian, and the evaluated functions and Jacobian are still correct.
+*/
+BOOST_AUTO_TEST_CASE(cse_system_jacobian_unchanged)
+{
+	std::string str = "function f1, f2; variable_group x, y; f1 = x^3*y^2 + x^3 - y^2; f2 = (x*y)^2 - x^3*y;";
+	System sys = ParseSystem(str);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+
+	Mat<dbl> J = sys.Jacobian(values);
+	Vec<dbl> f = sys.Eval(values);
+
+	// the exact Jacobian
+	dbl x = values(0), y = values(1);
+	Mat<dbl> J_exact(2,2);
+	J_exact << 3.0*x*x*y*y + 3.0*x*x, 2.0*x*x*x*y - 2.0*y,
+	           2.0*x*y*y - 3.0*x*x*y, 2.0*x*x*y - x*x*x;
+
+	BOOST_CHECK(abs(f(0) - (x*x*x*y*y + x*x*x - y*y)) < relaxed_threshold_clearance_d*abs(f(0)));
+	BOOST_CHECK(abs(f(1) - (x*x*y*y - x*x*x*y)) < relaxed_threshold_clearance_d*abs(f(1)));
+	for (int ii = 0; ii < 2; ++ii)
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J(ii,jj) - J_exact(ii,jj)) < relaxed_threshold_clearance_d*abs(J_exact(ii,jj)));
+}
+
+
+/**
+\test \b simplify_drops_identities Terms which are 0, factors which are 1, and double negations are removed, and constants are folded exactly.
+*/
+BOOST_AUTO_TEST_CASE(simplify_drops_identities)
+{
+	using namespace bertini::node;
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+
+	// (x*1 + 0) is x
+	std::shared_ptr<Node> f = std::make_shared<SumOperator>(std::make_shared<MultOperator>(x, std::make_shared<Integer>(1)), std::make_shared<Integer>(0));
+	// 0*y is 0, and -(-(2*(3/4))) is 3/2, a Rational
+	std::shared_ptr<Node> g = std::make_shared<MultOperator>(std::make_shared<Integer>(0), y);
+	std::shared_ptr<Node> h = std::make_shared<NegateOperator>(std::make_shared<NegateOperator>(std::make_shared<MultOperator>(std::make_shared<Integer>(2), std::make_shared<Rational>(mpq_rational(3,4)))));
+	// 2.0 - 2 is 0
+	std::shared_ptr<Node> k = std::make_shared<SumOperator>(std::make_shared<Float>("2.0"), true, std::make_shared<Integer>(2), false);
+
+	std::vector<std::shared_ptr<Node> > roots{f,g,h,k};
+	BOOST_CHECK(bertini::node::Simplify(roots) > 0);
+
+	BOOST_CHECK(roots[0]==x);
+	BOOST_CHECK(std::dynamic_pointer_cast<Integer>(roots[1]));
+	BOOST_CHECK_EQUAL(roots[1]->Eval<dbl>(), dbl(0));
+	BOOST_CHECK(std::dynamic_pointer_cast<Rational>(roots[2]));
+	BOOST_CHECK_EQUAL(roots[2]->Eval<dbl>(), dbl(1.5));
+	BOOST_CHECK(std::dynamic_pointer_cast<Integer>(roots[3]));
+	BOOST_CHECK_EQUAL(roots[3]->Eval<dbl>(), dbl(0));
+}
+
+
+/**
+\test \b simplify_powers Powers with exponent 0 or 1 are removed, integer exponents become IntegerPowerOperators, and powers of powers are combined.  The values of the trees are unchanged.
+*/
+BOOST_AUTO_TEST_CASE(simplify_powers)
+{
+	using namespace bertini::node;
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+
+	std::shared_ptr<Node> f = std::make_shared<PowerOperator>(x, std::make_shared<SumOperator>(std::make_shared<Integer>(2), true, std::make_shared<Float>("1.0"), false));
+	std::shared_ptr<Node> g = std::make_shared<PowerOperator>(std::make_shared<IntegerPowerOperator>(x,2), std::make_shared<Integer>(3));
+	std::shared_ptr<Node> h = std::make_shared<IntegerPowerOperator>(sin(x), 0);
+	std::shared_ptr<Node> k = std::make_shared<PowerOperator>(x, std::make_shared<Rational>(mpq_rational(1,2)));
+
+	x->set_current_value(dbl(0.3,-0.7));
+	dbl g_before = g->Eval<dbl>();
+	dbl k_before = k->Eval<dbl>();
+
+	std::vector<std::shared_ptr<Node> > roots{f,g,h,k};
+	bertini::node::Simplify(roots);
+
+	BOOST_CHECK(roots[0]==x);
+	auto g_simplified = std::dynamic_pointer_cast<IntegerPowerOperator>(roots[1]);
+	BOOST_CHECK(g_simplified);
+	if (g_simplified)
+		BOOST_CHECK_EQUAL(g_simplified->exponent(), 6);
+	BOOST_CHECK_EQUAL(roots[2]->Eval<dbl>(), dbl(1));
+	BOOST_CHECK(roots[3]==k);
+
+	roots[1]->Reset(); roots[3]->Reset();
+	BOOST_CHECK(abs(roots[1]->Eval<dbl>() - g_before) < threshold_clearance_d);
+	BOOST_CHECK(abs(roots[3]->Eval<dbl>() - k_before) < threshold_clearance_d);
+}
+
+
+/**
+\test \b simplify_system_jacobian_unchanged Differentiating a system with constants, parameters, and quotients simplifies its Jacobian, and the evaluated Jacobian and time derivative are still correct.
+*/
+BOOST_AUTO_TEST_CASE(simplify_system_jacobian_unchanged)
+{
+	std::string str = "function f1, f2; variable_group x, y; pathvariable t; parameter s; s = 2*t; f1 = 3*x^2*y/2 + 0.5*s*x - 1; f2 = y^3 - x/y + s;";
+	System sys = ParseSystem(str);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+	dbl time(0.3,0.1);
+
+	Mat<dbl> J = sys.Jacobian(values, time);
+	Vec<dbl> dt = sys.TimeDerivative(values, time);
+
+	dbl x = values(0), y = values(1), s = 2.0*time;
+	Mat<dbl> J_exact(2,2);
+	J_exact << 3.0*x*y + 0.5*s, 1.5*x*x,
+	           -1.0/y, 3.0*y*y + x/(y*y);
+
+	for (int ii = 0; ii < 2; ++ii)
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J(ii,jj) - J_exact(ii,jj)) < relaxed_threshold_clearance_d*abs(J_exact(ii,jj)));
+
+	BOOST_CHECK(abs(dt(0) - x) < relaxed_threshold_clearance_d*abs(x));
+	BOOST_CHECK(abs(dt(1) - dbl(2)) < relaxed_threshold_clearance_d);
+}
+
+
+
+
+/**
+\test \b substitute_differentials_gives_directional_derivative Putting numbers in place of the differentials in the derivative of x^2*y + sin(x) gives its derivative in that direction, and the differential of a variable not given one is zero.
+*/
+BOOST_AUTO_TEST_CASE(substitute_differentials_gives_directional_derivative)
+{
+	using bertini::node::MakeNode;
+	using bertini::node::Rational;
+
+	std::shared_ptr<Variable> x = std::make_shared<Variable>("x");
+	std::shared_ptr<Variable> y = std::make_shared<Variable>("y");
+	std::shared_ptr<Variable> z = std::make_shared<Variable>("z");
+
+	std::shared_ptr<Node> f = pow(x,2)*y + sin(x) + z;
+	std::vector< std::shared_ptr<Node> > roots{f->Differentiate()};
+
+	std::map< const Variable*, std::shared_ptr<Node> > directions;
+	directions[x.get()] = MakeNode<Rational>(mpq_rational(2,1), mpq_rational(1,1));
+	directions[y.get()] = MakeNode<Rational>(mpq_rational(-1,1), 0);
+
+	BOOST_CHECK(bertini::node::SubstituteDifferentials(roots, directions) > 0);
+
+	dbl x_val(0.3,-0.7), y_val(-1.1,0.2);
+	x->set_current_value(x_val);
+	y->set_current_value(y_val);
+	z->set_current_value(dbl(0.5,0.5));
+
+	dbl exact = (2.0*x_val*y_val + cos(x_val))*dbl(2,1) - x_val*x_val;
+	roots[0]->Reset();
+	BOOST_CHECK(abs(roots[0]->Eval<dbl>() - exact) < relaxed_threshold_clearance_d);
+
+	// the function itself is not changed
+	f->Reset();
+	BOOST_CHECK(abs(f->Eval<dbl>() - (x_val*x_val*y_val + sin(x_val) + dbl(0.5,0.5))) < threshold_clearance_d);
+}
+
+
+
+BOOST_AUTO_TEST_SUITE_END()
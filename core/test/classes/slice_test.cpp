@@ -84,5 +84,69 @@ BOOST_AUTO_TEST_CASE(slice_basic_real)
 }
 
 
+BOOST_AUTO_TEST_CASE(slice_batch_eval_matches_single_points)
+{
+	DefaultPrecision(30);
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	VariableGroup vars{x,y,z};
+
+	auto s = LinearSlice::RandomComplex(vars,2);
+
+	Mat<mpfr> points(3,4);
+	for (int ii = 0; ii < 3; ++ii)
+		for (int jj = 0; jj < 4; ++jj)
+			points(ii,jj) = mpfr(ii+1, jj-2);
+
+	auto values = s.EvalBatch(points);
+	BOOST_CHECK_EQUAL(values.rows(), 2);
+	BOOST_CHECK_EQUAL(values.cols(), 4);
+	for (int jj = 0; jj < 4; ++jj)
+	{
+		Vec<mpfr> point = points.col(jj);
+		auto single = s.Eval(point);
+		BOOST_CHECK(abs(values(0,jj) - single(0)) < mpfr_float("1e-25"));
+		BOOST_CHECK(abs(values(1,jj) - single(1)) < mpfr_float("1e-25"));
+	}
+
+	Mat<dbl> points_d(3,2);
+	points_d << dbl(1,0), dbl(0,1),
+	            dbl(2,0), dbl(1,1),
+	            dbl(3,0), dbl(-1,0);
+	auto values_d = s.EvalBatch(points_d);
+	Vec<dbl> point_d = points_d.col(1);
+	BOOST_CHECK(abs(values_d(1,1) - s.Eval(point_d)(1)) < 1e-14);
+}
+
+
+BOOST_AUTO_TEST_CASE(slice_pass_through_point)
+{
+	DefaultPrecision(30);
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	VariableGroup vars{x,y,z};
+
+	auto s = LinearSlice::RandomComplex(vars,2);
+	auto coefficients = s.Coefficients<mpfr>();
+
+	Vec<mpfr> p(3);
+	p << mpfr("0.5","1"), mpfr(2), mpfr("-1","0.25");
+	s.PassThrough(p);
+
+	auto v = s.Eval(p);
+	BOOST_CHECK(abs(v(0)) < mpfr_float("1e-25"));
+	BOOST_CHECK(abs(v(1)) < mpfr_float("1e-25"));
+	BOOST_CHECK(s.Coefficients<mpfr>()==coefficients);
+
+	Vec<dbl> p_d(3);
+	p_d << dbl(0.5,1), dbl(2,0), dbl(-1,0.25);
+	BOOST_CHECK(s.Eval(p_d).norm() < 1e-14);
+
+	auto h = LinearSlice::RandomComplex(vars,2,true);
+	BOOST_CHECK(h.IsHomogeneous());
+	BOOST_CHECK_THROW(h.PassThrough(p), std::runtime_error);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
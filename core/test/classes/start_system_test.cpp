@@ -28,6 +28,9 @@
 
 
 #include "bertini2/start_system.hpp"
+#include "bertini2/tracking/endpoint_file.hpp"
+
+#include <boost/filesystem/fstream.hpp>
 
 using System = bertini::System;
 
@@ -309,6 +312,50 @@ BOOST_AUTO_TEST_CASE(quadratic_cubic_quartic_start_points)
 
 
 
+/**
+\test \b total_degree_start_point_iterator Walking the start points in order gives those of StartPoint, index by index, in double and multiple precision, also from the middle.
+*/
+BOOST_AUTO_TEST_CASE(total_degree_start_point_iterator)
+{
+	bertini::System sys;
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddFunction(y+x*y + mpfr_float("0.5"));
+	sys.AddFunction(pow(x,3)+x*y+bertini::node::E());
+	sys.AddFunction(pow(x,2)*pow(y,2)+x*y*z*z - 1);
+
+	bertini::start_system::TotalDegree TD(sys);
+
+	mpz_int num_visited = 0;
+	for (auto iter = TD.StartPoints<dbl>(); !iter.AtEnd(); ++iter)
+	{
+		BOOST_CHECK_EQUAL(iter.Index(), num_visited);
+		BOOST_CHECK(((*iter) - TD.StartPoint<dbl>(iter.Index())).norm() < relaxed_threshold_clearance_d);
+		++num_visited;
+	}
+	BOOST_CHECK_EQUAL(num_visited, TD.NumStartPoints());
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	num_visited = 7;
+	for (auto iter = TD.StartPoints<mpfr>(7); !iter.AtEnd(); ++iter)
+	{
+		BOOST_CHECK_EQUAL(iter.Index(), num_visited);
+		BOOST_CHECK(((*iter) - TD.StartPoint<mpfr>(iter.Index())).norm() < threshold_clearance_mp);
+
+		auto function_values = TD.Eval(*iter);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+		++num_visited;
+	}
+	BOOST_CHECK_EQUAL(num_visited, TD.NumStartPoints());
+
+	BOOST_CHECK(TD.StartPoints<dbl>(TD.NumStartPoints()).AtEnd());
+}
+
+
+
 BOOST_AUTO_TEST_CASE(quadratic_cubic_quartic_all_the_way_to_final_system)
 {
 	bertini::System sys;
@@ -417,6 +464,264 @@ BOOST_AUTO_TEST_CASE(total_degree_start_system_coefficient_bound_degree_bound)
 
 
 
+/**
+\test \b mhom_start_system_bilinear Two bilinear functions of x and y, in separate groups, have multihomogeneous Bezout number 2, rather than total degree 4, and the start points solve the start system, in double and multiple precision.
+*/
+BOOST_AUTO_TEST_CASE(mhom_start_system_bilinear)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	bertini::System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddVariableGroup(VariableGroup{y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x*y + 2*x - 3*y + 1);
+
+	bertini::start_system::MHomogeneous MH(sys);
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 2);
+	BOOST_CHECK_EQUAL(MH.Degree(1,0), 1);
+	BOOST_CHECK_EQUAL(MH.Degree(1,1), 1);
+
+	std::vector< Vec<dbl> > starts;
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto start = MH.StartPoint<dbl>(ii);
+		auto function_values = MH.Eval(start);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+		starts.push_back(start);
+	}
+	BOOST_CHECK((starts[0] - starts[1]).norm() > 1e-5);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto function_values = MH.Eval(MH.StartPoint<mpfr>(ii));
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+	}
+
+	BOOST_CHECK_THROW(MH.StartPoint<dbl>(2), std::out_of_range);
+}
+
+
+/**
+\test \b mhom_start_system_homogenized_patched A homogenized and patched system in a group of two variables and a group of one, each function of degree 1 in the first and 2 in the second.  The start points solve the functions and the patches.  With all the variables in one group, the number of start points is the total degree.
+*/
+BOOST_AUTO_TEST_CASE(mhom_start_system_homogenized_patched)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	bertini::System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddVariableGroup(VariableGroup{z});
+	sys.AddFunction(x*z*z - y + 1);
+	sys.AddFunction(y*z*z + x*z - 2);
+	sys.AddFunction((x+y)*z*z - 3*z + 1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	// one of the three functions picks the group of z, in one of its two factors
+	bertini::start_system::MHomogeneous MH(sys);
+	BOOST_CHECK_EQUAL(MH.NumStartPoints(), 6);
+	BOOST_CHECK_EQUAL(MH.NumVariables(), 5);
+
+	for (mpz_int ii = 0; ii < MH.NumStartPoints(); ++ii)
+	{
+		auto function_values = MH.Eval(MH.StartPoint<dbl>(ii));
+		BOOST_CHECK_EQUAL(function_values.size(), 5);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+	}
+
+	bertini::System one_group;
+	one_group.AddVariableGroup(VariableGroup{x,y,z});
+	one_group.AddFunction(x*z*z - y + 1);
+	one_group.AddFunction(y*z*z + x*z - 2);
+	one_group.AddFunction((x+y)*z*z - 3*z + 1);
+	BOOST_CHECK_EQUAL(bertini::start_system::MHomogeneous(one_group).NumStartPoints(), bertini::start_system::TotalDegree(one_group).NumStartPoints());
+}
+
+
+
+/**
+\test \b polyhedral_start_system_sparse The functions x*y - 1 and x^2*y^2 + x - 3*y + 1 have total degree 8, but mixed volume 2.  The start points solve the start system, in double and multiple precision.
+*/
+BOOST_AUTO_TEST_CASE(polyhedral_start_system_sparse)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	bertini::System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(pow(x,2)*pow(y,2) + x - 3*y + 1);
+
+	bertini::start_system::Polyhedral P(sys);
+	BOOST_CHECK_EQUAL(P.MixedVolume(), 2);
+	BOOST_CHECK_EQUAL(P.NumStartPoints(), 2);
+	BOOST_CHECK_EQUAL(P.Support(0).size(), 2);
+	BOOST_CHECK_EQUAL(P.Support(1).size(), 4);
+
+	std::vector< Vec<dbl> > starts;
+	for (mpz_int ii = 0; ii < P.NumStartPoints(); ++ii)
+	{
+		auto start = P.StartPoint<dbl>(ii);
+		auto function_values = P.Eval(start);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+		starts.push_back(start);
+	}
+	BOOST_CHECK((starts[0] - starts[1]).norm() > 1e-5);
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	for (mpz_int ii = 0; ii < P.NumStartPoints(); ++ii)
+	{
+		auto function_values = P.Eval(P.StartPoint<mpfr>(ii));
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < threshold_clearance_mp);
+	}
+
+	BOOST_CHECK_THROW(P.StartPoint<dbl>(2), std::out_of_range);
+}
+
+
+/**
+\test \b polyhedral_start_system_three_variables The functions x^2+y^2+z^2-1, x*y*z-1, and x+y+z, whose mixed volume is their total degree, 6, found on two threads.  A homogenized target is refused.
+*/
+BOOST_AUTO_TEST_CASE(polyhedral_start_system_three_variables)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), z = std::make_shared<bertini::node::Variable>("z");
+
+	bertini::System sys;
+	sys.AddVariableGroup(VariableGroup{x,y,z});
+	sys.AddFunction(x*x + y*y + z*z - 1);
+	sys.AddFunction(x*y*z - 1);
+	sys.AddFunction(x + y + z);
+
+	bertini::start_system::Polyhedral P(sys, 2);
+	BOOST_CHECK_EQUAL(P.MixedVolume(), 6);
+	BOOST_CHECK_EQUAL(P.NumStartPoints(), 6);
+
+	std::vector< Vec<dbl> > starts;
+	for (mpz_int ii = 0; ii < P.NumStartPoints(); ++ii)
+	{
+		auto start = P.StartPoint<dbl>(ii);
+		auto function_values = P.Eval(start);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+
+		for (const auto& other : starts)
+			BOOST_CHECK((start - other).norm() > 1e-5);
+		starts.push_back(start);
+	}
+
+	sys.Homogenize();
+	BOOST_CHECK_THROW(bertini::start_system::Polyhedral{sys}, std::runtime_error);
+}
+
+
+
+/**
+\test \b user_supplied_start_system_classic_file A start file of Bertini classic, of 130 points of x^2-1, y^3-1, some past the second of the points located at construction.  The points are read by index in either precision, the digits past double precision kept, and the last is out of range.  A file cut short is refused.
+*/
+BOOST_AUTO_TEST_CASE(user_supplied_start_system_classic_file)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	bertini::System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(pow(x,2) - 1);
+	sys.AddFunction(pow(y,3) - 1);
+
+	const unsigned num_points = 130;
+	auto file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_start_%%%%-%%%%");
+	{
+		boost::filesystem::ofstream out(file);
+		out << num_points << "\n\n";
+		for (unsigned ii = 0; ii < num_points; ++ii)
+			out << (ii%2 ? "-1.0e+00 0.0e+00;\n" : "1.0e+00 0.0e+00;\n")
+			    << (ii%3==0 ? "1.0e+00 0.0e+00;\n" : ii%3==1 ? "-0.5 0.86602540378443864676372317075293618347140262690519;\n" : "-0.5 -0.86602540378443864676372317075293618347140262690519;\n")
+			    << "\n";
+	}
+
+	bertini::start_system::UserSupplied U(sys, file);
+	BOOST_CHECK(U.StartSolutionsFormat()==bertini::start_system::UserSupplied::Format::Classic);
+	BOOST_CHECK_EQUAL(U.NumStartPoints(), num_points);
+
+	for (unsigned ii : {0u, 1u, 63u, 64u, 100u, 129u})
+	{
+		auto start = U.StartPoint<dbl>(ii);
+		BOOST_CHECK(abs(start(0) - dbl(ii%2 ? -1 : 1)) < relaxed_threshold_clearance_d);
+		auto function_values = U.Eval(start);
+		for (int jj = 0; jj < function_values.size(); ++jj)
+			BOOST_CHECK(abs(function_values(jj)) < relaxed_threshold_clearance_d);
+	}
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	auto start = U.StartPoint<mpfr>(101);
+	BOOST_CHECK_EQUAL(Precision(start(1)), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	auto function_values = U.Eval(start);
+	for (int jj = 0; jj < function_values.size(); ++jj)
+		BOOST_CHECK(abs(function_values(jj)) < mpfr_float("1e-40"));
+
+	BOOST_CHECK_THROW(U.StartPoint<dbl>(num_points), std::out_of_range);
+
+	{
+		boost::filesystem::ofstream out(file);
+		out << "3\n\n1.0 0.0;\n1.0 0.0;\n\n-1.0 0.0;\n";
+	}
+	BOOST_CHECK_THROW(bertini::start_system::UserSupplied(sys, file), std::runtime_error);
+
+	boost::filesystem::remove(file);
+}
+
+
+/**
+\test \b user_supplied_start_system_endpoint_file The start points of x^2-1, y^3-1 as records of an endpoint file, read back in double precision, and in multiple precision at the default precision, whatever they were written at.
+*/
+BOOST_AUTO_TEST_CASE(user_supplied_start_system_endpoint_file)
+{
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y");
+
+	bertini::System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(pow(x,2) - 1);
+	sys.AddFunction(pow(y,3) - 1);
+
+	auto file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_start_%%%%-%%%%");
+	DefaultPrecision(30);
+	{
+		bertini::tracking::EndpointWriter writer(file);
+		for (unsigned ii = 0; ii < 4; ++ii)
+		{
+			bertini::tracking::EndpointRecord<mpfr> record;
+			record.index = ii;
+			record.time = mpfr(0);
+			record.endpoint.resize(2);
+			record.endpoint << mpfr(mpfr_float(ii%2 ? -1 : 1)), mpfr(mpfr_float(-1)/2, (ii/2 ? -1 : 1)*sqrt(mpfr_float(3))/2);
+			record.precision = 30;
+			writer.Write(record);
+		}
+	}
+
+	bertini::start_system::UserSupplied U(sys, file);
+	BOOST_CHECK(U.StartSolutionsFormat()==bertini::start_system::UserSupplied::Format::Endpoints);
+	BOOST_CHECK_EQUAL(U.NumStartPoints(), 4);
+
+	auto function_values_d = U.Eval(U.StartPoint<dbl>(3));
+	for (int jj = 0; jj < function_values_d.size(); ++jj)
+		BOOST_CHECK(abs(function_values_d(jj)) < relaxed_threshold_clearance_d);
+
+	DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	auto start = U.StartPoint<mpfr>(2);
+	BOOST_CHECK_EQUAL(Precision(start(0)), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	BOOST_CHECK(abs(start(1) - mpfr(mpfr_float(-1)/2, -sqrt(mpfr_float(3))/2)) < mpfr_float("1e-25"));
+
+	boost::filesystem::remove(file);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -0,0 +1,998 @@
+//This file is part of Bertini 2.
+//
+//straight_line_program_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//straight_line_program_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with straight_line_program_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file straight_line_program_test.cpp Unit testing for the bertini::StraightLineProgram class, and its use by bertini::System.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include "bertini2/system.hpp"
+#include "bertini2/system_parsing.hpp"
+#include "bertini2/function_tree/native_code.hpp"
+#include "bertini2/code_generation.hpp"
+#include "bertini2/generated_system.hpp"
+
+using System = bertini::System;
+using Var = std::shared_ptr<bertini::Variable>;
+
+using mpfr_float = bertini::mpfr_float;
+using dbl = bertini::dbl;
+using mpfr = bertini::mpfr;
+
+#include "externs.hpp"
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+
+
+BOOST_AUTO_TEST_SUITE(straight_line_program)
+
+
+System ParseSystem(std::string const& str)
+{
+	System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+	return sys;
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_matches_tree_double Compile a system with subfunctions, and check that the compiled functions and Jacobian match those from the trees, in double precision.
+*/
+BOOST_AUTO_TEST_CASE(slp_matches_tree_double)
+{
+	System sys = ParseSystem("function f1, f2; variable_group x1, x2; y = x1*x2 - 3; f1 = y*y + x1^3; f2 = x2/(y+x1) - 1/x1;");
+	sys.UseCompiledEvaluation(false);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+
+	Vec<dbl> f_tree = sys.Eval(values);
+	Mat<dbl> J_tree = sys.Jacobian(values);
+
+	sys.UseStraightLineProgram();
+	Vec<dbl> f_slp = sys.Eval(values);
+	Mat<dbl> J_slp = sys.Jacobian(values);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_slp(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_slp(ii,jj)) < threshold_clearance_d);
+	}
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_matches_tree_mpfr Compile a system, and check that the compiled functions and Jacobian match those from the trees, in multiple precision.  Also checks that changing precision of the system reaches the program.
+*/
+BOOST_AUTO_TEST_CASE(slp_matches_tree_mpfr)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	System sys = ParseSystem("function f1, f2; variable_group x1, x2; y = x1*x2 - 3; f1 = y*y + x1^3 - 1.7; f2 = exp(x2)*sin(y) - x1;");
+	sys.UseCompiledEvaluation(false);
+
+	sys.UseStraightLineProgram();
+	sys.GetStraightLineProgram();
+	sys.precision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Vec<mpfr> values(2);
+	values << mpfr("0.4","-1.2"), mpfr("2.1","0.3");
+
+	Vec<mpfr> f_slp = sys.Eval(values);
+	Mat<mpfr> J_slp = sys.Jacobian(values);
+
+	sys.UseStraightLineProgram(false);
+	Vec<mpfr> f_tree = sys.Eval(values);
+	Mat<mpfr> J_tree = sys.Jacobian(values);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_slp(ii)) < threshold_clearance_mp);
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_slp(ii,jj)) < threshold_clearance_mp);
+	}
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_time_derivative Check that the compiled time derivative matches that of the trees, for a homotopy with a parameter depending on the path variable.
+*/
+BOOST_AUTO_TEST_CASE(slp_time_derivative)
+{
+	System sys = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; parameter s; s = t^2; f1 = (1-s)*(x^2-1) + s*(x*y-2); f2 = (1-t)*(y^2-4) + t*(x+y);");
+	sys.UseCompiledEvaluation(false);
+	sys.UsePolynomialEvaluation(false);
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,0.1), dbl(-1.1,0.4);
+	dbl time(0.7,0.2);
+
+	Vec<dbl> ds_dt_tree = sys.TimeDerivative(values, time);
+	Mat<dbl> J_tree = sys.Jacobian(values, time);
+
+	sys.UseStraightLineProgram();
+	Vec<dbl> ds_dt_slp = sys.TimeDerivative(values, time);
+	Mat<dbl> J_slp = sys.Jacobian(values, time);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(ds_dt_tree(ii) - ds_dt_slp(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_slp(ii,jj)) < threshold_clearance_d);
+	}
+}
+
+
+/**
+\class bertini::System
+\test \b compiled_evaluation_by_default A system which is not polynomial is evaluated through its compiled program unless asked not to, and the values match those from the trees.
+*/
+BOOST_AUTO_TEST_CASE(compiled_evaluation_by_default)
+{
+	System sys = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; f1 = sin(x)*y - x/y + t; f2 = exp(t*y) - x^3;");
+	BOOST_CHECK(sys.UsingCompiledEvaluation());
+	BOOST_CHECK(!sys.UsingStraightLineProgram());
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+	dbl time(0.7,0.2);
+
+	Vec<dbl> f_compiled = sys.Eval(values, time);
+	Mat<dbl> J_compiled = sys.Jacobian(values, time);
+	Vec<dbl> dt_compiled = sys.TimeDerivative(values, time);
+
+	sys.UseCompiledEvaluation(false);
+	Vec<dbl> f_tree = sys.Eval(values, time);
+	Mat<dbl> J_tree = sys.Jacobian(values, time);
+	Vec<dbl> dt_tree = sys.TimeDerivative(values, time);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f_compiled(ii)) < threshold_clearance_d);
+		BOOST_CHECK(abs(dt_tree(ii) - dt_compiled(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_compiled(ii,jj)) < threshold_clearance_d);
+	}
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_compile_errors_are_distinguished Only a node type the program cannot compile is an UnsupportedNodeError, which is what a System falls back to its trees for.  Other errors of compilation are plain runtime errors, which propagate.
+*/
+BOOST_AUTO_TEST_CASE(slp_compile_errors_are_distinguished)
+{
+	System sys = ParseSystem("variable_group x, y; function f1, f2; f1 = sin(x)*y; f2 = exp(y) - x^3;");
+	BOOST_CHECK(sys.UsingCompiledEvaluation());
+
+	bool unsupported = false;
+	try
+	{
+		bertini::StraightLineProgram program({sys.Function(0), sys.Function(1)}, {sys.Function(0)}, sys.Variables());
+	}
+	catch (bertini::UnsupportedNodeError const&)
+	{
+		unsupported = true;
+	}
+	catch (std::runtime_error const&)
+	{}
+	BOOST_CHECK(!unsupported);
+	BOOST_CHECK_THROW(bertini::StraightLineProgram({sys.Function(0), sys.Function(1)}, {sys.Function(0)}, sys.Variables()), std::runtime_error);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+	BOOST_CHECK_EQUAL(sys.Eval(values).size(), 2);
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_shared_subtrees_computed_once A subfunction used several times is computed once, and derivative terms which are identically zero produce no instructions.
+*/
+BOOST_AUTO_TEST_CASE(slp_shared_subtrees_computed_once)
+{
+	System sys = ParseSystem("function f; variable_group x1, x2; y = x1*x2; f = y*y*y;");
+
+	const auto& slp = sys.GetStraightLineProgram();
+
+	// one multiplication for y, two for f.
+	BOOST_CHECK_EQUAL(slp.NumInstructions(bertini::StraightLineProgram::FunctionSegment), 3);
+	BOOST_CHECK_EQUAL(slp.NumFunctions(), 1);
+	BOOST_CHECK_EQUAL(slp.NumVariables(), 2);
+	BOOST_CHECK(!slp.HaveTimeDerivative());
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_shares_integer_powers Powers of the same variable, anywhere in the system, share their partial products, and match the values from the trees.
+*/
+BOOST_AUTO_TEST_CASE(slp_shares_integer_powers)
+{
+	System sys = ParseSystem("function f1, f2, f3; variable_group x, y; f1 = x^2 + y; f2 = x^3 - y^2; f3 = x^5*y^(-2);");
+	sys.UseCompiledEvaluation(false);
+	sys.UsePolynomialEvaluation(false);
+
+	// x^2, x^3, x^4, x^5, and y^2 are one multiplication each, 1/y^2 is a division, and then one operation for each function
+	const auto& slp = sys.GetForwardModeProgram();
+	BOOST_CHECK_EQUAL(slp.NumInstructions(bertini::StraightLineProgram::FunctionSegment), 9);
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-1.2), dbl(2.1,0.3);
+
+	Vec<dbl> f_tree = sys.Eval(values);
+	Mat<dbl> J_tree = sys.Jacobian(values);
+
+	sys.UseForwardModeDifferentiation();
+	Vec<dbl> f = sys.Eval(values);
+	Mat<dbl> J = sys.Jacobian(values);
+
+	sys.UseForwardModeDifferentiation(false);
+	sys.UseStraightLineProgram();
+	Mat<dbl> J_slp = sys.Jacobian(values);
+
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 2; ++jj)
+		{
+			BOOST_CHECK(abs(J_tree(ii,jj) - J(ii,jj)) < threshold_clearance_d);
+			BOOST_CHECK(abs(J_tree(ii,jj) - J_slp(ii,jj)) < threshold_clearance_d);
+		}
+	}
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_fuses_sine_and_cosine The sine and cosine of the same register are one instruction, in either order, and the values, derivatives, and batch values computed with it match those from the trees, in double and multiple precision.
+*/
+BOOST_AUTO_TEST_CASE(slp_fuses_sine_and_cosine)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	System sys = ParseSystem("function f1, f2; variable_group x, y; z = x*y; f1 = sin(x)*cos(x); f2 = cos(z)*sin(z);");
+	sys.UseCompiledEvaluation(false);
+	sys.UsePolynomialEvaluation(false);
+
+	// one fused sine and cosine and a multiplication for each function, and one multiplication for z
+	const auto& slp = sys.GetForwardModeProgram();
+	BOOST_CHECK_EQUAL(slp.NumInstructions(bertini::StraightLineProgram::FunctionSegment), 5);
+
+	Vec<dbl> values_d(2);
+	values_d << dbl(0.4,-1.2), dbl(2.1,0.3);
+	Vec<mpfr> values_mp(2);
+	values_mp << mpfr("0.4","-1.2"), mpfr("2.1","0.3");
+
+	Vec<dbl> f_tree_d = sys.Eval(values_d);
+	Mat<dbl> J_tree_d = sys.Jacobian(values_d);
+	Vec<mpfr> f_tree_mp = sys.Eval(values_mp);
+	Mat<mpfr> J_tree_mp = sys.Jacobian(values_mp);
+
+	Vec<dbl> f_d(2); Mat<dbl> J_d(2,2);
+	sys.SetVariables(values_d);
+	slp.EvalForwardMode(f_d, J_d);
+
+	Vec<mpfr> f_mp(2); Mat<mpfr> J_mp(2,2);
+	sys.SetVariables(values_mp);
+	slp.EvalForwardMode(f_mp, J_mp);
+
+	sys.UseStraightLineProgram();
+	Mat<dbl> J_slp_d = sys.Jacobian(values_d);
+	Mat<mpfr> J_slp_mp = sys.Jacobian(values_mp);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree_d(ii) - f_d(ii)) < threshold_clearance_d);
+		BOOST_CHECK(abs(f_tree_mp(ii) - f_mp(ii)) < threshold_clearance_mp);
+		for (int jj = 0; jj < 2; ++jj)
+		{
+			BOOST_CHECK(abs(J_tree_d(ii,jj) - J_d(ii,jj)) < relaxed_threshold_clearance_d);
+			BOOST_CHECK(abs(J_tree_d(ii,jj) - J_slp_d(ii,jj)) < relaxed_threshold_clearance_d);
+			BOOST_CHECK(abs(J_tree_mp(ii,jj) - J_mp(ii,jj)) < threshold_clearance_mp);
+			BOOST_CHECK(abs(J_tree_mp(ii,jj) - J_slp_mp(ii,jj)) < threshold_clearance_mp);
+		}
+	}
+
+	const int num_points = bertini::StraightLineProgram::BatchWidth + 3;
+	Mat<dbl> points(2, num_points);
+	for (int ii = 0; ii < num_points; ++ii)
+		points.col(ii) << dbl(0.3 + 0.1*ii, 0.1 - 0.05*ii), dbl(-1.1 + 0.07*ii, 0.4);
+
+	Mat<dbl> batch_values = sys.EvalBatch(points);
+	for (int ii = 0; ii < num_points; ++ii)
+	{
+		Vec<dbl> f = sys.Eval(Vec<dbl>(points.col(ii)));
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(batch_values(jj,ii) - f(jj)) < relaxed_threshold_clearance_d*(1+abs(f(jj))));
+	}
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b forward_mode_matches_tree Compute the functions and Jacobian in one forward-mode sweep, from a program compiled without derivatives, and check against those from the trees, in double and multiple precision.
+*/
+BOOST_AUTO_TEST_CASE(forward_mode_matches_tree)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	System sys = ParseSystem("function f1, f2, f3; variable_group x1, x2; y = x1*x2 - 3; f1 = y*y + x1^3 - 1.7; f2 = exp(x2)*sin(y) - x1/x2; f3 = sqrt(x1)*log(x2) + x1^1.5;");
+	sys.UseCompiledEvaluation(false);
+
+	Vec<dbl> values_d(2);
+	values_d << dbl(0.4,-1.2), dbl(2.1,0.3);
+	Vec<mpfr> values_mp(2);
+	values_mp << mpfr("0.4","-1.2"), mpfr("2.1","0.3");
+
+	Vec<dbl> f_tree_d = sys.Eval(values_d);
+	Mat<dbl> J_tree_d = sys.Jacobian(values_d);
+	Vec<mpfr> f_tree_mp = sys.Eval(values_mp);
+	Mat<mpfr> J_tree_mp = sys.Jacobian(values_mp);
+
+	const auto& slp = sys.GetForwardModeProgram();
+	BOOST_CHECK(!slp.HaveJacobian());
+
+	Vec<dbl> f_d(3); Mat<dbl> J_d(3,2);
+	sys.SetVariables(values_d);
+	slp.EvalForwardMode(f_d, J_d);
+
+	Vec<mpfr> f_mp(3); Mat<mpfr> J_mp(3,2);
+	sys.SetVariables(values_mp);
+	slp.EvalForwardMode(f_mp, J_mp);
+
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree_d(ii) - f_d(ii)) < threshold_clearance_d);
+		BOOST_CHECK(abs(f_tree_mp(ii) - f_mp(ii)) < threshold_clearance_mp);
+		for (int jj = 0; jj < 2; ++jj)
+		{
+			BOOST_CHECK(abs(J_tree_d(ii,jj) - J_d(ii,jj)) < relaxed_threshold_clearance_d);
+			BOOST_CHECK(abs(J_tree_mp(ii,jj) - J_mp(ii,jj)) < threshold_clearance_mp);
+		}
+	}
+}
+
+
+/**
+\class bertini::System
+\test \b forward_mode_system_time_derivative Switch a system with a path variable to forward-mode differentiation, and check its Jacobian and time derivative against those from the trees.
+*/
+BOOST_AUTO_TEST_CASE(forward_mode_system_time_derivative)
+{
+	System sys = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; parameter s; s = t^2; f1 = (1-s)*(x^2-1) + s*(x*y-2); f2 = (1-t)*(y^2-4) + t*(x+y);");
+	sys.UseCompiledEvaluation(false);
+	sys.UsePolynomialEvaluation(false);
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,0.1), dbl(-1.1,0.4);
+	dbl time(0.7,0.2);
+
+	Vec<dbl> ds_dt_tree = sys.TimeDerivative(values, time);
+	Mat<dbl> J_tree = sys.Jacobian(values, time);
+	Vec<dbl> f_tree = sys.Eval(values, time);
+
+	sys.UseForwardModeDifferentiation();
+	BOOST_CHECK(sys.UsingForwardModeDifferentiation());
+
+	Vec<dbl> ds_dt = sys.TimeDerivative(values, time);
+	Mat<dbl> J = sys.Jacobian(values, time);
+	Vec<dbl> f = sys.Eval(values, time);
+
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_tree(ii) - f(ii)) < threshold_clearance_d);
+		BOOST_CHECK(abs(ds_dt_tree(ii) - ds_dt(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_tree(ii,jj) - J(ii,jj)) < threshold_clearance_d);
+	}
+}
+
+
+/**
+\class bertini::System
+\test \b batch_matches_pointwise Evaluate a system with a path variable and transcendental functions at a batch of points which does not fill a whole number of lanes, and a patched system, and check each column against evaluating at that point alone.
+*/
+BOOST_AUTO_TEST_CASE(batch_matches_pointwise)
+{
+	System sys = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; parameter s; s = t^2; f1 = (1-s)*(x^3-1) + s*sin(x*y) - x/y; f2 = exp(t*y) + x^(-2) - y^0.5;");
+
+	const int num_points = 2*bertini::StraightLineProgram::BatchWidth + 3;
+	Mat<dbl> points(2, num_points);
+	Vec<dbl> times(num_points);
+	for (int ii = 0; ii < num_points; ++ii)
+	{
+		points(0,ii) = dbl(0.3 + 0.1*ii, 0.1 - 0.05*ii);
+		points(1,ii) = dbl(-1.1 + 0.07*ii, 0.4);
+		times(ii) = dbl(0.7 - 0.03*ii, 0.2);
+	}
+
+	Mat<dbl> values = sys.EvalBatch(points, times);
+	BOOST_CHECK_EQUAL(values.rows(), 2);
+	BOOST_CHECK_EQUAL(values.cols(), num_points);
+
+	for (int ii = 0; ii < num_points; ++ii)
+	{
+		Vec<dbl> f = sys.Eval(Vec<dbl>(points.col(ii)), times(ii));
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(values(jj,ii) - f(jj)) < relaxed_threshold_clearance_d*abs(f(jj)));
+	}
+
+	BOOST_CHECK_THROW(sys.EvalBatch(points), std::runtime_error);
+
+
+	System patched = ParseSystem("variable_group x, y; function f1, f2; f1 = x^2 + y^2 - 1; f2 = x*y - 0.25;");
+	patched.Homogenize();
+	patched.AutoPatch();
+
+	Mat<dbl> hom_points(3, num_points);
+	for (int ii = 0; ii < num_points; ++ii)
+		hom_points.col(ii) << dbl(1.0, 0.02*ii), points(0,ii), points(1,ii);
+
+	Mat<dbl> hom_values = patched.EvalBatch(hom_points);
+	BOOST_CHECK_EQUAL(hom_values.rows(), 3);
+	for (int ii = 0; ii < num_points; ++ii)
+	{
+		Vec<dbl> f = patched.Eval(Vec<dbl>(hom_points.col(ii)));
+		for (int jj = 0; jj < 3; ++jj)
+			BOOST_CHECK(abs(hom_values(jj,ii) - f(jj)) < relaxed_threshold_clearance_d*(1+abs(f(jj))));
+	}
+}
+
+
+/**
+\class bertini::System
+\test \b batch_derivatives_match_pointwise Evaluate the functions, Jacobian, and time derivatives of a system with transcendental functions, and of a patched one, at the lanes of a batch by forward-mode differentiation, and check each lane against evaluating at that point alone.
+*/
+BOOST_AUTO_TEST_CASE(batch_derivatives_match_pointwise)
+{
+	using bertini::BatchLanes;
+	constexpr size_t W = BatchLanes::Width;
+
+	auto check = [](System const& sys)
+	{
+		const size_t n = sys.NumVariables();
+		const size_t m = sys.NumTotalFunctions();
+
+		BatchLanes inputs(n+1), f, J, dt;
+		for (size_t l = 0; l < W; ++l)
+		{
+			for (size_t jj = 0; jj < n; ++jj)
+				inputs.Set(jj, l, dbl(0.3 + 0.1*l - 0.2*jj, 0.1 - 0.05*l + 0.03*jj));
+			inputs.Set(n, l, dbl(0.7 - 0.03*l, 0.2));
+		}
+
+		sys.EvalBatchWithDerivatives(inputs, f, J, dt);
+		BOOST_CHECK_EQUAL(f.NumEntries(), m);
+		BOOST_CHECK_EQUAL(J.NumEntries(), m*n);
+
+		for (size_t l = 0; l < W; ++l)
+		{
+			Vec<dbl> x(n);
+			for (size_t jj = 0; jj < n; ++jj)
+				x(jj) = inputs.Get(jj, l);
+			const dbl t = inputs.Get(n, l);
+
+			Vec<dbl> f_point = sys.Eval(x, t);
+			Mat<dbl> J_point = sys.Jacobian(x, t);
+			Vec<dbl> dt_point = sys.TimeDerivative(x, t);
+			for (size_t ii = 0; ii < m; ++ii)
+			{
+				BOOST_CHECK(abs(f.Get(ii, l) - f_point(ii)) < relaxed_threshold_clearance_d*(1+abs(f_point(ii))));
+				BOOST_CHECK(abs(dt.Get(ii, l) - dt_point(ii)) < relaxed_threshold_clearance_d*(1+abs(dt_point(ii))));
+				for (size_t jj = 0; jj < n; ++jj)
+					BOOST_CHECK(abs(J.Get(ii*n + jj, l) - J_point(ii,jj)) < relaxed_threshold_clearance_d*(1+abs(J_point(ii,jj))));
+			}
+		}
+	};
+
+	System sys = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; parameter s; s = t^2; f1 = (1-s)*(x^3-1) + s*sin(x*y) - x/y; f2 = exp(t*y) + x^(-2) - y^0.5 + atan(x)^2;");
+	check(sys);
+
+	System patched = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; f1 = (1-t)*(x^2 + y^2 - 1) + t*(x^2 - 4); f2 = x*y - 0.25*t;");
+	patched.Homogenize();
+	patched.AutoPatch();
+	check(patched);
+
+	BatchLanes too_few(1), f, J, dt;
+	BOOST_CHECK_THROW(sys.EvalBatchWithDerivatives(too_few, f, J, dt), std::runtime_error);
+}
+
+
+/**
+\class bertini::System
+\test \b batch_at_parameters_matches_pointwise Evaluate a system with implicit parameters at a batch of points, each with its own values of the parameters, and a batch of derivatives likewise, and check each against setting the parameters and evaluating at that point alone.
+*/
+BOOST_AUTO_TEST_CASE(batch_at_parameters_matches_pointwise)
+{
+	using bertini::BatchLanes;
+	using bertini::VariableGroup;
+	constexpr size_t W = BatchLanes::Width;
+
+	Var x = bertini::node::MakeNode<bertini::Variable>("x");
+	Var y = bertini::node::MakeNode<bertini::Variable>("y");
+	Var t = bertini::node::MakeNode<bertini::Variable>("t");
+	Var a = bertini::node::MakeNode<bertini::Variable>("a");
+	Var b = bertini::node::MakeNode<bertini::Variable>("b");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x, y});
+	sys.AddImplicitParameters(VariableGroup{a, b});
+	sys.AddPathVariable(t);
+	sys.AddFunction(x*x - a*t - sin(b*y));
+	sys.AddFunction(x*y - b*exp(a*t));
+	sys.UseForwardModeDifferentiation();
+
+	const int num_points = bertini::StraightLineProgram::BatchWidth + 3;
+	Mat<dbl> points(2, num_points), parameters(2, num_points);
+	Vec<dbl> times(num_points);
+	for (int ii = 0; ii < num_points; ++ii)
+	{
+		points.col(ii) << dbl(0.3 + 0.1*ii, 0.1 - 0.05*ii), dbl(-1.1 + 0.07*ii, 0.4);
+		parameters.col(ii) << dbl(1.0 - 0.2*ii, 0.3), dbl(0.5, -0.1*ii);
+		times(ii) = dbl(0.7 - 0.03*ii, 0.2);
+	}
+
+	Mat<dbl> values = sys.EvalBatchAtParameters(points, times, parameters);
+	BOOST_CHECK_EQUAL(values.cols(), num_points);
+	for (int ii = 0; ii < num_points; ++ii)
+	{
+		sys.SetImplicitParameters(Vec<dbl>(parameters.col(ii)));
+		Vec<dbl> f = sys.Eval(Vec<dbl>(points.col(ii)), times(ii));
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(values(jj,ii) - f(jj)) < relaxed_threshold_clearance_d*(1+abs(f(jj))));
+	}
+
+	BatchLanes inputs(3), lane_parameters(2), f, J, dt;
+	for (size_t l = 0; l < W; ++l)
+	{
+		for (size_t jj = 0; jj < 2; ++jj)
+		{
+			inputs.Set(jj, l, points(jj, l));
+			lane_parameters.Set(jj, l, parameters(jj, l));
+		}
+		inputs.Set(2, l, times(l));
+	}
+	sys.EvalBatchWithDerivatives(inputs, lane_parameters, f, J, dt);
+	for (size_t l = 0; l < W; ++l)
+	{
+		sys.SetImplicitParameters(Vec<dbl>(parameters.col(l)));
+		Vec<dbl> p = points.col(l);
+		Vec<dbl> f_point = sys.Eval(p, times(l));
+		Mat<dbl> J_point = sys.Jacobian(p, times(l));
+		Vec<dbl> dt_point = sys.TimeDerivative(p, times(l));
+		for (size_t ii = 0; ii < 2; ++ii)
+		{
+			BOOST_CHECK(abs(f.Get(ii, l) - f_point(ii)) < relaxed_threshold_clearance_d*(1+abs(f_point(ii))));
+			BOOST_CHECK(abs(dt.Get(ii, l) - dt_point(ii)) < relaxed_threshold_clearance_d*(1+abs(dt_point(ii))));
+			for (size_t jj = 0; jj < 2; ++jj)
+				BOOST_CHECK(abs(J.Get(ii*2 + jj, l) - J_point(ii,jj)) < relaxed_threshold_clearance_d*(1+abs(J_point(ii,jj))));
+		}
+	}
+
+	BOOST_CHECK_THROW(sys.EvalBatchAtParameters(points, times, Mat<dbl>(1, num_points)), std::runtime_error);
+	BOOST_CHECK_THROW(sys.EvalBatchWithDerivatives(inputs, BatchLanes(3), f, J, dt), std::runtime_error);
+}
+
+
+/**
+\class bertini::System
+\test \b native_batch_matches_interpreted Evaluate a batch of points, and of derivatives, with the batch sweeps compiled to native code, and check them against the interpreter.  The elementary functions in the system are called back into the interpreter from the compiled code.  Built without LLVM, nothing is compiled, and the two are the same.
+*/
+BOOST_AUTO_TEST_CASE(native_batch_matches_interpreted)
+{
+	using bertini::BatchLanes;
+	using bertini::VariableGroup;
+	constexpr size_t W = BatchLanes::Width;
+
+	Var x = bertini::node::MakeNode<bertini::Variable>("x");
+	Var y = bertini::node::MakeNode<bertini::Variable>("y");
+	Var t = bertini::node::MakeNode<bertini::Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x, y});
+	sys.AddPathVariable(t);
+	sys.AddFunction(x*x*y - 3*t + sin(y)/x);
+	sys.AddFunction(pow(x,3) - (y - t)*exp(x*t) - 2);
+	sys.UseForwardModeDifferentiation();
+
+	BatchLanes inputs(3);
+	const int num_points = bertini::StraightLineProgram::BatchWidth + 3;
+	Mat<dbl> points(2, num_points);
+	Vec<dbl> times(num_points);
+	for (int ii = 0; ii < num_points; ++ii)
+	{
+		points.col(ii) << dbl(0.3 + 0.1*ii, 0.1 - 0.05*ii), dbl(-1.1 + 0.07*ii, 0.4);
+		times(ii) = dbl(0.7 - 0.03*ii, 0.2);
+	}
+	for (size_t l = 0; l < W; ++l)
+	{
+		for (size_t jj = 0; jj < 2; ++jj)
+			inputs.Set(jj, l, points(jj, l));
+		inputs.Set(2, l, times(l));
+	}
+
+	Mat<dbl> interpreted = sys.EvalBatch(points, times);
+	BatchLanes f, J, dt;
+	sys.EvalBatchWithDerivatives(inputs, f, J, dt);
+
+	System native(sys);
+	native.UseNativeCode();
+	BOOST_CHECK(native.UsingNativeCode());
+	Mat<dbl> compiled = native.EvalBatch(points, times);
+	BatchLanes f_native, J_native, dt_native;
+	native.EvalBatchWithDerivatives(inputs, f_native, J_native, dt_native);
+
+	for (int ii = 0; ii < num_points; ++ii)
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(compiled(jj,ii) - interpreted(jj,ii)) < relaxed_threshold_clearance_d*(1+abs(interpreted(jj,ii))));
+
+	for (size_t l = 0; l < W; ++l)
+		for (size_t ii = 0; ii < 2; ++ii)
+		{
+			BOOST_CHECK(abs(f_native.Get(ii, l) - f.Get(ii, l)) < relaxed_threshold_clearance_d*(1+abs(f.Get(ii, l))));
+			BOOST_CHECK(abs(dt_native.Get(ii, l) - dt.Get(ii, l)) < relaxed_threshold_clearance_d*(1+abs(dt.Get(ii, l))));
+			for (size_t jj = 0; jj < 2; ++jj)
+				BOOST_CHECK(abs(J_native.Get(ii*2 + jj, l) - J.Get(ii*2 + jj, l)) < relaxed_threshold_clearance_d*(1+abs(J.Get(ii*2 + jj, l))));
+		}
+
+	// the code is found in the cache by a program compiled again from the same functions
+	bertini::StraightLineProgram program({sys.Function(0), sys.Function(1)}, {}, sys.Variables(), t);
+	BOOST_CHECK_EQUAL(program.CompileNative(), bertini::jit::Available());
+	BOOST_CHECK_EQUAL(program.CompiledNative(), bertini::jit::Available());
+}
+
+
+// kernels as b2-codegen writes them, by hand, for the system of their input
+struct TwoByTwoKernels
+{
+	static char const* Input()
+	{
+		return "variable_group x, y; function f1, f2; f1 = x*y - 2; f2 = x + 3*y^2;";
+	}
+
+	static constexpr bool homogenized = false;
+
+	static std::vector<char const*> InputNames()
+	{
+		return {"x", "y"};
+	}
+
+	static std::vector< std::pair<char const*, char const*> > Constants()
+	{
+		return {{"0", "0"}, {"1", "0"}, {"2", "0"}, {"3", "0"}, {"6", "0"}};
+	}
+
+	template<typename T>
+	static void Eval(T const* inputs, T const* constants, T* function_values)
+	{
+		function_values[0] = inputs[0]*inputs[1] - constants[2];
+		function_values[1] = inputs[0] + constants[3]*inputs[1]*inputs[1];
+	}
+
+	template<typename T>
+	static void Jacobian(T const* inputs, T const* constants, T* jacobian)
+	{
+		jacobian[0] = inputs[1];
+		jacobian[1] = inputs[0];
+		jacobian[2] = constants[1];
+		jacobian[3] = constants[4]*inputs[1];
+	}
+
+	template<typename T>
+	static void TimeDerivative(T const*, T const*, T*)
+	{}
+};
+
+
+/**
+\class bertini::GeneratedSystem
+\test \b generated_kernels_match_trees A system evaluated through kernels generated for it agrees with the same system evaluated as usual, in double and multiple precision, as do its copies.  Homogenizing gives up the kernels, and kernels for other inputs are refused.  The header written for a system names its struct and its inputs.
+*/
+BOOST_AUTO_TEST_CASE(generated_kernels_match_trees)
+{
+	bertini::GeneratedSystem<TwoByTwoKernels> generated;
+	BOOST_CHECK(generated.EvaluatingGeneratedKernels());
+
+	System sys = ParseSystem(TwoByTwoKernels::Input());
+
+	Vec<dbl> point(2);
+	point << dbl(0.3, -1.1), dbl(1.7, 0.2);
+	Vec<dbl> f = generated.Eval(point), f_expected = sys.Eval(point);
+	Mat<dbl> J = generated.Jacobian(point), J_expected = sys.Jacobian(point);
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f(ii) - f_expected(ii)) < threshold_clearance_d);
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J(ii,jj) - J_expected(ii,jj)) < threshold_clearance_d);
+	}
+
+	Vec<mpfr> point_mp(2);
+	point_mp << mpfr("0.3","-1.1"), mpfr("1.7","0.2");
+	Vec<mpfr> f_mp = generated.Eval(point_mp), f_mp_expected = sys.Eval(point_mp);
+	for (int ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(abs(f_mp(ii) - f_mp_expected(ii)) < threshold_clearance_mp);
+
+	System copy(generated);
+	BOOST_CHECK(copy.EvaluatingGeneratedKernels());
+	BOOST_CHECK(abs(copy.Eval(point)(1) - f_expected(1)) < threshold_clearance_d);
+
+	copy.Homogenize();
+	BOOST_CHECK(!copy.EvaluatingGeneratedKernels());
+
+	System other = ParseSystem("variable_group a, b; function f1, f2; f1 = a*b - 2; f2 = a + 3*b^2;");
+	BOOST_CHECK_THROW(other.UseGeneratedKernels(bertini::detail::MakeGeneratedKernels<TwoByTwoKernels>()), std::runtime_error);
+
+	const auto header = bertini::codegen::GenerateHeader(sys, TwoByTwoKernels::Input(), "TwoByTwo");
+	BOOST_CHECK(header.find("struct TwoByTwo\n")!=std::string::npos);
+	BOOST_CHECK(header.find("return {\"x\", \"y\"};")!=std::string::npos);
+	BOOST_CHECK(header.find("static void TimeDerivative(")!=std::string::npos);
+	BOOST_CHECK(header.find("using TwoByTwoSystem = GeneratedSystem<TwoByTwo>;")!=std::string::npos);
+	BOOST_CHECK_THROW(bertini::codegen::GenerateHeader(sys, TwoByTwoKernels::Input(), "2x2"), std::runtime_error);
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_reuses_registers A long chain of subfunctions runs in far fewer registers than it has values, and the functions and Jacobian computed in them match those from the trees, in double and multiple precision, before and after a forward-mode sweep, which runs in registers for every value.
+*/
+BOOST_AUTO_TEST_CASE(slp_reuses_registers)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	std::string input = "function f1, f2; variable_group x, y; a0 = x*y - 1; ";
+	const int chain = 40;
+	for (int ii = 1; ii <= chain; ++ii)
+		input += "a" + std::to_string(ii) + " = a" + std::to_string(ii-1) + "*x/" + std::to_string(ii+1) + " + y*" + std::to_string(ii) + "/7; ";
+	input += "f1 = a" + std::to_string(chain) + "*x; f2 = sin(a20)*cos(a20) + a" + std::to_string(chain) + ";";
+
+	System sys = ParseSystem(input);
+	sys.UseCompiledEvaluation(false);
+	sys.UseStraightLineProgram();
+
+	const auto& slp = sys.GetStraightLineProgram();
+	BOOST_CHECK(slp.NumRunRegisters() < slp.NumRegisters()/2);
+
+	Vec<dbl> values_d(2);
+	values_d << dbl(0.4,-0.2), dbl(0.1,0.3);
+	Vec<mpfr> values_mp(2);
+	values_mp << mpfr("0.4","-0.2"), mpfr("0.1","0.3");
+
+	auto check = [&]()
+	{
+		Vec<dbl> f_d = sys.Eval(values_d);
+		Mat<dbl> J_d = sys.Jacobian(values_d);
+		Vec<mpfr> f_mp = sys.Eval(values_mp);
+		Mat<mpfr> J_mp = sys.Jacobian(values_mp);
+
+		sys.UseStraightLineProgram(false);
+		Vec<dbl> f_tree_d = sys.Eval(values_d);
+		Mat<dbl> J_tree_d = sys.Jacobian(values_d);
+		Vec<mpfr> f_tree_mp = sys.Eval(values_mp);
+		Mat<mpfr> J_tree_mp = sys.Jacobian(values_mp);
+		sys.UseStraightLineProgram();
+
+		for (int ii = 0; ii < 2; ++ii)
+		{
+			BOOST_CHECK(abs(f_tree_d(ii) - f_d(ii)) < threshold_clearance_d);
+			BOOST_CHECK(abs(f_tree_mp(ii) - f_mp(ii)) < threshold_clearance_mp);
+			for (int jj = 0; jj < 2; ++jj)
+			{
+				BOOST_CHECK(abs(J_tree_d(ii,jj) - J_d(ii,jj)) < threshold_clearance_d);
+				BOOST_CHECK(abs(J_tree_mp(ii,jj) - J_mp(ii,jj)) < threshold_clearance_mp);
+			}
+		}
+	};
+
+	check();
+
+	Vec<mpfr> f_forward(2); Mat<mpfr> J_forward(2,2);
+	sys.SetVariables(values_mp);
+	sys.GetStraightLineProgram().EvalForwardMode(f_forward, J_forward);
+	Vec<mpfr> f_mp = sys.Eval(values_mp);
+	for (int ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(abs(f_forward(ii) - f_mp(ii)) < threshold_clearance_mp);
+
+	check();
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_returns_to_cached_precision Moving a compiled system among more precisions than are kept, and back, gives the same values as evaluating at each precision afresh, and the program reports the precision it is at.
+*/
+BOOST_AUTO_TEST_CASE(slp_returns_to_cached_precision)
+{
+	System sys = ParseSystem("function f1, f2; variable_group x1, x2; y = x1*x2 - 3; f1 = y*y + x1^3 - 1.7; f2 = exp(x2)*sin(y) - x1/3.1;");
+	sys.UseStraightLineProgram();
+
+	auto eval_at = [&](unsigned digits)
+	{
+		bertini::DefaultPrecision(digits);
+		sys.precision(digits);
+		Vec<mpfr> values(2);
+		values << mpfr("0.4","-1.2"), mpfr("2.1","0.3");
+		Vec<mpfr> f = sys.Eval(values);
+		BOOST_CHECK_EQUAL(sys.GetStraightLineProgram().precision(), digits);
+		return f;
+	};
+
+	const std::vector<unsigned> precisions{30, 50, 30, 70, 90, 110, 130, 50, 30};
+	std::map<unsigned, Vec<mpfr> > first;
+	for (auto digits : precisions)
+	{
+		auto f = eval_at(digits);
+		BOOST_CHECK_EQUAL(Precision(f), digits);
+		if (first.count(digits))
+			for (int ii = 0; ii < 2; ++ii)
+				BOOST_CHECK(f(ii)==first[digits](ii));
+		else
+			first[digits] = f;
+	}
+
+	// the constants at each precision are rounded afresh, not carried from another
+	bertini::DefaultPrecision(130);
+	sys.UseStraightLineProgram(false);
+	sys.precision(130);
+	Vec<mpfr> values(2);
+	values << mpfr("0.4","-1.2"), mpfr("2.1","0.3");
+	Vec<mpfr> f_tree = sys.Eval(values);
+	for (int ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(abs(f_tree(ii) - first[130](ii)) < mpfr_float("1e-120"));
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\class bertini::System
+\test \b taylor_coefficients_match_contour Compute the Taylor coefficients of a system with every kind of operation along a curve, by Taylor arithmetic, and check them against those from Cauchy's integral on a small circle; then in multiple precision, and for a patched system.
+*/
+BOOST_AUTO_TEST_CASE(taylor_coefficients_match_contour)
+{
+	System sys = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; parameter s; s = t^2; f1 = (1-s)*sin(x*y) + exp(t*y) - x/y + tan(x) - cos(x+t); f2 = log(x+2) + sqrt(y+3) + x^(-2) - y^0.5 + x^t;");
+
+	const int order = 4;
+	Mat<dbl> X(2, order+1);
+	X << dbl(0.3,0.1), dbl(-0.2,0.4), dbl(0.5,0.1), dbl(0.1,-0.3), dbl(-0.2,0.2),
+	     dbl(1.1,0.4), dbl(0.3,-0.1), dbl(-0.4,0.2), dbl(0.2,0.2), dbl(0.1,0.1);
+	const dbl time(0.7,0.2);
+
+	Mat<dbl> F;
+	sys.TaylorCoefficientsInPlace(F, X, time);
+	BOOST_CHECK_EQUAL(F.rows(), 2);
+	BOOST_CHECK_EQUAL(F.cols(), order+1);
+
+	// the trapezoid rule on a circle is exact but for the coefficients of s^(k+N) and up, scaled by r^N
+	const int N = 32;
+	const double r = 0.05;
+	const double two_pi = 2*acos(-1.);
+	Mat<dbl> F_contour = Mat<dbl>::Zero(2, order+1);
+	for (int j = 0; j < N; ++j)
+	{
+		const dbl w = std::polar(1., two_pi*j/N);
+		const dbl s = r*w;
+		Vec<dbl> x = X.col(order);
+		for (int k = order-1; k >= 0; --k)
+			x = x*s + X.col(k);
+		Vec<dbl> f = sys.Eval(x, dbl(time + s));
+		for (int k = 0; k <= order; ++k)
+			F_contour.col(k) += f*std::pow(std::conj(w),k)/(N*std::pow(r,k));
+	}
+
+	for (int ii = 0; ii < 2; ++ii)
+		for (int k = 0; k <= order; ++k)
+			BOOST_CHECK(abs(F(ii,k) - F_contour(ii,k)) < 1e-8*(1+abs(F_contour(ii,k))));
+
+	// the constant term is the value of the functions, and the next the derivative along the curve
+	Vec<dbl> x0 = X.col(0);
+	Vec<dbl> f0 = sys.Eval(x0, time);
+	Vec<dbl> df = sys.Jacobian(x0, time)*X.col(1) + sys.TimeDerivative(x0, time);
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(F(ii,0) - f0(ii)) < 1e-12*(1+abs(f0(ii))));
+		BOOST_CHECK(abs(F(ii,1) - df(ii)) < 1e-12*(1+abs(df(ii))));
+	}
+
+	Mat<mpfr> X_mp(2, order+1);
+	for (int ii = 0; ii < 2; ++ii)
+		for (int k = 0; k <= order; ++k)
+			X_mp(ii,k) = mpfr(X(ii,k));
+	Mat<mpfr> F_mp;
+	sys.TaylorCoefficientsInPlace(F_mp, X_mp, mpfr(time));
+	for (int ii = 0; ii < 2; ++ii)
+		for (int k = 0; k <= order; ++k)
+			BOOST_CHECK(abs(dbl(F_mp(ii,k)) - F(ii,k)) < 1e-10*(1+abs(F(ii,k))));
+
+	BOOST_CHECK_THROW(sys.TaylorCoefficientsInPlace(F, Mat<dbl>(3, order+1), time), std::runtime_error);
+
+
+	System patched = ParseSystem("variable_group x, y; function f1, f2; pathvariable t; f1 = x^2 + y^2 - t; f2 = x*y - 0.25*t;");
+	patched.Homogenize();
+	patched.AutoPatch();
+
+	Mat<dbl> H(3, 2);
+	H << dbl(1.0,0.1), dbl(0.2,-0.1),
+	     dbl(0.3,0.1), dbl(-0.2,0.4),
+	     dbl(1.1,0.4), dbl(0.3,-0.1);
+	patched.TaylorCoefficientsInPlace(F, H, time);
+	BOOST_CHECK_EQUAL(F.rows(), 3);
+
+	Vec<dbl> h0 = H.col(0);
+	Vec<dbl> g0 = patched.Eval(h0, time);
+	Vec<dbl> dg = patched.Jacobian(h0, time)*H.col(1) + patched.TimeDerivative(h0, time);
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		BOOST_CHECK(abs(F(ii,0) - g0(ii)) < 1e-12*(1+abs(g0(ii))));
+		BOOST_CHECK(abs(F(ii,1) - dg(ii)) < 1e-12*(1+abs(dg(ii))));
+	}
+}
+
+
+/**
+\class bertini::StraightLineProgram
+\test \b slp_zero_is_a_strong_zero Pin the one place the program and the trees differ: an exact zero times or over anything is zero in the program, while the trees give NaN for zero times infinity and zero over zero.
+*/
+BOOST_AUTO_TEST_CASE(slp_zero_is_a_strong_zero)
+{
+	System sys = ParseSystem("function f1, f2; variable_group x; f1 = 0*x + 1; f2 = 0/x + 1;");
+	sys.UseCompiledEvaluation(false);
+
+	auto is_nan = [](dbl const& z){ return std::isnan(real(z)) || std::isnan(imag(z)); };
+
+	Vec<dbl> at_zero(1), at_infinity(1);
+	at_zero << dbl(0);
+	at_infinity << dbl(std::numeric_limits<double>::infinity(), 0);
+
+	Vec<dbl> tree_zero = sys.Eval(at_zero);
+	Vec<dbl> tree_infinity = sys.Eval(at_infinity);
+	BOOST_CHECK(!is_nan(tree_zero(0)));
+	BOOST_CHECK(is_nan(tree_zero(1)));
+	BOOST_CHECK(is_nan(tree_infinity(0)));
+
+	sys.UseStraightLineProgram();
+	Vec<dbl> slp_zero = sys.Eval(at_zero);
+	Vec<dbl> slp_infinity = sys.Eval(at_infinity);
+	for (int ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK_EQUAL(slp_zero(ii), dbl(1));
+		BOOST_CHECK_EQUAL(slp_infinity(ii), dbl(1));
+	}
+}
+
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -38,11 +38,14 @@
 */
 
 #include <boost/test/unit_test.hpp>
+#include <iomanip>
+#include <thread>
 
 
 
 #include "bertini2/system.hpp"
 #include "bertini2/system_parsing.hpp"
+#include "bertini2/deflation.hpp"
 
 using System = bertini::System;
 using Var = std::shared_ptr<bertini::Variable>;
@@ -277,6 +280,97 @@ BOOST_AUTO_TEST_CASE(system_differentiate_x_and_t)
 
 
 
+/**
+\class bertini::System
+\test \b system_differentiate_many_functions_sharing_a_subfunction Enough functions to be differentiated on several threads, all sharing one subfunction, give the Jacobian entries of the product rule, each function in its own row, and leave the default precision alone.
+*/
+BOOST_AUTO_TEST_CASE(system_differentiate_many_functions_sharing_a_subfunction)
+{
+	bertini::DefaultPrecision(30);
+
+	std::shared_ptr<bertini::Variable> x = std::make_shared<bertini::Variable>("x");
+	std::shared_ptr<bertini::Variable> y = std::make_shared<bertini::Variable>("y");
+	std::shared_ptr<bertini::Variable> z = std::make_shared<bertini::Variable>("z");
+	auto s = x*y + z;
+
+	const int num_functions = 200;
+	bertini::System S;
+	S.AddUngroupedVariable(x);
+	S.AddUngroupedVariable(y);
+	S.AddUngroupedVariable(z);
+	for (int ii = 0; ii < num_functions; ++ii)
+		S.AddFunction((ii+1)*pow(s,2) + ii*x);
+
+	S.Differentiate();
+	BOOST_CHECK_EQUAL(bertini::DefaultPrecision(), 30);
+
+	Vec<dbl> v(3);
+	v << 1.0, 2.0, 3.0;
+	const auto J = S.Jacobian(v);
+
+	// s = 5 at the point
+	BOOST_REQUIRE_EQUAL(J.rows(), num_functions);
+	for (int ii = 0; ii < num_functions; ++ii)
+	{
+		BOOST_CHECK(abs(J(ii,0) - dbl(2*(ii+1)*5*2 + ii)) < threshold_clearance_d);
+		BOOST_CHECK(abs(J(ii,1) - dbl(2*(ii+1)*5*1)) < threshold_clearance_d);
+		BOOST_CHECK(abs(J(ii,2) - dbl(2*(ii+1)*5)) < threshold_clearance_d);
+	}
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+
+/**
+\test \b jacobian_trees_with_shared_subfunction_match_compiled Walking the Jacobian trees column by column, with the derivatives of a subfunction shared by every function kept across the rows, gives the Jacobian and time derivative the compiled program does, at one point and then another.
+*/
+BOOST_AUTO_TEST_CASE(jacobian_trees_with_shared_subfunction_match_compiled)
+{
+	Var x = std::make_shared<bertini::Variable>("x");
+	Var y = std::make_shared<bertini::Variable>("y");
+	Var t = std::make_shared<bertini::Variable>("t");
+	auto s = bertini::node::MakeNode<bertini::node::Function>(exp(x*y) + sin(y));
+
+	bertini::System trees;
+	trees.AddVariableGroup(bertini::VariableGroup{x,y});
+	trees.AddPathVariable(t);
+	trees.AddSubfunction(s);
+	const int num_functions = 5;
+	for (int ii = 0; ii < num_functions; ++ii)
+		trees.AddFunction((ii+1)*pow(s,2) + ii*x*t - y);
+	trees.UseCompiledEvaluation(false);
+	trees.UsePolynomialEvaluation(false);
+
+	bertini::System compiled(trees);
+	compiled.UseStraightLineProgram();
+
+	Vec<dbl> v1(2), v2(2);
+	v1 << dbl(0.3,0.1), dbl(-0.4,0.2);
+	v2 << dbl(-0.2,0.5), dbl(0.6,-0.1);
+	dbl t1(0.7,0.2), t2(0.1,-0.3);
+
+	for (const auto& iter : std::vector<std::pair<Vec<dbl>, dbl> >{{v1,t1}, {v2,t2}})
+	{
+		Mat<dbl> J = trees.Jacobian(iter.first, iter.second);
+		Mat<dbl> J_compiled = compiled.Jacobian(iter.first, iter.second);
+		Vec<dbl> ds_dt = trees.TimeDerivative(iter.first, iter.second);
+		Vec<dbl> ds_dt_compiled = compiled.TimeDerivative(iter.first, iter.second);
+
+		BOOST_REQUIRE_EQUAL(J.rows(), num_functions);
+		for (int ii = 0; ii < num_functions; ++ii)
+		{
+			for (int jj = 0; jj < 2; ++jj)
+				BOOST_CHECK(abs(J(ii,jj) - J_compiled(ii,jj)) < threshold_clearance_d);
+			BOOST_CHECK(abs(ds_dt(ii) - ds_dt_compiled(ii)) < threshold_clearance_d);
+		}
+	}
+}
+
+
+
+
 /**
 \class bertini::System
 \test \b system_homogenize_multiple_variable_groups Homogenize a system with multiple variable groups.
@@ -965,6 +1059,903 @@ BOOST_AUTO_TEST_CASE(ref_test)
 
 
 
+BOOST_AUTO_TEST_CASE(fused_evaluation_matches_separate)
+{
+	std::string str = "variable_group x, y; function f1, f2; pathvariable t; parameter s; s = t^2; f1 = (1-s)*(x^2-1) + s*(x*y-2); f2 = (1-t)*(y^2-4) + t*exp(x+y);";
+
+	bertini::System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,0.1), dbl(-1.1,0.4);
+	dbl time(0.7,0.2);
+
+	Vec<dbl> f_sep = sys.Eval(values, time);
+	Mat<dbl> J_sep = sys.Jacobian(values, time);
+	Vec<dbl> dt_sep = sys.TimeDerivative(values, time);
+
+	// the trees, the compiled program, and forward mode
+	for (int mode = 0; mode < 3; ++mode)
+	{
+		sys.UseStraightLineProgram(mode==1);
+		sys.UseForwardModeDifferentiation(mode==2);
+
+		Vec<dbl> f(2), dt(2);
+		Mat<dbl> J(2,2), J2(2,2);
+		sys.EvalAndJacobianInPlace(f, J, values, time);
+		sys.JacobianAndTimeDerivativeInPlace(J2, dt, values, time);
+
+		for (int ii = 0; ii < 2; ++ii)
+		{
+			BOOST_CHECK(abs(f(ii) - f_sep(ii)) < threshold_clearance_d);
+			BOOST_CHECK(abs(dt(ii) - dt_sep(ii)) < threshold_clearance_d);
+			for (int jj = 0; jj < 2; ++jj)
+			{
+				BOOST_CHECK(abs(J(ii,jj) - J_sep(ii,jj)) < threshold_clearance_d);
+				BOOST_CHECK(abs(J2(ii,jj) - J_sep(ii,jj)) < threshold_clearance_d);
+			}
+		}
+	}
+}
+
+
+/**
+\test \b partial_reset_matches_fresh_system Evaluating a system at a sequence of points, changing only the variables or only the path variable between evaluations, gives the same values as a freshly made system.
+*/
+BOOST_AUTO_TEST_CASE(partial_reset_matches_fresh_system)
+{
+	std::string str = "variable_group x, y; function f1, f2; pathvariable t; parameter s; constant c; c = 2^(0.5); s = t^2; f1 = c*x^2 + s*y; f2 = y*exp(c) - t;";
+
+	auto parse = [&str]()
+	{
+		bertini::System sys;
+		std::string::const_iterator iter = str.begin();
+		std::string::const_iterator end = str.end();
+		bertini::SystemParser<std::string::const_iterator> S;
+		phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+		return sys;
+	};
+
+	bertini::System sys = parse();
+	// the partial reset is done when walking the trees, which this polynomial system otherwise would not
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+
+	Vec<dbl> x1(2), x2(2);
+	x1 << dbl(0.3,0.1), dbl(-1.1,0.4);
+	x2 << dbl(1.2,-0.5), dbl(0.2,0.9);
+	dbl t1(0.7,0.2), t2(-0.1,0.3);
+
+	std::vector<std::pair<Vec<dbl>, dbl> > points{{x1,t1}, {x2,t1}, {x2,t2}, {x1,t1}};
+	for (const auto& iter : points)
+	{
+		Vec<dbl> f = sys.Eval(iter.first, iter.second);
+		Vec<dbl> f_fresh = parse().Eval(iter.first, iter.second);
+		for (int ii = 0; ii < 2; ++ii)
+			BOOST_CHECK(abs(f(ii) - f_fresh(ii)) < threshold_clearance_d);
+	}
+
+	// only the path variable changes
+	sys.SetVariables(x1);
+	sys.SetPathVariable(t2);
+	Vec<dbl> f = sys.Eval<dbl>();
+	Vec<dbl> f_fresh = parse().Eval(x1, t2);
+	for (int ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(abs(f(ii) - f_fresh(ii)) < threshold_clearance_d);
+}
+
+
+
+/**
+\test \b sparse_jacobian_matches_dense The structure of the Jacobian records which variables each function depends on, and the sparse Jacobian, patched or not, agrees with the dense one in every evaluation mode.
+*/
+BOOST_AUTO_TEST_CASE(sparse_jacobian_matches_dense)
+{
+	std::string str = "variable_group x, y, z; function f1, f2, f3; f1 = x^2 - 1; f2 = y*z - 2; f3 = x*z^2 + 3;";
+
+	bertini::System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+
+	std::vector< std::vector<unsigned> > expected{{0}, {1,2}, {0,2}};
+	BOOST_CHECK(sys.JacobianStructure()==expected);
+	BOOST_CHECK_EQUAL(sys.NumJacobianNonzeros(), 5);
+
+	// the homogenizing variable appears in every function
+	sys.Homogenize();
+	sys.AutoPatch();
+	BOOST_CHECK_EQUAL(sys.NumJacobianNonzeros(), 8+4);
+
+	Vec<dbl> values(4);
+	values << dbl(1), dbl(0.3,0.1), dbl(-1.1,0.4), dbl(0.7,-0.2);
+
+	for (int mode = 0; mode < 3; ++mode)
+	{
+		sys.UseStraightLineProgram(mode==1);
+		sys.UseForwardModeDifferentiation(mode==2);
+
+		Mat<dbl> J = sys.Jacobian(values);
+		bertini::SparseMat<dbl> J_sparse;
+		sys.SparseJacobianInPlace(J_sparse, values);
+
+		BOOST_CHECK_EQUAL(J_sparse.nonZeros(), 12);
+		for (int ii = 0; ii < 4; ++ii)
+			for (int jj = 0; jj < 4; ++jj)
+				BOOST_CHECK(abs(J(ii,jj) - J_sparse.coeff(ii,jj)) < threshold_clearance_d);
+	}
+}
+
+
+
+/**
+\test \b lazy_precision_change Changing the precision of a system defers the work on the trees until they are evaluated in multiple precision, and evaluation after a sequence of changes is at the final precision, in every evaluation mode.
+*/
+BOOST_AUTO_TEST_CASE(lazy_precision_change)
+{
+	std::string str = "variable_group x, y; function f1, f2; f1 = Pi*x*y - 1; f2 = x^2 - y/3 + 0.1;";
+
+	bertini::System sys;
+	std::string::const_iterator iter = str.begin();
+	std::string::const_iterator end = str.end();
+	bertini::SystemParser<std::string::const_iterator> S;
+	phrase_parse(iter, end, S, boost::spirit::ascii::space, sys);
+
+	for (int mode = 0; mode < 3; ++mode)
+	{
+		sys.UseCompiledEvaluation(mode==1);
+		sys.UsePolynomialEvaluation(false);
+		sys.UseForwardModeDifferentiation(mode==2);
+
+		for (unsigned digits : {50u, 16u, 30u, 50u})
+		{
+			bertini::DefaultPrecision(digits);
+			sys.precision(digits);
+			BOOST_CHECK_EQUAL(sys.precision(), digits);
+
+			Vec<mpfr> values(2);
+			values << mpfr("0.5","0.1"), mpfr("0.25","-1");
+			Vec<mpfr> f = sys.Eval(values);
+			Mat<mpfr> J = sys.Jacobian(values);
+
+			mpfr x = values(0), y = values(1);
+			mpfr pi(boost::math::constants::pi<bertini::mpfr_float>());
+			mpfr_float tol = pow(mpfr_float(10), -int(digits)+3);
+
+			BOOST_CHECK_EQUAL(Precision(f(0)), digits);
+			BOOST_CHECK_EQUAL(Precision(J(0,0)), digits);
+			BOOST_CHECK(abs(f(0) - (pi*x*y - mpfr(1))) < tol);
+			BOOST_CHECK(abs(f(1) - (x*x - y/mpfr(3) + mpfr("0.1"))) < tol);
+			BOOST_CHECK(abs(J(0,0) - pi*y) < tol);
+			BOOST_CHECK(abs(J(1,0) - mpfr(2)*x) < tol);
+		}
+	}
+
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+
+/**
+\test \b parallel_parsing_matches_serial Parse a system with many functions, subfunctions, constants, and parameters with several threads, and check it has the same structure and values as when parsed serially.
+*/
+BOOST_AUTO_TEST_CASE(parallel_parsing_matches_serial)
+{
+	std::stringstream input;
+	const int num_functions = 40;
+	// the names are all of one length, as the parser cannot declare a name which extends another, such as f1 and f10
+	input << std::setfill('0') << "function ";
+	for (int ii = 0; ii < num_functions; ++ii)
+		input << (ii ? ", " : "") << "f" << std::setw(2) << ii;
+	input << "; variable_group x, y; pathvariable t; parameter s; s = t^2; constant c; c = Pi/3; z = x*y - c;";
+	for (int ii = 0; ii < num_functions; ++ii)
+		input << " f" << std::setw(2) << ii << " = z^" << (ii%5 + 1) << " + " << ii << "*x*s - y^2*exp(" << ii << "*t) + 1;";
+
+	System serial(input.str());
+	System parallel = bertini::ParseSystemInParallel(input.str(), 4);
+
+	BOOST_CHECK_EQUAL(parallel.NumFunctions(), num_functions);
+	BOOST_CHECK_EQUAL(parallel.NumVariables(), 2);
+	BOOST_CHECK(parallel.HavePathVariable());
+
+	Vec<dbl> values(2);
+	values << dbl(0.4,-0.2), dbl(1.1,0.3);
+	dbl t(0.2,0.1);
+	Vec<dbl> f_serial = serial.Eval(values, t), f_parallel = parallel.Eval(values, t);
+	Mat<dbl> J_serial = serial.Jacobian(values, t), J_parallel = parallel.Jacobian(values, t);
+	for (int ii = 0; ii < num_functions; ++ii)
+	{
+		BOOST_CHECK_EQUAL(parallel.Function(ii)->name(), serial.Function(ii)->name());
+		BOOST_CHECK(abs(f_serial(ii) - f_parallel(ii)) < relaxed_threshold_clearance_d*abs(f_serial(ii)));
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_serial(ii,jj) - J_parallel(ii,jj)) < relaxed_threshold_clearance_d*abs(J_serial(ii,jj)));
+	}
+
+	BOOST_CHECK_THROW(bertini::ParseSystemInParallel("function f, g; variable_group x; f = x^2; g = x +* x;", 2), std::runtime_error);
+	BOOST_CHECK_THROW(bertini::ParseSystemInParallel("function f; variable_group x; f = w^2;", 2), std::runtime_error);
+}
+
+
+
+/**
+\test \b clone_for_thread_evaluates_independently Copies made by CloneForThread, in each mode of compiled evaluation, evaluate at their own points on their own threads, agree with the original, and refuse to walk the trees they share.
+*/
+BOOST_AUTO_TEST_CASE(clone_for_thread_evaluates_independently)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	for (int mode = 0; mode < 3; ++mode)
+	{
+		System sys("variable_group x, y; pathvariable t; function f1, f2; f1 = Pi*x*y - t; f2 = x^2 - y/3 + 0.1*t^2;");
+		sys.UsePolynomialEvaluation(mode==0);
+		sys.UseForwardModeDifferentiation(mode==2);
+
+		auto clone = sys.CloneForThread();
+		BOOST_CHECK(clone.SharesTrees());
+		BOOST_CHECK(!sys.SharesTrees());
+		BOOST_CHECK_EQUAL(clone.NumVariables(), sys.NumVariables());
+
+		const int num_points = 20;
+		std::vector<Vec<dbl> > points(num_points, Vec<dbl>(2));
+		std::vector<dbl> times(num_points);
+		for (int ii = 0; ii < num_points; ++ii)
+		{
+			points[ii] << dbl(0.1*ii, -0.3), dbl(1, 0.05*ii);
+			times[ii] = dbl(0.5, 0.01*ii);
+		}
+
+		std::vector<Vec<dbl> > expected(num_points);
+		std::vector<Mat<dbl> > expected_J(num_points);
+		for (int ii = 0; ii < num_points; ++ii)
+		{
+			expected[ii] = sys.Eval(points[ii], times[ii]);
+			expected_J[ii] = sys.Jacobian(points[ii], times[ii]);
+		}
+
+		// the original and the copies each evaluate at their own points, concurrently
+		auto copy = clone; // a copy of a copy is made the same way
+		BOOST_CHECK(copy.SharesTrees());
+
+		std::vector<int> num_wrong(2, 0);
+		auto evaluate = [&](System const& s, int which)
+		{
+			for (int pass = 0; pass < 50; ++pass)
+				for (int ii = 0; ii < num_points; ++ii)
+				{
+					const int jj = which ? num_points-1-ii : ii;
+					Vec<dbl> f = s.Eval(points[jj], times[jj]);
+					Mat<dbl> J = s.Jacobian(points[jj], times[jj]);
+					if ((f - expected[jj]).norm() > threshold_clearance_d || (J - expected_J[jj]).norm() > threshold_clearance_d)
+						num_wrong[which]++;
+				}
+		};
+
+		std::thread other(evaluate, std::cref(copy), 1);
+		evaluate(clone, 0);
+		other.join();
+
+		BOOST_CHECK_EQUAL(num_wrong[0], 0);
+		BOOST_CHECK_EQUAL(num_wrong[1], 0);
+
+		// precision changes on the copy are its own
+		bertini::DefaultPrecision(40);
+		clone.precision(40);
+		Vec<mpfr> x(2);
+		x << mpfr("0.5","0.1"), mpfr("0.25","-1");
+		mpfr t("0.5","0.2");
+		Vec<mpfr> f = clone.Eval(x, t);
+		BOOST_CHECK_EQUAL(Precision(f(0)), 40);
+		mpfr pi(boost::math::constants::pi<bertini::mpfr_float>());
+		BOOST_CHECK(abs(f(0) - (pi*x(0)*x(1) - t)) < mpfr_float("1e-35"));
+		BOOST_CHECK_EQUAL(sys.precision(), CLASS_TEST_MPFR_DEFAULT_DIGITS);
+		bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+		BOOST_CHECK_THROW(clone.Differentiate(), std::runtime_error);
+	}
+}
+
+
+/**
+\test \b evaluation_threads_match_one_thread A system evaluated on a team of threads, expanded and compiled, gives the same values, Jacobian, and time derivative as on one, in double and multiple precision.  Copies share the team, but those for other threads do not.
+*/
+BOOST_AUTO_TEST_CASE(evaluation_threads_match_one_thread)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	const std::string input = "variable_group x, y, z; pathvariable t; function f1, f2, f3, f4, f5, f6, f7; "
+		"f1 = x^2*y - t; f2 = y*z + 2*x; f3 = x*y*z - 1 + t^2; f4 = z^3 - x*t; f5 = x + y + z; f6 = (x-y)^2*z; f7 = y^4 - t*z;";
+
+	for (int mode = 0; mode < 2; ++mode)
+	{
+		System one(input), team(input);
+		one.UsePolynomialEvaluation(mode==0);
+		team.UsePolynomialEvaluation(mode==0);
+		team.UseEvaluationThreads(3);
+		BOOST_CHECK_EQUAL(team.NumEvaluationThreads(), 3);
+
+		Vec<dbl> x_d(3);
+		x_d << dbl(0.5,0.1), dbl(-0.25,1), dbl(1.5,-0.3);
+		const dbl t_d(0.3,0.2);
+		BOOST_CHECK((team.Eval(x_d, t_d) - one.Eval(x_d, t_d)).norm() < threshold_clearance_d);
+		BOOST_CHECK((team.Jacobian(x_d, t_d) - one.Jacobian(x_d, t_d)).norm() < threshold_clearance_d);
+		BOOST_CHECK((team.TimeDerivative(x_d, t_d) - one.TimeDerivative(x_d, t_d)).norm() < threshold_clearance_d);
+
+		Vec<mpfr> x_mp(3);
+		x_mp << mpfr("0.5","0.1"), mpfr("-0.25","1"), mpfr("1.5","-0.3");
+		const mpfr t_mp("0.3","0.2");
+		BOOST_CHECK((team.Eval(x_mp, t_mp) - one.Eval(x_mp, t_mp)).norm() < threshold_clearance_mp);
+		BOOST_CHECK((team.Jacobian(x_mp, t_mp) - one.Jacobian(x_mp, t_mp)).norm() < threshold_clearance_mp);
+		BOOST_CHECK((team.TimeDerivative(x_mp, t_mp) - one.TimeDerivative(x_mp, t_mp)).norm() < threshold_clearance_mp);
+
+		auto copy = team;
+		BOOST_CHECK(copy.EvaluationTeam()==team.EvaluationTeam());
+		BOOST_CHECK((copy.Jacobian(x_d, t_d) - one.Jacobian(x_d, t_d)).norm() < threshold_clearance_d);
+
+		auto clone = team.CloneForThread();
+		BOOST_CHECK_EQUAL(clone.NumEvaluationThreads(), 1);
+		BOOST_CHECK((clone.Jacobian(x_mp, t_mp) - one.Jacobian(x_mp, t_mp)).norm() < threshold_clearance_mp);
+
+		team.UseEvaluationThreads(1);
+		BOOST_CHECK(!team.EvaluationTeam());
+		BOOST_CHECK((team.Eval(x_d, t_d) - one.Eval(x_d, t_d)).norm() < threshold_clearance_d);
+	}
+}
+
+
+/**
+\test \b straight_line_homotopy_fused_matches_trees A straight-line homotopy evaluated through its target and start systems gives the same values, Jacobian, and time derivative as when evaluated from its trees, in double and multiple precision, and on a copy for another thread.
+*/
+BOOST_AUTO_TEST_CASE(straight_line_homotopy_fused_matches_trees)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), t = std::make_shared<bertini::node::Variable>("t");
+	VariableGroup vars{x,y};
+
+	System target, start;
+	target.AddVariableGroup(vars);
+	target.AddFunction(pow(x,2)*y + exp(x) - 3);
+	target.AddFunction(x*y - pow(y,3) + mpfr_float("0.5"));
+
+	start.AddVariableGroup(vars);
+	start.AddFunction(pow(x,3) - 1);
+	start.AddFunction(pow(y,3) - 1);
+
+	auto gamma = bertini::node::MakeNode<bertini::node::Rational>(bertini::node::Rational::Rand());
+
+	System fused = bertini::StraightLineHomotopy(target, start, gamma, t);
+	BOOST_CHECK(fused.HaveFusedHomotopy());
+	BOOST_CHECK(fused.UsingFusedHomotopy());
+
+	System trees(fused);
+	trees.UseFusedHomotopy(false);
+
+	Vec<dbl> values(2);
+	values << dbl(0.3,0.1), dbl(-1.1,0.4);
+	dbl time(0.7,0.2);
+
+	Vec<dbl> f(2), dt(2), f_trees = trees.Eval(values, time), dt_trees = trees.TimeDerivative(values, time);
+	Mat<dbl> J(2,2), J2(2,2), J_trees = trees.Jacobian(values, time);
+
+	BOOST_CHECK((fused.Eval(values, time) - f_trees).norm() < threshold_clearance_d);
+	BOOST_CHECK((fused.Jacobian(values, time) - J_trees).norm() < threshold_clearance_d);
+	BOOST_CHECK((fused.TimeDerivative(values, time) - dt_trees).norm() < threshold_clearance_d);
+
+	fused.EvalAndJacobianInPlace(f, J, values, time);
+	fused.JacobianAndTimeDerivativeInPlace(J2, dt, values, time);
+	BOOST_CHECK((f - f_trees).norm() < threshold_clearance_d);
+	BOOST_CHECK((J - J_trees).norm() < threshold_clearance_d);
+	BOOST_CHECK((J2 - J_trees).norm() < threshold_clearance_d);
+	BOOST_CHECK((dt - dt_trees).norm() < threshold_clearance_d);
+
+	// a copy for another thread evaluates through clones of the parts
+	auto clone = fused.CloneForThread();
+	BOOST_CHECK(clone.HaveFusedHomotopy());
+	BOOST_CHECK((clone.Eval(values, time) - f_trees).norm() < threshold_clearance_d);
+	BOOST_CHECK((clone.Jacobian(values, time) - J_trees).norm() < threshold_clearance_d);
+
+	// and in multiple precision, the parts follow the precision of the homotopy
+	bertini::DefaultPrecision(40);
+	fused.precision(40);
+	trees.precision(40);
+	Vec<mpfr> x_mp(2);
+	x_mp << mpfr("0.3","0.1"), mpfr("-1.1","0.4");
+	mpfr t_mp("0.7","0.2");
+
+	Vec<mpfr> f_mp = fused.Eval(x_mp, t_mp);
+	BOOST_CHECK_EQUAL(Precision(f_mp(0)), 40);
+	BOOST_CHECK((f_mp - trees.Eval(x_mp, t_mp)).norm() < mpfr_float("1e-35"));
+	BOOST_CHECK((fused.Jacobian(x_mp, t_mp) - trees.Jacobian(x_mp, t_mp)).norm() < mpfr_float("1e-35"));
+	BOOST_CHECK((fused.TimeDerivative(x_mp, t_mp) - trees.TimeDerivative(x_mp, t_mp)).norm() < mpfr_float("1e-35"));
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	// changing the homotopy discards the parts
+	fused *= bertini::node::MakeNode<bertini::node::Integer>(2);
+	BOOST_CHECK(!fused.HaveFusedHomotopy());
+
+	System other_vars;
+	other_vars.AddVariableGroup(VariableGroup{std::make_shared<bertini::node::Variable>("x"), std::make_shared<bertini::node::Variable>("y")});
+	other_vars.AddFunction(x);
+	other_vars.AddFunction(y);
+	BOOST_CHECK_THROW(bertini::StraightLineHomotopy(target, other_vars, gamma, t), std::runtime_error);
+}
+
+
+/**
+\test \b straight_line_homotopy_reuses_values_at_same_point A straight-line homotopy evaluated at a sequence of times and points, often at the same point for several times, and switching precision in between, agrees with its trees throughout.
+*/
+BOOST_AUTO_TEST_CASE(straight_line_homotopy_reuses_values_at_same_point)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = std::make_shared<bertini::node::Variable>("x"), y = std::make_shared<bertini::node::Variable>("y"), t = std::make_shared<bertini::node::Variable>("t");
+	VariableGroup vars{x,y};
+
+	System target, start;
+	target.AddVariableGroup(vars);
+	target.AddFunction(pow(x,2)*y + exp(x) - 3);
+	target.AddFunction(x*y - pow(y,3) + mpfr_float("0.5"));
+
+	start.AddVariableGroup(vars);
+	start.AddFunction(pow(x,3) - 1);
+	start.AddFunction(pow(y,3) - 1);
+
+	System fused = bertini::StraightLineHomotopy(target, start, bertini::node::MakeNode<bertini::node::Rational>(bertini::node::Rational::Rand()), t);
+	System trees(fused);
+	trees.UseFusedHomotopy(false);
+
+	Vec<dbl> x1(2), x2(2);
+	x1 << dbl(0.3,0.1), dbl(-1.1,0.4);
+	x2 << dbl(1.2,-0.5), dbl(0.2,0.9);
+	dbl t1(0.7,0.2), t2(-0.1,0.3), t3(0.4,-0.6);
+
+	std::vector<std::pair<Vec<dbl>, dbl> > points{{x1,t1}, {x1,t2}, {x1,t3}, {x2,t3}, {x2,t1}, {x1,t1}};
+	for (const auto& iter : points)
+	{
+		Vec<dbl> f(2), dt(2);
+		Mat<dbl> J(2,2);
+
+		BOOST_CHECK((fused.Eval(iter.first, iter.second) - trees.Eval(iter.first, iter.second)).norm() < threshold_clearance_d);
+
+		// the values at the point are kept, the Jacobians are not yet
+		fused.JacobianAndTimeDerivativeInPlace(J, dt, iter.first, iter.second);
+		BOOST_CHECK((J - trees.Jacobian(iter.first, iter.second)).norm() < threshold_clearance_d);
+		BOOST_CHECK((dt - trees.TimeDerivative(iter.first, iter.second)).norm() < threshold_clearance_d);
+
+		fused.EvalAndJacobianInPlace(f, J, iter.first, iter.second);
+		BOOST_CHECK((f - trees.Eval(iter.first, iter.second)).norm() < threshold_clearance_d);
+		BOOST_CHECK((J - trees.Jacobian(iter.first, iter.second)).norm() < threshold_clearance_d);
+	}
+
+	// the same point, in increasing precision, is evaluated anew at each
+	Vec<mpfr> x_mp(2);
+	x_mp << mpfr("0.3","0.1"), mpfr("-1.1","0.4");
+	mpfr t_mp("0.7","0.2");
+	for (unsigned digits : {30u, 50u})
+	{
+		bertini::DefaultPrecision(digits);
+		fused.precision(digits);
+		trees.precision(digits);
+		Vec<mpfr> x_at(x_mp);
+		mpfr t_at(t_mp);
+		bertini::Precision(x_at, digits);
+		bertini::Precision(t_at, digits);
+
+		Vec<mpfr> f = fused.Eval(x_at, t_at);
+		BOOST_CHECK_EQUAL(Precision(f(0)), digits);
+		BOOST_CHECK((f - trees.Eval(x_at, t_at)).norm() < pow(mpfr_float(10), -static_cast<int>(digits)+5));
+		BOOST_CHECK((fused.TimeDerivative(x_at, t_at) - trees.TimeDerivative(x_at, t_at)).norm() < pow(mpfr_float(10), -static_cast<int>(digits)+5));
+	}
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b evaluation_cache_answers_repeated_point Evaluating again at the same point, time, and precision is answered from the cache of the last evaluations, with the same values, while any other point, a change of precision, or of mode of evaluation, is evaluated afresh.
+*/
+BOOST_AUTO_TEST_CASE(evaluation_cache_answers_repeated_point)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	System sys("variable_group x, y; pathvariable t; function f1, f2; f1 = x^2*y - t; f2 = exp(x) - y*t^2;");
+	BOOST_CHECK(sys.UsingEvaluationCache());
+	System fresh(sys);
+	fresh.UseEvaluationCache(false);
+
+	Vec<dbl> x1(2), x2(2);
+	x1 << dbl(0.3,0.1), dbl(-1.1,0.4);
+	x2 << dbl(1.2,-0.5), dbl(0.2,0.9);
+	dbl t1(0.7,0.2), t2(-0.1,0.3);
+
+	Vec<dbl> f(2), dt(2);
+	Mat<dbl> J(2,2);
+
+	const auto hits = sys.EvaluationCacheHits();
+	sys.EvalInPlace(f, x1, t1);
+	sys.JacobianInPlace(J, x1, t1);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits);
+
+	// all three are kept, so asking for them together is answered at once
+	sys.EvalAndJacobianInPlace(f, J, x1, t1);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+1);
+	BOOST_CHECK((f - fresh.Eval(x1, t1)).norm() < threshold_clearance_d);
+	BOOST_CHECK((J - fresh.Jacobian(x1, t1)).norm() < threshold_clearance_d);
+
+	sys.TimeDerivativeInPlace(dt, x1, t1);
+	sys.JacobianAndTimeDerivativeInPlace(J, dt, x1, t1);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+2);
+	BOOST_CHECK((dt - fresh.TimeDerivative(x1, t1)).norm() < threshold_clearance_d);
+
+	// another time, or another point, is evaluated
+	BOOST_CHECK((sys.Eval(x1, t2) - fresh.Eval(x1, t2)).norm() < threshold_clearance_d);
+	BOOST_CHECK((sys.Eval(x2, t2) - fresh.Eval(x2, t2)).norm() < threshold_clearance_d);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+2);
+
+	// and so is the same point after switching the mode of evaluation
+	sys.UseForwardModeDifferentiation(true);
+	BOOST_CHECK((sys.Eval(x2, t2) - fresh.Eval(x2, t2)).norm() < threshold_clearance_d);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+2);
+	BOOST_CHECK((sys.Eval(x2, t2) - fresh.Eval(x2, t2)).norm() < threshold_clearance_d);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+3);
+
+	// in multiple precision, the precision is part of the key
+	Vec<mpfr> x_mp(2);
+	x_mp << mpfr("0.3","0.1"), mpfr("-1.1","0.4");
+	mpfr t_mp("0.7","0.2");
+	Vec<mpfr> f_mp = sys.Eval(x_mp, t_mp);
+	f_mp = sys.Eval(x_mp, t_mp);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+4);
+
+	bertini::DefaultPrecision(40);
+	sys.precision(40);
+	fresh.precision(40);
+	bertini::Precision(x_mp, 40);
+	bertini::Precision(t_mp, 40);
+	f_mp = sys.Eval(x_mp, t_mp);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+4);
+	BOOST_CHECK_EQUAL(Precision(f_mp(0)), 40);
+	BOOST_CHECK((f_mp - fresh.Eval(x_mp, t_mp)).norm() < mpfr_float("1e-35"));
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	BOOST_CHECK_EQUAL(fresh.EvaluationCacheHits(), 0);
+}
+
+
+/**
+\test \b evaluation_cache_notices_a_parameter_set_directly A parameter Variable which is not one of the system's variables is watched by the cache of the last evaluations.  After changing its value, evaluating at the same point computes afresh, in the system and in a copy made by CloneForThread.
+*/
+BOOST_AUTO_TEST_CASE(evaluation_cache_notices_a_parameter_set_directly)
+{
+	Var x = std::make_shared<bertini::Variable>("x"), y = std::make_shared<bertini::Variable>("y");
+	Var p = std::make_shared<bertini::Variable>("p");
+
+	VariableGroup vars;
+	vars.push_back(x); vars.push_back(y);
+
+	System sys;
+	sys.AddVariableGroup(vars);
+	sys.AddFunction(x*y - p);
+	sys.AddFunction(x + p*y);
+	BOOST_CHECK(sys.UsingEvaluationCache());
+
+	Vec<dbl> values(2);
+	values << dbl(2.0), dbl(3.0);
+
+	p->set_current_value(dbl(1.0));
+	Vec<dbl> before = sys.Eval(values);
+	BOOST_CHECK_EQUAL(before(0), dbl(5.0));
+	BOOST_CHECK_EQUAL(before(1), dbl(5.0));
+
+	const auto hits = sys.EvaluationCacheHits();
+	sys.Eval(values);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+1);
+
+	p->set_current_value(dbl(2.0));
+	Vec<dbl> after = sys.Eval(values);
+	BOOST_CHECK_EQUAL(sys.EvaluationCacheHits(), hits+1);
+	BOOST_CHECK_EQUAL(after(0), dbl(4.0));
+	BOOST_CHECK_EQUAL(after(1), dbl(8.0));
+
+	auto clone = sys.CloneForThread();
+	Vec<dbl> cloned = clone.Eval(values);
+	BOOST_CHECK_EQUAL(cloned(0), dbl(4.0));
+
+	p->set_current_value(dbl(3.0));
+	cloned = clone.Eval(values);
+	BOOST_CHECK_EQUAL(cloned(0), dbl(3.0));
+	BOOST_CHECK_EQUAL(cloned(1), dbl(11.0));
+}
+
+
+/**
+\test \b trees_notice_a_parameter_set_directly Walking the trees re-evaluates only the nodes depending on what the system set, unless another Variable of the trees has been set directly, as a parameter here, when everything is reset.  ForgetStoredValues resets everything too.
+*/
+BOOST_AUTO_TEST_CASE(trees_notice_a_parameter_set_directly)
+{
+	Var x = std::make_shared<bertini::Variable>("x"), y = std::make_shared<bertini::Variable>("y");
+	Var p = std::make_shared<bertini::Variable>("p");
+
+	VariableGroup vars;
+	vars.push_back(x); vars.push_back(y);
+
+	System sys;
+	sys.AddVariableGroup(vars);
+	sys.AddFunction(x*y - exp(p));
+	sys.AddFunction(x + p*y);
+	sys.UseCompiledEvaluation(false);
+	sys.UsePolynomialEvaluation(false);
+	sys.UseEvaluationCache(false);
+
+	Vec<dbl> values(2), others(2);
+	values << dbl(2.0), dbl(3.0);
+	others << dbl(1.0), dbl(-1.0);
+
+	p->set_current_value(dbl(0.0));
+	Vec<dbl> f = sys.Eval(values);
+	BOOST_CHECK(abs(f(0) - dbl(5.0)) < threshold_clearance_d);
+
+	// exp(p) depends on nothing the system sets, but p was set since
+	p->set_current_value(dbl(1.0));
+	f = sys.Eval(others);
+	BOOST_CHECK(abs(f(0) - (dbl(-1.0) - exp(dbl(1.0)))) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - dbl(0.0)) < threshold_clearance_d);
+
+	// the system's own setters need no help
+	f = sys.Eval(values);
+	BOOST_CHECK(abs(f(0) - (dbl(6.0) - exp(dbl(1.0)))) < threshold_clearance_d);
+	BOOST_CHECK(abs(f(1) - dbl(5.0)) < threshold_clearance_d);
+
+	sys.ForgetStoredValues();
+	f = sys.Eval(values);
+	BOOST_CHECK(abs(f(0) - (dbl(6.0) - exp(dbl(1.0)))) < threshold_clearance_d);
+}
+
+
+BOOST_AUTO_TEST_CASE(compensated_evaluation_survives_cancellation)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	// at x = 1e8+1, y = 1e8, the terms are about 1e16, and the value 1
+	System sys("variable_group x, y; function f; f = x^2 - 2*x*y + y^2;");
+	BOOST_CHECK(!sys.EvaluatingCompensated());
+
+	sys.UseCompensatedEvaluation(true);
+	BOOST_CHECK(sys.UsingCompensatedEvaluation());
+	BOOST_CHECK(sys.EvaluatingCompensated());
+
+	Vec<dbl> x(2);
+	x << dbl(1e8+1), dbl(1e8);
+
+	Vec<dbl> f = sys.Eval(x);
+	BOOST_CHECK(abs(f(0) - dbl(1)) < threshold_clearance_d);
+
+	Mat<dbl> J = sys.Jacobian(x);
+	BOOST_CHECK(abs(J(0,0) - dbl(2)) < threshold_clearance_d);
+	BOOST_CHECK(abs(J(0,1) + dbl(2)) < threshold_clearance_d);
+
+	// multiple precision goes through the usual registers
+	Vec<mpfr> x_mp(2);
+	x_mp << mpfr("100000001"), mpfr("100000000");
+	Vec<mpfr> f_mp = sys.Eval(x_mp);
+	BOOST_CHECK(abs(f_mp(0) - mpfr(1)) < threshold_clearance_mp);
+
+	// forward mode takes precedence, and is not compensated
+	sys.UseForwardModeDifferentiation(true);
+	BOOST_CHECK(!sys.EvaluatingCompensated());
+	sys.UseForwardModeDifferentiation(false);
+	BOOST_CHECK(sys.EvaluatingCompensated());
+
+	// a copy keeps the setting
+	System copy(sys);
+	BOOST_CHECK(copy.EvaluatingCompensated());
+	BOOST_CHECK(abs(copy.Eval(x)(0) - dbl(1)) < threshold_clearance_d);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(real_coefficient_system_evaluates_in_real_arithmetic)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	System sys("variable_group x, y; function f1, f2; f1 = x^2*y - 3.5*sin(x)*cos(x) + 2/7; f2 = exp(y)*x - y^3 + x^1.5;");
+	BOOST_CHECK(sys.HasRealCoefficients());
+
+	Vec<double> x(2);
+	x << 0.3, 1.2;
+	Vec<dbl> z(2);
+	z << dbl(0.3), dbl(1.2);
+
+	Vec<double> f = sys.EvalReal(x);
+	Vec<dbl> g = sys.Eval(z);
+	Mat<double> J = sys.JacobianReal(x);
+	Mat<dbl> K = sys.Jacobian(z);
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(std::abs(f(ii) - g(ii).real()) < threshold_clearance_d);
+		for (unsigned jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(std::abs(J(ii,jj) - K(ii,jj).real()) < threshold_clearance_d);
+	}
+
+	Vec<mpfr_float> x_mp(2);
+	x_mp << mpfr_float("0.3"), mpfr_float("1.2");
+	Vec<mpfr> z_mp(2);
+	z_mp << mpfr("0.3"), mpfr("1.2");
+
+	Vec<mpfr_float> f_mp = sys.EvalReal(x_mp);
+	Vec<mpfr> g_mp = sys.Eval(z_mp);
+	Mat<mpfr_float> J_mp = sys.JacobianReal(x_mp);
+	Mat<mpfr> K_mp = sys.Jacobian(z_mp);
+	for (unsigned ii = 0; ii < 2; ++ii)
+	{
+		BOOST_CHECK(abs(f_mp(ii) - g_mp(ii).real()) < threshold_clearance_mp);
+		for (unsigned jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(J_mp(ii,jj) - K_mp(ii,jj).real()) < threshold_clearance_mp);
+	}
+
+	// a constant with an imaginary part, or a patch, rules it out
+	System complex_sys("variable_group x; function f; f = x^2 + I;");
+	BOOST_CHECK(!complex_sys.HasRealCoefficients());
+	Vec<double> w(1);
+	w << 0.5;
+	BOOST_CHECK_THROW(complex_sys.EvalReal(w), std::runtime_error);
+
+	System patched("variable_group x, y; function f1, f2; f1 = x^2 - 2*y; f2 = x*y - 3;");
+	BOOST_CHECK(patched.HasRealCoefficients());
+	patched.Homogenize();
+	patched.AutoPatch();
+	BOOST_CHECK(!patched.HasRealCoefficients());
+}
+
+
+
+BOOST_AUTO_TEST_CASE(added_and_replaced_functions_differentiated_alone)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	Var x = std::make_shared<bertini::Variable>("x"), y = std::make_shared<bertini::Variable>("y"), z = std::make_shared<bertini::Variable>("z");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x, y, z});
+	sys.AddFunction(x*x - y);
+	sys.AddFunction(y*z + x);
+	sys.Differentiate();
+	BOOST_CHECK(sys.IsDifferentiated());
+
+	sys.AddFunction(x*y*z - 1);
+	BOOST_CHECK(!sys.IsDifferentiated());
+	sys.ReplaceFunction(0, bertini::node::MakeNode<bertini::node::Function>(x*x*x - y));
+	BOOST_CHECK_THROW(sys.ReplaceFunction(3, bertini::node::MakeNode<bertini::node::Function>(x)), std::out_of_range);
+
+	System fresh;
+	fresh.AddVariableGroup(VariableGroup{x, y, z});
+	fresh.AddFunction(x*x*x - y);
+	fresh.AddFunction(y*z + x);
+	fresh.AddFunction(x*y*z - 1);
+
+	Vec<dbl> v(3);
+	v << dbl(0.3,0.1), dbl(-1.2,0.4), dbl(0.7,-0.5);
+
+	const Mat<dbl> J = sys.Jacobian(v);
+	const Mat<dbl> K = fresh.Jacobian(v);
+	BOOST_CHECK(sys.IsDifferentiated());
+	BOOST_CHECK_EQUAL(J.rows(), 3);
+	for (unsigned ii = 0; ii < 3; ++ii)
+		for (unsigned jj = 0; jj < 3; ++jj)
+			BOOST_CHECK(abs(J(ii,jj) - K(ii,jj)) < threshold_clearance_d);
+
+	// a new variable changes every row
+	Var w = std::make_shared<bertini::Variable>("w");
+	sys.AddUngroupedVariable(w);
+	BOOST_CHECK_EQUAL(sys.Jacobian(Vec<dbl>::Ones(4)).cols(), 4);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(deflation_refines_singular_root)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	// at (0,1) the Jacobian has rank 1, and Newton's method converges only linearly
+	System sys("variable_group x, y; function f1, f2; f1 = x^2; f2 = y - 1;");
+
+	Vec<dbl> approximation(2);
+	approximation << dbl(1e-4,2e-5), dbl(1+1e-6,-1e-6);
+
+	Mat<dbl> J = sys.Jacobian(approximation);
+	BOOST_CHECK_EQUAL(bertini::NumericalRank(J, 1e-3), 1);
+
+	bertini::DeflatedSystem deflated(sys, 1);
+	BOOST_CHECK_EQUAL(deflated.NumMultipliers(), 2);
+	BOOST_CHECK_EQUAL(deflated.GetSystem().NumVariables(), 4);
+	BOOST_CHECK_EQUAL(deflated.GetSystem().NumTotalFunctions(), 4);
+	BOOST_CHECK_THROW(bertini::DeflatedSystem(sys, 2), std::runtime_error);
+
+	bertini::DeflationConfig config;
+	config.rank_tolerance = 1e-3;
+
+	Vec<dbl> root;
+	unsigned num_deflations;
+	BOOST_CHECK(bertini::RefineByDeflation(root, num_deflations, sys, approximation, config));
+	BOOST_CHECK_EQUAL(num_deflations, 1);
+	BOOST_CHECK_EQUAL(root.size(), 2);
+	BOOST_CHECK(abs(root(0)) < 1e-10);
+	BOOST_CHECK(abs(root(1) - dbl(1)) < 1e-10);
+
+	// the system itself is unchanged
+	Vec<dbl> f = sys.Eval(approximation);
+	BOOST_CHECK(abs(f(1) - (approximation(1) - dbl(1))) < threshold_clearance_d);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(memory_report_breaks_down_trees_and_values)
+{
+	bertini::DefaultPrecision(CLASS_TEST_MPFR_DEFAULT_DIGITS);
+
+	System sys("variable_group x, y; function f1, f2; f1 = x*y + 2; f2 = y^2 - x;");
+
+	auto before = sys.MemoryReport();
+	BOOST_CHECK_EQUAL(before.Count("function_trees/Variable"), 2);
+	BOOST_CHECK(before.Count("function_trees") > 2);
+	BOOST_CHECK_EQUAL(before.Count("jacobian_trees"), 0);
+
+	// walk the trees, so that they keep values
+	sys.UsePolynomialEvaluation(false);
+	sys.UseCompiledEvaluation(false);
+	sys.Differentiate();
+	Vec<mpfr> x(2);
+	x << mpfr("0.3","0.1"), mpfr("-1.2","0.7");
+	sys.Eval(x);
+	sys.Jacobian(x);
+
+	auto after = sys.MemoryReport();
+	BOOST_CHECK(after.Count("jacobian_trees") > 0);
+	BOOST_CHECK(after.Count("node_values") > 0);
+
+	std::size_t total = 0;
+	for (auto const& c : after.Components())
+		total += c.bytes;
+	BOOST_CHECK_EQUAL(after.TotalBytes(), total);
+
+	// the values are counted at their precision
+	sys.precision(4*CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	for (unsigned ii = 0; ii < 2; ++ii)
+		x(ii).precision(4*CLASS_TEST_MPFR_DEFAULT_DIGITS);
+	sys.Eval(x);
+	BOOST_CHECK(sys.MemoryReport().Bytes("node_values") > after.Bytes("node_values"));
+
+	sys.UsePolynomialEvaluation(true);
+	sys.Eval(x);
+	BOOST_CHECK(sys.MemoryReport().Bytes("polynomial_system") > 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(memory_usage_components_nest_by_name)
+{
+	bertini::MemoryUsage inner;
+	inner.Add("a", 10, 1);
+	inner.Add("a", 5, 1);
+	inner.Add("ab", 7);
+
+	bertini::MemoryUsage outer;
+	outer.Add("x", 100);
+	outer.Add("sub", inner);
+
+	BOOST_CHECK_EQUAL(outer.Components().size(), 3);
+	BOOST_CHECK_EQUAL(outer.Bytes("sub"), 22);
+	BOOST_CHECK_EQUAL(outer.Bytes("sub/a"), 15);
+	BOOST_CHECK_EQUAL(outer.Count("sub/a"), 2);
+	BOOST_CHECK_EQUAL(outer.Bytes("su"), 0);
+	BOOST_CHECK_EQUAL(outer.TotalBytes(), 122);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -32,6 +32,11 @@
 
 #include "bertini.hpp"
 #include <string>
+#include <cstdio>
+#include <fstream>
+#include <tuple>
+#include <vector>
+#include <boost/algorithm/string/trim.hpp>
 #include <boost/test/unit_test.hpp>
 
 
@@ -576,6 +581,79 @@ BOOST_AUTO_TEST_CASE(test_split_and_uncomment)
 }
 
 
+/**
+\test \b preprocessed_split Splitting in one linear pass finds the same sections as the split grammar, for each of the arrangements of markers it handles.  The sections are compared to the expected ones, rather than to those from the grammar, which repeats text after backtracking when there are no markers.
+*/
+BOOST_AUTO_TEST_CASE(preprocessed_split)
+{
+    const std::string config = "tracktype: 1;";
+    const std::string input = "variable_group x, y;\nfunction f;\nf = x^2 + y^2 - 1;";
+
+    // the text, whether it is readable, and the expected config and input
+    const std::vector<std::tuple<std::string, bool, std::string, std::string> > test_cases{
+        std::make_tuple("abcd CONFIG\n\n" + config + "\n\nEND; between INPUT\n\n" + input + "\n\nEND;  efgh", true, config, input), // 15
+        std::make_tuple("abcd CONFIG\n\n" + config + "\n\nEND; between INPUT\n\n" + input + "\n\n", true, config, input), // 14
+        std::make_tuple("abcd CONFIG\n\n" + config + "\n\nEND;\n\n" + input + "\n\nEND;  efgh", true, config, input), // 13
+        std::make_tuple("abcd CONFIG\n\n" + config + "\n\nEND;\n\n" + input + "\n\n", true, config, input), // 12
+        std::make_tuple("abcd CONFIG\n\n" + config + "\n\n INPUT\n\n" + input + "\n\nEND;  efgh", true, config, input), // 11
+        std::make_tuple("abcd CONFIG\n\n" + config + "\n\n INPUT\n\n" + input + "\n\n", true, config, input), // 10
+        std::make_tuple("abcd INPUT\n\n" + input + "\n\nEND;  efgh", true, "", input), // 3
+        std::make_tuple("abcd INPUT\n\n" + input + "\n\n", true, "", input), // 2
+        std::make_tuple(input + "\n\nEND;  efgh", true, "", input), // 1
+        std::make_tuple(input + "\n\n", true, "", input), // 0
+        std::make_tuple("abcd CONFIG\n\n" + config + "\n\n between \n\n" + input + "\n\n  efgh", false, "", ""), // 8
+        std::make_tuple("abcd " + config + "\n\n END; between INPUT \n\n" + input + "\n\n END; efgh", false, "", ""), // 7
+        std::make_tuple("abcd " + config + "\n\n END; between INPUT \n\n" + input + "\n\n efgh", false, "", ""), // 6
+        std::make_tuple("abcd " + config + "\n\n END; between \n\n" + input + "\nEND; \n efgh", false, "", "") // 5
+    };
+
+    for (auto const& test_case : test_cases)
+    {
+        bertini::classic::PreprocessedInputFile preprocessed(std::get<0>(test_case));
+
+        BOOST_CHECK_EQUAL(preprocessed.Readable(), std::get<1>(test_case));
+        BOOST_CHECK_EQUAL(boost::algorithm::trim_copy(preprocessed.Config().to_string()), std::get<2>(test_case));
+        BOOST_CHECK_EQUAL(boost::algorithm::trim_copy(preprocessed.Input().to_string()), std::get<3>(test_case));
+
+        bertini::classic::parsing::SplitFileInputConfig<std::string::const_iterator> parser;
+        bertini::classic::SplitInputFile config_and_input;
+        std::string::const_iterator iter = std::get<0>(test_case).begin();
+        std::string::const_iterator end = std::get<0>(test_case).end();
+        phrase_parse(iter, end, parser, boost::spirit::ascii::space, config_and_input);
+        BOOST_CHECK_EQUAL(preprocessed.ToSplitInputFile().Readable(), config_and_input.Readable());
+    }
+}
+
+
+/**
+\test \b preprocessed_file_parses_in_place Read a commented input file through a memory mapping, and parse the system directly from the stripped input section.
+*/
+BOOST_AUTO_TEST_CASE(preprocessed_file_parses_in_place)
+{
+    const std::string file_name = "classic_parsing_test_input";
+    {
+        std::ofstream fout(file_name);
+        fout << "%Title of file\n CONFIG \n tracktype: 1;  %comment about END; setting\n END; \n INPUT\n variable_group x,y; %variables, in INPUT\n function f;\n f = x^2 + y; %END;\n END;";
+    }
+
+    auto preprocessed = bertini::classic::PreprocessedInputFile::FromFile(file_name);
+    BOOST_CHECK(preprocessed.Readable());
+    BOOST_CHECK(preprocessed.Config().find("tracktype: 1;")!=boost::string_ref::npos);
+    BOOST_CHECK(preprocessed.Config().find("%")==boost::string_ref::npos);
+    BOOST_CHECK(preprocessed.Input().find("variable_group x,y;")!=boost::string_ref::npos);
+    BOOST_CHECK(preprocessed.Input().find("variables")==boost::string_ref::npos);
+
+    bertini::System sys;
+    bertini::SystemParser<bertini::classic::PreprocessedInputFile::const_iterator> S;
+    BOOST_CHECK(preprocessed.ParseInput(S, sys));
+    BOOST_CHECK_EQUAL(sys.NumFunctions(), 1);
+    BOOST_CHECK_EQUAL(sys.NumVariables(), 2);
+
+    std::remove(file_name.c_str());
+    BOOST_CHECK_THROW(bertini::classic::PreprocessedInputFile::FromFile(file_name), std::runtime_error);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
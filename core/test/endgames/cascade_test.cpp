@@ -0,0 +1,132 @@
+//This file is part of Bertini 2.
+//
+//cascade_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//cascade_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with cascade_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file cascade_test.cpp Unit testing for finding witness sets of every dimension by a cascade.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "bertini2/tracking/cascade.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(cascade)
+
+
+/**
+\test \b cascade_finds_line_and_point x(y-2), x(x-3), whose solutions are the line x=0 and the point (3,2).  The witness set of dimension 1 is the one point of the line on the slice, and that of dimension 0 is the point, any endpoints on the line having been removed as junk.
+*/
+BOOST_AUTO_TEST_CASE(cascade_finds_line_and_point)
+{
+	using namespace bertini::tracking;
+	using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*(y-2));
+	sys.AddFunction(x*(x-3));
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto found = Cascade<AMPTracker, EndgameType>(sys, setup, [](EndgameType &){}, mpfr("0.1"),
+	                                              config::Cascade<mpfr_float>(), StagedSolveConfig(), 2);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	BOOST_REQUIRE_EQUAL(found.witness_sets.size(), 2);
+	BOOST_REQUIRE_EQUAL(found.stages.size(), 2);
+	BOOST_CHECK_EQUAL(found.stages[1].dimension, 1);
+	BOOST_CHECK_EQUAL(found.stages[1].num_paths, 4);
+
+	auto const& line = found.witness_sets[1];
+	BOOST_CHECK_EQUAL(line.dimension, 1);
+	BOOST_CHECK_EQUAL(line.system.NumFunctions(), 1);
+	BOOST_CHECK_EQUAL(line.slice.Dimension(), 1);
+	BOOST_REQUIRE_EQUAL(line.points.size(), 1);
+	BOOST_CHECK(abs(line.points[0](0)) < mpfr_float("1e-10"));
+
+	auto const& point = found.witness_sets[0];
+	BOOST_CHECK_EQUAL(point.dimension, 0);
+	BOOST_CHECK_EQUAL(found.stages[0].num_junk, point.superset.size() - 1);
+	BOOST_REQUIRE_EQUAL(point.points.size(), 1);
+	BOOST_CHECK(abs(point.points[0](0) - mpfr(3)) < mpfr_float("1e-10"));
+	BOOST_CHECK(abs(point.points[0](1) - mpfr(2)) < mpfr_float("1e-10"));
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b cascade_refuses_top_dimension_of_whole_space The top dimension must be less than the number of variables.
+*/
+BOOST_AUTO_TEST_CASE(cascade_refuses_top_dimension_of_whole_space)
+{
+	using namespace bertini::tracking;
+	using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y);
+
+	config::Cascade<mpfr_float> cascade;
+	cascade.top_dimension = 2;
+
+	BOOST_CHECK_THROW((Cascade<AMPTracker, EndgameType>(sys, [](AMPTracker &){}, [](EndgameType &){}, mpfr("0.1"), cascade)), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
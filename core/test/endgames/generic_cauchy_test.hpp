@@ -77,6 +77,40 @@ using bertini::DefaultPrecision;
 using namespace bertini::tracking;
 using namespace bertini::tracking::endgame;
 
+/**
+\test \b mean_of_loop_samples Samples around a circle, on a loop closed by repeating the first, average to the center, the repeated sample not counted.  The second coordinate runs around a large circle, whose terms cancel.
+*/
+BOOST_AUTO_TEST_CASE(mean_of_loop_samples)
+{
+	DefaultPrecision(ambient_precision);
+
+	const BCT center = ComplexFromString("0.25","-1.5");
+	const BCT big(100000000);
+	BCT rotation = ComplexFromString("0","1");
+	BCT w(1);
+
+	SampCont<BCT> samples;
+	Vec<BCT> sample(2);
+	for (unsigned ii = 0; ii < 8; ++ii)
+	{
+		sample << center + w, big*w + BCT(3);
+		samples.push_back(sample);
+		w *= rotation;
+		if (ii==3)
+			rotation = -rotation; // go around twice, the second time the other way
+	}
+	sample << center + w, big*w + BCT(3);
+	samples.push_back(sample);
+
+	Vec<BCT> mean;
+	MeanOfSamples(mean, samples, 8);
+
+	BOOST_CHECK_EQUAL(mean.size(), 2);
+	BOOST_CHECK(abs(mean(0) - center) < 1e-14);
+	BOOST_CHECK(abs(mean(1) - BCT(3)) < 1e-8);
+}
+
+
 /**
 	In this test we take a univariate polynomial with one solution and ensure that our CircleTrack function returns to the same position. 
 	This is tested by checking that our cauchy_samples has the front and end with the same value roughly.
@@ -1201,10 +1235,73 @@ BOOST_AUTO_TEST_CASE(full_test_cycle_num_greater_than_1)
 	BOOST_CHECK(cauchy_endgame_success==SuccessCode::Success);
 	BOOST_CHECK((my_endgame.FinalApproximation<BCT>() - x_origin).norm() < my_endgame.Tolerances().newton_during_endgame);
 	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+	BOOST_CHECK_EQUAL(my_endgame.PredictedCycleNumber(), 2);
 }// end full_test_cycle_num_greater_than_1
 
 
 
+/**
+\test \b full_test_adaptive_samples_per_loop The same double root as full_test_cycle_num_greater_than_1, adapting the number of samples per loop.  It stays within its bounds, and the root is found as well.
+*/
+BOOST_AUTO_TEST_CASE(full_test_adaptive_samples_per_loop)
+{
+	DefaultPrecision(ambient_precision);
+
+	System sys;
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t"); 
+
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	config::Stepping<BRT> stepping_preferences;
+	config::Newton newton_preferences;
+	newton_preferences.max_num_newton_iterations = 2;
+	newton_preferences.min_num_newton_iterations = 1;
+
+	tracker.Setup(TestedPredictor,
+                RealFromString("1e-5"),
+                RealFromString("1e5"),
+                stepping_preferences,
+                newton_preferences);
+	
+	tracker.PrecisionSetup(precision_config);
+
+	auto time = ComplexFromString("0.1");
+
+	Vec<BCT> sample(1);
+	sample << ComplexFromString("9.000000000000001e-01", "4.358898943540673e-01");
+
+	Vec<BCT> x_origin(1); 
+	x_origin << BCT(1,0);
+
+	config::Cauchy<BRT> cauchy_settings;
+	cauchy_settings.adaptive_samples_per_loop = true;
+	cauchy_settings.min_samples_per_loop = 4;
+	cauchy_settings.max_samples_per_loop = 32;
+
+	TestedEGType my_endgame(tracker, cauchy_settings);
+	BOOST_CHECK_EQUAL(my_endgame.SamplesPerLoop(), my_endgame.EndgameSettings().num_sample_points);
+
+	auto cauchy_endgame_success = my_endgame.Run(time,sample);
+
+	BOOST_CHECK(cauchy_endgame_success==SuccessCode::Success);
+	BOOST_CHECK((my_endgame.FinalApproximation<BCT>() - x_origin).norm() < my_endgame.Tolerances().newton_during_endgame);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+	BOOST_CHECK(my_endgame.SamplesPerLoop() >= 4);
+	BOOST_CHECK(my_endgame.SamplesPerLoop() <= 32);
+}// end full_test_adaptive_samples_per_loop
+
+
+
 
 
 /*
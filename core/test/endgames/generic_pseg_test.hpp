@@ -224,6 +224,52 @@ BOOST_AUTO_TEST_CASE(hermite_interpolation)
 
 
 
+/**
+\test \b hermite_interpolator_slides Samples of t^5 - 2t^2 + 3, pushed one at a time into an interpolator holding three.  Once full, it drops the oldest sample at each push, and matches interpolating the same window from scratch.  Three samples with derivatives determine a quintic, so it is reproduced.
+*/
+BOOST_AUTO_TEST_CASE(hermite_interpolator_slides)
+{
+	DefaultPrecision(ambient_precision);
+
+	unsigned int num_samples = 3;
+	BCT target_time(0,0);
+
+	TimeCont<BCT> times; 
+	SampCont<BCT> samples, derivatives;
+	HermiteInterpolator<BCT> interpolator(num_samples);
+
+	BCT time(1);
+	Vec<BCT> sample(1), derivative(1);
+	for (unsigned ii = 0; ii < 6; ++ii)
+	{
+		time /= BCT(2);
+		BCT time_squared = time*time;
+		sample << time_squared*time_squared*time - BCT(2)*time_squared + BCT(3);
+		derivative << BCT(5)*time_squared*time_squared - BCT(4)*time;
+
+		times.push_back(time);
+		samples.push_back(sample);
+		derivatives.push_back(derivative);
+		interpolator.Push(time, sample, derivative);
+
+		BOOST_CHECK_EQUAL(interpolator.NumSamples(), std::min(ii+1, num_samples));
+		if (ii+1 < num_samples)
+			continue;
+
+		Vec<BCT> slid = interpolator.Interpolate(target_time);
+		Vec<BCT> from_scratch = HermiteInterpolateAndSolve(target_time,num_samples,times,samples,derivatives);
+
+		BOOST_CHECK((slid - from_scratch).norm() < 1e-12);
+		BOOST_CHECK(abs(slid(0) - BCT(3)) < 1e-12);
+	}
+
+	interpolator.Clear();
+	BOOST_CHECK_EQUAL(interpolator.NumSamples(), 0);
+	BOOST_CHECK_EQUAL(interpolator.Capacity(), num_samples);
+}
+
+
+
 
 
 
@@ -419,6 +465,130 @@ BOOST_AUTO_TEST_CASE(compute_cycle_number)
 
 
 
+/**
+\test \b pruned_cycle_number_search_matches_exhaustive On the samples of compute_cycle_number, the search from the last estimate finds the cycle number the exhaustive search does, starting either at it or above it.
+*/
+BOOST_AUTO_TEST_CASE(pruned_cycle_number_search_matches_exhaustive)
+{
+	DefaultPrecision(ambient_precision);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+	sys.AddFunction( pow(x-1,3) );
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	config::Stepping<BRT> stepping_settings;
+	config::Newton newton_settings;
+	tracker.Setup(TestedPredictor,
+                RealFromString("1e-5"),
+                RealFromString("1e5"),
+                stepping_settings,
+                newton_settings);
+	tracker.PrecisionSetup(precision_config);
+
+	TimeCont<BCT> times; 
+	SampCont<BCT> samples; 
+	Vec<BCT> sample(1);
+	for (auto const& ts : std::vector< std::pair<std::string, std::string> >{{".1","-0.729"}, {".05","-0.857375"}, {".025","-0.926859375"}, {".0125","-0.962966796875"}})
+	{
+		times.push_back(ComplexFromString(ts.first));
+		sample << ComplexFromString(ts.second);
+		samples.push_back(sample);
+	}
+
+	config::PowerSeries exhaustive_settings;
+	exhaustive_settings.cycle_number_search_patience = 0;
+	config::Tolerances<BRT> tolerances;
+
+	TestedEGType exhaustive(tracker,exhaustive_settings,tolerances);
+	exhaustive.SetTimes(times);
+	exhaustive.SetSamples(samples);
+	exhaustive.SetRandVec(samples.back());
+	exhaustive.ComputeCycleNumber<BCT>();
+
+	for (unsigned last_estimate : {0u, 1u, 4u})
+	{
+		TestedEGType pruned(tracker,config::PowerSeries(),tolerances);
+		pruned.SetTimes(times);
+		pruned.SetSamples(samples);
+		pruned.SetRandVec(samples.back());
+		pruned.CycleNumber(last_estimate);
+		pruned.ComputeCycleNumber<BCT>();
+
+		BOOST_CHECK_EQUAL(pruned.CycleNumber(), exhaustive.CycleNumber());
+	}
+}
+
+
+
+/**
+\test \b compute_derivatives_at_samples Along the path x = t^2, the derivative at each sample is 2t.  Derivatives are kept until the samples are replaced.
+*/
+BOOST_AUTO_TEST_CASE(compute_derivatives_at_samples)
+{
+	DefaultPrecision(ambient_precision);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+	sys.AddFunction( x - pow(t,2) );
+
+	VariableGroup vars{x};
+	sys.AddVariableGroup(vars); 
+	sys.AddPathVariable(t);
+
+	auto precision_config = PrecisionConfig(sys);
+
+	TrackerType tracker(sys);
+	
+	config::Stepping<BRT> stepping_settings;
+	config::Newton newton_settings;
+
+	tracker.Setup(TestedPredictor,
+                RealFromString("1e-5"),
+                RealFromString("1e5"),
+                stepping_settings,
+                newton_settings);
+	
+	tracker.PrecisionSetup(precision_config);
+
+	TimeCont<BCT> times; 
+	SampCont<BCT> samples; 
+
+	Vec<BCT> sample(1);
+	for (auto time : {ComplexFromString(".1"), ComplexFromString(".05"), ComplexFromString(".025")})
+	{
+		times.push_back(time);
+		sample << time*time;
+		samples.push_back(sample);
+	}
+
+	TestedEGType my_endgame(tracker);
+	my_endgame.SetTimes(times);
+	my_endgame.SetSamples(samples);
+	BOOST_CHECK(my_endgame.GetDerivatives<BCT>().empty());
+
+	my_endgame.ComputeDerivatives<BCT>();
+	my_endgame.ComputeDerivatives<BCT>();
+
+	auto derivatives = my_endgame.GetDerivatives<BCT>();
+	BOOST_CHECK_EQUAL(derivatives.size(), times.size());
+	for (unsigned ii = 0; ii < times.size(); ++ii)
+		BOOST_CHECK(abs(derivatives[ii](0) - BCT(2)*times[ii]) < 1e-12);
+
+	my_endgame.SetSamples(samples);
+	BOOST_CHECK(my_endgame.GetDerivatives<BCT>().empty());
+}
+
+
+
 
 /**
 Compute approximation at origin using three sample points. 
@@ -595,7 +765,7 @@ BOOST_AUTO_TEST_CASE(compute_initial_samples)
 	SampCont<BCT> correct_samples;
 
 	TimeCont<BCT> times; 
-	std::deque<Vec<BCT> > samples;
+	SampCont<BCT> samples;
 	BCT time(1);
 	Vec<BCT> sample(1);
 
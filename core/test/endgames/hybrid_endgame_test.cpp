@@ -0,0 +1,108 @@
+//This file is part of Bertini 2.
+//
+//hybrid_endgame_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//hybrid_endgame_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with hybrid_endgame_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file hybrid_endgame_test.cpp Unit testing for the endgame running the power series endgame, and the Cauchy endgame when that does not converge.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/hybrid_endgame.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+
+BOOST_AUTO_TEST_SUITE(hybrid_endgame)
+
+
+/**
+\test \b hybrid_endgame_switches_only_when_needed The double root 1 of (x-1)^2(1-t) + (x^2+1)t.  The power series endgame finds it, unless allowed too few approximations, when the Cauchy endgame finishes from its samples.
+*/
+BOOST_AUTO_TEST_CASE(hybrid_endgame_switches_only_when_needed)
+{
+	using namespace bertini::tracking;
+	using EndgameType = bertini::instrument::PathStatistics::EndgameType;
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+
+	config::Newton newton_preferences;
+	newton_preferences.max_num_newton_iterations = 2;
+	newton_preferences.min_num_newton_iterations = 1;
+
+	DoublePrecisionTracker tracker(sys);
+	config::Stepping<double> stepping;
+	tracker.Setup(config::Predictor::HeunEuler, 1e-5, 1e5, stepping, newton_preferences);
+
+	EndgameSelector<DoublePrecisionTracker>::Hybrid my_endgame(tracker);
+	BOOST_CHECK(my_endgame.EndgameUsed()==EndgameType::None);
+
+	dbl time(0.1);
+	Vec<dbl> start_point(1);
+	start_point << dbl(9.000000000000001e-01, 4.358898943540673e-01);
+
+	tracker.ResetStatistics();
+	auto code = my_endgame.Run(time, start_point);
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK(my_endgame.EndgameUsed()==EndgameType::PowerSeries);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+	BOOST_CHECK(abs(my_endgame.FinalApproximation<dbl>()(0) - dbl(1)) < 1e-8);
+	BOOST_CHECK(my_endgame.Statistics().endgame==EndgameType::PowerSeries);
+
+	// one approximation is too few for the power series endgame to converge in
+	config::HybridEndgame impatient;
+	impatient.max_power_series_approximations = 1;
+	my_endgame.SetHybridSettings(impatient);
+
+	tracker.ResetStatistics();
+	code = my_endgame.Run(time, start_point);
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK(my_endgame.EndgameUsed()==EndgameType::Cauchy);
+	BOOST_CHECK_EQUAL(my_endgame.CycleNumber(), 2);
+	BOOST_CHECK(abs(my_endgame.FinalApproximation<dbl>()(0) - dbl(1)) < 1e-8);
+
+	auto statistics = my_endgame.Statistics();
+	BOOST_CHECK(statistics.endgame==EndgameType::Cauchy);
+	BOOST_CHECK_EQUAL(statistics.cycle_number, 2);
+	BOOST_CHECK_EQUAL(my_endgame.PowerSeries().PowerSeriesSettings().max_approximations, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+//This file is part of Bertini 2.
+//
+//parallel_endgame_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parallel_endgame_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parallel_endgame_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file parallel_endgame_test.cpp Unit testing for running endgames from many points at the boundary on a pool of threads.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/fixed_prec_cauchy_endgame.hpp"
+#include "bertini2/tracking/parallel_endgame.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+
+BOOST_AUTO_TEST_SUITE(parallel_endgame)
+
+
+/**
+\test \b run_all_endgames_double_root The two paths of (x-1)^2(1-t) + (x^2+1)t, which meet at the double root 1, each run from t=0.1 several times, on two threads.
+*/
+BOOST_AUTO_TEST_CASE(run_all_endgames_double_root)
+{
+	using namespace bertini::tracking;
+	using EndgameType = EndgameSelector<DoublePrecisionTracker>::Cauchy;
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+
+	config::Stepping<double> stepping_preferences;
+	config::Newton newton_preferences;
+	newton_preferences.max_num_newton_iterations = 2;
+	newton_preferences.min_num_newton_iterations = 1;
+
+	std::vector< EndgameStart<dbl> > starts(5);
+	for (std::size_t ii = 0; ii < starts.size(); ++ii)
+	{
+		starts[ii].time = dbl(0.1);
+		starts[ii].point.resize(1);
+		starts[ii].point << dbl(9.000000000000001e-01, ii%2 ? -4.358898943540673e-01 : 4.358898943540673e-01);
+	}
+
+	auto finished = RunAllEndgames<DoublePrecisionTracker, EndgameType>(sys, starts, [&](DoublePrecisionTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::HeunEuler, 1e-5, 1e5, stepping_preferences, newton_preferences);
+		},
+		[](EndgameType &){}, 2);
+
+	BOOST_CHECK_EQUAL(finished.size(), starts.size());
+	for (std::size_t ii = 0; ii < finished.size(); ++ii)
+	{
+		auto const& r = finished[ii];
+		BOOST_CHECK_EQUAL(r.index, ii);
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(r.cycle_number, 2);
+		BOOST_CHECK(abs(r.endpoint(0) - dbl(1)) < 1e-8);
+		BOOST_CHECK(r.accuracy_estimate < config::Tolerances<double>().final_tolerance);
+	}
+
+	std::vector< EndgameStart<dbl> > wrong_size(1);
+	wrong_size[0].time = dbl(0.1);
+	wrong_size[0].point.resize(2);
+	BOOST_CHECK_THROW((RunAllEndgames<DoublePrecisionTracker, EndgameType>(sys, wrong_size, [](DoublePrecisionTracker &){}, [](EndgameType &){})), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
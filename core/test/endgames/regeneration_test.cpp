@@ -0,0 +1,170 @@
+//This file is part of Bertini 2.
+//
+//regeneration_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//regeneration_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with regeneration_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file regeneration_test.cpp Unit testing for solving by regeneration, equation by equation.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "bertini2/tracking/regeneration.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(regeneration)
+
+
+/**
+\test \b regeneration_finds_solutions_of_overdetermined_system x^2-1, y^2-4, xy-2, randomized to two equations, whose four solutions include the two, (1,2) and (-1,-2), of the original system.  The other two are removed as nonsolutions at the last stage.
+*/
+BOOST_AUTO_TEST_CASE(regeneration_finds_solutions_of_overdetermined_system)
+{
+	using namespace bertini::tracking;
+	using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(pow(x,2) - 1);
+	sys.AddFunction(pow(y,2) - 4);
+	sys.AddFunction(x*y - 2);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto solved = Regenerate<AMPTracker, EndgameType>(sys, setup, [](EndgameType &){}, mpfr("0.1"),
+	                                                  config::Regeneration<mpfr_float>(), StagedSolveConfig(), 2);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	BOOST_CHECK_EQUAL(solved.stages.size(), 2);
+	BOOST_CHECK_EQUAL(solved.stages[0].num_kept, 2);
+	BOOST_CHECK_EQUAL(solved.stages[1].num_paths, 4);
+	BOOST_CHECK_EQUAL(solved.stages[1].num_nonsolutions, 2);
+
+	BOOST_REQUIRE_EQUAL(solved.solutions.size(), 2);
+	unsigned num_found(0);
+	for (const auto& s : solved.solutions)
+	{
+		if (abs(s(0) - mpfr(1)) < mpfr_float("1e-10") && abs(s(1) - mpfr(2)) < mpfr_float("1e-10"))
+			num_found++;
+		if (abs(s(0) + mpfr(1)) < mpfr_float("1e-10") && abs(s(1) + mpfr(2)) < mpfr_float("1e-10"))
+			num_found++;
+	}
+	BOOST_CHECK_EQUAL(num_found, 2);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b regeneration_drops_higher_dimensional_points x(y-2), x(x-3), whose solutions are the line x=0 and the point (3,2).  The point of the first stage on x=0 satisfies the second function too, so is dropped, and only the one on y=2 is regenerated.
+*/
+BOOST_AUTO_TEST_CASE(regeneration_drops_higher_dimensional_points)
+{
+	using namespace bertini::tracking;
+	using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*(y-2));
+	sys.AddFunction(x*(x-3));
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto solved = Regenerate<AMPTracker, EndgameType>(sys, setup, [](EndgameType &){}, mpfr("0.1"));
+
+	BOOST_CHECK_EQUAL(solved.stages[0].num_higher_dimensional, 1);
+	BOOST_CHECK_EQUAL(solved.stages[0].num_kept, 1);
+	BOOST_CHECK_EQUAL(solved.stages[1].num_paths, 2);
+
+	BOOST_REQUIRE_EQUAL(solved.solutions.size(), 1);
+	BOOST_CHECK(abs(solved.solutions[0](0) - mpfr(3)) < mpfr_float("1e-10"));
+	BOOST_CHECK(abs(solved.solutions[0](1) - mpfr(2)) < mpfr_float("1e-10"));
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b regeneration_rejects_underdetermined_system One function in two variables has no isolated solutions.
+*/
+BOOST_AUTO_TEST_CASE(regeneration_rejects_underdetermined_system)
+{
+	using namespace bertini::tracking;
+	using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*y - 1);
+
+	BOOST_CHECK_THROW((Regenerate<AMPTracker, EndgameType>(sys, [](AMPTracker &){}, [](EndgameType &){}, mpfr("0.1"))), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
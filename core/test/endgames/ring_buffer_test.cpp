@@ -0,0 +1,130 @@
+//This file is part of Bertini 2.
+//
+//ring_buffer_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//ring_buffer_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with ring_buffer_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file ring_buffer_test.cpp Unit testing for the rings holding the samples of the endgames.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/adaptive_precision_utilities.hpp"
+
+
+using mpfr = bertini::complex;
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(ring_buffer)
+
+
+/**
+\test \b ring_buffer_advances_in_place Pushing at the back and popping from the front, as the endgames advance, keeps the order of the elements, and once the ring has room for them, grows it no more.
+*/
+BOOST_AUTO_TEST_CASE(ring_buffer_advances_in_place)
+{
+	using namespace bertini::tracking;
+
+	TimeCont<double> times;
+	BOOST_CHECK(times.empty());
+
+	times.reserve(4);
+	for (int ii = 0; ii < 3; ++ii)
+		times.push_back(ii);
+	BOOST_CHECK_EQUAL(times.capacity(), 4);
+
+	for (int ii = 3; ii < 20; ++ii)
+	{
+		times.push_back(ii);
+		times.pop_front();
+
+		BOOST_CHECK_EQUAL(times.size(), 3);
+		BOOST_CHECK_EQUAL(times.front(), ii-2);
+		BOOST_CHECK_EQUAL(times[1], ii-1);
+		BOOST_CHECK_EQUAL(times.back(), ii);
+	}
+	BOOST_CHECK_EQUAL(times.capacity(), 4);
+
+	double sum = 0;
+	for (auto t : times)
+		sum += t;
+	BOOST_CHECK_EQUAL(sum, 17+18+19);
+	BOOST_CHECK_EQUAL(times.end()-times.begin(), 3);
+
+	// growing a ring which has wrapped around keeps the order
+	times.push_back(20);
+	times.push_back(times.front());
+	BOOST_CHECK_EQUAL(times.size(), 5);
+	BOOST_CHECK_EQUAL(times.front(), 17);
+	BOOST_CHECK_EQUAL(times[3], 20);
+	BOOST_CHECK_EQUAL(times.back(), 17);
+
+	times.pop_back();
+	BOOST_CHECK_EQUAL(times.back(), 20);
+
+	auto capacity = times.capacity();
+	times.clear();
+	BOOST_CHECK(times.empty());
+	BOOST_CHECK_EQUAL(times.capacity(), capacity);
+}
+
+
+/**
+\test \b ring_buffer_uniform_precision Making samples of mixed precision uniform raises those below the highest, and leaves the rest.
+*/
+BOOST_AUTO_TEST_CASE(ring_buffer_uniform_precision)
+{
+	using namespace bertini::tracking;
+	auto initial_precision = DefaultPrecision();
+
+	TimeCont<mpfr> times;
+	SampCont<mpfr> samples;
+
+	DefaultPrecision(30);
+	Vec<mpfr> sample(2);
+	sample << mpfr(1), mpfr(2);
+	times.push_back(mpfr("0.1"));
+	samples.push_back(sample);
+
+	DefaultPrecision(50);
+	Vec<mpfr> higher_sample(2);
+	higher_sample << mpfr(1), mpfr(2);
+	times.push_back(mpfr("0.05"));
+	samples.push_back(higher_sample);
+
+	DefaultPrecision(30);
+	auto precision = endgame::adaptive::EnsureAtUniformPrecision(times, samples);
+	BOOST_CHECK_EQUAL(precision, 50);
+
+	for (const auto& s : samples)
+		for (int ii = 0; ii < s.size(); ++ii)
+			BOOST_CHECK_EQUAL(bertini::Precision(s(ii)), 50);
+	for (const auto& t : times)
+		BOOST_CHECK_EQUAL(bertini::Precision(t), 50);
+
+	DefaultPrecision(initial_precision);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+//This file is part of Bertini 2.
+//
+//staged_solve_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//staged_solve_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with staged_solve_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file staged_solve_test.cpp Unit testing for solving in stages, tracking to the endgame boundary, then finishing by Newton's method or the endgame.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/start_system.hpp"
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "bertini2/tracking/staged_solve.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(staged_solve)
+
+
+/**
+\test \b staged_solve_sends_only_singular_paths_to_endgame x^2(x-1) from a total degree start system.  The path to the simple root 1 is finished by Newton's method, and the two to the double root 0 by the endgame.
+*/
+BOOST_AUTO_TEST_CASE(staged_solve_sends_only_singular_paths_to_endgame)
+{
+	using namespace bertini::tracking;
+	using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(pow(x,2)*(x-1));
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto homotopy = (1-t)*sys + t*TD;
+	homotopy.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(homotopy);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto solved = SolveInStages<AMPTracker, EndgameType>(homotopy, TD, setup, [](EndgameType &){},
+	                                                    mpfr(1), mpfr("0.1"), StagedSolveConfig(), 2);
+
+	BOOST_CHECK_EQUAL(solved.paths.size(), 3);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+
+	unsigned num_by_newton(0), num_by_endgame(0);
+	for (std::size_t ii = 0; ii < solved.paths.size(); ++ii)
+	{
+		auto const& r = solved.paths[ii];
+		BOOST_CHECK_EQUAL(r.index, ii);
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(solved.retracks[ii], 0);
+
+		auto s = homotopy.DehomogenizePoint(r.endpoint);
+		if (solved.finished_by[ii]==FinishedBy::Newton)
+		{
+			num_by_newton++;
+			BOOST_CHECK_EQUAL(solved.cycle_numbers[ii], 1);
+			BOOST_CHECK(abs(s(0) - mpfr(1)) < mpfr_float("1e-10"));
+		}
+		else if (solved.finished_by[ii]==FinishedBy::Endgame)
+		{
+			num_by_endgame++;
+			BOOST_CHECK(abs(s(0)) < mpfr_float("1e-6"));
+		}
+	}
+	BOOST_CHECK_EQUAL(num_by_newton, 1);
+	BOOST_CHECK_EQUAL(num_by_endgame, 2);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b crossed_paths_are_those_sharing_a_well_conditioned_point x^2 - 1 - t, y - t at the boundary t=0.1.  Two paths reaching (sqrt(1.1),0.1) crossed, while one at (-sqrt(1.1),0.1) did not, nor did a failed path.  Two paths reaching (0,0.1) for x^2, y - t, at which the Jacobian is singular, are not taken to have crossed.
+*/
+BOOST_AUTO_TEST_CASE(crossed_paths_are_those_sharing_a_well_conditioned_point)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System homotopy;
+	homotopy.AddVariableGroup(VariableGroup{x,y});
+	homotopy.AddFunction(pow(x,2) - 1 - t);
+	homotopy.AddFunction(y - t);
+	homotopy.AddPathVariable(t);
+
+	const mpfr boundary_time("0.1");
+	const mpfr root = sqrt(mpfr("1.1"));
+
+	auto at = [&](std::size_t index, mpfr const& a, SuccessCode code)
+	{
+		PathResult<mpfr> r;
+		r.index = index;
+		r.success_code = code;
+		r.time = boundary_time;
+		r.endpoint.resize(2);
+		r.endpoint << a, boundary_time;
+		return r;
+	};
+
+	std::vector< PathResult<mpfr> > at_boundary{at(0, root, SuccessCode::Success),
+	                                            at(1, -root, SuccessCode::Success),
+	                                            at(2, root, SuccessCode::Success),
+	                                            at(3, -root, SuccessCode::MaxNumStepsTaken)};
+
+	auto crossed = detail::CrossedPaths(homotopy, at_boundary, boundary_time, StagedSolveConfig());
+	BOOST_REQUIRE_EQUAL(crossed.size(), 2);
+	BOOST_CHECK_EQUAL(crossed[0], 0);
+	BOOST_CHECK_EQUAL(crossed[1], 2);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+
+	System singular;
+	singular.AddVariableGroup(VariableGroup{x,y});
+	singular.AddFunction(pow(x,2));
+	singular.AddFunction(y - t);
+	singular.AddPathVariable(t);
+
+	std::vector< PathResult<mpfr> > at_double_root{at(0, mpfr(0), SuccessCode::Success),
+	                                               at(1, mpfr(0), SuccessCode::Success)};
+	BOOST_CHECK(detail::CrossedPaths(singular, at_double_root, boundary_time, StagedSolveConfig()).empty());
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
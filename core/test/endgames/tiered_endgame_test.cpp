@@ -0,0 +1,116 @@
+//This file is part of Bertini 2.
+//
+//tiered_endgame_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//tiered_endgame_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with tiered_endgame_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file tiered_endgame_test.cpp Unit testing for running an endgame in double precision first, and in adaptive precision only if that does not suffice.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/fixed_prec_cauchy_endgame.hpp"
+#include "bertini2/tracking/amp_cauchy_endgame.hpp"
+#include "bertini2/tracking/tiered_endgame.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(tiered_endgame)
+
+
+/**
+\test \b tiered_endgame_double_then_multiple The double root 1 of (x-1)^2(1-t) + (x^2+1)t.  The endgame in double precision finds it, and double precision suffices, until the safety digits demanded are more than double precision has.
+*/
+BOOST_AUTO_TEST_CASE(tiered_endgame_double_then_multiple)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddFunction( pow(x-1,2)*(1-t) + (pow(x,2) + 1)*t);
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+
+	auto AMP = config::AMPConfigFrom(sys);
+	config::Newton newton_preferences;
+	newton_preferences.max_num_newton_iterations = 2;
+	newton_preferences.min_num_newton_iterations = 1;
+
+	DoublePrecisionTracker double_tracker(sys);
+	config::Stepping<double> double_stepping;
+	double_tracker.Setup(config::Predictor::HeunEuler, 1e-5, 1e5, double_stepping, newton_preferences);
+
+	AMPTracker amp_tracker(sys);
+	config::Stepping<mpfr_float> amp_stepping;
+	amp_tracker.Setup(config::Predictor::HeunEuler, mpfr_float("1e-5"), mpfr_float("1e5"), amp_stepping, newton_preferences);
+	amp_tracker.PrecisionSetup(AMP);
+
+	EndgameSelector<DoublePrecisionTracker>::Cauchy double_endgame(double_tracker);
+	EndgameSelector<AMPTracker>::Cauchy amp_endgame(amp_tracker);
+
+	mpfr time("0.1");
+	Vec<mpfr> start_point(1);
+	start_point << mpfr("9.000000000000001e-01", "4.358898943540673e-01");
+
+	auto result = RunTieredEndgame(double_endgame, amp_endgame, time, start_point, AMP);
+
+	BOOST_CHECK(result.success_code==SuccessCode::Success);
+	BOOST_CHECK(result.tier==EndgameTier::Double);
+	BOOST_CHECK_EQUAL(result.cycle_number, 2);
+	BOOST_CHECK_EQUAL(Precision(result.endpoint(0)), bertini::DoublePrecision());
+	BOOST_CHECK(abs(result.endpoint(0) - mpfr(1)) < mpfr_float("1e-8"));
+
+	// demanding more safe digits than double precision has sends the path to the adaptive precision endgame
+	DefaultPrecision(30);
+	auto demanding = AMP;
+	demanding.safety_digits_1 = 20;
+	result = RunTieredEndgame(double_endgame, amp_endgame, time, start_point, demanding);
+
+	BOOST_CHECK(result.success_code==SuccessCode::Success);
+	BOOST_CHECK(result.tier==EndgameTier::Multiple);
+	BOOST_CHECK_EQUAL(result.cycle_number, 2);
+	BOOST_CHECK(abs(result.endpoint(0) - mpfr(1)) < mpfr_float("1e-8"));
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -45,6 +45,8 @@ using LoggingInit = bertini::LoggingInit;
 
 #include "bertini2/system_pool.hpp"
 
+#include <thread>
+
 #define BERTINI_MAKE_VARIABLE(name) \
 std::shared_ptr<bertini::node::Variable> name = std::make_shared<bertini::node::Variable>("name");
 
@@ -116,6 +118,68 @@ BOOST_AUTO_TEST_CASE(add_ptr_sys_to_pool)
 	BOOST_CHECK(result.get() == sys.get());
 }
 
+
+BOOST_AUTO_TEST_CASE(same_instance_for_same_worker_and_precision)
+{
+	System sys;
+	BERTINI_MAKE_VARIABLE(x)
+	BERTINI_MAKE_VARIABLE(y)
+
+	sys.AddVariableGroup(VariableGroup({x,y}));
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x - y);
+
+	SystemPool sp(sys);
+
+	auto a = sp.Acquire(0, 30);
+	auto b = sp.Acquire(0, 30);
+	auto c = sp.Acquire(1, 30);
+	auto d = sp.Acquire(0, 50);
+
+	BOOST_CHECK(a == b);
+	BOOST_CHECK(a != c);
+	BOOST_CHECK(a != d);
+	BOOST_CHECK(a.get() != &sys);
+	BOOST_CHECK_EQUAL(a->precision(), 30);
+	BOOST_CHECK_EQUAL(d->precision(), 50);
+	BOOST_CHECK_EQUAL(sp.NumInstances(), 3);
+	BOOST_CHECK(sp.ApproximateBytes() > 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(only_idle_instances_are_evicted)
+{
+	System sys;
+	BERTINI_MAKE_VARIABLE(x)
+
+	sys.AddVariableGroup(VariableGroup({x}));
+	sys.AddFunction(x*x - 2);
+
+	SystemPool sp(sys);
+
+	auto held = sp.Acquire(0, 16);
+	sp.Acquire(1, 16);
+	sp.Acquire(2, 16);
+
+	// every instance was acquired since the last eviction, so none is evicted yet
+	BOOST_CHECK_EQUAL(sp.EvictIdle(), 0);
+	BOOST_CHECK_EQUAL(sp.EvictIdle(), 2);
+	BOOST_CHECK_EQUAL(sp.NumInstances(), 1);
+
+	sp.Acquire(1, 16);
+	sp.Acquire(2, 16);
+	sp.MaxBytes(1);
+	BOOST_CHECK_EQUAL(sp.NumInstances(), 1);
+	BOOST_CHECK(sp.Acquire(0, 16) == held);
+}
+
+
+BOOST_AUTO_TEST_CASE(acquire_without_master_throws)
+{
+	SystemPool sp;
+	BOOST_CHECK_THROW(sp.Acquire(0, 16), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -132,6 +196,98 @@ BOOST_AUTO_TEST_CASE(make_double_point_point)
 {
 	PointPool<dbl> pool;
 }
+
+
+BOOST_AUTO_TEST_CASE(point_handed_back_is_recycled_for_same_size)
+{
+	PointPool<dbl> pool;
+
+	dbl* storage;
+	{
+		auto v = pool.Acquire(5);
+		BOOST_CHECK_EQUAL(v->size(), 5);
+		storage = v->data();
+		BOOST_CHECK_EQUAL(pool.NumFree(), 0);
+	}
+	BOOST_CHECK_EQUAL(pool.NumFree(), 1);
+
+	{
+		auto w = pool.Acquire(3);
+		BOOST_CHECK_EQUAL(w->size(), 3);
+		BOOST_CHECK_EQUAL(pool.NumFree(), 1);
+	}
+
+	auto v = pool.Acquire(5);
+	BOOST_CHECK(v->data() == storage);
+	BOOST_CHECK_EQUAL(pool.NumFree(), 1);
+
+	pool.PurgeCache();
+	BOOST_CHECK_EQUAL(pool.NumFree(), 0);
+}
+
+
+BOOST_AUTO_TEST_CASE(handle_outlives_pool)
+{
+	PointPool<dbl>::Handle v;
+	{
+		PointPool<dbl> pool;
+		v = pool.Acquire(2);
+	}
+	(*v)(0) = dbl(1,2);
+	BOOST_CHECK(v);
+}
+
+
+BOOST_AUTO_TEST_CASE(points_drawn_and_returned_from_many_threads)
+{
+	PointPool<dbl> pool;
+
+	std::vector<std::thread> threads;
+	for (unsigned ii = 0; ii < 4; ++ii)
+		threads.emplace_back([&pool]()
+		{
+			for (unsigned jj = 0; jj < 1000; ++jj)
+			{
+				auto a = pool.Acquire(4);
+				auto b = pool.Acquire(4);
+				(*a)(0) = (*b)(3) = dbl(jj,0);
+			}
+		});
+	for (auto& t : threads)
+		t.join();
+
+	// at most two per thread were ever on loan at once
+	BOOST_CHECK(pool.NumFree() <= 8);
+	BOOST_CHECK(pool.NumFree() >= 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(multiple_precision_point_pool)
+
+using namespace bertini;
+
+BOOST_AUTO_TEST_CASE(recycled_point_is_at_default_precision)
+{
+	const auto previous = DefaultPrecision();
+	PointPool<mpfr> pool;
+
+	DefaultPrecision(50);
+	{
+		auto v = pool.Acquire(3);
+		BOOST_CHECK_EQUAL(Precision((*v)(0)), 50);
+	}
+
+	DefaultPrecision(100);
+	auto v = pool.Acquire(3);
+	BOOST_CHECK_EQUAL(pool.NumFree(), 0);
+	BOOST_CHECK_EQUAL(Precision((*v)(0)), 100);
+	BOOST_CHECK_EQUAL(Precision((*v)(2)), 100);
+
+	DefaultPrecision(previous);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
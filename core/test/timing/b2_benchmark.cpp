@@ -0,0 +1,662 @@
+//This file is part of Bertini 2.
+//
+//b2_benchmark.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2_benchmark.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2_benchmark.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file b2_benchmark.cpp
+
+\brief Benchmarks of evaluation, linear algebra, tracking, endgames and full solves, on a standard set of problems, written as JSON.
+
+## Use
+
+\code
+b2_benchmark [--quick] [--problems katsura:5,cyclic:5] [--threads 1,2,4] [--precisions 30,64,128] [--system file] [--counters] [--output results.json]
+\endcode
+
+The problems are Katsura-n, cyclic-n, eco-n, noon-n, and dense:n:d, n random dense polynomials of degree d in n variables.  Each is timed at:
+
+- eval and jacobian, in double precision and in multiple precision at each of the precisions;
+- lu, factoring the Jacobian and solving with it, likewise;
+- track_path, from the start points of a total degree homotopy to the endgame boundary, one path at a time;
+- endgame, the power series endgame from the boundary to t=0, one path at a time;
+- solve, all paths by SolveInStages, at each thread count.
+
+A system read from a file with --system is timed at eval, jacobian and lu only.  Each record of the output has the problem, its size, the measure, number type, precision and number of threads, the number of operations timed and the seconds per operation.
+
+With --counters, the measures run on one thread also have the cycles, instructions, cache references and misses, and branches and mispredicted branches per operation, counted by perf_event_open, see perf_counters.hpp, and the instructions per cycle.  Where counting is refused, the timings are written without them.
+*/
+
+#include "bertini2/bertini.hpp"
+#include "bertini2/start_system.hpp"
+#include "bertini2/tracking.hpp"
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+#include "perf_counters.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+
+
+using System = bertini::System;
+using Var = std::shared_ptr<bertini::node::Variable>;
+using Nd = std::shared_ptr<bertini::node::Node>;
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = bertini::dbl;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+namespace {
+
+	/**
+	\brief The options of a run.
+	*/
+	struct Options
+	{
+		bool quick = false;
+		bool counters = false;
+		std::vector<std::string> problems;
+		std::vector<unsigned> threads;
+		std::vector<unsigned> precisions{30, 64, 128};
+		std::string system_file;
+		std::string output;
+	};
+
+
+	/**
+	\brief One timed measurement, a record of the output.
+	*/
+	struct Record
+	{
+		std::string problem;
+		unsigned num_variables;
+		unsigned num_functions;
+		std::string measure;
+		std::string number_type;
+		unsigned precision;
+		unsigned threads;
+		std::size_t operations;
+		double seconds_per_operation;
+		bertini::benchmark::PerfCounts counters; ///< Per operation, if counted.
+	};
+
+
+	/**
+	\brief The operations timed, the seconds each took, and the hardware events of each, if counted.
+	*/
+	struct Measurement
+	{
+		std::size_t operations;
+		double seconds_per_operation;
+		bertini::benchmark::PerfCounts counters;
+	};
+
+
+	// the hardware counters of the main thread, if asked for and available
+	bertini::benchmark::PerfCounters* perf_counters = nullptr;
+
+
+	std::vector<std::string> Split(std::string const& s, char separator)
+	{
+		std::vector<std::string> parts;
+		std::stringstream in(s);
+		std::string part;
+		while (std::getline(in, part, separator))
+			if (!part.empty())
+				parts.push_back(part);
+		return parts;
+	}
+
+
+	std::vector<unsigned> SplitNumbers(std::string const& s)
+	{
+		std::vector<unsigned> numbers;
+		for (auto const& part : Split(s, ','))
+			numbers.push_back(static_cast<unsigned>(std::stoul(part)));
+		return numbers;
+	}
+
+
+	std::vector<Var> MakeVariables(std::string const& prefix, unsigned n)
+	{
+		std::vector<Var> x;
+		for (unsigned ii = 0; ii < n; ++ii)
+			x.push_back(bertini::node::MakeNode<bertini::node::Variable>(prefix + std::to_string(ii)));
+		return x;
+	}
+
+
+	System FromVariables(std::vector<Var> const& x, std::vector<Nd> const& functions)
+	{
+		System sys;
+		sys.AddVariableGroup(VariableGroup(x.begin(), x.end()));
+		for (auto const& f : functions)
+			sys.AddFunction(f);
+		return sys;
+	}
+
+
+	/**
+	Katsura-n, in n+1 variables.  The sums run over the indices l from -n to n, with x_{-l} = x_l and x_l = 0 for l > n.
+	*/
+	System Katsura(unsigned n)
+	{
+		const auto x = MakeVariables("x", n+1);
+		auto at = [&](int l) -> Nd { l = std::abs(l); return l <= static_cast<int>(n) ? Nd(x[l]) : Nd(); };
+
+		std::vector<Nd> functions;
+		for (int m = 0; m < static_cast<int>(n); ++m)
+		{
+			Nd f = -x[m];
+			for (int l = -static_cast<int>(n); l <= static_cast<int>(n); ++l)
+				if (at(l) && at(m-l))
+					f = f + at(l)*at(m-l);
+			functions.push_back(f);
+		}
+
+		Nd last = x[0] - 1;
+		for (unsigned ii = 1; ii <= n; ++ii)
+			last = last + 2*x[ii];
+		functions.push_back(last);
+		return FromVariables(x, functions);
+	}
+
+
+	/**
+	Cyclic-n:  the elementary cyclic sums of degree 1 through n-1, and the product less one.
+	*/
+	System Cyclic(unsigned n)
+	{
+		const auto x = MakeVariables("x", n);
+
+		std::vector<Nd> functions;
+		for (unsigned k = 1; k < n; ++k)
+		{
+			Nd f;
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				Nd term = x[ii];
+				for (unsigned jj = 1; jj < k; ++jj)
+					term = term*x[(ii+jj)%n];
+				f = f ? f + term : term;
+			}
+			functions.push_back(f);
+		}
+
+		Nd product = x[0];
+		for (unsigned ii = 1; ii < n; ++ii)
+			product = product*x[ii];
+		functions.push_back(product - 1);
+		return FromVariables(x, functions);
+	}
+
+
+	/**
+	Eco-n, the economics problem, in n variables.
+	*/
+	System Eco(unsigned n)
+	{
+		const auto x = MakeVariables("x", n);
+
+		std::vector<Nd> functions;
+		for (unsigned k = 1; k < n; ++k)
+		{
+			Nd f = x[k-1];
+			for (unsigned ii = 1; ii + k < n; ++ii)
+				f = f + x[ii-1]*x[ii+k-1];
+			functions.push_back(f*x[n-1] - static_cast<int>(k));
+		}
+
+		Nd last = x[0] + 1;
+		for (unsigned ii = 1; ii + 1 < n; ++ii)
+			last = last + x[ii];
+		functions.push_back(last);
+		return FromVariables(x, functions);
+	}
+
+
+	/**
+	Noon-n, the neural network model.
+	*/
+	System Noon(unsigned n)
+	{
+		const auto x = MakeVariables("x", n);
+
+		std::vector<Nd> functions;
+		for (unsigned ii = 0; ii < n; ++ii)
+		{
+			Nd squares;
+			for (unsigned jj = 0; jj < n; ++jj)
+				if (jj!=ii)
+					squares = squares ? squares + pow(x[jj],2) : pow(x[jj],2);
+			functions.push_back(x[ii]*squares - mpfr_float("1.1")*x[ii] + 1);
+		}
+		return FromVariables(x, functions);
+	}
+
+
+	/**
+	n polynomials in n variables, each with every monomial of degree at most d, with random complex coefficients.
+	*/
+	System Dense(unsigned n, unsigned d)
+	{
+		const auto x = MakeVariables("x", n);
+
+		// the exponents of every monomial of degree at most d, by counting in base d+1
+		std::vector< std::vector<unsigned> > monomials;
+		std::vector<unsigned> exponents(n, 0);
+		while (true)
+		{
+			unsigned degree = 0;
+			for (auto e : exponents)
+				degree += e;
+			if (degree <= d)
+				monomials.push_back(exponents);
+
+			unsigned ii = 0;
+			while (ii < n && ++exponents[ii] > d)
+				exponents[ii++] = 0;
+			if (ii==n)
+				break;
+		}
+
+		std::vector<Nd> functions;
+		for (unsigned ii = 0; ii < n; ++ii)
+		{
+			Nd f;
+			for (auto const& m : monomials)
+			{
+				mpfr c;
+				bertini::RandomComplex(c, 20);
+				Nd term = bertini::node::MakeNode<bertini::node::Float>(c);
+				for (unsigned jj = 0; jj < n; ++jj)
+					if (m[jj] > 0)
+						term = term*pow(x[jj], static_cast<int>(m[jj]));
+				f = f ? f + term : term;
+			}
+			functions.push_back(f);
+		}
+		return FromVariables(x, functions);
+	}
+
+
+	/**
+	\brief Make a problem from its name, katsura:n, cyclic:n, eco:n, noon:n or dense:n:d.
+	*/
+	System MakeProblem(std::string const& spec, std::string & name)
+	{
+		const auto parts = Split(spec, ':');
+		if (parts.size() < 2)
+			throw std::runtime_error("problem '" + spec + "' is not of the form kind:size");
+
+		const auto n = static_cast<unsigned>(std::stoul(parts[1]));
+		name = parts[0] + "-" + parts[1];
+		if (parts[0]=="katsura")
+			return Katsura(n);
+		if (parts[0]=="cyclic")
+			return Cyclic(n);
+		if (parts[0]=="eco")
+			return Eco(n);
+		if (parts[0]=="noon")
+			return Noon(n);
+		if (parts[0]=="dense" && parts.size()==3)
+		{
+			name += "-" + parts[2];
+			return Dense(n, static_cast<unsigned>(std::stoul(parts[2])));
+		}
+		throw std::runtime_error("unknown problem '" + spec + "'");
+	}
+
+
+	/**
+	\brief Time an operation, repeating it until at least min_seconds have passed, and count its hardware events.
+	*/
+	template<typename Operation>
+	Measurement Time(double min_seconds, Operation op)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		op(); // once untimed, to fill caches and compile programs
+
+		std::size_t count = 0;
+		std::size_t batch = 1;
+		if (perf_counters)
+			perf_counters->Start();
+		const auto start = Clock::now();
+		double elapsed = 0;
+		while (elapsed < min_seconds)
+		{
+			for (std::size_t ii = 0; ii < batch; ++ii)
+				op();
+			count += batch;
+			batch *= 2;
+			elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		}
+		const auto counts = perf_counters ? perf_counters->Stop() : bertini::benchmark::PerfCounts();
+		return Measurement{count, elapsed/count, counts.PerOperation(count)};
+	}
+
+
+	/**
+	\brief Time an operation done once, which does a number of operations, and count its hardware events.
+	*/
+	template<typename Operation>
+	Measurement TimeOnce(std::size_t operations, Operation op)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		if (perf_counters)
+			perf_counters->Start();
+		const auto start = Clock::now();
+		op();
+		const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		const auto counts = perf_counters ? perf_counters->Stop() : bertini::benchmark::PerfCounts();
+		return Measurement{operations, elapsed/operations, counts.PerOperation(operations)};
+	}
+
+
+	/**
+	\brief Time evaluation, the Jacobian, and LU, in one number type, at the current default precision.
+	*/
+	template<typename T>
+	void BenchmarkLinearAlgebra(System const& sys, std::string const& name, std::string const& number_type, unsigned precision,
+	                            Options const& options, std::vector<Record> & records)
+	{
+		const double min_seconds = options.quick ? 0.05 : 0.5;
+
+		Vec<T> x(sys.NumVariables());
+		for (int ii = 0; ii < x.size(); ++ii)
+			x(ii) = T(bertini::rand_complex());
+		T time(bertini::rand_complex());
+
+		auto record = [&](std::string const& measure, Measurement const& timed)
+			{
+				records.push_back(Record{name, static_cast<unsigned>(sys.NumVariables()), static_cast<unsigned>(sys.NumTotalFunctions()),
+				                         measure, number_type, precision, 1, timed.operations, timed.seconds_per_operation, timed.counters});
+			};
+
+		const bool timed = sys.HavePathVariable();
+		Vec<T> f;
+		Mat<T> J;
+		record("eval", Time(min_seconds, [&]{ f = timed ? sys.Eval(x, time) : sys.Eval(x); }));
+		record("jacobian", Time(min_seconds, [&]{ J = timed ? sys.Jacobian(x, time) : sys.Jacobian(x); }));
+
+		if (J.rows()!=J.cols())
+			return;
+
+		bertini::PartialPivotLU<T> lu(J.rows());
+		Vec<T> dx(J.rows());
+		record("lu", Time(min_seconds, [&]{ lu.Factor(J); lu.Solve(dx, f); }));
+	}
+
+
+	void BenchmarkAllPrecisions(System const& sys, std::string const& name, Options const& options, std::vector<Record> & records)
+	{
+		const auto precision = DefaultPrecision();
+
+		DefaultPrecision(bertini::DoublePrecision());
+		sys.precision(bertini::DoublePrecision());
+		BenchmarkLinearAlgebra<dbl>(sys, name, "dbl", bertini::DoublePrecision(), options, records);
+
+		for (auto p : options.precisions)
+		{
+			DefaultPrecision(p);
+			sys.precision(p);
+			BenchmarkLinearAlgebra<mpfr>(sys, name, "mpfr", p, options, records);
+		}
+
+		DefaultPrecision(precision);
+		sys.precision(precision);
+	}
+
+
+	/**
+	\brief Time tracking single paths, the endgame, and full solves at each thread count, on the total degree homotopy of a problem.
+	*/
+	void BenchmarkSolve(System target, std::string const& name, Options const& options, std::vector<Record> & records)
+	{
+		using namespace bertini::tracking;
+		using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+
+		const unsigned num_variables = target.NumVariables();
+		const unsigned num_functions = target.NumFunctions();
+
+		target.Homogenize();
+		target.AutoPatch();
+
+		auto TD = bertini::start_system::TotalDegree(target);
+		TD.Homogenize();
+
+		auto t = bertini::node::MakeNode<bertini::node::Variable>("t");
+		auto homotopy = (1-t)*target + t*TD;
+		homotopy.AddPathVariable(t);
+
+		config::Stepping<mpfr_float> stepping;
+		config::Newton newton;
+		auto AMP = config::AMPConfigFrom(homotopy);
+		auto setup = [&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-6"), mpfr_float("1e5"), stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			};
+
+		const mpfr start_time(1), boundary_time("0.1");
+		const std::size_t num_paths = static_cast<std::size_t>(TD.NumStartPoints());
+		const std::size_t num_single = std::min<std::size_t>(num_paths, options.quick ? 2 : 8);
+
+		auto record = [&](std::string const& measure, unsigned threads, Measurement const& timed)
+			{
+				records.push_back(Record{name, num_variables, num_functions, measure, "amp", DefaultPrecision(), threads, timed.operations, timed.seconds_per_operation, timed.counters});
+			};
+
+		// one path at a time, then the endgame from where each reached
+		AMPTracker tracker(homotopy);
+		setup(tracker);
+		std::vector< Vec<mpfr> > at_boundary;
+		record("track_path", 1, TimeOnce(num_single, [&]
+			{
+				for (std::size_t ii = 0; ii < num_single; ++ii)
+				{
+					Vec<mpfr> endpoint;
+					if (tracker.TrackPath(endpoint, start_time, boundary_time, TD.StartPoint<mpfr>(ii))==SuccessCode::Success)
+						at_boundary.push_back(endpoint);
+				}
+			}));
+
+		if (!at_boundary.empty())
+		{
+			EndgameType endgame(tracker);
+			record("endgame", 1, TimeOnce(at_boundary.size(), [&]
+				{
+					for (auto const& p : at_boundary)
+						endgame.Run(boundary_time, p);
+				}));
+		}
+
+		for (auto threads : options.threads)
+		{
+			auto timed = TimeOnce(num_paths, [&]
+				{
+					SolveInStages<AMPTracker, EndgameType>(homotopy, TD, setup, [](EndgameType &){}, start_time, boundary_time, StagedSolveConfig(), threads);
+				});
+			// the counters see only the calling thread, which is one worker of several
+			if (threads > 1)
+				timed.counters = bertini::benchmark::PerfCounts();
+			record("solve", threads, timed);
+		}
+	}
+
+
+	std::string Escape(std::string const& s)
+	{
+		std::string escaped;
+		for (auto c : s)
+		{
+			if (c=='"' || c=='\\')
+				escaped += '\\';
+			escaped += c;
+		}
+		return escaped;
+	}
+
+
+	void WriteJson(std::ostream & out, Options const& options, std::vector<Record> const& records)
+	{
+		out << "{\n";
+		out << "  \"benchmark\": \"b2_benchmark\",\n";
+		out << "  \"quick\": " << (options.quick ? "true" : "false") << ",\n";
+		out << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+		out << "  \"counters\": " << (perf_counters ? "true" : "false") << ",\n";
+		out << "  \"results\": [";
+		for (std::size_t ii = 0; ii < records.size(); ++ii)
+		{
+			auto const& r = records[ii];
+			out << (ii ? ",\n" : "\n")
+			    << "    {\"problem\": \"" << Escape(r.problem) << "\""
+			    << ", \"variables\": " << r.num_variables
+			    << ", \"functions\": " << r.num_functions
+			    << ", \"measure\": \"" << r.measure << "\""
+			    << ", \"number_type\": \"" << r.number_type << "\""
+			    << ", \"precision\": " << r.precision
+			    << ", \"threads\": " << r.threads
+			    << ", \"operations\": " << r.operations
+			    << ", \"seconds_per_operation\": " << std::setprecision(6) << std::scientific << r.seconds_per_operation;
+			r.counters.WriteJsonFields(out, "_per_operation");
+			out << std::defaultfloat
+			    << "}";
+		}
+		out << "\n  ]\n}\n";
+	}
+
+
+	Options ParseOptions(int argc, char** argv)
+	{
+		Options options;
+		for (int ii = 1; ii < argc; ++ii)
+		{
+			const std::string arg(argv[ii]);
+			auto value = [&]() -> std::string
+				{
+					if (ii+1 >= argc)
+						throw std::runtime_error("option " + arg + " needs a value");
+					return argv[++ii];
+				};
+
+			if (arg=="--quick")
+				options.quick = true;
+			else if (arg=="--problems")
+				options.problems = Split(value(), ',');
+			else if (arg=="--threads")
+				options.threads = SplitNumbers(value());
+			else if (arg=="--precisions")
+				options.precisions = SplitNumbers(value());
+			else if (arg=="--system")
+				options.system_file = value();
+			else if (arg=="--counters")
+				options.counters = true;
+			else if (arg=="--output")
+				options.output = value();
+			else
+				throw std::runtime_error("unknown option " + arg);
+		}
+
+		if (options.problems.empty() && options.system_file.empty())
+			options.problems = options.quick ? std::vector<std::string>{"katsura:3", "cyclic:4", "eco:4", "noon:3", "dense:3:2"}
+			                                 : std::vector<std::string>{"katsura:5", "cyclic:5", "eco:6", "noon:4", "dense:4:3"};
+
+		if (options.threads.empty())
+		{
+			const auto max_threads = bertini::detail::DefaultNumWorkers();
+			for (unsigned threads = 1; threads < max_threads; threads *= 2)
+				options.threads.push_back(threads);
+			options.threads.push_back(max_threads);
+		}
+		return options;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		const auto options = ParseOptions(argc, argv);
+		DefaultPrecision(30);
+
+		bertini::benchmark::PerfCounters counters(options.counters);
+		if (counters.Available())
+			perf_counters = &counters;
+		else if (options.counters)
+			std::cerr << "hardware counters are not available, timing without them\n";
+
+		std::vector<Record> records;
+
+		if (!options.system_file.empty())
+		{
+			std::ifstream fin(options.system_file);
+			if (!fin)
+				throw std::runtime_error("could not read system file " + options.system_file);
+			std::stringstream buffer;
+			buffer << fin.rdbuf();
+
+			System sys(buffer.str());
+			BenchmarkAllPrecisions(sys, options.system_file, options, records);
+		}
+
+		for (auto const& spec : options.problems)
+		{
+			std::string name;
+			auto sys = MakeProblem(spec, name);
+			std::cerr << "benchmarking " << name << "\n";
+
+			BenchmarkAllPrecisions(sys, name, options, records);
+			BenchmarkSolve(sys, name, options, records);
+		}
+
+		if (options.output.empty())
+			WriteJson(std::cout, options, records);
+		else
+		{
+			std::ofstream out(options.output);
+			WriteJson(out, options, records);
+		}
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << "b2_benchmark: " << e.what() << "\n";
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,423 @@
+//This file is part of Bertini 2.
+//
+//b2_classic_benchmark.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2_classic_benchmark.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2_classic_benchmark.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file b2_classic_benchmark.cpp
+
+\brief Solves of a corpus of Bertini classic input files, timed by phase, with the success and precision of their paths, written as JSON in the format of b2_benchmark.
+
+## Use
+
+\code
+b2_classic_benchmark [--threads 1,4] [--output results.json] input_file...
+\endcode
+
+Each input file is read as Bertini 1.x reads it, split into its config and input sections by classic::PreprocessedInputFile, and its input section parsed into a System.  The config section is not read; every file is solved with the settings b2_benchmark uses, by the total degree homotopy, see SolveInStages.  Files whose systems are not square, or which declare their own path variable, are reported as skipped.
+
+Each file is timed at:
+
+- parse, reading and parsing the file, once;
+- track_to_boundary, TrackAllPaths from the start points to the endgame boundary, per path;
+- finish, FinishPaths from the boundary to t=0, per path;
+- solve, the two together, per path;
+
+at each thread count.  The records of these are those of b2_benchmark.  Each file also has a record in "paths", of the number of paths, how many succeeded, were finished by Newton's method or the endgame, or failed, their steps accepted and rejected, and the highest and mean of the highest precision of each.
+
+run_bertini_classic.sh runs Bertini 1.x on the same files, and writes its timings in the same format, and compare_classic.py makes a side-by-side report of the two.
+*/
+
+#include "bertini2/bertini.hpp"
+#include "bertini2/classic.hpp"
+#include "bertini2/system_parsing.hpp"
+#include "bertini2/start_system.hpp"
+#include "bertini2/tracking.hpp"
+#include "bertini2/tracking/amp_powerseries_endgame.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+
+
+using System = bertini::System;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+namespace {
+
+	/**
+	\brief The options of a run.
+	*/
+	struct Options
+	{
+		std::vector<unsigned> threads;
+		std::vector<std::string> input_files;
+		std::string output;
+	};
+
+
+	/**
+	\brief One timed measurement, a record of the output, as in b2_benchmark.
+	*/
+	struct Record
+	{
+		std::string problem;
+		unsigned num_variables;
+		unsigned num_functions;
+		std::string measure;
+		unsigned precision;
+		unsigned threads;
+		std::size_t operations;
+		double seconds_per_operation;
+	};
+
+
+	/**
+	\brief The outcome of the paths of one solve of a file.
+	*/
+	struct PathsRecord
+	{
+		std::string problem;
+		unsigned threads;
+		std::string status; ///< "solved", or why the file was skipped.
+		std::size_t paths = 0;
+		std::size_t succeeded = 0;
+		std::size_t finished_by_newton = 0;
+		std::size_t finished_by_endgame = 0;
+		std::size_t failed = 0;
+		std::uint64_t steps_accepted = 0;
+		std::uint64_t steps_rejected = 0;
+		unsigned max_precision = 0;
+		double mean_max_precision = 0;
+	};
+
+
+	std::vector<std::string> Split(std::string const& s, char separator)
+	{
+		std::vector<std::string> parts;
+		std::stringstream in(s);
+		std::string part;
+		while (std::getline(in, part, separator))
+			if (!part.empty())
+				parts.push_back(part);
+		return parts;
+	}
+
+
+	std::vector<unsigned> SplitNumbers(std::string const& s)
+	{
+		std::vector<unsigned> numbers;
+		for (auto const& part : Split(s, ','))
+			numbers.push_back(static_cast<unsigned>(std::stoul(part)));
+		return numbers;
+	}
+
+
+	/**
+	\brief Seconds taken by an operation done once.
+	*/
+	template<typename Operation>
+	double Seconds(Operation op)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		const auto start = Clock::now();
+		op();
+		return std::chrono::duration<double>(Clock::now() - start).count();
+	}
+
+
+	/**
+	\brief Read and parse a classic input file.
+
+	\throws std::runtime_error if the file can't be split into its sections, or its input section doesn't parse.
+	*/
+	System ParseClassic(std::string const& input_file)
+	{
+		auto file = bertini::classic::PreprocessedInputFile::FromFile(input_file);
+		if (!file.Readable())
+			throw std::runtime_error("could not split " + input_file + " into its config and input sections");
+
+		System sys;
+		bertini::SystemParser<bertini::classic::PreprocessedInputFile::const_iterator> parser;
+		if (!file.ParseInput(parser, sys))
+			throw std::runtime_error("could not parse the input section of " + input_file);
+		return sys;
+	}
+
+
+	/**
+	\brief Solve the system of a file by the total degree homotopy, at each thread count, timing its phases.
+	*/
+	void BenchmarkFile(std::string const& input_file, Options const& options, std::vector<Record> & records, std::vector<PathsRecord> & paths_records)
+	{
+		using namespace bertini::tracking;
+		using EndgameType = EndgameSelector<AMPTracker>::PSEG;
+
+		System target;
+		const double parse_seconds = Seconds([&]{ target = ParseClassic(input_file); });
+
+		const unsigned num_variables = target.NumVariables();
+		const unsigned num_functions = target.NumFunctions();
+
+		auto record = [&](std::string const& measure, unsigned threads, std::size_t operations, double seconds)
+			{
+				records.push_back(Record{input_file, num_variables, num_functions, measure, DefaultPrecision(), threads, operations, seconds/operations});
+			};
+		record("parse", 1, 1, parse_seconds);
+
+		auto skip = [&](std::string const& why)
+			{
+				PathsRecord skipped;
+				skipped.problem = input_file;
+				skipped.threads = 0;
+				skipped.status = why;
+				paths_records.push_back(skipped);
+			};
+
+		if (target.HavePathVariable())
+			return skip("declares a path variable");
+		if (num_functions != num_variables)
+			return skip("not square");
+
+		target.Homogenize();
+		target.AutoPatch();
+
+		auto TD = bertini::start_system::TotalDegree(target);
+		TD.Homogenize();
+
+		auto t = bertini::node::MakeNode<bertini::node::Variable>("t");
+		auto homotopy = (1-t)*target + t*TD;
+		homotopy.AddPathVariable(t);
+
+		config::Stepping<mpfr_float> stepping;
+		config::Newton newton;
+		auto AMP = config::AMPConfigFrom(homotopy);
+		auto setup = [&](AMPTracker & tracker)
+			{
+				tracker.Setup(config::Predictor::RK4, mpfr_float("1e-6"), mpfr_float("1e5"), stepping, newton);
+				tracker.PrecisionSetup(AMP);
+			};
+
+		const mpfr start_time(1), boundary_time("0.1");
+		const std::size_t num_paths = static_cast<std::size_t>(TD.NumStartPoints());
+
+		for (auto threads : options.threads)
+		{
+			std::cerr << "solving " << input_file << ", " << num_paths << " paths on " << threads << " threads\n";
+
+			std::vector< PathResult<mpfr> > at_boundary;
+			const double track_seconds = Seconds([&]
+				{
+					at_boundary = TrackAllPaths<AMPTracker>(homotopy, TD, setup, start_time, boundary_time, threads);
+				});
+
+			StagedResults<mpfr> results;
+			const double finish_seconds = Seconds([&]
+				{
+					results = FinishPaths<AMPTracker, EndgameType>(homotopy, at_boundary, boundary_time, setup, [](EndgameType &){}, StagedSolveConfig(), threads);
+				});
+
+			record("track_to_boundary", threads, num_paths, track_seconds);
+			record("finish", threads, num_paths, finish_seconds);
+			record("solve", threads, num_paths, track_seconds + finish_seconds);
+
+			PathsRecord outcome;
+			outcome.problem = input_file;
+			outcome.threads = threads;
+			outcome.status = "solved";
+			outcome.paths = num_paths;
+			for (std::size_t ii = 0; ii < results.paths.size(); ++ii)
+			{
+				if (results.paths[ii].success_code==SuccessCode::Success)
+					outcome.succeeded++;
+				else
+					outcome.failed++;
+				if (results.finished_by[ii]==FinishedBy::Newton)
+					outcome.finished_by_newton++;
+				else if (results.finished_by[ii]==FinishedBy::Endgame)
+					outcome.finished_by_endgame++;
+			}
+			for (auto const& path : at_boundary)
+			{
+				outcome.steps_accepted += path.statistics.steps_accepted;
+				outcome.steps_rejected += path.statistics.steps_rejected;
+				outcome.max_precision = std::max(outcome.max_precision, path.statistics.max_precision);
+				outcome.mean_max_precision += path.statistics.max_precision;
+			}
+			if (!at_boundary.empty())
+				outcome.mean_max_precision /= at_boundary.size();
+			paths_records.push_back(outcome);
+		}
+	}
+
+
+	std::string Escape(std::string const& s)
+	{
+		std::string escaped;
+		for (auto c : s)
+		{
+			if (c=='"' || c=='\\')
+				escaped += '\\';
+			escaped += c;
+		}
+		return escaped;
+	}
+
+
+	void WriteJson(std::ostream & out, std::vector<Record> const& records, std::vector<PathsRecord> const& paths_records)
+	{
+		out << "{\n";
+		out << "  \"benchmark\": \"b2_classic_benchmark\",\n";
+		out << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+		out << "  \"results\": [";
+		for (std::size_t ii = 0; ii < records.size(); ++ii)
+		{
+			auto const& r = records[ii];
+			out << (ii ? ",\n" : "\n")
+			    << "    {\"problem\": \"" << Escape(r.problem) << "\""
+			    << ", \"variables\": " << r.num_variables
+			    << ", \"functions\": " << r.num_functions
+			    << ", \"measure\": \"" << r.measure << "\""
+			    << ", \"number_type\": \"amp\""
+			    << ", \"precision\": " << r.precision
+			    << ", \"threads\": " << r.threads
+			    << ", \"operations\": " << r.operations
+			    << ", \"seconds_per_operation\": " << std::setprecision(6) << std::scientific << r.seconds_per_operation
+			    << std::defaultfloat
+			    << "}";
+		}
+		out << "\n  ],\n";
+		out << "  \"paths\": [";
+		for (std::size_t ii = 0; ii < paths_records.size(); ++ii)
+		{
+			auto const& p = paths_records[ii];
+			out << (ii ? ",\n" : "\n")
+			    << "    {\"problem\": \"" << Escape(p.problem) << "\""
+			    << ", \"threads\": " << p.threads
+			    << ", \"status\": \"" << Escape(p.status) << "\""
+			    << ", \"paths\": " << p.paths
+			    << ", \"succeeded\": " << p.succeeded
+			    << ", \"finished_by_newton\": " << p.finished_by_newton
+			    << ", \"finished_by_endgame\": " << p.finished_by_endgame
+			    << ", \"failed\": " << p.failed
+			    << ", \"steps_accepted\": " << p.steps_accepted
+			    << ", \"steps_rejected\": " << p.steps_rejected
+			    << ", \"max_precision\": " << p.max_precision
+			    << ", \"mean_max_precision\": " << std::setprecision(4) << std::fixed << p.mean_max_precision
+			    << std::defaultfloat
+			    << "}";
+		}
+		out << "\n  ]\n}\n";
+	}
+
+
+	Options ParseOptions(int argc, char** argv)
+	{
+		Options options;
+		for (int ii = 1; ii < argc; ++ii)
+		{
+			const std::string arg(argv[ii]);
+			auto value = [&]() -> std::string
+				{
+					if (ii+1 >= argc)
+						throw std::runtime_error("option " + arg + " needs a value");
+					return argv[++ii];
+				};
+
+			if (arg=="--threads")
+				options.threads = SplitNumbers(value());
+			else if (arg=="--output")
+				options.output = value();
+			else if (arg.compare(0, 2, "--")==0)
+				throw std::runtime_error("unknown option " + arg);
+			else
+				options.input_files.push_back(arg);
+		}
+
+		if (options.input_files.empty())
+			throw std::runtime_error("no input files given");
+
+		if (options.threads.empty())
+			options.threads.push_back(bertini::detail::DefaultNumWorkers());
+		return options;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		const auto options = ParseOptions(argc, argv);
+		DefaultPrecision(30);
+
+		std::vector<Record> records;
+		std::vector<PathsRecord> paths_records;
+
+		for (auto const& input_file : options.input_files)
+		{
+			try
+			{
+				BenchmarkFile(input_file, options, records, paths_records);
+			}
+			catch (std::exception const& e)
+			{
+				// one bad file of a corpus shouldn't lose the timings of the rest
+				std::cerr << "b2_classic_benchmark: " << input_file << ": " << e.what() << "\n";
+				PathsRecord failed;
+				failed.problem = input_file;
+				failed.threads = 0;
+				failed.status = e.what();
+				paths_records.push_back(failed);
+			}
+		}
+
+		if (options.output.empty())
+			WriteJson(std::cout, records, paths_records);
+		else
+		{
+			std::ofstream out(options.output);
+			WriteJson(out, records, paths_records);
+		}
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << "b2_classic_benchmark: " << e.what() << "\n";
+		return 1;
+	}
+
+	return 0;
+}
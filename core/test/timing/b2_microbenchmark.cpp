@@ -0,0 +1,349 @@
+//This file is part of Bertini 2.
+//
+//b2_microbenchmark.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//b2_microbenchmark.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with b2_microbenchmark.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file b2_microbenchmark.cpp
+
+\brief Microbenchmarks of the multiple precision primitives, at precisions from 64 to 4096 bits, reporting nanoseconds and allocations per operation as JSON, and with --counters, the hardware counters per operation.
+
+## Use
+
+\code
+b2_microbenchmark [--quick] [--bits 64,128,256] [--counters] [--output results.json]
+\endcode
+
+Timed are the arithmetic of bertini::complex, abs, pow and exp, RandomMp, changing the precision of a number, products of Mat<mpfr>, and factoring and solving with Eigen's PartialPivLU and bertini's PartialPivotLU.
+
+Allocations are counted through the global operator new and the GMP memory functions, which MPFR allocates through, so include the limbs of every temporary.
+
+With --counters, the cycles, instructions, cache references and misses, and branches and mispredicted branches of each operation are counted by perf_event_open, see perf_counters.hpp, and written with its timing, with the instructions per cycle.  Where counting is refused, the timings are written without them.
+*/
+
+#include "bertini2/bertini.hpp"
+#include "bertini2/lu.hpp"
+#include "perf_counters.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#include <gmp.h>
+
+
+
+using dbl = bertini::dbl;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+template<typename NumType> using Mat = bertini::Mat<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+namespace {
+
+	std::atomic<std::size_t> num_allocations(0);
+
+	void* CountedAllocate(std::size_t size)
+	{
+		++num_allocations;
+		return std::malloc(size);
+	}
+
+	void* CountedReallocate(void* p, std::size_t, std::size_t new_size)
+	{
+		++num_allocations;
+		return std::realloc(p, new_size);
+	}
+
+	void CountedFree(void* p, std::size_t)
+	{
+		std::free(p);
+	}
+}
+
+
+void* operator new(std::size_t size)
+{
+	++num_allocations;
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+
+namespace {
+
+	/**
+	\brief One timed primitive, a record of the output.
+	*/
+	struct Record
+	{
+		std::string operation;
+		unsigned bits;
+		unsigned size; ///< The dimension of the matrices, 0 for scalar operations.
+		std::size_t operations;
+		double nanoseconds_per_operation;
+		double allocations_per_operation;
+		bertini::benchmark::PerfCounts counters; ///< Per operation, if counted.
+	};
+
+
+	struct Options
+	{
+		bool quick = false;
+		bool counters = false;
+		std::vector<unsigned> bits{64, 128, 256, 512, 1024, 2048, 4096};
+		std::vector<unsigned> sizes{8, 32};
+		std::string output;
+	};
+
+
+	// the decimal digits holding at least a number of bits, as bertini's precisions are in digits
+	unsigned DigitsFromBits(unsigned bits)
+	{
+		return static_cast<unsigned>(std::ceil(bits*std::log10(2.0)));
+	}
+
+
+	// the hardware counters of the main thread, if asked for and available
+	bertini::benchmark::PerfCounters* perf_counters = nullptr;
+
+
+	/**
+	\brief Time an operation, repeating it until at least min_seconds have passed, and count its allocations, and hardware events.
+	*/
+	template<typename Operation>
+	Record Time(std::string const& operation, unsigned bits, unsigned size, double min_seconds, Operation op)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		op(); // once untimed, so workspaces reach their size
+
+		std::size_t count = 0;
+		std::size_t batch = 1;
+		const auto allocations_before = num_allocations.load();
+		if (perf_counters)
+			perf_counters->Start();
+		const auto start = Clock::now();
+		double elapsed = 0;
+		while (elapsed < min_seconds)
+		{
+			for (std::size_t ii = 0; ii < batch; ++ii)
+				op();
+			count += batch;
+			batch *= 2;
+			elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		}
+		const auto counts = perf_counters ? perf_counters->Stop() : bertini::benchmark::PerfCounts();
+		const auto allocations = num_allocations.load() - allocations_before;
+
+		return Record{operation, bits, size, count, 1e9*elapsed/count, static_cast<double>(allocations)/count, counts.PerOperation(count)};
+	}
+
+
+	void BenchmarkScalars(unsigned bits, Options const& options, std::vector<Record> & records)
+	{
+		const double min_seconds = options.quick ? 0.02 : 0.2;
+		const auto digits = DigitsFromBits(bits);
+		DefaultPrecision(digits);
+
+		mpfr a = mpfr::rand(), b = mpfr::rand(), c;
+		mpfr_float r;
+
+		records.push_back(Time("complex_add", bits, 0, min_seconds, [&]{ c = a + b; }));
+		records.push_back(Time("complex_add_in_place", bits, 0, min_seconds, [&]{ c += b; }));
+		records.push_back(Time("complex_mul", bits, 0, min_seconds, [&]{ c = a * b; }));
+		records.push_back(Time("complex_mul_in_place", bits, 0, min_seconds, [&]{ c = a; c *= b; }));
+		records.push_back(Time("complex_div", bits, 0, min_seconds, [&]{ c = a / b; }));
+		records.push_back(Time("complex_abs", bits, 0, min_seconds, [&]{ r = abs(a); }));
+		records.push_back(Time("complex_pow_int", bits, 0, min_seconds, [&]{ c = pow(a, 5); }));
+		records.push_back(Time("complex_pow_complex", bits, 0, min_seconds, [&]{ c = pow(a, b); }));
+		records.push_back(Time("complex_exp", bits, 0, min_seconds, [&]{ c = exp(a); }));
+		records.push_back(Time("random_mp", bits, 0, min_seconds, [&]{ r = bertini::RandomMp(); }));
+
+		// up and back, so each operation changes the precision of a number that has limbs
+		const auto other_digits = 2*digits;
+		records.push_back(Time("precision_change", bits, 0, min_seconds, [&]{ c.precision(other_digits); c.precision(digits); }));
+	}
+
+
+	void BenchmarkMatrices(unsigned bits, Options const& options, std::vector<Record> & records)
+	{
+		const double min_seconds = options.quick ? 0.05 : 0.5;
+		const auto digits = DigitsFromBits(bits);
+		DefaultPrecision(digits);
+
+		for (auto n : options.sizes)
+		{
+			Mat<mpfr> A(n,n), B(n,n), C(n,n);
+			Vec<mpfr> x(n), y(n);
+			for (unsigned ii = 0; ii < n; ++ii)
+			{
+				y(ii) = mpfr::rand();
+				for (unsigned jj = 0; jj < n; ++jj)
+				{
+					A(ii,jj) = mpfr::rand();
+					B(ii,jj) = mpfr::rand();
+				}
+			}
+
+			records.push_back(Time("mat_mat_product", bits, n, min_seconds, [&]{ C.noalias() = A*B; }));
+			records.push_back(Time("mat_vec_product", bits, n, min_seconds, [&]{ x.noalias() = A*y; }));
+			records.push_back(Time("eigen_partial_piv_lu", bits, n, min_seconds, [&]{ x = A.partialPivLu().solve(y); }));
+
+			bertini::PartialPivotLU<mpfr> lu(n);
+			lu.ChangePrecision(digits);
+			records.push_back(Time("partial_pivot_lu", bits, n, min_seconds, [&]{ lu.Factor(A); lu.Solve(x, y); }));
+		}
+	}
+
+
+	void WriteJson(std::ostream & out, Options const& options, std::vector<Record> const& records)
+	{
+		out << "{\n";
+		out << "  \"benchmark\": \"b2_microbenchmark\",\n";
+		out << "  \"quick\": " << (options.quick ? "true" : "false") << ",\n";
+		out << "  \"counters\": " << (perf_counters ? "true" : "false") << ",\n";
+		out << "  \"results\": [";
+		for (std::size_t ii = 0; ii < records.size(); ++ii)
+		{
+			auto const& r = records[ii];
+			out << (ii ? ",\n" : "\n")
+			    << "    {\"operation\": \"" << r.operation << "\""
+			    << ", \"bits\": " << r.bits
+			    << ", \"size\": " << r.size
+			    << ", \"operations\": " << r.operations
+			    << ", \"ns_per_op\": " << std::fixed << std::setprecision(2) << r.nanoseconds_per_operation
+			    << ", \"allocations_per_op\": " << std::setprecision(3) << r.allocations_per_operation;
+			r.counters.WriteJsonFields(out, "_per_op");
+			out << std::defaultfloat
+			    << "}";
+		}
+		out << "\n  ]\n}\n";
+	}
+
+
+	std::vector<unsigned> SplitNumbers(std::string const& s)
+	{
+		std::vector<unsigned> numbers;
+		std::stringstream in(s);
+		std::string part;
+		while (std::getline(in, part, ','))
+			if (!part.empty())
+				numbers.push_back(static_cast<unsigned>(std::stoul(part)));
+		return numbers;
+	}
+
+
+	Options ParseOptions(int argc, char** argv)
+	{
+		Options options;
+		for (int ii = 1; ii < argc; ++ii)
+		{
+			const std::string arg(argv[ii]);
+			auto value = [&]() -> std::string
+				{
+					if (ii+1 >= argc)
+						throw std::runtime_error("option " + arg + " needs a value");
+					return argv[++ii];
+				};
+
+			if (arg=="--quick")
+			{
+				options.quick = true;
+				options.sizes = {8};
+			}
+			else if (arg=="--bits")
+				options.bits = SplitNumbers(value());
+			else if (arg=="--sizes")
+				options.sizes = SplitNumbers(value());
+			else if (arg=="--counters")
+				options.counters = true;
+			else if (arg=="--output")
+				options.output = value();
+			else
+				throw std::runtime_error("unknown option " + arg);
+		}
+		return options;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	mp_set_memory_functions(&CountedAllocate, &CountedReallocate, &CountedFree);
+
+	try
+	{
+		const auto options = ParseOptions(argc, argv);
+
+		bertini::benchmark::PerfCounters counters(options.counters);
+		if (counters.Available())
+			perf_counters = &counters;
+		else if (options.counters)
+			std::cerr << "hardware counters are not available, timing without them\n";
+
+		std::vector<Record> records;
+		for (auto bits : options.bits)
+		{
+			std::cerr << "benchmarking at " << bits << " bits\n";
+			BenchmarkScalars(bits, options, records);
+			BenchmarkMatrices(bits, options, records);
+		}
+
+		if (options.output.empty())
+			WriteJson(std::cout, options, records);
+		else
+		{
+			std::ofstream out(options.output);
+			WriteJson(out, options, records);
+		}
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << "b2_microbenchmark: " << e.what() << "\n";
+		return 1;
+	}
+
+	return 0;
+}
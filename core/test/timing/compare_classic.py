@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#
+# compare_classic.py:  a side-by-side report of the solves of the same classic input files by
+# b2_classic_benchmark and by Bertini 1.x, run by run_bertini_classic.sh.
+#
+#   compare_classic.py b2_results.json classic_results.json [--threads N]
+#
+# For each file, the seconds of the whole solve by each, their ratio, and the paths each solved.
+# The solve by b2 is that at N threads, by default the fewest it was run at, so that a serial run
+# of Bertini 1.x is compared with a serial run of b2.
+#
+# This file is part of Bertini 2, and is distributed under the terms of the GNU General Public License,
+# version 3 or later, with the additional terms in the b2/licenses/ directory.
+
+import argparse
+import json
+import sys
+
+
+def solve_seconds(results, threads=None):
+    """The total seconds of the solve of each problem, at a thread count, or the fewest threads."""
+    seconds = {}
+    for r in results['results']:
+        if r['measure'] != 'solve':
+            continue
+        if threads is not None and r['threads'] != threads:
+            continue
+        known = seconds.get(r['problem'])
+        if known is None or r['threads'] < known[0]:
+            seconds[r['problem']] = (r['threads'], r['operations'] * r['seconds_per_operation'])
+    return {problem: s for problem, (_, s) in seconds.items()}
+
+
+def paths_by_problem(results, threads=None):
+    paths = {}
+    for p in results.get('paths', []):
+        if threads is not None and p['threads'] not in (threads, 0):
+            continue
+        known = paths.get(p['problem'])
+        if known is None or p['threads'] < known['threads']:
+            paths[p['problem']] = p
+    return paths
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare the solves of classic input files by b2 and by Bertini 1.x.')
+    parser.add_argument('b2_results')
+    parser.add_argument('classic_results')
+    parser.add_argument('--threads', type=int, default=None)
+    args = parser.parse_args()
+
+    with open(args.b2_results) as f:
+        b2 = json.load(f)
+    with open(args.classic_results) as f:
+        classic = json.load(f)
+
+    b2_seconds = solve_seconds(b2, args.threads)
+    classic_seconds = solve_seconds(classic)
+    b2_paths = paths_by_problem(b2, args.threads)
+    classic_paths = paths_by_problem(classic)
+
+    problems = sorted(set(b2_seconds) | set(classic_seconds) | set(b2_paths) | set(classic_paths))
+    width = max([len('problem')] + [len(p) for p in problems])
+
+    print('%-*s  %12s  %12s  %10s  %14s  %14s' % (width, 'problem', 'b2 seconds', 'classic sec', 'b2/classic', 'b2 succeeded', 'classic finite'))
+    for problem in problems:
+        b = b2_seconds.get(problem)
+        c = classic_seconds.get(problem)
+        ratio = '%10.2f' % (b / c) if b is not None and c else '%10s' % '-'
+
+        bp = b2_paths.get(problem, {})
+        cp = classic_paths.get(problem, {})
+        b_solved = '%d/%d' % (bp['succeeded'], bp['paths']) if bp.get('status') == 'solved' else bp.get('status', '-')
+        c_solved = str(cp['finite_solutions']) if 'finite_solutions' in cp else '-'
+
+        print('%-*s  %12s  %12s  %s  %14s  %14s' % (width, problem,
+              '%.4g' % b if b is not None else '-',
+              '%.4g' % c if c is not None else '-',
+              ratio, b_solved, c_solved))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,239 @@
+//This file is part of Bertini 2.
+//
+//perf_counters.hpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//perf_counters.hpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with perf_counters.hpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+
+/**
+\file perf_counters.hpp
+
+\brief Hardware performance counters of the calling thread, read around the kernels timed by the benchmarks, through Linux perf_event_open.
+
+Wall time alone cannot say whether a change of data layout helped by missing the cache less, or by executing fewer instructions.  A PerfCounters counts the cycles, instructions, cache references and misses, and branches and mispredicted branches, of the calling thread, between Start and Stop.  The counters are opened as one group, so are scheduled onto the hardware together, and if the kernel multiplexes them with other groups, scaled by the fraction of the time they ran.
+
+Counting may be refused, as it is in many containers, or by a kernel.perf_event_paranoid of 3 or more, and on other systems than Linux there is nothing to count with.  Then Available is false, and the benchmarks write their timings without counters.  Only the calling thread is counted, so the benchmarks count only measures run on one thread.
+*/
+
+#ifndef BERTINI_TEST_TIMING_PERF_COUNTERS_HPP
+#define BERTINI_TEST_TIMING_PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace bertini {
+	namespace benchmark {
+
+		/**
+		\brief The events counted.
+		*/
+		enum class PerfEvent
+		{
+			Cycles,
+			Instructions,
+			CacheReferences,
+			CacheMisses, ///< Of the last level cache.
+			Branches,
+			BranchMisses,
+			NumEvents
+		};
+
+		constexpr std::size_t NumPerfEvents = static_cast<std::size_t>(PerfEvent::NumEvents);
+
+
+		/**
+		\brief The counts of a measurement, or none if counting was not available.
+		*/
+		struct PerfCounts
+		{
+			bool valid = false;
+			std::array<double, NumPerfEvents> counts{}; ///< Scaled for the time the counters were multiplexed out.
+
+			double operator[](PerfEvent e) const
+			{
+				return counts[static_cast<std::size_t>(e)];
+			}
+
+			/**
+			\brief The counts of each of a number of operations.
+			*/
+			PerfCounts PerOperation(std::size_t operations) const
+			{
+				PerfCounts per = *this;
+				for (auto& c : per.counts)
+					c = operations ? c/operations : 0;
+				return per;
+			}
+
+			/**
+			\brief Write the counts as fields of a JSON object, each preceded by a comma, or nothing if they are not valid.
+			*/
+			void WriteJsonFields(std::ostream & out, std::string const& suffix) const
+			{
+				if (!valid)
+					return;
+
+				static const char* const names[NumPerfEvents] = {"cycles", "instructions", "cache_references", "cache_misses", "branches", "branch_misses"};
+				for (std::size_t ii = 0; ii < NumPerfEvents; ++ii)
+					out << ", \"" << names[ii] << suffix << "\": " << counts[ii];
+				const auto cycles = (*this)[PerfEvent::Cycles];
+				out << ", \"ipc\": " << (cycles > 0 ? (*this)[PerfEvent::Instructions]/cycles : 0);
+			}
+		};
+
+
+		/**
+		\brief A group of hardware counters of the calling thread.  Not copyable.
+		*/
+		class PerfCounters
+		{
+		public:
+
+			/**
+			\param enable Whether to try to open the counters at all.
+			*/
+			explicit PerfCounters(bool enable = true)
+			{
+				fds_.fill(-1);
+#ifdef __linux__
+				if (!enable)
+					return;
+
+				static const std::uint64_t configs[NumPerfEvents] = {
+					PERF_COUNT_HW_CPU_CYCLES,
+					PERF_COUNT_HW_INSTRUCTIONS,
+					PERF_COUNT_HW_CACHE_REFERENCES,
+					PERF_COUNT_HW_CACHE_MISSES,
+					PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+					PERF_COUNT_HW_BRANCH_MISSES};
+
+				for (std::size_t ii = 0; ii < NumPerfEvents; ++ii)
+				{
+					perf_event_attr attr;
+					std::memset(&attr, 0, sizeof(attr));
+					attr.type = PERF_TYPE_HARDWARE;
+					attr.size = sizeof(attr);
+					attr.config = configs[ii];
+					attr.disabled = ii==0; // the leader starts the group
+					attr.exclude_kernel = 1;
+					attr.exclude_hv = 1;
+					attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+					fds_[ii] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, ii ? fds_[0] : -1, 0));
+					if (fds_[ii] < 0)
+					{
+						Close();
+						return;
+					}
+				}
+				available_ = true;
+#else
+				(void)enable;
+#endif
+			}
+
+			~PerfCounters()
+			{
+				Close();
+			}
+
+			PerfCounters(PerfCounters const&) = delete;
+			PerfCounters& operator=(PerfCounters const&) = delete;
+
+			/**
+			\brief Whether the counters could be opened.
+			*/
+			bool Available() const
+			{
+				return available_;
+			}
+
+			/**
+			\brief Zero the counters, and start counting.
+			*/
+			void Start()
+			{
+#ifdef __linux__
+				if (!available_)
+					return;
+				ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+				ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+			}
+
+			/**
+			\brief Stop counting, and read the counts since Start.
+			*/
+			PerfCounts Stop()
+			{
+				PerfCounts result;
+#ifdef __linux__
+				if (!available_)
+					return result;
+				ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+				// the number of events, the times enabled and running, then the values
+				std::uint64_t data[3 + NumPerfEvents];
+				if (read(fds_[0], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[0]!=NumPerfEvents || data[2]==0)
+					return result;
+
+				const double scale = static_cast<double>(data[1])/data[2];
+				for (std::size_t ii = 0; ii < NumPerfEvents; ++ii)
+					result.counts[ii] = data[3+ii]*scale;
+				result.valid = true;
+#endif
+				return result;
+			}
+
+		private:
+
+			void Close()
+			{
+#ifdef __linux__
+				for (auto& fd : fds_)
+					if (fd >= 0)
+					{
+						close(fd);
+						fd = -1;
+					}
+#endif
+				available_ = false;
+			}
+
+			std::array<int, NumPerfEvents> fds_;
+			bool available_ = false;
+		};
+
+	} // namespace benchmark
+} // namespace bertini
+
+#endif
@@ -0,0 +1,96 @@
+#!/bin/sh
+#
+# run_bertini_classic.sh:  run Bertini 1.x on a corpus of classic input files, and write its timings
+# as JSON in the format of b2_benchmark, for comparison with b2_classic_benchmark by compare_classic.py.
+#
+#   run_bertini_classic.sh [-b path/to/bertini] [-o results.json] input_file...
+#
+# Each file is run in a directory of its own, so the files Bertini writes don't collide, and timed
+# from start to finish as "solve", with one operation.  The number of solutions in finite_solutions
+# and nonsingular_solutions, the first line of each, are recorded in "paths", with the exit status.
+#
+# This file is part of Bertini 2, and is distributed under the terms of the GNU General Public License,
+# version 3 or later, with the additional terms in the b2/licenses/ directory.
+
+bertini=bertini
+output=
+
+while getopts "b:o:" option
+do
+	case $option in
+		b) bertini=$OPTARG ;;
+		o) output=$OPTARG ;;
+		*) echo "usage: $0 [-b path/to/bertini] [-o results.json] input_file..." >&2; exit 1 ;;
+	esac
+done
+shift $((OPTIND-1))
+
+if [ $# -eq 0 ]
+then
+	echo "$0: no input files given" >&2
+	exit 1
+fi
+
+if ! command -v "$bertini" > /dev/null 2>&1
+then
+	echo "$0: can't run $bertini" >&2
+	exit 1
+fi
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# the first line of a solutions file, the number of solutions in it, or 0 if there is none
+count_solutions()
+{
+	if [ -f "$1" ]
+	then
+		head -n 1 "$1" | tr -d ' \r'
+	else
+		echo 0
+	fi
+}
+
+results=
+paths=
+index=0
+for input_file in "$@"
+do
+	index=$((index+1))
+	dir="$work/$index"
+	mkdir "$dir"
+	cp "$input_file" "$dir/input"
+
+	echo "solving $input_file with $bertini" >&2
+	start=$(date +%s.%N)
+	(cd "$dir" && "$bertini" input > output 2>&1)
+	status=$?
+	finish=$(date +%s.%N)
+	seconds=$(awk "BEGIN { print $finish - $start }")
+
+	problem=$(printf '%s' "$input_file" | sed 's/\\/\\\\/g; s/"/\\"/g')
+	results="$results${results:+,
+}    {\"problem\": \"$problem\", \"measure\": \"solve\", \"number_type\": \"amp\", \"threads\": 1, \"operations\": 1, \"seconds_per_operation\": $(printf '%e' "$seconds")}"
+	paths="$paths${paths:+,
+}    {\"problem\": \"$problem\", \"threads\": 1, \"status\": \"exit $status\", \"finite_solutions\": $(count_solutions "$dir/finite_solutions"), \"nonsingular_solutions\": $(count_solutions "$dir/nonsingular_solutions")}"
+done
+
+write_json()
+{
+	echo "{"
+	echo "  \"benchmark\": \"bertini_classic\","
+	echo "  \"results\": ["
+	echo "$results"
+	echo "  ],"
+	echo "  \"paths\": ["
+	echo "$paths"
+	echo "  ]"
+	echo "}"
+}
+
+if [ -z "$output" ]
+then
+	write_json
+else
+	write_json > "$output"
+fi
@@ -362,5 +362,34 @@ BOOST_AUTO_TEST_CASE(AMP_criteriaC_mp)
 
 
 
+BOOST_AUTO_TEST_CASE(AMP_criteria_compensated_double)
+{
+	/*
+	Compensated evaluation in double makes the error of double-double, so Phi and Psi count for 1e-16 of what they do otherwise, in double only.
+	*/
+	bertini::System sys("variable_group x, y; function f1, f2; f1 = x^2 - 2*x*y + y^2 - 1; f2 = x - y;");
+	sys.UseCompensatedEvaluation(true);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	BOOST_CHECK(AMP.compensated_double_evaluation);
+
+	auto plain = AMP;
+	plain.compensated_double_evaluation = false;
+
+	double norm_J = 1e3, norm_J_inverse = 1e8, norm_z = 1, TrackTolBeforeEG = 1e-5;
+
+	BOOST_CHECK(bertini::tracking::amp::D(norm_J, norm_J_inverse, AMP) < bertini::tracking::amp::D(norm_J, norm_J_inverse, plain));
+	BOOST_CHECK(bertini::tracking::amp::CriterionCRHS(norm_J_inverse, norm_z, TrackTolBeforeEG, AMP) < bertini::tracking::amp::CriterionCRHS(norm_J_inverse, norm_z, TrackTolBeforeEG, plain));
+
+	// multiple precision is not compensated
+	mpfr_float norm_J_mp(norm_J), norm_J_inverse_mp(norm_J_inverse);
+	BOOST_CHECK_EQUAL(bertini::tracking::amp::D(norm_J_mp, norm_J_inverse_mp, AMP), bertini::tracking::amp::D(norm_J_mp, norm_J_inverse_mp, plain));
+
+	sys.UseForwardModeDifferentiation(true);
+	BOOST_CHECK(!bertini::tracking::config::AMPConfigFrom(sys).compensated_double_evaluation);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,309 @@
+//This file is part of Bertini 2.
+//
+//batch_tracker_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//batch_tracker_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with batch_tracker_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file batch_tracker_test.cpp Unit testing for tracking batches of paths in lockstep.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/batch_tracker.hpp"
+#include "bertini2/start_system.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(batch_tracking)
+
+
+/**
+The system of AMP_simple_nonhomogeneous_system_trackable_initialprecision16, with the start points at t=1 repeated to fill more than one batch, the last only partly.
+*/
+struct SimpleNonhomogeneous
+{
+	SimpleNonhomogeneous()
+	{
+		Var x = std::make_shared<Variable>("x");
+		Var y = std::make_shared<Variable>("y");
+		Var t = std::make_shared<Variable>("t");
+
+		VariableGroup v{x,y};
+
+		sys.AddFunction(pow(x,2) + (1-t)*x - 1);
+		sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+		sys.AddPathVariable(t);
+		sys.AddVariableGroup(v);
+
+		const double r = std::sqrt(2.);
+		const std::vector<dbl> xs{1., -1.}, ys{r, -r};
+		for (unsigned ii = 0; ii < bertini::BatchLanes::Width + 3; ++ii)
+		{
+			Vec<dbl> p(2);
+			p << xs[ii%2], ys[(ii/2)%2];
+			start_points.push_back(p);
+		}
+	}
+
+	System sys;
+	std::vector< Vec<dbl> > start_points;
+};
+
+
+/**
+\test \b batch_tracker_matches_AMP_tracker Paths tracked in lockstep in double precision end where the AMP tracker takes them, with none handed off.
+*/
+BOOST_AUTO_TEST_CASE(batch_tracker_matches_AMP_tracker)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	SimpleNonhomogeneous problem;
+	auto AMP = config::AMPConfigFrom(problem.sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	AMPTracker tracker(problem.sys);
+	tracker.Setup(config::Predictor::Euler, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(AMP);
+
+	BatchTracker batch(problem.sys);
+	batch.Setup(1e-5, 1e5, config::Stepping<double>(), newton_preferences);
+	batch.PrecisionSetup(AMP);
+
+	auto double_results = batch.TrackPathsDouble(problem.start_points, dbl(1), dbl(0));
+	BOOST_CHECK_EQUAL(double_results.size(), problem.start_points.size());
+
+	auto results = batch.TrackPaths(problem.start_points, dbl(1), dbl(0), tracker);
+	BOOST_CHECK_EQUAL(results.size(), problem.start_points.size());
+
+	for (std::size_t ii = 0; ii < problem.start_points.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(double_results[ii].index, ii);
+		BOOST_CHECK(double_results[ii].success_code==SuccessCode::Success);
+		BOOST_CHECK(double_results[ii].time==dbl(0));
+		BOOST_CHECK(results[ii].success_code==SuccessCode::Success);
+
+		Vec<mpfr> start_point(2), end_point;
+		start_point << mpfr(problem.start_points[ii](0)), mpfr(problem.start_points[ii](1));
+		BOOST_CHECK(tracker.TrackPath(end_point, mpfr(1), mpfr(0), start_point)==SuccessCode::Success);
+
+		for (int jj = 0; jj < 2; ++jj)
+		{
+			BOOST_CHECK(abs(mpfr(double_results[ii].endpoint(jj)) - end_point(jj)) < 1e-5);
+			BOOST_CHECK(abs(results[ii].endpoint(jj) - end_point(jj)) < 1e-5);
+		}
+	}
+	BOOST_CHECK_EQUAL(batch.NumHandedOff(), 0);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b batch_tracker_hands_off_lanes_needing_precision With a bound on the error of function evaluation so large that double precision never suffices, every lane leaves the batch at its first step, and the fallback tracker finishes it.
+*/
+BOOST_AUTO_TEST_CASE(batch_tracker_hands_off_lanes_needing_precision)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	SimpleNonhomogeneous problem;
+	auto AMP = config::AMPConfigFrom(problem.sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	AMPTracker tracker(problem.sys);
+	tracker.Setup(config::Predictor::Euler, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_preferences, newton_preferences);
+	tracker.PrecisionSetup(AMP);
+
+	auto hopeless = AMP;
+	hopeless.Psi = mpfr_float("1e30");
+
+	BatchTracker batch(problem.sys);
+	batch.Setup(1e-5, 1e5, config::Stepping<double>(), newton_preferences);
+	batch.PrecisionSetup(hopeless);
+
+	auto double_results = batch.TrackPathsDouble(problem.start_points, dbl(1), dbl(0));
+	for (auto const& r : double_results)
+	{
+		BOOST_CHECK(r.success_code==SuccessCode::HigherPrecisionNecessary);
+		BOOST_CHECK(r.time==dbl(1));
+	}
+
+	auto results = batch.TrackPaths(problem.start_points, dbl(1), dbl(0), tracker);
+	BOOST_CHECK_EQUAL(batch.NumHandedOff(), problem.start_points.size());
+	for (auto const& r : results)
+	{
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+		BOOST_CHECK(abs(r.endpoint(0)*r.endpoint(0) + r.endpoint(0) - mpfr(1)) < 1e-5);
+	}
+
+	BOOST_CHECK_THROW(batch.TrackPathsDouble({Vec<dbl>(3)}, dbl(1), dbl(0)), std::runtime_error);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b batch_tracker_screens_in_single_precision Screening the steps in single precision, the paths end where they do in double, with some steps taken in single.  With a bound on the error of function evaluation too large for single precision but not for double, every lane is promoted to double, and none is handed off.
+*/
+BOOST_AUTO_TEST_CASE(batch_tracker_screens_in_single_precision)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	SimpleNonhomogeneous problem;
+	auto AMP = config::AMPConfigFrom(problem.sys);
+	AMP.Phi = mpfr_float(1);
+	AMP.Psi = mpfr_float(1);
+
+	config::Newton newton_preferences;
+
+	BatchTracker batch(problem.sys);
+	batch.Setup(1e-4, 1e5, config::Stepping<double>(), newton_preferences);
+	batch.PrecisionSetup(AMP);
+	BOOST_CHECK(!batch.ScreensInSinglePrecision());
+
+	auto double_results = batch.TrackPathsDouble(problem.start_points, dbl(1), dbl(0));
+	BOOST_CHECK_EQUAL(batch.NumSinglePrecisionSteps(), 0);
+
+	batch.ScreenInSinglePrecision();
+	BOOST_CHECK(batch.ScreensInSinglePrecision());
+	auto screened_results = batch.TrackPathsDouble(problem.start_points, dbl(1), dbl(0));
+	BOOST_CHECK(batch.NumSinglePrecisionSteps() > 0);
+
+	for (std::size_t ii = 0; ii < problem.start_points.size(); ++ii)
+	{
+		BOOST_CHECK(screened_results[ii].success_code==SuccessCode::Success);
+		BOOST_CHECK(screened_results[ii].time==dbl(0));
+		for (int jj = 0; jj < 2; ++jj)
+			BOOST_CHECK(abs(screened_results[ii].endpoint(jj) - double_results[ii].endpoint(jj)) < 1e-4);
+	}
+
+	auto too_coarse = AMP;
+	too_coarse.Psi = mpfr_float("1e8");
+	batch.PrecisionSetup(too_coarse);
+
+	const auto num_single_steps = batch.NumSinglePrecisionSteps();
+	auto promoted_results = batch.TrackPathsDouble(problem.start_points, dbl(1), dbl(0));
+	BOOST_CHECK_EQUAL(batch.NumSinglePrecisionSteps(), num_single_steps);
+	for (auto const& r : promoted_results)
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b batched_total_degree_in_parallel Track the total degree homotopy of AMP_track_total_degree_in_parallel in batches on two threads, and find both solutions.
+*/
+BOOST_AUTO_TEST_CASE(batched_total_degree_in_parallel)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(final_system);
+
+	auto results = TrackAllPathsBatched(final_system, TD,
+		[&](BatchTracker & batch, AMPTracker & fallback)
+		{
+			batch.Setup(1e-5, 1e5, config::Stepping<double>(), newton_preferences);
+			batch.PrecisionSetup(AMP);
+			fallback.Setup(config::Predictor::Euler,
+			               mpfr_float("1e-5"), mpfr_float("1e5"),
+			               stepping_preferences, newton_preferences);
+			fallback.PrecisionSetup(AMP);
+		},
+		dbl(1), dbl(0), 2);
+
+	BOOST_CHECK_EQUAL(results.size(), TD.NumStartPoints());
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+
+	Vec<mpfr> solution_1(2);
+	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+
+	Vec<mpfr> solution_2(2);
+	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+
+	unsigned num_1(0), num_2(0);
+	for (unsigned ii = 0; ii < results.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(results[ii].index, ii);
+		BOOST_CHECK(results[ii].success_code==SuccessCode::Success);
+		auto s = final_system.DehomogenizePoint(results[ii].endpoint);
+		if ( (s-solution_1).norm() < mpfr_float("1e-5"))
+			num_1++;
+		if ( (s-solution_2).norm() < mpfr_float("1e-5"))
+			num_2++;
+	}
+	BOOST_CHECK_EQUAL(num_1, 1);
+	BOOST_CHECK_EQUAL(num_2, 1);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
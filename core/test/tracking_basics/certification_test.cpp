@@ -0,0 +1,163 @@
+//This file is part of Bertini 2.
+//
+//certification_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//certification_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with certification_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file certification_test.cpp Unit testing for certifying points by alpha theory.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/certification.hpp"
+#include "bertini2/tracking/endpoint_file.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+using mpq_rational = bertini::mpq_rational;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(alpha_certification)
+
+
+/**
+\test \b certify_roots_of_two The roots of x^2 = 2, y = 1, are certified in double precision, and distinct, while a point a fifth of the way to the other root is not certified.
+*/
+BOOST_AUTO_TEST_CASE(certify_roots_of_two)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(x*x - 2);
+	sys.AddFunction(y - 1);
+
+	std::vector< Vec<dbl> > points(3, Vec<dbl>(2));
+	points[0] << dbl(std::sqrt(2.)), dbl(1);
+	points[1] << dbl(-std::sqrt(2.)), dbl(1);
+	points[2] << dbl(1.2), dbl(1);
+
+	auto certificates = CertifyAll(sys, points, CertifyConfig(), 2);
+	BOOST_REQUIRE_EQUAL(certificates.size(), 3);
+
+	BOOST_CHECK(certificates[0].Certified());
+	BOOST_CHECK(certificates[1].Certified());
+	BOOST_CHECK_EQUAL(certificates[0].precision, 16);
+	BOOST_CHECK(certificates[0].beta < 1e-14);
+	BOOST_CHECK(certificates[0].alpha <= certificates[0].beta*certificates[0].gamma*(1+1e-12));
+	BOOST_CHECK(AlphaCertificate::Distinct(certificates[0], points[0], certificates[1], points[1]));
+
+	BOOST_CHECK(!certificates[2].Certified());
+	BOOST_CHECK(certificates[2].beta > 0.2);
+
+	for (std::size_t ii = 0; ii < points.size(); ++ii)
+		BOOST_CHECK_EQUAL(Certify(sys, points[ii]).alpha, certificates[ii].alpha);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+}
+
+
+/**
+\test \b certify_falls_back_to_multiple_precision The roots of (x-1)(x-1-10^{-10}) are too close to certify in double precision, whose rounding of the function near them is as large as the Newton step, but not in multiple precision.
+*/
+BOOST_AUTO_TEST_CASE(certify_falls_back_to_multiple_precision)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction((x-1)*(x-1-mpq_rational(1,10000)*mpq_rational(1,1000000)));
+
+	Vec<dbl> root(1);
+	root << dbl(1);
+
+	CertifyConfig double_only;
+	double_only.fallback_precision = 0;
+	BOOST_CHECK(!Certify(sys, root, double_only).Certified());
+
+	auto certificate = Certify(sys, root);
+	BOOST_CHECK(certificate.Certified());
+	BOOST_CHECK_EQUAL(certificate.precision, 50);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+}
+
+
+/**
+\test \b certificates_in_endpoint_records Certifying records keeps the certificates in them, and they are written to, and read back from, an endpoint file.  A failed path is not certified.
+*/
+BOOST_AUTO_TEST_CASE(certificates_in_endpoint_records)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 2);
+
+	std::vector< EndpointRecord<mpfr> > records(2);
+	records[0].endpoint = Vec<mpfr>(1);
+	records[0].endpoint << mpfr(sqrt(mpfr_float(2)));
+	records[1].success_code = SuccessCode::MaxNumStepsTaken;
+	records[1].endpoint = Vec<mpfr>(1);
+	records[1].endpoint << mpfr("3","0");
+
+	BOOST_CHECK_EQUAL(CertifyEndpoints(sys, sys, records, CertifyConfig(), 2), 1);
+	BOOST_CHECK(records[0].certificate.Certified());
+	BOOST_CHECK_EQUAL(records[1].certificate.precision, 0);
+
+	auto file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_certified_%%%%-%%%%");
+	{
+		EndpointWriter writer(file);
+		writer.Write(records[0]);
+	}
+	auto read = EndpointReader(file).Get<mpfr>(0);
+	BOOST_CHECK_EQUAL(read.certificate.alpha, records[0].certificate.alpha);
+	BOOST_CHECK_EQUAL(read.certificate.beta, records[0].certificate.beta);
+	BOOST_CHECK_EQUAL(read.certificate.gamma, records[0].certificate.gamma);
+	BOOST_CHECK_EQUAL(read.certificate.precision, records[0].certificate.precision);
+	boost::filesystem::remove(file);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
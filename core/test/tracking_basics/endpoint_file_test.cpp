@@ -0,0 +1,238 @@
+//This file is part of Bertini 2.
+//
+//endpoint_file_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//endpoint_file_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with endpoint_file_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file endpoint_file_test.cpp Unit testing for the binary endpoint file.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+#include "bertini2/tracking/endpoint_file.hpp"
+
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(endpoint_file)
+
+
+/**
+\test \b endpoint_file_round_trips_exactly Records written in multiple and double precision read back bit for bit, in order, and a record cut short at the end of the file is ignored, and dropped when appending.
+*/
+BOOST_AUTO_TEST_CASE(endpoint_file_round_trips_exactly)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(50);
+
+	auto file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_endpoints_%%%%-%%%%");
+
+	EndpointRecord<mpfr> high;
+	high.index = 7;
+	high.success_code = SuccessCode::Success;
+	high.time = mpfr(0);
+	high.precision = 50;
+	high.cycle_number = 2;
+	high.condition_number = 1e8;
+	high.statistics.steps_accepted = 41;
+	high.statistics.steps_rejected = 5;
+	high.statistics.newton_iterations = 97;
+	high.statistics.evaluations = 301;
+	high.statistics.max_precision = 50;
+	high.statistics.final_precision = 30;
+	high.statistics.tracking_seconds = 0.25;
+	high.statistics.endgame_seconds = 0.125;
+	high.statistics.endgame = instrument::PathStatistics::EndgameType::Cauchy;
+	high.statistics.endgame_loops = 4;
+	high.statistics.cycle_number = 2;
+	high.endpoint.resize(3);
+	high.endpoint << mpfr(1)/mpfr(3), mpfr("-2.5","1e-40"), mpfr(0);
+
+	EndpointRecord<dbl> low;
+	low.index = 3;
+	low.success_code = SuccessCode::GoingToInfinity;
+	low.time = dbl(0.125, -0.5);
+	low.precision = 16;
+	low.endpoint.resize(2);
+	low.endpoint << dbl(1./3, 2./7), dbl(-1e300, 4);
+
+	{
+		EndpointWriter writer(file);
+		writer.Write(high);
+		writer.Write(low);
+		BOOST_CHECK_EQUAL(writer.NumWritten(), 2);
+	}
+
+	{
+		EndpointReader reader(file);
+		BOOST_CHECK_EQUAL(reader.NumRecords(), 2);
+
+		DefaultPrecision(16);
+		auto read_high = reader.Get<mpfr>(0);
+		BOOST_CHECK_EQUAL(read_high.index, 7);
+		BOOST_CHECK(read_high.success_code==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(read_high.cycle_number, 2);
+		BOOST_CHECK_EQUAL(read_high.condition_number, 1e8);
+		BOOST_CHECK_EQUAL(bertini::Precision(read_high.endpoint), 50);
+		BOOST_CHECK_EQUAL(read_high.statistics.steps_accepted, 41);
+		BOOST_CHECK_EQUAL(read_high.statistics.steps_rejected, 5);
+		BOOST_CHECK_EQUAL(read_high.statistics.newton_iterations, 97);
+		BOOST_CHECK_EQUAL(read_high.statistics.evaluations, 301);
+		BOOST_CHECK_EQUAL(read_high.statistics.max_precision, 50);
+		BOOST_CHECK_EQUAL(read_high.statistics.final_precision, 30);
+		BOOST_CHECK_EQUAL(read_high.statistics.tracking_seconds, 0.25);
+		BOOST_CHECK_EQUAL(read_high.statistics.endgame_seconds, 0.125);
+		BOOST_CHECK(read_high.statistics.endgame==instrument::PathStatistics::EndgameType::Cauchy);
+		BOOST_CHECK_EQUAL(read_high.statistics.endgame_loops, 4);
+		BOOST_CHECK_EQUAL(read_high.statistics.cycle_number, 2);
+		for (int ii = 0; ii < 3; ++ii)
+			BOOST_CHECK(read_high.endpoint(ii)==high.endpoint(ii));
+
+		auto read_low = reader.Get<dbl>(1);
+		BOOST_CHECK_EQUAL(read_low.index, 3);
+		BOOST_CHECK(read_low.success_code==SuccessCode::GoingToInfinity);
+		BOOST_CHECK(read_low.time==low.time);
+		BOOST_CHECK(read_low.endpoint==low.endpoint);
+		BOOST_CHECK(std::isnan(read_low.condition_number));
+		BOOST_CHECK_EQUAL(read_low.statistics.steps_accepted, 0);
+		BOOST_CHECK(read_low.statistics.endgame==instrument::PathStatistics::EndgameType::None);
+
+		BOOST_CHECK_THROW(reader.Get<dbl>(2), std::out_of_range);
+	}
+
+	// a killed run leaves part of a record
+	{
+		boost::filesystem::ofstream partial(file, std::ios::binary | std::ios::app);
+		const char garbage[12] = {100};
+		partial.write(garbage, sizeof(garbage));
+	}
+	BOOST_CHECK_EQUAL(EndpointReader(file).NumRecords(), 2);
+
+	{
+		EndpointWriter writer(file, true);
+		writer.Write(low);
+	}
+	{
+		EndpointReader reader(file);
+		BOOST_CHECK_EQUAL(reader.NumRecords(), 3);
+		BOOST_CHECK(reader.Get<dbl>(2).endpoint==low.endpoint);
+	}
+
+	boost::filesystem::remove(file);
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+/**
+\test \b endpoint_file_rejects_corrupt_records Each byte of a record, flipped or zeroed in turn, reads back either as some record or as a std::runtime_error, never reading past the record, nor handing MPFR a real it could not have written.
+*/
+BOOST_AUTO_TEST_CASE(endpoint_file_rejects_corrupt_records)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	auto file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_endpoints_%%%%-%%%%");
+
+	{
+		EndpointWriter writer(file);
+	}
+	const auto record_start = boost::filesystem::file_size(file);
+
+	EndpointRecord<mpfr> record;
+	record.index = 2;
+	record.success_code = SuccessCode::Success;
+	record.time = mpfr(0);
+	record.precision = 30;
+	record.endpoint.resize(2);
+	record.endpoint << mpfr(1)/mpfr(3), mpfr("-2.5","0.75");
+	{
+		EndpointWriter writer(file, true);
+		writer.Write(record);
+	}
+	const auto record_end = boost::filesystem::file_size(file);
+	BOOST_REQUIRE(record_end > record_start);
+
+	auto set_byte = [&](std::uintmax_t position, char value)
+	{
+		std::fstream f(file.string(), std::ios::binary | std::ios::in | std::ios::out);
+		f.seekp(position);
+		f.put(value);
+	};
+	auto get_byte = [&](std::uintmax_t position)
+	{
+		std::ifstream f(file.string(), std::ios::binary);
+		f.seekg(position);
+		return static_cast<char>(f.get());
+	};
+
+	unsigned num_rejected = 0, num_read = 0;
+	for (std::uintmax_t position = record_start; position < record_end; ++position)
+	{
+		const char original = get_byte(position);
+		for (char corrupted : {static_cast<char>(~original), '\0'})
+		{
+			if (corrupted==original)
+				continue;
+			set_byte(position, corrupted);
+			EndpointReader reader(file);
+			for (std::size_t n = 0; n < reader.NumRecords(); ++n)
+			{
+				try
+				{
+					reader.Get<mpfr>(n);
+					reader.Get<dbl>(n);
+					++num_read;
+				}
+				catch (std::runtime_error const&)
+				{
+					++num_rejected;
+				}
+			}
+		}
+		set_byte(position, original);
+	}
+
+	BOOST_CHECK(num_rejected > 0);
+	BOOST_CHECK(num_read > 0);
+
+	EndpointReader reader(file);
+	BOOST_CHECK_EQUAL(reader.NumRecords(), 1);
+	BOOST_CHECK(reader.Get<mpfr>(0).endpoint==record.endpoint);
+
+	boost::filesystem::remove(file);
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -158,6 +158,139 @@ BOOST_AUTO_TEST_CASE(multiple_100_tracker_track_linear)
 }
 
 
+BOOST_AUTO_TEST_CASE(double_tracker_declares_divergence_early)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{y};
+
+	// y = 1/t, which has its pole at the end time
+	sys.AddFunction(y*t - 1);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	config::Stepping<double> stepping_preferences;
+	config::Newton newton_preferences;
+
+	Vec<dbl> y_start(1);
+	y_start << dbl(1);
+	Vec<dbl> y_end;
+
+	DoublePrecisionTracker at_threshold(sys);
+	at_threshold.Setup(config::Predictor::RK4, 1e-6, 1e5, stepping_preferences, newton_preferences);
+	BOOST_CHECK(at_threshold.TrackPath(y_end, dbl(1), dbl(0), y_start)==SuccessCode::GoingToInfinity);
+
+	DoublePrecisionTracker early(sys);
+	early.Setup(config::Predictor::RK4, 1e-6, 1e5, stepping_preferences, newton_preferences);
+	config::Divergence divergence;
+	divergence.early_detection = true;
+	early.DivergenceDetection(divergence);
+	BOOST_CHECK(early.TrackPath(y_end, dbl(1), dbl(0), y_start)==SuccessCode::GoingToInfinity);
+
+	BOOST_CHECK(early.NumTotalStepsTaken() < at_threshold.NumTotalStepsTaken());
+
+	divergence.window = 2;
+	BOOST_CHECK_THROW(early.DivergenceDetection(divergence), std::runtime_error);
+}
+
+
+BOOST_AUTO_TEST_CASE(double_tracker_divergence_estimate_spares_finite_paths)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{y};
+
+	// y = 1/(t+1/1000), which grows to 1000, past the onset of the estimate, but has its pole past the end time
+	sys.AddFunction(y*(t + bertini::mpq_rational(1,1000)) - 1);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	config::Stepping<double> stepping_preferences;
+	config::Newton newton_preferences;
+
+	DoublePrecisionTracker tracker(sys);
+	tracker.Setup(config::Predictor::RK4, 1e-6, 1e5, stepping_preferences, newton_preferences);
+	config::Divergence divergence;
+	divergence.early_detection = true;
+	tracker.DivergenceDetection(divergence);
+
+	Vec<dbl> y_start(1);
+	y_start << dbl(1000)/dbl(1001);
+	Vec<dbl> y_end;
+
+	BOOST_CHECK(tracker.TrackPath(y_end, dbl(1), dbl(0), y_start)==SuccessCode::Success);
+	BOOST_CHECK(abs(y_end(0)-dbl(1000)) < 1e-2);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(double_tracker_stops_singular_path_at_its_endgame_boundary)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var z = std::make_shared<Variable>("z");
+	Var t = std::make_shared<Variable>("t");
+
+	// y = sqrt(t), a double root at the end time
+	System singular;
+	singular.AddFunction(y*y - t);
+	singular.AddFunction(z - 1);
+	singular.AddPathVariable(t);
+	singular.AddVariableGroup(VariableGroup{y, z});
+
+	// y = sqrt(t+1), nonsingular throughout
+	System nonsingular;
+	nonsingular.AddFunction(y*y - (t+1));
+	nonsingular.AddFunction(z - 1);
+	nonsingular.AddPathVariable(t);
+	nonsingular.AddVariableGroup(VariableGroup{y, z});
+
+	config::Stepping<double> stepping_preferences;
+	config::Newton newton_preferences;
+	config::EndgameBoundary boundary;
+	boundary.adaptive = true;
+
+	Vec<dbl> start(2);
+	Vec<dbl> end_point;
+	const dbl t_end(1e-3);
+
+	DoublePrecisionTracker tracker(singular);
+	tracker.Setup(config::Predictor::RK4, 1e-6, 1e5, stepping_preferences, newton_preferences);
+
+	start << dbl(1), dbl(1);
+	BOOST_CHECK(tracker.TrackPath(end_point, dbl(1), t_end, start)==SuccessCode::Success);
+	BOOST_CHECK(!tracker.StoppedAtEndgameBoundary());
+
+	tracker.EndgameBoundarySelection(boundary);
+	BOOST_CHECK(tracker.TrackPath(end_point, dbl(1), t_end, start)==SuccessCode::Success);
+	BOOST_CHECK(tracker.StoppedAtEndgameBoundary());
+	const double stopped_at = abs(tracker.CurrentTime());
+	BOOST_CHECK(stopped_at > abs(t_end));
+	BOOST_CHECK(stopped_at <= boundary.earliest_time);
+	BOOST_CHECK(abs(end_point(0) - sqrt(tracker.CurrentTime())) < 1e-5);
+
+	DoublePrecisionTracker other(nonsingular);
+	other.Setup(config::Predictor::RK4, 1e-6, 1e5, stepping_preferences, newton_preferences);
+	other.EndgameBoundarySelection(boundary);
+	start << sqrt(dbl(2)), dbl(1);
+	BOOST_CHECK(other.TrackPath(end_point, dbl(1), t_end, start)==SuccessCode::Success);
+	BOOST_CHECK(!other.StoppedAtEndgameBoundary());
+
+	boundary.min_steps = 2;
+	BOOST_CHECK_THROW(tracker.EndgameBoundarySelection(boundary), std::runtime_error);
+}
 
 
 
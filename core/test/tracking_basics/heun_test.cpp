@@ -381,6 +381,65 @@ BOOST_AUTO_TEST_CASE(circle_line_heun_double)
 	}
 	
 	
+	/**
+	\test \b heun_retry_from_same_point_reuses_first_stage Predicting again from the same point with a shorter step, as after a rejected step, gives the same prediction and error estimate as a fresh predictor, and so does predicting after the first stage is forgotten.
+	*/
+	BOOST_AUTO_TEST_CASE(heun_retry_from_same_point_reuses_first_stage)
+	{
+		Vec<dbl> current_space(2);
+		current_space << dbl(2.3,0.2), dbl(1.1, 1.87);
+		dbl current_time(0.9);
+
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+
+		VariableGroup vars{x,y};
+
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+
+		double tracking_tolerance(1e-5);
+		unsigned frequency_of_CN_estimation = 1;
+
+		auto predict = [&](ExplicitRKPredictor & predictor, dbl delta_t, Vec<dbl> & result, double & error_est)
+		{
+			double norm_J, norm_J_inverse, size_proportion, condition_number_estimate;
+			unsigned num_steps_since_last_condition_number_computation = 1;
+			return predictor.Predict(result, error_est, size_proportion, norm_J, norm_J_inverse,
+			                         sys, current_space, current_time, delta_t,
+			                         condition_number_estimate, num_steps_since_last_condition_number_computation,
+			                         frequency_of_CN_estimation, tracking_tolerance, AMP);
+		};
+
+		ExplicitRKPredictor retrying(bertini::tracking::config::Predictor::HeunEuler, sys);
+		Vec<dbl> rejected, retried, forgotten;
+		double rejected_error, retried_error, forgotten_error;
+		BOOST_CHECK(predict(retrying, dbl(-0.1), rejected, rejected_error)==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(predict(retrying, dbl(-0.05), retried, retried_error)==bertini::tracking::SuccessCode::Success);
+		retrying.ForgetStageZero();
+		BOOST_CHECK(predict(retrying, dbl(-0.05), forgotten, forgotten_error)==bertini::tracking::SuccessCode::Success);
+
+		ExplicitRKPredictor fresh(bertini::tracking::config::Predictor::HeunEuler, sys);
+		Vec<dbl> expected;
+		double expected_error;
+		BOOST_CHECK(predict(fresh, dbl(-0.05), expected, expected_error)==bertini::tracking::SuccessCode::Success);
+
+		for (unsigned ii = 0; ii < expected.size(); ++ii)
+		{
+			BOOST_CHECK(retried(ii)==expected(ii));
+			BOOST_CHECK(forgotten(ii)==expected(ii));
+		}
+		BOOST_CHECK_EQUAL(retried_error, expected_error);
+		BOOST_CHECK_EQUAL(forgotten_error, expected_error);
+	}
+
+
 	BOOST_AUTO_TEST_CASE(heun_predict_linear_algebra_fails_d)
 	{
 		// Circle line homotopy has singular point at (x,y) = (1,-4) and t = .75
@@ -617,6 +617,70 @@ BOOST_AUTO_TEST_CASE(monodromy_RKF45_d)
 
 
 
+BOOST_AUTO_TEST_CASE(circle_line_RKF45_mp_same_after_return_to_precision)
+{
+	bertini::DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	Vec<mpfr> current_space(2);
+	current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+	mpfr current_time("0.9");
+	mpfr delta_t("-0.1");
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+
+	VariableGroup vars{x,y};
+
+	sys.AddVariableGroup(vars);
+	sys.AddPathVariable(t);
+
+	sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+	sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	AMP.coefficient_bound = 5;
+
+	mpfr_float norm_J, norm_J_inverse, size_proportion, error_est, first_error_est;
+	mpfr_float tracking_tolerance("1e-5");
+	mpfr_float condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	Vec<mpfr> first_prediction, prediction;
+
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::RKF45,sys);
+
+	auto success_code = predictor.Predict(first_prediction, first_error_est, size_proportion, norm_J, norm_J_inverse,
+									sys, current_space, current_time, delta_t,
+									condition_number_estimate, num_steps_since_last_condition_number_computation,
+									frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+
+	// up and back down, the second time at the lower precision from the kept Butcher table
+	bertini::DefaultPrecision(50);
+	sys.precision(50);
+	predictor.ChangePrecision(50);
+
+	bertini::DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	sys.precision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	predictor.ChangePrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	for (unsigned ii = 0; ii < current_space.size(); ++ii)
+		current_space(ii).precision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	success_code = predictor.Predict(prediction, error_est, size_proportion, norm_J, norm_J_inverse,
+									sys, current_space, current_time, delta_t,
+									condition_number_estimate, num_steps_since_last_condition_number_computation,
+									frequency_of_CN_estimation, tracking_tolerance, AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+
+	BOOST_CHECK_EQUAL(prediction.size(),2);
+	for (unsigned ii = 0; ii < prediction.size(); ++ii)
+		BOOST_CHECK(abs(prediction(ii)-first_prediction(ii)) < threshold_clearance_mp);
+	BOOST_CHECK(abs(error_est - first_error_est) < threshold_clearance_mp);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(monodromy_RKF45_mp)
 {
 	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
@@ -1992,6 +2056,322 @@ BOOST_AUTO_TEST_CASE(monodromy_RKV67_mp)
 }
 
 
+
+//////////////////////////////////////////////
+//
+//	Pade
+//
+
+// x = 1/(t-a) has a pole at t=a, near the path, which the [2/1] approximant reproduces exactly, so that its prediction and error estimate are exact but for roundoff, and its trust region is the distance to the pole.
+BOOST_AUTO_TEST_CASE(pole_Pade_d)
+{
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+	std::shared_ptr<Float> a = std::make_shared<Float>("0.95","0.05");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+	sys.AddFunction( x*(t-a) - 1 );
+
+	const dbl pole(0.95,0.05);
+	dbl current_time(1);
+	dbl delta_t(-0.05);
+	Vec<dbl> current_space(1);
+	current_space << 1./(current_time-pole);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	double norm_J, norm_J_inverse, size_proportion, error_est;
+	double tracking_tolerance(1e-5);
+	double condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	Vec<dbl> prediction;
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::Pade, sys);
+	BOOST_CHECK_EQUAL(predictor.Order(), 3);
+	BOOST_CHECK(predictor.HasErrorEstimate());
+
+	auto success_code = predictor.Predict(prediction,
+										   error_est,
+										   size_proportion,
+										   norm_J, norm_J_inverse,
+										   sys,
+										   current_space, current_time,
+										   delta_t,
+										   condition_number_estimate,
+										   num_steps_since_last_condition_number_computation,
+										   frequency_of_CN_estimation,
+										   tracking_tolerance,
+										   AMP);
+
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(prediction.size(),1);
+	BOOST_CHECK(abs(prediction(0) - 1./(current_time+delta_t-pole)) < 1e-10);
+	BOOST_CHECK(error_est < 1e-8);
+	BOOST_CHECK(abs(predictor.TrustRegion() - abs(current_time-pole)) < 1e-10);
+}
+
+
+BOOST_AUTO_TEST_CASE(pole_Pade_mp)
+{
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+	std::shared_ptr<Float> a = std::make_shared<Float>("0.95","0.05");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+	sys.AddFunction( x*(t-a) - 1 );
+
+	const mpfr pole("0.95","0.05");
+	mpfr current_time("1");
+	mpfr delta_t("-0.05");
+	Vec<mpfr> current_space(1);
+	current_space << mpfr(1)/(current_time-pole);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	mpfr_float norm_J, norm_J_inverse, size_proportion, error_est;
+	mpfr_float tracking_tolerance("1e-5");
+	mpfr_float condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	Vec<mpfr> prediction;
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::Pade, sys);
+
+	auto success_code = predictor.Predict(prediction,
+										   error_est,
+										   size_proportion,
+										   norm_J, norm_J_inverse,
+										   sys,
+										   current_space, current_time,
+										   delta_t,
+										   condition_number_estimate,
+										   num_steps_since_last_condition_number_computation,
+										   frequency_of_CN_estimation,
+										   tracking_tolerance,
+										   AMP);
+
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(prediction.size(),1);
+	// the Taylor coefficients are divided by powers of the radius of the circle they are sampled on, so lose some digits
+	BOOST_CHECK(abs(prediction(0) - mpfr(1)/(current_time+delta_t-pole)) < mpfr_float("1e-24"));
+	BOOST_CHECK(error_est < mpfr_float("1e-20"));
+	BOOST_CHECK(abs(predictor.TrustRegion() - static_cast<double>(abs(current_time-pole))) < 1e-10);
+}
+
+
+//////////////////////////////////////////////
+//
+//	Taylor
+//
+
+// x = sqrt(t), whose Taylor coefficients at t=1 are binomial coefficients.  The error of the prediction is led by the next coefficient, which is the error estimate.
+BOOST_AUTO_TEST_CASE(square_root_Taylor_d)
+{
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+	sys.AddFunction( pow(x,2) - t );
+
+	dbl current_time(1);
+	dbl delta_t(-0.1);
+	Vec<dbl> current_space(1);
+	current_space << dbl(1);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	double norm_J, norm_J_inverse, size_proportion, error_est;
+	double tracking_tolerance(1e-5);
+	double condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	Vec<dbl> prediction;
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::Taylor, sys);
+	BOOST_CHECK_EQUAL(predictor.Order(), 4);
+	BOOST_CHECK(predictor.HasErrorEstimate());
+
+	auto success_code = predictor.Predict(prediction,
+										   error_est,
+										   size_proportion,
+										   norm_J, norm_J_inverse,
+										   sys,
+										   current_space, current_time,
+										   delta_t,
+										   condition_number_estimate,
+										   num_steps_since_last_condition_number_computation,
+										   frequency_of_CN_estimation,
+										   tracking_tolerance,
+										   AMP);
+
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(prediction.size(),1);
+
+	// the coefficient of s^5 of sqrt(1+s) is 7/256
+	BOOST_CHECK(std::abs(error_est - 7./256*1e-5) < 1e-15);
+	const double error = abs(prediction(0) - sqrt(current_time+delta_t));
+	BOOST_CHECK(error < 1.2*error_est);
+	BOOST_CHECK(error > 0.8*error_est);
+
+	// the coefficients of s^4 and s^5 are -5/128 and 7/256
+	BOOST_CHECK(std::abs(predictor.TrustRegion() - 10./7) < 1e-12);
+
+	predictor.TaylorOrder(6);
+	BOOST_CHECK_EQUAL(predictor.Order(), 6);
+	success_code = predictor.Predict(prediction,
+										   error_est,
+										   size_proportion,
+										   norm_J, norm_J_inverse,
+										   sys,
+										   current_space, current_time,
+										   delta_t,
+										   condition_number_estimate,
+										   num_steps_since_last_condition_number_computation,
+										   frequency_of_CN_estimation,
+										   tracking_tolerance,
+										   AMP);
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK(abs(prediction(0) - sqrt(current_time+delta_t)) < 1.2*error_est);
+	BOOST_CHECK(error_est < 1e-8);
+}
+
+
+BOOST_AUTO_TEST_CASE(square_root_Taylor_mp)
+{
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+	sys.AddFunction( pow(x,2) - t );
+
+	mpfr current_time("1");
+	mpfr delta_t("-0.1");
+	Vec<mpfr> current_space(1);
+	current_space << mpfr("1");
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	mpfr_float norm_J, norm_J_inverse, size_proportion, error_est;
+	mpfr_float tracking_tolerance("1e-5");
+	mpfr_float condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	Vec<mpfr> prediction;
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::Taylor, sys);
+
+	auto success_code = predictor.Predict(prediction,
+										   error_est,
+										   size_proportion,
+										   norm_J, norm_J_inverse,
+										   sys,
+										   current_space, current_time,
+										   delta_t,
+										   condition_number_estimate,
+										   num_steps_since_last_condition_number_computation,
+										   frequency_of_CN_estimation,
+										   tracking_tolerance,
+										   AMP);
+
+	BOOST_CHECK(success_code==bertini::tracking::SuccessCode::Success);
+
+	// 1 + s/2 - s^2/8 + s^3/16 - 5 s^4/128, at s = -1/10, and the term 7 s^5/256 after it
+	const mpfr_float s("-0.1");
+	const mpfr_float taylor = 1 + s/2 - s*s/8 + s*s*s/16 - 5*s*s*s*s/128;
+	BOOST_CHECK(abs(prediction(0) - mpfr(taylor)) < threshold_clearance_mp);
+	BOOST_CHECK(abs(error_est - mpfr_float(7)/256*pow(abs(s),5)) < threshold_clearance_mp);
+}
+
+
+
+//
+//	Hermite
+//
+
+// x = sqrt(t), stepped from t=1 by -0.1.  The first two steps have too little history, and are taken by RKF45, and the third extrapolates the points and tangents at 1, 0.9, 0.8, with only the one evaluation of the tangent at 0.8.
+BOOST_AUTO_TEST_CASE(square_root_Hermite_d)
+{
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+
+	bertini::System sys;
+	Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddPathVariable(t);
+	sys.AddFunction( pow(x,2) - t );
+
+	dbl delta_t(-0.1);
+	Vec<dbl> current_space(1);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	double norm_J, norm_J_inverse, size_proportion, error_est;
+	double tracking_tolerance(1e-5);
+	double condition_number_estimate;
+	unsigned num_steps_since_last_condition_number_computation = 1;
+	unsigned frequency_of_CN_estimation = 1;
+
+	Vec<dbl> prediction;
+	ExplicitRKPredictor predictor(bertini::tracking::config::Predictor::Hermite, sys);
+	BOOST_CHECK_EQUAL(predictor.Order(), 3);
+	BOOST_CHECK(predictor.HasErrorEstimate());
+
+	auto predict_from = [&](dbl current_time, dbl step)
+	{
+		current_space << sqrt(current_time);
+		return predictor.Predict(prediction,
+								   error_est,
+								   size_proportion,
+								   norm_J, norm_J_inverse,
+								   sys,
+								   current_space, current_time,
+								   step,
+								   condition_number_estimate,
+								   num_steps_since_last_condition_number_computation,
+								   frequency_of_CN_estimation,
+								   tracking_tolerance,
+								   AMP);
+	};
+
+	BOOST_CHECK(predict_from(dbl(1), delta_t)==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(predictor.NumEvaluations(), 6);
+	BOOST_CHECK(predict_from(dbl(0.9), delta_t)==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(predictor.NumEvaluations(), 12);
+
+	BOOST_CHECK(predict_from(dbl(0.8), delta_t)==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(predictor.NumEvaluations(), 13);
+
+	// the quintic through the three points leads the error of the cubic through the last two by about a twentieth
+	const double error = abs(prediction(0) - sqrt(dbl(0.7)));
+	BOOST_CHECK(error < 1.3*error_est);
+	BOOST_CHECK(error > 0.7*error_est);
+	BOOST_CHECK(error_est < 1e-4);
+
+	// a step of more than twice the last is taken by RKF45 again, reusing the tangent at 0.8
+	BOOST_CHECK(predict_from(dbl(0.8), dbl(-0.3))==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(predictor.NumEvaluations(), 18);
+
+	// and so is any step after the history is forgotten, as it is on changing precision
+	predictor.ForgetHistory();
+	BOOST_CHECK(predict_from(dbl(0.7), delta_t)==bertini::tracking::SuccessCode::Success);
+	BOOST_CHECK_EQUAL(predictor.NumEvaluations(), 24);
+}
+
+
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
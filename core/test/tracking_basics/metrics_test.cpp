@@ -0,0 +1,256 @@
+//This file is part of Bertini 2.
+//
+//metrics_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//metrics_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with metrics_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file metrics_test.cpp Unit testing for the metrics gathered over the threads of a run, and their export.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(metrics)
+
+
+/**
+\test \b registry_sums_shards_of_threads Four threads count into one registry at once, each into its own shard, and a snapshot has the sums.
+*/
+BOOST_AUTO_TEST_CASE(registry_sums_shards_of_threads)
+{
+	using namespace bertini::tracking;
+
+	metrics::Registry registry;
+	const unsigned num_threads = 4, num_steps = 1000;
+
+	std::vector<std::thread> threads;
+	for (unsigned ii = 0; ii < num_threads; ++ii)
+		threads.emplace_back([&]()
+		{
+			for (unsigned jj = 0; jj < num_steps; ++jj)
+			{
+				registry.Increment(metrics::Counter::SuccessfulSteps);
+				registry.RecordStepPrecision(16);
+			}
+			registry.Increment(metrics::Counter::FailedSteps, 10);
+			registry.RecordEndgame(metrics::Endgame::Cauchy, true);
+		});
+	for (auto& t : threads)
+		t.join();
+
+	auto s = registry.TakeSnapshot();
+	BOOST_CHECK_EQUAL(s.Count(metrics::Counter::SuccessfulSteps), num_threads*num_steps);
+	BOOST_CHECK_EQUAL(s.Count(metrics::Counter::FailedSteps), num_threads*10);
+	BOOST_CHECK_EQUAL(s.precision_histogram[0], num_threads*num_steps);
+	BOOST_CHECK_EQUAL(s.endgames[static_cast<std::size_t>(metrics::Endgame::Cauchy)][1], num_threads);
+	BOOST_CHECK_CLOSE(s.StepRejectionRate(), 40./4040, 1e-10);
+	BOOST_CHECK_EQUAL(s.EndgameSuccessRate(metrics::Endgame::Cauchy), 1);
+	BOOST_CHECK_EQUAL(s.EndgameSuccessRate(metrics::Endgame::PowerSeries), 0);
+
+	BOOST_CHECK_EQUAL(metrics::PrecisionBucket(16), 0);
+	BOOST_CHECK_EQUAL(metrics::PrecisionBucket(30), 2);
+	BOOST_CHECK_EQUAL(metrics::PrecisionBucket(100000), metrics::NumPrecisionBuckets-1);
+}
+
+
+/**
+\test \b snapshots_export_as_json_and_prometheus The counts appear in both formats, and the Prometheus histogram is cumulative.
+*/
+BOOST_AUTO_TEST_CASE(snapshots_export_as_json_and_prometheus)
+{
+	using namespace bertini::tracking;
+
+	metrics::Registry registry;
+	registry.Increment(metrics::Counter::PathsEnded, 3);
+	registry.RecordStepPrecision(16);
+	registry.RecordStepPrecision(30);
+	registry.RecordEndgame(metrics::Endgame::PowerSeries, false);
+
+	auto s = registry.TakeSnapshot();
+
+	const auto json = metrics::ToJSON(s);
+	BOOST_CHECK(json.find("\"paths_ended\":3")!=std::string::npos);
+	BOOST_CHECK(json.find("\"power_series\":{\"success\":0,\"failure\":1}")!=std::string::npos);
+	BOOST_CHECK(json.front()=='{' && json.back()=='}');
+
+	const auto prometheus = metrics::ToPrometheus(s, "b2");
+	BOOST_CHECK(prometheus.find("b2_paths_ended_total 3\n")!=std::string::npos);
+	BOOST_CHECK(prometheus.find("b2_step_precision_bits_bucket{le=\"64\"} 1\n")!=std::string::npos);
+	BOOST_CHECK(prometheus.find("b2_step_precision_bits_bucket{le=\"+Inf\"} 2\n")!=std::string::npos);
+	BOOST_CHECK(prometheus.find("b2_endgames_total{type=\"power_series\",outcome=\"failure\"} 1\n")!=std::string::npos);
+}
+
+
+/**
+\test \b recorder_counts_tracking x^2 - 1 - 3t, from x=2 and x=-2 at t=1 to t=0 on two threads, with the trackers recording into a registry.  The steps counted are those the trackers took, and the whole run is exported at least once, as the exporter is destroyed.
+*/
+BOOST_AUTO_TEST_CASE(recorder_counts_tracking)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 1 - 3*t);
+	sys.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	std::vector< Vec<mpfr> > points(4, Vec<mpfr>(1));
+	for (unsigned ii = 0; ii < points.size(); ++ii)
+		points[ii] << mpfr(ii%2 ? -2 : 2);
+
+	metrics::Registry registry;
+	std::vector<metrics::Snapshot> exported;
+	{
+		metrics::PeriodicExporter exporter(registry, std::chrono::milliseconds(5), [&](metrics::Snapshot const& s){ exported.push_back(s); });
+		auto results = TrackAllPaths<AMPTracker>(sys, detail::StartPointList<mpfr>(points), setup, mpfr(1), mpfr(0), CheckpointConfig(), 2, 64, &registry);
+		for (auto const& r : results)
+			BOOST_CHECK(r.success_code==SuccessCode::Success);
+	}
+
+	auto s = registry.TakeSnapshot();
+	BOOST_CHECK_EQUAL(s.Count(metrics::Counter::PathsStarted), points.size());
+	BOOST_CHECK_EQUAL(s.Count(metrics::Counter::PathsEnded), points.size());
+	BOOST_CHECK_EQUAL(s.Count(metrics::Counter::PathsTruncated), 0);
+	BOOST_CHECK(s.Count(metrics::Counter::SuccessfulSteps) > 0);
+
+	std::uint64_t histogram_total = 0;
+	for (auto n : s.precision_histogram)
+		histogram_total += n;
+	BOOST_CHECK_EQUAL(histogram_total, s.Count(metrics::Counter::SuccessfulSteps));
+
+	// one by one, a tracker records the steps it counts
+	AMPTracker tracker(sys);
+	setup(tracker);
+	metrics::Registry single;
+	MetricsRecorder<AMPTracker> recorder(single);
+	tracker.AddObserver(&recorder);
+	Vec<mpfr> endpoint;
+	tracker.TrackPath(endpoint, mpfr(1), mpfr(0), points[0]);
+	auto one = single.TakeSnapshot();
+	BOOST_CHECK_EQUAL(one.Count(metrics::Counter::SuccessfulSteps) + one.Count(metrics::Counter::FailedSteps), tracker.NumTotalStepsTaken());
+	BOOST_CHECK_EQUAL(one.Count(metrics::Counter::PathsEnded), 1);
+#ifdef BERTINI_ENABLE_INSTRUMENTATION
+	BOOST_CHECK(one.phase_calls[static_cast<std::size_t>(instrument::Phase::Predict)] > 0);
+#endif
+
+	BOOST_REQUIRE(!exported.empty());
+	BOOST_CHECK_EQUAL(exported.back().Count(metrics::Counter::PathsEnded), points.size());
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+/**
+\test \b numa_topology_places_workers Core lists parse as Linux writes them, workers are spread over the nodes before doubling up on one, and pinned runs record the topology.
+*/
+BOOST_AUTO_TEST_CASE(numa_topology_places_workers)
+{
+	using namespace bertini::tracking;
+	using bertini::detail::NumaTopology;
+
+	BOOST_CHECK(NumaTopology::ParseCpuList("0-3,8,10-11\n") == (std::vector<unsigned>{0,1,2,3,8,10,11}));
+	BOOST_CHECK(NumaTopology::ParseCpuList("").empty());
+
+	NumaTopology two;
+	two.cpus_of_node = {{0,1,2}, {4,5}};
+	BOOST_CHECK_EQUAL(two.NumNodes(), 2);
+	BOOST_CHECK_EQUAL(two.NumCpus(), 5);
+	BOOST_CHECK(two.PlaceWorkers(4) == (std::vector<unsigned>{0,4,1,5}));
+	BOOST_CHECK(two.PlaceWorkers(7) == (std::vector<unsigned>{0,4,1,5,2,0,4}));
+	BOOST_CHECK_EQUAL(two.Describe(), "2 NUMA nodes: 0-2 | 4-5");
+
+	auto const& here = NumaTopology::Detect();
+	BOOST_CHECK(here.NumNodes() >= 1);
+	BOOST_CHECK_EQUAL(here.PlaceWorkers(3).size(), 3);
+
+	DefaultPrecision(30);
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 1 - 3*t);
+	sys.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	std::vector< Vec<mpfr> > points(2, Vec<mpfr>(1));
+	points[0] << mpfr(2);
+	points[1] << mpfr(-2);
+
+	metrics::Registry registry;
+	auto results = TrackAllPaths<AMPTracker>(sys, detail::StartPointList<mpfr>(points), setup, mpfr(1), mpfr(0), CheckpointConfig(), 2, 64, &registry, true);
+	for (auto const& r : results)
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+
+	auto s = registry.TakeSnapshot();
+	BOOST_CHECK_EQUAL(s.numa_nodes, here.NumNodes());
+	BOOST_CHECK_EQUAL(s.cpus, here.NumCpus());
+	BOOST_CHECK(s.Count(metrics::Counter::WorkersPinned) <= 2);
+	BOOST_CHECK(metrics::ToJSON(s).find("\"numa_nodes\":" + std::to_string(here.NumNodes()))!=std::string::npos);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,185 @@
+//This file is part of Bertini 2.
+//
+//monodromy_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//monodromy_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with monodromy_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file monodromy_test.cpp Unit testing for solving by tracking around loops, from one solution.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/monodromy.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+using Function = bertini::node::Function;
+
+using Var = std::shared_ptr<Variable>;
+using Fn = std::shared_ptr<Function>;
+
+using VariableGroup = bertini::VariableGroup;
+using LinearSlice = bertini::LinearSlice;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+using dbl = bertini::dbl;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(monodromy)
+
+
+/**
+\test \b solution_set_recognizes_duplicates Points within the tolerance of one in the set are not inserted again, whether or not their projections are equal.
+*/
+BOOST_AUTO_TEST_CASE(solution_set_recognizes_duplicates)
+{
+	using namespace bertini::tracking;
+
+	SolutionSet<dbl> found(2, 1e-8);
+
+	Vec<dbl> a(2), b(2), a_again(2);
+	a << dbl(1,2), dbl(-3,0.5);
+	b << dbl(1,2), dbl(-3,0.6);
+	a_again << dbl(1+1e-10,2), dbl(-3,0.5-1e-10);
+
+	BOOST_CHECK(found.Insert(a));
+	BOOST_CHECK(found.Insert(b));
+	BOOST_CHECK(!found.Insert(a_again));
+	BOOST_CHECK(found.Contains(a_again));
+	BOOST_CHECK_EQUAL(found.Size(), 2);
+	BOOST_CHECK_THROW(found.Insert(Vec<dbl>(3)), std::runtime_error);
+}
+
+
+/**
+\test \b monodromy_solves_cube_roots The family x^3 = p, at p=1, from the one solution x=1.  Loops around p=0 find the other two cube roots of unity.
+*/
+BOOST_AUTO_TEST_CASE(monodromy_solves_cube_roots)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Fn p = std::make_shared<Function>("p");
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x});
+	family.AddParameter(p);
+	family.AddFunction(pow(x,3) - p);
+
+	ParameterHomotopy ph(family, {p});
+
+	Vec<mpfr> parameters(1);
+	parameters << mpfr(1);
+	Vec<mpfr> seed(1);
+	seed << mpfr(1);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	ph.SetPath(ph.Homotopy(), parameters, parameters); // the bounds are estimated by evaluating
+	auto AMP = config::AMPConfigFrom(ph.Homotopy());
+
+	MonodromyConfig monodromy;
+	monodromy.expected_count = 3;
+
+	auto solved = SolveByMonodromy<AMPTracker>(ph, parameters, {seed}, [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		}, monodromy, 2);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	BOOST_REQUIRE_EQUAL(solved.solutions.size(), 3);
+	BOOST_CHECK(abs(solved.solutions[0](0) - mpfr(1)) < mpfr_float("1e-20"));
+	for (const auto& s : solved.solutions)
+		BOOST_CHECK(abs(pow(s(0),3) - mpfr(1)) < mpfr_float("1e-10"));
+
+	std::size_t num_new(0);
+	for (const auto& loop : solved.loops)
+		num_new += loop.num_new;
+	BOOST_CHECK_EQUAL(num_new, 2);
+
+	BOOST_CHECK_THROW(SolveByMonodromy<AMPTracker>(ph, parameters, {}, [](AMPTracker &){}), std::runtime_error);
+	BOOST_CHECK_THROW(SolveByMonodromy<AMPTracker>(ph, Vec<mpfr>(2), {seed}, [](AMPTracker &){}), std::runtime_error);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b monodromy_completes_witness_set_of_hyperbola The curve xy=1 has degree two.  From the one witness point (1,1), moving the slice around loops finds the other.
+*/
+BOOST_AUTO_TEST_CASE(monodromy_completes_witness_set_of_hyperbola)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	VariableGroup vars{x,y};
+
+	System sys;
+	sys.AddVariableGroup(vars);
+	sys.AddFunction(x*y - 1);
+
+	auto slice = LinearSlice::RandomComplex(vars,1);
+	Vec<mpfr> seed(2);
+	seed << mpfr(1), mpfr(1);
+	slice.PassThrough(seed);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	MonodromyConfig monodromy;
+	monodromy.expected_count = 2;
+
+	auto completed = CompleteWitnessSet<AMPTracker>(sys, slice, {seed}, [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		}, monodromy, 2);
+
+	BOOST_REQUIRE_EQUAL(completed.solutions.size(), 2);
+
+	const auto coefficients = slice.Coefficients<mpfr>();
+	Vec<mpfr> other(2);
+	other << coefficients(0,1)/coefficients(0,0), coefficients(0,0)/coefficients(0,1);
+	BOOST_CHECK((completed.solutions[1] - other).norm() < mpfr_float("1e-10"));
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
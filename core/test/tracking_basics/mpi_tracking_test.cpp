@@ -0,0 +1,95 @@
+//This file is part of Bertini 2.
+//
+//mpi_tracking_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//mpi_tracking_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with mpi_tracking_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file mpi_tracking_test.cpp Unit testing for the distribution of paths over MPI.  Only built into the tests when configured with --enable-mpi.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/mpi_tracking.hpp"
+
+#ifdef BERTINI_ENABLE_MPI
+
+using bertini::mpz_int;
+
+
+BOOST_AUTO_TEST_SUITE(mpi_tracking)
+
+
+/**
+\test \b chunk_size_follows_the_cost_of_a_path Before any path is timed, ranges are of the initial size.  After, they are sized to take the target time, within 1 and the largest size.
+*/
+BOOST_AUTO_TEST_CASE(chunk_size_follows_the_cost_of_a_path)
+{
+	using bertini::tracking::mpi::DistributionConfig;
+	using bertini::tracking::mpi::detail::ChunkSize;
+
+	DistributionConfig config;
+	config.target_chunk_seconds = 2;
+	config.initial_chunk_size = 10;
+	config.max_chunk_size = 1000;
+
+	const mpz_int plenty(1000000);
+
+	BOOST_CHECK_EQUAL(ChunkSize(plenty, 4, 0, 0, config), 10);
+
+	// a tenth of a second a path, so twenty paths in two seconds
+	BOOST_CHECK_EQUAL(ChunkSize(plenty, 4, 10, 100, config), 20);
+
+	// paths taking no measurable time get the largest ranges
+	BOOST_CHECK_EQUAL(ChunkSize(plenty, 4, 0, 100, config), 1000);
+	BOOST_CHECK_EQUAL(ChunkSize(plenty, 4, 1e-6, 100, config), 1000);
+
+	// paths taking longer than the target get one at a time
+	BOOST_CHECK_EQUAL(ChunkSize(plenty, 4, 1000, 10, config), 1);
+}
+
+
+/**
+\test \b chunk_size_splits_the_last_paths_finely Near the end, no range is more than the paths remaining over twice the workers, and none is empty.
+*/
+BOOST_AUTO_TEST_CASE(chunk_size_splits_the_last_paths_finely)
+{
+	using bertini::tracking::mpi::DistributionConfig;
+	using bertini::tracking::mpi::detail::ChunkSize;
+
+	DistributionConfig config;
+	config.initial_chunk_size = 100;
+
+	BOOST_CHECK_EQUAL(ChunkSize(mpz_int(40), 4, 0, 0, config), 5);
+	BOOST_CHECK_EQUAL(ChunkSize(mpz_int(8), 4, 0, 0, config), 1);
+	BOOST_CHECK_EQUAL(ChunkSize(mpz_int(3), 4, 0, 0, config), 1);
+	BOOST_CHECK_EQUAL(ChunkSize(mpz_int(1), 1, 0, 0, config), 1);
+
+	// with far more paths left, the range is of the size asked for
+	mpz_int huge(1);
+	huge <<= 80;
+	BOOST_CHECK_EQUAL(ChunkSize(huge, 4, 0, 0, config), 100);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // BERTINI_ENABLE_MPI
@@ -182,6 +182,148 @@ BOOST_AUTO_TEST_CASE(circle_line_one_corrector_step_double)
 		
 	}
 	
+	/**
+	\test \b circle_line_mixed_precision_solve_mp Factoring the Jacobian in double and refining in 50 digits gives the same corrected point as factoring in 50 digits.
+	*/
+	BOOST_AUTO_TEST_CASE(circle_line_mixed_precision_solve_mp)
+	{
+		DefaultPrecision(50);
+
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		mpfr current_time("0.9");
+
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+
+		VariableGroup vars{x,y};
+
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+
+		auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+		AMP.coefficient_bound = 5;
+
+		bertini::mpfr_float tracking_tolerance("1e1");
+		unsigned max_num_newton_iterations = 2;
+		unsigned min_num_newton_iterations = 2;
+
+		NewtonCorrector full(sys);
+		Vec<mpfr> full_result;
+		auto full_code = full.Correct(full_result, sys, current_space, current_time, tracking_tolerance,
+		                              min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		bertini::tracking::config::Newton newton_settings;
+		newton_settings.mixed_precision_solve = true;
+		newton_settings.mixed_precision_min_digits = 30;
+		NewtonCorrector mixed(sys);
+		mixed.Settings(newton_settings);
+		Vec<mpfr> mixed_result;
+		auto mixed_code = mixed.Correct(mixed_result, sys, current_space, current_time, tracking_tolerance,
+		                                min_num_newton_iterations, max_num_newton_iterations, AMP);
+
+		BOOST_CHECK(full_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(mixed_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(mixed_result.size(),2);
+		for (unsigned ii = 0; ii < mixed_result.size(); ++ii)
+			BOOST_CHECK(abs(mixed_result(ii)-full_result(ii)) < mpfr_float("1e-45"));
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+
+	/**
+	\test \b circle_line_reused_jacobian_mp Correcting with the Jacobian reused until the steps stop contracting reaches the same point as Newton's method, to a tight tolerance.
+	*/
+	BOOST_AUTO_TEST_CASE(circle_line_reused_jacobian_mp)
+	{
+		DefaultPrecision(50);
+
+		Vec<mpfr> current_space(2);
+		current_space << mpfr("2.3","0.2"), mpfr("1.1", "1.87");
+		mpfr current_time("0.9");
+
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), y = std::make_shared<Variable>("y"), t = std::make_shared<Variable>("t");
+
+		VariableGroup vars{x,y};
+
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+
+		sys.AddFunction( t*(pow(x,2)-1) + (1-t)*(pow(x,2) + pow(y,2) - 4) );
+		sys.AddFunction( t*(y-1) + (1-t)*(2*x + 5*y) );
+
+		bertini::mpfr_float tracking_tolerance("1e-40");
+		unsigned max_num_newton_iterations = 40;
+		unsigned min_num_newton_iterations = 1;
+
+		NewtonCorrector newton(sys);
+		Vec<mpfr> newton_result;
+		auto newton_code = newton.Correct(newton_result, sys, current_space, current_time, tracking_tolerance,
+		                                  min_num_newton_iterations, max_num_newton_iterations);
+
+		bertini::tracking::config::Newton newton_settings;
+		newton_settings.reuse_jacobian = true;
+		NewtonCorrector chord(sys);
+		chord.Settings(newton_settings);
+		Vec<mpfr> chord_result;
+		auto chord_code = chord.Correct(chord_result, sys, current_space, current_time, tracking_tolerance,
+		                                min_num_newton_iterations, max_num_newton_iterations);
+
+		BOOST_CHECK(newton_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(chord_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(chord_result.size(),2);
+		for (unsigned ii = 0; ii < chord_result.size(); ++ii)
+			BOOST_CHECK(abs(chord_result(ii)-newton_result(ii)) < mpfr_float("1e-38"));
+
+		DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+	}
+	
+	/**
+	\test \b arctangent_line_search_d Newton's method overshoots the root of arctan(x) from 1.5, and each step lands further away, where the line search shortens the steps and converges to it.
+	*/
+	BOOST_AUTO_TEST_CASE(arctangent_line_search_d)
+	{
+		Vec<dbl> current_space(1);
+		current_space << dbl(1.5);
+		dbl current_time(0);
+
+		bertini::System sys;
+		Var x = std::make_shared<Variable>("x"), t = std::make_shared<Variable>("t");
+
+		VariableGroup vars{x};
+
+		sys.AddVariableGroup(vars);
+		sys.AddPathVariable(t);
+
+		sys.AddFunction( atan(x) - t );
+
+		double tracking_tolerance(1e-10);
+		unsigned max_num_newton_iterations = 10;
+		unsigned min_num_newton_iterations = 1;
+
+		NewtonCorrector newton(sys);
+		Vec<dbl> newton_result;
+		auto newton_code = newton.Correct(newton_result, sys, current_space, current_time, tracking_tolerance,
+		                                  min_num_newton_iterations, max_num_newton_iterations);
+
+		bertini::tracking::config::Newton newton_settings;
+		newton_settings.line_search = true;
+		NewtonCorrector damped(sys);
+		damped.Settings(newton_settings);
+		Vec<dbl> damped_result;
+		auto damped_code = damped.Correct(damped_result, sys, current_space, current_time, tracking_tolerance,
+		                                  min_num_newton_iterations, max_num_newton_iterations);
+
+		BOOST_CHECK(newton_code!=bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK(damped_code==bertini::tracking::SuccessCode::Success);
+		BOOST_CHECK_EQUAL(damped_result.size(),1);
+		BOOST_CHECK(abs(damped_result(0)) < 1e-10);
+	}
+	
 	BOOST_AUTO_TEST_CASE(circle_line_two_corrector_steps_double)
 	{
 		
@@ -0,0 +1,405 @@
+//This file is part of Bertini 2.
+//
+//parameter_homotopy_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//parameter_homotopy_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with parameter_homotopy_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file parameter_homotopy_test.cpp Unit testing for solving members of a parametrized family by parameter homotopy.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/parameter_homotopy.hpp"
+#include "bertini2/tracking/solution_database.hpp"
+
+#include <boost/filesystem.hpp>
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+using Function = bertini::node::Function;
+
+using Var = std::shared_ptr<Variable>;
+using Fn = std::shared_ptr<Function>;
+
+using VariableGroup = bertini::VariableGroup;
+
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(parameter_homotopy)
+
+
+/**
+\test \b parameter_homotopy_solves_many_targets The family x^2 = p, y = q*x, solved at generic p and q, then at three targets on two threads, finding both solutions of each.
+*/
+BOOST_AUTO_TEST_CASE(parameter_homotopy_solves_many_targets)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Fn p = std::make_shared<Function>("p");
+	Fn q = std::make_shared<Function>("q");
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(p);
+	family.AddParameter(q);
+	family.AddFunction(x*x - p);
+	family.AddFunction(y - q*x);
+
+	ParameterHomotopy ph(family, {p, q});
+	BOOST_CHECK(ph.Homotopy().HavePathVariable());
+	BOOST_CHECK_EQUAL(ph.NumParameters(), 2);
+
+	// the generic value of p is the square of a chosen root, so that the generic solutions are known exactly
+	const mpfr root("0.7","0.4");
+	Vec<mpfr> generic(2);
+	generic << root*root, mpfr("-0.3","0.9");
+
+	std::vector< Vec<mpfr> > generic_solutions(2, Vec<mpfr>(2));
+	generic_solutions[0] << root, generic(1)*root;
+	generic_solutions[1] << -root, -generic(1)*root;
+	ph.SetGenericSolve(generic, generic_solutions);
+	BOOST_CHECK_EQUAL(ph.NumGenericSolutions(), 2);
+
+	std::vector< Vec<mpfr> > targets(3, Vec<mpfr>(2));
+	targets[0] << mpfr(4), mpfr(3);
+	targets[1] << mpfr(9), mpfr(-1);
+	targets[2] << mpfr("0.25","0"), mpfr("0","2");
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	ph.SetTarget(ph.Homotopy(), targets[0]); // the bounds are estimated by evaluating
+	auto AMP = config::AMPConfigFrom(ph.Homotopy());
+
+	auto solved = ph.Solve<AMPTracker>(targets, [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		}, 2);
+
+	BOOST_CHECK_EQUAL(solved.size(), targets.size());
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+
+	const std::vector<mpfr> target_roots{mpfr(2), mpfr(3), mpfr("0.5","0")};
+	for (std::size_t kk = 0; kk < targets.size(); ++kk)
+	{
+		BOOST_CHECK_EQUAL(solved[kk].size(), 2);
+
+		unsigned num_plus(0), num_minus(0);
+		for (std::size_t ii = 0; ii < solved[kk].size(); ++ii)
+		{
+			auto const& r = solved[kk][ii];
+			BOOST_CHECK_EQUAL(r.index, ii);
+			BOOST_CHECK(r.success_code==SuccessCode::Success);
+
+			Vec<mpfr> expected(2);
+			expected << target_roots[kk], targets[kk](1)*target_roots[kk];
+			if ((r.endpoint - expected).norm() < mpfr_float("1e-5"))
+				num_plus++;
+			if ((r.endpoint + expected).norm() < mpfr_float("1e-5"))
+				num_minus++;
+		}
+		BOOST_CHECK_EQUAL(num_plus, 1);
+		BOOST_CHECK_EQUAL(num_minus, 1);
+	}
+
+	BOOST_CHECK_THROW(ph.Solve<AMPTracker>({Vec<mpfr>(3)}, [](AMPTracker &){}), std::runtime_error);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b parameter_homotopy_solves_targets_in_lockstep The family x^2 = p, y = q*x, its paths for more targets than fill a batch tracked together, each lane at its own target, finding both solutions of each.
+*/
+BOOST_AUTO_TEST_CASE(parameter_homotopy_solves_targets_in_lockstep)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Fn p = std::make_shared<Function>("p");
+	Fn q = std::make_shared<Function>("q");
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(p);
+	family.AddParameter(q);
+	family.AddFunction(x*x - p);
+	family.AddFunction(y - q*x);
+
+	ParameterHomotopy ph(family, {p, q});
+
+	const mpfr root("0.7","0.4");
+	Vec<mpfr> generic(2);
+	generic << root*root, mpfr("-0.3","0.9");
+
+	std::vector< Vec<mpfr> > generic_solutions(2, Vec<mpfr>(2));
+	generic_solutions[0] << root, generic(1)*root;
+	generic_solutions[1] << -root, -generic(1)*root;
+	ph.SetGenericSolve(generic, generic_solutions);
+
+	// the squares of the roots, so that the solutions are known
+	std::vector<mpfr> target_roots;
+	std::vector< Vec<mpfr> > targets;
+	for (int kk = 0; kk < 5; ++kk)
+	{
+		target_roots.push_back(mpfr(mpfr_float(1 + kk), mpfr_float(kk%2)));
+		targets.push_back(Vec<mpfr>(2));
+		targets.back() << target_roots.back()*target_roots.back(), mpfr(mpfr_float(kk - 2), mpfr_float(1));
+	}
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	ph.SetTarget(ph.Homotopy(), targets[0]);
+	auto AMP = config::AMPConfigFrom(ph.Homotopy());
+
+	auto solved = ph.SolveInLockstep(targets,
+		[&](BatchTracker & batch)
+		{
+			batch.Setup(1e-6, 1e5, config::Stepping<double>(), newton_preferences);
+			batch.PrecisionSetup(AMP);
+		},
+		[&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		});
+
+	BOOST_CHECK_EQUAL(solved.size(), targets.size());
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	for (std::size_t kk = 0; kk < targets.size(); ++kk)
+	{
+		BOOST_CHECK_EQUAL(solved[kk].size(), 2);
+
+		Vec<mpfr> expected(2);
+		expected << target_roots[kk], targets[kk](1)*target_roots[kk];
+		unsigned num_plus(0), num_minus(0);
+		for (std::size_t ii = 0; ii < solved[kk].size(); ++ii)
+		{
+			auto const& r = solved[kk][ii];
+			BOOST_CHECK_EQUAL(r.index, ii);
+			BOOST_CHECK(r.success_code==SuccessCode::Success);
+			if ((r.endpoint - expected).norm() < mpfr_float("1e-4"))
+				num_plus++;
+			if ((r.endpoint + expected).norm() < mpfr_float("1e-4"))
+				num_minus++;
+		}
+		BOOST_CHECK_EQUAL(num_plus, 1);
+		BOOST_CHECK_EQUAL(num_minus, 1);
+	}
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b parameter_homotopy_needs_generic_solve Solving before the generic solve is given, or building from a family which already has a path variable, throws.
+*/
+BOOST_AUTO_TEST_CASE(parameter_homotopy_needs_generic_solve)
+{
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+	Fn p = std::make_shared<Function>("p");
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x});
+	family.AddParameter(p);
+	family.AddFunction(x*x - p);
+
+	ParameterHomotopy ph(family, {p});
+	BOOST_CHECK_THROW(ph.SetTarget(ph.Homotopy(), Vec<mpfr>(1)), std::runtime_error);
+	BOOST_CHECK_THROW(ph.Solve<AMPTracker>({Vec<mpfr>(1)}, [](AMPTracker &){}), std::runtime_error);
+	BOOST_CHECK_THROW(ph.SetGenericSolve(Vec<mpfr>(2), {}), std::runtime_error);
+
+	System homotopy;
+	homotopy.AddVariableGroup(VariableGroup{x});
+	homotopy.AddFunction(x*x - t);
+	homotopy.AddPathVariable(t);
+	BOOST_CHECK_THROW(ParameterHomotopy(homotopy, {p}), std::runtime_error);
+}
+
+
+/**
+\test \b solution_database_finds_nearest_member Members added to a database are found again by the nearness of their parameters, skipping those with too few solutions, and survive reopening it.
+*/
+BOOST_AUTO_TEST_CASE(solution_database_finds_nearest_member)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_solved_%%%%-%%%%");
+
+	std::vector< Vec<mpfr> > members;
+	for (int kk = 0; kk < 20; ++kk)
+	{
+		members.push_back(Vec<mpfr>(2));
+		members.back() << mpfr(mpfr_float(kk%5), mpfr_float(kk/5)), mpfr(mpfr_float(kk), mpfr_float(-kk));
+	}
+
+	{
+		SolutionDatabase solved(directory, 2);
+		BOOST_CHECK_EQUAL(solved.NumEntries(), 0);
+		BOOST_CHECK(solved.Nearest(members[0])==SolutionDatabase::None);
+
+		for (std::size_t kk = 0; kk < members.size(); ++kk)
+		{
+			std::vector< Vec<mpfr> > solutions(kk%2 ? 1 : 2, members[kk]);
+			BOOST_CHECK_EQUAL(solved.Insert(members[kk], solutions), kk);
+		}
+		BOOST_CHECK_THROW(solved.Insert(Vec<mpfr>(3), std::vector< Vec<mpfr> >()), std::runtime_error);
+	}
+
+	SolutionDatabase solved(directory, 2);
+	BOOST_CHECK_EQUAL(solved.NumEntries(), members.size());
+	BOOST_CHECK_THROW(SolutionDatabase(directory, 3), std::runtime_error);
+
+	for (std::size_t kk = 0; kk < members.size(); ++kk)
+	{
+		Vec<mpfr> near = members[kk];
+		near(0) += mpfr("0.1","0.1");
+		BOOST_CHECK_EQUAL(solved.Nearest(near), kk);
+		BOOST_CHECK_EQUAL(solved.NumSolutions(kk), kk%2 ? 1 : 2);
+
+		// only the even members have two solutions
+		const auto nearest_pair = solved.Nearest(near, 2);
+		BOOST_CHECK_EQUAL(nearest_pair%2, 0);
+		if (kk%2==0)
+			BOOST_CHECK_EQUAL(nearest_pair, kk);
+	}
+
+	auto solutions = solved.Solutions(3);
+	BOOST_CHECK_EQUAL(solutions.size(), 1);
+	BOOST_CHECK_SMALL(abs((solutions[0] - members[3]).norm()), mpfr_float("1e-25"));
+	BOOST_CHECK_SMALL(abs((solved.Parameters(3) - members[3]).norm()), mpfr_float("1e-25"));
+
+	boost::filesystem::remove_all(directory);
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b parameter_homotopy_solves_from_nearest_member The family x^2 = p, y = q*x, its targets solved from a database which holds none, the first from the generic member and the second from the first, then again from the database, which now holds them, finding both solutions of each both times.
+*/
+BOOST_AUTO_TEST_CASE(parameter_homotopy_solves_from_nearest_member)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Fn p = std::make_shared<Function>("p");
+	Fn q = std::make_shared<Function>("q");
+
+	System family;
+	family.AddVariableGroup(VariableGroup{x,y});
+	family.AddParameter(p);
+	family.AddParameter(q);
+	family.AddFunction(x*x - p);
+	family.AddFunction(y - q*x);
+
+	ParameterHomotopy ph(family, {p, q});
+
+	const mpfr root("0.7","0.4");
+	Vec<mpfr> generic(2);
+	generic << root*root, mpfr("-0.3","0.9");
+
+	std::vector< Vec<mpfr> > generic_solutions(2, Vec<mpfr>(2));
+	generic_solutions[0] << root, generic(1)*root;
+	generic_solutions[1] << -root, -generic(1)*root;
+	ph.SetGenericSolve(generic, generic_solutions);
+
+	std::vector<mpfr> target_roots{mpfr(2), mpfr("2.1","0.1")};
+	std::vector< Vec<mpfr> > targets(2, Vec<mpfr>(2));
+	targets[0] << target_roots[0]*target_roots[0], mpfr(3);
+	targets[1] << target_roots[1]*target_roots[1], mpfr("3.1","0");
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	ph.SetTarget(ph.Homotopy(), targets[0]);
+	auto AMP = config::AMPConfigFrom(ph.Homotopy());
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_solved_%%%%-%%%%");
+	SolutionDatabase solved(directory, ph.NumParameters());
+
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		auto results = ph.SolveFrom<AMPTracker>(solved, targets, setup, 1);
+		BOOST_CHECK_EQUAL(results.size(), targets.size());
+		BOOST_CHECK_EQUAL(solved.NumEntries(), (pass+1)*targets.size());
+
+		for (std::size_t kk = 0; kk < targets.size(); ++kk)
+		{
+			BOOST_CHECK_EQUAL(results[kk].size(), 2);
+
+			Vec<mpfr> expected(2);
+			expected << target_roots[kk], targets[kk](1)*target_roots[kk];
+			unsigned num_plus(0), num_minus(0);
+			for (auto const& r : results[kk])
+			{
+				BOOST_CHECK(r.success_code==SuccessCode::Success);
+				if ((r.endpoint - expected).norm() < mpfr_float("1e-5"))
+					num_plus++;
+				if ((r.endpoint + expected).norm() < mpfr_float("1e-5"))
+					num_minus++;
+			}
+			BOOST_CHECK_EQUAL(num_plus, 1);
+			BOOST_CHECK_EQUAL(num_minus, 1);
+		}
+	}
+
+	SolutionDatabase other(directory / "other", 3);
+	BOOST_CHECK_THROW(ph.SolveFrom<AMPTracker>(other, targets, setup), std::runtime_error);
+
+	boost::filesystem::remove_all(directory);
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,11 @@
 
 #include "bertini2/tracking/amp_tracker.hpp"
 #include "bertini2/tracking/observers.hpp"
+#include "bertini2/tracking/path_recorder.hpp"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
 
 
 
@@ -55,6 +60,33 @@ extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
 
 using bertini::DefaultPrecision;
 
+
+/**
+Counts the events it receives, optionally declaring the event types it handles.
+*/
+template<class TrackerT, typename... HandledT>
+class EventCounter : public bertini::Observer<TrackerT>
+{
+public:
+	std::vector<std::type_index> HandledEvents() const override
+	{
+		return bertini::EventTypeList<HandledT...>();
+	}
+
+	void Observe(bertini::AnyEvent const& e) override
+	{
+		++received;
+		if (dynamic_cast<const bertini::tracking::SuccessfulStep<TrackerT>*>(&e))
+			++successful_steps;
+	}
+
+	void Visit(TrackerT const&) override
+	{}
+
+	unsigned received = 0;
+	unsigned successful_steps = 0;
+};
+
 BOOST_AUTO_TEST_SUITE(AMP_tracker_basics)
 
 
@@ -230,7 +262,207 @@ BOOST_AUTO_TEST_CASE(union_of_observers)
 
 
 
-BOOST_AUTO_TEST_SUITE_END()
+/**
+\test \b observers_receive_only_the_events_they_handle An observer declaring the event types it handles receives those, and those derived from them, and nothing else; one declaring none receives everything.
+*/
+BOOST_AUTO_TEST_CASE(observers_receive_only_the_events_they_handle)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	BOOST_CHECK(SuccessfulStep<AMPTracker>::IsA(typeid(TrackingEvent<AMPTracker>)));
+	BOOST_CHECK(PrecisionIncreased<AMPTracker>::IsA(typeid(PrecisionEvent<AMPTracker>)));
+	BOOST_CHECK(SuccessfulPredict<AMPTracker,dbl>::IsA(typeid(bertini::AnyEvent)));
+	BOOST_CHECK(!FailedStep<AMPTracker>::IsA(typeid(SuccessfulStep<AMPTracker>)));
+	BOOST_CHECK(!TrackingEvent<AMPTracker>::IsA(typeid(SuccessfulStep<AMPTracker>)));
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	EventCounter<AMPTracker> everything;
+	EventCounter<AMPTracker, SuccessfulStep<AMPTracker> > successes;
+	EventCounter<AMPTracker, TrackingEnded<AMPTracker>, PrecisionEvent<AMPTracker> > ends_and_precision;
+	tracker.AddObserver(&everything);
+	tracker.AddObserver(&successes);
+	tracker.AddObserver(&ends_and_precision);
+
+	mpfr t_start(1);
+	mpfr t_end(0);
+	
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
+	start_point << mpfr(1), mpfr(1);
+	tracker.TrackPath(end_point, t_start, t_end, start_point);
+
+	BOOST_CHECK(successes.received > 0);
+	BOOST_CHECK_EQUAL(successes.received, successes.successful_steps);
+	BOOST_CHECK_EQUAL(everything.successful_steps, successes.successful_steps);
+	BOOST_CHECK(everything.received > successes.received);
+	BOOST_CHECK(ends_and_precision.received >= 1);
+	BOOST_CHECK_EQUAL(ends_and_precision.successful_steps, 0);
+
+	bertini::MultiObserver<AMPTracker, StepFailScreenPrinter, PrecisionAccumulator> both;
+	BOOST_CHECK_EQUAL(both.HandledEvents().size(), 2);
+	bertini::MultiObserver<AMPTracker, StepFailScreenPrinter, GoryDetailLogger> all;
+	BOOST_CHECK(all.HandledEvents().empty());
+}
+
+
+/**
+\test \b deferred_logging_writes_every_record Every record logged while asynchronous logging runs is formatted, by the background thread, by the time it stops, and none is dropped.
+*/
+BOOST_AUTO_TEST_CASE(deferred_logging_writes_every_record)
+{
+	using bertini::logging::trivial::severity_level;
+
+	const unsigned num_records = 1000;
+	std::atomic<unsigned> num_written(0);
+	std::atomic<bool> written_elsewhere(true);
+	const auto this_thread = std::this_thread::get_id();
+
+	bertini::AsyncLogging::Start();
+	for (unsigned ii = 0; ii < num_records; ++ii)
+		BERTINI_LOG_DEFERRED(severity_level::fatal, [&, ii](std::ostream& out)
+			{
+				out << "deferred record " << ii;
+				++num_written;
+				if (std::this_thread::get_id()==this_thread)
+					written_elsewhere = false;
+			});
+	bertini::AsyncLogging::Stop();
+
+	BOOST_CHECK_EQUAL(num_written, num_records);
+	BOOST_CHECK_EQUAL(bertini::AsyncLogging::NumDropped(), 0);
+	BOOST_CHECK(!bertini::AsyncLogging::Running());
+#ifdef USE_THREAD_LOCAL
+	BOOST_CHECK(written_elsewhere);
+#endif
+}
+
+
+/**
+Tracks x-t, y^2-x from t=1 to 0 in adaptive precision, recording it, and returns the number of successful steps.
+*/
+unsigned TrackRecordedSquareRoot(bertini::tracking::PathRecorder<bertini::tracking::AMPTracker> & recorder)
+{
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	VariableGroup v{x,y};
+	sys.AddFunction(x-t);
+	sys.AddFunction(pow(y,2)-x);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
 
+	AMPTracker tracker(sys);
+	tracker.Setup(config::Predictor::Euler, mpfr_float("1e-5"), mpfr_float("1e5"), config::Stepping<mpfr_float>(), config::Newton());
+	tracker.PrecisionSetup(config::AMPConfigFrom(sys));
 
+	EventCounter<AMPTracker, bertini::tracking::SuccessfulStep<AMPTracker> > counter;
+	tracker.AddObserver(&recorder);
+	tracker.AddObserver(&counter);
 
+	Vec<mpfr> start_point(2), end_point;
+	start_point << mpfr(1), mpfr(1);
+	auto code = tracker.TrackPath(end_point, mpfr(1), mpfr(0), start_point);
+	BOOST_CHECK(code==bertini::SuccessCode::Success);
+	return counter.successful_steps;
+}
+
+
+BOOST_AUTO_TEST_CASE(path_recorder_keeps_geometric_steps_and_the_last)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	std::stringstream stream;
+	PathSampleWriter writer(stream);
+	PathRecorderConfig config;
+	config.distance_ratio = 2;
+	config.time_fraction = 0;
+	PathRecorder<AMPTracker> recorder(writer, config, 7);
+
+	const auto num_steps = TrackRecordedSquareRoot(recorder);
+	const auto samples = ReadPathSamples(stream);
+
+	BOOST_REQUIRE(!samples.empty());
+	BOOST_CHECK_EQUAL(samples.size(), writer.NumWritten());
+	BOOST_CHECK(samples.size() < num_steps);
+	BOOST_CHECK_EQUAL(samples.back().step, num_steps);
+	BOOST_CHECK(abs(samples.back().time) < 1e-10);
+	for (size_t ii = 0; ii < samples.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(samples[ii].path, 7u);
+		BOOST_CHECK_EQUAL(samples[ii].point.size(), 2);
+		if (ii > 0)
+			BOOST_CHECK(samples[ii].step > samples[ii-1].step);
+	}
+
+	// each kept step at least halves the distance to the end
+	for (size_t ii = 1; ii+1 < samples.size(); ++ii)
+		BOOST_CHECK(abs(samples[ii].time) <= abs(samples[ii-1].time)/2 * (1+1e-12));
+}
+
+
+BOOST_AUTO_TEST_CASE(path_recorder_reservoir_is_bounded)
+{
+	DefaultPrecision(16);
+	using namespace bertini::tracking;
+
+	std::stringstream stream;
+	PathSampleWriter writer(stream);
+	PathRecorderConfig config;
+	config.sampling = PathSampling::Reservoir;
+	config.reservoir_size = 5;
+	config.full_precision = true;
+	PathRecorder<AMPTracker> recorder(writer, config);
+
+	const auto num_steps = TrackRecordedSquareRoot(recorder);
+	BOOST_REQUIRE(num_steps > 6);
+	const auto samples = ReadPathSamples(stream);
+
+	// the five of the reservoir, and the last step unless it is among them
+	BOOST_CHECK(samples.size()==5 || samples.size()==6);
+	BOOST_CHECK_EQUAL(samples.back().step, num_steps);
+	for (size_t ii = 1; ii < samples.size(); ++ii)
+		BOOST_CHECK(samples[ii].step > samples[ii-1].step);
+
+	// truncating the stream loses only the record cut short
+	const std::string contents = stream.str();
+	std::stringstream truncated(contents.substr(0, contents.size()-3));
+	BOOST_CHECK_EQUAL(ReadPathSamples(truncated).size(), samples.size()-1);
+}
+
+
+
+
+BOOST_AUTO_TEST_SUITE_END()
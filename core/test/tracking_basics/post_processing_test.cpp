@@ -0,0 +1,177 @@
+//This file is part of Bertini 2.
+//
+//post_processing_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//post_processing_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with post_processing_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file post_processing_test.cpp Unit testing for gathering and classifying the endpoints of a solve.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/post_processing.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = bertini::dbl;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(post_processing)
+
+
+template<typename ComplexType>
+bertini::tracking::PathResult<ComplexType> Endpoint(std::size_t index, ComplexType const& x, ComplexType const& y, bertini::tracking::SuccessCode code = bertini::tracking::SuccessCode::Success)
+{
+	bertini::tracking::PathResult<ComplexType> r;
+	r.index = index;
+	r.success_code = code;
+	r.time = ComplexType(0);
+	r.endpoint.resize(2);
+	r.endpoint << x, y;
+	return r;
+}
+
+
+/**
+\test \b post_process_gathers_and_classifies The endpoints of five paths of x^2-1, y-2: two reach (1,2), one (-1,2), one a far point, and one fails.
+*/
+BOOST_AUTO_TEST_CASE(post_process_gathers_and_classifies)
+{
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(pow(x,2) - 1);
+	sys.AddFunction(y - 2);
+
+	std::vector< PathResult<dbl> > paths;
+	paths.push_back(Endpoint(0, dbl(1,0), dbl(2,0)));
+	paths.push_back(Endpoint(1, dbl(-1,0), dbl(2,0)));
+	paths.push_back(Endpoint(2, dbl(1+1e-12,1e-12), dbl(2,0)));
+	paths.push_back(Endpoint(3, dbl(1e6,1), dbl(2,0)));
+	paths.push_back(Endpoint(4, dbl(0,0), dbl(0,0), SuccessCode::MaxNumStepsTaken));
+
+	auto processed = PostProcess(sys, paths, config::PostProcessing<double>(), 2);
+
+	BOOST_CHECK_EQUAL(processed.num_failed, 1);
+	BOOST_REQUIRE_EQUAL(processed.solutions.size(), 3);
+	BOOST_CHECK_EQUAL(processed.solution_of[0], 0);
+	BOOST_CHECK_EQUAL(processed.solution_of[1], 1);
+	BOOST_CHECK_EQUAL(processed.solution_of[2], 0);
+	BOOST_CHECK_EQUAL(processed.solution_of[3], 2);
+	BOOST_CHECK_EQUAL(processed.solution_of[4], PostProcessResults<dbl>::NoSolution);
+
+	auto const& doubled = processed.solutions[0];
+	BOOST_CHECK_EQUAL(doubled.path_index, 0);
+	BOOST_CHECK_EQUAL(doubled.multiplicity, 2);
+	BOOST_CHECK(doubled.is_singular);
+	BOOST_CHECK(doubled.is_real);
+
+	auto const& simple = processed.solutions[1];
+	BOOST_CHECK_EQUAL(simple.multiplicity, 1);
+	BOOST_CHECK(!simple.is_singular);
+	BOOST_CHECK(simple.is_real);
+	BOOST_CHECK(simple.is_finite);
+	BOOST_CHECK(simple.condition_number < 10);
+
+	auto const& far = processed.solutions[2];
+	BOOST_CHECK(!far.is_finite);
+	BOOST_CHECK(!far.is_real);
+
+	BOOST_CHECK_EQUAL(processed.num_finite, 2);
+	BOOST_CHECK_EQUAL(processed.num_real, 2);
+	BOOST_CHECK_EQUAL(processed.num_singular, 1);
+}
+
+
+/**
+\test \b post_process_finds_singular_endpoints The Jacobian of x^2, y-2 at (0,2) cannot be factored.  With a third function, the system is not square.
+*/
+BOOST_AUTO_TEST_CASE(post_process_finds_singular_endpoints)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x,y});
+	sys.AddFunction(pow(x,2));
+	sys.AddFunction(y - 2);
+
+	std::vector< PathResult<mpfr> > paths{Endpoint(0, mpfr(0), mpfr(2))};
+
+	auto processed = PostProcess(sys, paths, config::PostProcessing<mpfr_float>());
+
+	BOOST_REQUIRE_EQUAL(processed.solutions.size(), 1);
+	BOOST_CHECK(processed.solutions[0].is_singular);
+	BOOST_CHECK_EQUAL(processed.solutions[0].multiplicity, 1);
+
+	sys.AddFunction(x*y);
+	BOOST_CHECK_THROW(PostProcess(sys, paths, config::PostProcessing<mpfr_float>()), std::runtime_error);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b same_endpoint_is_precision_aware Points at 16 and 50 digits, equal to 20 digits, are the same for a tolerance of 1e-30, which the lower precision cannot resolve, while two at 50 digits are not.
+*/
+BOOST_AUTO_TEST_CASE(same_endpoint_is_precision_aware)
+{
+	using bertini::tracking::detail::SameEndpoint;
+
+	DefaultPrecision(50);
+	Vec<mpfr> a(1), b(1);
+	a << mpfr("1.00000000000000000001");
+	b << mpfr("1");
+	BOOST_CHECK(!SameEndpoint(a, b, 1e-30));
+
+	DefaultPrecision(16);
+	Vec<mpfr> c(1);
+	c << mpfr("1");
+	DefaultPrecision(50);
+	BOOST_CHECK(SameEndpoint(a, c, 1e-30));
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 50);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
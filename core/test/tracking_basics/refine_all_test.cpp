@@ -0,0 +1,162 @@
+//This file is part of Bertini 2.
+//
+//refine_all_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//refine_all_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with refine_all_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file refine_all_test.cpp Unit testing for refining many points by Newton's method on a pool of threads.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/fixed_precision_tracker.hpp"
+#include "bertini2/tracking/refine_all.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using dbl = std::complex<double>;
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(refine_all)
+
+
+/**
+\test \b refine_all_amp_raises_precision Points near the roots of x^2 = 2+t, refined at t=0 on two threads to a tolerance needing more than the precision they are given in.
+*/
+BOOST_AUTO_TEST_CASE(refine_all_amp_raises_precision)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 2 - t);
+	sys.AddPathVariable(t);
+
+	std::vector< Vec<mpfr> > points(5, Vec<mpfr>(1));
+	points[0] << mpfr("1.41","0");
+	points[1] << mpfr("-1.42","0");
+	points[2] << mpfr("1.414","0.001");
+	points[3] << mpfr("-1.4","-0.01");
+	points[4] << mpfr("1.4142","0");
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	RefineAllConfig refine_config;
+	refine_config.tolerance = 1e-45;
+	refine_config.max_iterations = 10;
+	refine_config.precision = 60;
+
+	auto refined = RefineAll<AMPTracker>(sys, points, mpfr(0), [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::Euler,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		}, refine_config, 2);
+
+	BOOST_CHECK_EQUAL(refined.size(), points.size());
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+
+	for (std::size_t ii = 0; ii < refined.size(); ++ii)
+	{
+		auto const& r = refined[ii];
+		BOOST_CHECK_EQUAL(r.index, ii);
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+		BOOST_CHECK(r.precision >= 60);
+		BOOST_CHECK_EQUAL(Precision(r.point(0)), r.precision);
+
+		DefaultPrecision(r.precision);
+		mpfr_float root = sqrt(mpfr_float(2));
+		if (real(points[ii](0)) < 0)
+			root = -root;
+		BOOST_CHECK(abs(r.point(0) - mpfr(root)) < mpfr_float("1e-40"));
+	}
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b refine_all_double Refining in double precision, with the fixed precision tracker, keeps the precision of the points.
+*/
+BOOST_AUTO_TEST_CASE(refine_all_double)
+{
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 2 - t);
+	sys.AddPathVariable(t);
+
+	std::vector< Vec<dbl> > points(3, Vec<dbl>(1));
+	points[0] << dbl(1.41,0);
+	points[1] << dbl(-1.42,0);
+	points[2] << dbl(1.4,0.01);
+
+	config::Stepping<double> stepping_preferences;
+	config::Newton newton_preferences;
+
+	RefineAllConfig refine_config;
+	refine_config.max_iterations = 10;
+
+	auto refined = RefineAll<DoublePrecisionTracker>(sys, points, dbl(0), [&](DoublePrecisionTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::Euler, 1e-5, 1e5, stepping_preferences, newton_preferences);
+		}, refine_config, 2);
+
+	BOOST_CHECK_EQUAL(refined.size(), points.size());
+	for (std::size_t ii = 0; ii < refined.size(); ++ii)
+	{
+		auto const& r = refined[ii];
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+		BOOST_CHECK_EQUAL(r.precision, bertini::DoublePrecision());
+		BOOST_CHECK(abs(abs(r.point(0)) - sqrt(2.0)) < 1e-10);
+	}
+
+	BOOST_CHECK_THROW(RefineAll<DoublePrecisionTracker>(sys, {Vec<dbl>(2)}, dbl(0), [](DoublePrecisionTracker &){}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,201 @@
+//This file is part of Bertini 2.
+//
+//trace_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//trace_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with trace_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file trace_test.cpp Unit testing for the timeline of what each thread of a run did, and its export for the Chrome trace viewer.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/parallel_tracking.hpp"
+
+#include <set>
+#include <thread>
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(tracing)
+
+
+/**
+\test \b trace_keeps_events_of_each_thread Two threads record into one trace, each into its own buffer, in order, and the paths they mark are those of their events.  Nothing is recorded with no trace active, and a full buffer drops.
+*/
+BOOST_AUTO_TEST_CASE(trace_keeps_events_of_each_thread)
+{
+	using namespace bertini::tracking;
+
+	trace::Record(trace::EventKind::CauchyLoop, 3);
+	BOOST_CHECK(!trace::Active());
+
+	trace::Trace timeline;
+	trace::Start(timeline);
+	BOOST_CHECK(trace::Active()==&timeline);
+
+	auto work = [](std::uint64_t first)
+	{
+		for (std::uint64_t ii = first; ii < first+10; ++ii)
+		{
+			trace::ScopedPath path(ii);
+			trace::Record(trace::EventKind::CauchyLoop, 8);
+		}
+	};
+	std::thread a(work, 0), b(work, 100);
+	a.join();
+	b.join();
+	trace::Stop();
+	trace::Record(trace::EventKind::CauchyLoop, 3);
+
+	auto events = timeline.Events();
+	BOOST_REQUIRE_EQUAL(events.size(), 2);
+	std::set<std::uint64_t> firsts;
+	for (auto const& thread : events)
+	{
+		BOOST_REQUIRE_EQUAL(thread.events.size(), 30);
+		firsts.insert(thread.events[0].path);
+		for (std::size_t ii = 0; ii < thread.events.size(); ++ii)
+		{
+			auto const& e = thread.events[ii];
+			BOOST_CHECK(e.kind==(ii%3==0 ? trace::EventKind::PathBegin : ii%3==1 ? trace::EventKind::CauchyLoop : trace::EventKind::PathEnd));
+			BOOST_CHECK_EQUAL(e.path, thread.events[0].path + ii/3);
+			if (ii > 0)
+				BOOST_CHECK(e.nanoseconds >= thread.events[ii-1].nanoseconds);
+		}
+	}
+	BOOST_CHECK(firsts==std::set<std::uint64_t>({0, 100}));
+	BOOST_CHECK_EQUAL(trace::CurrentPath(), trace::NoPath);
+
+	trace::Trace small(2);
+	trace::Start(small);
+	for (unsigned ii = 0; ii < 5; ++ii)
+		trace::Record(trace::EventKind::Retry, 1);
+	trace::Stop();
+	BOOST_CHECK_EQUAL(small.Events()[0].events.size(), 2);
+	BOOST_CHECK_EQUAL(small.NumDropped(), 3);
+}
+
+
+/**
+\test \b tracking_all_paths_is_traced x^2 - 1 - 3t, from x=2 and x=-2 at t=1 to t=0 on two threads, traced.  Every path is begun and ended once, enclosing the tracking of it, and the export has a complete event for each.
+*/
+BOOST_AUTO_TEST_CASE(tracking_all_paths_is_traced)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 1 - 3*t);
+	sys.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	std::vector< Vec<mpfr> > points(4, Vec<mpfr>(1));
+	for (unsigned ii = 0; ii < points.size(); ++ii)
+		points[ii] << mpfr(ii%2 ? -2 : 2);
+
+	trace::Trace timeline;
+	trace::Start(timeline);
+	auto results = TrackAllPaths<AMPTracker>(sys, detail::StartPointList<mpfr>(points), setup, mpfr(1), mpfr(0), CheckpointConfig(), 2);
+	trace::Stop();
+	for (auto const& r : results)
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+
+	std::vector<unsigned> begun(points.size(), 0), tracked(points.size(), 0);
+	for (auto const& thread : timeline.Events())
+		for (auto const& e : thread.events)
+		{
+			BOOST_REQUIRE(e.path < points.size());
+			if (e.kind==trace::EventKind::PathBegin)
+				++begun[e.path];
+			else if (e.kind==trace::EventKind::TrackEnd)
+				++tracked[e.path];
+		}
+	for (std::size_t ii = 0; ii < points.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(begun[ii], 1);
+		BOOST_CHECK_EQUAL(tracked[ii], 1);
+	}
+
+	const auto json = trace::ToChromeTrace(timeline);
+	BOOST_CHECK_EQUAL(json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0);
+	BOOST_CHECK_EQUAL(json.substr(json.size()-2), "]}");
+	for (std::size_t ii = 0; ii < points.size(); ++ii)
+		BOOST_CHECK(json.find("\"name\":\"path " + std::to_string(ii) + "\"") != std::string::npos);
+	BOOST_CHECK(json.find("\"name\":\"track\"") != std::string::npos);
+	BOOST_CHECK(json.find("\"ended\":false") == std::string::npos);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b unended_spans_close_with_what_encloses_them A piece of tracking not ended, as when a path is put off, ends with its path.
+*/
+BOOST_AUTO_TEST_CASE(unended_spans_close_with_what_encloses_them)
+{
+	using namespace bertini::tracking;
+
+	trace::Trace timeline;
+	timeline.Record(trace::EventKind::PathBegin, 5, 0);
+	timeline.Record(trace::EventKind::TrackBegin, 5, 0);
+	timeline.Record(trace::EventKind::PrecisionChange, 5, 30);
+	timeline.Record(trace::EventKind::PathEnd, 5, 0);
+
+	const auto json = trace::ToChromeTrace(timeline);
+	BOOST_CHECK(json.find("\"name\":\"track\",\"cat\":\"tracking\",\"ph\":\"X\"") != std::string::npos);
+	BOOST_CHECK(json.find("\"ended\":false") != std::string::npos);
+	BOOST_CHECK(json.find("\"name\":\"path 5\"") != std::string::npos);
+	BOOST_CHECK(json.find("\"ph\":\"C\"") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -28,6 +28,10 @@
 #include <boost/test/unit_test.hpp>
 #include "start_system.hpp"
 #include "tracking/tracker.hpp"
+#include "tracking/parallel_tracking.hpp"
+#include "tracking/auto_tune.hpp"
+#include "bertini2/limb_pool.hpp"
+#include "bertini2/system_pool.hpp"
 
 using System = bertini::System;
 using Variable = bertini::node::Variable;
@@ -160,6 +164,228 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_track_quadratic)
 
 
 
+/**
+\test \b AMP_tracker_continues_path The quadratic y = t^2, tracked from 1 to 0.5, then continued from there to -1, without initializing the tracker again.  Continuing before any path was tracked throws.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_continues_path)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,2));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_mid, y_end;
+
+	BOOST_CHECK_THROW(tracker.ContinuePath(y_end, mpfr(-1)), std::runtime_error);
+
+	auto code = tracker.TrackPath(y_mid, mpfr(1), mpfr("0.5"), y_start);
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK(abs(y_mid(0)-mpfr("0.25")) < 1e-5);
+	auto num_steps_first_piece = tracker.NumTotalStepsTaken();
+
+	code = tracker.ContinuePath(y_end, mpfr(-1));
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr(1)) < 1e-5);
+	BOOST_CHECK(tracker.NumTotalStepsTaken() > num_steps_first_piece);
+	BOOST_CHECK(abs(tracker.CurrentTime()-mpfr(-1)) < 1e-10);
+}
+
+
+
+/**
+\test \b AMP_tracker_steps_past_end_times The cubic y = t^3 + t, tracked from 1 to 0.75, 0.5, 0.25 and 0 in pieces.  With dense output, the pieces end past their end times, with the solutions there interpolated, taking no more steps than tracking onto each, and the last piece, to t=0, ends on it.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_steps_past_end_times)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,3)-t);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	config::Newton newton_preferences;
+
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(2);
+
+	const std::vector<mpfr> end_times{mpfr("0.75"), mpfr("0.5"), mpfr("0.25")};
+
+	auto track_in_pieces = [&](bertini::tracking::AMPTracker const& tracker)
+	{
+		Vec<mpfr> y_end;
+		auto code = tracker.TrackPath(y_end, mpfr(1), end_times[0], y_start);
+		BOOST_CHECK(code==SuccessCode::Success);
+		for (unsigned ii = 0; ii < end_times.size(); ++ii)
+		{
+			if (ii>0)
+			{
+				code = tracker.ContinuePath(y_end, end_times[ii]);
+				BOOST_CHECK(code==SuccessCode::Success);
+			}
+			const mpfr& t_end = end_times[ii];
+			BOOST_CHECK(abs(y_end(0) - (t_end*t_end*t_end + t_end)) < 1e-5);
+		}
+		return tracker.NumTotalStepsTaken();
+	};
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	bertini::tracking::AMPTracker onto(sys);
+	onto.Setup(config::Predictor::RKF45, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_preferences, newton_preferences);
+	onto.PrecisionSetup(AMP);
+	const auto num_steps_onto = track_in_pieces(onto);
+	BOOST_CHECK(!onto.SteppedPastEndTime());
+
+	stepping_preferences.dense_output = true;
+	bertini::tracking::AMPTracker past(sys);
+	past.Setup(config::Predictor::RKF45, mpfr_float("1e-5"), mpfr_float("1e5"), stepping_preferences, newton_preferences);
+	past.PrecisionSetup(AMP);
+
+	Vec<mpfr> y_end;
+	auto code = past.TrackPath(y_end, mpfr(1), end_times[0], y_start);
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK(past.SteppedPastEndTime());
+	BOOST_CHECK(real(past.CurrentTime()) < real(end_times[0]));
+	BOOST_CHECK(abs(y_end(0) - mpfr("1.171875")) < 1e-5);
+
+	const auto num_steps_past = track_in_pieces(past);
+	BOOST_CHECK(num_steps_past <= num_steps_onto);
+
+	// t=0 is where homotopies end, and is never stepped past
+	code = past.ContinuePath(y_end, mpfr(0));
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK(!past.SteppedPastEndTime());
+	BOOST_CHECK(abs(past.CurrentTime()) < 1e-10);
+	BOOST_CHECK(abs(y_end(0)) < 1e-5);
+}
+
+
+
+/**
+\test \b AMP_tracker_interleaves_paths The two roots of y^2 = t+2, tracked from t=1 to 0 by two trackers on one system, a step of each in turn, reach the same endpoints in the same number of steps as tracking each all at once.  Advancing before beginning a path throws.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_interleaves_paths)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(pow(y,2)-t-2);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	AMPTracker first(sys), second(sys);
+	std::vector<AMPTracker*> trackers{&first, &second};
+	for (auto tracker : trackers)
+	{
+		tracker->Setup(config::Predictor::Euler,
+		              mpfr_float("1e-5"),
+						mpfr_float("1e5"),
+						stepping_preferences,
+						newton_preferences);
+		tracker->PrecisionSetup(AMP);
+	}
+
+	std::vector<Vec<mpfr> > start_points(2, Vec<mpfr>(1));
+	start_points[0] << mpfr(sqrt(mpfr_float(3)));
+	start_points[1] << mpfr(-sqrt(mpfr_float(3)));
+
+	std::vector<Vec<mpfr> > all_at_once(2);
+	std::vector<unsigned> num_steps(2);
+	for (unsigned ii=0; ii<2; ++ii)
+	{
+		BOOST_CHECK(!trackers[ii]->PathInProgress());
+		BOOST_CHECK_THROW(trackers[ii]->AdvancePath(all_at_once[ii]), std::runtime_error);
+
+		auto code = trackers[ii]->TrackPath(all_at_once[ii], mpfr(1), mpfr(0), start_points[ii]);
+		BOOST_CHECK(code==SuccessCode::Success);
+		BOOST_CHECK(!trackers[ii]->PathInProgress());
+		num_steps[ii] = trackers[ii]->NumTotalStepsTaken();
+	}
+
+	std::vector<Vec<mpfr> > interleaved(2);
+	for (unsigned ii=0; ii<2; ++ii)
+	{
+		auto code = trackers[ii]->BeginPath(mpfr(1), mpfr(0), start_points[ii]);
+		BOOST_CHECK(code==SuccessCode::Success);
+		BOOST_CHECK(trackers[ii]->PathInProgress());
+	}
+
+	unsigned num_rounds = 0;
+	while (trackers[0]->PathInProgress() || trackers[1]->PathInProgress())
+	{
+		for (unsigned ii=0; ii<2; ++ii)
+			if (trackers[ii]->PathInProgress())
+			{
+				auto code = trackers[ii]->AdvancePath(interleaved[ii]);
+				BOOST_CHECK(code==SuccessCode::Success);
+			}
+		++num_rounds;
+		BOOST_REQUIRE(num_rounds < 10000);
+	}
+
+	for (unsigned ii=0; ii<2; ++ii)
+	{
+		BOOST_CHECK_EQUAL(trackers[ii]->NumTotalStepsTaken(), num_steps[ii]);
+		BOOST_CHECK_EQUAL(interleaved[ii].size(), 1);
+		BOOST_CHECK(abs(interleaved[ii](0)-all_at_once[ii](0)) < 1e-10);
+	}
+	BOOST_CHECK(abs(interleaved[0](0)-mpfr(sqrt(mpfr_float(2)))) < 1e-5);
+	BOOST_CHECK(abs(interleaved[1](0)+mpfr(sqrt(mpfr_float(2)))) < 1e-5);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic)
 {
 	mpfr_float::default_precision(30);
@@ -180,12 +406,366 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic)
 
 	bertini::tracking::AMPTracker tracker(sys);
 
-
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(-2);
+	
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	tracker.TrackPath(y_end,
+	                  t_start, t_end, y_start);
+
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
+
+}
+
+
+
+
+/**
+\test \b arithmetic_cost_model_interpolates_measured_costs With no costs set the model is analytic.  With some, it is linear between and beyond them, and double precision is always 1.
+*/
+BOOST_AUTO_TEST_CASE(arithmetic_cost_model_interpolates_measured_costs)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	config::ArithmeticCostModel model;
+	BOOST_CHECK(!model.IsCalibrated());
+	BOOST_CHECK_EQUAL(model.Cost(40), ArithmeticCost(40));
+	BOOST_CHECK_EQUAL(model.Cost(bertini::DoublePrecision()), 1);
+
+	model.Set(20, 4);
+	BOOST_CHECK_EQUAL(model.Cost(100), 4);
+
+	model.Set(40, 8);
+	BOOST_CHECK(model.IsCalibrated());
+	BOOST_CHECK_EQUAL(model.Cost(bertini::DoublePrecision()), 1);
+	BOOST_CHECK(abs(model.Cost(30) - 6) < mpfr_float("1e-12"));
+	BOOST_CHECK(abs(model.Cost(60) - 12) < mpfr_float("1e-12"));
+	BOOST_CHECK(model.Cost(10) > 0);
+
+	BOOST_CHECK_THROW(model.Set(bertini::DoublePrecision(), 2), std::runtime_error);
+	BOOST_CHECK_THROW(model.Set(50, 0), std::runtime_error);
+
+	model.Clear();
+	BOOST_CHECK_EQUAL(model.Cost(40), ArithmeticCost(40));
+}
+
+
+/**
+\test \b AMP_tracker_track_decic_calibrated_cost Calibrating the cost model on the homotopy gives a positive cost at each precision asked for, leaves the default precision alone, and the tracker using it still tracks y=t^10 to t=-2.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic_calibrated_cost)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	AMP.arithmetic_cost = CalibrateArithmeticCost(sys, {20, 40}, 0.001);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	BOOST_CHECK_EQUAL(AMP.arithmetic_cost.Costs().size(), 2);
+	for (const auto& c : AMP.arithmetic_cost.Costs())
+		BOOST_CHECK(c.second > 0);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(-2);
+	
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	auto code = tracker.TrackPath(y_end, t_start, t_end, y_start);
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
+}
+
+
+
+
+/**
+\test \b order_selector_climbs_on_clean_windows_and_drops_on_failures A window of accepted steps moves the selector up a rung, a run of failures moves it down at once, and a method measured as more expensive than the one below is left.
+*/
+BOOST_AUTO_TEST_CASE(order_selector_climbs_on_clean_windows_and_drops_on_failures)
+{
+	using namespace bertini::tracking;
+
+	config::OrderSelection settings;
+	settings.adaptive = true;
+	settings.window = 4;
+	settings.max_consecutive_failures = 2;
+
+	predict::OrderSelector selector(settings);
+	BOOST_CHECK(selector.Start(config::Predictor::Euler)==config::Predictor::HeunEuler);
+	BOOST_CHECK(selector.Start(config::Predictor::RKF45)==config::Predictor::RKCashKarp45);
+	BOOST_CHECK(selector.Start(config::Predictor::RKVerner67)==config::Predictor::RKVerner67);
+
+	selector.Start(config::Predictor::HeunEuler);
+	for (unsigned ii = 0; ii < 3; ++ii)
+		BOOST_CHECK(selector.Record(true, 0.01, 4, 0)==config::Predictor::HeunEuler);
+	BOOST_CHECK(selector.Record(true, 0.01, 4, 0)==config::Predictor::RKCashKarp45);
+
+	// the higher order method takes no longer steps, so costs more per unit time
+	for (unsigned ii = 0; ii < 3; ++ii)
+		selector.Record(true, 0.01, 8, 0);
+	BOOST_CHECK(selector.Record(true, 0.01, 8, 0)==config::Predictor::HeunEuler);
+
+	// and is not tried again while that measurement stands
+	for (unsigned ii = 0; ii < 4; ++ii)
+		selector.Record(true, 0.01, 4, 0);
+	BOOST_CHECK(selector.Current()==config::Predictor::HeunEuler);
+
+	selector.Start(config::Predictor::RKDormandPrince56);
+	BOOST_CHECK(selector.Record(false, 0, 10, 1)==config::Predictor::RKDormandPrince56);
+	BOOST_CHECK(selector.Record(false, 0, 10, 2)==config::Predictor::RKCashKarp45);
+}
+
+
+/**
+\test \b AMP_tracker_track_decic_adaptive_order Tracking with adaptive order selection reaches the same endpoint as with one predictor, and leaves one of the embedded pairs in use.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic_adaptive_order)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::HeunEuler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	config::OrderSelection order_selection;
+	order_selection.adaptive = true;
+	tracker.PredictorOrderSelection(order_selection);
+
+	mpfr t_start(1);
+	mpfr t_end(-2);
+	
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	auto code = tracker.TrackPath(y_end,
+	                  t_start, t_end, y_start);
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
+
+	const auto& ladder = predict::OrderSelector::Ladder();
+	BOOST_CHECK(std::find(ladder.begin(), ladder.end(), tracker.Predictor())!=ladder.end());
+
+	order_selection.adaptive = false;
+	tracker.PredictorOrderSelection(order_selection);
+	BOOST_CHECK(tracker.Predictor()==config::Predictor::HeunEuler);
+}
+
+
+
+
+/**
+\test \b AMP_tracker_track_decic_PI_controller Tracking with the PI step size controller reaches the same endpoint as with the grow-shrink one.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic_PI_controller)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	stepping_preferences.step_size_controller = config::StepSizeController::PI;
+	config::Newton newton_preferences;
+
+
+	tracker.Setup(config::Predictor::HeunEuler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	mpfr t_start(1);
+	mpfr t_end(-2);
+	
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	auto code = tracker.TrackPath(y_end,
+	                  t_start, t_end, y_start);
+
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
+}
+
+
+
+
+/**
+\test \b allocation_counts_see_through_pools With the limb pool installed, a block it cannot serve comes from the memory functions of allocation counting, and is counted as an allocation and a miss, and the same block again is a hit.  A PointPool counts its loans alike.
+*/
+BOOST_AUTO_TEST_CASE(allocation_counts_see_through_pools)
+{
+	using namespace bertini;
+	using tracking::instrument::ThreadAllocations;
+	DefaultPrecision(300);
+
+	const bool was_installed = limb_pool::IsInstalled();
+	limb_pool::Install();
+	limb_pool::ReleaseThreadCache();
+
+	const auto before = ThreadAllocations();
+	{
+		mpfr_float x(3);
+	}
+	const auto after_miss = ThreadAllocations();
+	{
+		mpfr_float x(5);
+	}
+	const auto after_hit = ThreadAllocations();
+
+	BOOST_CHECK(after_miss.pool_misses > before.pool_misses);
+	BOOST_CHECK(after_hit.pool_hits > after_miss.pool_hits);
+#ifdef BERTINI_ENABLE_ALLOCATION_COUNTING
+	BOOST_CHECK(after_miss.allocations > before.allocations);
+	BOOST_CHECK(after_miss.bytes > before.bytes);
+#endif
+
+	limb_pool::ReleaseThreadCache();
+	if (!was_installed)
+		limb_pool::Uninstall();
+
+	PointPool<mpfr> points;
+	const auto before_loans = ThreadAllocations();
+	{
+		auto v = points.Acquire(3);
+	}
+	{
+		auto v = points.Acquire(3);
+	}
+	const auto after_loans = ThreadAllocations();
+	BOOST_CHECK_EQUAL(after_loans.pool_misses - before_loans.pool_misses, 1);
+	BOOST_CHECK_EQUAL(after_loans.pool_hits - before_loans.pool_hits, 1);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
+/**
+\test \b AMP_tracker_profiles_phases Tracking records every prediction and correction in the tracker's profile, with the evaluations and linear solves inside them, and the profile clears.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_profiles_phases)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+	using instrument::Phase;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
 	config::Stepping<mpfr_float> stepping_preferences;
 	config::Newton newton_preferences;
 
-
-	tracker.Setup(config::Predictor::Euler,
+	tracker.Setup(config::Predictor::RK4,
 	              	mpfr_float("1e-5"),
 					mpfr_float("1e5"),
 					stepping_preferences,
@@ -201,17 +781,284 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_track_decic)
 
 	Vec<mpfr> y_end;
 
-	tracker.TrackPath(y_end,
+	auto code = tracker.TrackPath(y_end,
 	                  t_start, t_end, y_start);
+	BOOST_CHECK(code==SuccessCode::Success);
+
+#ifdef BERTINI_ENABLE_INSTRUMENTATION
+	auto const& profile = tracker.Profile();
+	BOOST_CHECK(profile.Total(Phase::Predict).calls > 0);
+	BOOST_CHECK(profile.Total(Phase::Correct).calls > 0);
+	// every prediction evaluates the Jacobian at least once, and so does every correction
+	BOOST_CHECK(profile.Total(Phase::JacobianEvaluation).calls >= profile.Total(Phase::Predict).calls + profile.Total(Phase::Correct).calls);
+	BOOST_CHECK(profile.Total(Phase::LinearSolve).calls > 0);
+	BOOST_CHECK(profile.Total(Phase::Endgame).calls==0);
+	BOOST_CHECK(!profile.Precisions().empty());
+
+	unsigned calls = 0;
+	for (auto p : profile.Precisions())
+		calls += profile.Total(Phase::Predict, p).calls;
+	BOOST_CHECK_EQUAL(calls, profile.Total(Phase::Predict).calls);
+
+#ifdef BERTINI_ENABLE_ALLOCATION_COUNTING
+	// the path is tracked in multiple precision, whose temporaries allocate their limbs
+	BOOST_CHECK(profile.Total(Phase::Predict).allocations > 0);
+	BOOST_CHECK(profile.Total(Phase::Predict).bytes >= profile.Total(Phase::Predict).allocations);
+#else
+	BOOST_CHECK_EQUAL(profile.Total(Phase::Predict).allocations, 0);
+#endif
+
+	tracker.ResetProfile();
+	BOOST_CHECK(tracker.Profile().Precisions().empty());
+	BOOST_CHECK_EQUAL(tracker.Profile().Total(Phase::Predict).calls, 0);
+#else
+	BOOST_CHECK(tracker.Profile().Precisions().empty());
+#endif
+}
+
+
+
+/**
+\test \b AMP_tracker_counts_path_statistics Tracking counts its steps, iterations and evaluations, whatever the instrumentation, in statistics which reset to zero.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_counts_path_statistics)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::RK4,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	tracker.ResetStatistics();
+	auto code = tracker.TrackPath(y_end, mpfr(1), mpfr(-2), y_start);
+	BOOST_CHECK(code==SuccessCode::Success);
+
+	const auto statistics = tracker.Statistics();
+	BOOST_CHECK_EQUAL(statistics.steps_accepted + statistics.steps_rejected, tracker.NumTotalStepsTaken());
+	BOOST_CHECK(statistics.steps_accepted > 0);
+	// every step corrects at least once, and predicts with four evaluations
+	BOOST_CHECK(statistics.newton_iterations >= statistics.steps_accepted);
+	BOOST_CHECK(statistics.evaluations >= statistics.newton_iterations + 4*statistics.steps_accepted);
+	BOOST_CHECK_EQUAL(statistics.final_precision, tracker.CurrentPrecision());
+	BOOST_CHECK(statistics.max_precision >= statistics.final_precision);
+	BOOST_CHECK(statistics.tracking_seconds > 0);
+	BOOST_CHECK(statistics.endgame==instrument::PathStatistics::EndgameType::None);
+	BOOST_CHECK_EQUAL(statistics.endgame_seconds, 0);
+
+	tracker.ResetStatistics();
+	BOOST_CHECK_EQUAL(tracker.Statistics().steps_accepted, 0);
+	BOOST_CHECK_EQUAL(tracker.Statistics().newton_iterations, 0);
+	BOOST_CHECK_EQUAL(tracker.Statistics().evaluations, 0);
+}
+
+
+
+
+/**
+\test \b AMP_tracker_speculates_at_smaller_step_sizes A path of y - t^10, with an Euler predictor, which fails many steps.  Attempting each at three step sizes at once, also at a higher precision, ends where tracking alone does.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_speculates_at_smaller_step_sizes)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	config::Speculation speculation;
+	speculation.num_attempts = 3;
+	tracker.SpeculativeStepping(speculation);
 
+	BOOST_CHECK(tracker.TrackPath(y_end, mpfr(1), mpfr(-2), y_start)==SuccessCode::Success);
 	BOOST_CHECK_EQUAL(y_end.size(),1);
 	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
 
+	speculation.raise_precision = true;
+	tracker.SpeculativeStepping(speculation);
+
+	BOOST_CHECK(tracker.TrackPath(y_end, mpfr(1), mpfr(-2), y_start)==SuccessCode::Success);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
+
+	speculation.num_attempts = 0;
+	BOOST_CHECK_THROW(tracker.SpeculativeStepping(speculation), std::runtime_error);
+}
+
+
+
+
+/**
+\test \b AMP_tracker_raises_precision_predictively A path of y - t^10, with an Euler predictor.  Raising precision from the trend of the digits the criteria require ends where raising it on failure does.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_raises_precision_predictively)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_end;
+
+	BOOST_CHECK(tracker.TrackPath(y_end, mpfr(1), mpfr(-2), y_start)==SuccessCode::Success);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
+
+	AMP.predictive_precision = true;
+	tracker.PrecisionSetup(AMP);
+
+	BOOST_CHECK(tracker.TrackPath(y_end, mpfr(1), mpfr(-2), y_start)==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(y_end.size(),1);
+	BOOST_CHECK(abs(y_end(0)-mpfr("1024.0")) < 1e-5);
 }
 
 
 
 
+/**
+\test \b AMP_tracker_predicts_in_double_above_a_precision A path of y - t^10, tracked at 100 digits, which precision is not allowed to drop.  Predicting in double above 64 digits, and correcting at 100, ends where predicting at 100 digits does, at 100 digits.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_predicts_in_double_above_a_precision)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(100);
+
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{y};
+
+	sys.AddFunction(y-pow(t,10));
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+	AMP.max_num_precision_decreases = 0;
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::RKF45,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+
+	Vec<mpfr> y_start(1);
+	y_start << mpfr(1);
+
+	Vec<mpfr> y_full;
+	auto code = tracker.TrackPath(y_full, mpfr(1), mpfr("0.5"), y_start);
+	BOOST_CHECK(code==SuccessCode::Success);
+
+	AMP.reduced_precision_prediction_above = 64;
+	tracker.PrecisionSetup(AMP);
+	tracker.ResetProfile();
+
+	DefaultPrecision(100);
+	Vec<mpfr> y_reduced;
+	code = tracker.TrackPath(y_reduced, mpfr(1), mpfr("0.5"), y_start);
+	BOOST_CHECK(code==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(tracker.CurrentPrecision(), 100);
+	BOOST_CHECK_EQUAL(Precision(y_reduced(0)), 100);
+	BOOST_CHECK(abs(y_reduced(0) - y_full(0)) < mpfr_float("1e-10"));
+	BOOST_CHECK(abs(y_reduced(0) - pow(mpfr("0.5"),10)) < mpfr_float("1e-10"));
+
+#ifdef BERTINI_ENABLE_INSTRUMENTATION
+	BOOST_CHECK(tracker.Profile().Total(instrument::Phase::Predict, bertini::DoublePrecision()).calls > 0);
+#endif
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+
 BOOST_AUTO_TEST_CASE(AMP_tracker_track_square_root)
 {
 	mpfr_float::default_precision(30);
@@ -275,26 +1122,113 @@ BOOST_AUTO_TEST_CASE(AMP_tracker_track_square_root)
 	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
 	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
 
-	t_start = mpfr(-1);
-	start_point << mpfr(-1), mpfr(0,-1);
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	t_start = mpfr(-1);
+	start_point << mpfr(-1), mpfr(0,-1);
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
+
+	start_point << mpfr(-1), mpfr(0,1);
+	tracking_success = tracker.TrackPath(end_point,
+	                  t_start, t_end, start_point);
+
+	BOOST_CHECK(tracking_success==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(end_point.size(),2);
+	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
+}
+
+
+
+/**
+\class bertini::tracking::AMPTracker
+\test \b AMP_tracker_releases_space_it_has_left Step a tracker down from multiple precision to double, and check that it holds no multiple precision space values, and the point survives the step.  Then step back up, and track paths at other precisions with the same tracker, checking they still track correctly.
+*/
+BOOST_AUTO_TEST_CASE(AMP_tracker_releases_space_it_has_left)
+{
+	mpfr_float::default_precision(30);
+	using namespace bertini::tracking;
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddFunction(pow(x,2) + (1-t)*x - 1);
+	sys.AddFunction(pow(y,2) + (1-t)*x*y - 2);
+	sys.AddPathVariable(t);
+	sys.AddVariableGroup(v);
+
+	auto AMP = bertini::tracking::config::AMPConfigFrom(sys);
+
+	bertini::tracking::AMPTracker tracker(sys);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+
+	tracker.Setup(config::Predictor::Euler,
+	              	mpfr_float("1e-5"),
+					mpfr_float("1e5"),
+					stepping_preferences,
+					newton_preferences);
+
+	tracker.PrecisionSetup(AMP);
+	tracker.PrecisionPreservation(true);
 
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
+	mpfr t_start(1);
+	mpfr t_end(0);
 
-	start_point << mpfr(-1), mpfr(0,1);
-	tracking_success = tracker.TrackPath(end_point,
-	                  t_start, t_end, start_point);
+	Vec<mpfr> start_point(2);
+	Vec<mpfr> end_point;
 
-	BOOST_CHECK(tracking_success==SuccessCode::Success);
-	BOOST_CHECK_EQUAL(end_point.size(),2);
-	BOOST_CHECK(abs(end_point(0)-mpfr(0)) < 1e-5);
-	BOOST_CHECK(abs(end_point(1)-mpfr(0)) < 1e-5);
-}
+	start_point << mpfr(1), mpfr("1.414");
+	BOOST_CHECK(tracker.TrackPath(end_point, t_start, t_end, start_point)==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(tracker.CurrentPrecision(), 30);
+	BOOST_CHECK_EQUAL(tracker.SpaceHeld<dbl>(), 0);
+
+	tracker.ChangePrecision(16);
+	BOOST_CHECK_EQUAL(tracker.CurrentPrecision(), 16);
+	BOOST_CHECK_EQUAL(tracker.SpaceHeld<mpfr>(), 0);
+	Vec<mpfr> point = tracker.CurrentPoint();
+	BOOST_CHECK_EQUAL(point.size(), 2);
+	for (int ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(abs(point(ii) - end_point(ii)) < 1e-14);
+
+	tracker.ChangePrecision(40);
+	BOOST_CHECK_EQUAL(tracker.CurrentPrecision(), 40);
+	BOOST_CHECK_EQUAL(tracker.SpaceHeld<dbl>(), 0);
+	point = tracker.CurrentPoint();
+	BOOST_CHECK_EQUAL(point.size(), 2);
+	for (int ii = 0; ii < 2; ++ii)
+		BOOST_CHECK(abs(point(ii) - end_point(ii)) < 1e-14);
+
+	// a path begun in double ends there, holding nothing in multiple precision
+	mpfr_float::default_precision(16);
+	start_point = Vec<mpfr>(2);
+	start_point << mpfr(1), mpfr("1.414");
+	BOOST_CHECK(tracker.TrackPath(end_point, t_start, t_end, start_point)==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(tracker.CurrentPrecision(), 16);
+	BOOST_CHECK_EQUAL(tracker.SpaceHeld<mpfr>(), 0);
+	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
 
+	// and one begun higher still rises from there, and tracks
+	mpfr_float::default_precision(50);
+	start_point = Vec<mpfr>(2);
+	start_point << mpfr(1), mpfr("1.414");
+	BOOST_CHECK(tracker.TrackPath(end_point, t_start, t_end, start_point)==SuccessCode::Success);
+	BOOST_CHECK_EQUAL(tracker.CurrentPrecision(), 50);
+	BOOST_CHECK_EQUAL(tracker.SpaceHeld<dbl>(), 0);
+	BOOST_CHECK(abs(end_point(0)-mpfr("6.180339887498949e-01")) < 1e-5);
+	BOOST_CHECK(abs(end_point(1)-mpfr("1.138564265110173e+00")) < 1e-5);
+}
 
 
 
@@ -827,6 +1761,510 @@ BOOST_AUTO_TEST_CASE(AMP_track_total_degree_start_system)
 }
 
 
+/**
+\test \b AMP_track_total_degree_in_parallel Track the total degree homotopy of the previous test on two threads, each with its own copy of the systems, and find both solutions.
+*/
+BOOST_AUTO_TEST_CASE(AMP_track_total_degree_in_parallel)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(final_system);
+
+	auto results = TrackAllPaths<AMPTracker>(final_system, TD,
+		[&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::Euler,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+			tracker.PrecisionPreservation(true);
+		},
+		mpfr(1), mpfr(0), 2);
+
+	BOOST_CHECK_EQUAL(results.size(), TD.NumStartPoints());
+	BOOST_CHECK_EQUAL(DefaultPrecision(),30);
+
+	Vec<mpfr> solution_1(2);
+	solution_1 << mpfr("-0.61803398874989484820458683","0"), mpfr("1.6180339887498948482045868","0");
+
+	Vec<mpfr> solution_2(2);
+	solution_2 << mpfr("1.6180339887498948482045868","0"), mpfr("-0.6180339887498948482045868","0");
+
+	unsigned num_1(0), num_2(0);
+	for (unsigned ii = 0; ii < results.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(results[ii].index, ii);
+		BOOST_CHECK(results[ii].success_code==SuccessCode::Success);
+		BOOST_CHECK(results[ii].statistics.steps_accepted > 0);
+		BOOST_CHECK(results[ii].statistics.evaluations > results[ii].statistics.newton_iterations);
+		auto s = final_system.DehomogenizePoint(results[ii].endpoint);
+		if ( (s-solution_1).norm() < mpfr_float("1e-5"))
+			num_1++;
+		if ( (s-solution_2).norm() < mpfr_float("1e-5"))
+			num_2++;
+	}
+	BOOST_CHECK_EQUAL(num_1,1);
+	BOOST_CHECK_EQUAL(num_2,1);
+}
+
+
+/**
+\test \b work_stealing_queues_hand_out_each_path_once One worker draining the queues, by its own block, stealing, and the shared queue, gets every item exactly once.
+*/
+BOOST_AUTO_TEST_CASE(work_stealing_queues_hand_out_each_path_once)
+{
+	using bertini::tracking::detail::WorkStealingQueues;
+
+	WorkStealingQueues queues(10, 3);
+
+	std::vector<unsigned> times_handed_out(10, 0);
+	std::size_t item;
+
+	// worker 1 takes the first of its block, then gives up the rest, as on entering the high precision lane
+	BOOST_CHECK(queues.Next(1, item));
+	times_handed_out[item]++;
+	queues.Release(1);
+
+	while (queues.Next(0, item))
+		times_handed_out[item]++;
+
+	for (auto n : times_handed_out)
+		BOOST_CHECK_EQUAL(n, 1);
+
+	BOOST_CHECK(!queues.Next(1, item));
+	BOOST_CHECK(!queues.Next(2, item));
+}
+
+
+/**
+\test \b AMP_track_in_parallel_resumes_from_checkpoint A run writes a checkpoint of every path it finished, and a run given a checkpoint returns the paths finished in it without tracking them again, and tracks the rest.
+*/
+BOOST_AUTO_TEST_CASE(AMP_track_in_parallel_resumes_from_checkpoint)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(final_system);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::Euler,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	CheckpointConfig checkpoint;
+	checkpoint.file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_checkpoint_%%%%-%%%%");
+
+	auto results = TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), checkpoint, 2);
+
+	Checkpoint<mpfr> written;
+	BOOST_CHECK(written.Load(checkpoint.file));
+	BOOST_CHECK_EQUAL(written.num_paths, results.size());
+	BOOST_CHECK_EQUAL(written.finished.size(), results.size());
+	BOOST_CHECK(written.in_flight.empty());
+
+	// keep only the first path, marked so that tracking it again would show
+	Checkpoint<mpfr> partial;
+	partial.num_paths = results.size();
+	partial.finished.push_back(results[0]);
+	partial.finished.back().endpoint(0) = mpfr(42);
+	partial.Save(checkpoint.file);
+
+	auto resumed = TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), checkpoint, 2);
+
+	BOOST_CHECK_EQUAL(resumed.size(), results.size());
+	BOOST_CHECK(resumed[0].endpoint(0) == mpfr(42));
+	for (unsigned ii = 1; ii < resumed.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(resumed[ii].index, ii);
+		BOOST_CHECK(resumed[ii].success_code==SuccessCode::Success);
+		BOOST_CHECK((resumed[ii].endpoint - results[ii].endpoint).norm() < mpfr_float("1e-5"));
+	}
+
+	// a checkpoint of another run is refused
+	partial.num_paths = results.size()+1;
+	partial.Save(checkpoint.file);
+	BOOST_CHECK_THROW(TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), checkpoint, 2), std::runtime_error);
+
+	boost::filesystem::remove(checkpoint.file);
+}
+
+
+/**
+\test \b AMP_track_in_parallel_passes_endpoints_to_a_sink Each path is passed to the sink once, and the checkpoints hold only which paths finished.  A run resuming from one passes on only the paths not finished in it, and the overload returning the results refuses it.
+*/
+BOOST_AUTO_TEST_CASE(AMP_track_in_parallel_passes_endpoints_to_a_sink)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(final_system);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::Euler,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	CheckpointConfig checkpoint;
+	checkpoint.file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("b2_checkpoint_%%%%-%%%%");
+
+	const auto num_paths = static_cast<std::size_t>(TD.NumStartPoints());
+	std::vector<unsigned> times_passed(num_paths, 0);
+	TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0),
+		[&](PathResult<mpfr> && result)
+		{
+			times_passed[result.index]++;
+			BOOST_CHECK(result.success_code==SuccessCode::Success);
+		},
+		checkpoint, 2);
+
+	for (auto n : times_passed)
+		BOOST_CHECK_EQUAL(n, 1);
+
+	Checkpoint<mpfr> written;
+	BOOST_CHECK(written.Load(checkpoint.file));
+	BOOST_CHECK_EQUAL(written.num_paths, num_paths);
+	BOOST_CHECK(written.finished.empty());
+	BOOST_CHECK_EQUAL(written.delivered.size(), num_paths);
+
+	Checkpoint<mpfr> partial;
+	partial.num_paths = num_paths;
+	partial.delivered.push_back(0);
+	partial.Save(checkpoint.file);
+
+	std::fill(times_passed.begin(), times_passed.end(), 0);
+	TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0),
+		[&](PathResult<mpfr> && result)
+		{
+			times_passed[result.index]++;
+		},
+		checkpoint, 2);
+
+	BOOST_CHECK_EQUAL(times_passed[0], 0);
+	for (std::size_t ii = 1; ii < num_paths; ++ii)
+		BOOST_CHECK_EQUAL(times_passed[ii], 1);
+
+	partial.Save(checkpoint.file);
+	BOOST_CHECK_THROW(TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), checkpoint, 2), std::runtime_error);
+
+	boost::filesystem::remove(checkpoint.file);
+}
+
+
+/**
+\test \b AMP_track_in_parallel_defers_paths_over_budget With a budget of a few steps, every path of the total degree homotopy is put off to the slow lane, and finished from there at the endpoints an unlimited run finds, whether the slow lane is served by all workers after the main batch, or by one of its own.
+*/
+BOOST_AUTO_TEST_CASE(AMP_track_in_parallel_defers_paths_over_budget)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(final_system);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::Euler,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto unlimited = TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), 2);
+
+	PathBudget budget;
+	budget.max_steps = 3;
+
+	for (unsigned slow_lane_workers : {0u, 1u})
+	{
+		budget.slow_lane_workers = slow_lane_workers;
+		metrics::Registry registry;
+		auto results = TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), CheckpointConfig(), 2, 64, &registry, false, budget);
+
+		BOOST_CHECK_EQUAL(registry.TakeSnapshot().Count(metrics::Counter::PathsDeferred), TD.NumStartPoints());
+		BOOST_CHECK_EQUAL(results.size(), unlimited.size());
+		for (unsigned ii = 0; ii < results.size(); ++ii)
+		{
+			BOOST_CHECK_EQUAL(results[ii].index, ii);
+			BOOST_CHECK(results[ii].success_code==SuccessCode::Success);
+			BOOST_CHECK((results[ii].endpoint - unlimited[ii].endpoint).norm() < mpfr_float("1e-5"));
+		}
+	}
+
+	BOOST_CHECK(!budget.Exceeded(2, std::chrono::seconds(100), 1000));
+	BOOST_CHECK(budget.Exceeded(3, std::chrono::seconds(0), 16));
+	BOOST_CHECK(!PathBudget().Limited());
+}
+
+
+/**
+\test \b AMP_retry_failed_paths_climbs_the_ladder A run allowed too few steps fails every path.  Retried, a rung which only changes the predictor fails them again, and the next, which allows enough steps, recovers them all, at the endpoints of an ordinary run.
+*/
+BOOST_AUTO_TEST_CASE(AMP_retry_failed_paths_climbs_the_ladder)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(final_system);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::Euler,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto ordinary = TrackAllPaths<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), 2);
+
+	config::Stepping<mpfr_float> hasty = stepping_preferences;
+	hasty.max_num_steps = 2;
+	auto hasty_setup = [&](AMPTracker & tracker)
+		{
+			setup(tracker);
+			tracker.SteppingSettings(hasty);
+		};
+
+	auto results = TrackAllPaths<AMPTracker>(final_system, TD, hasty_setup, mpfr(1), mpfr(0), 2);
+	for (auto const& r : results)
+		BOOST_CHECK(r.success_code==SuccessCode::MaxNumStepsTaken);
+
+	RetryPolicy<AMPTracker> policy;
+	policy.ladder.push_back(RetryRung<AMPTracker>::SwitchPredictor(config::Predictor::RK4));
+	RetryRung<AMPTracker> patient;
+	patient.adjust = [&](AMPTracker & tracker)
+		{
+			tracker.SteppingSettings(stepping_preferences);
+		};
+	policy.ladder.push_back(patient);
+
+	metrics::Registry registry;
+	auto num_failed = RetryFailedPaths<AMPTracker>(results, final_system, TD, hasty_setup, mpfr(1), mpfr(0), policy, 2, 64, &registry);
+
+	BOOST_CHECK_EQUAL(num_failed, 0);
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	for (unsigned ii = 0; ii < results.size(); ++ii)
+	{
+		BOOST_CHECK_EQUAL(results[ii].index, ii);
+		BOOST_CHECK(results[ii].success_code==SuccessCode::Success);
+		BOOST_CHECK((results[ii].endpoint - ordinary[ii].endpoint).norm() < mpfr_float("1e-5"));
+	}
+
+	auto s = registry.TakeSnapshot();
+	BOOST_CHECK_EQUAL(s.Count(metrics::Counter::PathsRetried), 2*results.size());
+	BOOST_CHECK_EQUAL(s.Count(metrics::Counter::PathsRecovered), results.size());
+
+	BOOST_CHECK_EQUAL(RetryPolicy<AMPTracker>::Default().ladder.size(), 3);
+	BOOST_CHECK_EQUAL(RetryPolicy<AMPTracker>::Default().ladder[2].start_precision, 60);
+}
+
+
+/**
+\test \b AMP_auto_tune_chooses_the_candidate_which_answers A candidate allowed too few steps fails every path of the sample, so is not chosen however fast it is.  The choice is cached, and read back for the same input and candidates, but not for others.
+*/
+BOOST_AUTO_TEST_CASE(AMP_auto_tune_chooses_the_candidate_which_answers)
+{
+	using namespace bertini::tracking;
+	mpfr_float::default_precision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+
+	VariableGroup v{x,y};
+
+	sys.AddVariableGroup(v);
+
+	sys.AddFunction(x*y+1);
+	sys.AddFunction(x+y-1);
+	sys.Homogenize();
+	sys.AutoPatch();
+
+	auto TD = bertini::start_system::TotalDegree(sys);
+	TD.Homogenize();
+
+	auto final_system = (1-t)*sys + t*TD;
+	final_system.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(final_system);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-5"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	TuningPolicy<AMPTracker> policy;
+	TuningCandidate<AMPTracker> hasty;
+	hasty.name = "hasty";
+	hasty.adjust = [&](AMPTracker & tracker)
+		{
+			auto stepping = tracker.SteppingSettings();
+			stepping.max_num_steps = 2;
+			tracker.SteppingSettings(stepping);
+		};
+	policy.candidates.push_back(hasty);
+	policy.candidates.push_back(TuningCandidate<AMPTracker>::AsSetUp());
+
+	auto tuning = AutoTune<AMPTracker>(final_system, TD, setup, mpfr(1), mpfr(0), policy, 2);
+
+	BOOST_CHECK_EQUAL(tuning.chosen, 1);
+	BOOST_CHECK(!tuning.from_cache);
+	BOOST_REQUIRE_EQUAL(tuning.measurements.size(), 2);
+	BOOST_CHECK_EQUAL(tuning.measurements[0].failed, 2);
+	BOOST_CHECK_EQUAL(tuning.measurements[1].answered, 2);
+	BOOST_CHECK(tuning.measurements[1].steps > 0);
+
+	auto cache_file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.tuning");
+	const std::string input = "function f1, f2; variable_group x, y; f1 = x*y+1; f2 = x+y-1;";
+
+	auto first = AutoTuneCached<AMPTracker>(input, cache_file, final_system, TD, setup, mpfr(1), mpfr(0), policy, 2);
+	auto second = AutoTuneCached<AMPTracker>(input, cache_file, final_system, TD, setup, mpfr(1), mpfr(0), policy, 2);
+	BOOST_CHECK(!first.from_cache);
+	BOOST_CHECK(second.from_cache);
+	BOOST_CHECK_EQUAL(second.chosen, first.chosen);
+
+	BOOST_CHECK(LoadTuning(input + " ", {"hasty", "as_set_up"}, cache_file).empty());
+	BOOST_CHECK(LoadTuning(input, {"as_set_up"}, cache_file).empty());
+	BOOST_CHECK_EQUAL(LoadTuning(input, {"hasty", "as_set_up"}, cache_file), "as_set_up");
+
+	boost::filesystem::remove(cache_file);
+
+	std::vector<TuningMeasurement> measurements(3);
+	measurements[0].answered = 9; measurements[0].failed = 1; measurements[0].seconds = 1;
+	measurements[1].answered = 10; measurements[1].seconds = 4;
+	measurements[2].answered = 10; measurements[2].seconds = 3;
+	BOOST_CHECK_EQUAL(ChooseCandidate(measurements, 0), 2);
+	BOOST_CHECK_EQUAL(ChooseCandidate(measurements, 0.1), 0);
+}
+
+
 
 std::vector<Vec<mpfr> > track_total_degree(bertini::tracking::AMPTracker const& tracker, bertini::start_system::TotalDegree const& TD)
 {
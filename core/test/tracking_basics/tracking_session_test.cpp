@@ -0,0 +1,153 @@
+//This file is part of Bertini 2.
+//
+//tracking_session_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//tracking_session_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with tracking_session_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file tracking_session_test.cpp Unit testing for tracking paths submitted one at a time, with results by futures.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/tracking_session.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(tracking_session)
+
+
+/**
+\test \b session_tracks_submitted_paths x^2 - 1 - 3t, from x=2 and x=-2 at t=1 to x=1 and x=-1 at t=0, submitted one at a time to two workers, every one announced once on the completion queue.
+*/
+BOOST_AUTO_TEST_CASE(session_tracks_submitted_paths)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 1 - 3*t);
+	sys.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	TrackingSession<AMPTracker> session(sys, [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		}, mpfr(1), mpfr(0), 2);
+
+	const unsigned num_paths = 6;
+	std::vector< std::future< PathResult<mpfr> > > results;
+	for (unsigned ii = 0; ii < num_paths; ++ii)
+	{
+		Vec<mpfr> start(1);
+		start << mpfr(ii%2 ? -2 : 2);
+		results.push_back(session.Submit(start));
+	}
+
+	std::vector<unsigned> announced(num_paths, 0);
+	std::size_t index;
+	while (session.NextCompleted(index))
+		++announced[index];
+
+	BOOST_CHECK_EQUAL(session.NumPending(), 0);
+	for (unsigned ii = 0; ii < num_paths; ++ii)
+	{
+		BOOST_CHECK_EQUAL(announced[ii], 1);
+		auto r = results[ii].get();
+		BOOST_CHECK_EQUAL(r.index, ii);
+		BOOST_CHECK(r.success_code==SuccessCode::Success);
+		BOOST_CHECK(abs(r.endpoint(0) - mpfr(ii%2 ? -1 : 1)) < mpfr_float("1e-5"));
+	}
+
+	session.Close();
+	BOOST_CHECK_THROW(session.Submit(Vec<mpfr>(1)), std::runtime_error);
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b session_stores_exceptions_in_futures A start point of the wrong size makes the tracker throw, which reaches the caller through the future, and the path is still announced.
+*/
+BOOST_AUTO_TEST_CASE(session_stores_exceptions_in_futures)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var t = std::make_shared<Variable>("t");
+
+	System sys;
+	sys.AddVariableGroup(VariableGroup{x});
+	sys.AddFunction(x*x - 1 - 3*t);
+	sys.AddPathVariable(t);
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	TrackingSession<AMPTracker> session(sys, [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		}, mpfr(1), mpfr(0), 1);
+
+	auto result = session.Submit(Vec<mpfr>(3));
+
+	std::size_t index;
+	BOOST_CHECK(session.NextCompleted(index));
+	BOOST_CHECK_EQUAL(index, 0);
+	BOOST_CHECK_THROW(result.get(), std::runtime_error);
+	BOOST_CHECK(!session.NextCompleted(index));
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
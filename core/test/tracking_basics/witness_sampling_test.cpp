@@ -0,0 +1,145 @@
+//This file is part of Bertini 2.
+//
+//witness_sampling_test.cpp is free software: you can redistribute it and/or modify
+//it under the terms of the GNU General Public License as published by
+//the Free Software Foundation, either version 3 of the License, or
+//(at your option) any later version.
+//
+//witness_sampling_test.cpp is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with witness_sampling_test.cpp.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Copyright(C) 2015, 2016 by Bertini2 Development Team
+//
+// See <http://www.gnu.org/licenses/> for a copy of the license,
+// as well as COPYING.  Bertini2 is provided with permitted
+// additional terms in the b2/licenses/ directory.
+
+// individual authors of this file include:
+// daniel brake, university of notre dame
+
+/**
+\file witness_sampling_test.cpp Unit testing for moving the points of a witness set to other slices.
+*/
+
+#include <boost/test/unit_test.hpp>
+
+#include "bertini2/tracking/amp_tracker.hpp"
+#include "bertini2/tracking/witness_sampling.hpp"
+
+
+using System = bertini::System;
+using Variable = bertini::node::Variable;
+
+using Var = std::shared_ptr<Variable>;
+
+using VariableGroup = bertini::VariableGroup;
+using LinearSlice = bertini::LinearSlice;
+
+using mpfr = bertini::complex;
+using mpfr_float = bertini::mpfr_float;
+
+template<typename NumType> using Vec = bertini::Vec<NumType>;
+
+extern unsigned TRACKING_TEST_MPFR_DEFAULT_DIGITS;
+
+using bertini::DefaultPrecision;
+
+
+BOOST_AUTO_TEST_SUITE(witness_sampling)
+
+
+/**
+\test \b sample_and_test_membership_on_hyperbola The curve xy=1, sliced by a random line through (1,1), has the witness points (1,1) and (c/a,a/c), for the line ax+cy+b.  Moving them to random lines gives points of the curve on those lines, and membership is decided for a point on the curve and one off it.
+*/
+BOOST_AUTO_TEST_CASE(sample_and_test_membership_on_hyperbola)
+{
+	using namespace bertini::tracking;
+	DefaultPrecision(30);
+
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	VariableGroup vars{x,y};
+
+	System sys;
+	sys.AddVariableGroup(vars);
+	sys.AddFunction(x*y - 1);
+
+	auto slice = LinearSlice::RandomComplex(vars,1);
+	Vec<mpfr> on_curve(2);
+	on_curve << mpfr(1), mpfr(1);
+	slice.PassThrough(on_curve);
+
+	const auto coefficients = slice.Coefficients<mpfr>();
+	Vec<mpfr> other(2);
+	other << coefficients(0,1)/coefficients(0,0), coefficients(0,0)/coefficients(0,1);
+
+	std::vector<Vec<mpfr> > points{on_curve, other};
+	for (const auto& r : SliceResiduals(slice, points))
+		BOOST_CHECK(r < mpfr_float("1e-25"));
+
+	config::Stepping<mpfr_float> stepping_preferences;
+	config::Newton newton_preferences;
+	auto AMP = config::AMPConfigFrom(sys);
+
+	auto setup = [&](AMPTracker & tracker)
+		{
+			tracker.Setup(config::Predictor::RK4,
+			              mpfr_float("1e-6"), mpfr_float("1e5"),
+			              stepping_preferences, newton_preferences);
+			tracker.PrecisionSetup(AMP);
+		};
+
+	auto samples = SampleWitnessSet<AMPTracker>(sys, slice, points, 3, setup, 2);
+
+	BOOST_CHECK_EQUAL(DefaultPrecision(), 30);
+	BOOST_REQUIRE_EQUAL(samples.slices.size(), 3);
+	BOOST_REQUIRE_EQUAL(samples.paths.size(), 3);
+	for (unsigned ii = 0; ii < 3; ++ii)
+	{
+		BOOST_REQUIRE_EQUAL(samples.paths[ii].size(), 2);
+		std::vector<Vec<mpfr> > endpoints;
+		for (const auto& path : samples.paths[ii])
+		{
+			BOOST_CHECK(path.success_code==SuccessCode::Success);
+			BOOST_CHECK(abs(path.endpoint(0)*path.endpoint(1) - mpfr(1)) < mpfr_float("1e-10"));
+			endpoints.push_back(path.endpoint);
+		}
+		for (const auto& r : SliceResiduals(samples.slices[ii], endpoints))
+			BOOST_CHECK(r < mpfr_float("1e-10"));
+	}
+
+	Vec<mpfr> member(2), nonmember(2);
+	member << mpfr(2), mpfr("0.5");
+	nonmember << mpfr(2), mpfr(1);
+	BOOST_CHECK(IsMember<AMPTracker>(sys, slice, points, member, setup, mpfr_float("1e-8"), 2));
+	BOOST_CHECK(!IsMember<AMPTracker>(sys, slice, points, nonmember, setup, mpfr_float("1e-8"), 2));
+
+	DefaultPrecision(TRACKING_TEST_MPFR_DEFAULT_DIGITS);
+}
+
+
+/**
+\test \b slice_homotopy_must_be_square Two functions in two variables leave no room for a slice of dimension one.
+*/
+BOOST_AUTO_TEST_CASE(slice_homotopy_must_be_square)
+{
+	Var x = std::make_shared<Variable>("x");
+	Var y = std::make_shared<Variable>("y");
+	VariableGroup vars{x,y};
+
+	System sys;
+	sys.AddVariableGroup(vars);
+	sys.AddFunction(x*y - 1);
+	sys.AddFunction(x - y);
+
+	auto from = LinearSlice::RandomComplex(vars,1);
+	auto to = LinearSlice::RandomComplex(vars,1);
+	BOOST_CHECK_THROW(bertini::tracking::detail::SliceHomotopy(sys, from, to), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -61,6 +61,12 @@ namespace bertini{
 			using RT = typename TrackerTraits<typename EndgameT::TrackerType>::BaseRealType;
 
 			unsigned (EndgameT::*get_cycle_number_)() const = &EndgameT::CycleNumber;
+
+			static SuccessCode RunWithoutGIL(EndgameT & endgame, CT const& start_time, Vec<CT> const& start_point)
+			{
+				ReleaseGIL unlocked;
+				return endgame.template Run<CT>(start_time, start_point);
+			}
 		};// EndgameVisitor class
 
 
@@ -187,6 +193,9 @@ namespace bertini{
 				.def_readwrite("minimum_for_c_over_k_stabilization", &config::Cauchy<NumT>::minimum_for_c_over_k_stabilization)
 				.def_readwrite("maximum_cauchy_ratio", &config::Cauchy<NumT>::maximum_cauchy_ratio)
 				.def_readwrite("fail_safe_maximum_cycle_number", &config::Cauchy<NumT>::fail_safe_maximum_cycle_number, "max number of loops before giving up." )
+				.def_readwrite("adaptive_samples_per_loop", &config::Cauchy<NumT>::adaptive_samples_per_loop, "adapt the number of samples per loop to the error of the trapezoid rule." )
+				.def_readwrite("min_samples_per_loop", &config::Cauchy<NumT>::min_samples_per_loop)
+				.def_readwrite("max_samples_per_loop", &config::Cauchy<NumT>::max_samples_per_loop)
 				;
 			}
 
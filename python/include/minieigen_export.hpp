@@ -43,13 +43,144 @@
 #include "minieigen/src/converters.hpp"
 #include "minieigen/src/visitors.hpp"
 
-
+#include <cstdint>
+#include <cstring>
 
 
 
 namespace bertini{
 	namespace python{
 		
+		/**
+		 The NumPy array interface of a double precision vector or matrix, so numpy.asarray makes a view of its memory rather than a copy.
+
+		 The view keeps the Python object alive, and writes through to it, but is invalidated if the vector or matrix is resized.
+		 */
+		template<typename MatT>
+		dict ArrayInterface(MatT & m)
+		{
+			const std::uint16_t one = 1;
+			const bool little_endian = *reinterpret_cast<const unsigned char*>(&one)==1;
+
+			dict interface;
+			interface["version"] = 3;
+			interface["typestr"] = std::string(little_endian ? "<" : ">") + "c" + std::to_string(sizeof(dbl));
+			interface["data"] = make_tuple(reinterpret_cast<std::uintptr_t>(m.data()), false);
+			if (MatT::ColsAtCompileTime==1)
+				interface["shape"] = make_tuple(m.rows());
+			else
+			{
+				// Eigen is column major
+				interface["shape"] = make_tuple(m.rows(), m.cols());
+				interface["strides"] = make_tuple(sizeof(dbl), m.rows()*sizeof(dbl));
+			}
+			return interface;
+		}
+
+
+		/**
+		 Pack a multiple precision vector into bytes, for bulk transfer to and from Python without a Python object per number.
+
+		 The format is native endian, so for the one machine:  the magic "B2MP", a 32 bit version, and the 64 bit number of entries.  Then, for each real and imaginary part in order, its 64 bit precision in bits, 32 bit MPFR kind, which carries the sign, 32 bits of padding, 64 bit exponent, and its limbs, as MPFR stores them.
+		 */
+		inline
+		object PackVector(Vec<mpfr> const& v)
+		{
+			const auto put = [](std::string & packed, const void* data, std::size_t size)
+				{
+					packed.append(static_cast<const char*>(data), size);
+				};
+			const auto put_part = [&](std::string & packed, mpfr_float const& x)
+				{
+					const auto raw = x.backend().data();
+					const std::uint64_t prec = mpfr_get_prec(raw);
+					const std::int32_t kind = mpfr_custom_get_kind(raw);
+					const std::int32_t padding = 0;
+					const std::int64_t exponent = mpfr_regular_p(raw) ? mpfr_custom_get_exp(raw) : 0;
+					put(packed, &prec, sizeof(prec));
+					put(packed, &kind, sizeof(kind));
+					put(packed, &padding, sizeof(padding));
+					put(packed, &exponent, sizeof(exponent));
+					put(packed, mpfr_custom_get_significand(raw), mpfr_custom_get_size(prec));
+				};
+
+			std::string packed("B2MP");
+			const std::uint32_t version = 1;
+			const std::uint64_t num_entries = v.size();
+			put(packed, &version, sizeof(version));
+			put(packed, &num_entries, sizeof(num_entries));
+			for (int ii = 0; ii < v.size(); ++ii)
+			{
+				put_part(packed, v(ii).real());
+				put_part(packed, v(ii).imag());
+			}
+
+			return object(handle<>(PyBytes_FromStringAndSize(packed.data(), packed.size())));
+		}
+
+
+		/**
+		 Unpack a multiple precision vector from the bytes made by PackVector.  Each number gets the precision it was packed at.
+		 */
+		inline
+		Vec<mpfr> UnpackVector(object const& bytes)
+		{
+			char* data;
+			Py_ssize_t size;
+			if (PyBytes_AsStringAndSize(bytes.ptr(), &data, &size)==-1)
+				throw_error_already_set();
+
+			std::size_t offset = 0;
+			const auto get = [&](void* into, std::size_t count)
+				{
+					if (offset + count > static_cast<std::size_t>(size))
+						throw std::runtime_error("unpacking a vector from " + std::to_string(size) + " bytes, but they end early");
+					std::memcpy(into, data + offset, count);
+					offset += count;
+				};
+			const auto get_part = [&]()
+				{
+					std::uint64_t prec;
+					std::int32_t kind, padding;
+					std::int64_t exponent;
+					get(&prec, sizeof(prec));
+					get(&kind, sizeof(kind));
+					get(&padding, sizeof(padding));
+					get(&exponent, sizeof(exponent));
+					if (prec < MPFR_PREC_MIN || prec > MPFR_PREC_MAX)
+						throw std::runtime_error("unpacking a vector, but a number has precision " + std::to_string(prec) + " bits");
+
+					std::vector<mp_limb_t> limbs((mpfr_custom_get_size(prec) + sizeof(mp_limb_t) - 1)/sizeof(mp_limb_t));
+					get(limbs.data(), mpfr_custom_get_size(prec));
+
+					mpfr_t view;
+					mpfr_custom_init_set(view, kind, exponent, prec, limbs.data());
+
+					mpfr_float x;
+					mpfr_set_prec(x.backend().data(), prec);
+					mpfr_set(x.backend().data(), view, MPFR_RNDN);
+					return x;
+				};
+
+			char magic[4];
+			std::uint32_t version;
+			std::uint64_t num_entries;
+			get(magic, sizeof(magic));
+			get(&version, sizeof(version));
+			get(&num_entries, sizeof(num_entries));
+			if (std::memcmp(magic, "B2MP", 4)!=0 || version!=1)
+				throw std::runtime_error("unpacking a vector, but the bytes were not made by pack, or by a different version");
+
+			Vec<mpfr> v(num_entries);
+			for (std::uint64_t ii = 0; ii < num_entries; ++ii)
+			{
+				const auto real = get_part();
+				const auto imag = get_part();
+				v(ii) = mpfr(real, imag);
+			}
+			return v;
+		}
+
 		
 		void ExportMinieigen()
 		{
@@ -62,13 +193,17 @@ namespace bertini{
 			
 			// Eigen Vector of type dbl or mpfr
 			class_<Eigen::Matrix<dbl,Eigen::Dynamic,1>>("VectorXd","/*TODO*/",
-														 py::init<>()).def(VectorVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,1>>());
+														 py::init<>()).def(VectorVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,1>>())
+				.add_property("__array_interface__", &ArrayInterface<Eigen::Matrix<dbl,Eigen::Dynamic,1>>);
 			class_<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>("VectorXmp","/*TODO*/",
-														py::init<>()).def(VectorVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>());
+														py::init<>()).def(VectorVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,1>>())
+				.def("pack", &PackVector, "Pack into bytes, a header and the limbs of each number, for bulk transfer.  The format is native endian.")
+				.def("unpack", &UnpackVector, "Unpack from the bytes made by pack.").staticmethod("unpack");
 			
 			// Eigen Matrix of type dbl or mpfr
 			class_<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>("MatrixXd","/*TODO*/",
-														py::init<>()).def(MatrixVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>());
+														py::init<>()).def(MatrixVisitor<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>())
+				.add_property("__array_interface__", &ArrayInterface<Eigen::Matrix<dbl,Eigen::Dynamic,Eigen::Dynamic>>);
 			class_<Eigen::Matrix<mpfr,Eigen::Dynamic,Eigen::Dynamic>>("MatrixXmp","/*TODO*/",
 														 py::init<>()).def(MatrixVisitor<Eigen::Matrix<mpfr,Eigen::Dynamic,Eigen::Dynamic>>());
 
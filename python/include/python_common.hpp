@@ -62,4 +62,33 @@ using namespace boost::python;
 typedef bertini::mpfr_float bmp;
 
 
+namespace bertini{
+	namespace python{
+
+		/**
+		 Releases the Python interpreter lock for its lifetime, so other Python threads run while native code does.
+
+		 Nothing may touch a Python object while one is alive.  Convert arguments to C++ before making it, and results to Python after it is gone.
+		 */
+		class ReleaseGIL
+		{
+		public:
+			ReleaseGIL() : state_(PyEval_SaveThread())
+			{}
+
+			~ReleaseGIL()
+			{
+				PyEval_RestoreThread(state_);
+			}
+
+			ReleaseGIL(ReleaseGIL const&) = delete;
+			ReleaseGIL& operator=(ReleaseGIL const&) = delete;
+
+		private:
+			PyThreadState* state_;
+		};
+
+}} // namespaces
+
+
 #endif
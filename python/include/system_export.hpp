@@ -34,7 +34,14 @@
 #ifndef BERTINI_PYTHON_SYSTEM_EXPORT_HPP
 #define BERTINI_PYTHON_SYSTEM_EXPORT_HPP
 #include <bertini2/system.hpp>
+#include <bertini2/system_pool.hpp>
 #include <bertini2/start_system.hpp>
+#include <bertini2/system_cache.hpp>
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 
 
@@ -38,6 +38,9 @@
 #include "python_common.hpp"
 
 #include <bertini2/tracking/tracker.hpp>
+#include <bertini2/tracking/refine_all.hpp>
+#include <bertini2/tracking/parallel_tracking.hpp>
+#include <bertini2/tracking/tracking_session.hpp>
 
 namespace bertini{
 	namespace python{
@@ -45,6 +48,51 @@ namespace bertini{
 
 		using namespace bertini::tracking;
 
+
+		/**
+		 Track a path with the interpreter lock released, so other Python threads run meanwhile.  Each thread must track with its own tracker, on its own system.
+		 */
+		template<typename TrackerT>
+		SuccessCode TrackPathWithoutGIL(TrackerT const& tracker, Vec<typename TrackerTraits<TrackerT>::BaseComplexType> & solution_at_endtime,
+		                                typename TrackerTraits<TrackerT>::BaseComplexType const& start_time,
+		                                typename TrackerTraits<TrackerT>::BaseComplexType const& end_time,
+		                                Vec<typename TrackerTraits<TrackerT>::BaseComplexType> const& start_point)
+		{
+			ReleaseGIL unlocked;
+			return tracker.TrackPath(solution_at_endtime, start_time, end_time, start_point);
+		}
+
+		/**
+		 Start counting the statistics of a new path, from zero.
+		 */
+		template<typename TrackerT>
+		void ResetStatistics(TrackerT const& tracker)
+		{
+			tracker.ResetStatistics();
+		}
+
+		/**
+		 Refine a point with the interpreter lock released, to the tracker's own tolerance.
+		 */
+		template<typename TrackerT, typename T>
+		SuccessCode RefineWithoutGIL(TrackerT const& tracker, Vec<T> & new_space, Vec<T> const& start_point, T const& current_time)
+		{
+			ReleaseGIL unlocked;
+			return tracker.template Refine<T>(new_space, start_point, current_time);
+		}
+
+		/**
+		 Refine a point with the interpreter lock released, to a given tolerance and number of iterations.
+		 */
+		template<typename TrackerT, typename ComplexT, typename RealT>
+		SuccessCode RefineToToleranceWithoutGIL(TrackerT const& tracker, Vec<ComplexT> & new_space, Vec<ComplexT> const& start_point, ComplexT const& current_time,
+		                                        RealT const& tolerance, unsigned max_iterations)
+		{
+			ReleaseGIL unlocked;
+			return tracker.template Refine<ComplexT, RealT>(new_space, start_point, current_time, tolerance, max_iterations);
+		}
+
+
 		/**
 		 Abstract Tracker class
 		 */
@@ -86,27 +134,6 @@ namespace bertini{
 		public:
 			template<class PyClass>
 			void visit(PyClass& cl) const;
-			
-			
-		private:
-			// resolve overloads for refining a point.
-			template <typename T>
-			using Refine3_ptr = SuccessCode (TrackerT::*)(Vec<T>&, Vec<T> const&, T const&) const;
-			template <typename T>
-			static Refine3_ptr<T> return_Refine3_ptr()
-			{
-				return &TrackerT::template Refine<T>;
-			};
-			
-			template <typename ComplexT, typename RealT>
-			using Refine4_ptr = SuccessCode (TrackerT::*)(Vec<ComplexT>&, Vec<ComplexT> const&, ComplexT const&, RealT const&, unsigned) const;
-			template <typename ComplexT, typename RealT>
-			static Refine4_ptr<ComplexT, RealT> return_Refine4_ptr()
-			{
-				return &TrackerT::template Refine<ComplexT, RealT>;
-			};
-
-			
 		};// AMPTrackerVisitor class
 
 		
@@ -121,27 +148,6 @@ namespace bertini{
 		public:
 			template<class PyClass>
 			void visit(PyClass& cl) const;
-			
-			
-		private:
-			// resolve overloads for refining a point.
-			template <typename T>
-			using Refine3_ptr = SuccessCode (TrackerT::*)(Vec<T>&, Vec<T> const&, T const&) const;
-			template <typename T>
-			static Refine3_ptr<T> return_Refine3_ptr()
-			{
-				return &TrackerT::template Refine<T>;
-			};
-			
-			template <typename ComplexT, typename RealT>
-			using Refine4_ptr = SuccessCode (TrackerT::*)(Vec<ComplexT>&, Vec<ComplexT> const&, ComplexT const&, RealT const&, unsigned) const;
-			template <typename ComplexT, typename RealT>
-			static Refine4_ptr<ComplexT, RealT> return_Refine4_ptr()
-			{
-				return &TrackerT::template Refine<ComplexT, RealT>;
-			};
-
-			
 		};// FixedDoubleTrackerVisitor class
 
 		
@@ -156,27 +162,6 @@ namespace bertini{
 		public:
 			template<class PyClass>
 			void visit(PyClass& cl) const;
-			
-			
-		private:
-			// resolve overloads for refining a point.
-			template <typename T>
-			using Refine3_ptr = SuccessCode (TrackerT::*)(Vec<T>&, Vec<T> const&, T const&) const;
-			template <typename T>
-			static Refine3_ptr<T> return_Refine3_ptr()
-			{
-				return &TrackerT::template Refine<T>;
-			};
-			
-			template <typename ComplexT, typename RealT>
-			using Refine4_ptr = SuccessCode (TrackerT::*)(Vec<ComplexT>&, Vec<ComplexT> const&, ComplexT const&, RealT const&, unsigned) const;
-			template <typename ComplexT, typename RealT>
-			static Refine4_ptr<ComplexT, RealT> return_Refine4_ptr()
-			{
-				return &TrackerT::template Refine<ComplexT, RealT>;
-			};
-			
-			
 		};// FixedMultipleTrackerVisitor class
 
 		
@@ -231,6 +216,14 @@ namespace bertini{
 		
 		void ExportConfigSettings();
 
+		void ExportInstrumentation();
+
+		void ExportRefineAll();
+
+		void ExportTrackAllPaths();
+
+		void ExportTrackingSession();
+
 }}// re: namespaces
 
 
@@ -54,9 +54,12 @@ namespace bertini{
 
 			.def("get_tracker", &EndgameT::GetTracker, return_internal_reference<>(),"Get the tracker used in this endgame.  This is the same tracker as you feed the endgame object when you make it.")
 			.def("get_system",  &EndgameT::GetSystem,  return_internal_reference<>(),"Get the tracked system")
+			.def("profile", &EndgameT::Profile, return_internal_reference<>(),"Get the time spent in, and number of calls to, each phase of the endgame, by precision")
+			.def("reset_profile", &EndgameT::ResetProfile)
+			.def("memory_report", &EndgameT::MemoryReport, "Get the memory held by the endgame, by component: its samples, and its approximations at the origin.")
 
 			.def("final_approximation", &EndgameT::template FinalApproximation<BCT>, return_internal_reference<>(),"Get the current approximation of the root")
-			.def("run", &EndgameT::template Run<BCT>,"Run the endgame, from start point and start time, to t=0")
+			.def("run", &RunWithoutGIL,"Run the endgame, from start point and start time, to t=0.  Releases the interpreter lock while running.")
 			;
 		}
 
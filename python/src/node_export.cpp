@@ -53,17 +53,17 @@ namespace bertini{
 			
 			void precision(unsigned int prec) { this->get_override("precision")(prec); }
 			
-			int Degree(std::shared_ptr<Variable> const& v = nullptr) const {return this->get_override("Degree")(v); }
-			int Degree(VariableGroup const& vars) const {return this->get_override("Degree")(vars); }
+			int FreshDegree(std::shared_ptr<Variable> const& v) const {return this->get_override("Degree")(v); }
+			int FreshDegree(VariableGroup const& vars) const {return this->get_override("Degree")(vars); }
 			
-			std::shared_ptr<Node> Differentiate() {return this->get_override("Differentiate")(); }
+			std::shared_ptr<Node> FreshDifferentiate() const {return this->get_override("Differentiate")(); }
 			
-			std::vector<int> MultiDegree(VariableGroup const& vars) const {return this->get_override("MultiDegree")(vars); }
+			std::vector<int> FreshMultiDegree(VariableGroup const& vars) const {return this->get_override("MultiDegree")(vars); }
 			
 			void Homogenize(VariableGroup const& vars, std::shared_ptr<Variable> const& homvar) { this->get_override("Homogenize")(vars, homvar); }
 			
-			bool IsHomogeneous(std::shared_ptr<Variable> const& v = nullptr) const {return this->get_override("IsHomogeneous")(v); }
-			bool IsHomogeneous(VariableGroup const& vars) const {return this->get_override("IsHomogeneous")(vars); }
+			bool FreshIsHomogeneous(std::shared_ptr<Variable> const& v) const {return this->get_override("IsHomogeneous")(v); }
+			bool FreshIsHomogeneous(VariableGroup const& vars) const {return this->get_override("IsHomogeneous")(vars); }
 			
 			bool IsPolynomial(std::shared_ptr<Variable> const&v = nullptr) const {return this->get_override("IsPolynomial")(v); }
 			bool IsPolynomial(VariableGroup const&v) const {return this->get_override("IsPolynomial")(v); }
@@ -44,6 +44,160 @@ namespace bertini{
 			mpz_int NumStartPoints() const {return this->get_override("NumStartPoints")(); }
 		}; // re: StartSystemWrap
 
+
+		namespace {
+
+			/**
+			 Split the points among workers, each evaluating a contiguous chunk on its own copy of the system, in double precision, with the interpreter lock released.  work(system, begin, end) does one chunk.
+			 */
+			template<typename WorkFunction>
+			void ForChunksWithoutGIL(System const& sys, long num_points, unsigned num_threads, WorkFunction work)
+			{
+				if (num_threads==0)
+					num_threads = detail::DefaultNumWorkers();
+				num_threads = static_cast<unsigned>(std::max(1l, std::min<long>(num_threads, num_points)));
+
+				// big enough to amortize the per-chunk set-up, small enough to balance
+				const long chunk_size = std::max(1l, std::min(256l, num_points/(4*static_cast<long>(num_threads))));
+
+				ReleaseGIL unlocked;
+
+				SystemPool copies(sys);
+				std::vector< std::shared_ptr<System> > worker_systems(num_threads);
+				for (unsigned ii = 0; ii < num_threads; ++ii)
+					worker_systems[ii] = copies.Acquire(ii, DoublePrecision());
+
+				std::atomic<long> next(0);
+				std::exception_ptr error;
+				std::mutex error_mutex;
+				auto worker = [&](unsigned index)
+					{
+						try
+						{
+							long begin;
+							while ((begin = next.fetch_add(chunk_size)) < num_points)
+								work(*worker_systems[index], begin, std::min(begin + chunk_size, num_points));
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(error_mutex);
+							if (!error)
+								error = std::current_exception();
+							next = num_points;
+						}
+					};
+
+				std::vector<std::thread> threads;
+				for (unsigned ii = 1; ii < num_threads; ++ii)
+					threads.emplace_back(worker, ii);
+				worker(0);
+				for (auto& t : threads)
+					t.join();
+
+				if (error)
+					std::rethrow_exception(error);
+			}
+
+
+			Mat<dbl> EvalMany(System const& sys, Mat<dbl> const& points, Vec<dbl> const* times, unsigned num_threads)
+			{
+				if (points.cols()!=static_cast<long>(sys.NumVariables()))
+					throw std::runtime_error("evaluating system at many points, but the points have " + std::to_string(points.cols()) + " coordinates, not " + std::to_string(sys.NumVariables()));
+				if (times && times->size()!=points.rows())
+					throw std::runtime_error("evaluating system at many points, but there are " + std::to_string(times->size()) + " times for " + std::to_string(points.rows()) + " points");
+
+				Mat<dbl> values(points.rows(), sys.NumTotalFunctions());
+				ForChunksWithoutGIL(sys, points.rows(), num_threads, [&](System const& s, long begin, long end)
+					{
+						const Mat<dbl> columns = points.middleRows(begin, end - begin).transpose();
+						values.middleRows(begin, end - begin) = (times ? s.EvalBatch(columns, times->segment(begin, end - begin)) : s.EvalBatch(columns)).transpose();
+					});
+				return values;
+			}
+
+			Mat<dbl> JacobianMany(System const& sys, Mat<dbl> const& points, Vec<dbl> const* times, unsigned num_threads)
+			{
+				if (points.cols()!=static_cast<long>(sys.NumVariables()))
+					throw std::runtime_error("evaluating Jacobian at many points, but the points have " + std::to_string(points.cols()) + " coordinates, not " + std::to_string(sys.NumVariables()));
+				if (times && times->size()!=points.rows())
+					throw std::runtime_error("evaluating Jacobian at many points, but there are " + std::to_string(times->size()) + " times for " + std::to_string(points.rows()) + " points");
+
+				const long num_functions = sys.NumTotalFunctions();
+				Mat<dbl> jacobians(points.rows()*num_functions, sys.NumVariables());
+				ForChunksWithoutGIL(sys, points.rows(), num_threads, [&](System const& s, long begin, long end)
+					{
+						Vec<dbl> x;
+						for (long ii = begin; ii < end; ++ii)
+						{
+							x = points.row(ii).transpose();
+							jacobians.middleRows(ii*num_functions, num_functions) = times ? s.Jacobian(x, (*times)(ii)) : s.Jacobian(x);
+						}
+					});
+				return jacobians;
+			}
+
+
+			Mat<dbl> EvalManyPy(System const& sys, Mat<dbl> const& points, unsigned num_threads)
+			{
+				return EvalMany(sys, points, nullptr, num_threads);
+			}
+
+			Mat<dbl> EvalManyAtTimesPy(System const& sys, Mat<dbl> const& points, Vec<dbl> const& times, unsigned num_threads)
+			{
+				return EvalMany(sys, points, &times, num_threads);
+			}
+
+			Mat<dbl> JacobianManyPy(System const& sys, Mat<dbl> const& points, unsigned num_threads)
+			{
+				return JacobianMany(sys, points, nullptr, num_threads);
+			}
+
+			Mat<dbl> JacobianManyAtTimesPy(System const& sys, Mat<dbl> const& points, Vec<dbl> const& times, unsigned num_threads)
+			{
+				return JacobianMany(sys, points, &times, num_threads);
+			}
+
+
+			/**
+			 The components of a memory report, as a list of tuples of name, bytes and count.
+			 */
+			list MemoryComponents(MemoryUsage const& usage)
+			{
+				list components;
+				for (auto const& c : usage.Components())
+					components.append(boost::python::make_tuple(c.name, c.bytes, c.count));
+				return components;
+			}
+
+
+			/**
+			 Pickle a system as the bytes of the system cache format, a binary archive of the prepared system, Jacobian and patches included, so that sending it to a worker process is a copy of memory rather than a parse.  The bytes are for processes of the same build.
+			 */
+			struct SystemPickleSuite : pickle_suite
+			{
+				static object getstate(System const& sys)
+				{
+					std::string bytes;
+					{
+						ReleaseGIL unlocked;
+						bytes = SystemToBytes(sys);
+					}
+					return object(handle<>(PyBytes_FromStringAndSize(bytes.data(), bytes.size())));
+				}
+
+				static void setstate(System & sys, object state)
+				{
+					char* data;
+					Py_ssize_t size;
+					if (PyBytes_AsStringAndSize(state.ptr(), &data, &size)==-1)
+						throw_error_already_set();
+
+					ReleaseGIL unlocked;
+					SystemFromBytes(sys, data, static_cast<std::size_t>(size));
+				}
+			};
+		}
+
 		
 		
 		
@@ -56,6 +210,12 @@ namespace bertini{
 			.def("precision", get_prec_)
 			.def("precision", set_prec_)
 			.def("differentiate", &SystemBaseT::Differentiate)
+			.def("memory_report", &SystemBaseT::MemoryReport, "Get the memory held by the system, by component: the function and Jacobian trees by the type of their nodes, the values the nodes keep, the patch, and the compiled forms of the system.")
+
+			.def("use_evaluation_cache", &SystemBaseT::UseEvaluationCache, (arg("use_it")=true), "Switch on or off the cache of the last evaluations, kept with the point, time and precision at which they were made.")
+			.def("using_evaluation_cache", &SystemBaseT::UsingEvaluationCache, "Query whether the last evaluations are kept.")
+			.def("forget_evaluations", &SystemBaseT::ForgetEvaluations, "Forget the last evaluations, so the next are computed afresh.")
+			.def("forget_stored_values", &SystemBaseT::ForgetStoredValues, "Reset every node of the function trees at the next evaluation, and forget the last evaluations.  Needed after changing a leaf of the trees in place; variables given a value with set_current_value are noticed by the system.")
 
 			.def("eval", return_Eval0_ptr<dbl>() ,"evaluate the system in double precision, using already-set variable values.")
 			.def("eval", return_Eval0_ptr<mpfr>() ,"evaluate the system in multiple precision, using already-set variable values.")
@@ -71,6 +231,11 @@ namespace bertini{
 			.def("jacobian", return_Jac2_ptr<dbl>() , "evaluate the jacobian of the system, using time and space values passed into this function")
 			.def("jacobian", return_Jac2_ptr<mpfr>() , "evaluate the jacobian of the system, using time and space values passed into this function")
 
+			.def("eval_many", &EvalManyPy, (arg("points"), arg("num_threads")=0u), "evaluate the system in double precision at many points, one per row, on a pool of threads with the interpreter lock released.  returns the function values, one row per point.")
+			.def("eval_many", &EvalManyAtTimesPy, (arg("points"), arg("times"), arg("num_threads")=0u), "evaluate the system in double precision at many points, one per row, and a time for each.  returns the function values, one row per point.")
+			.def("jacobian_many", &JacobianManyPy, (arg("points"), arg("num_threads")=0u), "evaluate the jacobian of the system in double precision at many points, one per row, on a pool of threads with the interpreter lock released.  returns the jacobians stacked, num_functions rows per point.")
+			.def("jacobian_many", &JacobianManyAtTimesPy, (arg("points"), arg("times"), arg("num_threads")=0u), "evaluate the jacobian of the system in double precision at many points, one per row, and a time for each.  returns the jacobians stacked, num_functions rows per point.")
+
 			.def("homogenize", &SystemBaseT::Homogenize)
 			.def("is_homogeneous", &SystemBaseT::IsHomogeneous)
 			.def("is_polynomial", &SystemBaseT::IsPolynomial)
@@ -164,10 +329,18 @@ namespace bertini{
 		
 		void ExportSystem()
 		{
-			
+			class_<MemoryUsage>("MemoryUsage", init<>())
+				.def("total_bytes", &MemoryUsage::TotalBytes, "The bytes of all the components.")
+				.def("bytes", &MemoryUsage::Bytes, "The bytes of a component, and of those beneath it, as in 'function_trees'.")
+				.def("count", &MemoryUsage::Count, "The number of nodes, numbers, or other things holding the bytes of a component, and of those beneath it.")
+				.def("components", &MemoryComponents, "The components, as tuples of name, bytes and count.")
+				.def(self_ns::str(self_ns::self))
+				;
+
 			// System class
 			class_<System, std::shared_ptr<System> >("System", init<>())
 			.def(SystemVisitor<System>())
+			.def_pickle(SystemPickleSuite())
 			;
 			
 			// StartSystem class
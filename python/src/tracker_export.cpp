@@ -39,13 +39,21 @@ namespace bertini{
 		{
 			cl
 			.def("setup", &TrackerT::Setup)
-			.def("track_path", &TrackerT::TrackPath)
+			.def("track_path", &TrackPathWithoutGIL<TrackerT>, "Track a path from start time to end time.  Releases the interpreter lock while tracking, so Python threads, each with its own tracker and system, track in parallel.")
+			.def("begin_path", &TrackerT::BeginPath, "Set up to track a path a few steps at a time, with advance_path.")
+			.def("advance_path", &TrackerT::AdvancePath, "Take up to a number of steps along the path begun, stopping early at the end time, on failure, or when the precision changes.  The solution is written once the end time is reached.")
+			.def("path_in_progress", &TrackerT::PathInProgress, "Whether the path begun has yet to reach its end time or fail.")
 			.def("get_system",&TrackerT::GetSystem,return_internal_reference<>())
 			.def("predictor",get_predictor_,"Query the current predictor method used by the tracker.")
 			.def("predictor",set_predictor_,"Set the predictor method used by the tracker.")
 			.def("set_stepsize", &TrackerT::SetStepSize)
 			.def("reinitialize_initial_step_size", &TrackerT::ReinitializeInitialStepSize)
 			.def("num_total_steps_taken", &TrackerT::NumTotalStepsTaken)
+			.def("profile", &TrackerT::Profile, return_internal_reference<>(), "Get the time spent in, and number of calls to, each phase of tracking, by precision.")
+			.def("reset_profile", &TrackerT::ResetProfile)
+			.def("statistics", &TrackerT::Statistics, "Get the steps, Newton iterations, evaluations, precisions and time of the tracking done since the last reset_statistics.")
+			.def("reset_statistics", &ResetStatistics<TrackerT>, "Start counting the statistics of a new path.")
+			.def("memory_report", &TrackerT::MemoryReport, "Get the memory held by the tracker, by component: its points, the workspaces of its predictor and corrector, and the system it tracks, beneath 'system'.")
 			.def("tracking_tolerance", &TrackerT::TrackingTolerance)
 			;
 		}
@@ -61,10 +69,10 @@ namespace bertini{
 			.def("current_point", &TrackerT::CurrentPoint)
 			.def("current_time", &TrackerT::CurrentTime)
 			.def("current_precision", &TrackerT::CurrentPrecision)
-			.def("refine", return_Refine3_ptr<dbl>)
-			.def("refine", return_Refine3_ptr<mpfr>)
-			.def("refine", return_Refine4_ptr<dbl, double>)
-			.def("refine", return_Refine4_ptr<mpfr, mpfr_float>)
+			.def("refine", &RefineWithoutGIL<TrackerT, dbl>)
+			.def("refine", &RefineWithoutGIL<TrackerT, mpfr>)
+			.def("refine", &RefineToToleranceWithoutGIL<TrackerT, dbl, double>)
+			.def("refine", &RefineToToleranceWithoutGIL<TrackerT, mpfr, mpfr_float>)
 			;
 		}
 
@@ -79,8 +87,8 @@ namespace bertini{
 			.def("current_time", &TrackerT::CurrentTime)
 			.def("current_precision", &TrackerT::CurrentPrecision)
 			.def("tracker_loop_initialization", &TrackerT::TrackerLoopInitialization)
-			.def("refine", return_Refine3_ptr<dbl>)
-			.def("refine", return_Refine4_ptr<dbl, double>)
+			.def("refine", &RefineWithoutGIL<TrackerT, dbl>)
+			.def("refine", &RefineToToleranceWithoutGIL<TrackerT, dbl, double>)
 			;
 		}
 
@@ -94,8 +102,8 @@ namespace bertini{
 			.def("current_time", &TrackerT::CurrentTime)
 			.def("current_precision", &TrackerT::CurrentPrecision)
 			.def("tracker_loop_initialization", &TrackerT::TrackerLoopInitialization)
-			.def("refine", return_Refine3_ptr<mpfr>)
-			.def("refine", return_Refine4_ptr<mpfr, mpfr_float>)
+			.def("refine", &RefineWithoutGIL<TrackerT, mpfr>)
+			.def("refine", &RefineToToleranceWithoutGIL<TrackerT, mpfr, mpfr_float>)
 			;
 		}
 
@@ -114,6 +122,7 @@ namespace bertini{
 			.def_readwrite("min_num_steps", &Stepping<T>::min_num_steps)
 			.def_readwrite("max_num_steps", &Stepping<T>::max_num_steps)
 			.def_readwrite("frequency_of_CN_estimation", &Stepping<T>::frequency_of_CN_estimation)
+			.def_readwrite("dense_output", &Stepping<T>::dense_output)
 			.def_readwrite("initial_step_size", &Stepping<T>::initial_step_size)
 			.def_readwrite("initial_step_size", &Stepping<T>::initial_step_size)
 			;
@@ -132,8 +141,12 @@ namespace bertini{
 			scope new_submodule_scope = new_submodule;
 			
 			ExportConfigSettings();
+			ExportInstrumentation();
 			ExportAMPTracker();
 			ExportFixedTrackers();
+			ExportRefineAll();
+			ExportTrackAllPaths();
+			ExportTrackingSession();
 		}
 
 		void ExportAMPTracker()
@@ -169,6 +182,309 @@ namespace bertini{
 		
 		
 		
+		namespace {
+			list ProfilePrecisions(instrument::Profile const& profile)
+			{
+				list precisions;
+				for (auto p : profile.Precisions())
+					precisions.append(p);
+				return precisions;
+			}
+		}
+
+		void ExportInstrumentation()
+		{
+			using namespace bertini::tracking::instrument;
+
+			enum_<Phase>("Phase")
+				.value("SystemEvaluation", Phase::SystemEvaluation)
+				.value("JacobianEvaluation", Phase::JacobianEvaluation)
+				.value("LinearSolve", Phase::LinearSolve)
+				.value("Predict", Phase::Predict)
+				.value("Correct", Phase::Correct)
+				.value("PrecisionChange", Phase::PrecisionChange)
+				.value("EndgameSampling", Phase::EndgameSampling)
+				.value("EndgameApproximation", Phase::EndgameApproximation)
+				.value("Endgame", Phase::Endgame)
+				;
+
+			class_<PhaseTotals>("PhaseTotals", init<>())
+				.def_readonly("calls", &PhaseTotals::calls)
+				.def_readonly("allocations", &PhaseTotals::allocations, "The heap allocations made during the phase.  Zero unless the module links libbertini2_allocation_counting.")
+				.def_readonly("bytes", &PhaseTotals::bytes, "The bytes asked for by those allocations.")
+				.def_readonly("pool_hits", &PhaseTotals::pool_hits, "The requests served by the limb pool and the pools of objects during the phase.")
+				.def_readonly("pool_misses", &PhaseTotals::pool_misses, "The requests those pools could not serve.")
+				.add_property("seconds", &PhaseTotals::Seconds)
+				;
+
+			PhaseTotals (Profile::*total_)(Phase) const = &Profile::Total;
+			PhaseTotals (Profile::*total_at_)(Phase, unsigned) const = &Profile::Total;
+
+			class_<Profile>("Profile", init<>())
+				.def("total", total_, "The totals of a phase, over all precisions.")
+				.def("total", total_at_, "The totals of a phase at one precision.")
+				.def("precisions", &ProfilePrecisions, "The precisions at which anything was recorded.")
+				.def("reset", &Profile::Reset)
+				;
+
+			enum_<PathStatistics::EndgameType>("EndgameType")
+				.value("none", PathStatistics::EndgameType::None)
+				.value("power_series", PathStatistics::EndgameType::PowerSeries)
+				.value("cauchy", PathStatistics::EndgameType::Cauchy)
+				;
+
+			class_<PathStatistics>("PathStatistics", init<>())
+				.def_readonly("steps_accepted", &PathStatistics::steps_accepted)
+				.def_readonly("steps_rejected", &PathStatistics::steps_rejected)
+				.def_readonly("newton_iterations", &PathStatistics::newton_iterations)
+				.def_readonly("evaluations", &PathStatistics::evaluations)
+				.def_readonly("max_precision", &PathStatistics::max_precision, "The highest precision, in digits, of any step.")
+				.def_readonly("final_precision", &PathStatistics::final_precision, "The precision, in digits, in which the path ended.")
+				.def_readonly("tracking_seconds", &PathStatistics::tracking_seconds, "The time spent tracking, including the tracking done by the endgame.")
+				.def_readonly("endgame_seconds", &PathStatistics::endgame_seconds)
+				.def_readonly("endgame", &PathStatistics::endgame)
+				.def_readonly("endgame_loops", &PathStatistics::endgame_loops)
+				.def_readonly("cycle_number", &PathStatistics::cycle_number)
+				;
+		}
+
+
+
+		namespace {
+			/**
+			Calibrate the cost model of AMP on a system, at the precisions in a list, or the default ones if it is empty.
+			*/
+			ArithmeticCostModel CalibrateArithmeticCostFromList(System const& sys, list const& precisions, double min_seconds)
+			{
+				std::vector<unsigned> digits;
+				for (long ii = 0; ii < len(precisions); ++ii)
+					digits.push_back(extract<unsigned>(precisions[ii]));
+
+				ReleaseGIL unlocked;
+				return CalibrateArithmeticCost(sys, digits, min_seconds);
+			}
+
+			dict ArithmeticCosts(ArithmeticCostModel const& model)
+			{
+				dict costs;
+				for (const auto& c : model.Costs())
+					costs[c.first] = c.second;
+				return costs;
+			}
+		}
+
+
+
+		namespace {
+			/**
+			Refine a list of points with adaptive precision trackers, one per worker, each set up with the given Newton and AMP settings.
+			*/
+			list RefineAllAMP(System const& sys, list const& points, mpfr const& time,
+			                  config::Newton const& newton, config::AdaptiveMultiplePrecisionConfig const& AMP,
+			                  RefineAllConfig const& refine_config, unsigned num_threads)
+			{
+				std::vector< Vec<mpfr> > to_refine;
+				for (long ii = 0; ii < len(points); ++ii)
+					to_refine.push_back(extract< Vec<mpfr> >(points[ii]));
+
+				std::vector< RefineResult<mpfr> > refined;
+				{
+					ReleaseGIL unlocked;
+					refined = RefineAll<AMPTracker>(sys, to_refine, time, [&](AMPTracker & tracker)
+						{
+							tracker.Setup(config::Predictor::Euler, mpfr_float("1e-5"), mpfr_float("1e5"),
+							              config::Stepping<mpfr_float>(), newton);
+							tracker.PrecisionSetup(AMP);
+						}, refine_config, num_threads);
+				}
+
+				list results;
+				for (auto& r : refined)
+					results.append(r);
+				return results;
+			}
+		}
+
+		void ExportRefineAll()
+		{
+			class_<RefineAllConfig>("RefineAllConfig", init<>())
+				.def_readwrite("tolerance", &RefineAllConfig::tolerance)
+				.def_readwrite("max_iterations", &RefineAllConfig::max_iterations)
+				.def_readwrite("precision", &RefineAllConfig::precision)
+				.def_readwrite("max_precision", &RefineAllConfig::max_precision)
+				;
+
+			class_<RefineResult<mpfr>>("RefineResult_mp", init<>())
+				.def_readonly("index", &RefineResult<mpfr>::index)
+				.def_readonly("success_code", &RefineResult<mpfr>::success_code)
+				.def_readonly("precision", &RefineResult<mpfr>::precision)
+				.def_readonly("point", &RefineResult<mpfr>::point)
+				;
+
+			def("refine_all", &RefineAllAMP, (arg("system"), arg("points"), arg("time"), arg("newton"), arg("amp"), arg("config")=RefineAllConfig(), arg("num_threads")=0u),
+			    "Refine a list of points by Newton's method, at the given time, on a pool of threads, raising the precision of each point until it converges.  Returns a RefineResult_mp for each point, in order.");
+		}
+
+
+
+		namespace {
+			/**
+			Track from a list of start points with adaptive precision trackers, one per worker, each set up with the given settings.  The interpreter lock is released while the workers track.
+			*/
+			tuple TrackPathsAMP(System const& homotopy, list const& start_points, mpfr const& start_time, mpfr const& end_time,
+			                    mpfr_float const& tracking_tolerance, mpfr_float const& path_truncation_threshold,
+			                    config::Stepping<mpfr_float> const& stepping, config::Newton const& newton,
+			                    config::AdaptiveMultiplePrecisionConfig const& AMP, unsigned num_threads)
+			{
+				std::vector< Vec<mpfr> > points;
+				for (long ii = 0; ii < len(start_points); ++ii)
+					points.push_back(extract< Vec<mpfr> >(start_points[ii]));
+
+				std::vector< PathResult<mpfr> > tracked;
+				{
+					ReleaseGIL unlocked;
+					tracked = TrackAllPaths<AMPTracker>(homotopy, tracking::detail::StartPointList<mpfr>(points), [&](AMPTracker & tracker)
+						{
+							tracker.Setup(config::Predictor::RK4, tracking_tolerance, path_truncation_threshold, stepping, newton);
+							tracker.PrecisionSetup(AMP);
+						}, start_time, end_time, num_threads);
+				}
+
+				list endpoints, success_codes;
+				for (auto const& p : tracked)
+				{
+					endpoints.append(p.endpoint);
+					success_codes.append(p.success_code);
+				}
+				return make_tuple(endpoints, success_codes);
+			}
+		}
+
+		void ExportTrackAllPaths()
+		{
+			def("track_paths", &TrackPathsAMP, (arg("homotopy"), arg("start_points"), arg("start_time"), arg("end_time"),
+			                                    arg("tracking_tolerance"), arg("path_truncation_threshold"),
+			                                    arg("stepping"), arg("newton"), arg("amp"), arg("num_threads")=0u),
+			    "Track from each of a list of start points, from start time to end time, on a pool of native threads, with the interpreter lock released.  Returns a pair of lists in the order of the start points: the endpoints, as vectors, and the success codes.");
+		}
+
+
+
+
+		namespace {
+			/**
+			The result of a path submitted to a tracking session, waited on with the interpreter lock released, and awaitable from asyncio.
+			*/
+			class PathFuture
+			{
+			public:
+				explicit PathFuture(std::shared_future< PathResult<mpfr> > f) : future_(std::move(f))
+				{}
+
+				bool Done() const
+				{
+					return future_.wait_for(std::chrono::seconds(0))==std::future_status::ready;
+				}
+
+				PathResult<mpfr> Result() const
+				{
+					{
+						ReleaseGIL unlocked;
+						future_.wait();
+					}
+					return future_.get();
+				}
+
+				// awaiting polls, yielding to the event loop until the path is done
+				static object Next(PathFuture const& self)
+				{
+					if (!self.Done())
+						return object();
+
+					object result(self.Result());
+					object stop(handle<>(borrowed(PyExc_StopIteration)));
+					PyErr_SetObject(PyExc_StopIteration, stop(result).ptr());
+					throw_error_already_set();
+					return object();
+				}
+
+			private:
+				std::shared_future< PathResult<mpfr> > future_;
+			};
+
+			object Self(object const& self)
+			{
+				return self;
+			}
+
+			std::shared_ptr< TrackingSession<AMPTracker> > MakeSessionAMP(System const& homotopy, mpfr const& start_time, mpfr const& end_time,
+			                                                             mpfr_float const& tracking_tolerance, mpfr_float const& path_truncation_threshold,
+			                                                             config::Stepping<mpfr_float> const& stepping, config::Newton const& newton,
+			                                                             config::AdaptiveMultiplePrecisionConfig const& AMP, unsigned num_threads)
+			{
+				// the workers set up their trackers after this returns, so they get copies of the settings
+				return std::make_shared< TrackingSession<AMPTracker> >(homotopy, [=](AMPTracker & tracker)
+					{
+						tracker.Setup(config::Predictor::RK4, tracking_tolerance, path_truncation_threshold, stepping, newton);
+						tracker.PrecisionSetup(AMP);
+					}, start_time, end_time, num_threads);
+			}
+
+			PathFuture Submit(TrackingSession<AMPTracker> & session, Vec<mpfr> const& start_point)
+			{
+				return PathFuture(session.Submit(start_point).share());
+			}
+
+			object NextCompleted(TrackingSession<AMPTracker> & session)
+			{
+				std::size_t index;
+				bool found;
+				{
+					ReleaseGIL unlocked;
+					found = session.NextCompleted(index);
+				}
+				return found ? object(index) : object();
+			}
+
+			void Close(TrackingSession<AMPTracker> & session)
+			{
+				ReleaseGIL unlocked;
+				session.Close();
+			}
+		}
+
+		void ExportTrackingSession()
+		{
+			class_<PathResult<mpfr>>("PathResult_mp", init<>())
+				.def_readonly("index", &PathResult<mpfr>::index)
+				.def_readonly("success_code", &PathResult<mpfr>::success_code)
+				.def_readonly("time", &PathResult<mpfr>::time)
+				.def_readonly("endpoint", &PathResult<mpfr>::endpoint)
+				.def_readonly("statistics", &PathResult<mpfr>::statistics)
+				;
+
+			class_<PathFuture>("PathFuture", no_init)
+				.def("done", &PathFuture::Done, "Whether the path is done.")
+				.def("result", &PathFuture::Result, "Wait for the path to be done, with the interpreter lock released, and get its PathResult_mp.  Raises what tracking raised, if it did.")
+				.def("__await__", &Self)
+				.def("__iter__", &Self)
+				.def("__next__", &PathFuture::Next)
+				.def("next", &PathFuture::Next)
+				;
+
+			class_<TrackingSession<AMPTracker>, std::shared_ptr< TrackingSession<AMPTracker> >, boost::noncopyable>("TrackingSession", no_init)
+				.def("__init__", make_constructor(&MakeSessionAMP, default_call_policies(),
+					(arg("homotopy"), arg("start_time"), arg("end_time"), arg("tracking_tolerance"), arg("path_truncation_threshold"),
+					 arg("stepping"), arg("newton"), arg("amp"), arg("num_threads")=0u)))
+				.def("submit", &Submit, "Queue a path from a start point, and get a PathFuture for its result.")
+				.def("next_completed", &NextCompleted, "Wait for the next path to complete, with the interpreter lock released, and get its index, the number of paths submitted before it.  None once every submitted path has been announced.")
+				.def("num_pending", &TrackingSession<AMPTracker>::NumPending, "The number of paths submitted and not yet done.")
+				.def("close", &Close, "Stop taking paths, and finish those already submitted.")
+				;
+		}
+
+
+
 		void ExportConfigSettings()
 		{
 			using namespace bertini::tracking::config;
@@ -184,6 +500,9 @@ namespace bertini{
 				.value("RKCashKarp45", Predictor::RKCashKarp45)
 				.value("RKDormandPrince56", Predictor::RKDormandPrince56)
 				.value("RKVerner67", Predictor::RKVerner67)
+				.value("Pade", Predictor::Pade)
+				.value("Taylor", Predictor::Taylor)
+				.value("Hermite", Predictor::Hermite)
 				;
 
 			enum_<SuccessCode>("SuccessCode")
@@ -232,6 +551,10 @@ namespace bertini{
 				class_<Newton, std::shared_ptr<Newton> >("Newton", init<>())
 					.def_readwrite("max_num_newton_iterations", &Newton::max_num_newton_iterations)
 					.def_readwrite("min_num_newton_iterations", &Newton::min_num_newton_iterations)
+					.def_readwrite("lu_refinement_steps", &Newton::lu_refinement_steps)
+					.def_readwrite("mixed_precision_solve", &Newton::mixed_precision_solve)
+					.def_readwrite("mixed_precision_min_digits", &Newton::mixed_precision_min_digits)
+					.def_readwrite("max_mixed_precision_refinements", &Newton::max_mixed_precision_refinements)
 					;
 				
 				
@@ -241,6 +564,19 @@ namespace bertini{
 
 				
 				
+				class_<ArithmeticCostModel>("ArithmeticCostModel", init<>())
+					.def("set", &ArithmeticCostModel::Set, "Set the cost of multiple precision arithmetic at a precision in digits, relative to double.")
+					.def("cost", &ArithmeticCostModel::Cost, "The cost of arithmetic at a precision in digits, relative to double, interpolated between those set, or analytic if none are.")
+					.def("clear", &ArithmeticCostModel::Clear, "Forget the costs set, going back to the analytic model.")
+					.def("is_calibrated", &ArithmeticCostModel::IsCalibrated)
+					.def("costs", &ArithmeticCosts, "The costs set, as a dict from precision to relative cost.")
+					.def("analytic", &ArithmeticCostModel::Analytic).staticmethod("analytic")
+					;
+
+				def("calibrate_arithmetic_cost", &CalibrateArithmeticCostFromList,
+				    (arg("system"), arg("precisions")=list(), arg("min_seconds")=0.01),
+				    "Time evaluation, the Jacobian and a linear solve of a system in double precision and at each of the precisions, making an ArithmeticCostModel of the ratios.  Releases the interpreter lock while timing.");
+
 				class_<AdaptiveMultiplePrecisionConfig, std::shared_ptr<AdaptiveMultiplePrecisionConfig> >("AMPConfig", init<>())
 					.def(init<System const&>())
 					.def("set_amp_config_from", &AdaptiveMultiplePrecisionConfig::SetAMPConfigFrom)
@@ -256,6 +592,7 @@ namespace bertini{
 					.def_readwrite("maximum_precision", &AdaptiveMultiplePrecisionConfig::maximum_precision)
 					.def_readwrite("consecutive_successful_steps_before_precision_decrease", &AdaptiveMultiplePrecisionConfig::consecutive_successful_steps_before_precision_decrease)
 					.def_readwrite("max_num_precision_decreases", &AdaptiveMultiplePrecisionConfig::max_num_precision_decreases)
+					.def_readwrite("arithmetic_cost", &AdaptiveMultiplePrecisionConfig::arithmetic_cost)
 					.def_readwrite("coefficient_bound", &AdaptiveMultiplePrecisionConfig::coefficient_bound)
 					;
 				
@@ -0,0 +1,71 @@
+# This file is part of Bertini 2.
+# 
+# python/test/eigen_test.py is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# 
+# python/test/eigen_test.py is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with python/test/eigen_test.py.  If not, see <http://www.gnu.org/licenses/>.
+# 
+#  Copyright(C) 2016 by Bertini2 Development Team
+# 
+#  See <http://www.gnu.org/licenses/> for a copy of the license, 
+#  as well as COPYING.  Bertini2 is provided with permitted 
+#  additional terms in the b2/licenses/ directory.
+
+#  individual authors of this file include:
+#   Daniel Brake
+#   University of Notre Dame
+#   Fall 2016
+# 
+
+
+from pybertini import *
+import unittest
+import numpy as np
+
+
+class EigenTransfer(unittest.TestCase):
+    def test_vector_d_is_viewed_not_copied(self):
+        v = VectorXd([complex(1,2), complex(3,-4), complex(5,0)]);
+        a = np.asarray(v);
+        self.assertEqual(a.shape, (3,))
+        self.assertEqual(a.dtype, np.complex128)
+        self.assertEqual(a[1], complex(3,-4))
+        a[2] = complex(0,7);
+        self.assertEqual(v[2], complex(0,7))
+
+    def test_matrix_d_is_viewed_column_major(self):
+        m = MatrixXd([[complex(1,0), complex(2,0)], [complex(3,0), complex(4,0)], [complex(5,0), complex(6,0)]]);
+        a = np.asarray(m);
+        self.assertEqual(a.shape, (3,2))
+        for ii in range(3):
+            for jj in range(2):
+                self.assertEqual(a[ii,jj], m[ii,jj])
+
+    def test_vector_mp_pack_round_trip(self):
+        default_precision(50);
+        v = VectorXmp([mpfr_complex("1.2345678901234567890123456789","-3"), mpfr_complex("0","0"), mpfr_complex("-1e-300","1e300")]);
+        packed = v.pack();
+        default_precision(16);
+        w = VectorXmp.unpack(packed);
+        default_precision(50);
+        self.assertEqual(w.rows(), 3)
+        for ii in range(3):
+            self.assertEqual(w[ii], v[ii])
+        default_precision(16);
+
+    def test_vector_mp_unpack_rejects_garbage(self):
+        with self.assertRaises(Exception):
+            VectorXmp.unpack(b"not a vector")
+
+
+
+if __name__ == '__main__':
+    unittest.main();
@@ -35,6 +35,7 @@ from pybertini.function_tree.root import *
 from pybertini.function_tree import *
 import unittest
 import numpy as np
+import pickle
 import pdb
 
 
@@ -161,6 +162,27 @@ class SystemTest(unittest.TestCase):
 
 
 
+    def test_eval_many_matches_eval(self):
+        s = parse_system('function f1, f2; variable_group x,y; f1 = x*y - 1; f2 = x^2 + y;')
+        #
+        points = MatrixXd.Zero(5,2);
+        for ii in range(5):
+            points[ii,0] = complex(ii, 0.5); points[ii,1] = complex(-1.5, ii);
+        #
+        values = s.eval_many(points, 2);
+        jacobians = s.jacobian_many(points, 2);
+        self.assertEqual(values.rows(), 5)
+        self.assertEqual(jacobians.rows(), 10)
+        for ii in range(5):
+            v = VectorXd((points[ii,0], points[ii,1]));
+            e = s.eval(v);
+            J = s.jacobian(v);
+            for jj in range(2):
+                self.assertLessEqual(np.abs(values[ii,jj] - e[jj]), self.toldbl*(1+np.abs(e[jj])));
+                for kk in range(2):
+                    self.assertLessEqual(np.abs(jacobians[2*ii+jj,kk] - J[jj,kk]), self.toldbl*(1+np.abs(J[jj,kk])));
+
+
     def test_add_systems(self):
         x = self.x;  y = self.y;
         s1 = System(); s2 = System();
@@ -206,6 +228,36 @@ class SystemTest(unittest.TestCase):
         self.assertLessEqual(np.abs(sysEval[1].imag / (-37.5584)-1), tol_d)
 
 
+    def test_pickle_round_trip(self):
+        sys = parse_system('function f1, f2; variable_group x,y,z; f1 = x*y+2; f2 = y*y - z;')
+        sys.homogenize()
+        sys.auto_patch()
+        #
+        state = pickle.dumps(sys, pickle.HIGHEST_PROTOCOL)
+        copy = pickle.loads(state)
+        #
+        self.assertTrue(copy.is_patched())
+        self.assertEqual(copy.num_variables(), sys.num_variables())
+        vals = VectorXd((complex(-2.43,.21 ),complex(4.84, -1.94),complex(-6.48, -.731),complex(1.2, .3)))
+        e = sys.eval(vals)
+        e_copy = copy.eval(vals)
+        for ii in range(sys.num_functions()):
+            self.assertLessEqual(np.abs(e[ii] - e_copy[ii]), self.toldbl*np.abs(e[ii]))
+
+
+    def test_memory_report(self):
+        sys = parse_system('function f1, f2; variable_group x,y; f1 = x*y+2; f2 = y*y - x;')
+        sys.homogenize()
+        sys.auto_patch()
+        sys.differentiate()
+        report = sys.memory_report()
+        #
+        self.assertGreater(report.count('function_trees'), 0)
+        self.assertGreater(report.count('jacobian_trees'), 0)
+        self.assertGreater(report.bytes('patch'), 0)
+        self.assertEqual(report.total_bytes(), sum(c[1] for c in report.components()))
+
+
 
 if __name__ == '__main__':
     unittest.main();
@@ -228,6 +228,128 @@ class AMPTrackingTest(unittest.TestCase):
         self.assertEqual(y_end.rows(), 0)
 
 
+    def test_refine_all(self):
+        default_precision(30);
+        y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(y);
+        s.add_function(y**2 - 2 - t);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        ampconfig = amp_config_from(s);
+        newton_pref = Newton();
+
+        refine_pref = RefineAllConfig();
+        refine_pref.tolerance = 1e-45;
+        refine_pref.max_iterations = 10;
+        refine_pref.precision = 60;
+
+        points = [VectorXmp([mpfr_complex("1.41","0")]), VectorXmp([mpfr_complex("-1.42","0")]), VectorXmp([mpfr_complex("1.4142","0")])];
+
+        refined = refine_all(s, points, mpfr_complex(0), newton_pref, ampconfig, refine_pref, 2);
+
+        self.assertEqual(len(refined), 3)
+        for ii in range(3):
+            self.assertEqual(refined[ii].index, ii)
+            self.assertTrue(refined[ii].success_code == SuccessCode.Success)
+            self.assertGreaterEqual(refined[ii].precision, 60)
+            default_precision(refined[ii].precision);
+            self.assertLessEqual(norm(refined[ii].point[0]*refined[ii].point[0] - mpfr_complex(2)), mpfr_float("1e-40"))
+        default_precision(30);
+
+
+    def test_track_paths(self):
+        default_precision(30);
+        y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(y);
+        s.add_function(y**2 - 1 - 3*t);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        ampconfig = amp_config_from(s);
+        stepping_pref = Stepping_mp();
+        newton_pref = Newton();
+
+        start_points = [VectorXmp([mpfr_complex("2","0")]), VectorXmp([mpfr_complex("-2","0")])];
+
+        endpoints, codes = track_paths(s, start_points, mpfr_complex(1), mpfr_complex(0),
+                                       mpfr_float("1e-5"), mpfr_float("1e5"), stepping_pref, newton_pref, ampconfig, 2);
+
+        self.assertEqual(len(endpoints), 2)
+        self.assertEqual(len(codes), 2)
+        for ii in range(2):
+            self.assertTrue(codes[ii] == SuccessCode.Success)
+        self.assertLessEqual(norm(endpoints[0][0] - mpfr_complex(1)), mpfr_float("1e-5"))
+        self.assertLessEqual(norm(endpoints[1][0] + mpfr_complex(1)), mpfr_float("1e-5"))
+
+
+    def test_calibrated_arithmetic_cost(self):
+        default_precision(30);
+        y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(y);
+        s.add_function(y**2 - 1 - 3*t);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        model = calibrate_arithmetic_cost(s, [20, 40], 0.001);
+        self.assertTrue(model.is_calibrated())
+        self.assertEqual(sorted(model.costs().keys()), [20, 40])
+        self.assertEqual(default_precision(), 30)
+
+        ampconfig = amp_config_from(s);
+        ampconfig.arithmetic_cost = model;
+
+        endpoints, codes = track_paths(s, [VectorXmp([mpfr_complex("2","0")])], mpfr_complex(1), mpfr_complex(0),
+                                       mpfr_float("1e-5"), mpfr_float("1e5"), Stepping_mp(), Newton(), ampconfig, 1);
+
+        self.assertTrue(codes[0] == SuccessCode.Success)
+        self.assertLessEqual(norm(endpoints[0][0] - mpfr_complex(1)), mpfr_float("1e-5"))
+
+
+    def test_tracking_session(self):
+        default_precision(30);
+        y = self.y; t = self.t;
+        s = System();
+
+        vars = VariableGroup();
+        vars.append(y);
+        s.add_function(y**2 - 1 - 3*t);
+        s.add_path_variable(t);
+        s.add_variable_group(vars);
+
+        ampconfig = amp_config_from(s);
+        stepping_pref = Stepping_mp();
+        newton_pref = Newton();
+
+        session = TrackingSession(s, mpfr_complex(1), mpfr_complex(0), mpfr_float("1e-5"), mpfr_float("1e5"),
+                                  stepping_pref, newton_pref, ampconfig, 2);
+
+        futures = [session.submit(VectorXmp([mpfr_complex(2 if ii%2==0 else -2)])) for ii in range(4)];
+
+        announced = [];
+        index = session.next_completed();
+        while index is not None:
+            announced.append(index);
+            index = session.next_completed();
+
+        self.assertEqual(sorted(announced), [0,1,2,3])
+        for ii in range(4):
+            self.assertTrue(futures[ii].done())
+            r = futures[ii].result();
+            self.assertEqual(r.index, ii)
+            self.assertTrue(r.success_code == SuccessCode.Success)
+            self.assertLessEqual(norm(r.endpoint[0] - mpfr_complex(1 if ii%2==0 else -1)), mpfr_float("1e-5"))
+        session.close();
+
 
 if __name__ == '__main__':
     unittest.main();